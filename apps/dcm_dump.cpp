@@ -1,4 +1,5 @@
 #include <iostream>
+#include <string>
 
 #include "boost/core/ignore_unused.hpp"
 
@@ -25,14 +26,17 @@ public:
   void OnElementEnd(dcm::DataElement* data_element) override;
 
   void OnSequenceStart(dcm::DataSequence* data_sequence) override;
-  void OnSequenceEnd(dcm::DataElement* data_element = nullptr) override;
+  void OnSequenceEnd(bool delimited) override;
 
-  void OnSequenceItemStart(dcm::DataElement* data_element) override;
-  void OnSequenceItemEnd(dcm::DataElement* data_element = nullptr) override;
+  void OnSequenceItemStart(std::uint32_t length) override;
+  void OnSequenceItemEnd(bool delimited) override;
 
 private:
   void PrintIndent();
 
+  // Print a sequence item prefix or delimitation.
+  void PrintDelimiter(dcm::Tag tag, std::uint32_t length);
+
 private:
   std::ostream& os_;
   std::string indent_;
@@ -76,54 +80,34 @@ void DumpReadHandler::OnSequenceStart(dcm::DataSequence* data_sequence) {
   ++level_;
 }
 
-void DumpReadHandler::OnSequenceEnd(dcm::DataElement* data_element) {
+void DumpReadHandler::OnSequenceEnd(bool delimited) {
   LOG_INFO("OnSequenceEnd");
 
-  if (data_element != nullptr) {
+  if (delimited) {
     // Sequence delimitation tag read.
-    assert(data_element->tag() == dcm::tags::kSeqDelimatation);
-
-    PrintIndent();
-
-    Print(os_, data_element);
-    os_ << std::endl;
-
-    delete data_element;
-  } else {
-    // Sequence ended.
-    --level_;
+    PrintDelimiter(dcm::tags::kSeqDelimatation, 0);
   }
+
+  --level_;
 }
 
-void DumpReadHandler::OnSequenceItemStart(dcm::DataElement* data_element) {
+void DumpReadHandler::OnSequenceItemStart(std::uint32_t length) {
   LOG_INFO("OnSequenceItemStart");
 
-  PrintIndent();
+  PrintDelimiter(dcm::tags::kSeqItemPrefix, length);
 
-  Print(os_, data_element);
-  os_ << std::endl;
-
-  delete data_element;
   ++level_;
 }
 
-void DumpReadHandler::OnSequenceItemEnd(dcm::DataElement* data_element) {
+void DumpReadHandler::OnSequenceItemEnd(bool delimited) {
   LOG_INFO("OnSequenceItemEnd");
 
-  if (data_element != nullptr) {
+  if (delimited) {
     // Sequence item delimitation tag read.
-    assert(data_element->tag() == dcm::tags::kSeqItemDelimatation);
-
-    PrintIndent();
-
-    Print(os_, data_element);
-    os_ << std::endl;
-
-    delete data_element;
-  } else {
-    // Sequence item ended.
-    --level_;
+    PrintDelimiter(dcm::tags::kSeqItemDelimatation, 0);
   }
+
+  --level_;
 }
 
 void DumpReadHandler::PrintIndent() {
@@ -132,6 +116,16 @@ void DumpReadHandler::PrintIndent() {
   }
 }
 
+void DumpReadHandler::PrintDelimiter(dcm::Tag tag, std::uint32_t length) {
+  dcm::DataElement data_element(tag, dcm::VR::UN);
+  data_element.set_length(length);
+
+  PrintIndent();
+
+  Print(os_, &data_element);
+  os_ << std::endl;
+}
+
 // -----------------------------------------------------------------------------
 
 int main(int argc, char* argv[]) {
@@ -140,17 +134,26 @@ int main(int argc, char* argv[]) {
                  "into memory." << std::endl;
     std::cout << "Usage:" << std::endl;
     std::cout << "  " << argv[0] << " <file path>" << std::endl;
+    std::cout << "Use - as the file path to read from stdin, e.g.:" << std::endl;
+    std::cout << "  cat <file path> | " << argv[0] << " -" << std::endl;
     return 1;
   }
 
   DCM_LOG_INIT("", dcm::LOG_CONSOLE);
 
-  const char* path = argv[1];
+  const std::string path = argv[1];
 
   DumpReadHandler read_handler(std::cout);
   dcm::DicomReader reader(&read_handler);
 
-  if (!reader.ReadFile(path)) {
+  bool ok = false;
+  if (path == "-") {
+    ok = reader.ReadStream(&std::cin);
+  } else {
+    ok = reader.ReadFile(path);
+  }
+
+  if (!ok) {
     std::cerr << "Failed to read file." << std::endl;
     return 1;
   }
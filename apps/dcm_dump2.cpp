@@ -56,17 +56,22 @@ void DumpVisitor::VisitDataSequence(const dcm::DataSequence* data_sequence) {
   for (std::size_t i = 0; i < data_sequence->size(); ++i) {
     const auto& item = data_sequence->At(i);
 
-    VisitDataElement(item.prefix);
+    dcm::DataElement prefix(dcm::tags::kSeqItemPrefix, dcm::VR::UN);
+    prefix.set_length(item.length);
+    VisitDataElement(&prefix);
 
     VisitDataSet(item.data_set);
 
-    if (item.delimitation != nullptr) {
-      VisitDataElement(item.delimitation);
+    if (item.delimited) {
+      dcm::DataElement delimitation(dcm::tags::kSeqItemDelimatation,
+                                    dcm::VR::UN);
+      VisitDataElement(&delimitation);
     }
   }
 
-  if (data_sequence->delimitation() != nullptr) {
-    VisitDataElement(data_sequence->delimitation());
+  if (data_sequence->delimited()) {
+    dcm::DataElement delimitation(dcm::tags::kSeqDelimatation, dcm::VR::UN);
+    VisitDataElement(&delimitation);
   }
 
   --level_;
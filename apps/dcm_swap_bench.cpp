@@ -0,0 +1,88 @@
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "dcm/util.h"
+
+// -----------------------------------------------------------------------------
+
+typedef void (*SwapFunc)(void* values, std::size_t size, std::size_t count);
+
+// Swap |length| bytes of |data| |rounds| times, return the throughput in GB/s.
+static double Measure(SwapFunc swap, char* data, std::size_t length,
+                      std::size_t size, int rounds) {
+  const std::size_t count = length / size;
+
+  // Warm up, e.g., touch the pages.
+  swap(data, size, count);
+
+  auto start = std::chrono::steady_clock::now();
+
+  for (int i = 0; i < rounds; ++i) {
+    swap(data, size, count);
+  }
+
+  std::chrono::duration<double> seconds =
+      std::chrono::steady_clock::now() - start;
+
+  const double bytes = static_cast<double>(length) * rounds;
+  return bytes / seconds.count() / 1e9;
+}
+
+// -----------------------------------------------------------------------------
+
+int main(int argc, char* argv[]) {
+  if (argc > 2) {
+    std::cout << "Measure the throughput of byte swapping." << std::endl;
+    std::cout << "Usage:" << std::endl;
+    std::cout << "  " << argv[0] << " [buffer size in MiB, default 64]"
+              << std::endl;
+    return 1;
+  }
+
+  std::size_t mib = 64;
+  if (argc == 2) {
+    mib = std::strtoul(argv[1], nullptr, 10);
+    if (mib == 0) {
+      std::cerr << "Invalid buffer size." << std::endl;
+      return 1;
+    }
+  }
+
+  const std::size_t length = mib * 1024 * 1024;
+
+  // Plus 1 byte so that the same bytes could also be swapped from offset 1 to
+  // measure the unaligned case.
+  std::vector<char> storage(length + 1);
+  for (std::size_t i = 0; i < storage.size(); ++i) {
+    storage[i] = static_cast<char>(i);
+  }
+
+  const int kRounds = 10;
+
+  std::cout << "Buffer: " << mib << " MiB, kernel: "
+            << dcm::util::GetSwapKernelName() << std::endl;
+
+  std::cout << std::fixed << std::setprecision(2);
+
+  for (std::size_t offset : { 0, 1 }) {
+    char* data = storage.data() + offset;
+
+    std::cout << (offset == 0 ? "Aligned:" : "Unaligned (offset 1):")
+              << std::endl;
+
+    for (std::size_t size : { 2, 4, 8 }) {
+      double scalar =
+          Measure(dcm::util::SwapBytesScalar, data, length, size, kRounds);
+      double simd = Measure(dcm::util::SwapBytes, data, length, size, kRounds);
+
+      std::cout << "  " << size * 8 << "-bit: scalar " << scalar << " GB/s, "
+                << dcm::util::GetSwapKernelName() << " " << simd << " GB/s ("
+                << simd / scalar << "x)" << std::endl;
+    }
+  }
+
+  return 0;
+}
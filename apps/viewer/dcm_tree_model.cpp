@@ -215,16 +215,22 @@ void DcmTreeModel::SetupModelData(const dcm::DataSequence* data_sequence,
   for (std::size_t i = 0; i < data_sequence->size(); ++i) {
     const auto& data_item = data_sequence->At(i);
 
-    if (data_item.prefix != nullptr) {
-      QList<QVariant> column_data = GetColumnData(data_item.prefix);
+    {
+      dcm::DataElement prefix(dcm::tags::kSeqItemPrefix, dcm::VR::UN);
+      prefix.set_length(data_item.length);
+
+      QList<QVariant> column_data = GetColumnData(&prefix);
       DcmTreeItem* item = new DcmTreeItem(column_data, parent_item);
       parent_item->AppendChild(item);
     }
 
     SetupModelData(data_sequence->At(i).data_set, parent_item);
 
-    if (data_item.delimitation != nullptr) {
-      QList<QVariant> column_data = GetColumnData(data_item.delimitation);
+    if (data_item.delimited) {
+      dcm::DataElement delimitation(dcm::tags::kSeqItemDelimatation,
+                                    dcm::VR::UN);
+
+      QList<QVariant> column_data = GetColumnData(&delimitation);
       DcmTreeItem* item = new DcmTreeItem(column_data, parent_item);
       parent_item->AppendChild(item);
     }
@@ -0,0 +1,79 @@
+#include "dcm/arena.h"
+
+#include <algorithm>  // for std::max, std::min
+#include <cassert>
+#include <cstdint>  // for std::uintptr_t
+
+namespace dcm {
+
+const std::size_t Arena::kMinBlockSize;
+const std::size_t Arena::kMaxBlockSize;
+
+Arena::~Arena() {
+  for (Block& block : blocks_) {
+    delete[] block.data;
+  }
+}
+
+void* Arena::Allocate(std::size_t size, std::size_t alignment) {
+  assert(alignment > 0 && (alignment & (alignment - 1)) == 0);
+
+  // Keep the returned pointers distinct.
+  if (size == 0) {
+    size = 1;
+  }
+
+  if (ptr_ != nullptr) {
+    std::uintptr_t address = reinterpret_cast<std::uintptr_t>(ptr_);
+    std::size_t padding = (alignment - (address & (alignment - 1))) &
+                          (alignment - 1);
+
+    if (padding <= static_cast<std::size_t>(end_ - ptr_) &&
+        size <= static_cast<std::size_t>(end_ - ptr_) - padding) {
+      char* p = ptr_ + padding;
+      ptr_ = p + size;
+      return p;
+    }
+  }
+
+  // The blocks from new[] are aligned for any fundamental type.
+  assert(alignment <= alignof(std::max_align_t));
+
+  if (size > next_block_size_ / 2) {
+    // A large allocation (e.g., the value of Pixel Data) takes a block of its
+    // own, so that the rest of the current block is not wasted.
+    return AddBlock(size);
+  }
+
+  char* p = AddBlock(next_block_size_);
+  ptr_ = p + size;
+  end_ = p + next_block_size_;
+
+  next_block_size_ = std::min(next_block_size_ * 2, kMaxBlockSize);
+
+  return p;
+}
+
+bool Arena::Owns(const void* p) const {
+  const char* c = static_cast<const char*>(p);
+
+  // The pointers might be to unrelated objects, compare them by std::less
+  // which gives a total order.
+  std::less<const char*> less;
+
+  for (const Block& block : blocks_) {
+    if (!less(c, block.data) && less(c, block.data + block.size)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+char* Arena::AddBlock(std::size_t size) {
+  char* data = new char[size];
+  blocks_.push_back({ data, size });
+  size_ += size;
+  return data;
+}
+
+}  // namespace dcm
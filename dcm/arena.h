@@ -0,0 +1,97 @@
+#ifndef DCM_ARENA_H_
+#define DCM_ARENA_H_
+
+#include <cstddef>
+#include <functional>  // for std::less
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace dcm {
+
+// A monotonic allocator: the memory is carved out of a few large blocks and
+// only released, all at once, when the arena is destroyed.
+//
+// Used to load a whole data set tree (elements, item data sets and values)
+// without allocating them one by one, see LoadOptions::use_arena.
+// The arena is shared (std::shared_ptr) by the data sets and the value buffers
+// referring to it, see Buffer::View().
+//
+// NOTE: Not thread-safe.
+class Arena {
+public:
+  // Size of the first block.
+  static const std::size_t kMinBlockSize = 64 * 1024;
+
+  // The blocks grow up to this size.
+  static const std::size_t kMaxBlockSize = 4 * 1024 * 1024;
+
+  Arena() = default;
+
+  ~Arena();
+
+  Arena(const Arena&) = delete;
+  Arena& operator=(const Arena&) = delete;
+
+  // Allocate |size| bytes aligned to |alignment| (a power of 2).
+  void* Allocate(std::size_t size,
+                 std::size_t alignment = alignof(std::max_align_t));
+
+  // Is the pointer allocated from this arena?
+  // Linear in the number of blocks, meant for checks (e.g., in tests) only.
+  bool Owns(const void* p) const;
+
+  // The number of blocks allocated.
+  std::size_t block_count() const { return blocks_.size(); }
+
+  // Total size of the blocks allocated.
+  std::size_t size() const { return size_; }
+
+private:
+  struct Block {
+    char* data;
+    std::size_t size;
+  };
+
+  // Allocate a new block of at least |size| bytes and return it.
+  char* AddBlock(std::size_t size);
+
+private:
+  std::vector<Block> blocks_;
+
+  // The free range of the current block.
+  char* ptr_ = nullptr;
+  char* end_ = nullptr;
+
+  std::size_t next_block_size_ = kMinBlockSize;
+
+  std::size_t size_ = 0;
+};
+
+// Create an object from the arena, or from the heap if |arena| is null.
+template <typename T, typename... Args>
+T* ArenaNew(Arena* arena, Args&&... args) {
+  if (arena == nullptr) {
+    return new T(std::forward<Args>(args)...);
+  }
+  void* p = arena->Allocate(sizeof(T), alignof(T));
+  return new (p) T(std::forward<Args>(args)...);
+}
+
+// Destroy an object created by ArenaNew() with the same |arena|, or by the
+// plain operator new if |arena| is null. The owner has to remember which one
+// it is, see DataElement::from_arena().
+// The memory of an object from the arena is not released until the arena is
+// destroyed.
+template <typename T>
+void ArenaDelete(Arena* arena, T* object) {
+  if (arena != nullptr) {
+    object->~T();
+  } else {
+    delete object;
+  }
+}
+
+}  // namespace dcm
+
+#endif  // DCM_ARENA_H_
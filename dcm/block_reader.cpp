@@ -0,0 +1,177 @@
+#include "dcm/block_reader.h"
+
+#include <algorithm>  // for std::min
+
+#include "dcm/logger.h"
+
+namespace dcm {
+
+const std::size_t BlockReader::kDefaultBlockSize;
+const std::size_t BlockReader::kLookBackSize;
+
+BlockReader::BlockReader(std::istream* istream, std::size_t block_size)
+    : istream_(istream),
+      seekable_(false),
+      failed_(false),
+      block_size_(block_size),
+      window_(kLookBackSize + block_size),
+      pos_(0),
+      size_(0),
+      offset_(0) {
+  assert(block_size > 0);
+
+  if (istream_ != nullptr) {
+    // tellg() fails (returns -1) for non-seekable streams.
+    offset_ = istream_->tellg();
+    if (offset_ >= 0) {
+      seekable_ = true;
+    } else {
+      istream_->clear();
+      offset_ = 0;
+    }
+  }
+}
+
+void BlockReader::Seek(long offset, std::ios::seekdir dir) {
+  assert(istream_ != nullptr);
+
+  if (failed_) {
+    return;
+  }
+
+  if (dir == std::ios::end) {
+    if (!seekable_) {
+      LOG_ERRO("Can't seek from the end of a non-seekable stream.");
+      Fail();
+      return;
+    }
+
+    istream_->clear();
+    istream_->seekg(offset, std::ios::end);
+
+    // Drop the window.
+    offset_ = istream_->tellg();
+    pos_ = size_ = 0;
+    return;
+  }
+
+  std::streamoff target = offset;
+  if (dir == std::ios::cur) {
+    target += offset_ + static_cast<std::streamoff>(pos_);
+  }
+
+  if (target >= offset_ &&
+      target <= offset_ + static_cast<std::streamoff>(size_)) {
+    // Within the window.
+    pos_ = static_cast<std::size_t>(target - offset_);
+    return;
+  }
+
+  if (seekable_) {
+    istream_->clear();
+    istream_->seekg(target, std::ios::beg);
+
+    // Drop the window.
+    offset_ = target;
+    pos_ = size_ = 0;
+    return;
+  }
+
+  if (target < offset_) {
+    LOG_ERRO("Can't seek backward beyond the look-back window of a "
+             "non-seekable stream.");
+    Fail();
+    return;
+  }
+
+  Skip(target - (offset_ + static_cast<std::streamoff>(pos_)));
+}
+
+std::streamsize BlockReader::ReadBytesSlow(void* bytes, std::size_t count) {
+  char* dst = static_cast<char*>(bytes);
+
+  // Drain the window.
+  std::size_t done = size_ - pos_;
+  if (done > 0) {
+    std::memcpy(dst, window_.data() + pos_, done);
+    pos_ = size_;
+  }
+
+  while (done < count) {
+    std::size_t remaining = count - done;
+
+    if (remaining >= block_size_) {
+      // Too large for the window, read directly.
+      if (failed_) {
+        break;
+      }
+
+      istream_->read(dst + done, remaining);
+      std::size_t read_count = static_cast<std::size_t>(istream_->gcount());
+
+      offset_ += size_ + read_count;
+      pos_ = size_ = 0;
+
+      done += read_count;
+      break;
+    }
+
+    if (!Fill()) {
+      break;
+    }
+
+    std::size_t n = std::min(remaining, size_ - pos_);
+    std::memcpy(dst + done, window_.data() + pos_, n);
+    pos_ += n;
+    done += n;
+  }
+
+  return static_cast<std::streamsize>(done);
+}
+
+bool BlockReader::Fill() {
+  if (failed_) {
+    return false;
+  }
+
+  // Keep the tail of the current window for looking back.
+  std::size_t keep = std::min(size_, kLookBackSize);
+  if (keep > 0) {
+    std::memmove(window_.data(), window_.data() + size_ - keep, keep);
+  }
+
+  offset_ += size_ - keep;
+
+  istream_->read(window_.data() + keep, block_size_);
+
+  std::size_t read_count = static_cast<std::size_t>(istream_->gcount());
+
+  size_ = keep + read_count;
+  pos_ = keep;
+
+  return read_count > 0;
+}
+
+void BlockReader::Skip(std::streamoff count) {
+  while (count > 0) {
+    std::streamoff available = static_cast<std::streamoff>(size_ - pos_);
+    if (count <= available) {
+      pos_ += static_cast<std::size_t>(count);
+      return;
+    }
+
+    count -= available;
+    pos_ = size_;
+
+    if (!Fill()) {
+      return;  // End of stream.
+    }
+  }
+}
+
+void BlockReader::Fail() {
+  failed_ = true;
+  pos_ = size_ = 0;
+}
+
+}  // namespace dcm
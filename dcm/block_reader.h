@@ -0,0 +1,100 @@
+#ifndef DCM_BLOCK_READER_H_
+#define DCM_BLOCK_READER_H_
+
+#include <cstring>  // std::memcpy
+#include <vector>
+
+#include "dcm/reader.h"
+
+namespace dcm {
+
+// A reader pulling large blocks from an input stream into its own window.
+//
+// Small reads (tags, VRs, value lengths) are served straight from the window,
+// and the stream is only touched when the window runs out. Seeking within the
+// window (e.g., UndoRead()) doesn't touch the stream at all. Reads larger than
+// a block bypass the window.
+//
+// The stream doesn't have to be seekable (e.g., a pipe or a socket). In that
+// case, seeking forward skips the bytes by reading them, and seeking backward
+// is only possible within the window. When the window is refilled, the last
+// |kLookBackSize| bytes are kept so that a short UndoRead() always works.
+class BlockReader : public Reader {
+public:
+  static const std::size_t kDefaultBlockSize = 64 * 1024;
+
+  // Number of bytes kept from the previous block on refilling.
+  static const std::size_t kLookBackSize = 256;
+
+  // The stream is checked to see if it's seekable or not.
+  explicit BlockReader(std::istream* istream,
+                       std::size_t block_size = kDefaultBlockSize);
+
+  ~BlockReader() override = default;
+
+  bool IsOk() const override {
+    return istream_ != nullptr && !istream_->bad() && !failed_;
+  }
+
+  bool seekable() const { return seekable_; }
+
+  void Seek(long offset, std::ios::seekdir dir = std::ios::beg) override;
+
+  // Relative to the stream position when this reader was created if the stream
+  // is not seekable.
+  std::streamoff Tell() const override {
+    return offset_ + static_cast<std::streamoff>(pos_);
+  }
+
+  std::streamsize ReadBytes(void* bytes, std::size_t count) override {
+    if (count <= size_ - pos_) {
+      std::memcpy(bytes, window_.data() + pos_, count);
+      pos_ += count;
+      return static_cast<std::streamsize>(count);
+    }
+    return ReadBytesSlow(bytes, count);
+  }
+
+private:
+  // Read across the end of the window.
+  std::streamsize ReadBytesSlow(void* bytes, std::size_t count);
+
+  // Pull the next block from the stream into the window, keeping the last
+  // |kLookBackSize| bytes of the current window in front of it.
+  // Return false if no more bytes could be read.
+  bool Fill();
+
+  // Skip forward by reading (for non-seekable streams).
+  void Skip(std::streamoff count);
+
+  // Reading is not possible any more (e.g., seeking backward out of the window
+  // of a non-seekable stream).
+  void Fail();
+
+private:
+  std::istream* istream_;
+
+  bool seekable_;
+
+  bool failed_;
+
+  std::size_t block_size_;
+
+  // Look-back bytes + one block.
+  std::vector<char> window_;
+
+  // Read position in the window.
+  std::size_t pos_;
+
+  // Number of valid bytes in the window.
+  std::size_t size_;
+
+  // Offset of the first byte of the window, relative to the stream position
+  // when this reader was created if the stream is not seekable.
+  // The stream position is always |offset_| + |size_|.
+  std::streamoff offset_;
+};
+
+}  // namespace dcm
+
+#endif  // DCM_BLOCK_READER_H_
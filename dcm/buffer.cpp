@@ -0,0 +1,164 @@
+#include "dcm/buffer.h"
+
+#include <algorithm>  // for std::max
+#include <cstring>  // for memcpy, memset
+#include <limits>
+#include <new>  // for placement new
+#include <utility>  // for std::move
+
+namespace dcm {
+
+const std::size_t Buffer::kInlineSize;
+
+Buffer::Buffer(std::size_t size) : Buffer() {
+  resize(size);
+}
+
+Buffer::Buffer(const char* data, std::size_t size) : Buffer() {
+  Reserve(size, 0);
+  if (size > 0) {
+    std::memcpy(owned_data(), data, size);
+  }
+  size_ = static_cast<std::uint32_t>(size);
+}
+
+Buffer::Buffer(const Buffer& rhs) : Buffer() {
+  CopyFrom(rhs);
+}
+
+Buffer& Buffer::operator=(const Buffer& rhs) {
+  if (this != &rhs) {
+    CopyFrom(rhs);
+  }
+  return *this;
+}
+
+Buffer::Buffer(Buffer&& rhs) : Buffer() {
+  MoveFrom(rhs);
+}
+
+Buffer& Buffer::operator=(Buffer&& rhs) {
+  if (this != &rhs) {
+    MoveFrom(rhs);
+  }
+  return *this;
+}
+
+Buffer::~Buffer() {
+  Reset();
+}
+
+Buffer Buffer::View(const char* data, std::size_t size,
+                    std::shared_ptr<const void> keeper) {
+  assert(size <= std::numeric_limits<std::uint32_t>::max());
+
+  Buffer buffer;
+  if (size > 0) {
+    new (&buffer.view_) ViewBytes{ data, std::move(keeper) };
+    buffer.mode_ = VIEW;
+    buffer.size_ = static_cast<std::uint32_t>(size);
+  }
+  return buffer;
+}
+
+void Buffer::resize(std::size_t size) {
+  Detach();
+
+  Reserve(size, size_);
+
+  if (size > size_) {
+    std::memset(owned_data() + size_, 0, size - size_);
+  }
+  size_ = static_cast<std::uint32_t>(size);
+}
+
+void Buffer::clear() {
+  // Keep the heap bytes for reuse, like std::vector.
+  if (mode_ == VIEW) {
+    Reset();
+  }
+  size_ = 0;
+}
+
+void Buffer::Reserve(std::size_t size, std::size_t keep) {
+  assert(mode_ != VIEW);
+  assert(size <= std::numeric_limits<std::uint32_t>::max());
+
+  std::size_t capacity = mode_ == HEAP ? heap_.capacity : kInlineSize;
+  if (size <= capacity) {
+    return;
+  }
+
+  // Grow geometrically like std::vector, for repeated resizing.
+  capacity = std::max(size, mode_ == HEAP ? capacity * 2 : size);
+
+  char* heap = new char[capacity];
+  if (keep > 0) {
+    std::memcpy(heap, owned_data(), keep);
+  }
+
+  Reset();
+
+  heap_.data = heap;
+  heap_.capacity = capacity;
+  mode_ = HEAP;
+}
+
+void Buffer::Detach() {
+  if (mode_ == VIEW) {
+    // Keep the referred bytes alive until they are copied.
+    ViewBytes view = std::move(view_);
+    Reset();
+
+    Reserve(size_, 0);
+    std::memcpy(owned_data(), view.data, size_);
+  }
+}
+
+void Buffer::CopyFrom(const Buffer& rhs) {
+  clear();
+
+  if (rhs.mode_ == VIEW) {
+    Reset();
+    new (&view_) ViewBytes(rhs.view_);
+    mode_ = VIEW;
+  } else {
+    Reserve(rhs.size_, 0);
+    if (rhs.size_ > 0) {
+      std::memcpy(owned_data(), rhs.owned_data(), rhs.size_);
+    }
+  }
+
+  size_ = rhs.size_;
+}
+
+void Buffer::MoveFrom(Buffer& rhs) {
+  Reset();
+
+  if (rhs.mode_ == VIEW) {
+    new (&view_) ViewBytes(std::move(rhs.view_));
+    mode_ = VIEW;
+  } else if (rhs.mode_ == HEAP) {
+    heap_ = rhs.heap_;
+    mode_ = HEAP;
+    rhs.mode_ = INLINE;
+  } else if (rhs.size_ > 0) {
+    std::memcpy(inline_, rhs.inline_, rhs.size_);
+  }
+
+  size_ = rhs.size_;
+
+  rhs.Reset();
+  rhs.size_ = 0;
+}
+
+void Buffer::Reset() {
+  if (mode_ == HEAP) {
+    delete[] heap_.data;
+  } else if (mode_ == VIEW) {
+    view_.~ViewBytes();
+  }
+  mode_ = INLINE;
+}
+
+}  // namespace dcm
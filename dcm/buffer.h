@@ -0,0 +1,160 @@
+#ifndef DCM_BUFFER_H_
+#define DCM_BUFFER_H_
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace dcm {
+
+// Raw buffer (i.e., bytes) of a value.
+//
+// A buffer either owns its bytes, or refers to the bytes of a shared source
+// (e.g., a memory-mapped file) without copying them. In the latter case, the
+// source is kept alive by |keeper_| as long as the buffer refers to it.
+//
+// A buffer referring to a shared source is read-only. Any non-const access
+// copies the bytes into the buffer's own storage first (copy-on-write).
+//
+// The owned bytes of a small value (most of the values in a header, e.g., US,
+// DA, short strings) are stored inline without heap allocation.
+//
+// Only one of the inline bytes, the heap bytes and the referred bytes is used
+// at a time, so they share the same space like a small string. The size is
+// limited to 32 bits like a value length. A buffer takes 32 bytes on a 64-bit
+// platform.
+class Buffer {
+public:
+  // The max size of the bytes stored inline, i.e., the space of a view.
+  static const std::size_t kInlineSize = 24;
+
+  Buffer() : size_(0), mode_(INLINE) {
+  }
+
+  // The bytes are zero-initialized.
+  explicit Buffer(std::size_t size);
+
+  // Copy the given bytes.
+  Buffer(const char* data, std::size_t size);
+
+  Buffer(const Buffer& rhs);
+  Buffer& operator=(const Buffer& rhs);
+
+  Buffer(Buffer&& rhs);
+  Buffer& operator=(Buffer&& rhs);
+
+  ~Buffer();
+
+  // Create a buffer referring to the given bytes without copying them.
+  // \param keeper Keeps the bytes alive, e.g., a memory-mapped file.
+  static Buffer View(const char* data, std::size_t size,
+                     std::shared_ptr<const void> keeper);
+
+  // Does this buffer refer to the bytes of a shared source?
+  bool IsView() const { return mode_ == VIEW; }
+
+  // Are the owned bytes stored on the heap instead of inline?
+  bool IsOnHeap() const { return mode_ == HEAP; }
+
+  std::size_t size() const { return size_; }
+
+  bool empty() const { return size_ == 0; }
+
+  const char* data() const {
+    return IsView() ? view_.data : owned_data();
+  }
+
+  char* data() {
+    Detach();
+    return owned_data();
+  }
+
+  const char& operator[](std::size_t index) const {
+    assert(index < size());
+    return data()[index];
+  }
+
+  char& operator[](std::size_t index) {
+    assert(index < size());
+    return data()[index];
+  }
+
+  const char& back() const {
+    assert(!empty());
+    return data()[size() - 1];
+  }
+
+  // Resize the owned bytes; the new bytes are zero-initialized.
+  void resize(std::size_t size);
+
+  void clear();
+
+private:
+  // Which of the union members is used.
+  enum Mode : std::uint8_t {
+    INLINE,
+    HEAP,
+    VIEW,
+  };
+
+  struct HeapBytes {
+    char* data;
+    std::size_t capacity;
+  };
+
+  struct ViewBytes {
+    const char* data;
+
+    // Keeps the referred bytes alive.
+    std::shared_ptr<const void> keeper;
+  };
+
+  const char* owned_data() const {
+    assert(mode_ != VIEW);
+    return mode_ == HEAP ? heap_.data : inline_;
+  }
+
+  char* owned_data() {
+    assert(mode_ != VIEW);
+    return mode_ == HEAP ? heap_.data : inline_;
+  }
+
+  // Make the owned storage large enough for |size| bytes, keeping the first
+  // |keep| bytes.
+  void Reserve(std::size_t size, std::size_t keep);
+
+  // Copy the referred bytes into the owned storage.
+  void Detach();
+
+  // Copy the bytes (owned or referred) of |rhs|.
+  void CopyFrom(const Buffer& rhs);
+
+  // Take the bytes (owned or referred) of |rhs|, leaving it empty.
+  void MoveFrom(Buffer& rhs);
+
+  // Release the heap bytes or the view, and switch to the inline bytes.
+  void Reset();
+
+private:
+  // Size of the owned or referred bytes.
+  std::uint32_t size_;
+
+  Mode mode_;
+
+  union {
+    // Owned bytes stored inline (INLINE).
+    // Aligned for the views of numbers, see NumberView.
+    alignas(8) char inline_[kInlineSize];
+
+    // Owned bytes on the heap (HEAP).
+    HeapBytes heap_;
+
+    // Referred bytes (VIEW).
+    ViewBytes view_;
+  };
+};
+
+}  // namespace dcm
+
+#endif  // DCM_BUFFER_H_
@@ -1,38 +1,81 @@
 #include "dcm/data_dict.h"
 
-#include <algorithm>
+#include <algorithm>  // for std::lower_bound
+#include <atomic>
+#include <cstring>  // for strcmp
+#include <map>
+#include <memory>
+#include <mutex>
 
 namespace dcm {
 namespace dict {
 
 // -----------------------------------------------------------------------------
 
-struct VMEntry {
-  std::uint32_t tag;
-  VM vm;
-};
-
 #include "dcm/dict.inl"
 
-#include "dcm/dict_vm.inl"
-
 // -----------------------------------------------------------------------------
 
+static const std::uint16_t kNoEntry = 0xFFFF;
+
+static_assert(sizeof(g_dict) / sizeof(g_dict[0]) < kNoEntry,
+              "Too many entries for the 16-bit slots.");
+
+// The finalizer of MurmurHash3, see mix() in dict.py.
+static inline std::uint32_t Mix(std::uint32_t x) {
+  x ^= x >> 16;
+  x *= 0x85EBCA6B;
+  x ^= x >> 13;
+  x *= 0xC2B2AE35;
+  x ^= x >> 16;
+  return x;
+}
+
+// 32-bit FNV-1a hash of a string, see fnv1a() in dict.py.
+static inline std::uint32_t Fnv1a(const char* str) {
+  std::uint32_t h = 0x811C9DC5;
+  for (; *str != '\0'; ++str) {
+    h ^= static_cast<std::uint8_t>(*str);
+    h *= 0x01000193;
+  }
+  return h;
+}
+
+// Look up the perfect hash generated by dict.py: the bucket of the key gives
+// the displacement of its slot, which has the index of the entry (or kNoEntry).
+// The entry found must still be compared with the key.
+static inline std::uint16_t Lookup(std::uint32_t key,
+                                   const std::uint16_t* displacements,
+                                   const std::uint16_t* slots) {
+  const std::uint32_t displacement =
+      displacements[Mix(key) >> (32 - kBucketBits)];
+  return slots[Mix(key ^ (displacement * 0x9E3779B9)) >> (32 - kSlotBits)];
+}
+
 const Entry* GetEntry(Tag tag) {
-  auto less = [](const Entry& entry, std::uint32_t tag) {
-    return entry.tag < tag;
-  };
+  const std::uint32_t key = tag.ToUint32();
 
-  const auto end = g_dict + ARRAY_SIZE(g_dict);
+  const std::uint16_t index = Lookup(key, g_dict_displacements, g_dict_slots);
 
-  auto it = std::lower_bound(g_dict, end, tag.ToUint32(), less);
-  if (it != end && it->tag == tag) {
-    return it;
+  if (index != kNoEntry && g_dict[index].tag == key) {
+    return &g_dict[index];
   }
 
   return nullptr;
 }
 
+bool GetTag(const char* keyword, Tag* tag) {
+  const std::uint16_t index =
+      Lookup(Fnv1a(keyword), g_keyword_displacements, g_keyword_slots);
+
+  if (index != kNoEntry && std::strcmp(g_dict[index].keyword, keyword) == 0) {
+    *tag = g_dict[index].tag;
+    return true;
+  }
+
+  return false;
+}
+
 const char* GetName(Tag tag) {
   if (tag == tags::kSeqDelimatation) {
     return "Sequence Delimatation";
@@ -55,16 +98,10 @@ VR GetVR(Tag tag) {
 }
 
 const VM* GetVM(Tag tag) {
-  auto less = [](const VMEntry& entry, std::uint32_t tag) {
-    return entry.tag < tag;
-  };
-
-  const auto end = g_dict_vm + ARRAY_SIZE(g_dict_vm);
-
-  auto it = std::lower_bound(g_dict_vm, end, tag.ToUint32(), less);
+  const Entry* entry = GetEntry(tag);
 
-  if (it != end && it->tag == tag) {
-    return &it->vm;
+  if (entry != nullptr && entry->vm.max() != 1) {
+    return &entry->vm;
   }
 
   return nullptr;
@@ -81,5 +118,90 @@ bool CheckVM(Tag tag, std::size_t value) {
   return value == 1;
 }
 
+// -----------------------------------------------------------------------------
+
+// The latest snapshot of the private dictionaries, read without locking.
+// The entries of each creator are sorted by offset.
+static std::atomic<const PrivateDict*> g_private_dict(nullptr);
+
+// All the snapshots ever published. A snapshot is never changed or released
+// after it's published, since lookups might still be reading it.
+static std::vector<std::unique_ptr<const PrivateDict>> g_private_dicts;
+
+// Serializes the registrations.
+static std::mutex g_private_mutex;
+
+static bool OffsetLess(const PrivateEntry& entry, std::uint8_t offset) {
+  return entry.offset < offset;
+}
+
+// Remove the trailing spaces (the padding of LO) of the creator.
+static std::string TrimCreator(const std::string& creator) {
+  return creator.substr(0, creator.find_last_not_of(' ') + 1);
+}
+
+void RegisterPrivate(const PrivateDict& dict) {
+  std::lock_guard<std::mutex> lock(g_private_mutex);
+
+  const PrivateDict* current = g_private_dict.load(std::memory_order_relaxed);
+
+  std::unique_ptr<PrivateDict> new_dict(current != nullptr ?
+                                        new PrivateDict(*current) :
+                                        new PrivateDict);
+
+  for (auto& pair : dict) {
+    std::vector<PrivateEntry>& creator_entries =
+        (*new_dict)[TrimCreator(pair.first)];
+
+    for (const PrivateEntry& entry : pair.second) {
+      auto it = std::lower_bound(creator_entries.begin(),
+                                 creator_entries.end(), entry.offset,
+                                 OffsetLess);
+
+      if (it != creator_entries.end() && it->offset == entry.offset) {
+        *it = entry;
+      } else {
+        creator_entries.insert(it, entry);
+      }
+    }
+  }
+
+  g_private_dicts.push_back(std::move(new_dict));
+  g_private_dict.store(g_private_dicts.back().get(), std::memory_order_release);
+}
+
+void RegisterPrivate(const std::string& creator,
+                     const std::vector<PrivateEntry>& entries) {
+  RegisterPrivate(PrivateDict{ { creator, entries } });
+}
+
+const PrivateEntry* GetPrivateEntry(const std::string& creator,
+                                    std::uint8_t offset) {
+  if (!creator.empty() && creator.back() == ' ') {
+    return GetPrivateEntry(TrimCreator(creator), offset);
+  }
+
+  const PrivateDict* dict = g_private_dict.load(std::memory_order_acquire);
+  if (dict == nullptr) {
+    return nullptr;
+  }
+
+  auto creator_it = dict->find(creator);
+  if (creator_it == dict->end()) {
+    return nullptr;
+  }
+
+  const std::vector<PrivateEntry>& entries = creator_it->second;
+
+  auto it = std::lower_bound(entries.begin(), entries.end(), offset,
+                             OffsetLess);
+
+  if (it != entries.end() && it->offset == offset) {
+    return &*it;
+  }
+
+  return nullptr;
+}
+
 }  // namespace dict
 }  // namespace dcm
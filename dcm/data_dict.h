@@ -1,16 +1,21 @@
 #ifndef DCM_DATA_DICT_H_
 #define DCM_DATA_DICT_H_
 
+#include <map>
+#include <string>
+#include <vector>
+
 #include "dcm/defs.h"
 
 namespace dcm {
 namespace dict {
 
 // Data dictionary entry.
-// E.g., { 0x00080018, VR::UI, "SOPInstanceUID" }
+// E.g., { 0x00080018, VR::UI, VM(1, 1, 1), "SOPInstanceUID" }
 struct Entry {
   std::uint32_t tag;
   VR vr;
+  VM vm;
   const char* keyword;  // TODO: Rename
 };
 
@@ -21,18 +26,58 @@ const Entry* GetEntry(Tag tag);
 // Get the name (or description) of the tag.
 const char* GetName(Tag tag);
 
+// Get the tag by its keyword, e.g., "PatientID" for (0010,0020).
+// Constant time without allocation, see dict.py.
+// Return false if the dictionary has no such keyword.
+bool GetTag(const char* keyword, Tag* tag);
+
 // Get the VR of the tag.
 // Return VR::UN if the the dictionary has no such tag.
 VR GetVR(Tag tag);
 
 // Get the VM of the tag.
-// Return nullptr if the tag's VM is 1.
-// For saving memory, the VM dictionary doesn't store the tags whose VM is 1.
+// Return nullptr if the tag's VM is 1, or the dictionary has no such tag.
 const VM* GetVM(Tag tag);
 
 // Check if the value is a valid VM for the given tag.
 bool CheckVM(Tag tag, std::size_t value);
 
+// -----------------------------------------------------------------------------
+
+// Private data dictionary entry.
+// A private data element (gggg,xxee) belongs to the block xx reserved by the
+// private creator element (gggg,00xx) of the same data set. Its entry is keyed
+// by the value of the creator (e.g., "SIEMENS CSA HEADER") and the offset ee.
+struct PrivateEntry {
+  std::uint8_t offset;
+  VR vr;
+  std::string keyword;
+};
+
+// Private dictionaries: the entries of each creator.
+typedef std::map<std::string, std::vector<PrivateEntry>> PrivateDict;
+
+// Register private entries, replacing the entries registered before with the
+// same creators and offsets. Trailing spaces of the creators are ignored.
+//
+// Lookups never lock: each registration publishes a new copy of all the
+// private dictionaries, and the copies are kept until the program exits since
+// a lookup might still be reading them. So register a whole set of
+// dictionaries in one call, at startup; registering N dictionaries one by one
+// keeps N copies, i.e., O(N^2) memory.
+void RegisterPrivate(const PrivateDict& dict);
+
+// Register private entries for a single creator, see above.
+void RegisterPrivate(const std::string& creator,
+                     const std::vector<PrivateEntry>& entries);
+
+// Get the private entry by its creator and offset.
+// Trailing spaces of the creator are ignored, as in the registration.
+// Return nullptr if no such entry is registered.
+// The entry stays valid (and unchanged) until the program exits.
+const PrivateEntry* GetPrivateEntry(const std::string& creator,
+                                    std::uint8_t offset);
+
 }  // namespace dict
 }  // namespace dcm
 
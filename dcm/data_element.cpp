@@ -8,7 +8,9 @@
 #include "boost/core/ignore_unused.hpp"
 
 #include "dcm/data_dict.h"
+#include "dcm/logger.h"
 #include "dcm/util.h"
+#include "dcm/value_source.h"
 #include "dcm/visitor.h"
 
 namespace dcm {
@@ -362,12 +364,14 @@ bool CheckStringValue(VR vr, const std::string& value) {
 // -----------------------------------------------------------------------------
 
 DataElement::DataElement(Tag tag, ByteOrder byte_order)
-    : tag_(tag), byte_order_(byte_order), length_(0) {
+    : tag_(tag), byte_order_(byte_order), value_byte_order_(byte_order),
+      length_(0) {
   vr_ = dict::GetVR(tag);
 }
 
 DataElement::DataElement(Tag tag, VR vr, ByteOrder byte_order)
-    : tag_(tag), vr_(vr), byte_order_(byte_order), length_(0) {
+    : tag_(tag), vr_(vr), byte_order_(byte_order),
+      value_byte_order_(byte_order), length_(0) {
 }
 
 void DataElement::Accept(Visitor& visitor) const {
@@ -380,12 +384,44 @@ bool DataElement::SetBuffer(Buffer&& buffer) {
     return false;
   }
 
+  lazy_.reset();
+  valueless_ = false;
+
   length_ = static_cast<std::uint32_t>(buffer.size());
   buffer_ = std::move(buffer);
+  value_byte_order_ = byte_order_;
+  swapped_.reset();
 
   return true;
 }
 
+void DataElement::SetLazyValue(std::shared_ptr<ValueSource> source,
+                               std::int64_t offset, std::uint32_t length) {
+  assert(source);
+
+  buffer_.clear();
+  length_ = length;
+  value_byte_order_ = byte_order_;
+  swapped_.reset();
+
+  valueless_ = false;
+
+  lazy_.reset(new LazyValue);
+  lazy_->source = std::move(source);
+  lazy_->offset = offset;
+}
+
+void DataElement::SetValueless(std::uint32_t length) {
+  lazy_.reset();
+
+  buffer_.clear();
+  length_ = length;
+  value_byte_order_ = byte_order_;
+  swapped_.reset();
+
+  valueless_ = true;
+}
+
 bool DataElement::SetByteOrder(ByteOrder byte_order) {
   if (byte_order == byte_order_) {
     return true;
@@ -397,25 +433,39 @@ bool DataElement::SetByteOrder(ByteOrder byte_order) {
 
   byte_order_ = byte_order;
 
+  if (GetSwapSize() == 0) {
+    // The bytes are the same in any byte order.
+    value_byte_order_ = byte_order;
+    return false;
+  }
+
+  // The bytes will be swapped on demand, see buffer().
+  if (byte_order_ != value_byte_order_) {
+    swapped_.reset(new SwappedValue);
+  } else {
+    swapped_.reset();
+  }
+
+  return true;
+}
+
+std::size_t DataElement::GetSwapSize() const {
   const VR::Code code = vr_.code();
 
   if (code == VR::US || code == VR::SS || code == VR::AT || code == VR::OW) {
-    SwapBytes(2);
-    return true;
+    return 2;
   }
 
   if (code == VR::UL || code == VR::SL || code == VR::FL || code == VR::OF ||
       code == VR::OL) {
-    SwapBytes(4);
-    return true;
+    return 4;
   }
 
   if (code == VR::FD || code == VR::OD) {
-    SwapBytes(8);
-    return true;
+    return 8;
   }
 
-  return false;
+  return 0;
 }
 
 std::uint32_t DataElement::GetElementLength(VR::Type vr_type,
@@ -425,7 +475,7 @@ std::uint32_t DataElement::GetElementLength(VR::Type vr_type,
   if (tag_ == tags::kSeqDelimatation ||
       tag_ == tags::kSeqItemDelimatation ||
       tag_ == tags::kSeqItemPrefix) {
-    return 8;
+    return kDelimiterLength;
   }
 
   std::uint32_t element_length = 4;  // Tag
@@ -443,7 +493,13 @@ std::uint32_t DataElement::GetElementLength(VR::Type vr_type,
     element_length += 4;  // Value length
   }
 
-  element_length += static_cast<std::uint32_t>(buffer_.size());
+  // Don't read a lazy value just for its length. A value-less element has
+  // the length only.
+  if (lazy_ || valueless_) {
+    element_length += length_;
+  } else {
+    element_length += static_cast<std::uint32_t>(buffer_.size());
+  }
 
   return element_length;
 }
@@ -476,12 +532,16 @@ std::size_t DataElement::GetVM() const {
 
   if (vr_.IsBackSlashVM()) {
     // AE, AS, UI, etc.
-    if (buffer_.empty()) {
+    // NOTE: Access the buffer by const reference so that a view (e.g., of a
+    // mapped file) is not detached.
+    const Buffer& buffer = stored_buffer();
+
+    if (buffer.empty()) {
       return 0;
     }
     std::size_t vm = 1;
-    for (std::size_t i = 0; i < buffer_.size(); ++i) {
-      if (buffer_[i] == '\\') {
+    for (std::size_t i = 0; i < buffer.size(); ++i) {
+      if (buffer[i] == '\\') {
         ++vm;
       }
     }
@@ -495,32 +555,12 @@ std::size_t DataElement::GetVM() const {
 // String
 
 bool DataElement::GetString(std::string* value) const {
-  if (!vr_.IsString()) {
+  boost::string_view view;
+  if (!GetStringView(&view)) {
     return false;
   }
 
-  if (buffer_.empty()) {
-    value->clear();
-    return true;
-  }
-
-  std::size_t size = buffer_.size();
-
-  if (size > 0) {
-    // Remove blank trailing space (or NULL byte for UI).
-    if (vr_ == VR::UI) {
-      if (buffer_.back() == '\0') {
-        --size;
-      }
-    } else {
-      if (buffer_.back() == ' ') {
-        --size;
-      }
-    }
-  }
-
-  value->assign(&buffer_[0], size);
-
+  value->assign(view.data(), view.size());
   return true;
 }
 
@@ -531,21 +571,55 @@ std::string DataElement::GetString() const {
 }
 
 bool DataElement::GetStringArray(std::vector<std::string>* values) const {
-  std::string value;
-  if (!GetString(&value)) {
+  values->clear();
+
+  // TODO: Just return false if !vr_.IsBackSlashVM()?
+  return ForEachValue([values](boost::string_view value) {
+    values->emplace_back(value.data(), value.size());
+  });
+}
+
+bool DataElement::GetStringView(boost::string_view* value) const {
+  if (!vr_.IsString() || valueless_) {
     return false;
   }
 
-  if (!vr_.IsBackSlashVM()) {  // TODO: Just return false?
-    // TODO: What if value is empty? Return false?
-    values->push_back(std::move(value));
+  // Strings have no byte order.
+  // NOTE: Access the buffer by const reference so that a view (e.g., of a
+  // mapped file) is not detached.
+  const Buffer& buffer = stored_buffer();
+
+  if (buffer.empty()) {
+    *value = boost::string_view();
     return true;
   }
 
-  boost::split(*values, value, boost::is_any_of("\\"));
+  std::size_t size = buffer.size();
+
+  // Remove blank trailing space (or NULL byte for UI).
+  if (vr_ == VR::UI) {
+    if (buffer.back() == '\0') {
+      --size;
+    }
+  } else {
+    if (buffer.back() == ' ') {
+      --size;
+    }
+  }
+
+  *value = boost::string_view(buffer.data(), size);
   return true;
 }
 
+bool DataElement::GetStringViews(
+    std::vector<boost::string_view>* values) const {
+  values->clear();
+
+  return ForEachValue([values](boost::string_view value) {
+    values->push_back(value);
+  });
+}
+
 // TODO: Split by "\\", check each value separately.
 bool DataElement::SetString(const std::string& value) {
   if (!CheckStringValue(vr_, value)) {
@@ -582,6 +656,9 @@ bool DataElement::SetStringArray(const std::vector<std::string>& values) {
 // -----------------------------------------------------------------------------
 
 void DataElement::DoSetString(const std::string& value) {
+  lazy_.reset();
+  valueless_ = false;
+
   const bool odd = value.size() % 2 == 1;
 
   length_ = static_cast<std::uint32_t>(value.size());
@@ -594,7 +671,7 @@ void DataElement::DoSetString(const std::string& value) {
   buffer_.resize(length_);
 
   if (length_ > 0) {
-    std::memcpy(&buffer_[0], value.data(), value.size());
+    std::memcpy(buffer_.data(), value.data(), value.size());
   }
 
   if (odd) {
@@ -608,16 +685,18 @@ void DataElement::DoSetString(const std::string& value) {
 }
 
 bool DataElement::GetNumber(VR vr, std::size_t size, void* value) const {
-  if (vr_ != vr) {
+  if (vr_ != vr || valueless_) {
     return false;
   }
 
   // length_ > size when VM > 1.
   assert(length_ >= size);
 
-  std::memcpy(value, &buffer_[0], size);
+  // Swap from the byte order the value is stored in, instead of converting
+  // the whole value, see SetByteOrder().
+  std::memcpy(value, stored_buffer().data(), size);
 
-  if (byte_order_ != kByteOrderOS) {
+  if (value_byte_order_ != kByteOrderOS) {
     util::SwapBytes(value, size);
   }
 
@@ -633,15 +712,21 @@ bool DataElement::SetNumber(VR vr, std::size_t size, void* value) {
     return false;
   }
 
+  lazy_.reset();
+  valueless_ = false;
+
   length_ = static_cast<std::uint32_t>(size);
   buffer_.resize(size);
 
-  std::memcpy(&buffer_[0], value, size);
+  std::memcpy(buffer_.data(), value, size);
 
   if (byte_order_ != kByteOrderOS) {
-    util::SwapBytes(&buffer_[0], size);
+    util::SwapBytes(buffer_.data(), size);
   }
 
+  value_byte_order_ = byte_order_;
+  swapped_.reset();
+
   return true;
 }
 
@@ -653,16 +738,37 @@ bool DataElement::GetNumberArray(VR vr, std::size_t size, std::size_t count,
 
   assert(length_ == size * count);
 
-  std::memcpy(values, &buffer_[0], length_);
+  CopyNumbers(size, count, values);
 
-  if (byte_order_ != kByteOrderOS) {
-    char* dst = reinterpret_cast<char*>(values);
-    for (std::size_t i = 0; i < count; ++i, dst += size) {
-      util::SwapBytes(dst, size);
-    }
+  return true;
+}
+
+const void* DataElement::GetNumberData(std::size_t size) const {
+  if (value_byte_order_ != kByteOrderOS) {
+    return nullptr;
   }
 
-  return true;
+  const char* data = stored_buffer().data();
+
+  // E.g., a view of a mapped file at an odd offset.
+  if (reinterpret_cast<std::uintptr_t>(data) % size != 0) {
+    return nullptr;
+  }
+
+  return data;
+}
+
+void DataElement::CopyNumbers(std::size_t size, std::size_t count,
+                              void* values) const {
+  if (count == 0) {
+    return;
+  }
+
+  std::memcpy(values, stored_buffer().data(), size * count);
+
+  if (value_byte_order_ != kByteOrderOS) {
+    util::SwapBytes(values, size, count);
+  }
 }
 
 bool DataElement::SetNumberArray(VR vr, std::size_t size, std::size_t count,
@@ -675,29 +781,65 @@ bool DataElement::SetNumberArray(VR vr, std::size_t size, std::size_t count,
     return false;
   }
 
+  lazy_.reset();
+  valueless_ = false;
+
   buffer_.resize(size * count);
 
-  char* dst = &buffer_[0];
+  char* dst = buffer_.data();
 
   std::memcpy(dst, values, buffer_.size());
 
   if (byte_order_ != kByteOrderOS) {
-    for (std::size_t i = 0; i < count; ++i, dst += size) {
-      util::SwapBytes(dst, size);
-    }
+    util::SwapBytes(dst, size, count);
   }
 
+  value_byte_order_ = byte_order_;
+  swapped_.reset();
+
   return true;
 }
 
-void DataElement::SwapBytes(std::size_t size) {
-  char* p = &buffer_[0];
+const Buffer& DataElement::GetSwappedBuffer() const {
+  assert(swapped_);
 
-  const std::size_t count = length_ / size;
+  const Buffer& buffer = stored_buffer();
 
-  for (std::size_t i = 0; i < count; ++i, p += size) {
-    util::SwapBytes(p, size);
-  }
+  // The other threads calling this at the same time wait for the value.
+  std::call_once(swapped_->once, [this, &buffer]() {
+    Buffer bytes(buffer.size());
+
+    if (!buffer.empty()) {
+      std::memcpy(bytes.data(), buffer.data(), buffer.size());
+
+      const std::size_t size = GetSwapSize();
+      util::SwapBytes(bytes.data(), size, bytes.size() / size);
+    }
+
+    swapped_->buffer = std::move(bytes);
+  });
+
+  return swapped_->buffer;
+}
+
+void DataElement::LoadValue() const {
+  assert(lazy_);
+
+  // The other threads calling this at the same time wait for the value.
+  std::call_once(lazy_->once, [this]() {
+    const std::shared_ptr<ValueSource>& source = lazy_->source;
+
+    if (!source->Read(lazy_->offset, length_, &buffer_)) {
+      LOG_ERRO("Failed to load the value of (%04x,%04x) from: %s",
+               tag_.group(), tag_.element(), source->path().string().c_str());
+
+      // Keep the buffer size identical to the value length.
+      buffer_ = Buffer(length_);
+    }
+
+    lazy_->source.reset();
+    lazy_->loaded = true;
+  });
 }
 
 }  // namespace dcm
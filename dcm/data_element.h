@@ -1,12 +1,19 @@
 #ifndef DCM_DATA_ELEMENT_H_
 #define DCM_DATA_ELEMENT_H_
 
+#include <atomic>
 #include <cstdint>
+#include <memory>
+#include <mutex>
+
+#include "boost/utility/string_view.hpp"
 
 #include "dcm/defs.h"
+#include "dcm/number_view.h"
 
 namespace dcm {
 
+class ValueSource;
 class Visitor;
 
 class DataElement {
@@ -30,17 +37,78 @@ public:
 
   void set_length(std::uint32_t length) { length_ = length; }
 
-  // Get raw value buffer.
-  const Buffer& buffer() const { return buffer_; }
+  ByteOrder byte_order() const { return byte_order_; }
+
+  // The byte order the value is actually stored in.
+  // It differs from byte_order() after SetByteOrder() until the value is set
+  // again. See SetByteOrder().
+  ByteOrder value_byte_order() const { return value_byte_order_; }
+
+  // Get raw value buffer, in byte_order().
+  // The buffer might refer to the bytes of a memory-mapped file, see
+  // DicomReader::MapFile().
+  // A lazy value is read from its source, and a value stored in the other
+  // byte order is swapped into a new buffer (the stored one is kept as is), on
+  // the first call.
+  // Both are done only once even if multiple threads call this (or any const
+  // getter) at the same time.
+  const Buffer& buffer() const {
+    if (lazy_) {
+      LoadValue();
+    }
+    if (swapped_) {
+      return GetSwappedBuffer();
+    }
+    return buffer_;
+  }
+
+  // Get raw value buffer as it's stored, in value_byte_order().
+  // E.g., to swap the bytes on the fly while writing instead of in place.
+  const Buffer& stored_buffer() const {
+    if (lazy_) {
+      LoadValue();
+    }
+    return buffer_;
+  }
+
+  // Defer reading the value of |length| bytes at |offset| of the source until
+  // it's needed, see DicomReader::set_lazy_threshold().
+  void SetLazyValue(std::shared_ptr<ValueSource> source, std::int64_t offset,
+                    std::uint32_t length);
+
+  // Is the value not read yet?
+  bool IsLazy() const { return lazy_ && !lazy_->loaded; }
+
+  // Has the value length only, without the value, which was passed in chunks
+  // to the read handler instead, see ReadHandler::OnElementData().
+  // The getters of the values fail, and the element can't be written.
+  bool IsValueless() const { return valueless_; }
+
+  // Set the value length without the value, see IsValueless().
+  // Setting a value (e.g., by SetBuffer()) clears it.
+  void SetValueless(std::uint32_t length);
+
+  // Is the element created by ArenaNew() from an arena (instead of the heap)?
+  // Set by the creator so that the owner destroys it properly, see
+  // ArenaDelete().
+  bool from_arena() const { return from_arena_; }
+  void set_from_arena(bool from_arena) { from_arena_ = from_arena; }
 
   // Set raw value buffer.
   // The buffer size must be even: 2, 4, 8, ...
   bool SetBuffer(Buffer&& buffer);
 
-  // Set byte order and swap bytes for numeric values.
+  // Set byte order for numeric values.
+  // The stored bytes are not swapped, so it's cheap even for large values
+  // (e.g., OW Pixel Data) which might never be accessed. The getters and the
+  // writer swap the values on the fly, and buffer() swaps into a new buffer.
   // Return false if not applicable.
   bool SetByteOrder(ByteOrder byte_order);
 
+  // The size of the numeric values to swap for the byte order: 2, 4 or 8.
+  // 0 if the value has no byte order, e.g., strings and OB.
+  std::size_t GetSwapSize() const;
+
   // Calculate the length of the whole element.
   virtual std::uint32_t GetElementLength(VR::Type vr_type,
                                          bool recursively = true) const;
@@ -60,6 +128,45 @@ public:
 
   bool GetStringArray(std::vector<std::string>* values) const;
 
+  // Get the string value without copying it.
+  // The trailing padding (space, or NULL byte for UI) is removed, same as
+  // GetString(). The view refers to the value, so it must not be used after
+  // the element is modified or destroyed.
+  bool GetStringView(boost::string_view* value) const;
+
+  // Call |f| with each value (split by backslash) as a boost::string_view,
+  // without copying, same as GetStringArray().
+  // See GetStringView() for the lifetime of the views.
+  template <typename F>
+  bool ForEachValue(F f) const {
+    boost::string_view value;
+    if (!GetStringView(&value)) {
+      return false;
+    }
+
+    if (!vr_.IsBackSlashVM()) {
+      f(value);
+      return true;
+    }
+
+    while (true) {
+      const std::size_t pos = value.find('\\');
+      f(value.substr(0, pos));
+
+      if (pos == boost::string_view::npos) {
+        break;
+      }
+      value.remove_prefix(pos + 1);
+    }
+
+    return true;
+  }
+
+  // Get the values (split by backslash) without copying them.
+  // The vector is cleared first; reuse it to avoid allocation.
+  // See GetStringView() for the lifetime of the views.
+  bool GetStringViews(std::vector<boost::string_view>* values) const;
+
   bool SetString(const std::string& value);
 
   bool SetStringArray(const std::vector<std::string>& values);
@@ -83,6 +190,12 @@ public:
     return SetNumberArray(VR::US, values);
   }
 
+  // Get the values without copying them if possible, see NumberView.
+  // Also for OW, e.g., Pixel Data.
+  bool GetUint16View(NumberView<std::uint16_t>* view) const {
+    return GetNumberView(VR::US, VR::OW, view);
+  }
+
   // ---------------------------------------------------------------------------
   // SS (Signed Short)
 
@@ -102,6 +215,10 @@ public:
     return SetNumberArray(VR::SS, values);
   }
 
+  bool GetInt16View(NumberView<std::int16_t>* view) const {
+    return GetNumberView(VR::SS, VR::SS, view);
+  }
+
   // ---------------------------------------------------------------------------
   // UL (Unsigned Long)
 
@@ -121,6 +238,11 @@ public:
     return SetNumberArray(VR::UL, values);
   }
 
+  // Also for OL.
+  bool GetUint32View(NumberView<std::uint32_t>* view) const {
+    return GetNumberView(VR::UL, VR::OL, view);
+  }
+
   // ---------------------------------------------------------------------------
   // SL (Signed Long)
 
@@ -140,6 +262,10 @@ public:
     return SetNumberArray(VR::SL, values);
   }
 
+  bool GetInt32View(NumberView<std::int32_t>* view) const {
+    return GetNumberView(VR::SL, VR::SL, view);
+  }
+
   // ---------------------------------------------------------------------------
   // FL (Floating Point Single)
 
@@ -159,6 +285,11 @@ public:
     return SetNumberArray(VR::FL, values);
   }
 
+  // Also for OF.
+  bool GetFloat32View(NumberView<float32_t>* view) const {
+    return GetNumberView(VR::FL, VR::OF, view);
+  }
+
   // ---------------------------------------------------------------------------
   // FD (Floating Point Double)
 
@@ -178,6 +309,11 @@ public:
     return SetNumberArray(VR::FD, values);
   }
 
+  // Also for OD.
+  bool GetFloat64View(NumberView<float64_t>* view) const {
+    return GetNumberView(VR::FD, VR::OD, view);
+  }
+
 private:
   void DoSetString(const std::string& value);
 
@@ -193,6 +329,10 @@ private:
 
   template <typename T>
   bool GetNumberArray(VR vr, std::vector<T>* values) const {
+    if (valueless_) {
+      return false;
+    }
+
     const std::size_t count = GetVM();
     values->resize(count);
     return GetNumberArray(vr, sizeof(T), count, &(*values)[0]);
@@ -204,6 +344,35 @@ private:
     return SetNumberArray(vr, sizeof(T), values.size(), &values[0]);
   }
 
+  // |vr| is the VR of the values, |array_vr| is the other VR for an array of
+  // them (e.g., OW for US), could be the same as |vr|.
+  template <typename T>
+  bool GetNumberView(VR vr, VR array_vr, NumberView<T>* view) const {
+    if ((vr_ != vr && vr_ != array_vr) || valueless_) {
+      return false;
+    }
+
+    const std::size_t count = length_ / sizeof(T);
+
+    const void* data = GetNumberData(sizeof(T));
+    if (data != nullptr) {
+      view->Reset(static_cast<const T*>(data), count);
+    } else {
+      std::vector<T> copy(count);
+      CopyNumbers(sizeof(T), count, copy.data());
+      view->Reset(std::move(copy));
+    }
+
+    return true;
+  }
+
+  // Get the stored value if it could be used as values of |size| bytes
+  // directly: in the byte order of this OS and aligned. Otherwise nullptr.
+  const void* GetNumberData(std::size_t size) const;
+
+  // Copy the values in the byte order of this OS.
+  void CopyNumbers(std::size_t size, std::size_t count, void* values) const;
+
   bool GetNumber(VR vr, std::size_t size, void* value) const;
 
   bool SetNumber(VR vr, std::size_t size, void* value);
@@ -214,7 +383,11 @@ private:
   bool SetNumberArray(VR vr, std::size_t size, std::size_t count,
                       const void* values);
 
-  void SwapBytes(std::size_t size);
+  // Get the value swapped from value_byte_order_ to byte_order_, once.
+  const Buffer& GetSwappedBuffer() const;
+
+  // Read the lazy value from its source, once.
+  void LoadValue() const;
 
 protected:
   // Tag key.
@@ -226,14 +399,49 @@ protected:
   // Little endian or big endian.
   ByteOrder byte_order_;
 
+  // The byte order of the bytes in buffer_, see value_byte_order().
+  ByteOrder value_byte_order_;
+
+  // See from_arena().
+  bool from_arena_ = false;
+
+  // See IsValueless().
+  bool valueless_ = false;
+
   // Value length.
   // 0xFFFFFFFF (-1) for SQ element.
   // Identical to the buffer size if the buffer is not empty.
   std::uint32_t length_;
 
 private:
+  // A value not read yet, see SetLazyValue().
+  struct LazyValue {
+    // Released once the value is read.
+    std::shared_ptr<ValueSource> source;
+    std::int64_t offset;
+
+    // Guards the reading (and |source|) against the concurrent const calls.
+    std::once_flag once;
+    std::atomic<bool> loaded{ false };
+  };
+
+  // The value swapped to byte_order_, see buffer().
+  struct SwappedValue {
+    // Guards |buffer| against the concurrent const calls.
+    std::once_flag once;
+    Buffer buffer;
+  };
+
   // Raw buffer (i.e., bytes) of the value.
-  Buffer buffer_;
+  // Mutable for reading a lazy value on demand.
+  mutable Buffer buffer_;
+
+  // Kept until the value is set again, so that the const calls don't race on
+  // it, see LoadValue().
+  std::unique_ptr<LazyValue> lazy_;
+
+  // Set by SetByteOrder() if the value is stored in the other byte order.
+  std::unique_ptr<SwappedValue> swapped_;
 };
 
 }  // namespace dcm
@@ -1,17 +1,18 @@
 #include "dcm/data_sequence.h"
 
+#include "dcm/arena.h"
 #include "dcm/data_set.h"
 #include "dcm/visitor.h"
 
 namespace dcm {
 
 DataSequence::DataSequence(Tag tag)
-    : DataElement(tag, VR::SQ), delimitation_(nullptr) {
+    : DataElement(tag, VR::SQ), delimited_(false) {
   length_ = kUndefinedLength;
 }
 
 DataSequence::~DataSequence() {
-  Clear();
+  DeleteItems();
 }
 
 void DataSequence::Accept(Visitor& visitor) const {
@@ -29,54 +30,106 @@ std::uint32_t DataSequence::GetElementLength(VR::Type vr_type,
 
   if (recursively) {
     for (auto& item : items_) {
-      if (item.prefix != nullptr) {
-        element_length += item.prefix->GetElementLength(vr_type);
-      }
+      element_length += kDelimiterLength;  // Item prefix
 
       for (std::size_t i = 0; i < item.data_set->size(); ++i) {
         element_length += item.data_set->At(i)->GetElementLength(vr_type);
       }
 
-      if (item.delimitation != nullptr) {
-        element_length += item.delimitation->GetElementLength(vr_type);
+      if (item.delimited) {
+        element_length += kDelimiterLength;
       }
     }
+
+    if (delimited_) {
+      element_length += kDelimiterLength;
+    }
   }
 
   return element_length;
 }
 
-void DataSequence::NewItem(DataElement* prefix, VR::Type vr_type,
-                           ByteOrder byte_order) {
+void DataSequence::NewItem(std::uint32_t length, VR::Type vr_type,
+                           ByteOrder byte_order, std::shared_ptr<Arena> arena) {
   // TODO: charset
-  auto data_set = new DataSet(vr_type, byte_order);
+  auto data_set = ArenaNew<DataSet>(arena.get(), vr_type, byte_order);
+  data_set->set_arena(std::move(arena));
+  data_set->parent_ = this;
 
-  items_.push_back({ prefix, nullptr, data_set });
+  items_.push_back({ length, false, data_set });
 }
 
-void DataSequence::EndItem(DataElement* delimitation) {
+void DataSequence::EndItem() {
   assert(!items_.empty());
 
-  items_.back().delimitation = delimitation;
+  items_.back().delimited = true;
 }
 
-bool DataSequence::AppendToLastItem(DataElement* data_element) {
+bool DataSequence::AppendToLastItem(DataElement* data_element,
+                                    bool adjust_lengths) {
   if (items_.empty()) {
     return false;
   }
-  items_.back().data_set->Append(data_element);
-  return true;
+  return items_.back().data_set->Append(data_element, adjust_lengths);
+}
+
+void DataSequence::AdjustLengths(const DataSet* data_set, std::int64_t delta) {
+  // Usually the last item is being edited.
+  for (auto it = items_.rbegin(); it != items_.rend(); ++it) {
+    if (it->data_set == data_set) {
+      if (it->length != kUndefinedLength) {
+        it->length = static_cast<std::uint32_t>(it->length + delta);
+      }
+      break;
+    }
+  }
+
+  if (length_ != kUndefinedLength) {
+    length_ = static_cast<std::uint32_t>(length_ + delta);
+  }
+
+  if (parent_ != nullptr) {
+    parent_->AdjustLengths(tag_, delta);
+  }
 }
 
 void DataSequence::Clear() {
+  if (items_.empty()) {
+    delimited_ = false;
+    return;
+  }
+
+  const VR::Type vr_type =
+      parent_ != nullptr ? parent_->GetVRType(tag_) : VR::EXPLICIT;
+
+  const std::int64_t old_length = GetElementLength(vr_type);
+
+  // The items with their prefixes and delimitations.
+  std::int64_t items_length = old_length - GetElementLength(vr_type, false);
+  if (delimited_) {
+    items_length -= kDelimiterLength;
+  }
+
+  DeleteItems();
+
+  delimited_ = false;
+
+  if (length_ != kUndefinedLength) {
+    length_ = static_cast<std::uint32_t>(length_ - items_length);
+  }
+
+  if (parent_ != nullptr) {
+    parent_->AdjustLengths(tag_, GetElementLength(vr_type) - old_length);
+  }
+}
+
+void DataSequence::DeleteItems() {
   for (auto& item: items_) {
-    delete item.prefix;
-    delete item.delimitation;
-    delete item.data_set;
+    // Keep the arena alive until the data set is destroyed.
+    std::shared_ptr<Arena> arena = item.data_set->arena();
+    ArenaDelete(arena.get(), item.data_set);
   }
   items_.clear();
-
-  delete delimitation_;
 }
 
 }  // namespace dcm
@@ -1,25 +1,28 @@
 #ifndef DCM_DATA_SEQUENCE_H_
 #define DCM_DATA_SEQUENCE_H_
 
+#include <memory>
 #include <vector>
 
 #include "dcm/data_element.h"
 
 namespace dcm {
 
+class Arena;
 class DataSet;
 class Visitor;
 
 class DataSequence : public DataElement {
 public:
   struct Item {
-    // Sequence item prefix tag (fffe,e000).
-    DataElement* prefix;
+    // Value length of the sequence item prefix tag (fffe,e000).
+    // Could be kUndefinedLength, then the item is ended with a delimitation.
+    std::uint32_t length;
 
-    // Sequence item delimitation/end tag (fffe,e00d).
-    // If the prefix tag has a value length other than -1, the delimiation
-    // normally is absent.
-    DataElement* delimitation;
+    // Ended with a sequence item delimitation/end tag (fffe,e00d).
+    // If the item has a value length other than -1, the delimiation normally
+    // is absent.
+    bool delimited;
 
     DataSet* data_set;
   };
@@ -54,34 +57,56 @@ public:
     return (*this)[index];
   }
 
-  const DataElement* delimitation() const { return delimitation_; }
+  bool delimited() const { return delimited_; }
 
-  void set_delimitation(DataElement* delimitation) {
-    delimitation_ = delimitation;
-  }
+  void set_delimited(bool delimited) { delimited_ = delimited; }
 
-  // Start a new item.
-  void NewItem(DataElement* prefix, VR::Type vr_type, ByteOrder byte_order);
+  // Start a new item with the value length of its prefix.
+  // The data set of the item is allocated from |arena| if it's not null, and
+  // shares it for its elements, see DataSet::set_arena().
+  void NewItem(std::uint32_t length, VR::Type vr_type, ByteOrder byte_order,
+               std::shared_ptr<Arena> arena = nullptr);
 
   // End the last item with a delimitation.
   // This call is optional. If the prefix has a value length other than -1,
   // a sequence item normally doesn't have any delimitation.
-  void EndItem(DataElement* delimitation);
+  void EndItem();
 
   // Append the data element to the last item's data set.
-  bool AppendToLastItem(DataElement* data_element);
+  // Return false, without taking the ownership, if there's no item or the
+  // element is out of order, see DataSet::Append().
+  bool AppendToLastItem(DataElement* data_element, bool adjust_lengths = true);
 
   // Clear all items.
+  // The lengths of this sequence and those depending on it are updated, see
+  // DataSet::Clear().
   void Clear();
 
+  // The data set containing this sequence, if any.
+  const DataSet* parent() const { return parent_; }
+
+private:
+  friend class DataSet;
+
+  // Add |delta| to the value lengths of the item with |data_set| and this
+  // sequence, then to the lengths depending on this sequence in its parent.
+  // See DataSet::AdjustLengths().
+  void AdjustLengths(const DataSet* data_set, std::int64_t delta);
+
+  // Delete the data sets of the items, without updating any length.
+  void DeleteItems();
+
 private:
   // Sequence items.
   std::vector<Item> items_;
 
-  // Sequence delimitation/end tag (fffe,e0dd).
+  // Ended with a sequence delimitation/end tag (fffe,e0dd).
   // If the sequence tag has a value length other than -1, the delimiation
   // normally is absent.
-  DataElement* delimitation_;
+  bool delimited_;
+
+  // See parent(). Set by the data set when the sequence is added to it.
+  DataSet* parent_ = nullptr;
 };
 
 }  // namespace dcm
@@ -1,9 +1,12 @@
 #include "dcm/data_set.h"
 
-#include <algorithm>  // for lower_bound
+#include <algorithm>  // for lower_bound, merge, stable_sort
+#include <iterator>  // for back_inserter
+#include <utility>  // for std::pair
 
 #include "boost/core/ignore_unused.hpp"
 
+#include "dcm/arena.h"
 #include "dcm/visitor.h"
 
 namespace dcm {
@@ -70,46 +73,62 @@ private:
 
 // -----------------------------------------------------------------------------
 
+// Update the value lengths of the sequences and the sequence items in one pass
+// from the bottom up, so that each element is measured only once.
 class UpdateSeqLengthVisitor : public Visitor {
 public:
   void VisitDataElement(const DataElement* data_element) override {
-    boost::ignore_unused(data_element);
+    length_ = data_element->GetElementLength(vr_type_, false);
   }
 
   void VisitDataSequence(const DataSequence* data_sequence) override {
     DataSequence* sequence = const_cast<DataSequence*>(data_sequence);
 
+    const VR::Type vr_type = vr_type_;
+
+    std::uint32_t value_length = 0;
+
     for (std::size_t i = 0; i < sequence->size(); ++i) {
       DataSequence::Item& item = sequence->At(i);
 
+      // The length of the item's elements is left in |length_|.
       item.data_set->Accept(*this);
 
-      if (item.delimitation != nullptr) {
-        item.prefix->set_length(kUndefinedLength);
-      } else {
-        std::uint32_t length = 0;
-        for (std::size_t j = 0; j < item.data_set->size(); ++j) {
-          length += item.data_set->At(j)->GetElementLength(vr_type_, true);
-        }
-        item.prefix->set_length(length);
+      item.length = item.delimited ? kUndefinedLength : length_;
+
+      value_length += kDelimiterLength + length_;  // Item prefix + elements
+      if (item.delimited) {
+        value_length += kDelimiterLength;
       }
     }
 
-    std::uint32_t length = sequence->GetElementLength(vr_type_, true);
-    std::uint32_t self_length = sequence->GetElementLength(vr_type_, false);
-    sequence->set_length(length - self_length);
+    if (sequence->delimited()) {
+      value_length += kDelimiterLength;
+    }
+
+    vr_type_ = vr_type;
+
+    sequence->set_length(value_length);
+    length_ = sequence->GetElementLength(vr_type_, false) + value_length;
   }
 
   void VisitDataSet(const DataSet* data_set) override {
-    vr_type_ = data_set->vr_type();
+    std::uint32_t length = 0;
 
     for (std::size_t i = 0; i < data_set->size(); ++i) {
+      vr_type_ = data_set->vr_type();
       data_set->At(i)->Accept(*this);
+      length += length_;
     }
+
+    length_ = length;
   }
 
 private:
   VR::Type vr_type_ = VR::EXPLICIT;
+
+  // The length of the element, or all the elements of the data set, visited.
+  std::uint32_t length_ = 0;
 };
 
 }  // namespace
@@ -121,6 +140,8 @@ DataSet::DataSet(VR::Type vr_type, ByteOrder byte_order, Charset charset)
 }
 
 DataSet::~DataSet() {
+  // The parent is being destroyed, or has deleted this item already.
+  parent_ = nullptr;
   Clear();
 }
 
@@ -152,31 +173,127 @@ const DataSequence* DataSet::GetSequence(Tag tag) const {
   return nullptr;
 }
 
-bool DataSet::Append(DataElement* element) {
-  if (elements_.empty() || element->tag() > elements_.back()->tag()) {
+bool DataSet::Append(DataElement* element, bool adjust_lengths) {
+  if (tags_.empty() || element->tag() > tags_.back()) {
+    tags_.push_back(element->tag());
     elements_.push_back(element);
+    Adopt(element);
+    if (adjust_lengths) {
+      AdjustLengths(element->tag(), GetLength(element));
+    }
     return true;
   }
   return false;
 }
 
-bool DataSet::Insert(DataElement* element) {
-  auto it = LowerBound(element->tag());
-  if (it != elements_.end() && (*it)->tag() == element->tag()) {
+bool DataSet::Insert(DataElement* element, bool adjust_lengths) {
+  const std::size_t index = LowerBound(element->tag());
+  if (index < tags_.size() && tags_[index] == element->tag()) {
     return false;
   }
-  elements_.insert(it, element);
+  tags_.insert(tags_.begin() + index, element->tag());
+  elements_.insert(elements_.begin() + index, element);
+  Adopt(element);
+  if (adjust_lengths) {
+    AdjustLengths(element->tag(), GetLength(element));
+  }
   return true;
 }
 
+std::size_t DataSet::InsertBatch(std::vector<DataElement*>* elements,
+                                 DuplicatePolicy policy, bool adjust_lengths) {
+  // An element with whether it's new to this data set.
+  typedef std::pair<DataElement*, bool> Entry;
+
+  auto less = [](const Entry& lhs, const Entry& rhs) {
+    return lhs.first->tag() < rhs.first->tag();
+  };
+
+  std::vector<Entry> added;
+  added.reserve(elements->size());
+  for (DataElement* element : *elements) {
+    added.emplace_back(element, true);
+  }
+  elements->clear();
+
+  // Stable so that the duplicates are kept in the order they are added.
+  std::stable_sort(added.begin(), added.end(), less);
+
+  std::vector<Entry> existing;
+  existing.reserve(elements_.size());
+  for (DataElement* element : elements_) {
+    existing.emplace_back(element, false);
+  }
+
+  // The existing elements go first for the same tags.
+  std::vector<Entry> merged;
+  merged.reserve(existing.size() + added.size());
+  std::merge(existing.begin(), existing.end(), added.begin(), added.end(),
+             std::back_inserter(merged), less);
+
+  elements_.clear();
+  tags_.clear();
+  elements_.reserve(merged.size());
+  tags_.reserve(merged.size());
+
+  std::size_t duplicates = 0;
+
+  // NOTE: The lengths are adjusted as the elements are placed, the group
+  // length (gggg,0000), if any, is always placed before the others of the
+  // group.
+  for (const Entry& entry : merged) {
+    DataElement* element = entry.first;
+
+    if (tags_.empty() || tags_.back() != element->tag()) {
+      tags_.push_back(element->tag());
+      elements_.push_back(element);
+      Adopt(element);
+      if (adjust_lengths && entry.second) {
+        AdjustLengths(element->tag(), GetLength(element));
+      }
+      continue;
+    }
+
+    // The existing tags are unique, so a duplicate is always an added one.
+    ++duplicates;
+
+    if (policy == DuplicatePolicy::KEEP_LAST) {
+      std::swap(elements_.back(), element);
+      Adopt(elements_.back());
+      if (adjust_lengths) {
+        AdjustLengths(element->tag(),
+                      GetLength(elements_.back()) - GetLength(element));
+      }
+    }
+    DeleteElement(element);
+  }
+
+  return duplicates;
+}
+
 void DataSet::Clear() {
+  if (parent_ != nullptr && !elements_.empty()) {
+    std::int64_t length = 0;
+    for (DataElement* element : elements_) {
+      length += GetLength(element);
+    }
+    parent_->AdjustLengths(this, -length);
+  }
+
   vr_type_ = VR::EXPLICIT;
   byte_order_ = ByteOrder::LE;
 
   for (DataElement* element : elements_) {
-    delete element;
+    DeleteElement(element);
   }
-  elements_.clear(); 
+  elements_.clear();
+  tags_.clear();
+}
+
+void DataSet::set_arena(std::shared_ptr<Arena> arena) {
+  // The arena of an item is set once by the sequence, see NewItem().
+  assert(elements_.empty() && parent_ == nullptr);
+  arena_ = std::move(arena);
 }
 
 // -----------------------------------------------------------------------------
@@ -205,22 +322,11 @@ void DataSet::SetByteOrder(ByteOrder byte_order) {
 
 #if 0
 std::uint32_t DataSet::GetGroupLength(std::uint16_t group) const {
-  Tag tag(group, 0);
-
-  auto less = [](Tag tag, DataElement* element) {
-    return tag < element->tag();
-  };
-
-  auto it = std::upper_bound(elements_.begin(), elements_.end(), tag, less);
-
-  if (it == elements_.end() || (*it)->tag().group() != group) {
-    // No such group.
-    return 0;
-  }
+  std::size_t index = LowerBound(Tag(group, 1));
 
   std::uint32_t group_length = 0;
-  for (; it != elements_.end() && (*it)->tag().group() == group; ++it) {
-    group_length += (*it)->GetElementLength(vr_type_, true);
+  for (; index < tags_.size() && tags_[index].group() == group; ++index) {
+    group_length += elements_[index]->GetElementLength(vr_type_, true);
   }
 
   return group_length;
@@ -230,19 +336,20 @@ std::uint32_t DataSet::GetGroupLength(std::uint16_t group) const {
 bool DataSet::UpdateGroupLength(std::uint16_t group) {
   Tag tag(group, 0);
 
-  auto it = LowerBound(tag);
-  if (it == elements_.end() || (*it)->tag() != tag) {
+  std::size_t index = LowerBound(tag);
+  if (index == tags_.size() || tags_[index] != tag) {
     // No such group or no group length element.
     return false;
   }
 
   // Group length element.
-  auto element = *it;
-  auto vr_type = group == 2 ? VR::EXPLICIT : vr_type_;
+  auto element = elements_[index];
+  auto vr_type = GetVRType(tag);
 
   std::uint32_t group_length = 0;
-  for (++it; it != elements_.end() && (*it)->tag().group() == group; ++it) {
-    group_length += (*it)->GetElementLength(vr_type, true);
+  for (++index; index < tags_.size() && tags_[index].group() == group;
+       ++index) {
+    group_length += elements_[index]->GetElementLength(vr_type, true);
   }
 
   element->SetUint32(group_length);
@@ -306,6 +413,17 @@ bool DataSet::GetStringArray(Tag tag, std::vector<std::string>* values) const {
   return element->GetStringArray(values);
 }
 
+bool DataSet::GetStringView(Tag tag, boost::string_view* value) const {
+  GET_OR_RETURN_FALSE();
+  return element->GetStringView(value);
+}
+
+bool DataSet::GetStringViews(Tag tag,
+                             std::vector<boost::string_view>* values) const {
+  GET_OR_RETURN_FALSE();
+  return element->GetStringViews(values);
+}
+
 bool DataSet::SetStringArray(Tag tag, const std::vector<std::string>& values) {
   return Set(tag, [&values](DataElement* element) {
     return element->SetStringArray(values);
@@ -450,35 +568,77 @@ bool DataSet::SetFloat64Array(Tag tag, const std::vector<float64_t>& values) {
 
 // -----------------------------------------------------------------------------
 
-DataSet::Elements::iterator DataSet::LowerBound(Tag tag) {
-  auto less = [](DataElement* element, Tag tag) {
-    return element->tag() < tag;
-  };
-  return std::lower_bound(elements_.begin(), elements_.end(), tag, less);
+std::size_t DataSet::LowerBound(Tag tag) const {
+  auto it = std::lower_bound(tags_.begin(), tags_.end(), tag);
+  return static_cast<std::size_t>(it - tags_.begin());
 }
 
 DataElement* DataSet::Find(Tag tag) {
-  auto it = LowerBound(tag);
-  if (it != elements_.end() && (*it)->tag() == tag) {
-    return *it;
+  const std::size_t index = LowerBound(tag);
+  if (index < tags_.size() && tags_[index] == tag) {
+    return elements_[index];
   }
   return nullptr;
 }
 
 bool DataSet::Set(Tag tag, std::function<bool(DataElement*)> setter) {
+  const VR::Type vr_type = GetVRType(tag);
+
   DataElement* element = Find(tag);
   if (element != nullptr) {
-    return setter(element);
+    const std::uint32_t old_length = element->GetElementLength(vr_type);
+    if (!setter(element)) {
+      return false;
+    }
+    AdjustLengths(tag, static_cast<std::int64_t>(
+                           element->GetElementLength(vr_type)) - old_length);
+    return true;
   }
 
-  element = new DataElement(tag, byte_order_);
+  element = ArenaNew<DataElement>(arena_.get(), tag, byte_order_);
+  element->set_from_arena(!!arena_);
 
-  if (setter(element)) {
-    return Insert(element);
+  if (setter(element) && Insert(element)) {
+    return true;
   } else {
-    delete element;
+    ArenaDelete(arena_.get(), element);
     return false;
   }
 }
 
+void DataSet::DeleteElement(DataElement* element) {
+  // An element from the arena is in a data set sharing the arena, see
+  // DicomReader::set_arena().
+  assert(!element->from_arena() || arena_);
+
+  ArenaDelete(element->from_arena() ? arena_.get() : nullptr, element);
+}
+
+void DataSet::Adopt(DataElement* element) {
+  if (element->vr() == VR::SQ) {
+    auto data_sequence = dynamic_cast<DataSequence*>(element);
+    if (data_sequence != nullptr) {
+      data_sequence->parent_ = this;
+    }
+  }
+}
+
+void DataSet::AdjustLengths(Tag tag, std::int64_t delta) {
+  if (delta == 0) {
+    return;
+  }
+
+  if (tag.element() != 0) {
+    DataElement* group_length = Find(Tag(tag.group(), 0));
+    std::uint32_t value = 0;
+    if (group_length != nullptr && group_length->GetUint32(&value)) {
+      group_length->SetUint32(static_cast<std::uint32_t>(value + delta));
+    }
+  }
+
+  if (parent_ != nullptr) {
+    parent_->AdjustLengths(this, delta);
+  }
+}
+
 }  // namespace dcm
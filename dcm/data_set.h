@@ -2,6 +2,7 @@
 #define DCM_DATA_SET_H_
 
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -12,10 +13,17 @@
 
 namespace dcm {
 
+class Arena;
 class Visitor;
 
 class DataSet {
 public:
+  // Which of the elements with the same tag to keep, see InsertBatch().
+  enum class DuplicatePolicy {
+    KEEP_FIRST,  // The element added first, e.g., the existing one.
+    KEEP_LAST,   // The element added last.
+  };
+
   DataSet(VR::Type vr_type = VR::EXPLICIT,
           ByteOrder byte_order = ByteOrder::LE,
           Charset charset = Charset::ISO_IR_6);  // TODO: default charset
@@ -35,6 +43,16 @@ public:
   Charset charset() const { return charset_; }
   void set_charset(Charset charset) { charset_ = charset; }
 
+  // The arena which the elements (and the data sets of sequence items) are
+  // allocated from, or null for the heap. See DicomReader::set_arena().
+  const std::shared_ptr<Arena>& arena() const { return arena_; }
+
+  // The data set must be empty, and not an item of a sequence.
+  void set_arena(std::shared_ptr<Arena> arena);
+
+  // The sequence which this data set is an item of, or null for the root.
+  const DataSequence* parent() const { return parent_; }
+
   // ---------------------------------------------------------------------------
 
   std::size_t size() const { return elements_.size(); }
@@ -53,10 +71,31 @@ public:
   // Return nullptr if the tag doesn't exist or it's not a sequence.
   const DataSequence* GetSequence(Tag tag) const;
 
-  bool Append(DataElement* element);
-
-  bool Insert(DataElement* element);
-
+  // Adding, replacing or deleting elements updates the group length
+  // (gggg,0000) and the lengths of the sequence and item containing this data
+  // set by the change of the element lengths, same as SetXxx(). Pass false for
+  // |adjust_lengths| if the lengths are already known, e.g., while reading.
+
+  // Append the element whose tag must be greater than the last one.
+  // Return false, without taking the ownership, if it's not.
+  bool Append(DataElement* element, bool adjust_lengths = true);
+
+  // Insert the element at its place.
+  // Return false, without taking the ownership, if the tag already exists.
+  bool Insert(DataElement* element, bool adjust_lengths = true);
+
+  // Insert the elements in any order, with a single sort instead of shifting
+  // the elements for each as Insert() does.
+  // The ownership of all the elements is taken and |elements| is cleared; the
+  // duplicates (including those with the tags already existing) are deleted
+  // according to |policy|.
+  // Return the number of the duplicates deleted.
+  std::size_t InsertBatch(std::vector<DataElement*>* elements,
+                          DuplicatePolicy policy = DuplicatePolicy::KEEP_FIRST,
+                          bool adjust_lengths = true);
+
+  // Delete all the elements.
+  // The lengths of the sequence and item containing this data set are updated.
   void Clear();
 
   // ---------------------------------------------------------------------------
@@ -77,7 +116,10 @@ public:
   // each element in this group recursively.
   // If the group length element (gggg,0000) doesn't exist, just return false
   // without any calculation.
-  // TODO: When set a (string) value, update group length automatically.
+  // NOTE: Setting a value by SetXxx() updates the group length (and the
+  // lengths of the sequences and items containing this data set) by the change
+  // of the element length, so this is needed only if the group length was
+  // wrong in the first place.
   bool UpdateGroupLength(std::uint16_t group);
 
   // ---------------------------------------------------------------------------
@@ -110,6 +152,12 @@ public:
 
   bool GetStringArray(Tag tag, std::vector<std::string>* values) const;
 
+  // See DataElement::GetStringView().
+  bool GetStringView(Tag tag, boost::string_view* value) const;
+
+  // See DataElement::GetStringViews().
+  bool GetStringViews(Tag tag, std::vector<boost::string_view>* values) const;
+
   bool SetStringArray(Tag tag, const std::vector<std::string>& values);
 
   // ---------------------------------------------------------------------------
@@ -179,16 +227,38 @@ public:
   bool SetFloat64Array(Tag tag, const std::vector<float64_t>& values);
 
 private:
-  using Elements = std::vector<DataElement*>;
+  friend class DataSequence;
 
-  // A wrapper of std::lower_bound.
-  Elements::iterator LowerBound(Tag tag);
+  // The index of the first element whose tag is not less than |tag|.
+  // A wrapper of std::lower_bound on |tags_|.
+  std::size_t LowerBound(Tag tag) const;
 
   DataElement* Find(Tag tag);
 
   // SetXxx template
   bool Set(Tag tag, std::function<bool(DataElement*)> setter);
 
+  // Destroy the element, from the arena or not, see DataElement::from_arena().
+  void DeleteElement(DataElement* element);
+
+  // Link the sequence to this data set as its parent.
+  void Adopt(DataElement* element);
+
+  // The length of the whole element as encoded in this data set.
+  std::int64_t GetLength(const DataElement* element) const {
+    return element->GetElementLength(GetVRType(element->tag()));
+  }
+
+  // The element length of |tag| has changed by |delta|. Add it to the group
+  // length (gggg,0000), if present, and the lengths of the parent sequence
+  // and item, recursively up to the root.
+  void AdjustLengths(Tag tag, std::int64_t delta);
+
+  // Which VR type the length of the element of |tag| is calculated with.
+  VR::Type GetVRType(Tag tag) const {
+    return tag.group() == 2 ? VR::EXPLICIT : vr_type_;
+  }
+
 private:
   // Explicit or implicit VR.
   VR::Type vr_type_;
@@ -199,7 +269,18 @@ private:
   // Character set.
   Charset charset_;
 
-  Elements elements_;
+  // See arena(). Elements not from the arena (e.g., inserted by the user) are
+  // deleted as usual, see DeleteElement().
+  std::shared_ptr<Arena> arena_;
+
+  // See parent(). Set by the sequence when the item is added.
+  DataSequence* parent_ = nullptr;
+
+  // The tags of the elements, sorted, parallel to |elements_|.
+  // Kept contiguous so that a lookup doesn't dereference any element.
+  std::vector<Tag> tags_;
+
+  std::vector<DataElement*> elements_;
 };
 
 }  // namespace dcm
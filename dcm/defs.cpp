@@ -123,6 +123,14 @@ bool VR::IsNumber() const {
   return Find(kCodes, ARRAY_SIZE(kCodes), code_);
 }
 
+bool VR::IsBinary() const {
+  static const Code kCodes[] = {
+    OB, OD, OF, OL, OW, UN,
+  };
+
+  return Find(kCodes, ARRAY_SIZE(kCodes), code_);
+}
+
 // TODO: Merge to IsString() as an optional output parameter?
 bool VR::IsBackSlashVM() const {
   static const Code kVRCodes[] = {
@@ -137,7 +145,7 @@ bool VR::IsBackSlashVM() const {
 
 // -----------------------------------------------------------------------------
 
-const std::size_t VM::N = -1;
+const std::size_t VM::N;
 
 VM::VM(const char* str) : min_(0), max_(0), times_(1) {
   if (!Parse(str)) {
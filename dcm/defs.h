@@ -7,6 +7,7 @@
 
 #include "boost/filesystem/path.hpp"
 
+#include "dcm/buffer.h"
 #include "dcm/config.h"
 
 namespace dcm {
@@ -24,7 +25,9 @@ using Path = boost::filesystem::path;
 
 const std::uint32_t kUndefinedLength = 0xFFFFFFFF;
 
-using Buffer = std::vector<char>;
+// Element length of a sequence item prefix or delimitation: the tag and the
+// 4-byte value length, no VR.
+const std::uint32_t kDelimiterLength = 8;
 
 // -----------------------------------------------------------------------------
 
@@ -85,7 +88,7 @@ public:
   };
 
 public:
-  VR(Code code = UN) : code_(code) {}
+  constexpr VR(Code code = UN) : code_(code) {}
 
   explicit VR(const char bytes[2]);
 
@@ -116,6 +119,9 @@ public:
 
   bool IsNumber() const;
 
+  // Is the value a blob of bytes (OB, OD, OF, OL, OW and UN)?
+  bool IsBinary() const;
+
   // Is VM determined by back slash?
   bool IsBackSlashVM() const;
 
@@ -142,12 +148,17 @@ inline bool operator!=(VR lhs, VR rhs) {
 //
 class VM {
 public:
-  static const std::size_t N;
+  static const std::size_t N = static_cast<std::size_t>(-1);
 
 public:
   // "1", "1-n", "2-2n", etc.
   VM(const char* str);
 
+  // E.g., VM(1, N, 2) for "2-2n".
+  constexpr VM(std::size_t min, std::size_t max, std::size_t times = 1)
+      : min_(min), max_(max), times_(times) {
+  }
+
   std::size_t min() const { return min_; }
   std::size_t max() const { return max_; }
   std::size_t times() const { return times_; }
@@ -0,0 +1,267 @@
+#include "dcm/dicom_cursor.h"
+
+#include <cstring>  // for memcmp
+
+#include "boost/filesystem/fstream.hpp"
+
+#include "dcm/block_reader.h"
+#include "dcm/data_element.h"
+#include "dcm/logger.h"
+#include "dcm/mapped_file.h"
+#include "dcm/memory_reader.h"
+#include "dcm/reader.h"
+
+namespace bfs = boost::filesystem;
+
+namespace dcm {
+
+// -----------------------------------------------------------------------------
+
+DicomCursor::DicomCursor()
+    : state_(State::CLOSED),
+      ending_(false),
+      length_(0) {
+}
+
+DicomCursor::~DicomCursor() {
+}
+
+bool DicomCursor::OpenFile(const Path& path) {
+  std::unique_ptr<bfs::ifstream> file(
+      new bfs::ifstream(path, std::ios::binary));
+  if (!file->is_open()) {
+    LOG_ERRO("Failed to open the file to read: %s", path.string().c_str());
+    return false;
+  }
+
+  reader_.reset(new BlockReader(file.get()));
+  file_ = std::move(file);
+  return Start();
+}
+
+bool DicomCursor::OpenStream(std::istream* stream) {
+  std::unique_ptr<BlockReader> reader(new BlockReader(stream));
+  if (!reader->IsOk()) {
+    LOG_ERRO("Invalid stream to read.");
+    return false;
+  }
+
+  reader_ = std::move(reader);
+  return Start();
+}
+
+bool DicomCursor::OpenBuffer(const char* data, std::size_t size) {
+  reader_.reset(new MemoryReader(data, size));
+  return Start();
+}
+
+bool DicomCursor::OpenBuffer(const char* data, std::size_t size,
+                             std::shared_ptr<const void> keeper) {
+  assert(keeper);
+
+  reader_.reset(new MemoryReader(data, size, std::move(keeper)));
+  return Start();
+}
+
+bool DicomCursor::MapFile(const Path& path) {
+  auto mapped_file = MappedFile::Open(path);
+  if (!mapped_file) {
+    LOG_ERRO("Failed to map the file to read: %s", path.string().c_str());
+    return false;
+  }
+
+  reader_.reset(new MemoryReader(mapped_file->data(), mapped_file->size(),
+                                 mapped_file));
+  return Start();
+}
+
+bool DicomCursor::Next(Event* event) {
+  assert(event != nullptr);
+
+  if (state_ == State::VALUE) {
+    SkipValue();
+  }
+
+  if (state_ != State::HEADER) {
+    return false;
+  }
+
+  while (true) {
+    HeaderParser::Frame& frame = parser_.frames().back();
+    if (ending_ || frame.read_length >= frame.length) {
+      return PopFrame(frame.tag, event);
+    }
+
+    HeaderParser::Header header;
+    HeaderParser::Status status = parser_.ReadHeader(*reader_, &header);
+
+    if (status == HeaderParser::END) {
+      ending_ = true;
+      continue;
+    }
+
+    if (status == HeaderParser::CHECK_TRANSFER_SYNTAX) {
+      // Go back to read the header again.
+      continue;
+    }
+
+    frame.read_length += static_cast<std::uint32_t>(header.size);
+
+    if (status == HeaderParser::INVALID_VR) {
+      LOG_ERRO("Failed to read VR for (%u,%u).", header.tag.group(),
+               header.tag.element());
+      return PopFrame(frame.tag, event);
+    }
+
+    if (header.IsDelimitation()) {
+      return PopFrame(header.tag, event);
+    }
+
+    event->tag = header.tag;
+    event->vr = header.vr;
+    event->length = header.length;
+    event->depth = parser_.frames().size() - 1;
+
+    if (header.IsItem()) {
+      event->type = Event::ITEM_START;
+      parser_.PushFrame(HeaderParser::Frame::ITEM, header.tag, header.length);
+      return true;
+    }
+
+    if (header.vr == VR::SQ) {
+      event->type = Event::SEQUENCE_START;
+      parser_.PushFrame(HeaderParser::Frame::SEQUENCE, header.tag,
+                        header.length);
+      return true;
+    }
+
+    if (header.length == kUndefinedLength) {
+      LOG_ERRO("Non-SQ element with undefined length.");
+      return PopFrame(frame.tag, event);
+    }
+
+    event->type = Event::ELEMENT;
+
+    tag_ = header.tag;
+    vr_ = header.vr;
+    length_ = header.length;
+    state_ = State::VALUE;
+
+    return true;
+  }
+}
+
+bool DicomCursor::ReadValue(Buffer* buffer) {
+  assert(buffer != nullptr);
+
+  if (state_ != State::VALUE) {
+    return false;
+  }
+
+  state_ = State::HEADER;
+  parser_.frames().back().read_length += length_;
+
+  if (length_ == 0) {
+    buffer->clear();
+  } else if (!reader_->ReadBuffer(length_, buffer)) {
+    LOG_ERRO("Failed to read value of size: %u", length_);
+    ending_ = true;
+    return false;
+  }
+
+  if (parser_.IsValueNeeded(tag_)) {
+    DataElement element(tag_, vr_, parser_.byte_order());
+    element.SetBuffer(Buffer(*buffer));
+    parser_.KeepValue(element);
+  }
+
+  return true;
+}
+
+DataElement* DicomCursor::ReadElement() {
+  if (state_ != State::VALUE) {
+    return nullptr;
+  }
+
+  Tag tag = tag_;
+  VR vr = vr_;
+
+  Buffer buffer;
+  if (!ReadValue(&buffer)) {
+    return nullptr;
+  }
+
+  auto element = new DataElement(tag, vr, parser_.byte_order());
+  if (!buffer.empty()) {
+    element->SetBuffer(std::move(buffer));
+  }
+  return element;
+}
+
+void DicomCursor::SkipValue() {
+  if (state_ != State::VALUE) {
+    return;
+  }
+
+  if (parser_.IsValueNeeded(tag_)) {
+    // Needed to check the transfer syntax or resolve private VRs.
+    Buffer buffer;
+    ReadValue(&buffer);
+    return;
+  }
+
+  state_ = State::HEADER;
+  parser_.frames().back().read_length += length_;
+
+  if (length_ > 0) {
+    reader_->Seek(length_, std::ios::cur);
+  }
+}
+
+bool DicomCursor::Start() {
+  // Preamble
+  // Seek relatively so that reading could start from the middle of a stream.
+  reader_->Seek(128, std::ios::cur);
+
+  char prefix[4];
+  if (!reader_->ReadBytes(prefix, 4)) {
+    LOG_ERRO("Failed to read 4 bytes DICOM prefix.");
+    return false;
+  }
+
+  if (std::memcmp(prefix, "DICM", 4) != 0) {
+    LOG_WARN("Preamble is omitted.");
+    reader_->UndoRead(132);
+  }
+
+  parser_.Reset();
+  ending_ = false;
+
+  state_ = State::HEADER;
+  return true;
+}
+
+bool DicomCursor::PopFrame(Tag end_tag, Event* event) {
+  HeaderParser::Frame frame = parser_.PopFrame();
+
+  if (frame.kind == HeaderParser::Frame::ROOT) {
+    state_ = State::DONE;
+    return false;
+  }
+
+  if (frame.kind == HeaderParser::Frame::SEQUENCE) {
+    event->type = Event::SEQUENCE_END;
+    event->vr = VR::SQ;
+  } else {
+    event->type = Event::ITEM_END;
+    event->vr = VR::UN;
+  }
+
+  event->tag = end_tag;
+  event->length = frame.length;
+  event->depth = parser_.frames().size() - 1;
+
+  return true;
+}
+
+}  // namespace dcm
@@ -0,0 +1,144 @@
+#ifndef DCM_DICOM_CURSOR_H_
+#define DCM_DICOM_CURSOR_H_
+
+#include <iosfwd>
+#include <memory>
+
+#include "dcm/defs.h"
+#include "dcm/header_parser.h"
+
+namespace dcm {
+
+class DataElement;
+class Reader;
+
+// A pull-style alternative to DicomReader + ReadHandler.
+//
+// Instead of receiving callbacks, the caller asks for the next event and
+// decides per element whether to read the value or skip it. No virtual calls
+// are made and no event is allocated on the heap.
+//
+// Usage:
+//   DicomCursor cursor;
+//   if (cursor.OpenFile(path)) {
+//     DicomCursor::Event event;
+//     while (cursor.Next(&event)) {
+//       if (event.type == DicomCursor::Event::ELEMENT &&
+//           event.tag == tags::kPatientName) {
+//         Buffer buffer;
+//         cursor.ReadValue(&buffer);
+//       }
+//     }
+//   }
+//
+class DicomCursor {
+public:
+  struct Event {
+    enum Type {
+      ELEMENT,
+      SEQUENCE_START,
+      SEQUENCE_END,
+      ITEM_START,
+      ITEM_END,
+    };
+
+    Type type;
+
+    // For end events, it's the tag of the delimitation if the sequence or item
+    // is ended with one, otherwise the tag of the sequence or item prefix.
+    Tag tag;
+
+    // SQ for sequence events, UN for item events.
+    VR vr;
+
+    // Value length, might be kUndefinedLength for sequences and items.
+    std::uint32_t length;
+
+    // The nesting level, 0 for the elements of the root data set.
+    // An item is one level deeper than its sequence.
+    std::size_t depth;
+  };
+
+  DicomCursor();
+
+  ~DicomCursor();
+
+  DicomCursor(const DicomCursor&) = delete;
+  DicomCursor& operator=(const DicomCursor&) = delete;
+
+  // The Open methods mirror the Read methods of DicomReader.
+  // Return false if the data is not DICOM at all (e.g., too short).
+
+  bool OpenFile(const Path& path);
+
+  // The stream must outlive the cursor.
+  bool OpenStream(std::istream* stream);
+
+  // The bytes must outlive the cursor. The values read are copied.
+  bool OpenBuffer(const char* data, std::size_t size);
+
+  // The values read refer to the bytes and share the ownership of |keeper|.
+  bool OpenBuffer(const char* data, std::size_t size,
+                  std::shared_ptr<const void> keeper);
+
+  bool MapFile(const Path& path);
+
+  // Move to the next event.
+  // The value of the previous element is skipped if it was neither read nor
+  // skipped explicitly.
+  // Return false at the end of the data.
+  bool Next(Event* event);
+
+  // Read the value of the current element (i.e., the last ELEMENT event).
+  // Return false if there's no value to read or failed to read it.
+  bool ReadValue(Buffer* buffer);
+
+  // Read the current element as a newly allocated data element which should be
+  // deleted by the caller. Return nullptr on failure.
+  DataElement* ReadElement();
+
+  // Skip the value of the current element.
+  void SkipValue();
+
+  // The transfer syntax is known after the first event out of group 0002.
+  VR::Type vr_type() const { return parser_.vr_type(); }
+  ByteOrder byte_order() const { return parser_.byte_order(); }
+
+private:
+  enum class State {
+    CLOSED,  // Not opened or failed to open.
+    HEADER,  // At the header of an element or the end of a level.
+    VALUE,   // At the value of the current element.
+    DONE,
+  };
+
+  // Check the preamble and DICOM prefix.
+  bool Start();
+
+  // End the current level and set the end event.
+  // Return false if the root level is ended.
+  bool PopFrame(Tag end_tag, Event* event);
+
+private:
+  // The file or stream being read, if any.
+  std::unique_ptr<std::istream> file_;
+
+  std::unique_ptr<Reader> reader_;
+
+  State state_;
+
+  // The data is over (or malformed), all open levels are to be ended.
+  bool ending_;
+
+  // The transfer syntax and the levels being read.
+  HeaderParser parser_;
+
+  // The current element.
+  Tag tag_;
+  VR vr_;
+  std::uint32_t length_;
+};
+
+}  // namespace dcm
+
+#endif  // DCM_DICOM_CURSOR_H_
@@ -2,9 +2,12 @@
 
 #include "boost/filesystem/fstream.hpp"
 
+#include "dcm/arena.h"
+#include "dcm/block_reader.h"
 #include "dcm/dicom_reader.h"
 #include "dcm/full_read_handler.h"
 #include "dcm/logger.h"
+#include "dcm/util.h"
 #include "dcm/write_visitor.h"
 #include "dcm/writer.h"
 
@@ -15,11 +18,92 @@ namespace dcm {
 DicomFile::DicomFile(const Path& path) : path_(path) {
 }
 
-bool DicomFile::Load() {
+bool DicomFile::Load(const LoadOptions& options) {
+  // The elements of the previous load might be from another arena.
+  Clear();
+  set_arena(options.use_arena ? std::make_shared<Arena>() : nullptr);
+
   FullReadHandler read_handler(this);
   DicomReader reader(&read_handler);
 
-  if (!reader.ReadFile(path_)) {
+  reader.set_stop_at_pixel_data(options.header_only);
+  reader.set_lazy_threshold(options.lazy_threshold);
+  reader.set_arena(arena());
+
+  if (options.map_file) {
+    if (!reader.MapFile(path_)) {
+      return false;
+    }
+  } else {
+    if (!reader.ReadFile(path_)) {
+      return false;
+    }
+  }
+
+  pixel_data_info_ = reader.pixel_data_info();
+
+  return true;
+}
+
+bool DicomFile::ReadPixelData(Buffer* buffer) const {
+  if (!pixel_data_info_.found()) {
+    LOG_ERRO("The position of pixel data is unknown.");
+    return false;
+  }
+
+  bfs::ifstream stream(path_, std::ios::binary);
+  if (!stream.is_open()) {
+    LOG_ERRO("Failed to open the file to read: %s", path_.string().c_str());
+    return false;
+  }
+
+  BlockReader reader(&stream);
+  reader.Seek(static_cast<long>(pixel_data_info_.offset));
+
+  std::uint32_t length = pixel_data_info_.length;
+
+  if (pixel_data_info_.encapsulated) {
+    // Find the sequence delimitation after the fragment items.
+    // Encapsulated pixel data is always in Explicit VR Little Endian.
+    length = 0;
+
+    while (true) {
+      std::uint16_t group = 0;
+      std::uint16_t element = 0;
+      std::uint32_t item_length = 0;
+
+      if (!reader.ReadUint16(&group) || !reader.ReadUint16(&element) ||
+          !reader.ReadUint32(&item_length)) {
+        LOG_ERRO("Failed to read the items of encapsulated pixel data.");
+        return false;
+      }
+
+      if (byte_order() != kByteOrderOS) {
+        util::Swap16(&group);
+        util::Swap16(&element);
+        util::Swap32(&item_length);
+      }
+
+      Tag tag(group, element);
+
+      if (tag == tags::kSeqDelimatation) {
+        break;
+      }
+
+      if (tag != tags::kSeqItemPrefix || item_length == kUndefinedLength) {
+        LOG_ERRO("Invalid item of encapsulated pixel data.");
+        return false;
+      }
+
+      reader.Seek(item_length, std::ios::cur);
+      length += 8 + item_length;
+    }
+
+    reader.Seek(static_cast<long>(pixel_data_info_.offset));
+  }
+
+  if (!reader.ReadBuffer(length, buffer)) {
+    LOG_ERRO("Failed to read pixel data of size: %u", length);
     return false;
   }
 
@@ -68,7 +152,7 @@ bool DicomFile::Save(const Path& new_path) {
 
   Accept(v);
 
-  return true;
+  return v.ok();
 }
 
 }  // namespace dcm
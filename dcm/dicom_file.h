@@ -2,9 +2,32 @@
 #define DCM_DICOM_FILE_H_
 
 #include "dcm/data_set.h"
+#include "dcm/dicom_reader.h"
 
 namespace dcm {
 
+// Options for loading a DICOM file.
+struct LoadOptions {
+  // Memory-map the file instead of reading it through a stream.
+  // The values then refer to the mapped bytes without being copied, and the
+  // mapping is kept alive as long as any of the values.
+  bool map_file = false;
+
+  // Stop at Pixel Data without reading its value, which could be read later on
+  // demand, see DicomFile::ReadPixelData().
+  bool header_only = false;
+
+  // Values of binary VRs (OB, OW, UN, etc.) larger than this are not read
+  // until they are accessed, e.g., the pixel data. 0 to read all values.
+  // Not applicable to |map_file| which doesn't copy the values anyway.
+  std::uint32_t lazy_threshold = 0;
+
+  // Allocate the data elements, the data sets of sequence items and the values
+  // from a few large blocks (see Arena) instead of one by one, and release them
+  // all at once. A value buffer copied out of the file keeps the arena alive.
+  bool use_arena = false;
+};
+
 class DicomFile : public DataSet {
 public:
   explicit DicomFile(const Path& path);
@@ -12,18 +35,31 @@ public:
   ~DicomFile() = default;
 
   // Load DICOM file.
-  bool Load();
+  bool Load(const LoadOptions& options = LoadOptions());
+
+  // Where the Pixel Data is, if loaded with LoadOptions::header_only.
+  const PixelDataInfo& pixel_data_info() const { return pixel_data_info_; }
+
+  // Read the value of Pixel Data from the file, if loaded with
+  // LoadOptions::header_only.
+  // For encapsulated pixel data, the buffer has the raw fragment items (the
+  // Basic Offset Table included) without the sequence delimitation.
+  bool ReadPixelData(Buffer* buffer) const;
 
   // Change transfer syntax.
   bool SetTransferSyntax(const std::string& transfer_syntax_uid);
 
   // Save DICOM file to the given path.
+  // Return false if any element can't be written, e.g., it has no value (see
+  // DataElement::IsValueless()).
   bool Save(const Path& new_path);
 
 private:
   Path path_;
 
   std::string transfer_syntax_uid_;
+
+  PixelDataInfo pixel_data_info_;
 };
 
 }  // namespace dcm
@@ -1,14 +1,20 @@
 #include "dcm/dicom_reader.h"
 
+#include <algorithm>  // for std::min
+#include <vector>
+
 #include "boost/filesystem/fstream.hpp"
 
-#include "dcm/data_dict.h"
+#include "dcm/arena.h"
+#include "dcm/block_reader.h"
 #include "dcm/data_sequence.h"
 #include "dcm/data_set.h"
 #include "dcm/logger.h"
+#include "dcm/mapped_file.h"
+#include "dcm/memory_reader.h"
 #include "dcm/read_handler.h"
 #include "dcm/reader.h"
-#include "dcm/util.h"
+#include "dcm/value_source.h"
 
 namespace bfs = boost::filesystem;
 
@@ -16,114 +22,81 @@ namespace dcm {
 
 // -----------------------------------------------------------------------------
 
-namespace {
-
-bool CheckVrType(Reader& reader, VR::Type* vr_type) {
-  // Skip the 4 tag bytes.
-  reader.Seek(4, std::ios::cur);
-
-  char bytes[2];
-  if (!reader.ReadBytes(bytes, 2)) {
-    reader.UndoRead(4);  // Put 4 tag bytes back.
-    return false;
-  }
+const std::size_t DicomReader::kDefaultMaxDepth;
 
-  reader.UndoRead(6);  // Put it back.
-
-  // Check to see if the 2 bytes following the tag field represents a valid VR.
-  if (VR(bytes).IsUnknown()) {
-    *vr_type = VR::IMPLICIT;
-    LOG_INFO("VR type: Implicit.");
-  } else {
-    *vr_type = VR::EXPLICIT;
-    LOG_INFO("VR type: Explicit.");
-  }
+DicomReader::DicomReader(ReadHandler* handler)
+    : handler_(handler),
+      stop_at_pixel_data_(false),
+      depth_(0),
+      max_depth_(kDefaultMaxDepth),
+      too_deep_(false),
+      lazy_threshold_(0) {
+}
 
-  return true;
+DicomReader::~DicomReader() {
 }
 
-bool CheckByteOrder(Reader& reader, ByteOrder* byte_order) {
-  std::uint8_t bytes[4] = { 0 };
-  if (!reader.ReadBytes(bytes, 4)) {
+bool DicomReader::ReadFile(const Path& path) {
+  bfs::ifstream stream(path, std::ios::binary);
+  if (stream.bad()) {
+    LOG_ERRO("Failed to open the file to read: %s", path.string().c_str());
     return false;
   }
 
-  reader.UndoRead(4);  // Put it back.
+  if (lazy_threshold_ > 0) {
+    value_source_ = std::make_shared<ValueSource>(path);
+  }
+
+  BlockReader reader(&stream);
+  bool ok = DoRead(reader);
 
-  std::uint16_t group = (bytes[0] & 0xff) + ((bytes[1] & 0xff) << 8);
-  std::uint16_t element = (bytes[2] & 0xff) + ((bytes[3] & 0xff) << 8);
-  Tag tag_l(group, element);  // Little Endian
-  Tag tag_b = tag_l.SwapBytes();  // Big Endian
+  value_source_.reset();
 
-  const dict::Entry* entry_l = dict::GetEntry(tag_l);
-  const dict::Entry* entry_b = dict::GetEntry(tag_b);
+  return ok;
+}
 
-  if (entry_l == nullptr && entry_b == nullptr) {
-    if (element == 0) {
-      // Group Length tag not in data dictionary, check the group number.
-      // For the first tag, group number is more probable of 0008 than 0800.
-      if (tag_l.group() > 0xff && tag_b.group() <= 0xff) {
-        *byte_order = ByteOrder::BE;
-      } else {
-        *byte_order = ByteOrder::LE;
-      }
-    } else {
-      // Both tags show an error, an invalid tag is encountered.
-      // Assume that it's Little Endian.
-      *byte_order = ByteOrder::LE;
-    }
-  } else {
-    if (entry_l == nullptr) {
-      *byte_order = ByteOrder::BE;
-    } else if (entry_b == nullptr) {
-      *byte_order = ByteOrder::LE;
-    } else {
-      // Both tags are valid, check the group number.
-      // For the first tag, group number is more probable of 0008 than 0800.
-      if (tag_l.group() > 0xff && tag_b.group() <= 0xff) {
-        *byte_order = ByteOrder::BE;
-      } else {
-        *byte_order = ByteOrder::LE;
-      }
-    }
+bool DicomReader::ReadStream(std::istream* stream) {
+  BlockReader reader(stream);
+  if (!reader.IsOk()) {
+    LOG_ERRO("Invalid stream to read.");
+    return false;
   }
 
-  if (*byte_order == ByteOrder::LE) {
-    LOG_INFO("Byte order checked: little endian.");
-  } else {
-    LOG_INFO("Byte order checked: big endian.");
+  if (!reader.seekable()) {
+    LOG_INFO("Read from a non-seekable stream.");
   }
 
-  return true;
+  return DoRead(reader);
 }
 
-}  // namespace
-
-// -----------------------------------------------------------------------------
-
-DicomReader::DicomReader(ReadHandler* handler)
-    : handler_(handler),
-      transfer_syntax_checked_(false),
-      vr_type_(VR::EXPLICIT) {
+bool DicomReader::ReadBuffer(const char* data, std::size_t size) {
+  MemoryReader reader(data, size);
+  return DoRead(reader);
 }
 
-DicomReader::~DicomReader() {
+bool DicomReader::ReadBuffer(const char* data, std::size_t size,
+                             std::shared_ptr<const void> keeper) {
+  assert(keeper);
+
+  MemoryReader reader(data, size, std::move(keeper));
+  return DoRead(reader);
 }
 
-bool DicomReader::ReadFile(const Path& path) {
-  bfs::ifstream stream(path, std::ios::binary);
-  if (stream.bad()) {
-    LOG_ERRO("Failed to open the file to read: %s", path.string().c_str());
+bool DicomReader::MapFile(const Path& path) {
+  auto mapped_file = MappedFile::Open(path);
+  if (!mapped_file) {
+    LOG_ERRO("Failed to map the file to read: %s", path.string().c_str());
     return false;
   }
 
-  Reader reader(&stream);
+  MemoryReader reader(mapped_file->data(), mapped_file->size(), mapped_file);
   return DoRead(reader);
 }
 
 bool DicomReader::DoRead(Reader& reader) {
   // Preamble
-  reader.Seek(128);
+  // Seek relatively so that reading could start from the middle of a stream.
+  reader.Seek(128, std::ios::cur);
 
   char prefix[4];
   if (!reader.ReadBytes(prefix, 4)) {
@@ -136,293 +109,160 @@ bool DicomReader::DoRead(Reader& reader) {
     reader.UndoRead(132);
   }
 
-  // Group 0002 is always Explicit VR Little Endian.
-  vr_type_ = VR::EXPLICIT;
-  byte_order_ = ByteOrder::LE;
+  bool ok = Read(reader);
 
-  Read(reader, kUndefinedLength);
+  handler_->OnEnd();
 
-  return true;
+  return ok;
 }
 
-std::uint32_t DicomReader::Read(Reader& reader, std::size_t max_length) {
-  std::uint32_t read_length = 0;
+template <VR::Type kVrType, ByteOrder kByteOrder>
+void DicomReader::ReadElements(Reader& reader) {
+  std::vector<HeaderParser::Frame>& frames = parser_.frames();
+  HeaderParser::Header header;
 
-  Tag tag;
+  while (!frames.empty()) {
+    // NOTE: The reference is invalidated once a new level is started.
+    std::uint32_t& read_length = frames.back().read_length;
 
-  while (read_length < max_length) {
-    if (handler_->should_stop()) {
-      break;  // Handler required to stop reading.
+    if (read_length >= frames.back().length) {
+      EndLevel();
+      continue;
     }
 
-    if (!ReadTag(reader, &tag)) {
-      break;
+    if (handler_->should_stop() || too_deep_) {
+      EndLevel();  // Handler required to stop reading.
+      continue;
     }
 
-    read_length += 4;
-
-    if (!transfer_syntax_checked_) {
-      if (tag.group() != 0x0002) {
-        // Undo read tag since the byte order might be wrong.
-        reader.UndoRead(4);
-
-        CheckTransferSyntax(reader);
-
-        transfer_syntax_checked_ = true;
-
-        handler_->OnTransferSyntax(vr_type_, byte_order_);
+    HeaderParser::Status status =
+        parser_.ReadHeader<kVrType, kByteOrder>(reader, &header);
 
-        // Go back to read the tag again.
-        continue;
-      }
+    if (status == HeaderParser::END) {
+      EndLevel();
+      continue;
     }
 
-    // End of sequence itself.
-    if (tag == tags::kSeqDelimatation) {
-      ReadSeqDelimitation(reader, tag, read_length);
-      break;
-    }
+    if (status == HeaderParser::CHECK_TRANSFER_SYNTAX) {
+      handler_->OnTransferSyntax(parser_.vr_type(), parser_.byte_order());
 
-    // End of sequence item.
-    if (tag == tags::kSeqItemDelimatation) {
-      ReadSeqItemDelimitation(reader, tag, read_length);
-      // The reading of the sequence item has ended.
-      // The value length of this sequence item must be undefined, so it is
-      // ended with a delimitation tag.
-      // See ReadSeqItemPrefix().
-      break;
+      // Go back to read the header again, with the loop for the transfer
+      // syntax, see Read().
+      return;
     }
 
-    if (tag == tags::kSeqItemPrefix) {
-      ReadSeqItemPrefix(reader, tag, read_length);
+    read_length += static_cast<std::uint32_t>(header.size);
+
+    if (status == HeaderParser::INVALID_VR) {
+      LOG_ERRO("Failed to read VR for (%u,%u).", header.tag.group(),
+               header.tag.element());
+      EndLevel();
       continue;
     }
 
-    VR vr = VR::UN;
-    if (!ReadVR(reader, tag, read_length, &vr)) {
-      LOG_ERRO("Failed to read VR for (%u,%u).", tag.group(), tag.element());
-      break;
+    // The value length of the sequence or item must be undefined, so it is
+    // ended with a delimitation tag.
+    if (header.IsDelimitation()) {
+      LOG_INFO("Read sequence (item) delimitation tag.");
+      EndLevel(true);
+      continue;
     }
 
-    std::uint32_t length = ReadValueLength(reader, vr, read_length);
+    if (header.IsItem()) {
+      LOG_INFO("Read sequence item prefix tag.");
 
-    if (!ReadValue(reader, tag, vr, length, read_length)) {
-      break;
-    }
-  }
-
-  return read_length;
-}
+      // If item length is undefined, this item will be ended with a
+      // delimitation.
+      handler_->OnSequenceItemStart(header.length);
 
-void DicomReader::CheckTransferSyntax(Reader& reader) {
-  if (!transfer_syntax_uid_.empty()) {
-    // Group 0002 and tag 0x00020010 exist.
-
-    LOG_INFO("Check transfer syntax by 0x00020010 (%s).",
-             transfer_syntax_uid_.c_str());
-
-    if (transfer_syntax_uid_ == transfer_syntax_uids::kImplicitLittleEndian) {
-      vr_type_ = VR::IMPLICIT;
-      byte_order_ = ByteOrder::LE;
-    } else if (transfer_syntax_uid_ ==
-               transfer_syntax_uids::kExplicitLittleEndian) {
-      vr_type_ = VR::EXPLICIT;
-      byte_order_ = ByteOrder::LE;
-    } else if (transfer_syntax_uid_ ==
-               transfer_syntax_uids::kDeflatedExplicitLittleEndian) {
-      vr_type_ = VR::EXPLICIT;
-      byte_order_ = ByteOrder::LE;
-    } else if (transfer_syntax_uid_ ==
-               transfer_syntax_uids::kExplicitBigEndian) {
-      vr_type_ = VR::EXPLICIT;
-      byte_order_ = ByteOrder::BE;
-    } else {
-      // Compressed pixel data transfer syntax are always Explicit VR Little
-      // Endian (so you can call JPEG baseline 1.2.840.10008.1.2.4.50 for
-      // example "Explicit Little Endian JPEG Baseline").
-      vr_type_ = VR::EXPLICIT;
-      byte_order_ = ByteOrder::LE;
+      // The item is ended by EndLevel().
+      parser_.PushFrame(HeaderParser::Frame::ITEM, header.tag, header.length);
+      continue;
     }
 
-    return;
-  }
-
-  LOG_INFO("Check transfer syntax by reading some bytes then figure out with "
-           "the help of VR and data dictionaries.");
-
-  CheckVrType(reader, &vr_type_);
-  CheckByteOrder(reader, &byte_order_);
-}
-
-bool DicomReader::ReadTag(Reader& reader, Tag* tag) {
-  std::uint16_t group = 0;
-  std::uint16_t element = 0;
-
-  if (!ReadUint16(reader, &group)) {
-    return false;
-  }
-
-  if (!ReadUint16(reader, &element)) {
-    return false;
-  }
-
-  tag->set_group(group);
-  tag->set_element(element);
-
-  return true;
-}
-
-bool DicomReader::ReadUint16(Reader& reader, std::uint16_t* value) {
-  if (reader.ReadUint16(value)) {
-    if (byte_order_ != kByteOrderOS) {
-      util::Swap16(value);
+    if (stop_at_pixel_data_ && depth_ == 0 && header.tag == tags::kPixelData) {
+      pixel_data_info_.offset = reader.Tell();
+      pixel_data_info_.vr = header.vr;
+      pixel_data_info_.length = header.length;
+      pixel_data_info_.encapsulated = header.length == kUndefinedLength;
+      EndLevel();
+      continue;
     }
-    return true;
-  }
-  return false;
-}
 
-bool DicomReader::ReadUint32(Reader& reader, std::uint32_t* value) {
-  if (reader.ReadUint32(value)) {
-    if (byte_order_ != kByteOrderOS) {
-      util::Swap32(value);
+    if (!ReadValue(reader, header.tag, header.vr, header.length,
+                   read_length)) {
+      EndLevel();
+      continue;
     }
-    return true;
   }
-  return false;
 }
 
-void DicomReader::ReadSeqDelimitation(Reader& reader, Tag tag,
-                                      std::uint32_t& read_length) {
-  LOG_INFO("Read sequence delimitation tag.");
-
-  // Skip the 4-byte zero length of this sequence delimitation item.
-  reader.Seek(4, std::ios::cur);
-  read_length += 4;
-
-  auto element = new DataElement(tag, VR::UN, byte_order_);
-  handler_->OnSequenceEnd(element);
-}
+bool DicomReader::Read(Reader& reader) {
+  parser_.Reset();
 
-void DicomReader::ReadSeqItemDelimitation(Reader& reader, Tag tag,
-                                          std::uint32_t& read_length) {
-  LOG_INFO("Read sequence item delimitation tag.");
+  depth_ = 0;
+  too_deep_ = false;
 
-  // Skip the 4-byte zero length of this item delimitation item.
-  reader.Seek(4, std::ios::cur);
-  read_length += 4;
-
-  auto element = new DataElement(tag, VR::UN, byte_order_);
-  handler_->OnSequenceItemEnd(element);
-}
-
-void DicomReader::ReadSeqItemPrefix(Reader& reader, Tag tag,
-                                    std::uint32_t& read_length) {
-  LOG_INFO("Read sequence item prefix tag.");
-
-  std::uint32_t item_length = 0;
-  ReadUint32(reader, &item_length);
-
-  read_length += 4;
-
-  auto element = new DataElement(tag, VR::UN, byte_order_);
-
-  // If item length is undefined, this item will be ended with a delimitation.
-  element->set_length(item_length);
-
-  handler_->OnSequenceItemStart(element);
-
-  read_length += Read(reader, item_length);
-
-  handler_->OnSequenceItemEnd();
-}
-
-bool DicomReader::ReadVR(Reader& reader, Tag tag, std::uint32_t& read_length,
-                         VR* vr) {
-  if (vr_type_ == VR::EXPLICIT) {
-    char bytes[2];
-    reader.ReadBytes(bytes, 2);
-    read_length += 2;
-
-    if (!vr->SetBytes(bytes)) {
-      LOG_ERRO("'%s' is not a VR!", std::string(bytes, 2).c_str());
-      return false;
-    }
-  } else {
-    if (tag.element() == 0) {
-      // Group Length (VR type is always UL).
-      *vr = VR::UL;
+  // Group 0002 is always Explicit VR Little Endian.
+  // The loop returns once the transfer syntax of the data set is checked, and
+  // reading goes on with the loop specialized for it.
+  ReadElements<VR::EXPLICIT, ByteOrder::LE>(reader);
+
+  if (!parser_.frames().empty()) {
+    if (parser_.vr_type() == VR::EXPLICIT) {
+      if (parser_.byte_order() == ByteOrder::LE) {
+        ReadElements<VR::EXPLICIT, ByteOrder::LE>(reader);
+      } else {
+        ReadElements<VR::EXPLICIT, ByteOrder::BE>(reader);
+      }
     } else {
-      if (tag.group() % 2 == 1) {
-        // Private tag with Implicit VR.
-        // As I know, images generated by Carestream Dental CR CS7600 are really
-        // Implicit VR. They do have private tags.
-        LOG_WARN("Private tag in Implicit VR.");
+      if (parser_.byte_order() == ByteOrder::LE) {
+        ReadElements<VR::IMPLICIT, ByteOrder::LE>(reader);
       } else {
-        // Query VR type from data dictionary.
-        *vr = dict::GetVR(tag);
-        if (vr->IsUnknown()) {
-          LOG_WARN("Unknown tag in Implicit VR.");
-        }
+        // Not a standard transfer syntax, but might be figured out by the
+        // "smart" algorithm. See HeaderParser::CheckTransferSyntax().
+        ReadElements<VR::IMPLICIT, ByteOrder::BE>(reader);
       }
     }
   }
 
-  return true;
+  return !too_deep_;
 }
 
-std::uint32_t DicomReader::ReadValueLength(Reader& reader, VR vr,
-                                           std::uint32_t& read_length) {
-  std::uint32_t vl32 = 0;
-
-  if (vr_type_ == VR::EXPLICIT) {
-    // For VRs of OB, OD, OF, OL, OW, SQ, UN and UC, UR, UT, the 16 bits
-    // following the two character VR Field are reserved for use by later
-    // versions of the DICOM Standard.
-    // See: PS 3.5 Section 7.1.2 - Data Element Structure with Explicit VR
+void DicomReader::EndLevel(bool delimited) {
+  HeaderParser::Frame frame = parser_.PopFrame();
 
-    std::uint16_t vl16 = 0;
-    ReadUint16(reader, &vl16);
-    read_length += 2;
-
-    if (vl16 != 0) {
-      vl32 = vl16;
-    } else {
-      // The 16 bits after VR Field are 0, but we can't conclude that they
-      // are reserved since the value length might actually be 0.
-      // Check the VR to confirm it.
-      if (vr.Is16BitsFollowingReversed()) {
-        LOG_INFO("2 bytes following VR are reserved.");
-
-        // This 2 bytes are reserved, read the 4-byte value length.
-        ReadUint32(reader, &vl32);
-        read_length += 4;
-      } else {
-        // Value length is 0.
-        vl32 = 0;
-      }
-    }
-  } else {  // Implicit VR
-    ReadUint32(reader, &vl32);
-    read_length += 4;
+  if (frame.kind == HeaderParser::Frame::ROOT) {
+    return;
   }
 
-  return vl32;
+  if (frame.kind == HeaderParser::Frame::SEQUENCE) {
+    --depth_;
+    handler_->OnSequenceEnd(delimited);
+  } else {
+    handler_->OnSequenceItemEnd(delimited);
+  }
 }
 
 bool DicomReader::ReadValue(Reader& reader, Tag tag, VR vr,
                             std::uint32_t length, std::uint32_t& read_length) {
   if (vr == VR::SQ) {
-    auto data_sequence = new DataSequence(tag);
+    if (depth_ >= max_depth_) {
+      LOG_ERRO("Sequences are nested deeper than %u.",
+               static_cast<unsigned>(max_depth_));
+      too_deep_ = true;
+      return false;
+    }
+
+    auto data_sequence = ArenaNew<DataSequence>(arena_.get(), tag);
+    data_sequence->set_from_arena(!!arena_);
     data_sequence->set_length(length);
 
     handler_->OnSequenceStart(data_sequence);
 
-    if (length > 0) {
-      read_length += Read(reader, length);
-    }
-
-    handler_->OnSequenceEnd();
+    // The sequence is ended by EndLevel().
+    ++depth_;
+    parser_.PushFrame(HeaderParser::Frame::SEQUENCE, tag, length);
 
   } else {
     if (length == kUndefinedLength) {
@@ -431,27 +271,31 @@ bool DicomReader::ReadValue(Reader& reader, Tag tag, VR vr,
     }
 
     if (handler_->OnElementStart(tag)) {
-      DataElement* element = ReadElement(reader, tag, vr, length);
+      DataElement* element = nullptr;
+      if (handler_->data_chunk_size() > 0 &&
+          length > handler_->data_chunk_size()) {
+        element = ReadElementData(reader, tag, vr, length);
+      } else {
+        element = ReadElement(reader, tag, vr, length);
+      }
       if (element == nullptr) {
         return false;
       }
 
-      if (transfer_syntax_uid_.empty() && tag == tags::kTransferSyntaxUID) {
-        element->GetString(&transfer_syntax_uid_);
-      }
+      parser_.KeepValue(*element);
 
       // Call handler as the last step since it might delete the element.
       handler_->OnElementEnd(element);
 
     } else {
-      if (transfer_syntax_uid_.empty() && tag == tags::kTransferSyntaxUID) {
+      if (parser_.IsValueNeeded(tag)) {
         DataElement* element = ReadElement(reader, tag, vr, length);
         if (element == nullptr) {
           return false;
         }
 
-        element->GetString(&transfer_syntax_uid_);
-        delete element;
+        parser_.KeepValue(*element);
+        ArenaDelete(arena_.get(), element);
 
       } else {
         // Just skip the buffer.
@@ -470,16 +314,28 @@ bool DicomReader::ReadValue(Reader& reader, Tag tag, VR vr,
 
 DataElement* DicomReader::ReadElement(Reader& reader, Tag tag, VR vr,
                                       std::uint32_t length) {
-  auto element = new DataElement(tag, vr, byte_order_);
+  auto element =
+      ArenaNew<DataElement>(arena_.get(), tag, vr, parser_.byte_order());
+  element->set_from_arena(!!arena_);
+
+  if (value_source_ && length > lazy_threshold_ && vr.IsBinary()) {
+    // Skip the value and read it on demand.
+    element->SetLazyValue(value_source_, reader.Tell(), length);
+    reader.Seek(length, std::ios::cur);
+    return element;
+  }
 
   if (length > 0) {
-    Buffer buffer(length);
+    Buffer buffer;
+
+    bool ok = arena_ ? reader.ReadBuffer(length, &buffer, arena_)
+                     : reader.ReadBuffer(length, &buffer);
 
-    if (reader.ReadBytes(&buffer[0], length) == length) {
+    if (ok) {
       element->SetBuffer(std::move(buffer));
     } else {
       LOG_ERRO("Failed to read value of size: %u", length);
-      delete element;
+      ArenaDelete(arena_.get(), element);
       element = nullptr;
     }
   }
@@ -487,4 +343,30 @@ DataElement* DicomReader::ReadElement(Reader& reader, Tag tag, VR vr,
   return element;
 }
 
+DataElement* DicomReader::ReadElementData(Reader& reader, Tag tag, VR vr,
+                                          std::uint32_t length) {
+  std::vector<char> chunk(handler_->data_chunk_size());
+
+  std::uint32_t remaining = length;
+
+  while (remaining > 0) {
+    std::size_t n = std::min<std::size_t>(remaining, chunk.size());
+
+    if (reader.ReadBytes(chunk.data(), n) != static_cast<std::streamsize>(n)) {
+      LOG_ERRO("Failed to read value of size: %u", length);
+      return nullptr;
+    }
+
+    remaining -= static_cast<std::uint32_t>(n);
+
+    handler_->OnElementData(chunk.data(), n, remaining == 0);
+  }
+
+  auto element =
+      ArenaNew<DataElement>(arena_.get(), tag, vr, parser_.byte_order());
+  element->set_from_arena(!!arena_);
+  element->SetValueless(length);
+  return element;
+}
+
 }  // namespace dcm
@@ -1,82 +1,155 @@
 #ifndef DCM_DICOM_READER_H_
 #define DCM_DICOM_READER_H_
 
+#include <iosfwd>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "dcm/defs.h"
+#include "dcm/header_parser.h"
 
 namespace dcm {
 
+class Arena;
 class DataElement;
 class Reader;
 class ReadHandler;
+class ValueSource;
+
+// Where the value of Pixel Data (7FE0,0010) is, without reading it.
+struct PixelDataInfo {
+  // Byte offset of the value from the beginning of the source (or the stream
+  // position where reading started). -1 if Pixel Data is not found.
+  std::int64_t offset = -1;
+
+  VR vr;
+
+  // Value length, kUndefinedLength if encapsulated.
+  std::uint32_t length = 0;
+
+  // The pixel data is compressed and encapsulated in a sequence of fragments.
+  bool encapsulated = false;
+
+  bool found() const { return offset >= 0; }
+};
 
 class DicomReader {
 public:
+  // Default maximum depth of nested sequences.
+  static const std::size_t kDefaultMaxDepth = 64;
+
   explicit DicomReader(ReadHandler* handler);
 
   ~DicomReader();
 
-  // Read a DICOM file.
-  bool ReadFile(const Path& path);
+  // Stop reading at Pixel Data of the root data set (i.e., read the header
+  // only). The value is not read, but its position is recorded, see
+  // pixel_data_info().
+  void set_stop_at_pixel_data(bool stop_at_pixel_data) {
+    stop_at_pixel_data_ = stop_at_pixel_data;
+  }
 
-private:
-  bool DoRead(Reader& reader);
+  const PixelDataInfo& pixel_data_info() const { return pixel_data_info_; }
 
-  // Read data element sequentially from the reader.
-  // \param max_length Maximum value length to read for the current data set.
-  //        Could be kUndefinedLength (0xFFFFFFFF).
-  // \return The length read.
-  std::uint32_t Read(Reader& reader, std::size_t max_length);
+  // Stop reading (and fail) if sequences are nested deeper than this.
+  void set_max_depth(std::size_t max_depth) { max_depth_ = max_depth; }
 
-  // Check transfer syntax by Transfer Syntax UID read from 0x00020010.
-  // A "smart" algorithm will be used instead if 0x00020010 is absent.
-  void CheckTransferSyntax(Reader& reader);
+  // Defer reading the values of binary VRs (OB, OW, UN, etc.) larger than
+  // |threshold| bytes until they are accessed, see DataElement::IsLazy().
+  // Only applicable to ReadFile(), 0 (default) to disable.
+  void set_lazy_threshold(std::uint32_t threshold) {
+    lazy_threshold_ = threshold;
+  }
 
-  bool ReadTag(Reader& reader, Tag* tag);
+  // Allocate the data elements and the values from |arena| instead of one by
+  // one. The handler must destroy the elements by ArenaDelete(), e.g., by a
+  // data set sharing the same arena (see DataSet::set_arena()).
+  void set_arena(std::shared_ptr<Arena> arena) { arena_ = std::move(arena); }
 
-  bool ReadUint16(Reader& reader, std::uint16_t* value);
-  bool ReadUint32(Reader& reader, std::uint32_t* value);
+  // Read a DICOM file.
+  bool ReadFile(const Path& path);
+
+  // Read DICOM data from the current position of an input stream.
+  // The stream doesn't have to be seekable, e.g., std::cin from a pipe. It is
+  // parsed in one pass with a bounded look-back window, see BlockReader.
+  bool ReadStream(std::istream* stream);
+
+  // Read DICOM data from a range of bytes in memory.
+  // The values of the data elements are copied, so the bytes could be released
+  // once this returns.
+  bool ReadBuffer(const char* data, std::size_t size);
 
-  // Read sequence delimitation tag.
-  void ReadSeqDelimitation(Reader& reader, Tag tag, std::uint32_t& read_length);
+  // Read DICOM data from a range of bytes in memory without copying.
+  // The values of the data elements refer to the bytes and share the
+  // ownership of |keeper|, which should keep the bytes alive.
+  // E.g., pass the std::shared_ptr of the container holding the bytes.
+  bool ReadBuffer(const char* data, std::size_t size,
+                  std::shared_ptr<const void> keeper);
 
-  // Read sequence item delimitation tag.
-  void ReadSeqItemDelimitation(Reader& reader, Tag tag,
-                               std::uint32_t& read_length);
+  // Read a DICOM file by memory-mapping it.
+  // The values of the data elements refer to the mapped bytes instead of
+  // owning a copy. The mapping is released after the last of them is gone.
+  bool MapFile(const Path& path);
+
+private:
+  bool DoRead(Reader& reader);
 
-  // Read sequence prefix tag.
-  void ReadSeqItemPrefix(Reader& reader, Tag tag, std::uint32_t& read_length);
+  // Read data elements sequentially from the reader.
+  // The nested sequences and items are tracked by an explicit stack of levels
+  // instead of recursion.
+  // Return false if the sequences are nested too deep.
+  bool Read(Reader& reader);
 
-  // Read VR code.
-  bool ReadVR(Reader& reader, Tag tag, std::uint32_t& read_length, VR* vr);
+  // The read loop specialized for a transfer syntax, so that the VR type and
+  // byte order are not checked again for each tag, VR and value length.
+  // Return when all the levels have ended, or the transfer syntax of the data
+  // set (after group 0002) has been checked.
+  template <VR::Type kVrType, ByteOrder kByteOrder>
+  void ReadElements(Reader& reader);
 
-  std::uint32_t ReadValueLength(Reader& reader, VR vr,
-                                std::uint32_t& read_length);
+  // End the current level (i.e., the innermost sequence or item).
+  // |delimited| tells if it's ended with a delimitation tag.
+  void EndLevel(bool delimited = false);
 
+  // Read the value, or start a level for a sequence.
   bool ReadValue(Reader& reader, Tag tag, VR vr, std::uint32_t length,
                  std::uint32_t& read_length);
 
   DataElement* ReadElement(Reader& reader, Tag tag, VR vr,
                            std::uint32_t length);
 
+  // Read the value in chunks and pass them to the handler.
+  // The element returned has the value length only, see
+  // DataElement::IsValueless().
+  // See ReadHandler::OnElementData().
+  DataElement* ReadElementData(Reader& reader, Tag tag, VR vr,
+                               std::uint32_t length);
+
 private:
   ReadHandler* handler_;
 
-  // Transfer Syntax UID read from 0x00020010.
-  // Please note that some DICOM files don't have group 0002.
-  // But even if it's absent, a "smart" algorithm will be used to figure out the
-  // transfer syntax of the data set.
-  std::string transfer_syntax_uid_;
+  // The transfer syntax and the levels being read.
+  HeaderParser parser_;
+
+  bool stop_at_pixel_data_;
+  PixelDataInfo pixel_data_info_;
+
+  // Depth of nested sequences, 0 for the root data set.
+  std::size_t depth_;
+
+  std::size_t max_depth_;
+
+  // The sequences are nested deeper than |max_depth_|.
+  bool too_deep_;
 
-  // If the transfer syntax has been checked or not.
-  bool transfer_syntax_checked_;
+  std::uint32_t lazy_threshold_;
 
-  // Explicit or implicit VR.
-  VR::Type vr_type_;
+  // The file to read lazy values from, see set_lazy_threshold().
+  std::shared_ptr<ValueSource> value_source_;
 
-  // Little endian or big endian.
-  ByteOrder byte_order_;
+  // See set_arena().
+  std::shared_ptr<Arena> arena_;
 };
 
 }  // namespace dcm
@@ -1,3621 +1,5205 @@
-// NOTE: This file was automatically generated.
+// NOTE: This file was automatically generated by dict.py.
 
 static const Entry g_dict[] = {
-  { 0x00020000, VR::UL, "FileMetaInformationGroupLength" },
-  { 0x00020001, VR::OB, "FileMetaInformationVersion" },
-  { 0x00020002, VR::UI, "MediaStorageSOPClassUID" },
-  { 0x00020003, VR::UI, "MediaStorageSOPInstanceUID" },
-  { 0x00020010, VR::UI, "TransferSyntaxUID" },
-  { 0x00020012, VR::UI, "ImplementationClassUID" },
-  { 0x00020013, VR::SH, "ImplementationVersionName" },
-  { 0x00020016, VR::AE, "SourceApplicationEntityTitle" },
-  { 0x00020017, VR::AE, "SendingApplicationEntityTitle" },
-  { 0x00020018, VR::AE, "ReceivingApplicationEntityTitle" },
-  { 0x00020100, VR::UI, "PrivateInformationCreatorUID" },
-  { 0x00020102, VR::OB, "PrivateInformation" },
-  { 0x00041130, VR::CS, "FileSetID" },
-  { 0x00041141, VR::CS, "FileSetDescriptorFileID" },
-  { 0x00041142, VR::CS, "SpecificCharacterSetOfFileSetDescriptorFile" },
-  { 0x00041200, VR::UL, "OffsetOfTheFirstDirectoryRecordOfTheRootDirectoryEntity" },
-  { 0x00041202, VR::UL, "OffsetOfTheLastDirectoryRecordOfTheRootDirectoryEntity" },
-  { 0x00041212, VR::US, "FileSetConsistencyFlag" },
-  { 0x00041220, VR::SQ, "DirectoryRecordSequence" },
-  { 0x00041400, VR::UL, "OffsetOfTheNextDirectoryRecord" },
-  { 0x00041410, VR::US, "RecordInUseFlag" },
-  { 0x00041420, VR::UL, "OffsetOfReferencedLowerLevelDirectoryEntity" },
-  { 0x00041430, VR::CS, "DirectoryRecordType" },
-  { 0x00041432, VR::UI, "PrivateRecordUID" },
-  { 0x00041500, VR::CS, "ReferencedFileID" },
-  { 0x00041510, VR::UI, "ReferencedSOPClassUIDInFile" },
-  { 0x00041511, VR::UI, "ReferencedSOPInstanceUIDInFile" },
-  { 0x00041512, VR::UI, "ReferencedTransferSyntaxUIDInFile" },
-  { 0x0004151A, VR::UI, "ReferencedRelatedGeneralSOPClassUIDInFile" },
-  { 0x00080005, VR::CS, "SpecificCharacterSet" },
-  { 0x00080006, VR::SQ, "LanguageCodeSequence" },
-  { 0x00080008, VR::CS, "ImageType" },
-  { 0x00080012, VR::DA, "InstanceCreationDate" },
-  { 0x00080013, VR::TM, "InstanceCreationTime" },
-  { 0x00080014, VR::UI, "InstanceCreatorUID" },
-  { 0x00080015, VR::DT, "InstanceCoercionDateTime" },
-  { 0x00080016, VR::UI, "SOPClassUID" },
-  { 0x00080018, VR::UI, "SOPInstanceUID" },
-  { 0x0008001A, VR::UI, "RelatedGeneralSOPClassUID" },
-  { 0x0008001B, VR::UI, "OriginalSpecializedSOPClassUID" },
-  { 0x00080020, VR::DA, "StudyDate" },
-  { 0x00080021, VR::DA, "SeriesDate" },
-  { 0x00080022, VR::DA, "AcquisitionDate" },
-  { 0x00080023, VR::DA, "ContentDate" },
-  { 0x0008002A, VR::DT, "AcquisitionDateTime" },
-  { 0x00080030, VR::TM, "StudyTime" },
-  { 0x00080031, VR::TM, "SeriesTime" },
-  { 0x00080032, VR::TM, "AcquisitionTime" },
-  { 0x00080033, VR::TM, "ContentTime" },
-  { 0x00080050, VR::SH, "AccessionNumber" },
-  { 0x00080051, VR::SQ, "IssuerOfAccessionNumberSequence" },
-  { 0x00080052, VR::CS, "QueryRetrieveLevel" },
-  { 0x00080053, VR::CS, "QueryRetrieveView" },
-  { 0x00080054, VR::AE, "RetrieveAETitle" },
-  { 0x00080055, VR::AE, "StationAETitle" },
-  { 0x00080056, VR::CS, "InstanceAvailability" },
-  { 0x00080058, VR::UI, "FailedSOPInstanceUIDList" },
-  { 0x00080060, VR::CS, "Modality" },
-  { 0x00080061, VR::CS, "ModalitiesInStudy" },
-  { 0x00080062, VR::UI, "SOPClassesInStudy" },
-  { 0x00080064, VR::CS, "ConversionType" },
-  { 0x00080068, VR::CS, "PresentationIntentType" },
-  { 0x00080070, VR::LO, "Manufacturer" },
-  { 0x00080080, VR::LO, "InstitutionName" },
-  { 0x00080081, VR::ST, "InstitutionAddress" },
-  { 0x00080082, VR::SQ, "InstitutionCodeSequence" },
-  { 0x00080090, VR::PN, "ReferringPhysicianName" },
-  { 0x00080092, VR::ST, "ReferringPhysicianAddress" },
-  { 0x00080094, VR::SH, "ReferringPhysicianTelephoneNumbers" },
-  { 0x00080096, VR::SQ, "ReferringPhysicianIdentificationSequence" },
-  { 0x0008009C, VR::PN, "ConsultingPhysicianName" },
-  { 0x0008009D, VR::SQ, "ConsultingPhysicianIdentificationSequence" },
-  { 0x00080100, VR::SH, "CodeValue" },
-  { 0x00080101, VR::LO, "ExtendedCodeValue" },
-  { 0x00080102, VR::SH, "CodingSchemeDesignator" },
-  { 0x00080103, VR::SH, "CodingSchemeVersion" },
-  { 0x00080104, VR::LO, "CodeMeaning" },
-  { 0x00080105, VR::CS, "MappingResource" },
-  { 0x00080106, VR::DT, "ContextGroupVersion" },
-  { 0x00080107, VR::DT, "ContextGroupLocalVersion" },
-  { 0x00080108, VR::LT, "ExtendedCodeMeaning" },
-  { 0x0008010B, VR::CS, "ContextGroupExtensionFlag" },
-  { 0x0008010C, VR::UI, "CodingSchemeUID" },
-  { 0x0008010D, VR::UI, "ContextGroupExtensionCreatorUID" },
-  { 0x0008010F, VR::CS, "ContextIdentifier" },
-  { 0x00080110, VR::SQ, "CodingSchemeIdentificationSequence" },
-  { 0x00080112, VR::LO, "CodingSchemeRegistry" },
-  { 0x00080114, VR::ST, "CodingSchemeExternalID" },
-  { 0x00080115, VR::ST, "CodingSchemeName" },
-  { 0x00080116, VR::ST, "CodingSchemeResponsibleOrganization" },
-  { 0x00080117, VR::UI, "ContextUID" },
-  { 0x00080118, VR::UI, "MappingResourceUID" },
-  { 0x00080119, VR::UC, "LongCodeValue" },
-  { 0x00080120, VR::UR, "URNCodeValue" },
-  { 0x00080121, VR::SQ, "EquivalentCodeSequence" },
-  { 0x00080201, VR::SH, "TimezoneOffsetFromUTC" },
-  { 0x00080300, VR::SQ, "PrivateDataElementCharacteristicsSequence" },
-  { 0x00080301, VR::US, "PrivateGroupReference" },
-  { 0x00080302, VR::LO, "PrivateCreatorReference" },
-  { 0x00080303, VR::CS, "BlockIdentifyingInformationStatus" },
-  { 0x00080304, VR::US, "NonidentifyingPrivateElements" },
-  { 0x00080305, VR::SQ, "DeidentificationActionSequence" },
-  { 0x00080306, VR::US, "IdentifyingPrivateElements" },
-  { 0x00080307, VR::CS, "DeidentificationAction" },
-  { 0x00081010, VR::SH, "StationName" },
-  { 0x00081030, VR::LO, "StudyDescription" },
-  { 0x00081032, VR::SQ, "ProcedureCodeSequence" },
-  { 0x0008103E, VR::LO, "SeriesDescription" },
-  { 0x0008103F, VR::SQ, "SeriesDescriptionCodeSequence" },
-  { 0x00081040, VR::LO, "InstitutionalDepartmentName" },
-  { 0x00081048, VR::PN, "PhysiciansOfRecord" },
-  { 0x00081049, VR::SQ, "PhysiciansOfRecordIdentificationSequence" },
-  { 0x00081050, VR::PN, "PerformingPhysicianName" },
-  { 0x00081052, VR::SQ, "PerformingPhysicianIdentificationSequence" },
-  { 0x00081060, VR::PN, "NameOfPhysiciansReadingStudy" },
-  { 0x00081062, VR::SQ, "PhysiciansReadingStudyIdentificationSequence" },
-  { 0x00081070, VR::PN, "OperatorsName" },
-  { 0x00081072, VR::SQ, "OperatorIdentificationSequence" },
-  { 0x00081080, VR::LO, "AdmittingDiagnosesDescription" },
-  { 0x00081084, VR::SQ, "AdmittingDiagnosesCodeSequence" },
-  { 0x00081090, VR::LO, "ManufacturerModelName" },
-  { 0x00081110, VR::SQ, "ReferencedStudySequence" },
-  { 0x00081111, VR::SQ, "ReferencedPerformedProcedureStepSequence" },
-  { 0x00081115, VR::SQ, "ReferencedSeriesSequence" },
-  { 0x00081120, VR::SQ, "ReferencedPatientSequence" },
-  { 0x00081125, VR::SQ, "ReferencedVisitSequence" },
-  { 0x00081134, VR::SQ, "ReferencedStereometricInstanceSequence" },
-  { 0x0008113A, VR::SQ, "ReferencedWaveformSequence" },
-  { 0x00081140, VR::SQ, "ReferencedImageSequence" },
-  { 0x0008114A, VR::SQ, "ReferencedInstanceSequence" },
-  { 0x0008114B, VR::SQ, "ReferencedRealWorldValueMappingInstanceSequence" },
-  { 0x00081150, VR::UI, "ReferencedSOPClassUID" },
-  { 0x00081155, VR::UI, "ReferencedSOPInstanceUID" },
-  { 0x0008115A, VR::UI, "SOPClassesSupported" },
-  { 0x00081160, VR::IS, "ReferencedFrameNumber" },
-  { 0x00081161, VR::UL, "SimpleFrameList" },
-  { 0x00081162, VR::UL, "CalculatedFrameList" },
-  { 0x00081163, VR::FD, "TimeRange" },
-  { 0x00081164, VR::SQ, "FrameExtractionSequence" },
-  { 0x00081167, VR::UI, "MultiFrameSourceSOPInstanceUID" },
-  { 0x00081190, VR::UR, "RetrieveURL" },
-  { 0x00081195, VR::UI, "TransactionUID" },
-  { 0x00081196, VR::US, "WarningReason" },
-  { 0x00081197, VR::US, "FailureReason" },
-  { 0x00081198, VR::SQ, "FailedSOPSequence" },
-  { 0x00081199, VR::SQ, "ReferencedSOPSequence" },
-  { 0x0008119A, VR::SQ, "OtherFailuresSequence" },
-  { 0x00081200, VR::SQ, "StudiesContainingOtherReferencedInstancesSequence" },
-  { 0x00081250, VR::SQ, "RelatedSeriesSequence" },
-  { 0x00082111, VR::ST, "DerivationDescription" },
-  { 0x00082112, VR::SQ, "SourceImageSequence" },
-  { 0x00082120, VR::SH, "StageName" },
-  { 0x00082122, VR::IS, "StageNumber" },
-  { 0x00082124, VR::IS, "NumberOfStages" },
-  { 0x00082127, VR::SH, "ViewName" },
-  { 0x00082128, VR::IS, "ViewNumber" },
-  { 0x00082129, VR::IS, "NumberOfEventTimers" },
-  { 0x0008212A, VR::IS, "NumberOfViewsInStage" },
-  { 0x00082130, VR::DS, "EventElapsedTimes" },
-  { 0x00082132, VR::LO, "EventTimerNames" },
-  { 0x00082133, VR::SQ, "EventTimerSequence" },
-  { 0x00082134, VR::FD, "EventTimeOffset" },
-  { 0x00082135, VR::SQ, "EventCodeSequence" },
-  { 0x00082142, VR::IS, "StartTrim" },
-  { 0x00082143, VR::IS, "StopTrim" },
-  { 0x00082144, VR::IS, "RecommendedDisplayFrameRate" },
-  { 0x00082218, VR::SQ, "AnatomicRegionSequence" },
-  { 0x00082220, VR::SQ, "AnatomicRegionModifierSequence" },
-  { 0x00082228, VR::SQ, "PrimaryAnatomicStructureSequence" },
-  { 0x00082229, VR::SQ, "AnatomicStructureSpaceOrRegionSequence" },
-  { 0x00082230, VR::SQ, "PrimaryAnatomicStructureModifierSequence" },
-  { 0x00083001, VR::SQ, "AlternateRepresentationSequence" },
-  { 0x00083010, VR::UI, "IrradiationEventUID" },
-  { 0x00083011, VR::SQ, "SourceIrradiationEventSequence" },
-  { 0x00083012, VR::UI, "RadiopharmaceuticalAdministrationEventUID" },
-  { 0x00089007, VR::CS, "FrameType" },
-  { 0x00089092, VR::SQ, "ReferencedImageEvidenceSequence" },
-  { 0x00089121, VR::SQ, "ReferencedRawDataSequence" },
-  { 0x00089123, VR::UI, "CreatorVersionUID" },
-  { 0x00089124, VR::SQ, "DerivationImageSequence" },
-  { 0x00089154, VR::SQ, "SourceImageEvidenceSequence" },
-  { 0x00089205, VR::CS, "PixelPresentation" },
-  { 0x00089206, VR::CS, "VolumetricProperties" },
-  { 0x00089207, VR::CS, "VolumeBasedCalculationTechnique" },
-  { 0x00089208, VR::CS, "ComplexImageComponent" },
-  { 0x00089209, VR::CS, "AcquisitionContrast" },
-  { 0x00089215, VR::SQ, "DerivationCodeSequence" },
-  { 0x00089237, VR::SQ, "ReferencedPresentationStateSequence" },
-  { 0x00089410, VR::SQ, "ReferencedOtherPlaneSequence" },
-  { 0x00089458, VR::SQ, "FrameDisplaySequence" },
-  { 0x00089459, VR::FL, "RecommendedDisplayFrameRateInFloat" },
-  { 0x00089460, VR::CS, "SkipFrameRangeFlag" },
-  { 0x00100010, VR::PN, "PatientName" },
-  { 0x00100020, VR::LO, "PatientID" },
-  { 0x00100021, VR::LO, "IssuerOfPatientID" },
-  { 0x00100022, VR::CS, "TypeOfPatientID" },
-  { 0x00100024, VR::SQ, "IssuerOfPatientIDQualifiersSequence" },
-  { 0x00100026, VR::SQ, "SourcePatientGroupIdentificationSequence" },
-  { 0x00100027, VR::SQ, "GroupOfPatientsIdentificationSequence" },
-  { 0x00100028, VR::US, "SubjectRelativePositionInImage" },
-  { 0x00100030, VR::DA, "PatientBirthDate" },
-  { 0x00100032, VR::TM, "PatientBirthTime" },
-  { 0x00100040, VR::CS, "PatientSex" },
-  { 0x00100050, VR::SQ, "PatientInsurancePlanCodeSequence" },
-  { 0x00100101, VR::SQ, "PatientPrimaryLanguageCodeSequence" },
-  { 0x00100102, VR::SQ, "PatientPrimaryLanguageModifierCodeSequence" },
-  { 0x00100200, VR::CS, "QualityControlSubject" },
-  { 0x00100201, VR::SQ, "QualityControlSubjectTypeCodeSequence" },
-  { 0x00100212, VR::UC, "StrainDescription" },
-  { 0x00100213, VR::LO, "StrainNomenclature" },
-  { 0x00100214, VR::LO, "StrainStockNumber" },
-  { 0x00100215, VR::SQ, "StrainSourceRegistryCodeSequence" },
-  { 0x00100216, VR::SQ, "StrainStockSequence" },
-  { 0x00100217, VR::LO, "StrainSource" },
-  { 0x00100218, VR::UT, "StrainAdditionalInformation" },
-  { 0x00100219, VR::SQ, "StrainCodeSequence" },
-  { 0x00101000, VR::LO, "OtherPatientIDs" },
-  { 0x00101001, VR::PN, "OtherPatientNames" },
-  { 0x00101002, VR::SQ, "OtherPatientIDsSequence" },
-  { 0x00101005, VR::PN, "PatientBirthName" },
-  { 0x00101010, VR::AS, "PatientAge" },
-  { 0x00101020, VR::DS, "PatientSize" },
-  { 0x00101021, VR::SQ, "PatientSizeCodeSequence" },
-  { 0x00101030, VR::DS, "PatientWeight" },
-  { 0x00101040, VR::LO, "PatientAddress" },
-  { 0x00101060, VR::PN, "PatientMotherBirthName" },
-  { 0x00101080, VR::LO, "MilitaryRank" },
-  { 0x00101081, VR::LO, "BranchOfService" },
-  { 0x00101090, VR::LO, "MedicalRecordLocator" },
-  { 0x00101100, VR::SQ, "ReferencedPatientPhotoSequence" },
-  { 0x00102000, VR::LO, "MedicalAlerts" },
-  { 0x00102110, VR::LO, "Allergies" },
-  { 0x00102150, VR::LO, "CountryOfResidence" },
-  { 0x00102152, VR::LO, "RegionOfResidence" },
-  { 0x00102154, VR::SH, "PatientTelephoneNumbers" },
-  { 0x00102155, VR::LT, "PatientTelecomInformation" },
-  { 0x00102160, VR::SH, "EthnicGroup" },
-  { 0x00102180, VR::SH, "Occupation" },
-  { 0x001021A0, VR::CS, "SmokingStatus" },
-  { 0x001021B0, VR::LT, "AdditionalPatientHistory" },
-  { 0x001021C0, VR::US, "PregnancyStatus" },
-  { 0x001021D0, VR::DA, "LastMenstrualDate" },
-  { 0x001021F0, VR::LO, "PatientReligiousPreference" },
-  { 0x00102201, VR::LO, "PatientSpeciesDescription" },
-  { 0x00102202, VR::SQ, "PatientSpeciesCodeSequence" },
-  { 0x00102203, VR::CS, "PatientSexNeutered" },
-  { 0x00102210, VR::CS, "AnatomicalOrientationType" },
-  { 0x00102292, VR::LO, "PatientBreedDescription" },
-  { 0x00102293, VR::SQ, "PatientBreedCodeSequence" },
-  { 0x00102294, VR::SQ, "BreedRegistrationSequence" },
-  { 0x00102295, VR::LO, "BreedRegistrationNumber" },
-  { 0x00102296, VR::SQ, "BreedRegistryCodeSequence" },
-  { 0x00102297, VR::PN, "ResponsiblePerson" },
-  { 0x00102298, VR::CS, "ResponsiblePersonRole" },
-  { 0x00102299, VR::LO, "ResponsibleOrganization" },
-  { 0x00104000, VR::LT, "PatientComments" },
-  { 0x00109431, VR::FL, "ExaminedBodyThickness" },
-  { 0x00120010, VR::LO, "ClinicalTrialSponsorName" },
-  { 0x00120020, VR::LO, "ClinicalTrialProtocolID" },
-  { 0x00120021, VR::LO, "ClinicalTrialProtocolName" },
-  { 0x00120030, VR::LO, "ClinicalTrialSiteID" },
-  { 0x00120031, VR::LO, "ClinicalTrialSiteName" },
-  { 0x00120040, VR::LO, "ClinicalTrialSubjectID" },
-  { 0x00120042, VR::LO, "ClinicalTrialSubjectReadingID" },
-  { 0x00120050, VR::LO, "ClinicalTrialTimePointID" },
-  { 0x00120051, VR::ST, "ClinicalTrialTimePointDescription" },
-  { 0x00120060, VR::LO, "ClinicalTrialCoordinatingCenterName" },
-  { 0x00120062, VR::CS, "PatientIdentityRemoved" },
-  { 0x00120063, VR::LO, "DeidentificationMethod" },
-  { 0x00120064, VR::SQ, "DeidentificationMethodCodeSequence" },
-  { 0x00120071, VR::LO, "ClinicalTrialSeriesID" },
-  { 0x00120072, VR::LO, "ClinicalTrialSeriesDescription" },
-  { 0x00120081, VR::LO, "ClinicalTrialProtocolEthicsCommitteeName" },
-  { 0x00120082, VR::LO, "ClinicalTrialProtocolEthicsCommitteeApprovalNumber" },
-  { 0x00120083, VR::SQ, "ConsentForClinicalTrialUseSequence" },
-  { 0x00120084, VR::CS, "DistributionType" },
-  { 0x00120085, VR::CS, "ConsentForDistributionFlag" },
-  { 0x00140025, VR::ST, "ComponentManufacturingProcedure" },
-  { 0x00140028, VR::ST, "ComponentManufacturer" },
-  { 0x00140030, VR::DS, "MaterialThickness" },
-  { 0x00140032, VR::DS, "MaterialPipeDiameter" },
-  { 0x00140034, VR::DS, "MaterialIsolationDiameter" },
-  { 0x00140042, VR::ST, "MaterialGrade" },
-  { 0x00140044, VR::ST, "MaterialPropertiesDescription" },
-  { 0x00140046, VR::LT, "MaterialNotes" },
-  { 0x00140050, VR::CS, "ComponentShape" },
-  { 0x00140052, VR::CS, "CurvatureType" },
-  { 0x00140054, VR::DS, "OuterDiameter" },
-  { 0x00140056, VR::DS, "InnerDiameter" },
-  { 0x00140100, VR::LO, "ComponentWelderIDs" },
-  { 0x00140101, VR::CS, "SecondaryApprovalStatus" },
-  { 0x00140102, VR::DA, "SecondaryReviewDate" },
-  { 0x00140103, VR::TM, "SecondaryReviewTime" },
-  { 0x00140104, VR::PN, "SecondaryReviewerName" },
-  { 0x00140105, VR::ST, "RepairID" },
-  { 0x00140106, VR::SQ, "MultipleComponentApprovalSequence" },
-  { 0x00140107, VR::CS, "OtherApprovalStatus" },
-  { 0x00140108, VR::CS, "OtherSecondaryApprovalStatus" },
-  { 0x00141010, VR::ST, "ActualEnvironmentalConditions" },
-  { 0x00141020, VR::DA, "ExpiryDate" },
-  { 0x00141040, VR::ST, "EnvironmentalConditions" },
-  { 0x00142002, VR::SQ, "EvaluatorSequence" },
-  { 0x00142004, VR::IS, "EvaluatorNumber" },
-  { 0x00142006, VR::PN, "EvaluatorName" },
-  { 0x00142008, VR::IS, "EvaluationAttempt" },
-  { 0x00142012, VR::SQ, "IndicationSequence" },
-  { 0x00142014, VR::IS, "IndicationNumber" },
-  { 0x00142016, VR::SH, "IndicationLabel" },
-  { 0x00142018, VR::ST, "IndicationDescription" },
-  { 0x0014201A, VR::CS, "IndicationType" },
-  { 0x0014201C, VR::CS, "IndicationDisposition" },
-  { 0x0014201E, VR::SQ, "IndicationROISequence" },
-  { 0x00142030, VR::SQ, "IndicationPhysicalPropertySequence" },
-  { 0x00142032, VR::SH, "PropertyLabel" },
-  { 0x00142202, VR::IS, "CoordinateSystemNumberOfAxes" },
-  { 0x00142204, VR::SQ, "CoordinateSystemAxesSequence" },
-  { 0x00142206, VR::ST, "CoordinateSystemAxisDescription" },
-  { 0x00142208, VR::CS, "CoordinateSystemDataSetMapping" },
-  { 0x0014220A, VR::IS, "CoordinateSystemAxisNumber" },
-  { 0x0014220C, VR::CS, "CoordinateSystemAxisType" },
-  { 0x0014220E, VR::CS, "CoordinateSystemAxisUnits" },
-  { 0x00142210, VR::OB, "CoordinateSystemAxisValues" },
-  { 0x00142220, VR::SQ, "CoordinateSystemTransformSequence" },
-  { 0x00142222, VR::ST, "TransformDescription" },
-  { 0x00142224, VR::IS, "TransformNumberOfAxes" },
-  { 0x00142226, VR::IS, "TransformOrderOfAxes" },
-  { 0x00142228, VR::CS, "TransformedAxisUnits" },
-  { 0x0014222A, VR::DS, "CoordinateSystemTransformRotationAndScaleMatrix" },
-  { 0x0014222C, VR::DS, "CoordinateSystemTransformTranslationMatrix" },
-  { 0x00143011, VR::DS, "InternalDetectorFrameTime" },
-  { 0x00143012, VR::DS, "NumberOfFramesIntegrated" },
-  { 0x00143020, VR::SQ, "DetectorTemperatureSequence" },
-  { 0x00143022, VR::ST, "SensorName" },
-  { 0x00143024, VR::DS, "HorizontalOffsetOfSensor" },
-  { 0x00143026, VR::DS, "VerticalOffsetOfSensor" },
-  { 0x00143028, VR::DS, "SensorTemperature" },
-  { 0x00143040, VR::SQ, "DarkCurrentSequence" },
-  { 0x00143050, VR::OB, "DarkCurrentCounts" },
-  { 0x00143060, VR::SQ, "GainCorrectionReferenceSequence" },
-  { 0x00143070, VR::OB, "AirCounts" },
-  { 0x00143071, VR::DS, "KVUsedInGainCalibration" },
-  { 0x00143072, VR::DS, "MAUsedInGainCalibration" },
-  { 0x00143073, VR::DS, "NumberOfFramesUsedForIntegration" },
-  { 0x00143074, VR::LO, "FilterMaterialUsedInGainCalibration" },
-  { 0x00143075, VR::DS, "FilterThicknessUsedInGainCalibration" },
-  { 0x00143076, VR::DA, "DateOfGainCalibration" },
-  { 0x00143077, VR::TM, "TimeOfGainCalibration" },
-  { 0x00143080, VR::OB, "BadPixelImage" },
-  { 0x00143099, VR::LT, "CalibrationNotes" },
-  { 0x00144002, VR::SQ, "PulserEquipmentSequence" },
-  { 0x00144004, VR::CS, "PulserType" },
-  { 0x00144006, VR::LT, "PulserNotes" },
-  { 0x00144008, VR::SQ, "ReceiverEquipmentSequence" },
-  { 0x0014400A, VR::CS, "AmplifierType" },
-  { 0x0014400C, VR::LT, "ReceiverNotes" },
-  { 0x0014400E, VR::SQ, "PreAmplifierEquipmentSequence" },
-  { 0x0014400F, VR::LT, "PreAmplifierNotes" },
-  { 0x00144010, VR::SQ, "TransmitTransducerSequence" },
-  { 0x00144011, VR::SQ, "ReceiveTransducerSequence" },
-  { 0x00144012, VR::US, "NumberOfElements" },
-  { 0x00144013, VR::CS, "ElementShape" },
-  { 0x00144014, VR::DS, "ElementDimensionA" },
-  { 0x00144015, VR::DS, "ElementDimensionB" },
-  { 0x00144016, VR::DS, "ElementPitchA" },
-  { 0x00144017, VR::DS, "MeasuredBeamDimensionA" },
-  { 0x00144018, VR::DS, "MeasuredBeamDimensionB" },
-  { 0x00144019, VR::DS, "LocationOfMeasuredBeamDiameter" },
-  { 0x0014401A, VR::DS, "NominalFrequency" },
-  { 0x0014401B, VR::DS, "MeasuredCenterFrequency" },
-  { 0x0014401C, VR::DS, "MeasuredBandwidth" },
-  { 0x0014401D, VR::DS, "ElementPitchB" },
-  { 0x00144020, VR::SQ, "PulserSettingsSequence" },
-  { 0x00144022, VR::DS, "PulseWidth" },
-  { 0x00144024, VR::DS, "ExcitationFrequency" },
-  { 0x00144026, VR::CS, "ModulationType" },
-  { 0x00144028, VR::DS, "Damping" },
-  { 0x00144030, VR::SQ, "ReceiverSettingsSequence" },
-  { 0x00144031, VR::DS, "AcquiredSoundpathLength" },
-  { 0x00144032, VR::CS, "AcquisitionCompressionType" },
-  { 0x00144033, VR::IS, "AcquisitionSampleSize" },
-  { 0x00144034, VR::DS, "RectifierSmoothing" },
-  { 0x00144035, VR::SQ, "DACSequence" },
-  { 0x00144036, VR::CS, "DACType" },
-  { 0x00144038, VR::DS, "DACGainPoints" },
-  { 0x0014403A, VR::DS, "DACTimePoints" },
-  { 0x0014403C, VR::DS, "DACAmplitude" },
-  { 0x00144040, VR::SQ, "PreAmplifierSettingsSequence" },
-  { 0x00144050, VR::SQ, "TransmitTransducerSettingsSequence" },
-  { 0x00144051, VR::SQ, "ReceiveTransducerSettingsSequence" },
-  { 0x00144052, VR::DS, "IncidentAngle" },
-  { 0x00144054, VR::ST, "CouplingTechnique" },
-  { 0x00144056, VR::ST, "CouplingMedium" },
-  { 0x00144057, VR::DS, "CouplingVelocity" },
-  { 0x00144058, VR::DS, "ProbeCenterLocationX" },
-  { 0x00144059, VR::DS, "ProbeCenterLocationZ" },
-  { 0x0014405A, VR::DS, "SoundPathLength" },
-  { 0x0014405C, VR::ST, "DelayLawIdentifier" },
-  { 0x00144060, VR::SQ, "GateSettingsSequence" },
-  { 0x00144062, VR::DS, "GateThreshold" },
-  { 0x00144064, VR::DS, "VelocityOfSound" },
-  { 0x00144070, VR::SQ, "CalibrationSettingsSequence" },
-  { 0x00144072, VR::ST, "CalibrationProcedure" },
-  { 0x00144074, VR::SH, "ProcedureVersion" },
-  { 0x00144076, VR::DA, "ProcedureCreationDate" },
-  { 0x00144078, VR::DA, "ProcedureExpirationDate" },
-  { 0x0014407A, VR::DA, "ProcedureLastModifiedDate" },
-  { 0x0014407C, VR::TM, "CalibrationTime" },
-  { 0x0014407E, VR::DA, "CalibrationDate" },
-  { 0x00144080, VR::SQ, "ProbeDriveEquipmentSequence" },
-  { 0x00144081, VR::CS, "DriveType" },
-  { 0x00144082, VR::LT, "ProbeDriveNotes" },
-  { 0x00144083, VR::SQ, "DriveProbeSequence" },
-  { 0x00144084, VR::DS, "ProbeInductance" },
-  { 0x00144085, VR::DS, "ProbeResistance" },
-  { 0x00144086, VR::SQ, "ReceiveProbeSequence" },
-  { 0x00144087, VR::SQ, "ProbeDriveSettingsSequence" },
-  { 0x00144088, VR::DS, "BridgeResistors" },
-  { 0x00144089, VR::DS, "ProbeOrientationAngle" },
-  { 0x0014408B, VR::DS, "UserSelectedGainY" },
-  { 0x0014408C, VR::DS, "UserSelectedPhase" },
-  { 0x0014408D, VR::DS, "UserSelectedOffsetX" },
-  { 0x0014408E, VR::DS, "UserSelectedOffsetY" },
-  { 0x00144091, VR::SQ, "ChannelSettingsSequence" },
-  { 0x00144092, VR::DS, "ChannelThreshold" },
-  { 0x0014409A, VR::SQ, "ScannerSettingsSequence" },
-  { 0x0014409B, VR::ST, "ScanProcedure" },
-  { 0x0014409C, VR::DS, "TranslationRateX" },
-  { 0x0014409D, VR::DS, "TranslationRateY" },
-  { 0x0014409F, VR::DS, "ChannelOverlap" },
-  { 0x001440A0, VR::LO, "ImageQualityIndicatorType" },
-  { 0x001440A1, VR::LO, "ImageQualityIndicatorMaterial" },
-  { 0x001440A2, VR::LO, "ImageQualityIndicatorSize" },
-  { 0x00145002, VR::IS, "LINACEnergy" },
-  { 0x00145004, VR::IS, "LINACOutput" },
-  { 0x00145100, VR::US, "ActiveAperture" },
-  { 0x00145101, VR::DS, "TotalAperture" },
-  { 0x00145102, VR::DS, "ApertureElevation" },
-  { 0x00145103, VR::DS, "MainLobeAngle" },
-  { 0x00145104, VR::DS, "MainRoofAngle" },
-  { 0x00145105, VR::CS, "ConnectorType" },
-  { 0x00145106, VR::SH, "WedgeModelNumber" },
-  { 0x00145107, VR::DS, "WedgeAngleFloat" },
-  { 0x00145108, VR::DS, "WedgeRoofAngle" },
-  { 0x00145109, VR::CS, "WedgeElement1Position" },
-  { 0x0014510A, VR::DS, "WedgeMaterialVelocity" },
-  { 0x0014510B, VR::SH, "WedgeMaterial" },
-  { 0x0014510C, VR::DS, "WedgeOffsetZ" },
-  { 0x0014510D, VR::DS, "WedgeOriginOffsetX" },
-  { 0x0014510E, VR::DS, "WedgeTimeDelay" },
-  { 0x0014510F, VR::SH, "WedgeName" },
-  { 0x00145110, VR::SH, "WedgeManufacturerName" },
-  { 0x00145111, VR::LO, "WedgeDescription" },
-  { 0x00145112, VR::DS, "NominalBeamAngle" },
-  { 0x00145113, VR::DS, "WedgeOffsetX" },
-  { 0x00145114, VR::DS, "WedgeOffsetY" },
-  { 0x00145115, VR::DS, "WedgeTotalLength" },
-  { 0x00145116, VR::DS, "WedgeInContactLength" },
-  { 0x00145117, VR::DS, "WedgeFrontGap" },
-  { 0x00145118, VR::DS, "WedgeTotalHeight" },
-  { 0x00145119, VR::DS, "WedgeFrontHeight" },
-  { 0x0014511A, VR::DS, "WedgeRearHeight" },
-  { 0x0014511B, VR::DS, "WedgeTotalWidth" },
-  { 0x0014511C, VR::DS, "WedgeInContactWidth" },
-  { 0x0014511D, VR::DS, "WedgeChamferHeight" },
-  { 0x0014511E, VR::CS, "WedgeCurve" },
-  { 0x0014511F, VR::DS, "RadiusAlongWedge" },
-  { 0x00180010, VR::LO, "ContrastBolusAgent" },
-  { 0x00180012, VR::SQ, "ContrastBolusAgentSequence" },
-  { 0x00180013, VR::FL, "ContrastBolusT1Relaxivity" },
-  { 0x00180014, VR::SQ, "ContrastBolusAdministrationRouteSequence" },
-  { 0x00180015, VR::CS, "BodyPartExamined" },
-  { 0x00180020, VR::CS, "ScanningSequence" },
-  { 0x00180021, VR::CS, "SequenceVariant" },
-  { 0x00180022, VR::CS, "ScanOptions" },
-  { 0x00180023, VR::CS, "MRAcquisitionType" },
-  { 0x00180024, VR::SH, "SequenceName" },
-  { 0x00180025, VR::CS, "AngioFlag" },
-  { 0x00180026, VR::SQ, "InterventionDrugInformationSequence" },
-  { 0x00180027, VR::TM, "InterventionDrugStopTime" },
-  { 0x00180028, VR::DS, "InterventionDrugDose" },
-  { 0x00180029, VR::SQ, "InterventionDrugCodeSequence" },
-  { 0x0018002A, VR::SQ, "AdditionalDrugSequence" },
-  { 0x00180031, VR::LO, "Radiopharmaceutical" },
-  { 0x00180034, VR::LO, "InterventionDrugName" },
-  { 0x00180035, VR::TM, "InterventionDrugStartTime" },
-  { 0x00180036, VR::SQ, "InterventionSequence" },
-  { 0x00180038, VR::CS, "InterventionStatus" },
-  { 0x0018003A, VR::ST, "InterventionDescription" },
-  { 0x00180040, VR::IS, "CineRate" },
-  { 0x00180042, VR::CS, "InitialCineRunState" },
-  { 0x00180050, VR::DS, "SliceThickness" },
-  { 0x00180060, VR::DS, "KVP" },
-  { 0x00180070, VR::IS, "CountsAccumulated" },
-  { 0x00180071, VR::CS, "AcquisitionTerminationCondition" },
-  { 0x00180072, VR::DS, "EffectiveDuration" },
-  { 0x00180073, VR::CS, "AcquisitionStartCondition" },
-  { 0x00180074, VR::IS, "AcquisitionStartConditionData" },
-  { 0x00180075, VR::IS, "AcquisitionTerminationConditionData" },
-  { 0x00180080, VR::DS, "RepetitionTime" },
-  { 0x00180081, VR::DS, "EchoTime" },
-  { 0x00180082, VR::DS, "InversionTime" },
-  { 0x00180083, VR::DS, "NumberOfAverages" },
-  { 0x00180084, VR::DS, "ImagingFrequency" },
-  { 0x00180085, VR::SH, "ImagedNucleus" },
-  { 0x00180086, VR::IS, "EchoNumbers" },
-  { 0x00180087, VR::DS, "MagneticFieldStrength" },
-  { 0x00180088, VR::DS, "SpacingBetweenSlices" },
-  { 0x00180089, VR::IS, "NumberOfPhaseEncodingSteps" },
-  { 0x00180090, VR::DS, "DataCollectionDiameter" },
-  { 0x00180091, VR::IS, "EchoTrainLength" },
-  { 0x00180093, VR::DS, "PercentSampling" },
-  { 0x00180094, VR::DS, "PercentPhaseFieldOfView" },
-  { 0x00180095, VR::DS, "PixelBandwidth" },
-  { 0x00181000, VR::LO, "DeviceSerialNumber" },
-  { 0x00181002, VR::UI, "DeviceUID" },
-  { 0x00181003, VR::LO, "DeviceID" },
-  { 0x00181004, VR::LO, "PlateID" },
-  { 0x00181005, VR::LO, "GeneratorID" },
-  { 0x00181006, VR::LO, "GridID" },
-  { 0x00181007, VR::LO, "CassetteID" },
-  { 0x00181008, VR::LO, "GantryID" },
-  { 0x00181010, VR::LO, "SecondaryCaptureDeviceID" },
-  { 0x00181012, VR::DA, "DateOfSecondaryCapture" },
-  { 0x00181014, VR::TM, "TimeOfSecondaryCapture" },
-  { 0x00181016, VR::LO, "SecondaryCaptureDeviceManufacturer" },
-  { 0x00181018, VR::LO, "SecondaryCaptureDeviceManufacturerModelName" },
-  { 0x00181019, VR::LO, "SecondaryCaptureDeviceSoftwareVersions" },
-  { 0x00181020, VR::LO, "SoftwareVersions" },
-  { 0x00181022, VR::SH, "VideoImageFormatAcquired" },
-  { 0x00181023, VR::LO, "DigitalImageFormatAcquired" },
-  { 0x00181030, VR::LO, "ProtocolName" },
-  { 0x00181040, VR::LO, "ContrastBolusRoute" },
-  { 0x00181041, VR::DS, "ContrastBolusVolume" },
-  { 0x00181042, VR::TM, "ContrastBolusStartTime" },
-  { 0x00181043, VR::TM, "ContrastBolusStopTime" },
-  { 0x00181044, VR::DS, "ContrastBolusTotalDose" },
-  { 0x00181045, VR::IS, "SyringeCounts" },
-  { 0x00181046, VR::DS, "ContrastFlowRate" },
-  { 0x00181047, VR::DS, "ContrastFlowDuration" },
-  { 0x00181048, VR::CS, "ContrastBolusIngredient" },
-  { 0x00181049, VR::DS, "ContrastBolusIngredientConcentration" },
-  { 0x00181050, VR::DS, "SpatialResolution" },
-  { 0x00181060, VR::DS, "TriggerTime" },
-  { 0x00181061, VR::LO, "TriggerSourceOrType" },
-  { 0x00181062, VR::IS, "NominalInterval" },
-  { 0x00181063, VR::DS, "FrameTime" },
-  { 0x00181064, VR::LO, "CardiacFramingType" },
-  { 0x00181065, VR::DS, "FrameTimeVector" },
-  { 0x00181066, VR::DS, "FrameDelay" },
-  { 0x00181067, VR::DS, "ImageTriggerDelay" },
-  { 0x00181068, VR::DS, "MultiplexGroupTimeOffset" },
-  { 0x00181069, VR::DS, "TriggerTimeOffset" },
-  { 0x0018106A, VR::CS, "SynchronizationTrigger" },
-  { 0x0018106C, VR::US, "SynchronizationChannel" },
-  { 0x0018106E, VR::UL, "TriggerSamplePosition" },
-  { 0x00181070, VR::LO, "RadiopharmaceuticalRoute" },
-  { 0x00181071, VR::DS, "RadiopharmaceuticalVolume" },
-  { 0x00181072, VR::TM, "RadiopharmaceuticalStartTime" },
-  { 0x00181073, VR::TM, "RadiopharmaceuticalStopTime" },
-  { 0x00181074, VR::DS, "RadionuclideTotalDose" },
-  { 0x00181075, VR::DS, "RadionuclideHalfLife" },
-  { 0x00181076, VR::DS, "RadionuclidePositronFraction" },
-  { 0x00181077, VR::DS, "RadiopharmaceuticalSpecificActivity" },
-  { 0x00181078, VR::DT, "RadiopharmaceuticalStartDateTime" },
-  { 0x00181079, VR::DT, "RadiopharmaceuticalStopDateTime" },
-  { 0x00181080, VR::CS, "BeatRejectionFlag" },
-  { 0x00181081, VR::IS, "LowRRValue" },
-  { 0x00181082, VR::IS, "HighRRValue" },
-  { 0x00181083, VR::IS, "IntervalsAcquired" },
-  { 0x00181084, VR::IS, "IntervalsRejected" },
-  { 0x00181085, VR::LO, "PVCRejection" },
-  { 0x00181086, VR::IS, "SkipBeats" },
-  { 0x00181088, VR::IS, "HeartRate" },
-  { 0x00181090, VR::IS, "CardiacNumberOfImages" },
-  { 0x00181094, VR::IS, "TriggerWindow" },
-  { 0x00181100, VR::DS, "ReconstructionDiameter" },
-  { 0x00181110, VR::DS, "DistanceSourceToDetector" },
-  { 0x00181111, VR::DS, "DistanceSourceToPatient" },
-  { 0x00181114, VR::DS, "EstimatedRadiographicMagnificationFactor" },
-  { 0x00181120, VR::DS, "GantryDetectorTilt" },
-  { 0x00181121, VR::DS, "GantryDetectorSlew" },
-  { 0x00181130, VR::DS, "TableHeight" },
-  { 0x00181131, VR::DS, "TableTraverse" },
-  { 0x00181134, VR::CS, "TableMotion" },
-  { 0x00181135, VR::DS, "TableVerticalIncrement" },
-  { 0x00181136, VR::DS, "TableLateralIncrement" },
-  { 0x00181137, VR::DS, "TableLongitudinalIncrement" },
-  { 0x00181138, VR::DS, "TableAngle" },
-  { 0x0018113A, VR::CS, "TableType" },
-  { 0x00181140, VR::CS, "RotationDirection" },
-  { 0x00181142, VR::DS, "RadialPosition" },
-  { 0x00181143, VR::DS, "ScanArc" },
-  { 0x00181144, VR::DS, "AngularStep" },
-  { 0x00181145, VR::DS, "CenterOfRotationOffset" },
-  { 0x00181147, VR::CS, "FieldOfViewShape" },
-  { 0x00181149, VR::IS, "FieldOfViewDimensions" },
-  { 0x00181150, VR::IS, "ExposureTime" },
-  { 0x00181151, VR::IS, "XRayTubeCurrent" },
-  { 0x00181152, VR::IS, "Exposure" },
-  { 0x00181153, VR::IS, "ExposureInuAs" },
-  { 0x00181154, VR::DS, "AveragePulseWidth" },
-  { 0x00181155, VR::CS, "RadiationSetting" },
-  { 0x00181156, VR::CS, "RectificationType" },
-  { 0x0018115A, VR::CS, "RadiationMode" },
-  { 0x0018115E, VR::DS, "ImageAndFluoroscopyAreaDoseProduct" },
-  { 0x00181160, VR::SH, "FilterType" },
-  { 0x00181161, VR::LO, "TypeOfFilters" },
-  { 0x00181162, VR::DS, "IntensifierSize" },
-  { 0x00181164, VR::DS, "ImagerPixelSpacing" },
-  { 0x00181166, VR::CS, "Grid" },
-  { 0x00181170, VR::IS, "GeneratorPower" },
-  { 0x00181180, VR::SH, "CollimatorGridName" },
-  { 0x00181181, VR::CS, "CollimatorType" },
-  { 0x00181182, VR::IS, "FocalDistance" },
-  { 0x00181183, VR::DS, "XFocusCenter" },
-  { 0x00181184, VR::DS, "YFocusCenter" },
-  { 0x00181190, VR::DS, "FocalSpots" },
-  { 0x00181191, VR::CS, "AnodeTargetMaterial" },
-  { 0x001811A0, VR::DS, "BodyPartThickness" },
-  { 0x001811A2, VR::DS, "CompressionForce" },
-  { 0x001811A4, VR::LO, "PaddleDescription" },
-  { 0x00181200, VR::DA, "DateOfLastCalibration" },
-  { 0x00181201, VR::TM, "TimeOfLastCalibration" },
-  { 0x00181202, VR::DT, "DateTimeOfLastCalibration" },
-  { 0x00181210, VR::SH, "ConvolutionKernel" },
-  { 0x00181242, VR::IS, "ActualFrameDuration" },
-  { 0x00181243, VR::IS, "CountRate" },
-  { 0x00181244, VR::US, "PreferredPlaybackSequencing" },
-  { 0x00181250, VR::SH, "ReceiveCoilName" },
-  { 0x00181251, VR::SH, "TransmitCoilName" },
-  { 0x00181260, VR::SH, "PlateType" },
-  { 0x00181261, VR::LO, "PhosphorType" },
-  { 0x00181300, VR::DS, "ScanVelocity" },
-  { 0x00181301, VR::CS, "WholeBodyTechnique" },
-  { 0x00181302, VR::IS, "ScanLength" },
-  { 0x00181310, VR::US, "AcquisitionMatrix" },
-  { 0x00181312, VR::CS, "InPlanePhaseEncodingDirection" },
-  { 0x00181314, VR::DS, "FlipAngle" },
-  { 0x00181315, VR::CS, "VariableFlipAngleFlag" },
-  { 0x00181316, VR::DS, "SAR" },
-  { 0x00181318, VR::DS, "dBdt" },
-  { 0x00181320, VR::FL, "B1rms" },
-  { 0x00181400, VR::LO, "AcquisitionDeviceProcessingDescription" },
-  { 0x00181401, VR::LO, "AcquisitionDeviceProcessingCode" },
-  { 0x00181402, VR::CS, "CassetteOrientation" },
-  { 0x00181403, VR::CS, "CassetteSize" },
-  { 0x00181404, VR::US, "ExposuresOnPlate" },
-  { 0x00181405, VR::IS, "RelativeXRayExposure" },
-  { 0x00181411, VR::DS, "ExposureIndex" },
-  { 0x00181412, VR::DS, "TargetExposureIndex" },
-  { 0x00181413, VR::DS, "DeviationIndex" },
-  { 0x00181450, VR::DS, "ColumnAngulation" },
-  { 0x00181460, VR::DS, "TomoLayerHeight" },
-  { 0x00181470, VR::DS, "TomoAngle" },
-  { 0x00181480, VR::DS, "TomoTime" },
-  { 0x00181490, VR::CS, "TomoType" },
-  { 0x00181491, VR::CS, "TomoClass" },
-  { 0x00181495, VR::IS, "NumberOfTomosynthesisSourceImages" },
-  { 0x00181500, VR::CS, "PositionerMotion" },
-  { 0x00181508, VR::CS, "PositionerType" },
-  { 0x00181510, VR::DS, "PositionerPrimaryAngle" },
-  { 0x00181511, VR::DS, "PositionerSecondaryAngle" },
-  { 0x00181520, VR::DS, "PositionerPrimaryAngleIncrement" },
-  { 0x00181521, VR::DS, "PositionerSecondaryAngleIncrement" },
-  { 0x00181530, VR::DS, "DetectorPrimaryAngle" },
-  { 0x00181531, VR::DS, "DetectorSecondaryAngle" },
-  { 0x00181600, VR::CS, "ShutterShape" },
-  { 0x00181602, VR::IS, "ShutterLeftVerticalEdge" },
-  { 0x00181604, VR::IS, "ShutterRightVerticalEdge" },
-  { 0x00181606, VR::IS, "ShutterUpperHorizontalEdge" },
-  { 0x00181608, VR::IS, "ShutterLowerHorizontalEdge" },
-  { 0x00181610, VR::IS, "CenterOfCircularShutter" },
-  { 0x00181612, VR::IS, "RadiusOfCircularShutter" },
-  { 0x00181620, VR::IS, "VerticesOfThePolygonalShutter" },
-  { 0x00181622, VR::US, "ShutterPresentationValue" },
-  { 0x00181623, VR::US, "ShutterOverlayGroup" },
-  { 0x00181624, VR::US, "ShutterPresentationColorCIELabValue" },
-  { 0x00181700, VR::CS, "CollimatorShape" },
-  { 0x00181702, VR::IS, "CollimatorLeftVerticalEdge" },
-  { 0x00181704, VR::IS, "CollimatorRightVerticalEdge" },
-  { 0x00181706, VR::IS, "CollimatorUpperHorizontalEdge" },
-  { 0x00181708, VR::IS, "CollimatorLowerHorizontalEdge" },
-  { 0x00181710, VR::IS, "CenterOfCircularCollimator" },
-  { 0x00181712, VR::IS, "RadiusOfCircularCollimator" },
-  { 0x00181720, VR::IS, "VerticesOfThePolygonalCollimator" },
-  { 0x00181800, VR::CS, "AcquisitionTimeSynchronized" },
-  { 0x00181801, VR::SH, "TimeSource" },
-  { 0x00181802, VR::CS, "TimeDistributionProtocol" },
-  { 0x00181803, VR::LO, "NTPSourceAddress" },
-  { 0x00182001, VR::IS, "PageNumberVector" },
-  { 0x00182002, VR::SH, "FrameLabelVector" },
-  { 0x00182003, VR::DS, "FramePrimaryAngleVector" },
-  { 0x00182004, VR::DS, "FrameSecondaryAngleVector" },
-  { 0x00182005, VR::DS, "SliceLocationVector" },
-  { 0x00182006, VR::SH, "DisplayWindowLabelVector" },
-  { 0x00182010, VR::DS, "NominalScannedPixelSpacing" },
-  { 0x00182020, VR::CS, "DigitizingDeviceTransportDirection" },
-  { 0x00182030, VR::DS, "RotationOfScannedFilm" },
-  { 0x00182041, VR::SQ, "BiopsyTargetSequence" },
-  { 0x00182042, VR::UI, "TargetUID" },
-  { 0x00182043, VR::FL, "LocalizingCursorPosition" },
-  { 0x00182044, VR::FL, "CalculatedTargetPosition" },
-  { 0x00182045, VR::SH, "TargetLabel" },
-  { 0x00182046, VR::FL, "DisplayedZValue" },
-  { 0x00183100, VR::CS, "IVUSAcquisition" },
-  { 0x00183101, VR::DS, "IVUSPullbackRate" },
-  { 0x00183102, VR::DS, "IVUSGatedRate" },
-  { 0x00183103, VR::IS, "IVUSPullbackStartFrameNumber" },
-  { 0x00183104, VR::IS, "IVUSPullbackStopFrameNumber" },
-  { 0x00183105, VR::IS, "LesionNumber" },
-  { 0x00185000, VR::SH, "OutputPower" },
-  { 0x00185010, VR::LO, "TransducerData" },
-  { 0x00185012, VR::DS, "FocusDepth" },
-  { 0x00185020, VR::LO, "ProcessingFunction" },
-  { 0x00185022, VR::DS, "MechanicalIndex" },
-  { 0x00185024, VR::DS, "BoneThermalIndex" },
-  { 0x00185026, VR::DS, "CranialThermalIndex" },
-  { 0x00185027, VR::DS, "SoftTissueThermalIndex" },
-  { 0x00185028, VR::DS, "SoftTissueFocusThermalIndex" },
-  { 0x00185029, VR::DS, "SoftTissueSurfaceThermalIndex" },
-  { 0x00185050, VR::IS, "DepthOfScanField" },
-  { 0x00185100, VR::CS, "PatientPosition" },
-  { 0x00185101, VR::CS, "ViewPosition" },
-  { 0x00185104, VR::SQ, "ProjectionEponymousNameCodeSequence" },
-  { 0x00186000, VR::DS, "Sensitivity" },
-  { 0x00186011, VR::SQ, "SequenceOfUltrasoundRegions" },
-  { 0x00186012, VR::US, "RegionSpatialFormat" },
-  { 0x00186014, VR::US, "RegionDataType" },
-  { 0x00186016, VR::UL, "RegionFlags" },
-  { 0x00186018, VR::UL, "RegionLocationMinX0" },
-  { 0x0018601A, VR::UL, "RegionLocationMinY0" },
-  { 0x0018601C, VR::UL, "RegionLocationMaxX1" },
-  { 0x0018601E, VR::UL, "RegionLocationMaxY1" },
-  { 0x00186020, VR::SL, "ReferencePixelX0" },
-  { 0x00186022, VR::SL, "ReferencePixelY0" },
-  { 0x00186024, VR::US, "PhysicalUnitsXDirection" },
-  { 0x00186026, VR::US, "PhysicalUnitsYDirection" },
-  { 0x00186028, VR::FD, "ReferencePixelPhysicalValueX" },
-  { 0x0018602A, VR::FD, "ReferencePixelPhysicalValueY" },
-  { 0x0018602C, VR::FD, "PhysicalDeltaX" },
-  { 0x0018602E, VR::FD, "PhysicalDeltaY" },
-  { 0x00186030, VR::UL, "TransducerFrequency" },
-  { 0x00186031, VR::CS, "TransducerType" },
-  { 0x00186032, VR::UL, "PulseRepetitionFrequency" },
-  { 0x00186034, VR::FD, "DopplerCorrectionAngle" },
-  { 0x00186036, VR::FD, "SteeringAngle" },
-  { 0x00186039, VR::SL, "DopplerSampleVolumeXPosition" },
-  { 0x0018603B, VR::SL, "DopplerSampleVolumeYPosition" },
-  { 0x0018603D, VR::SL, "TMLinePositionX0" },
-  { 0x0018603F, VR::SL, "TMLinePositionY0" },
-  { 0x00186041, VR::SL, "TMLinePositionX1" },
-  { 0x00186043, VR::SL, "TMLinePositionY1" },
-  { 0x00186044, VR::US, "PixelComponentOrganization" },
-  { 0x00186046, VR::UL, "PixelComponentMask" },
-  { 0x00186048, VR::UL, "PixelComponentRangeStart" },
-  { 0x0018604A, VR::UL, "PixelComponentRangeStop" },
-  { 0x0018604C, VR::US, "PixelComponentPhysicalUnits" },
-  { 0x0018604E, VR::US, "PixelComponentDataType" },
-  { 0x00186050, VR::UL, "NumberOfTableBreakPoints" },
-  { 0x00186052, VR::UL, "TableOfXBreakPoints" },
-  { 0x00186054, VR::FD, "TableOfYBreakPoints" },
-  { 0x00186056, VR::UL, "NumberOfTableEntries" },
-  { 0x00186058, VR::UL, "TableOfPixelValues" },
-  { 0x0018605A, VR::FL, "TableOfParameterValues" },
-  { 0x00186060, VR::FL, "RWaveTimeVector" },
-  { 0x00187000, VR::CS, "DetectorConditionsNominalFlag" },
-  { 0x00187001, VR::DS, "DetectorTemperature" },
-  { 0x00187004, VR::CS, "DetectorType" },
-  { 0x00187005, VR::CS, "DetectorConfiguration" },
-  { 0x00187006, VR::LT, "DetectorDescription" },
-  { 0x00187008, VR::LT, "DetectorMode" },
-  { 0x0018700A, VR::SH, "DetectorID" },
-  { 0x0018700C, VR::DA, "DateOfLastDetectorCalibration" },
-  { 0x0018700E, VR::TM, "TimeOfLastDetectorCalibration" },
-  { 0x00187010, VR::IS, "ExposuresOnDetectorSinceLastCalibration" },
-  { 0x00187011, VR::IS, "ExposuresOnDetectorSinceManufactured" },
-  { 0x00187012, VR::DS, "DetectorTimeSinceLastExposure" },
-  { 0x00187014, VR::DS, "DetectorActiveTime" },
-  { 0x00187016, VR::DS, "DetectorActivationOffsetFromExposure" },
-  { 0x0018701A, VR::DS, "DetectorBinning" },
-  { 0x00187020, VR::DS, "DetectorElementPhysicalSize" },
-  { 0x00187022, VR::DS, "DetectorElementSpacing" },
-  { 0x00187024, VR::CS, "DetectorActiveShape" },
-  { 0x00187026, VR::DS, "DetectorActiveDimensions" },
-  { 0x00187028, VR::DS, "DetectorActiveOrigin" },
-  { 0x0018702A, VR::LO, "DetectorManufacturerName" },
-  { 0x0018702B, VR::LO, "DetectorManufacturerModelName" },
-  { 0x00187030, VR::DS, "FieldOfViewOrigin" },
-  { 0x00187032, VR::DS, "FieldOfViewRotation" },
-  { 0x00187034, VR::CS, "FieldOfViewHorizontalFlip" },
-  { 0x00187036, VR::FL, "PixelDataAreaOriginRelativeToFOV" },
-  { 0x00187038, VR::FL, "PixelDataAreaRotationAngleRelativeToFOV" },
-  { 0x00187040, VR::LT, "GridAbsorbingMaterial" },
-  { 0x00187041, VR::LT, "GridSpacingMaterial" },
-  { 0x00187042, VR::DS, "GridThickness" },
-  { 0x00187044, VR::DS, "GridPitch" },
-  { 0x00187046, VR::IS, "GridAspectRatio" },
-  { 0x00187048, VR::DS, "GridPeriod" },
-  { 0x0018704C, VR::DS, "GridFocalDistance" },
-  { 0x00187050, VR::CS, "FilterMaterial" },
-  { 0x00187052, VR::DS, "FilterThicknessMinimum" },
-  { 0x00187054, VR::DS, "FilterThicknessMaximum" },
-  { 0x00187056, VR::FL, "FilterBeamPathLengthMinimum" },
-  { 0x00187058, VR::FL, "FilterBeamPathLengthMaximum" },
-  { 0x00187060, VR::CS, "ExposureControlMode" },
-  { 0x00187062, VR::LT, "ExposureControlModeDescription" },
-  { 0x00187064, VR::CS, "ExposureStatus" },
-  { 0x00187065, VR::DS, "PhototimerSetting" },
-  { 0x00188150, VR::DS, "ExposureTimeInuS" },
-  { 0x00188151, VR::DS, "XRayTubeCurrentInuA" },
-  { 0x00189004, VR::CS, "ContentQualification" },
-  { 0x00189005, VR::SH, "PulseSequenceName" },
-  { 0x00189006, VR::SQ, "MRImagingModifierSequence" },
-  { 0x00189008, VR::CS, "EchoPulseSequence" },
-  { 0x00189009, VR::CS, "InversionRecovery" },
-  { 0x00189010, VR::CS, "FlowCompensation" },
-  { 0x00189011, VR::CS, "MultipleSpinEcho" },
-  { 0x00189012, VR::CS, "MultiPlanarExcitation" },
-  { 0x00189014, VR::CS, "PhaseContrast" },
-  { 0x00189015, VR::CS, "TimeOfFlightContrast" },
-  { 0x00189016, VR::CS, "Spoiling" },
-  { 0x00189017, VR::CS, "SteadyStatePulseSequence" },
-  { 0x00189018, VR::CS, "EchoPlanarPulseSequence" },
-  { 0x00189019, VR::FD, "TagAngleFirstAxis" },
-  { 0x00189020, VR::CS, "MagnetizationTransfer" },
-  { 0x00189021, VR::CS, "T2Preparation" },
-  { 0x00189022, VR::CS, "BloodSignalNulling" },
-  { 0x00189024, VR::CS, "SaturationRecovery" },
-  { 0x00189025, VR::CS, "SpectrallySelectedSuppression" },
-  { 0x00189026, VR::CS, "SpectrallySelectedExcitation" },
-  { 0x00189027, VR::CS, "SpatialPresaturation" },
-  { 0x00189028, VR::CS, "Tagging" },
-  { 0x00189029, VR::CS, "OversamplingPhase" },
-  { 0x00189030, VR::FD, "TagSpacingFirstDimension" },
-  { 0x00189032, VR::CS, "GeometryOfKSpaceTraversal" },
-  { 0x00189033, VR::CS, "SegmentedKSpaceTraversal" },
-  { 0x00189034, VR::CS, "RectilinearPhaseEncodeReordering" },
-  { 0x00189035, VR::FD, "TagThickness" },
-  { 0x00189036, VR::CS, "PartialFourierDirection" },
-  { 0x00189037, VR::CS, "CardiacSynchronizationTechnique" },
-  { 0x00189041, VR::LO, "ReceiveCoilManufacturerName" },
-  { 0x00189042, VR::SQ, "MRReceiveCoilSequence" },
-  { 0x00189043, VR::CS, "ReceiveCoilType" },
-  { 0x00189044, VR::CS, "QuadratureReceiveCoil" },
-  { 0x00189045, VR::SQ, "MultiCoilDefinitionSequence" },
-  { 0x00189046, VR::LO, "MultiCoilConfiguration" },
-  { 0x00189047, VR::SH, "MultiCoilElementName" },
-  { 0x00189048, VR::CS, "MultiCoilElementUsed" },
-  { 0x00189049, VR::SQ, "MRTransmitCoilSequence" },
-  { 0x00189050, VR::LO, "TransmitCoilManufacturerName" },
-  { 0x00189051, VR::CS, "TransmitCoilType" },
-  { 0x00189052, VR::FD, "SpectralWidth" },
-  { 0x00189053, VR::FD, "ChemicalShiftReference" },
-  { 0x00189054, VR::CS, "VolumeLocalizationTechnique" },
-  { 0x00189058, VR::US, "MRAcquisitionFrequencyEncodingSteps" },
-  { 0x00189059, VR::CS, "Decoupling" },
-  { 0x00189060, VR::CS, "DecoupledNucleus" },
-  { 0x00189061, VR::FD, "DecouplingFrequency" },
-  { 0x00189062, VR::CS, "DecouplingMethod" },
-  { 0x00189063, VR::FD, "DecouplingChemicalShiftReference" },
-  { 0x00189064, VR::CS, "KSpaceFiltering" },
-  { 0x00189065, VR::CS, "TimeDomainFiltering" },
-  { 0x00189066, VR::US, "NumberOfZeroFills" },
-  { 0x00189067, VR::CS, "BaselineCorrection" },
-  { 0x00189069, VR::FD, "ParallelReductionFactorInPlane" },
-  { 0x00189070, VR::FD, "CardiacRRIntervalSpecified" },
-  { 0x00189073, VR::FD, "AcquisitionDuration" },
-  { 0x00189074, VR::DT, "FrameAcquisitionDateTime" },
-  { 0x00189075, VR::CS, "DiffusionDirectionality" },
-  { 0x00189076, VR::SQ, "DiffusionGradientDirectionSequence" },
-  { 0x00189077, VR::CS, "ParallelAcquisition" },
-  { 0x00189078, VR::CS, "ParallelAcquisitionTechnique" },
-  { 0x00189079, VR::FD, "InversionTimes" },
-  { 0x00189080, VR::ST, "MetaboliteMapDescription" },
-  { 0x00189081, VR::CS, "PartialFourier" },
-  { 0x00189082, VR::FD, "EffectiveEchoTime" },
-  { 0x00189083, VR::SQ, "MetaboliteMapCodeSequence" },
-  { 0x00189084, VR::SQ, "ChemicalShiftSequence" },
-  { 0x00189085, VR::CS, "CardiacSignalSource" },
-  { 0x00189087, VR::FD, "DiffusionBValue" },
-  { 0x00189089, VR::FD, "DiffusionGradientOrientation" },
-  { 0x00189090, VR::FD, "VelocityEncodingDirection" },
-  { 0x00189091, VR::FD, "VelocityEncodingMinimumValue" },
-  { 0x00189092, VR::SQ, "VelocityEncodingAcquisitionSequence" },
-  { 0x00189093, VR::US, "NumberOfKSpaceTrajectories" },
-  { 0x00189094, VR::CS, "CoverageOfKSpace" },
-  { 0x00189095, VR::UL, "SpectroscopyAcquisitionPhaseRows" },
-  { 0x00189098, VR::FD, "TransmitterFrequency" },
-  { 0x00189100, VR::CS, "ResonantNucleus" },
-  { 0x00189101, VR::CS, "FrequencyCorrection" },
-  { 0x00189103, VR::SQ, "MRSpectroscopyFOVGeometrySequence" },
-  { 0x00189104, VR::FD, "SlabThickness" },
-  { 0x00189105, VR::FD, "SlabOrientation" },
-  { 0x00189106, VR::FD, "MidSlabPosition" },
-  { 0x00189107, VR::SQ, "MRSpatialSaturationSequence" },
-  { 0x00189112, VR::SQ, "MRTimingAndRelatedParametersSequence" },
-  { 0x00189114, VR::SQ, "MREchoSequence" },
-  { 0x00189115, VR::SQ, "MRModifierSequence" },
-  { 0x00189117, VR::SQ, "MRDiffusionSequence" },
-  { 0x00189118, VR::SQ, "CardiacSynchronizationSequence" },
-  { 0x00189119, VR::SQ, "MRAveragesSequence" },
-  { 0x00189125, VR::SQ, "MRFOVGeometrySequence" },
-  { 0x00189126, VR::SQ, "VolumeLocalizationSequence" },
-  { 0x00189127, VR::UL, "SpectroscopyAcquisitionDataColumns" },
-  { 0x00189147, VR::CS, "DiffusionAnisotropyType" },
-  { 0x00189151, VR::DT, "FrameReferenceDateTime" },
-  { 0x00189152, VR::SQ, "MRMetaboliteMapSequence" },
-  { 0x00189155, VR::FD, "ParallelReductionFactorOutOfPlane" },
-  { 0x00189159, VR::UL, "SpectroscopyAcquisitionOutOfPlanePhaseSteps" },
-  { 0x00189168, VR::FD, "ParallelReductionFactorSecondInPlane" },
-  { 0x00189169, VR::CS, "CardiacBeatRejectionTechnique" },
-  { 0x00189170, VR::CS, "RespiratoryMotionCompensationTechnique" },
-  { 0x00189171, VR::CS, "RespiratorySignalSource" },
-  { 0x00189172, VR::CS, "BulkMotionCompensationTechnique" },
-  { 0x00189173, VR::CS, "BulkMotionSignalSource" },
-  { 0x00189174, VR::CS, "ApplicableSafetyStandardAgency" },
-  { 0x00189175, VR::LO, "ApplicableSafetyStandardDescription" },
-  { 0x00189176, VR::SQ, "OperatingModeSequence" },
-  { 0x00189177, VR::CS, "OperatingModeType" },
-  { 0x00189178, VR::CS, "OperatingMode" },
-  { 0x00189179, VR::CS, "SpecificAbsorptionRateDefinition" },
-  { 0x00189180, VR::CS, "GradientOutputType" },
-  { 0x00189181, VR::FD, "SpecificAbsorptionRateValue" },
-  { 0x00189182, VR::FD, "GradientOutput" },
-  { 0x00189183, VR::CS, "FlowCompensationDirection" },
-  { 0x00189184, VR::FD, "TaggingDelay" },
-  { 0x00189185, VR::ST, "RespiratoryMotionCompensationTechniqueDescription" },
-  { 0x00189186, VR::SH, "RespiratorySignalSourceID" },
-  { 0x00189197, VR::SQ, "MRVelocityEncodingSequence" },
-  { 0x00189198, VR::CS, "FirstOrderPhaseCorrection" },
-  { 0x00189199, VR::CS, "WaterReferencedPhaseCorrection" },
-  { 0x00189200, VR::CS, "MRSpectroscopyAcquisitionType" },
-  { 0x00189214, VR::CS, "RespiratoryCyclePosition" },
-  { 0x00189217, VR::FD, "VelocityEncodingMaximumValue" },
-  { 0x00189218, VR::FD, "TagSpacingSecondDimension" },
-  { 0x00189219, VR::SS, "TagAngleSecondAxis" },
-  { 0x00189220, VR::FD, "FrameAcquisitionDuration" },
-  { 0x00189226, VR::SQ, "MRImageFrameTypeSequence" },
-  { 0x00189227, VR::SQ, "MRSpectroscopyFrameTypeSequence" },
-  { 0x00189231, VR::US, "MRAcquisitionPhaseEncodingStepsInPlane" },
-  { 0x00189232, VR::US, "MRAcquisitionPhaseEncodingStepsOutOfPlane" },
-  { 0x00189234, VR::UL, "SpectroscopyAcquisitionPhaseColumns" },
-  { 0x00189236, VR::CS, "CardiacCyclePosition" },
-  { 0x00189239, VR::SQ, "SpecificAbsorptionRateSequence" },
-  { 0x00189240, VR::US, "RFEchoTrainLength" },
-  { 0x00189241, VR::US, "GradientEchoTrainLength" },
-  { 0x00189250, VR::CS, "ArterialSpinLabelingContrast" },
-  { 0x00189251, VR::SQ, "MRArterialSpinLabelingSequence" },
-  { 0x00189252, VR::LO, "ASLTechniqueDescription" },
-  { 0x00189253, VR::US, "ASLSlabNumber" },
-  { 0x00189254, VR::FD, "ASLSlabThickness" },
-  { 0x00189255, VR::FD, "ASLSlabOrientation" },
-  { 0x00189256, VR::FD, "ASLMidSlabPosition" },
-  { 0x00189257, VR::CS, "ASLContext" },
-  { 0x00189258, VR::UL, "ASLPulseTrainDuration" },
-  { 0x00189259, VR::CS, "ASLCrusherFlag" },
-  { 0x0018925A, VR::FD, "ASLCrusherFlowLimit" },
-  { 0x0018925B, VR::LO, "ASLCrusherDescription" },
-  { 0x0018925C, VR::CS, "ASLBolusCutoffFlag" },
-  { 0x0018925D, VR::SQ, "ASLBolusCutoffTimingSequence" },
-  { 0x0018925E, VR::LO, "ASLBolusCutoffTechnique" },
-  { 0x0018925F, VR::UL, "ASLBolusCutoffDelayTime" },
-  { 0x00189260, VR::SQ, "ASLSlabSequence" },
-  { 0x00189295, VR::FD, "ChemicalShiftMinimumIntegrationLimitInppm" },
-  { 0x00189296, VR::FD, "ChemicalShiftMaximumIntegrationLimitInppm" },
-  { 0x00189297, VR::CS, "WaterReferenceAcquisition" },
-  { 0x00189298, VR::IS, "EchoPeakPosition" },
-  { 0x00189301, VR::SQ, "CTAcquisitionTypeSequence" },
-  { 0x00189302, VR::CS, "AcquisitionType" },
-  { 0x00189303, VR::FD, "TubeAngle" },
-  { 0x00189304, VR::SQ, "CTAcquisitionDetailsSequence" },
-  { 0x00189305, VR::FD, "RevolutionTime" },
-  { 0x00189306, VR::FD, "SingleCollimationWidth" },
-  { 0x00189307, VR::FD, "TotalCollimationWidth" },
-  { 0x00189308, VR::SQ, "CTTableDynamicsSequence" },
-  { 0x00189309, VR::FD, "TableSpeed" },
-  { 0x00189310, VR::FD, "TableFeedPerRotation" },
-  { 0x00189311, VR::FD, "SpiralPitchFactor" },
-  { 0x00189312, VR::SQ, "CTGeometrySequence" },
-  { 0x00189313, VR::FD, "DataCollectionCenterPatient" },
-  { 0x00189314, VR::SQ, "CTReconstructionSequence" },
-  { 0x00189315, VR::CS, "ReconstructionAlgorithm" },
-  { 0x00189316, VR::CS, "ConvolutionKernelGroup" },
-  { 0x00189317, VR::FD, "ReconstructionFieldOfView" },
-  { 0x00189318, VR::FD, "ReconstructionTargetCenterPatient" },
-  { 0x00189319, VR::FD, "ReconstructionAngle" },
-  { 0x00189320, VR::SH, "ImageFilter" },
-  { 0x00189321, VR::SQ, "CTExposureSequence" },
-  { 0x00189322, VR::FD, "ReconstructionPixelSpacing" },
-  { 0x00189323, VR::CS, "ExposureModulationType" },
-  { 0x00189324, VR::FD, "EstimatedDoseSaving" },
-  { 0x00189325, VR::SQ, "CTXRayDetailsSequence" },
-  { 0x00189326, VR::SQ, "CTPositionSequence" },
-  { 0x00189327, VR::FD, "TablePosition" },
-  { 0x00189328, VR::FD, "ExposureTimeInms" },
-  { 0x00189329, VR::SQ, "CTImageFrameTypeSequence" },
-  { 0x00189330, VR::FD, "XRayTubeCurrentInmA" },
-  { 0x00189332, VR::FD, "ExposureInmAs" },
-  { 0x00189333, VR::CS, "ConstantVolumeFlag" },
-  { 0x00189334, VR::CS, "FluoroscopyFlag" },
-  { 0x00189335, VR::FD, "DistanceSourceToDataCollectionCenter" },
-  { 0x00189337, VR::US, "ContrastBolusAgentNumber" },
-  { 0x00189338, VR::SQ, "ContrastBolusIngredientCodeSequence" },
-  { 0x00189340, VR::SQ, "ContrastAdministrationProfileSequence" },
-  { 0x00189341, VR::SQ, "ContrastBolusUsageSequence" },
-  { 0x00189342, VR::CS, "ContrastBolusAgentAdministered" },
-  { 0x00189343, VR::CS, "ContrastBolusAgentDetected" },
-  { 0x00189344, VR::CS, "ContrastBolusAgentPhase" },
-  { 0x00189345, VR::FD, "CTDIvol" },
-  { 0x00189346, VR::SQ, "CTDIPhantomTypeCodeSequence" },
-  { 0x00189351, VR::FL, "CalciumScoringMassFactorPatient" },
-  { 0x00189352, VR::FL, "CalciumScoringMassFactorDevice" },
-  { 0x00189353, VR::FL, "EnergyWeightingFactor" },
-  { 0x00189360, VR::SQ, "CTAdditionalXRaySourceSequence" },
-  { 0x00189401, VR::SQ, "ProjectionPixelCalibrationSequence" },
-  { 0x00189402, VR::FL, "DistanceSourceToIsocenter" },
-  { 0x00189403, VR::FL, "DistanceObjectToTableTop" },
-  { 0x00189404, VR::FL, "ObjectPixelSpacingInCenterOfBeam" },
-  { 0x00189405, VR::SQ, "PositionerPositionSequence" },
-  { 0x00189406, VR::SQ, "TablePositionSequence" },
-  { 0x00189407, VR::SQ, "CollimatorShapeSequence" },
-  { 0x00189410, VR::CS, "PlanesInAcquisition" },
-  { 0x00189412, VR::SQ, "XAXRFFrameCharacteristicsSequence" },
-  { 0x00189417, VR::SQ, "FrameAcquisitionSequence" },
-  { 0x00189420, VR::CS, "XRayReceptorType" },
-  { 0x00189423, VR::LO, "AcquisitionProtocolName" },
-  { 0x00189424, VR::LT, "AcquisitionProtocolDescription" },
-  { 0x00189425, VR::CS, "ContrastBolusIngredientOpaque" },
-  { 0x00189426, VR::FL, "DistanceReceptorPlaneToDetectorHousing" },
-  { 0x00189427, VR::CS, "IntensifierActiveShape" },
-  { 0x00189428, VR::FL, "IntensifierActiveDimensions" },
-  { 0x00189429, VR::FL, "PhysicalDetectorSize" },
-  { 0x00189430, VR::FL, "PositionOfIsocenterProjection" },
-  { 0x00189432, VR::SQ, "FieldOfViewSequence" },
-  { 0x00189433, VR::LO, "FieldOfViewDescription" },
-  { 0x00189434, VR::SQ, "ExposureControlSensingRegionsSequence" },
-  { 0x00189435, VR::CS, "ExposureControlSensingRegionShape" },
-  { 0x00189436, VR::SS, "ExposureControlSensingRegionLeftVerticalEdge" },
-  { 0x00189437, VR::SS, "ExposureControlSensingRegionRightVerticalEdge" },
-  { 0x00189438, VR::SS, "ExposureControlSensingRegionUpperHorizontalEdge" },
-  { 0x00189439, VR::SS, "ExposureControlSensingRegionLowerHorizontalEdge" },
-  { 0x00189440, VR::SS, "CenterOfCircularExposureControlSensingRegion" },
-  { 0x00189441, VR::US, "RadiusOfCircularExposureControlSensingRegion" },
-  { 0x00189442, VR::SS, "VerticesOfThePolygonalExposureControlSensingRegion" },
-  { 0x00189447, VR::FL, "ColumnAngulationPatient" },
-  { 0x00189449, VR::FL, "BeamAngle" },
-  { 0x00189451, VR::SQ, "FrameDetectorParametersSequence" },
-  { 0x00189452, VR::FL, "CalculatedAnatomyThickness" },
-  { 0x00189455, VR::SQ, "CalibrationSequence" },
-  { 0x00189456, VR::SQ, "ObjectThicknessSequence" },
-  { 0x00189457, VR::CS, "PlaneIdentification" },
-  { 0x00189461, VR::FL, "FieldOfViewDimensionsInFloat" },
-  { 0x00189462, VR::SQ, "IsocenterReferenceSystemSequence" },
-  { 0x00189463, VR::FL, "PositionerIsocenterPrimaryAngle" },
-  { 0x00189464, VR::FL, "PositionerIsocenterSecondaryAngle" },
-  { 0x00189465, VR::FL, "PositionerIsocenterDetectorRotationAngle" },
-  { 0x00189466, VR::FL, "TableXPositionToIsocenter" },
-  { 0x00189467, VR::FL, "TableYPositionToIsocenter" },
-  { 0x00189468, VR::FL, "TableZPositionToIsocenter" },
-  { 0x00189469, VR::FL, "TableHorizontalRotationAngle" },
-  { 0x00189470, VR::FL, "TableHeadTiltAngle" },
-  { 0x00189471, VR::FL, "TableCradleTiltAngle" },
-  { 0x00189472, VR::SQ, "FrameDisplayShutterSequence" },
-  { 0x00189473, VR::FL, "AcquiredImageAreaDoseProduct" },
-  { 0x00189474, VR::CS, "CArmPositionerTabletopRelationship" },
-  { 0x00189476, VR::SQ, "XRayGeometrySequence" },
-  { 0x00189477, VR::SQ, "IrradiationEventIdentificationSequence" },
-  { 0x00189504, VR::SQ, "XRay3DFrameTypeSequence" },
-  { 0x00189506, VR::SQ, "ContributingSourcesSequence" },
-  { 0x00189507, VR::SQ, "XRay3DAcquisitionSequence" },
-  { 0x00189508, VR::FL, "PrimaryPositionerScanArc" },
-  { 0x00189509, VR::FL, "SecondaryPositionerScanArc" },
-  { 0x00189510, VR::FL, "PrimaryPositionerScanStartAngle" },
-  { 0x00189511, VR::FL, "SecondaryPositionerScanStartAngle" },
-  { 0x00189514, VR::FL, "PrimaryPositionerIncrement" },
-  { 0x00189515, VR::FL, "SecondaryPositionerIncrement" },
-  { 0x00189516, VR::DT, "StartAcquisitionDateTime" },
-  { 0x00189517, VR::DT, "EndAcquisitionDateTime" },
-  { 0x00189518, VR::SS, "PrimaryPositionerIncrementSign" },
-  { 0x00189519, VR::SS, "SecondaryPositionerIncrementSign" },
-  { 0x00189524, VR::LO, "ApplicationName" },
-  { 0x00189525, VR::LO, "ApplicationVersion" },
-  { 0x00189526, VR::LO, "ApplicationManufacturer" },
-  { 0x00189527, VR::CS, "AlgorithmType" },
-  { 0x00189528, VR::LO, "AlgorithmDescription" },
-  { 0x00189530, VR::SQ, "XRay3DReconstructionSequence" },
-  { 0x00189531, VR::LO, "ReconstructionDescription" },
-  { 0x00189538, VR::SQ, "PerProjectionAcquisitionSequence" },
-  { 0x00189541, VR::SQ, "DetectorPositionSequence" },
-  { 0x00189542, VR::SQ, "XRayAcquisitionDoseSequence" },
-  { 0x00189543, VR::FD, "XRaySourceIsocenterPrimaryAngle" },
-  { 0x00189544, VR::FD, "XRaySourceIsocenterSecondaryAngle" },
-  { 0x00189545, VR::FD, "BreastSupportIsocenterPrimaryAngle" },
-  { 0x00189546, VR::FD, "BreastSupportIsocenterSecondaryAngle" },
-  { 0x00189547, VR::FD, "BreastSupportXPositionToIsocenter" },
-  { 0x00189548, VR::FD, "BreastSupportYPositionToIsocenter" },
-  { 0x00189549, VR::FD, "BreastSupportZPositionToIsocenter" },
-  { 0x00189550, VR::FD, "DetectorIsocenterPrimaryAngle" },
-  { 0x00189551, VR::FD, "DetectorIsocenterSecondaryAngle" },
-  { 0x00189552, VR::FD, "DetectorXPositionToIsocenter" },
-  { 0x00189553, VR::FD, "DetectorYPositionToIsocenter" },
-  { 0x00189554, VR::FD, "DetectorZPositionToIsocenter" },
-  { 0x00189555, VR::SQ, "XRayGridSequence" },
-  { 0x00189556, VR::SQ, "XRayFilterSequence" },
-  { 0x00189557, VR::FD, "DetectorActiveAreaTLHCPosition" },
-  { 0x00189558, VR::FD, "DetectorActiveAreaOrientation" },
-  { 0x00189559, VR::CS, "PositionerPrimaryAngleDirection" },
-  { 0x00189601, VR::SQ, "DiffusionBMatrixSequence" },
-  { 0x00189602, VR::FD, "DiffusionBValueXX" },
-  { 0x00189603, VR::FD, "DiffusionBValueXY" },
-  { 0x00189604, VR::FD, "DiffusionBValueXZ" },
-  { 0x00189605, VR::FD, "DiffusionBValueYY" },
-  { 0x00189606, VR::FD, "DiffusionBValueYZ" },
-  { 0x00189607, VR::FD, "DiffusionBValueZZ" },
-  { 0x00189621, VR::SQ, "FunctionalMRSequence" },
-  { 0x00189622, VR::CS, "FunctionalSettlingPhaseFramesPresent" },
-  { 0x00189623, VR::DT, "FunctionalSyncPulse" },
-  { 0x00189624, VR::CS, "SettlingPhaseFrame" },
-  { 0x00189701, VR::DT, "DecayCorrectionDateTime" },
-  { 0x00189715, VR::FD, "StartDensityThreshold" },
-  { 0x00189716, VR::FD, "StartRelativeDensityDifferenceThreshold" },
-  { 0x00189717, VR::FD, "StartCardiacTriggerCountThreshold" },
-  { 0x00189718, VR::FD, "StartRespiratoryTriggerCountThreshold" },
-  { 0x00189719, VR::FD, "TerminationCountsThreshold" },
-  { 0x00189720, VR::FD, "TerminationDensityThreshold" },
-  { 0x00189721, VR::FD, "TerminationRelativeDensityThreshold" },
-  { 0x00189722, VR::FD, "TerminationTimeThreshold" },
-  { 0x00189723, VR::FD, "TerminationCardiacTriggerCountThreshold" },
-  { 0x00189724, VR::FD, "TerminationRespiratoryTriggerCountThreshold" },
-  { 0x00189725, VR::CS, "DetectorGeometry" },
-  { 0x00189726, VR::FD, "TransverseDetectorSeparation" },
-  { 0x00189727, VR::FD, "AxialDetectorDimension" },
-  { 0x00189729, VR::US, "RadiopharmaceuticalAgentNumber" },
-  { 0x00189732, VR::SQ, "PETFrameAcquisitionSequence" },
-  { 0x00189733, VR::SQ, "PETDetectorMotionDetailsSequence" },
-  { 0x00189734, VR::SQ, "PETTableDynamicsSequence" },
-  { 0x00189735, VR::SQ, "PETPositionSequence" },
-  { 0x00189736, VR::SQ, "PETFrameCorrectionFactorsSequence" },
-  { 0x00189737, VR::SQ, "RadiopharmaceuticalUsageSequence" },
-  { 0x00189738, VR::CS, "AttenuationCorrectionSource" },
-  { 0x00189739, VR::US, "NumberOfIterations" },
-  { 0x00189740, VR::US, "NumberOfSubsets" },
-  { 0x00189749, VR::SQ, "PETReconstructionSequence" },
-  { 0x00189751, VR::SQ, "PETFrameTypeSequence" },
-  { 0x00189755, VR::CS, "TimeOfFlightInformationUsed" },
-  { 0x00189756, VR::CS, "ReconstructionType" },
-  { 0x00189758, VR::CS, "DecayCorrected" },
-  { 0x00189759, VR::CS, "AttenuationCorrected" },
-  { 0x00189760, VR::CS, "ScatterCorrected" },
-  { 0x00189761, VR::CS, "DeadTimeCorrected" },
-  { 0x00189762, VR::CS, "GantryMotionCorrected" },
-  { 0x00189763, VR::CS, "PatientMotionCorrected" },
-  { 0x00189764, VR::CS, "CountLossNormalizationCorrected" },
-  { 0x00189765, VR::CS, "RandomsCorrected" },
-  { 0x00189766, VR::CS, "NonUniformRadialSamplingCorrected" },
-  { 0x00189767, VR::CS, "SensitivityCalibrated" },
-  { 0x00189768, VR::CS, "DetectorNormalizationCorrection" },
-  { 0x00189769, VR::CS, "IterativeReconstructionMethod" },
-  { 0x00189770, VR::CS, "AttenuationCorrectionTemporalRelationship" },
-  { 0x00189771, VR::SQ, "PatientPhysiologicalStateSequence" },
-  { 0x00189772, VR::SQ, "PatientPhysiologicalStateCodeSequence" },
-  { 0x00189801, VR::FD, "DepthsOfFocus" },
-  { 0x00189803, VR::SQ, "ExcludedIntervalsSequence" },
-  { 0x00189804, VR::DT, "ExclusionStartDateTime" },
-  { 0x00189805, VR::FD, "ExclusionDuration" },
-  { 0x00189806, VR::SQ, "USImageDescriptionSequence" },
-  { 0x00189807, VR::SQ, "ImageDataTypeSequence" },
-  { 0x00189808, VR::CS, "DataType" },
-  { 0x00189809, VR::SQ, "TransducerScanPatternCodeSequence" },
-  { 0x0018980B, VR::CS, "AliasedDataType" },
-  { 0x0018980C, VR::CS, "PositionMeasuringDeviceUsed" },
-  { 0x0018980D, VR::SQ, "TransducerGeometryCodeSequence" },
-  { 0x0018980E, VR::SQ, "TransducerBeamSteeringCodeSequence" },
-  { 0x0018980F, VR::SQ, "TransducerApplicationCodeSequence" },
-  { 0x00189810, VR::US, "ZeroVelocityPixelValue" },
-  { 0x0018A001, VR::SQ, "ContributingEquipmentSequence" },
-  { 0x0018A002, VR::DT, "ContributionDateTime" },
-  { 0x0018A003, VR::ST, "ContributionDescription" },
-  { 0x0020000D, VR::UI, "StudyInstanceUID" },
-  { 0x0020000E, VR::UI, "SeriesInstanceUID" },
-  { 0x00200010, VR::SH, "StudyID" },
-  { 0x00200011, VR::IS, "SeriesNumber" },
-  { 0x00200012, VR::IS, "AcquisitionNumber" },
-  { 0x00200013, VR::IS, "InstanceNumber" },
-  { 0x00200019, VR::IS, "ItemNumber" },
-  { 0x00200020, VR::CS, "PatientOrientation" },
-  { 0x00200032, VR::DS, "ImagePositionPatient" },
-  { 0x00200037, VR::DS, "ImageOrientationPatient" },
-  { 0x00200052, VR::UI, "FrameOfReferenceUID" },
-  { 0x00200060, VR::CS, "Laterality" },
-  { 0x00200062, VR::CS, "ImageLaterality" },
-  { 0x00200100, VR::IS, "TemporalPositionIdentifier" },
-  { 0x00200105, VR::IS, "NumberOfTemporalPositions" },
-  { 0x00200110, VR::DS, "TemporalResolution" },
-  { 0x00200200, VR::UI, "SynchronizationFrameOfReferenceUID" },
-  { 0x00200242, VR::UI, "SOPInstanceUIDOfConcatenationSource" },
-  { 0x00201002, VR::IS, "ImagesInAcquisition" },
-  { 0x00201040, VR::LO, "PositionReferenceIndicator" },
-  { 0x00201041, VR::DS, "SliceLocation" },
-  { 0x00201200, VR::IS, "NumberOfPatientRelatedStudies" },
-  { 0x00201202, VR::IS, "NumberOfPatientRelatedSeries" },
-  { 0x00201204, VR::IS, "NumberOfPatientRelatedInstances" },
-  { 0x00201206, VR::IS, "NumberOfStudyRelatedSeries" },
-  { 0x00201208, VR::IS, "NumberOfStudyRelatedInstances" },
-  { 0x00201209, VR::IS, "NumberOfSeriesRelatedInstances" },
-  { 0x00204000, VR::LT, "ImageComments" },
-  { 0x00209056, VR::SH, "StackID" },
-  { 0x00209057, VR::UL, "InStackPositionNumber" },
-  { 0x00209071, VR::SQ, "FrameAnatomySequence" },
-  { 0x00209072, VR::CS, "FrameLaterality" },
-  { 0x00209111, VR::SQ, "FrameContentSequence" },
-  { 0x00209113, VR::SQ, "PlanePositionSequence" },
-  { 0x00209116, VR::SQ, "PlaneOrientationSequence" },
-  { 0x00209128, VR::UL, "TemporalPositionIndex" },
-  { 0x00209153, VR::FD, "NominalCardiacTriggerDelayTime" },
-  { 0x00209154, VR::FL, "NominalCardiacTriggerTimePriorToRPeak" },
-  { 0x00209155, VR::FL, "ActualCardiacTriggerTimePriorToRPeak" },
-  { 0x00209156, VR::US, "FrameAcquisitionNumber" },
-  { 0x00209157, VR::UL, "DimensionIndexValues" },
-  { 0x00209158, VR::LT, "FrameComments" },
-  { 0x00209161, VR::UI, "ConcatenationUID" },
-  { 0x00209162, VR::US, "InConcatenationNumber" },
-  { 0x00209163, VR::US, "InConcatenationTotalNumber" },
-  { 0x00209164, VR::UI, "DimensionOrganizationUID" },
-  { 0x00209165, VR::AT, "DimensionIndexPointer" },
-  { 0x00209167, VR::AT, "FunctionalGroupPointer" },
-  { 0x00209170, VR::SQ, "UnassignedSharedConvertedAttributesSequence" },
-  { 0x00209171, VR::SQ, "UnassignedPerFrameConvertedAttributesSequence" },
-  { 0x00209172, VR::SQ, "ConversionSourceAttributesSequence" },
-  { 0x00209213, VR::LO, "DimensionIndexPrivateCreator" },
-  { 0x00209221, VR::SQ, "DimensionOrganizationSequence" },
-  { 0x00209222, VR::SQ, "DimensionIndexSequence" },
-  { 0x00209228, VR::UL, "ConcatenationFrameOffsetNumber" },
-  { 0x00209238, VR::LO, "FunctionalGroupPrivateCreator" },
-  { 0x00209241, VR::FL, "NominalPercentageOfCardiacPhase" },
-  { 0x00209245, VR::FL, "NominalPercentageOfRespiratoryPhase" },
-  { 0x00209246, VR::FL, "StartingRespiratoryAmplitude" },
-  { 0x00209247, VR::CS, "StartingRespiratoryPhase" },
-  { 0x00209248, VR::FL, "EndingRespiratoryAmplitude" },
-  { 0x00209249, VR::CS, "EndingRespiratoryPhase" },
-  { 0x00209250, VR::CS, "RespiratoryTriggerType" },
-  { 0x00209251, VR::FD, "RRIntervalTimeNominal" },
-  { 0x00209252, VR::FD, "ActualCardiacTriggerDelayTime" },
-  { 0x00209253, VR::SQ, "RespiratorySynchronizationSequence" },
-  { 0x00209254, VR::FD, "RespiratoryIntervalTime" },
-  { 0x00209255, VR::FD, "NominalRespiratoryTriggerDelayTime" },
-  { 0x00209256, VR::FD, "RespiratoryTriggerDelayThreshold" },
-  { 0x00209257, VR::FD, "ActualRespiratoryTriggerDelayTime" },
-  { 0x00209301, VR::FD, "ImagePositionVolume" },
-  { 0x00209302, VR::FD, "ImageOrientationVolume" },
-  { 0x00209307, VR::CS, "UltrasoundAcquisitionGeometry" },
-  { 0x00209308, VR::FD, "ApexPosition" },
-  { 0x00209309, VR::FD, "VolumeToTransducerMappingMatrix" },
-  { 0x0020930A, VR::FD, "VolumeToTableMappingMatrix" },
-  { 0x0020930B, VR::CS, "VolumeToTransducerRelationship" },
-  { 0x0020930C, VR::CS, "PatientFrameOfReferenceSource" },
-  { 0x0020930D, VR::FD, "TemporalPositionTimeOffset" },
-  { 0x0020930E, VR::SQ, "PlanePositionVolumeSequence" },
-  { 0x0020930F, VR::SQ, "PlaneOrientationVolumeSequence" },
-  { 0x00209310, VR::SQ, "TemporalPositionSequence" },
-  { 0x00209311, VR::CS, "DimensionOrganizationType" },
-  { 0x00209312, VR::UI, "VolumeFrameOfReferenceUID" },
-  { 0x00209313, VR::UI, "TableFrameOfReferenceUID" },
-  { 0x00209421, VR::LO, "DimensionDescriptionLabel" },
-  { 0x00209450, VR::SQ, "PatientOrientationInFrameSequence" },
-  { 0x00209453, VR::LO, "FrameLabel" },
-  { 0x00209518, VR::US, "AcquisitionIndex" },
-  { 0x00209529, VR::SQ, "ContributingSOPInstancesReferenceSequence" },
-  { 0x00209536, VR::US, "ReconstructionIndex" },
-  { 0x00220001, VR::US, "LightPathFilterPassThroughWavelength" },
-  { 0x00220002, VR::US, "LightPathFilterPassBand" },
-  { 0x00220003, VR::US, "ImagePathFilterPassThroughWavelength" },
-  { 0x00220004, VR::US, "ImagePathFilterPassBand" },
-  { 0x00220005, VR::CS, "PatientEyeMovementCommanded" },
-  { 0x00220006, VR::SQ, "PatientEyeMovementCommandCodeSequence" },
-  { 0x00220007, VR::FL, "SphericalLensPower" },
-  { 0x00220008, VR::FL, "CylinderLensPower" },
-  { 0x00220009, VR::FL, "CylinderAxis" },
-  { 0x0022000A, VR::FL, "EmmetropicMagnification" },
-  { 0x0022000B, VR::FL, "IntraOcularPressure" },
-  { 0x0022000C, VR::FL, "HorizontalFieldOfView" },
-  { 0x0022000D, VR::CS, "PupilDilated" },
-  { 0x0022000E, VR::FL, "DegreeOfDilation" },
-  { 0x00220010, VR::FL, "StereoBaselineAngle" },
-  { 0x00220011, VR::FL, "StereoBaselineDisplacement" },
-  { 0x00220012, VR::FL, "StereoHorizontalPixelOffset" },
-  { 0x00220013, VR::FL, "StereoVerticalPixelOffset" },
-  { 0x00220014, VR::FL, "StereoRotation" },
-  { 0x00220015, VR::SQ, "AcquisitionDeviceTypeCodeSequence" },
-  { 0x00220016, VR::SQ, "IlluminationTypeCodeSequence" },
-  { 0x00220017, VR::SQ, "LightPathFilterTypeStackCodeSequence" },
-  { 0x00220018, VR::SQ, "ImagePathFilterTypeStackCodeSequence" },
-  { 0x00220019, VR::SQ, "LensesCodeSequence" },
-  { 0x0022001A, VR::SQ, "ChannelDescriptionCodeSequence" },
-  { 0x0022001B, VR::SQ, "RefractiveStateSequence" },
-  { 0x0022001C, VR::SQ, "MydriaticAgentCodeSequence" },
-  { 0x0022001D, VR::SQ, "RelativeImagePositionCodeSequence" },
-  { 0x0022001E, VR::FL, "CameraAngleOfView" },
-  { 0x00220020, VR::SQ, "StereoPairsSequence" },
-  { 0x00220021, VR::SQ, "LeftImageSequence" },
-  { 0x00220022, VR::SQ, "RightImageSequence" },
-  { 0x00220028, VR::CS, "StereoPairsPresent" },
-  { 0x00220030, VR::FL, "AxialLengthOfTheEye" },
-  { 0x00220031, VR::SQ, "OphthalmicFrameLocationSequence" },
-  { 0x00220032, VR::FL, "ReferenceCoordinates" },
-  { 0x00220035, VR::FL, "DepthSpatialResolution" },
-  { 0x00220036, VR::FL, "MaximumDepthDistortion" },
-  { 0x00220037, VR::FL, "AlongScanSpatialResolution" },
-  { 0x00220038, VR::FL, "MaximumAlongScanDistortion" },
-  { 0x00220039, VR::CS, "OphthalmicImageOrientation" },
-  { 0x00220041, VR::FL, "DepthOfTransverseImage" },
-  { 0x00220042, VR::SQ, "MydriaticAgentConcentrationUnitsSequence" },
-  { 0x00220048, VR::FL, "AcrossScanSpatialResolution" },
-  { 0x00220049, VR::FL, "MaximumAcrossScanDistortion" },
-  { 0x0022004E, VR::DS, "MydriaticAgentConcentration" },
-  { 0x00220055, VR::FL, "IlluminationWaveLength" },
-  { 0x00220056, VR::FL, "IlluminationPower" },
-  { 0x00220057, VR::FL, "IlluminationBandwidth" },
-  { 0x00220058, VR::SQ, "MydriaticAgentSequence" },
-  { 0x00221007, VR::SQ, "OphthalmicAxialMeasurementsRightEyeSequence" },
-  { 0x00221008, VR::SQ, "OphthalmicAxialMeasurementsLeftEyeSequence" },
-  { 0x00221009, VR::CS, "OphthalmicAxialMeasurementsDeviceType" },
-  { 0x00221010, VR::CS, "OphthalmicAxialLengthMeasurementsType" },
-  { 0x00221012, VR::SQ, "OphthalmicAxialLengthSequence" },
-  { 0x00221019, VR::FL, "OphthalmicAxialLength" },
-  { 0x00221024, VR::SQ, "LensStatusCodeSequence" },
-  { 0x00221025, VR::SQ, "VitreousStatusCodeSequence" },
-  { 0x00221028, VR::SQ, "IOLFormulaCodeSequence" },
-  { 0x00221029, VR::LO, "IOLFormulaDetail" },
-  { 0x00221033, VR::FL, "KeratometerIndex" },
-  { 0x00221035, VR::SQ, "SourceOfOphthalmicAxialLengthCodeSequence" },
-  { 0x00221037, VR::FL, "TargetRefraction" },
-  { 0x00221039, VR::CS, "RefractiveProcedureOccurred" },
-  { 0x00221040, VR::SQ, "RefractiveSurgeryTypeCodeSequence" },
-  { 0x00221044, VR::SQ, "OphthalmicUltrasoundMethodCodeSequence" },
-  { 0x00221050, VR::SQ, "OphthalmicAxialLengthMeasurementsSequence" },
-  { 0x00221053, VR::FL, "IOLPower" },
-  { 0x00221054, VR::FL, "PredictedRefractiveError" },
-  { 0x00221059, VR::FL, "OphthalmicAxialLengthVelocity" },
-  { 0x00221065, VR::LO, "LensStatusDescription" },
-  { 0x00221066, VR::LO, "VitreousStatusDescription" },
-  { 0x00221090, VR::SQ, "IOLPowerSequence" },
-  { 0x00221092, VR::SQ, "LensConstantSequence" },
-  { 0x00221093, VR::LO, "IOLManufacturer" },
-  { 0x00221095, VR::LO, "ImplantName" },
-  { 0x00221096, VR::SQ, "KeratometryMeasurementTypeCodeSequence" },
-  { 0x00221097, VR::LO, "ImplantPartNumber" },
-  { 0x00221100, VR::SQ, "ReferencedOphthalmicAxialMeasurementsSequence" },
-  { 0x00221101, VR::SQ, "OphthalmicAxialLengthMeasurementsSegmentNameCodeSequence" },
-  { 0x00221103, VR::SQ, "RefractiveErrorBeforeRefractiveSurgeryCodeSequence" },
-  { 0x00221121, VR::FL, "IOLPowerForExactEmmetropia" },
-  { 0x00221122, VR::FL, "IOLPowerForExactTargetRefraction" },
-  { 0x00221125, VR::SQ, "AnteriorChamberDepthDefinitionCodeSequence" },
-  { 0x00221127, VR::SQ, "LensThicknessSequence" },
-  { 0x00221128, VR::SQ, "AnteriorChamberDepthSequence" },
-  { 0x00221130, VR::FL, "LensThickness" },
-  { 0x00221131, VR::FL, "AnteriorChamberDepth" },
-  { 0x00221132, VR::SQ, "SourceOfLensThicknessDataCodeSequence" },
-  { 0x00221133, VR::SQ, "SourceOfAnteriorChamberDepthDataCodeSequence" },
-  { 0x00221134, VR::SQ, "SourceOfRefractiveMeasurementsSequence" },
-  { 0x00221135, VR::SQ, "SourceOfRefractiveMeasurementsCodeSequence" },
-  { 0x00221140, VR::CS, "OphthalmicAxialLengthMeasurementModified" },
-  { 0x00221150, VR::SQ, "OphthalmicAxialLengthDataSourceCodeSequence" },
-  { 0x00221155, VR::FL, "SignalToNoiseRatio" },
-  { 0x00221159, VR::LO, "OphthalmicAxialLengthDataSourceDescription" },
-  { 0x00221210, VR::SQ, "OphthalmicAxialLengthMeasurementsTotalLengthSequence" },
-  { 0x00221211, VR::SQ, "OphthalmicAxialLengthMeasurementsSegmentalLengthSequence" },
-  { 0x00221212, VR::SQ, "OphthalmicAxialLengthMeasurementsLengthSummationSequence" },
-  { 0x00221220, VR::SQ, "UltrasoundOphthalmicAxialLengthMeasurementsSequence" },
-  { 0x00221225, VR::SQ, "OpticalOphthalmicAxialLengthMeasurementsSequence" },
-  { 0x00221230, VR::SQ, "UltrasoundSelectedOphthalmicAxialLengthSequence" },
-  { 0x00221250, VR::SQ, "OphthalmicAxialLengthSelectionMethodCodeSequence" },
-  { 0x00221255, VR::SQ, "OpticalSelectedOphthalmicAxialLengthSequence" },
-  { 0x00221257, VR::SQ, "SelectedSegmentalOphthalmicAxialLengthSequence" },
-  { 0x00221260, VR::SQ, "SelectedTotalOphthalmicAxialLengthSequence" },
-  { 0x00221262, VR::SQ, "OphthalmicAxialLengthQualityMetricSequence" },
-  { 0x00221300, VR::SQ, "IntraocularLensCalculationsRightEyeSequence" },
-  { 0x00221310, VR::SQ, "IntraocularLensCalculationsLeftEyeSequence" },
-  { 0x00221330, VR::SQ, "ReferencedOphthalmicAxialLengthMeasurementQCImageSequence" },
-  { 0x00221415, VR::CS, "OphthalmicMappingDeviceType" },
-  { 0x00221420, VR::SQ, "AcquisitionMethodCodeSequence" },
-  { 0x00221423, VR::SQ, "AcquisitionMethodAlgorithmSequence" },
-  { 0x00221436, VR::SQ, "OphthalmicThicknessMapTypeCodeSequence" },
-  { 0x00221443, VR::SQ, "OphthalmicThicknessMappingNormalsSequence" },
-  { 0x00221445, VR::SQ, "RetinalThicknessDefinitionCodeSequence" },
-  { 0x00221450, VR::SQ, "PixelValueMappingToCodedConceptSequence" },
-  { 0x00221452, VR::US, "MappedPixelValue" },
-  { 0x00221454, VR::LO, "PixelValueMappingExplanation" },
-  { 0x00221458, VR::SQ, "OphthalmicThicknessMapQualityThresholdSequence" },
-  { 0x00221460, VR::FL, "OphthalmicThicknessMapThresholdQualityRating" },
-  { 0x00221463, VR::FL, "AnatomicStructureReferencePoint" },
-  { 0x00221465, VR::SQ, "RegistrationToLocalizerSequence" },
-  { 0x00221466, VR::CS, "RegisteredLocalizerUnits" },
-  { 0x00221467, VR::FL, "RegisteredLocalizerTopLeftHandCorner" },
-  { 0x00221468, VR::FL, "RegisteredLocalizerBottomRightHandCorner" },
-  { 0x00221470, VR::SQ, "OphthalmicThicknessMapQualityRatingSequence" },
-  { 0x00221472, VR::SQ, "RelevantOPTAttributesSequence" },
-  { 0x00221512, VR::SQ, "TransformationMethodCodeSequence" },
-  { 0x00221513, VR::SQ, "TransformationAlgorithmSequence" },
-  { 0x00221515, VR::CS, "OphthalmicAxialLengthMethod" },
-  { 0x00221517, VR::FL, "OphthalmicFOV" },
-  { 0x00221518, VR::SQ, "TwoDimensionalToThreeDimensionalMapSequence" },
-  { 0x00221525, VR::SQ, "WideFieldOphthalmicPhotographyQualityRatingSequence" },
-  { 0x00221526, VR::SQ, "WideFieldOphthalmicPhotographyQualityThresholdSequence" },
-  { 0x00221527, VR::FL, "WideFieldOphthalmicPhotographyThresholdQualityRating" },
-  { 0x00221528, VR::FL, "XCoordinatesCenterPixelViewAngle" },
-  { 0x00221529, VR::FL, "YCoordinatesCenterPixelViewAngle" },
-  { 0x00221530, VR::UL, "NumberOfMapPoints" },
-  { 0x00221531, VR::OF, "TwoDimensionalToThreeDimensionalMapData" },
-  { 0x00240010, VR::FL, "VisualFieldHorizontalExtent" },
-  { 0x00240011, VR::FL, "VisualFieldVerticalExtent" },
-  { 0x00240012, VR::CS, "VisualFieldShape" },
-  { 0x00240016, VR::SQ, "ScreeningTestModeCodeSequence" },
-  { 0x00240018, VR::FL, "MaximumStimulusLuminance" },
-  { 0x00240020, VR::FL, "BackgroundLuminance" },
-  { 0x00240021, VR::SQ, "StimulusColorCodeSequence" },
-  { 0x00240024, VR::SQ, "BackgroundIlluminationColorCodeSequence" },
-  { 0x00240025, VR::FL, "StimulusArea" },
-  { 0x00240028, VR::FL, "StimulusPresentationTime" },
-  { 0x00240032, VR::SQ, "FixationSequence" },
-  { 0x00240033, VR::SQ, "FixationMonitoringCodeSequence" },
-  { 0x00240034, VR::SQ, "VisualFieldCatchTrialSequence" },
-  { 0x00240035, VR::US, "FixationCheckedQuantity" },
-  { 0x00240036, VR::US, "PatientNotProperlyFixatedQuantity" },
-  { 0x00240037, VR::CS, "PresentedVisualStimuliDataFlag" },
-  { 0x00240038, VR::US, "NumberOfVisualStimuli" },
-  { 0x00240039, VR::CS, "ExcessiveFixationLossesDataFlag" },
-  { 0x00240040, VR::CS, "ExcessiveFixationLosses" },
-  { 0x00240042, VR::US, "StimuliRetestingQuantity" },
-  { 0x00240044, VR::LT, "CommentsOnPatientPerformanceOfVisualField" },
-  { 0x00240045, VR::CS, "FalseNegativesEstimateFlag" },
-  { 0x00240046, VR::FL, "FalseNegativesEstimate" },
-  { 0x00240048, VR::US, "NegativeCatchTrialsQuantity" },
-  { 0x00240050, VR::US, "FalseNegativesQuantity" },
-  { 0x00240051, VR::CS, "ExcessiveFalseNegativesDataFlag" },
-  { 0x00240052, VR::CS, "ExcessiveFalseNegatives" },
-  { 0x00240053, VR::CS, "FalsePositivesEstimateFlag" },
-  { 0x00240054, VR::FL, "FalsePositivesEstimate" },
-  { 0x00240055, VR::CS, "CatchTrialsDataFlag" },
-  { 0x00240056, VR::US, "PositiveCatchTrialsQuantity" },
-  { 0x00240057, VR::CS, "TestPointNormalsDataFlag" },
-  { 0x00240058, VR::SQ, "TestPointNormalsSequence" },
-  { 0x00240059, VR::CS, "GlobalDeviationProbabilityNormalsFlag" },
-  { 0x00240060, VR::US, "FalsePositivesQuantity" },
-  { 0x00240061, VR::CS, "ExcessiveFalsePositivesDataFlag" },
-  { 0x00240062, VR::CS, "ExcessiveFalsePositives" },
-  { 0x00240063, VR::CS, "VisualFieldTestNormalsFlag" },
-  { 0x00240064, VR::SQ, "ResultsNormalsSequence" },
-  { 0x00240065, VR::SQ, "AgeCorrectedSensitivityDeviationAlgorithmSequence" },
-  { 0x00240066, VR::FL, "GlobalDeviationFromNormal" },
-  { 0x00240067, VR::SQ, "GeneralizedDefectSensitivityDeviationAlgorithmSequence" },
-  { 0x00240068, VR::FL, "LocalizedDeviationFromNormal" },
-  { 0x00240069, VR::LO, "PatientReliabilityIndicator" },
-  { 0x00240070, VR::FL, "VisualFieldMeanSensitivity" },
-  { 0x00240071, VR::FL, "GlobalDeviationProbability" },
-  { 0x00240072, VR::CS, "LocalDeviationProbabilityNormalsFlag" },
-  { 0x00240073, VR::FL, "LocalizedDeviationProbability" },
-  { 0x00240074, VR::CS, "ShortTermFluctuationCalculated" },
-  { 0x00240075, VR::FL, "ShortTermFluctuation" },
-  { 0x00240076, VR::CS, "ShortTermFluctuationProbabilityCalculated" },
-  { 0x00240077, VR::FL, "ShortTermFluctuationProbability" },
-  { 0x00240078, VR::CS, "CorrectedLocalizedDeviationFromNormalCalculated" },
-  { 0x00240079, VR::FL, "CorrectedLocalizedDeviationFromNormal" },
-  { 0x00240080, VR::CS, "CorrectedLocalizedDeviationFromNormalProbabilityCalculated" },
-  { 0x00240081, VR::FL, "CorrectedLocalizedDeviationFromNormalProbability" },
-  { 0x00240083, VR::SQ, "GlobalDeviationProbabilitySequence" },
-  { 0x00240085, VR::SQ, "LocalizedDeviationProbabilitySequence" },
-  { 0x00240086, VR::CS, "FovealSensitivityMeasured" },
-  { 0x00240087, VR::FL, "FovealSensitivity" },
-  { 0x00240088, VR::FL, "VisualFieldTestDuration" },
-  { 0x00240089, VR::SQ, "VisualFieldTestPointSequence" },
-  { 0x00240090, VR::FL, "VisualFieldTestPointXCoordinate" },
-  { 0x00240091, VR::FL, "VisualFieldTestPointYCoordinate" },
-  { 0x00240092, VR::FL, "AgeCorrectedSensitivityDeviationValue" },
-  { 0x00240093, VR::CS, "StimulusResults" },
-  { 0x00240094, VR::FL, "SensitivityValue" },
-  { 0x00240095, VR::CS, "RetestStimulusSeen" },
-  { 0x00240096, VR::FL, "RetestSensitivityValue" },
-  { 0x00240097, VR::SQ, "VisualFieldTestPointNormalsSequence" },
-  { 0x00240098, VR::FL, "QuantifiedDefect" },
-  { 0x00240100, VR::FL, "AgeCorrectedSensitivityDeviationProbabilityValue" },
-  { 0x00240102, VR::CS, "GeneralizedDefectCorrectedSensitivityDeviationFlag" },
-  { 0x00240103, VR::FL, "GeneralizedDefectCorrectedSensitivityDeviationValue" },
-  { 0x00240104, VR::FL, "GeneralizedDefectCorrectedSensitivityDeviationProbabilityValue" },
-  { 0x00240105, VR::FL, "MinimumSensitivityValue" },
-  { 0x00240106, VR::CS, "BlindSpotLocalized" },
-  { 0x00240107, VR::FL, "BlindSpotXCoordinate" },
-  { 0x00240108, VR::FL, "BlindSpotYCoordinate" },
-  { 0x00240110, VR::SQ, "VisualAcuityMeasurementSequence" },
-  { 0x00240112, VR::SQ, "RefractiveParametersUsedOnPatientSequence" },
-  { 0x00240113, VR::CS, "MeasurementLaterality" },
-  { 0x00240114, VR::SQ, "OphthalmicPatientClinicalInformationLeftEyeSequence" },
-  { 0x00240115, VR::SQ, "OphthalmicPatientClinicalInformationRightEyeSequence" },
-  { 0x00240117, VR::CS, "FovealPointNormativeDataFlag" },
-  { 0x00240118, VR::FL, "FovealPointProbabilityValue" },
-  { 0x00240120, VR::CS, "ScreeningBaselineMeasured" },
-  { 0x00240122, VR::SQ, "ScreeningBaselineMeasuredSequence" },
-  { 0x00240124, VR::CS, "ScreeningBaselineType" },
-  { 0x00240126, VR::FL, "ScreeningBaselineValue" },
-  { 0x00240202, VR::LO, "AlgorithmSource" },
-  { 0x00240306, VR::LO, "DataSetName" },
-  { 0x00240307, VR::LO, "DataSetVersion" },
-  { 0x00240308, VR::LO, "DataSetSource" },
-  { 0x00240309, VR::LO, "DataSetDescription" },
-  { 0x00240317, VR::SQ, "VisualFieldTestReliabilityGlobalIndexSequence" },
-  { 0x00240320, VR::SQ, "VisualFieldGlobalResultsIndexSequence" },
-  { 0x00240325, VR::SQ, "DataObservationSequence" },
-  { 0x00240338, VR::CS, "IndexNormalsFlag" },
-  { 0x00240341, VR::FL, "IndexProbability" },
-  { 0x00240344, VR::SQ, "IndexProbabilitySequence" },
-  { 0x00280002, VR::US, "SamplesPerPixel" },
-  { 0x00280003, VR::US, "SamplesPerPixelUsed" },
-  { 0x00280004, VR::CS, "PhotometricInterpretation" },
-  { 0x00280006, VR::US, "PlanarConfiguration" },
-  { 0x00280008, VR::IS, "NumberOfFrames" },
-  { 0x00280009, VR::AT, "FrameIncrementPointer" },
-  { 0x0028000A, VR::AT, "FrameDimensionPointer" },
-  { 0x00280010, VR::US, "Rows" },
-  { 0x00280011, VR::US, "Columns" },
-  { 0x00280014, VR::US, "UltrasoundColorDataPresent" },
-  { 0x00280030, VR::DS, "PixelSpacing" },
-  { 0x00280031, VR::DS, "ZoomFactor" },
-  { 0x00280032, VR::DS, "ZoomCenter" },
-  { 0x00280034, VR::IS, "PixelAspectRatio" },
-  { 0x00280051, VR::CS, "CorrectedImage" },
-  { 0x00280100, VR::US, "BitsAllocated" },
-  { 0x00280101, VR::US, "BitsStored" },
-  { 0x00280102, VR::US, "HighBit" },
-  { 0x00280103, VR::US, "PixelRepresentation" },
-  { 0x00280106, VR::US, "SmallestImagePixelValue" },
-  { 0x00280107, VR::US, "LargestImagePixelValue" },
-  { 0x00280108, VR::US, "SmallestPixelValueInSeries" },
-  { 0x00280109, VR::US, "LargestPixelValueInSeries" },
-  { 0x00280120, VR::US, "PixelPaddingValue" },
-  { 0x00280121, VR::US, "PixelPaddingRangeLimit" },
-  { 0x00280122, VR::FL, "FloatPixelPaddingValue" },
-  { 0x00280123, VR::FD, "DoubleFloatPixelPaddingValue" },
-  { 0x00280124, VR::FL, "FloatPixelPaddingRangeLimit" },
-  { 0x00280125, VR::FD, "DoubleFloatPixelPaddingRangeLimit" },
-  { 0x00280300, VR::CS, "QualityControlImage" },
-  { 0x00280301, VR::CS, "BurnedInAnnotation" },
-  { 0x00280302, VR::CS, "RecognizableVisualFeatures" },
-  { 0x00280303, VR::CS, "LongitudinalTemporalInformationModified" },
-  { 0x00280304, VR::UI, "ReferencedColorPaletteInstanceUID" },
-  { 0x00280A02, VR::CS, "PixelSpacingCalibrationType" },
-  { 0x00280A04, VR::LO, "PixelSpacingCalibrationDescription" },
-  { 0x00281040, VR::CS, "PixelIntensityRelationship" },
-  { 0x00281041, VR::SS, "PixelIntensityRelationshipSign" },
-  { 0x00281050, VR::DS, "WindowCenter" },
-  { 0x00281051, VR::DS, "WindowWidth" },
-  { 0x00281052, VR::DS, "RescaleIntercept" },
-  { 0x00281053, VR::DS, "RescaleSlope" },
-  { 0x00281054, VR::LO, "RescaleType" },
-  { 0x00281055, VR::LO, "WindowCenterWidthExplanation" },
-  { 0x00281056, VR::CS, "VOILUTFunction" },
-  { 0x00281090, VR::CS, "RecommendedViewingMode" },
-  { 0x00281101, VR::US, "RedPaletteColorLookupTableDescriptor" },
-  { 0x00281102, VR::US, "GreenPaletteColorLookupTableDescriptor" },
-  { 0x00281103, VR::US, "BluePaletteColorLookupTableDescriptor" },
-  { 0x00281104, VR::US, "AlphaPaletteColorLookupTableDescriptor" },
-  { 0x00281199, VR::UI, "PaletteColorLookupTableUID" },
-  { 0x00281201, VR::OW, "RedPaletteColorLookupTableData" },
-  { 0x00281202, VR::OW, "GreenPaletteColorLookupTableData" },
-  { 0x00281203, VR::OW, "BluePaletteColorLookupTableData" },
-  { 0x00281204, VR::OW, "AlphaPaletteColorLookupTableData" },
-  { 0x00281221, VR::OW, "SegmentedRedPaletteColorLookupTableData" },
-  { 0x00281222, VR::OW, "SegmentedGreenPaletteColorLookupTableData" },
-  { 0x00281223, VR::OW, "SegmentedBluePaletteColorLookupTableData" },
-  { 0x00281224, VR::OW, "SegmentedAlphaPaletteColorLookupTableData" },
-  { 0x00281300, VR::CS, "BreastImplantPresent" },
-  { 0x00281350, VR::CS, "PartialView" },
-  { 0x00281351, VR::ST, "PartialViewDescription" },
-  { 0x00281352, VR::SQ, "PartialViewCodeSequence" },
-  { 0x0028135A, VR::CS, "SpatialLocationsPreserved" },
-  { 0x00281401, VR::SQ, "DataFrameAssignmentSequence" },
-  { 0x00281402, VR::CS, "DataPathAssignment" },
-  { 0x00281403, VR::US, "BitsMappedToColorLookupTable" },
-  { 0x00281404, VR::SQ, "BlendingLUT1Sequence" },
-  { 0x00281405, VR::CS, "BlendingLUT1TransferFunction" },
-  { 0x00281406, VR::FD, "BlendingWeightConstant" },
-  { 0x00281407, VR::US, "BlendingLookupTableDescriptor" },
-  { 0x00281408, VR::OW, "BlendingLookupTableData" },
-  { 0x0028140B, VR::SQ, "EnhancedPaletteColorLookupTableSequence" },
-  { 0x0028140C, VR::SQ, "BlendingLUT2Sequence" },
-  { 0x0028140D, VR::CS, "BlendingLUT2TransferFunction" },
-  { 0x0028140E, VR::CS, "DataPathID" },
-  { 0x0028140F, VR::CS, "RGBLUTTransferFunction" },
-  { 0x00281410, VR::CS, "AlphaLUTTransferFunction" },
-  { 0x00282000, VR::OB, "ICCProfile" },
-  { 0x00282002, VR::CS, "ColorSpace" },
-  { 0x00282110, VR::CS, "LossyImageCompression" },
-  { 0x00282112, VR::DS, "LossyImageCompressionRatio" },
-  { 0x00282114, VR::CS, "LossyImageCompressionMethod" },
-  { 0x00283000, VR::SQ, "ModalityLUTSequence" },
-  { 0x00283002, VR::US, "LUTDescriptor" },
-  { 0x00283003, VR::LO, "LUTExplanation" },
-  { 0x00283004, VR::LO, "ModalityLUTType" },
-  { 0x00283006, VR::US, "LUTData" },
-  { 0x00283010, VR::SQ, "VOILUTSequence" },
-  { 0x00283110, VR::SQ, "SoftcopyVOILUTSequence" },
-  { 0x00286010, VR::US, "RepresentativeFrameNumber" },
-  { 0x00286020, VR::US, "FrameNumbersOfInterest" },
-  { 0x00286022, VR::LO, "FrameOfInterestDescription" },
-  { 0x00286023, VR::CS, "FrameOfInterestType" },
-  { 0x00286040, VR::US, "RWavePointer" },
-  { 0x00286100, VR::SQ, "MaskSubtractionSequence" },
-  { 0x00286101, VR::CS, "MaskOperation" },
-  { 0x00286102, VR::US, "ApplicableFrameRange" },
-  { 0x00286110, VR::US, "MaskFrameNumbers" },
-  { 0x00286112, VR::US, "ContrastFrameAveraging" },
-  { 0x00286114, VR::FL, "MaskSubPixelShift" },
-  { 0x00286120, VR::SS, "TIDOffset" },
-  { 0x00286190, VR::ST, "MaskOperationExplanation" },
-  { 0x00287000, VR::SQ, "EquipmentAdministratorSequence" },
-  { 0x00287001, VR::US, "NumberOfDisplaySubsystems" },
-  { 0x00287002, VR::US, "CurrentConfigurationID" },
-  { 0x00287003, VR::US, "DisplaySubsystemID" },
-  { 0x00287004, VR::SH, "DisplaySubsystemName" },
-  { 0x00287005, VR::LO, "DisplaySubsystemDescription" },
-  { 0x00287006, VR::CS, "SystemStatus" },
-  { 0x00287007, VR::LO, "SystemStatusComment" },
-  { 0x00287008, VR::SQ, "TargetLuminanceCharacteristicsSequence" },
-  { 0x00287009, VR::US, "LuminanceCharacteristicsID" },
-  { 0x0028700A, VR::SQ, "DisplaySubsystemConfigurationSequence" },
-  { 0x0028700B, VR::US, "ConfigurationID" },
-  { 0x0028700C, VR::SH, "ConfigurationName" },
-  { 0x0028700D, VR::LO, "ConfigurationDescription" },
-  { 0x0028700E, VR::US, "ReferencedTargetLuminanceCharacteristicsID" },
-  { 0x0028700F, VR::SQ, "QAResultsSequence" },
-  { 0x00287010, VR::SQ, "DisplaySubsystemQAResultsSequence" },
-  { 0x00287011, VR::SQ, "ConfigurationQAResultsSequence" },
-  { 0x00287012, VR::SQ, "MeasurementEquipmentSequence" },
-  { 0x00287013, VR::CS, "MeasurementFunctions" },
-  { 0x00287014, VR::CS, "MeasurementEquipmentType" },
-  { 0x00287015, VR::SQ, "VisualEvaluationResultSequence" },
-  { 0x00287016, VR::SQ, "DisplayCalibrationResultSequence" },
-  { 0x00287017, VR::US, "DDLValue" },
-  { 0x00287018, VR::FL, "CIExyWhitePoint" },
-  { 0x00287019, VR::CS, "DisplayFunctionType" },
-  { 0x0028701A, VR::FL, "GammaValue" },
-  { 0x0028701B, VR::US, "NumberOfLuminancePoints" },
-  { 0x0028701C, VR::SQ, "LuminanceResponseSequence" },
-  { 0x0028701D, VR::FL, "TargetMinimumLuminance" },
-  { 0x0028701E, VR::FL, "TargetMaximumLuminance" },
-  { 0x0028701F, VR::FL, "LuminanceValue" },
-  { 0x00287020, VR::LO, "LuminanceResponseDescription" },
-  { 0x00287021, VR::CS, "WhitePointFlag" },
-  { 0x00287022, VR::SQ, "DisplayDeviceTypeCodeSequence" },
-  { 0x00287023, VR::SQ, "DisplaySubsystemSequence" },
-  { 0x00287024, VR::SQ, "LuminanceResultSequence" },
-  { 0x00287025, VR::CS, "AmbientLightValueSource" },
-  { 0x00287026, VR::CS, "MeasuredCharacteristics" },
-  { 0x00287027, VR::SQ, "LuminanceUniformityResultSequence" },
-  { 0x00287028, VR::SQ, "VisualEvaluationTestSequence" },
-  { 0x00287029, VR::CS, "TestResult" },
-  { 0x0028702A, VR::LO, "TestResultComment" },
-  { 0x0028702B, VR::CS, "TestImageValidation" },
-  { 0x0028702C, VR::SQ, "TestPatternCodeSequence" },
-  { 0x0028702D, VR::SQ, "MeasurementPatternCodeSequence" },
-  { 0x0028702E, VR::SQ, "VisualEvaluationMethodCodeSequence" },
-  { 0x00287FE0, VR::UR, "PixelDataProviderURL" },
-  { 0x00289001, VR::UL, "DataPointRows" },
-  { 0x00289002, VR::UL, "DataPointColumns" },
-  { 0x00289003, VR::CS, "SignalDomainColumns" },
-  { 0x00289108, VR::CS, "DataRepresentation" },
-  { 0x00289110, VR::SQ, "PixelMeasuresSequence" },
-  { 0x00289132, VR::SQ, "FrameVOILUTSequence" },
-  { 0x00289145, VR::SQ, "PixelValueTransformationSequence" },
-  { 0x00289235, VR::CS, "SignalDomainRows" },
-  { 0x00289411, VR::FL, "DisplayFilterPercentage" },
-  { 0x00289415, VR::SQ, "FramePixelShiftSequence" },
-  { 0x00289416, VR::US, "SubtractionItemID" },
-  { 0x00289422, VR::SQ, "PixelIntensityRelationshipLUTSequence" },
-  { 0x00289443, VR::SQ, "FramePixelDataPropertiesSequence" },
-  { 0x00289444, VR::CS, "GeometricalProperties" },
-  { 0x00289445, VR::FL, "GeometricMaximumDistortion" },
-  { 0x00289446, VR::CS, "ImageProcessingApplied" },
-  { 0x00289454, VR::CS, "MaskSelectionMode" },
-  { 0x00289474, VR::CS, "LUTFunction" },
-  { 0x00289478, VR::FL, "MaskVisibilityPercentage" },
-  { 0x00289501, VR::SQ, "PixelShiftSequence" },
-  { 0x00289502, VR::SQ, "RegionPixelShiftSequence" },
-  { 0x00289503, VR::SS, "VerticesOfTheRegion" },
-  { 0x00289505, VR::SQ, "MultiFramePresentationSequence" },
-  { 0x00289506, VR::US, "PixelShiftFrameRange" },
-  { 0x00289507, VR::US, "LUTFrameRange" },
-  { 0x00289520, VR::DS, "ImageToEquipmentMappingMatrix" },
-  { 0x00289537, VR::CS, "EquipmentCoordinateSystemIdentification" },
-  { 0x00321031, VR::SQ, "RequestingPhysicianIdentificationSequence" },
-  { 0x00321032, VR::PN, "RequestingPhysician" },
-  { 0x00321033, VR::LO, "RequestingService" },
-  { 0x00321034, VR::SQ, "RequestingServiceCodeSequence" },
-  { 0x00321060, VR::LO, "RequestedProcedureDescription" },
-  { 0x00321064, VR::SQ, "RequestedProcedureCodeSequence" },
-  { 0x00321070, VR::LO, "RequestedContrastAgent" },
-  { 0x00380004, VR::SQ, "ReferencedPatientAliasSequence" },
-  { 0x00380008, VR::CS, "VisitStatusID" },
-  { 0x00380010, VR::LO, "AdmissionID" },
-  { 0x00380014, VR::SQ, "IssuerOfAdmissionIDSequence" },
-  { 0x00380016, VR::LO, "RouteOfAdmissions" },
-  { 0x00380020, VR::DA, "AdmittingDate" },
-  { 0x00380021, VR::TM, "AdmittingTime" },
-  { 0x00380050, VR::LO, "SpecialNeeds" },
-  { 0x00380060, VR::LO, "ServiceEpisodeID" },
-  { 0x00380062, VR::LO, "ServiceEpisodeDescription" },
-  { 0x00380064, VR::SQ, "IssuerOfServiceEpisodeIDSequence" },
-  { 0x00380100, VR::SQ, "PertinentDocumentsSequence" },
-  { 0x00380101, VR::SQ, "PertinentResourcesSequence" },
-  { 0x00380102, VR::LO, "ResourceDescription" },
-  { 0x00380300, VR::LO, "CurrentPatientLocation" },
-  { 0x00380400, VR::LO, "PatientInstitutionResidence" },
-  { 0x00380500, VR::LO, "PatientState" },
-  { 0x00380502, VR::SQ, "PatientClinicalTrialParticipationSequence" },
-  { 0x00384000, VR::LT, "VisitComments" },
-  { 0x003A0004, VR::CS, "WaveformOriginality" },
-  { 0x003A0005, VR::US, "NumberOfWaveformChannels" },
-  { 0x003A0010, VR::UL, "NumberOfWaveformSamples" },
-  { 0x003A001A, VR::DS, "SamplingFrequency" },
-  { 0x003A0020, VR::SH, "MultiplexGroupLabel" },
-  { 0x003A0200, VR::SQ, "ChannelDefinitionSequence" },
-  { 0x003A0202, VR::IS, "WaveformChannelNumber" },
-  { 0x003A0203, VR::SH, "ChannelLabel" },
-  { 0x003A0205, VR::CS, "ChannelStatus" },
-  { 0x003A0208, VR::SQ, "ChannelSourceSequence" },
-  { 0x003A0209, VR::SQ, "ChannelSourceModifiersSequence" },
-  { 0x003A020A, VR::SQ, "SourceWaveformSequence" },
-  { 0x003A020C, VR::LO, "ChannelDerivationDescription" },
-  { 0x003A0210, VR::DS, "ChannelSensitivity" },
-  { 0x003A0211, VR::SQ, "ChannelSensitivityUnitsSequence" },
-  { 0x003A0212, VR::DS, "ChannelSensitivityCorrectionFactor" },
-  { 0x003A0213, VR::DS, "ChannelBaseline" },
-  { 0x003A0214, VR::DS, "ChannelTimeSkew" },
-  { 0x003A0215, VR::DS, "ChannelSampleSkew" },
-  { 0x003A0218, VR::DS, "ChannelOffset" },
-  { 0x003A021A, VR::US, "WaveformBitsStored" },
-  { 0x003A0220, VR::DS, "FilterLowFrequency" },
-  { 0x003A0221, VR::DS, "FilterHighFrequency" },
-  { 0x003A0222, VR::DS, "NotchFilterFrequency" },
-  { 0x003A0223, VR::DS, "NotchFilterBandwidth" },
-  { 0x003A0230, VR::FL, "WaveformDataDisplayScale" },
-  { 0x003A0231, VR::US, "WaveformDisplayBackgroundCIELabValue" },
-  { 0x003A0240, VR::SQ, "WaveformPresentationGroupSequence" },
-  { 0x003A0241, VR::US, "PresentationGroupNumber" },
-  { 0x003A0242, VR::SQ, "ChannelDisplaySequence" },
-  { 0x003A0244, VR::US, "ChannelRecommendedDisplayCIELabValue" },
-  { 0x003A0245, VR::FL, "ChannelPosition" },
-  { 0x003A0246, VR::CS, "DisplayShadingFlag" },
-  { 0x003A0247, VR::FL, "FractionalChannelDisplayScale" },
-  { 0x003A0248, VR::FL, "AbsoluteChannelDisplayScale" },
-  { 0x003A0300, VR::SQ, "MultiplexedAudioChannelsDescriptionCodeSequence" },
-  { 0x003A0301, VR::IS, "ChannelIdentificationCode" },
-  { 0x003A0302, VR::CS, "ChannelMode" },
-  { 0x00400001, VR::AE, "ScheduledStationAETitle" },
-  { 0x00400002, VR::DA, "ScheduledProcedureStepStartDate" },
-  { 0x00400003, VR::TM, "ScheduledProcedureStepStartTime" },
-  { 0x00400004, VR::DA, "ScheduledProcedureStepEndDate" },
-  { 0x00400005, VR::TM, "ScheduledProcedureStepEndTime" },
-  { 0x00400006, VR::PN, "ScheduledPerformingPhysicianName" },
-  { 0x00400007, VR::LO, "ScheduledProcedureStepDescription" },
-  { 0x00400008, VR::SQ, "ScheduledProtocolCodeSequence" },
-  { 0x00400009, VR::SH, "ScheduledProcedureStepID" },
-  { 0x0040000A, VR::SQ, "StageCodeSequence" },
-  { 0x0040000B, VR::SQ, "ScheduledPerformingPhysicianIdentificationSequence" },
-  { 0x00400010, VR::SH, "ScheduledStationName" },
-  { 0x00400011, VR::SH, "ScheduledProcedureStepLocation" },
-  { 0x00400012, VR::LO, "PreMedication" },
-  { 0x00400020, VR::CS, "ScheduledProcedureStepStatus" },
-  { 0x00400026, VR::SQ, "OrderPlacerIdentifierSequence" },
-  { 0x00400027, VR::SQ, "OrderFillerIdentifierSequence" },
-  { 0x00400031, VR::UT, "LocalNamespaceEntityID" },
-  { 0x00400032, VR::UT, "UniversalEntityID" },
-  { 0x00400033, VR::CS, "UniversalEntityIDType" },
-  { 0x00400035, VR::CS, "IdentifierTypeCode" },
-  { 0x00400036, VR::SQ, "AssigningFacilitySequence" },
-  { 0x00400039, VR::SQ, "AssigningJurisdictionCodeSequence" },
-  { 0x0040003A, VR::SQ, "AssigningAgencyOrDepartmentCodeSequence" },
-  { 0x00400100, VR::SQ, "ScheduledProcedureStepSequence" },
-  { 0x00400220, VR::SQ, "ReferencedNonImageCompositeSOPInstanceSequence" },
-  { 0x00400241, VR::AE, "PerformedStationAETitle" },
-  { 0x00400242, VR::SH, "PerformedStationName" },
-  { 0x00400243, VR::SH, "PerformedLocation" },
-  { 0x00400244, VR::DA, "PerformedProcedureStepStartDate" },
-  { 0x00400245, VR::TM, "PerformedProcedureStepStartTime" },
-  { 0x00400250, VR::DA, "PerformedProcedureStepEndDate" },
-  { 0x00400251, VR::TM, "PerformedProcedureStepEndTime" },
-  { 0x00400252, VR::CS, "PerformedProcedureStepStatus" },
-  { 0x00400253, VR::SH, "PerformedProcedureStepID" },
-  { 0x00400254, VR::LO, "PerformedProcedureStepDescription" },
-  { 0x00400255, VR::LO, "PerformedProcedureTypeDescription" },
-  { 0x00400260, VR::SQ, "PerformedProtocolCodeSequence" },
-  { 0x00400261, VR::CS, "PerformedProtocolType" },
-  { 0x00400270, VR::SQ, "ScheduledStepAttributesSequence" },
-  { 0x00400275, VR::SQ, "RequestAttributesSequence" },
-  { 0x00400280, VR::ST, "CommentsOnThePerformedProcedureStep" },
-  { 0x00400281, VR::SQ, "PerformedProcedureStepDiscontinuationReasonCodeSequence" },
-  { 0x00400293, VR::SQ, "QuantitySequence" },
-  { 0x00400294, VR::DS, "Quantity" },
-  { 0x00400295, VR::SQ, "MeasuringUnitsSequence" },
-  { 0x00400296, VR::SQ, "BillingItemSequence" },
-  { 0x00400300, VR::US, "TotalTimeOfFluoroscopy" },
-  { 0x00400301, VR::US, "TotalNumberOfExposures" },
-  { 0x00400302, VR::US, "EntranceDose" },
-  { 0x00400303, VR::US, "ExposedArea" },
-  { 0x00400306, VR::DS, "DistanceSourceToEntrance" },
-  { 0x0040030E, VR::SQ, "ExposureDoseSequence" },
-  { 0x00400310, VR::ST, "CommentsOnRadiationDose" },
-  { 0x00400312, VR::DS, "XRayOutput" },
-  { 0x00400314, VR::DS, "HalfValueLayer" },
-  { 0x00400316, VR::DS, "OrganDose" },
-  { 0x00400318, VR::CS, "OrganExposed" },
-  { 0x00400320, VR::SQ, "BillingProcedureStepSequence" },
-  { 0x00400321, VR::SQ, "FilmConsumptionSequence" },
-  { 0x00400324, VR::SQ, "BillingSuppliesAndDevicesSequence" },
-  { 0x00400340, VR::SQ, "PerformedSeriesSequence" },
-  { 0x00400400, VR::LT, "CommentsOnTheScheduledProcedureStep" },
-  { 0x00400440, VR::SQ, "ProtocolContextSequence" },
-  { 0x00400441, VR::SQ, "ContentItemModifierSequence" },
-  { 0x00400500, VR::SQ, "ScheduledSpecimenSequence" },
-  { 0x00400512, VR::LO, "ContainerIdentifier" },
-  { 0x00400513, VR::SQ, "IssuerOfTheContainerIdentifierSequence" },
-  { 0x00400515, VR::SQ, "AlternateContainerIdentifierSequence" },
-  { 0x00400518, VR::SQ, "ContainerTypeCodeSequence" },
-  { 0x0040051A, VR::LO, "ContainerDescription" },
-  { 0x00400520, VR::SQ, "ContainerComponentSequence" },
-  { 0x00400551, VR::LO, "SpecimenIdentifier" },
-  { 0x00400554, VR::UI, "SpecimenUID" },
-  { 0x00400555, VR::SQ, "AcquisitionContextSequence" },
-  { 0x00400556, VR::ST, "AcquisitionContextDescription" },
-  { 0x00400560, VR::SQ, "SpecimenDescriptionSequence" },
-  { 0x00400562, VR::SQ, "IssuerOfTheSpecimenIdentifierSequence" },
-  { 0x0040059A, VR::SQ, "SpecimenTypeCodeSequence" },
-  { 0x00400600, VR::LO, "SpecimenShortDescription" },
-  { 0x00400602, VR::UT, "SpecimenDetailedDescription" },
-  { 0x00400610, VR::SQ, "SpecimenPreparationSequence" },
-  { 0x00400612, VR::SQ, "SpecimenPreparationStepContentItemSequence" },
-  { 0x00400620, VR::SQ, "SpecimenLocalizationContentItemSequence" },
-  { 0x0040071A, VR::SQ, "ImageCenterPointCoordinatesSequence" },
-  { 0x0040072A, VR::DS, "XOffsetInSlideCoordinateSystem" },
-  { 0x0040073A, VR::DS, "YOffsetInSlideCoordinateSystem" },
-  { 0x0040074A, VR::DS, "ZOffsetInSlideCoordinateSystem" },
-  { 0x004008EA, VR::SQ, "MeasurementUnitsCodeSequence" },
-  { 0x00401001, VR::SH, "RequestedProcedureID" },
-  { 0x00401002, VR::LO, "ReasonForTheRequestedProcedure" },
-  { 0x00401003, VR::SH, "RequestedProcedurePriority" },
-  { 0x00401004, VR::LO, "PatientTransportArrangements" },
-  { 0x00401005, VR::LO, "RequestedProcedureLocation" },
-  { 0x00401008, VR::LO, "ConfidentialityCode" },
-  { 0x00401009, VR::SH, "ReportingPriority" },
-  { 0x0040100A, VR::SQ, "ReasonForRequestedProcedureCodeSequence" },
-  { 0x00401010, VR::PN, "NamesOfIntendedRecipientsOfResults" },
-  { 0x00401011, VR::SQ, "IntendedRecipientsOfResultsIdentificationSequence" },
-  { 0x00401012, VR::SQ, "ReasonForPerformedProcedureCodeSequence" },
-  { 0x00401101, VR::SQ, "PersonIdentificationCodeSequence" },
-  { 0x00401102, VR::ST, "PersonAddress" },
-  { 0x00401103, VR::LO, "PersonTelephoneNumbers" },
-  { 0x00401104, VR::LT, "PersonTelecomInformation" },
-  { 0x00401400, VR::LT, "RequestedProcedureComments" },
-  { 0x00402004, VR::DA, "IssueDateOfImagingServiceRequest" },
-  { 0x00402005, VR::TM, "IssueTimeOfImagingServiceRequest" },
-  { 0x00402008, VR::PN, "OrderEnteredBy" },
-  { 0x00402009, VR::SH, "OrderEntererLocation" },
-  { 0x00402010, VR::SH, "OrderCallbackPhoneNumber" },
-  { 0x00402011, VR::LT, "OrderCallbackTelecomInformation" },
-  { 0x00402016, VR::LO, "PlacerOrderNumberImagingServiceRequest" },
-  { 0x00402017, VR::LO, "FillerOrderNumberImagingServiceRequest" },
-  { 0x00402400, VR::LT, "ImagingServiceRequestComments" },
-  { 0x00403001, VR::LO, "ConfidentialityConstraintOnPatientDataDescription" },
-  { 0x00404005, VR::DT, "ScheduledProcedureStepStartDateTime" },
-  { 0x00404007, VR::SQ, "PerformedProcessingApplicationsCodeSequence" },
-  { 0x00404009, VR::SQ, "HumanPerformerCodeSequence" },
-  { 0x00404010, VR::DT, "ScheduledProcedureStepModificationDateTime" },
-  { 0x00404011, VR::DT, "ExpectedCompletionDateTime" },
-  { 0x00404018, VR::SQ, "ScheduledWorkitemCodeSequence" },
-  { 0x00404019, VR::SQ, "PerformedWorkitemCodeSequence" },
-  { 0x00404020, VR::CS, "InputAvailabilityFlag" },
-  { 0x00404021, VR::SQ, "InputInformationSequence" },
-  { 0x00404025, VR::SQ, "ScheduledStationNameCodeSequence" },
-  { 0x00404026, VR::SQ, "ScheduledStationClassCodeSequence" },
-  { 0x00404027, VR::SQ, "ScheduledStationGeographicLocationCodeSequence" },
-  { 0x00404028, VR::SQ, "PerformedStationNameCodeSequence" },
-  { 0x00404029, VR::SQ, "PerformedStationClassCodeSequence" },
-  { 0x00404030, VR::SQ, "PerformedStationGeographicLocationCodeSequence" },
-  { 0x00404033, VR::SQ, "OutputInformationSequence" },
-  { 0x00404034, VR::SQ, "ScheduledHumanPerformersSequence" },
-  { 0x00404035, VR::SQ, "ActualHumanPerformersSequence" },
-  { 0x00404036, VR::LO, "HumanPerformerOrganization" },
-  { 0x00404037, VR::PN, "HumanPerformerName" },
-  { 0x00404040, VR::CS, "RawDataHandling" },
-  { 0x00404041, VR::CS, "InputReadinessState" },
-  { 0x00404050, VR::DT, "PerformedProcedureStepStartDateTime" },
-  { 0x00404051, VR::DT, "PerformedProcedureStepEndDateTime" },
-  { 0x00404052, VR::DT, "ProcedureStepCancellationDateTime" },
-  { 0x00404070, VR::SQ, "OutputDestinationSequence" },
-  { 0x00404071, VR::SQ, "DICOMStorageSequence" },
-  { 0x00404072, VR::SQ, "STOWRSStorageSequence" },
-  { 0x00404073, VR::UR, "StorageURL" },
-  { 0x00404074, VR::SQ, "XDSStorageSequence" },
-  { 0x00408302, VR::DS, "EntranceDoseInmGy" },
-  { 0x00409092, VR::SQ, "ParametricMapFrameTypeSequence" },
-  { 0x00409094, VR::SQ, "ReferencedImageRealWorldValueMappingSequence" },
-  { 0x00409096, VR::SQ, "RealWorldValueMappingSequence" },
-  { 0x00409098, VR::SQ, "PixelValueMappingCodeSequence" },
-  { 0x00409210, VR::SH, "LUTLabel" },
-  { 0x00409211, VR::US, "RealWorldValueLastValueMapped" },
-  { 0x00409212, VR::FD, "RealWorldValueLUTData" },
-  { 0x00409213, VR::FD, "DoubleFloatRealWorldValueLastValueMapped" },
-  { 0x00409214, VR::FD, "DoubleFloatRealWorldValueFirstValueMapped" },
-  { 0x00409216, VR::US, "RealWorldValueFirstValueMapped" },
-  { 0x00409220, VR::SQ, "QuantityDefinitionSequence" },
-  { 0x00409224, VR::FD, "RealWorldValueIntercept" },
-  { 0x00409225, VR::FD, "RealWorldValueSlope" },
-  { 0x0040A010, VR::CS, "RelationshipType" },
-  { 0x0040A027, VR::LO, "VerifyingOrganization" },
-  { 0x0040A030, VR::DT, "VerificationDateTime" },
-  { 0x0040A032, VR::DT, "ObservationDateTime" },
-  { 0x0040A040, VR::CS, "ValueType" },
-  { 0x0040A043, VR::SQ, "ConceptNameCodeSequence" },
-  { 0x0040A050, VR::CS, "ContinuityOfContent" },
-  { 0x0040A073, VR::SQ, "VerifyingObserverSequence" },
-  { 0x0040A075, VR::PN, "VerifyingObserverName" },
-  { 0x0040A078, VR::SQ, "AuthorObserverSequence" },
-  { 0x0040A07A, VR::SQ, "ParticipantSequence" },
-  { 0x0040A07C, VR::SQ, "CustodialOrganizationSequence" },
-  { 0x0040A080, VR::CS, "ParticipationType" },
-  { 0x0040A082, VR::DT, "ParticipationDateTime" },
-  { 0x0040A084, VR::CS, "ObserverType" },
-  { 0x0040A088, VR::SQ, "VerifyingObserverIdentificationCodeSequence" },
-  { 0x0040A0B0, VR::US, "ReferencedWaveformChannels" },
-  { 0x0040A120, VR::DT, "DateTime" },
-  { 0x0040A121, VR::DA, "Date" },
-  { 0x0040A122, VR::TM, "Time" },
-  { 0x0040A123, VR::PN, "PersonName" },
-  { 0x0040A124, VR::UI, "UID" },
-  { 0x0040A130, VR::CS, "TemporalRangeType" },
-  { 0x0040A132, VR::UL, "ReferencedSamplePositions" },
-  { 0x0040A136, VR::US, "ReferencedFrameNumbers" },
-  { 0x0040A138, VR::DS, "ReferencedTimeOffsets" },
-  { 0x0040A13A, VR::DT, "ReferencedDateTime" },
-  { 0x0040A160, VR::UT, "TextValue" },
-  { 0x0040A161, VR::FD, "FloatingPointValue" },
-  { 0x0040A162, VR::SL, "RationalNumeratorValue" },
-  { 0x0040A163, VR::UL, "RationalDenominatorValue" },
-  { 0x0040A168, VR::SQ, "ConceptCodeSequence" },
-  { 0x0040A170, VR::SQ, "PurposeOfReferenceCodeSequence" },
-  { 0x0040A171, VR::UI, "ObservationUID" },
-  { 0x0040A180, VR::US, "AnnotationGroupNumber" },
-  { 0x0040A195, VR::SQ, "ModifierCodeSequence" },
-  { 0x0040A300, VR::SQ, "MeasuredValueSequence" },
-  { 0x0040A301, VR::SQ, "NumericValueQualifierCodeSequence" },
-  { 0x0040A30A, VR::DS, "NumericValue" },
-  { 0x0040A360, VR::SQ, "PredecessorDocumentsSequence" },
-  { 0x0040A370, VR::SQ, "ReferencedRequestSequence" },
-  { 0x0040A372, VR::SQ, "PerformedProcedureCodeSequence" },
-  { 0x0040A375, VR::SQ, "CurrentRequestedProcedureEvidenceSequence" },
-  { 0x0040A385, VR::SQ, "PertinentOtherEvidenceSequence" },
-  { 0x0040A390, VR::SQ, "HL7StructuredDocumentReferenceSequence" },
-  { 0x0040A491, VR::CS, "CompletionFlag" },
-  { 0x0040A492, VR::LO, "CompletionFlagDescription" },
-  { 0x0040A493, VR::CS, "VerificationFlag" },
-  { 0x0040A494, VR::CS, "ArchiveRequested" },
-  { 0x0040A496, VR::CS, "PreliminaryFlag" },
-  { 0x0040A504, VR::SQ, "ContentTemplateSequence" },
-  { 0x0040A525, VR::SQ, "IdenticalDocumentsSequence" },
-  { 0x0040A730, VR::SQ, "ContentSequence" },
-  { 0x0040B020, VR::SQ, "WaveformAnnotationSequence" },
-  { 0x0040DB00, VR::CS, "TemplateIdentifier" },
-  { 0x0040DB73, VR::UL, "ReferencedContentItemIdentifier" },
-  { 0x0040E001, VR::ST, "HL7InstanceIdentifier" },
-  { 0x0040E004, VR::DT, "HL7DocumentEffectiveTime" },
-  { 0x0040E006, VR::SQ, "HL7DocumentTypeCodeSequence" },
-  { 0x0040E008, VR::SQ, "DocumentClassCodeSequence" },
-  { 0x0040E010, VR::UR, "RetrieveURI" },
-  { 0x0040E011, VR::UI, "RetrieveLocationUID" },
-  { 0x0040E020, VR::CS, "TypeOfInstances" },
-  { 0x0040E021, VR::SQ, "DICOMRetrievalSequence" },
-  { 0x0040E022, VR::SQ, "DICOMMediaRetrievalSequence" },
-  { 0x0040E023, VR::SQ, "WADORetrievalSequence" },
-  { 0x0040E024, VR::SQ, "XDSRetrievalSequence" },
-  { 0x0040E025, VR::SQ, "WADORSRetrievalSequence" },
-  { 0x0040E030, VR::UI, "RepositoryUniqueID" },
-  { 0x0040E031, VR::UI, "HomeCommunityID" },
-  { 0x00420010, VR::ST, "DocumentTitle" },
-  { 0x00420011, VR::OB, "EncapsulatedDocument" },
-  { 0x00420012, VR::LO, "MIMETypeOfEncapsulatedDocument" },
-  { 0x00420013, VR::SQ, "SourceInstanceSequence" },
-  { 0x00420014, VR::LO, "ListOfMIMETypes" },
-  { 0x00440001, VR::ST, "ProductPackageIdentifier" },
-  { 0x00440002, VR::CS, "SubstanceAdministrationApproval" },
-  { 0x00440003, VR::LT, "ApprovalStatusFurtherDescription" },
-  { 0x00440004, VR::DT, "ApprovalStatusDateTime" },
-  { 0x00440007, VR::SQ, "ProductTypeCodeSequence" },
-  { 0x00440008, VR::LO, "ProductName" },
-  { 0x00440009, VR::LT, "ProductDescription" },
-  { 0x0044000A, VR::LO, "ProductLotIdentifier" },
-  { 0x0044000B, VR::DT, "ProductExpirationDateTime" },
-  { 0x00440010, VR::DT, "SubstanceAdministrationDateTime" },
-  { 0x00440011, VR::LO, "SubstanceAdministrationNotes" },
-  { 0x00440012, VR::LO, "SubstanceAdministrationDeviceID" },
-  { 0x00440013, VR::SQ, "ProductParameterSequence" },
-  { 0x00440019, VR::SQ, "SubstanceAdministrationParameterSequence" },
-  { 0x00460012, VR::LO, "LensDescription" },
-  { 0x00460014, VR::SQ, "RightLensSequence" },
-  { 0x00460015, VR::SQ, "LeftLensSequence" },
-  { 0x00460016, VR::SQ, "UnspecifiedLateralityLensSequence" },
-  { 0x00460018, VR::SQ, "CylinderSequence" },
-  { 0x00460028, VR::SQ, "PrismSequence" },
-  { 0x00460030, VR::FD, "HorizontalPrismPower" },
-  { 0x00460032, VR::CS, "HorizontalPrismBase" },
-  { 0x00460034, VR::FD, "VerticalPrismPower" },
-  { 0x00460036, VR::CS, "VerticalPrismBase" },
-  { 0x00460038, VR::CS, "LensSegmentType" },
-  { 0x00460040, VR::FD, "OpticalTransmittance" },
-  { 0x00460042, VR::FD, "ChannelWidth" },
-  { 0x00460044, VR::FD, "PupilSize" },
-  { 0x00460046, VR::FD, "CornealSize" },
-  { 0x00460050, VR::SQ, "AutorefractionRightEyeSequence" },
-  { 0x00460052, VR::SQ, "AutorefractionLeftEyeSequence" },
-  { 0x00460060, VR::FD, "DistancePupillaryDistance" },
-  { 0x00460062, VR::FD, "NearPupillaryDistance" },
-  { 0x00460063, VR::FD, "IntermediatePupillaryDistance" },
-  { 0x00460064, VR::FD, "OtherPupillaryDistance" },
-  { 0x00460070, VR::SQ, "KeratometryRightEyeSequence" },
-  { 0x00460071, VR::SQ, "KeratometryLeftEyeSequence" },
-  { 0x00460074, VR::SQ, "SteepKeratometricAxisSequence" },
-  { 0x00460075, VR::FD, "RadiusOfCurvature" },
-  { 0x00460076, VR::FD, "KeratometricPower" },
-  { 0x00460077, VR::FD, "KeratometricAxis" },
-  { 0x00460080, VR::SQ, "FlatKeratometricAxisSequence" },
-  { 0x00460092, VR::CS, "BackgroundColor" },
-  { 0x00460094, VR::CS, "Optotype" },
-  { 0x00460095, VR::CS, "OptotypePresentation" },
-  { 0x00460097, VR::SQ, "SubjectiveRefractionRightEyeSequence" },
-  { 0x00460098, VR::SQ, "SubjectiveRefractionLeftEyeSequence" },
-  { 0x00460100, VR::SQ, "AddNearSequence" },
-  { 0x00460101, VR::SQ, "AddIntermediateSequence" },
-  { 0x00460102, VR::SQ, "AddOtherSequence" },
-  { 0x00460104, VR::FD, "AddPower" },
-  { 0x00460106, VR::FD, "ViewingDistance" },
-  { 0x00460121, VR::SQ, "VisualAcuityTypeCodeSequence" },
-  { 0x00460122, VR::SQ, "VisualAcuityRightEyeSequence" },
-  { 0x00460123, VR::SQ, "VisualAcuityLeftEyeSequence" },
-  { 0x00460124, VR::SQ, "VisualAcuityBothEyesOpenSequence" },
-  { 0x00460125, VR::CS, "ViewingDistanceType" },
-  { 0x00460135, VR::SS, "VisualAcuityModifiers" },
-  { 0x00460137, VR::FD, "DecimalVisualAcuity" },
-  { 0x00460139, VR::LO, "OptotypeDetailedDefinition" },
-  { 0x00460145, VR::SQ, "ReferencedRefractiveMeasurementsSequence" },
-  { 0x00460146, VR::FD, "SpherePower" },
-  { 0x00460147, VR::FD, "CylinderPower" },
-  { 0x00460201, VR::CS, "CornealTopographySurface" },
-  { 0x00460202, VR::FL, "CornealVertexLocation" },
-  { 0x00460203, VR::FL, "PupilCentroidXCoordinate" },
-  { 0x00460204, VR::FL, "PupilCentroidYCoordinate" },
-  { 0x00460205, VR::FL, "EquivalentPupilRadius" },
-  { 0x00460207, VR::SQ, "CornealTopographyMapTypeCodeSequence" },
-  { 0x00460208, VR::IS, "VerticesOfTheOutlineOfPupil" },
-  { 0x00460210, VR::SQ, "CornealTopographyMappingNormalsSequence" },
-  { 0x00460211, VR::SQ, "MaximumCornealCurvatureSequence" },
-  { 0x00460212, VR::FL, "MaximumCornealCurvature" },
-  { 0x00460213, VR::FL, "MaximumCornealCurvatureLocation" },
-  { 0x00460215, VR::SQ, "MinimumKeratometricSequence" },
-  { 0x00460218, VR::SQ, "SimulatedKeratometricCylinderSequence" },
-  { 0x00460220, VR::FL, "AverageCornealPower" },
-  { 0x00460224, VR::FL, "CornealISValue" },
-  { 0x00460227, VR::FL, "AnalyzedArea" },
-  { 0x00460230, VR::FL, "SurfaceRegularityIndex" },
-  { 0x00460232, VR::FL, "SurfaceAsymmetryIndex" },
-  { 0x00460234, VR::FL, "CornealEccentricityIndex" },
-  { 0x00460236, VR::FL, "KeratoconusPredictionIndex" },
-  { 0x00460238, VR::FL, "DecimalPotentialVisualAcuity" },
-  { 0x00460242, VR::CS, "CornealTopographyMapQualityEvaluation" },
-  { 0x00460244, VR::SQ, "SourceImageCornealProcessedDataSequence" },
-  { 0x00460247, VR::FL, "CornealPointLocation" },
-  { 0x00460248, VR::CS, "CornealPointEstimated" },
-  { 0x00460249, VR::FL, "AxialPower" },
-  { 0x00460250, VR::FL, "TangentialPower" },
-  { 0x00460251, VR::FL, "RefractivePower" },
-  { 0x00460252, VR::FL, "RelativeElevation" },
-  { 0x00460253, VR::FL, "CornealWavefront" },
-  { 0x00480001, VR::FL, "ImagedVolumeWidth" },
-  { 0x00480002, VR::FL, "ImagedVolumeHeight" },
-  { 0x00480003, VR::FL, "ImagedVolumeDepth" },
-  { 0x00480006, VR::UL, "TotalPixelMatrixColumns" },
-  { 0x00480007, VR::UL, "TotalPixelMatrixRows" },
-  { 0x00480008, VR::SQ, "TotalPixelMatrixOriginSequence" },
-  { 0x00480010, VR::CS, "SpecimenLabelInImage" },
-  { 0x00480011, VR::CS, "FocusMethod" },
-  { 0x00480012, VR::CS, "ExtendedDepthOfField" },
-  { 0x00480013, VR::US, "NumberOfFocalPlanes" },
-  { 0x00480014, VR::FL, "DistanceBetweenFocalPlanes" },
-  { 0x00480015, VR::US, "RecommendedAbsentPixelCIELabValue" },
-  { 0x00480100, VR::SQ, "IlluminatorTypeCodeSequence" },
-  { 0x00480102, VR::DS, "ImageOrientationSlide" },
-  { 0x00480105, VR::SQ, "OpticalPathSequence" },
-  { 0x00480106, VR::SH, "OpticalPathIdentifier" },
-  { 0x00480107, VR::ST, "OpticalPathDescription" },
-  { 0x00480108, VR::SQ, "IlluminationColorCodeSequence" },
-  { 0x00480110, VR::SQ, "SpecimenReferenceSequence" },
-  { 0x00480111, VR::DS, "CondenserLensPower" },
-  { 0x00480112, VR::DS, "ObjectiveLensPower" },
-  { 0x00480113, VR::DS, "ObjectiveLensNumericalAperture" },
-  { 0x00480120, VR::SQ, "PaletteColorLookupTableSequence" },
-  { 0x00480200, VR::SQ, "ReferencedImageNavigationSequence" },
-  { 0x00480201, VR::US, "TopLeftHandCornerOfLocalizerArea" },
-  { 0x00480202, VR::US, "BottomRightHandCornerOfLocalizerArea" },
-  { 0x00480207, VR::SQ, "OpticalPathIdentificationSequence" },
-  { 0x0048021A, VR::SQ, "PlanePositionSlideSequence" },
-  { 0x0048021E, VR::SL, "ColumnPositionInTotalImagePixelMatrix" },
-  { 0x0048021F, VR::SL, "RowPositionInTotalImagePixelMatrix" },
-  { 0x00480301, VR::CS, "PixelOriginInterpretation" },
-  { 0x00500004, VR::CS, "CalibrationImage" },
-  { 0x00500010, VR::SQ, "DeviceSequence" },
-  { 0x00500012, VR::SQ, "ContainerComponentTypeCodeSequence" },
-  { 0x00500013, VR::FD, "ContainerComponentThickness" },
-  { 0x00500014, VR::DS, "DeviceLength" },
-  { 0x00500015, VR::FD, "ContainerComponentWidth" },
-  { 0x00500016, VR::DS, "DeviceDiameter" },
-  { 0x00500017, VR::CS, "DeviceDiameterUnits" },
-  { 0x00500018, VR::DS, "DeviceVolume" },
-  { 0x00500019, VR::DS, "InterMarkerDistance" },
-  { 0x0050001A, VR::CS, "ContainerComponentMaterial" },
-  { 0x0050001B, VR::LO, "ContainerComponentID" },
-  { 0x0050001C, VR::FD, "ContainerComponentLength" },
-  { 0x0050001D, VR::FD, "ContainerComponentDiameter" },
-  { 0x0050001E, VR::LO, "ContainerComponentDescription" },
-  { 0x00500020, VR::LO, "DeviceDescription" },
-  { 0x00520001, VR::FL, "ContrastBolusIngredientPercentByVolume" },
-  { 0x00520002, VR::FD, "OCTFocalDistance" },
-  { 0x00520003, VR::FD, "BeamSpotSize" },
-  { 0x00520004, VR::FD, "EffectiveRefractiveIndex" },
-  { 0x00520006, VR::CS, "OCTAcquisitionDomain" },
-  { 0x00520007, VR::FD, "OCTOpticalCenterWavelength" },
-  { 0x00520008, VR::FD, "AxialResolution" },
-  { 0x00520009, VR::FD, "RangingDepth" },
-  { 0x00520011, VR::FD, "ALineRate" },
-  { 0x00520012, VR::US, "ALinesPerFrame" },
-  { 0x00520013, VR::FD, "CatheterRotationalRate" },
-  { 0x00520014, VR::FD, "ALinePixelSpacing" },
-  { 0x00520016, VR::SQ, "ModeOfPercutaneousAccessSequence" },
-  { 0x00520025, VR::SQ, "IntravascularOCTFrameTypeSequence" },
-  { 0x00520026, VR::CS, "OCTZOffsetApplied" },
-  { 0x00520027, VR::SQ, "IntravascularFrameContentSequence" },
-  { 0x00520028, VR::FD, "IntravascularLongitudinalDistance" },
-  { 0x00520029, VR::SQ, "IntravascularOCTFrameContentSequence" },
-  { 0x00520030, VR::SS, "OCTZOffsetCorrection" },
-  { 0x00520031, VR::CS, "CatheterDirectionOfRotation" },
-  { 0x00520033, VR::FD, "SeamLineLocation" },
-  { 0x00520034, VR::FD, "FirstALineLocation" },
-  { 0x00520036, VR::US, "SeamLineIndex" },
-  { 0x00520038, VR::US, "NumberOfPaddedALines" },
-  { 0x00520039, VR::CS, "InterpolationType" },
-  { 0x0052003A, VR::CS, "RefractiveIndexApplied" },
-  { 0x00540010, VR::US, "EnergyWindowVector" },
-  { 0x00540011, VR::US, "NumberOfEnergyWindows" },
-  { 0x00540012, VR::SQ, "EnergyWindowInformationSequence" },
-  { 0x00540013, VR::SQ, "EnergyWindowRangeSequence" },
-  { 0x00540014, VR::DS, "EnergyWindowLowerLimit" },
-  { 0x00540015, VR::DS, "EnergyWindowUpperLimit" },
-  { 0x00540016, VR::SQ, "RadiopharmaceuticalInformationSequence" },
-  { 0x00540017, VR::IS, "ResidualSyringeCounts" },
-  { 0x00540018, VR::SH, "EnergyWindowName" },
-  { 0x00540020, VR::US, "DetectorVector" },
-  { 0x00540021, VR::US, "NumberOfDetectors" },
-  { 0x00540022, VR::SQ, "DetectorInformationSequence" },
-  { 0x00540030, VR::US, "PhaseVector" },
-  { 0x00540031, VR::US, "NumberOfPhases" },
-  { 0x00540032, VR::SQ, "PhaseInformationSequence" },
-  { 0x00540033, VR::US, "NumberOfFramesInPhase" },
-  { 0x00540036, VR::IS, "PhaseDelay" },
-  { 0x00540038, VR::IS, "PauseBetweenFrames" },
-  { 0x00540039, VR::CS, "PhaseDescription" },
-  { 0x00540050, VR::US, "RotationVector" },
-  { 0x00540051, VR::US, "NumberOfRotations" },
-  { 0x00540052, VR::SQ, "RotationInformationSequence" },
-  { 0x00540053, VR::US, "NumberOfFramesInRotation" },
-  { 0x00540060, VR::US, "RRIntervalVector" },
-  { 0x00540061, VR::US, "NumberOfRRIntervals" },
-  { 0x00540062, VR::SQ, "GatedInformationSequence" },
-  { 0x00540063, VR::SQ, "DataInformationSequence" },
-  { 0x00540070, VR::US, "TimeSlotVector" },
-  { 0x00540071, VR::US, "NumberOfTimeSlots" },
-  { 0x00540072, VR::SQ, "TimeSlotInformationSequence" },
-  { 0x00540073, VR::DS, "TimeSlotTime" },
-  { 0x00540080, VR::US, "SliceVector" },
-  { 0x00540081, VR::US, "NumberOfSlices" },
-  { 0x00540090, VR::US, "AngularViewVector" },
-  { 0x00540100, VR::US, "TimeSliceVector" },
-  { 0x00540101, VR::US, "NumberOfTimeSlices" },
-  { 0x00540200, VR::DS, "StartAngle" },
-  { 0x00540202, VR::CS, "TypeOfDetectorMotion" },
-  { 0x00540210, VR::IS, "TriggerVector" },
-  { 0x00540211, VR::US, "NumberOfTriggersInPhase" },
-  { 0x00540220, VR::SQ, "ViewCodeSequence" },
-  { 0x00540222, VR::SQ, "ViewModifierCodeSequence" },
-  { 0x00540300, VR::SQ, "RadionuclideCodeSequence" },
-  { 0x00540302, VR::SQ, "AdministrationRouteCodeSequence" },
-  { 0x00540304, VR::SQ, "RadiopharmaceuticalCodeSequence" },
-  { 0x00540306, VR::SQ, "CalibrationDataSequence" },
-  { 0x00540308, VR::US, "EnergyWindowNumber" },
-  { 0x00540400, VR::SH, "ImageID" },
-  { 0x00540410, VR::SQ, "PatientOrientationCodeSequence" },
-  { 0x00540412, VR::SQ, "PatientOrientationModifierCodeSequence" },
-  { 0x00540414, VR::SQ, "PatientGantryRelationshipCodeSequence" },
-  { 0x00540500, VR::CS, "SliceProgressionDirection" },
-  { 0x00540501, VR::CS, "ScanProgressionDirection" },
-  { 0x00541000, VR::CS, "SeriesType" },
-  { 0x00541001, VR::CS, "Units" },
-  { 0x00541002, VR::CS, "CountsSource" },
-  { 0x00541004, VR::CS, "ReprojectionMethod" },
-  { 0x00541006, VR::CS, "SUVType" },
-  { 0x00541100, VR::CS, "RandomsCorrectionMethod" },
-  { 0x00541101, VR::LO, "AttenuationCorrectionMethod" },
-  { 0x00541102, VR::CS, "DecayCorrection" },
-  { 0x00541103, VR::LO, "ReconstructionMethod" },
-  { 0x00541104, VR::LO, "DetectorLinesOfResponseUsed" },
-  { 0x00541105, VR::LO, "ScatterCorrectionMethod" },
-  { 0x00541200, VR::DS, "AxialAcceptance" },
-  { 0x00541201, VR::IS, "AxialMash" },
-  { 0x00541202, VR::IS, "TransverseMash" },
-  { 0x00541203, VR::DS, "DetectorElementSize" },
-  { 0x00541210, VR::DS, "CoincidenceWindowWidth" },
-  { 0x00541220, VR::CS, "SecondaryCountsType" },
-  { 0x00541300, VR::DS, "FrameReferenceTime" },
-  { 0x00541310, VR::IS, "PrimaryPromptsCountsAccumulated" },
-  { 0x00541311, VR::IS, "SecondaryCountsAccumulated" },
-  { 0x00541320, VR::DS, "SliceSensitivityFactor" },
-  { 0x00541321, VR::DS, "DecayFactor" },
-  { 0x00541322, VR::DS, "DoseCalibrationFactor" },
-  { 0x00541323, VR::DS, "ScatterFractionFactor" },
-  { 0x00541324, VR::DS, "DeadTimeFactor" },
-  { 0x00541330, VR::US, "ImageIndex" },
-  { 0x00603000, VR::SQ, "HistogramSequence" },
-  { 0x00603002, VR::US, "HistogramNumberOfBins" },
-  { 0x00603004, VR::US, "HistogramFirstBinValue" },
-  { 0x00603006, VR::US, "HistogramLastBinValue" },
-  { 0x00603008, VR::US, "HistogramBinWidth" },
-  { 0x00603010, VR::LO, "HistogramExplanation" },
-  { 0x00603020, VR::UL, "HistogramData" },
-  { 0x00620001, VR::CS, "SegmentationType" },
-  { 0x00620002, VR::SQ, "SegmentSequence" },
-  { 0x00620003, VR::SQ, "SegmentedPropertyCategoryCodeSequence" },
-  { 0x00620004, VR::US, "SegmentNumber" },
-  { 0x00620005, VR::LO, "SegmentLabel" },
-  { 0x00620006, VR::ST, "SegmentDescription" },
-  { 0x00620008, VR::CS, "SegmentAlgorithmType" },
-  { 0x00620009, VR::LO, "SegmentAlgorithmName" },
-  { 0x0062000A, VR::SQ, "SegmentIdentificationSequence" },
-  { 0x0062000B, VR::US, "ReferencedSegmentNumber" },
-  { 0x0062000C, VR::US, "RecommendedDisplayGrayscaleValue" },
-  { 0x0062000D, VR::US, "RecommendedDisplayCIELabValue" },
-  { 0x0062000E, VR::US, "MaximumFractionalValue" },
-  { 0x0062000F, VR::SQ, "SegmentedPropertyTypeCodeSequence" },
-  { 0x00620010, VR::CS, "SegmentationFractionalType" },
-  { 0x00620011, VR::SQ, "SegmentedPropertyTypeModifierCodeSequence" },
-  { 0x00620012, VR::SQ, "UsedSegmentsSequence" },
-  { 0x00620020, VR::UT, "TrackingID" },
-  { 0x00620021, VR::UI, "TrackingUID" },
-  { 0x00640002, VR::SQ, "DeformableRegistrationSequence" },
-  { 0x00640003, VR::UI, "SourceFrameOfReferenceUID" },
-  { 0x00640005, VR::SQ, "DeformableRegistrationGridSequence" },
-  { 0x00640007, VR::UL, "GridDimensions" },
-  { 0x00640008, VR::FD, "GridResolution" },
-  { 0x00640009, VR::OF, "VectorGridData" },
-  { 0x0064000F, VR::SQ, "PreDeformationMatrixRegistrationSequence" },
-  { 0x00640010, VR::SQ, "PostDeformationMatrixRegistrationSequence" },
-  { 0x00660001, VR::UL, "NumberOfSurfaces" },
-  { 0x00660002, VR::SQ, "SurfaceSequence" },
-  { 0x00660003, VR::UL, "SurfaceNumber" },
-  { 0x00660004, VR::LT, "SurfaceComments" },
-  { 0x00660009, VR::CS, "SurfaceProcessing" },
-  { 0x0066000A, VR::FL, "SurfaceProcessingRatio" },
-  { 0x0066000B, VR::LO, "SurfaceProcessingDescription" },
-  { 0x0066000C, VR::FL, "RecommendedPresentationOpacity" },
-  { 0x0066000D, VR::CS, "RecommendedPresentationType" },
-  { 0x0066000E, VR::CS, "FiniteVolume" },
-  { 0x00660010, VR::CS, "Manifold" },
-  { 0x00660011, VR::SQ, "SurfacePointsSequence" },
-  { 0x00660012, VR::SQ, "SurfacePointsNormalsSequence" },
-  { 0x00660013, VR::SQ, "SurfaceMeshPrimitivesSequence" },
-  { 0x00660015, VR::UL, "NumberOfSurfacePoints" },
-  { 0x00660016, VR::OF, "PointCoordinatesData" },
-  { 0x00660017, VR::FL, "PointPositionAccuracy" },
-  { 0x00660018, VR::FL, "MeanPointDistance" },
-  { 0x00660019, VR::FL, "MaximumPointDistance" },
-  { 0x0066001A, VR::FL, "PointsBoundingBoxCoordinates" },
-  { 0x0066001B, VR::FL, "AxisOfRotation" },
-  { 0x0066001C, VR::FL, "CenterOfRotation" },
-  { 0x0066001E, VR::UL, "NumberOfVectors" },
-  { 0x0066001F, VR::US, "VectorDimensionality" },
-  { 0x00660020, VR::FL, "VectorAccuracy" },
-  { 0x00660021, VR::OF, "VectorCoordinateData" },
-  { 0x00660026, VR::SQ, "TriangleStripSequence" },
-  { 0x00660027, VR::SQ, "TriangleFanSequence" },
-  { 0x00660028, VR::SQ, "LineSequence" },
-  { 0x0066002A, VR::UL, "SurfaceCount" },
-  { 0x0066002B, VR::SQ, "ReferencedSurfaceSequence" },
-  { 0x0066002C, VR::UL, "ReferencedSurfaceNumber" },
-  { 0x0066002D, VR::SQ, "SegmentSurfaceGenerationAlgorithmIdentificationSequence" },
-  { 0x0066002E, VR::SQ, "SegmentSurfaceSourceInstanceSequence" },
-  { 0x0066002F, VR::SQ, "AlgorithmFamilyCodeSequence" },
-  { 0x00660030, VR::SQ, "AlgorithmNameCodeSequence" },
-  { 0x00660031, VR::LO, "AlgorithmVersion" },
-  { 0x00660032, VR::LT, "AlgorithmParameters" },
-  { 0x00660034, VR::SQ, "FacetSequence" },
-  { 0x00660035, VR::SQ, "SurfaceProcessingAlgorithmIdentificationSequence" },
-  { 0x00660036, VR::LO, "AlgorithmName" },
-  { 0x00660037, VR::FL, "RecommendedPointRadius" },
-  { 0x00660038, VR::FL, "RecommendedLineThickness" },
-  { 0x00660040, VR::OL, "LongPrimitivePointIndexList" },
-  { 0x00660041, VR::OL, "LongTrianglePointIndexList" },
-  { 0x00660042, VR::OL, "LongEdgePointIndexList" },
-  { 0x00660043, VR::OL, "LongVertexPointIndexList" },
-  { 0x00660101, VR::SQ, "TrackSetSequence" },
-  { 0x00660102, VR::SQ, "TrackSequence" },
-  { 0x00660103, VR::OW, "RecommendedDisplayCIELabValueList" },
-  { 0x00660104, VR::SQ, "TrackingAlgorithmIdentificationSequence" },
-  { 0x00660105, VR::UL, "TrackSetNumber" },
-  { 0x00660106, VR::LO, "TrackSetLabel" },
-  { 0x00660107, VR::UT, "TrackSetDescription" },
-  { 0x00660108, VR::SQ, "TrackSetAnatomicalTypeCodeSequence" },
-  { 0x00660121, VR::SQ, "MeasurementsSequence" },
-  { 0x00660124, VR::SQ, "TrackSetStatisticsSequence" },
-  { 0x00660125, VR::OF, "FloatingPointValues" },
-  { 0x00660129, VR::OL, "TrackPointIndexList" },
-  { 0x00660130, VR::SQ, "TrackStatisticsSequence" },
-  { 0x00660132, VR::SQ, "MeasurementValuesSequence" },
-  { 0x00660133, VR::SQ, "DiffusionAcquisitionCodeSequence" },
-  { 0x00660134, VR::SQ, "DiffusionModelCodeSequence" },
-  { 0x00686210, VR::LO, "ImplantSize" },
-  { 0x00686221, VR::LO, "ImplantTemplateVersion" },
-  { 0x00686222, VR::SQ, "ReplacedImplantTemplateSequence" },
-  { 0x00686223, VR::CS, "ImplantType" },
-  { 0x00686224, VR::SQ, "DerivationImplantTemplateSequence" },
-  { 0x00686225, VR::SQ, "OriginalImplantTemplateSequence" },
-  { 0x00686226, VR::DT, "EffectiveDateTime" },
-  { 0x00686230, VR::SQ, "ImplantTargetAnatomySequence" },
-  { 0x00686260, VR::SQ, "InformationFromManufacturerSequence" },
-  { 0x00686265, VR::SQ, "NotificationFromManufacturerSequence" },
-  { 0x00686270, VR::DT, "InformationIssueDateTime" },
-  { 0x00686280, VR::ST, "InformationSummary" },
-  { 0x006862A0, VR::SQ, "ImplantRegulatoryDisapprovalCodeSequence" },
-  { 0x006862A5, VR::FD, "OverallTemplateSpatialTolerance" },
-  { 0x006862C0, VR::SQ, "HPGLDocumentSequence" },
-  { 0x006862D0, VR::US, "HPGLDocumentID" },
-  { 0x006862D5, VR::LO, "HPGLDocumentLabel" },
-  { 0x006862E0, VR::SQ, "ViewOrientationCodeSequence" },
-  { 0x006862F0, VR::FD, "ViewOrientationModifier" },
-  { 0x006862F2, VR::FD, "HPGLDocumentScaling" },
-  { 0x00686300, VR::OB, "HPGLDocument" },
-  { 0x00686310, VR::US, "HPGLContourPenNumber" },
-  { 0x00686320, VR::SQ, "HPGLPenSequence" },
-  { 0x00686330, VR::US, "HPGLPenNumber" },
-  { 0x00686340, VR::LO, "HPGLPenLabel" },
-  { 0x00686345, VR::ST, "HPGLPenDescription" },
-  { 0x00686346, VR::FD, "RecommendedRotationPoint" },
-  { 0x00686347, VR::FD, "BoundingRectangle" },
-  { 0x00686350, VR::US, "ImplantTemplate3DModelSurfaceNumber" },
-  { 0x00686360, VR::SQ, "SurfaceModelDescriptionSequence" },
-  { 0x00686380, VR::LO, "SurfaceModelLabel" },
-  { 0x00686390, VR::FD, "SurfaceModelScalingFactor" },
-  { 0x006863A0, VR::SQ, "MaterialsCodeSequence" },
-  { 0x006863A4, VR::SQ, "CoatingMaterialsCodeSequence" },
-  { 0x006863A8, VR::SQ, "ImplantTypeCodeSequence" },
-  { 0x006863AC, VR::SQ, "FixationMethodCodeSequence" },
-  { 0x006863B0, VR::SQ, "MatingFeatureSetsSequence" },
-  { 0x006863C0, VR::US, "MatingFeatureSetID" },
-  { 0x006863D0, VR::LO, "MatingFeatureSetLabel" },
-  { 0x006863E0, VR::SQ, "MatingFeatureSequence" },
-  { 0x006863F0, VR::US, "MatingFeatureID" },
-  { 0x00686400, VR::SQ, "MatingFeatureDegreeOfFreedomSequence" },
-  { 0x00686410, VR::US, "DegreeOfFreedomID" },
-  { 0x00686420, VR::CS, "DegreeOfFreedomType" },
-  { 0x00686430, VR::SQ, "TwoDMatingFeatureCoordinatesSequence" },
-  { 0x00686440, VR::US, "ReferencedHPGLDocumentID" },
-  { 0x00686450, VR::FD, "TwoDMatingPoint" },
-  { 0x00686460, VR::FD, "TwoDMatingAxes" },
-  { 0x00686470, VR::SQ, "TwoDDegreeOfFreedomSequence" },
-  { 0x00686490, VR::FD, "ThreeDDegreeOfFreedomAxis" },
-  { 0x006864A0, VR::FD, "RangeOfFreedom" },
-  { 0x006864C0, VR::FD, "ThreeDMatingPoint" },
-  { 0x006864D0, VR::FD, "ThreeDMatingAxes" },
-  { 0x006864F0, VR::FD, "TwoDDegreeOfFreedomAxis" },
-  { 0x00686500, VR::SQ, "PlanningLandmarkPointSequence" },
-  { 0x00686510, VR::SQ, "PlanningLandmarkLineSequence" },
-  { 0x00686520, VR::SQ, "PlanningLandmarkPlaneSequence" },
-  { 0x00686530, VR::US, "PlanningLandmarkID" },
-  { 0x00686540, VR::LO, "PlanningLandmarkDescription" },
-  { 0x00686545, VR::SQ, "PlanningLandmarkIdentificationCodeSequence" },
-  { 0x00686550, VR::SQ, "TwoDPointCoordinatesSequence" },
-  { 0x00686560, VR::FD, "TwoDPointCoordinates" },
-  { 0x00686590, VR::FD, "ThreeDPointCoordinates" },
-  { 0x006865A0, VR::SQ, "TwoDLineCoordinatesSequence" },
-  { 0x006865B0, VR::FD, "TwoDLineCoordinates" },
-  { 0x006865D0, VR::FD, "ThreeDLineCoordinates" },
-  { 0x006865E0, VR::SQ, "TwoDPlaneCoordinatesSequence" },
-  { 0x006865F0, VR::FD, "TwoDPlaneIntersection" },
-  { 0x00686610, VR::FD, "ThreeDPlaneOrigin" },
-  { 0x00686620, VR::FD, "ThreeDPlaneNormal" },
-  { 0x00700001, VR::SQ, "GraphicAnnotationSequence" },
-  { 0x00700002, VR::CS, "GraphicLayer" },
-  { 0x00700003, VR::CS, "BoundingBoxAnnotationUnits" },
-  { 0x00700004, VR::CS, "AnchorPointAnnotationUnits" },
-  { 0x00700005, VR::CS, "GraphicAnnotationUnits" },
-  { 0x00700006, VR::ST, "UnformattedTextValue" },
-  { 0x00700008, VR::SQ, "TextObjectSequence" },
-  { 0x00700009, VR::SQ, "GraphicObjectSequence" },
-  { 0x00700010, VR::FL, "BoundingBoxTopLeftHandCorner" },
-  { 0x00700011, VR::FL, "BoundingBoxBottomRightHandCorner" },
-  { 0x00700012, VR::CS, "BoundingBoxTextHorizontalJustification" },
-  { 0x00700014, VR::FL, "AnchorPoint" },
-  { 0x00700015, VR::CS, "AnchorPointVisibility" },
-  { 0x00700020, VR::US, "GraphicDimensions" },
-  { 0x00700021, VR::US, "NumberOfGraphicPoints" },
-  { 0x00700022, VR::FL, "GraphicData" },
-  { 0x00700023, VR::CS, "GraphicType" },
-  { 0x00700024, VR::CS, "GraphicFilled" },
-  { 0x00700041, VR::CS, "ImageHorizontalFlip" },
-  { 0x00700042, VR::US, "ImageRotation" },
-  { 0x00700052, VR::SL, "DisplayedAreaTopLeftHandCorner" },
-  { 0x00700053, VR::SL, "DisplayedAreaBottomRightHandCorner" },
-  { 0x0070005A, VR::SQ, "DisplayedAreaSelectionSequence" },
-  { 0x00700060, VR::SQ, "GraphicLayerSequence" },
-  { 0x00700062, VR::IS, "GraphicLayerOrder" },
-  { 0x00700066, VR::US, "GraphicLayerRecommendedDisplayGrayscaleValue" },
-  { 0x00700068, VR::LO, "GraphicLayerDescription" },
-  { 0x00700080, VR::CS, "ContentLabel" },
-  { 0x00700081, VR::LO, "ContentDescription" },
-  { 0x00700082, VR::DA, "PresentationCreationDate" },
-  { 0x00700083, VR::TM, "PresentationCreationTime" },
-  { 0x00700084, VR::PN, "ContentCreatorName" },
-  { 0x00700086, VR::SQ, "ContentCreatorIdentificationCodeSequence" },
-  { 0x00700087, VR::SQ, "AlternateContentDescriptionSequence" },
-  { 0x00700100, VR::CS, "PresentationSizeMode" },
-  { 0x00700101, VR::DS, "PresentationPixelSpacing" },
-  { 0x00700102, VR::IS, "PresentationPixelAspectRatio" },
-  { 0x00700103, VR::FL, "PresentationPixelMagnificationRatio" },
-  { 0x00700207, VR::LO, "GraphicGroupLabel" },
-  { 0x00700208, VR::ST, "GraphicGroupDescription" },
-  { 0x00700209, VR::SQ, "CompoundGraphicSequence" },
-  { 0x00700226, VR::UL, "CompoundGraphicInstanceID" },
-  { 0x00700227, VR::LO, "FontName" },
-  { 0x00700228, VR::CS, "FontNameType" },
-  { 0x00700229, VR::LO, "CSSFontName" },
-  { 0x00700230, VR::FD, "RotationAngle" },
-  { 0x00700231, VR::SQ, "TextStyleSequence" },
-  { 0x00700232, VR::SQ, "LineStyleSequence" },
-  { 0x00700233, VR::SQ, "FillStyleSequence" },
-  { 0x00700234, VR::SQ, "GraphicGroupSequence" },
-  { 0x00700241, VR::US, "TextColorCIELabValue" },
-  { 0x00700242, VR::CS, "HorizontalAlignment" },
-  { 0x00700243, VR::CS, "VerticalAlignment" },
-  { 0x00700244, VR::CS, "ShadowStyle" },
-  { 0x00700245, VR::FL, "ShadowOffsetX" },
-  { 0x00700246, VR::FL, "ShadowOffsetY" },
-  { 0x00700247, VR::US, "ShadowColorCIELabValue" },
-  { 0x00700248, VR::CS, "Underlined" },
-  { 0x00700249, VR::CS, "Bold" },
-  { 0x00700250, VR::CS, "Italic" },
-  { 0x00700251, VR::US, "PatternOnColorCIELabValue" },
-  { 0x00700252, VR::US, "PatternOffColorCIELabValue" },
-  { 0x00700253, VR::FL, "LineThickness" },
-  { 0x00700254, VR::CS, "LineDashingStyle" },
-  { 0x00700255, VR::UL, "LinePattern" },
-  { 0x00700256, VR::OB, "FillPattern" },
-  { 0x00700257, VR::CS, "FillMode" },
-  { 0x00700258, VR::FL, "ShadowOpacity" },
-  { 0x00700261, VR::FL, "GapLength" },
-  { 0x00700262, VR::FL, "DiameterOfVisibility" },
-  { 0x00700273, VR::FL, "RotationPoint" },
-  { 0x00700274, VR::CS, "TickAlignment" },
-  { 0x00700278, VR::CS, "ShowTickLabel" },
-  { 0x00700279, VR::CS, "TickLabelAlignment" },
-  { 0x00700282, VR::CS, "CompoundGraphicUnits" },
-  { 0x00700284, VR::FL, "PatternOnOpacity" },
-  { 0x00700285, VR::FL, "PatternOffOpacity" },
-  { 0x00700287, VR::SQ, "MajorTicksSequence" },
-  { 0x00700288, VR::FL, "TickPosition" },
-  { 0x00700289, VR::SH, "TickLabel" },
-  { 0x00700294, VR::CS, "CompoundGraphicType" },
-  { 0x00700295, VR::UL, "GraphicGroupID" },
-  { 0x00700306, VR::CS, "ShapeType" },
-  { 0x00700308, VR::SQ, "RegistrationSequence" },
-  { 0x00700309, VR::SQ, "MatrixRegistrationSequence" },
-  { 0x0070030A, VR::SQ, "MatrixSequence" },
-  { 0x0070030B, VR::FD, "FrameOfReferenceToDisplayedCoordinateSystemTransformationMatrix" },
-  { 0x0070030C, VR::CS, "FrameOfReferenceTransformationMatrixType" },
-  { 0x0070030D, VR::SQ, "RegistrationTypeCodeSequence" },
-  { 0x0070030F, VR::ST, "FiducialDescription" },
-  { 0x00700310, VR::SH, "FiducialIdentifier" },
-  { 0x00700311, VR::SQ, "FiducialIdentifierCodeSequence" },
-  { 0x00700312, VR::FD, "ContourUncertaintyRadius" },
-  { 0x00700314, VR::SQ, "UsedFiducialsSequence" },
-  { 0x00700318, VR::SQ, "GraphicCoordinatesDataSequence" },
-  { 0x0070031A, VR::UI, "FiducialUID" },
-  { 0x0070031C, VR::SQ, "FiducialSetSequence" },
-  { 0x0070031E, VR::SQ, "FiducialSequence" },
-  { 0x00700401, VR::US, "GraphicLayerRecommendedDisplayCIELabValue" },
-  { 0x00700402, VR::SQ, "BlendingSequence" },
-  { 0x00700403, VR::FL, "RelativeOpacity" },
-  { 0x00700404, VR::SQ, "ReferencedSpatialRegistrationSequence" },
-  { 0x00700405, VR::CS, "BlendingPosition" },
-  { 0x00701101, VR::UI, "PresentationDisplayCollectionUID" },
-  { 0x00701102, VR::UI, "PresentationSequenceCollectionUID" },
-  { 0x00701103, VR::US, "PresentationSequencePositionIndex" },
-  { 0x00701104, VR::SQ, "RenderedImageReferenceSequence" },
-  { 0x00701201, VR::SQ, "VolumetricPresentationStateInputSequence" },
-  { 0x00701202, VR::CS, "PresentationInputType" },
-  { 0x00701203, VR::US, "InputSequencePositionIndex" },
-  { 0x00701204, VR::CS, "Crop" },
-  { 0x00701205, VR::US, "CroppingSpecificationIndex" },
-  { 0x00701206, VR::CS, "CompositingMethod" },
-  { 0x00701207, VR::US, "VolumetricPresentationInputNumber" },
-  { 0x00701208, VR::CS, "ImageVolumeGeometry" },
-  { 0x00701301, VR::SQ, "VolumeCroppingSequence" },
-  { 0x00701302, VR::CS, "VolumeCroppingMethod" },
-  { 0x00701303, VR::FD, "BoundingBoxCrop" },
-  { 0x00701304, VR::SQ, "ObliqueCroppingPlaneSequence" },
-  { 0x00701305, VR::FD, "Plane" },
-  { 0x00701306, VR::FD, "PlaneNormal" },
-  { 0x00701309, VR::US, "CroppingSpecificationNumber" },
-  { 0x00701501, VR::CS, "MultiPlanarReconstructionStyle" },
-  { 0x00701502, VR::CS, "MPRThicknessType" },
-  { 0x00701503, VR::FD, "MPRSlabThickness" },
-  { 0x00701505, VR::FD, "MPRTopLeftHandCorner" },
-  { 0x00701507, VR::FD, "MPRViewWidthDirection" },
-  { 0x00701508, VR::FD, "MPRViewWidth" },
-  { 0x0070150C, VR::UL, "NumberOfVolumetricCurvePoints" },
-  { 0x0070150D, VR::OD, "VolumetricCurvePoints" },
-  { 0x00701511, VR::FD, "MPRViewHeightDirection" },
-  { 0x00701512, VR::FD, "MPRViewHeight" },
-  { 0x00701801, VR::SQ, "PresentationStateClassificationComponentSequence" },
-  { 0x00701802, VR::CS, "ComponentType" },
-  { 0x00701803, VR::SQ, "ComponentInputSequence" },
-  { 0x00701804, VR::US, "VolumetricPresentationInputIndex" },
-  { 0x00701805, VR::SQ, "PresentationStateCompositorComponentSequence" },
-  { 0x00701806, VR::SQ, "WeightingTransferFunctionSequence" },
-  { 0x00701807, VR::US, "WeightingLookupTableDescriptor" },
-  { 0x00701808, VR::OB, "WeightingLookupTableData" },
-  { 0x00701901, VR::SQ, "VolumetricAnnotationSequence" },
-  { 0x00701903, VR::SQ, "ReferencedStructuredContextSequence" },
-  { 0x00701904, VR::UI, "ReferencedContentItem" },
-  { 0x00701905, VR::SQ, "VolumetricPresentationInputAnnotationSequence" },
-  { 0x00701907, VR::CS, "AnnotationClipping" },
-  { 0x00701A01, VR::CS, "PresentationAnimationStyle" },
-  { 0x00701A03, VR::FD, "RecommendedAnimationRate" },
-  { 0x00701A04, VR::SQ, "AnimationCurveSequence" },
-  { 0x00701A05, VR::FD, "AnimationStepSize" },
-  { 0x00720002, VR::SH, "HangingProtocolName" },
-  { 0x00720004, VR::LO, "HangingProtocolDescription" },
-  { 0x00720006, VR::CS, "HangingProtocolLevel" },
-  { 0x00720008, VR::LO, "HangingProtocolCreator" },
-  { 0x0072000A, VR::DT, "HangingProtocolCreationDateTime" },
-  { 0x0072000C, VR::SQ, "HangingProtocolDefinitionSequence" },
-  { 0x0072000E, VR::SQ, "HangingProtocolUserIdentificationCodeSequence" },
-  { 0x00720010, VR::LO, "HangingProtocolUserGroupName" },
-  { 0x00720012, VR::SQ, "SourceHangingProtocolSequence" },
-  { 0x00720014, VR::US, "NumberOfPriorsReferenced" },
-  { 0x00720020, VR::SQ, "ImageSetsSequence" },
-  { 0x00720022, VR::SQ, "ImageSetSelectorSequence" },
-  { 0x00720024, VR::CS, "ImageSetSelectorUsageFlag" },
-  { 0x00720026, VR::AT, "SelectorAttribute" },
-  { 0x00720028, VR::US, "SelectorValueNumber" },
-  { 0x00720030, VR::SQ, "TimeBasedImageSetsSequence" },
-  { 0x00720032, VR::US, "ImageSetNumber" },
-  { 0x00720034, VR::CS, "ImageSetSelectorCategory" },
-  { 0x00720038, VR::US, "RelativeTime" },
-  { 0x0072003A, VR::CS, "RelativeTimeUnits" },
-  { 0x0072003C, VR::SS, "AbstractPriorValue" },
-  { 0x0072003E, VR::SQ, "AbstractPriorCodeSequence" },
-  { 0x00720040, VR::LO, "ImageSetLabel" },
-  { 0x00720050, VR::CS, "SelectorAttributeVR" },
-  { 0x00720052, VR::AT, "SelectorSequencePointer" },
-  { 0x00720054, VR::LO, "SelectorSequencePointerPrivateCreator" },
-  { 0x00720056, VR::LO, "SelectorAttributePrivateCreator" },
-  { 0x00720060, VR::AT, "SelectorATValue" },
-  { 0x00720062, VR::CS, "SelectorCSValue" },
-  { 0x00720064, VR::IS, "SelectorISValue" },
-  { 0x00720066, VR::LO, "SelectorLOValue" },
-  { 0x00720068, VR::LT, "SelectorLTValue" },
-  { 0x0072006A, VR::PN, "SelectorPNValue" },
-  { 0x0072006C, VR::SH, "SelectorSHValue" },
-  { 0x0072006E, VR::ST, "SelectorSTValue" },
-  { 0x00720070, VR::UT, "SelectorUTValue" },
-  { 0x00720072, VR::DS, "SelectorDSValue" },
-  { 0x00720074, VR::FD, "SelectorFDValue" },
-  { 0x00720076, VR::FL, "SelectorFLValue" },
-  { 0x00720078, VR::UL, "SelectorULValue" },
-  { 0x0072007A, VR::US, "SelectorUSValue" },
-  { 0x0072007C, VR::SL, "SelectorSLValue" },
-  { 0x0072007E, VR::SS, "SelectorSSValue" },
-  { 0x0072007F, VR::UI, "SelectorUIValue" },
-  { 0x00720080, VR::SQ, "SelectorCodeSequenceValue" },
-  { 0x00720100, VR::US, "NumberOfScreens" },
-  { 0x00720102, VR::SQ, "NominalScreenDefinitionSequence" },
-  { 0x00720104, VR::US, "NumberOfVerticalPixels" },
-  { 0x00720106, VR::US, "NumberOfHorizontalPixels" },
-  { 0x00720108, VR::FD, "DisplayEnvironmentSpatialPosition" },
-  { 0x0072010A, VR::US, "ScreenMinimumGrayscaleBitDepth" },
-  { 0x0072010C, VR::US, "ScreenMinimumColorBitDepth" },
-  { 0x0072010E, VR::US, "ApplicationMaximumRepaintTime" },
-  { 0x00720200, VR::SQ, "DisplaySetsSequence" },
-  { 0x00720202, VR::US, "DisplaySetNumber" },
-  { 0x00720203, VR::LO, "DisplaySetLabel" },
-  { 0x00720204, VR::US, "DisplaySetPresentationGroup" },
-  { 0x00720206, VR::LO, "DisplaySetPresentationGroupDescription" },
-  { 0x00720208, VR::CS, "PartialDataDisplayHandling" },
-  { 0x00720210, VR::SQ, "SynchronizedScrollingSequence" },
-  { 0x00720212, VR::US, "DisplaySetScrollingGroup" },
-  { 0x00720214, VR::SQ, "NavigationIndicatorSequence" },
-  { 0x00720216, VR::US, "NavigationDisplaySet" },
-  { 0x00720218, VR::US, "ReferenceDisplaySets" },
-  { 0x00720300, VR::SQ, "ImageBoxesSequence" },
-  { 0x00720302, VR::US, "ImageBoxNumber" },
-  { 0x00720304, VR::CS, "ImageBoxLayoutType" },
-  { 0x00720306, VR::US, "ImageBoxTileHorizontalDimension" },
-  { 0x00720308, VR::US, "ImageBoxTileVerticalDimension" },
-  { 0x00720310, VR::CS, "ImageBoxScrollDirection" },
-  { 0x00720312, VR::CS, "ImageBoxSmallScrollType" },
-  { 0x00720314, VR::US, "ImageBoxSmallScrollAmount" },
-  { 0x00720316, VR::CS, "ImageBoxLargeScrollType" },
-  { 0x00720318, VR::US, "ImageBoxLargeScrollAmount" },
-  { 0x00720320, VR::US, "ImageBoxOverlapPriority" },
-  { 0x00720330, VR::FD, "CineRelativeToRealTime" },
-  { 0x00720400, VR::SQ, "FilterOperationsSequence" },
-  { 0x00720402, VR::CS, "FilterByCategory" },
-  { 0x00720404, VR::CS, "FilterByAttributePresence" },
-  { 0x00720406, VR::CS, "FilterByOperator" },
-  { 0x00720420, VR::US, "StructuredDisplayBackgroundCIELabValue" },
-  { 0x00720421, VR::US, "EmptyImageBoxCIELabValue" },
-  { 0x00720422, VR::SQ, "StructuredDisplayImageBoxSequence" },
-  { 0x00720424, VR::SQ, "StructuredDisplayTextBoxSequence" },
-  { 0x00720427, VR::SQ, "ReferencedFirstFrameSequence" },
-  { 0x00720430, VR::SQ, "ImageBoxSynchronizationSequence" },
-  { 0x00720432, VR::US, "SynchronizedImageBoxList" },
-  { 0x00720434, VR::CS, "TypeOfSynchronization" },
-  { 0x00720500, VR::CS, "BlendingOperationType" },
-  { 0x00720510, VR::CS, "ReformattingOperationType" },
-  { 0x00720512, VR::FD, "ReformattingThickness" },
-  { 0x00720514, VR::FD, "ReformattingInterval" },
-  { 0x00720516, VR::CS, "ReformattingOperationInitialViewDirection" },
-  { 0x00720520, VR::CS, "ThreeDRenderingType" },
-  { 0x00720600, VR::SQ, "SortingOperationsSequence" },
-  { 0x00720602, VR::CS, "SortByCategory" },
-  { 0x00720604, VR::CS, "SortingDirection" },
-  { 0x00720700, VR::CS, "DisplaySetPatientOrientation" },
-  { 0x00720702, VR::CS, "VOIType" },
-  { 0x00720704, VR::CS, "PseudoColorType" },
-  { 0x00720705, VR::SQ, "PseudoColorPaletteInstanceReferenceSequence" },
-  { 0x00720706, VR::CS, "ShowGrayscaleInverted" },
-  { 0x00720710, VR::CS, "ShowImageTrueSizeFlag" },
-  { 0x00720712, VR::CS, "ShowGraphicAnnotationFlag" },
-  { 0x00720714, VR::CS, "ShowPatientDemographicsFlag" },
-  { 0x00720716, VR::CS, "ShowAcquisitionTechniquesFlag" },
-  { 0x00720717, VR::CS, "DisplaySetHorizontalJustification" },
-  { 0x00720718, VR::CS, "DisplaySetVerticalJustification" },
-  { 0x00740120, VR::FD, "ContinuationStartMeterset" },
-  { 0x00740121, VR::FD, "ContinuationEndMeterset" },
-  { 0x00741000, VR::CS, "ProcedureStepState" },
-  { 0x00741002, VR::SQ, "ProcedureStepProgressInformationSequence" },
-  { 0x00741004, VR::DS, "ProcedureStepProgress" },
-  { 0x00741006, VR::ST, "ProcedureStepProgressDescription" },
-  { 0x00741008, VR::SQ, "ProcedureStepCommunicationsURISequence" },
-  { 0x0074100A, VR::UR, "ContactURI" },
-  { 0x0074100C, VR::LO, "ContactDisplayName" },
-  { 0x0074100E, VR::SQ, "ProcedureStepDiscontinuationReasonCodeSequence" },
-  { 0x00741020, VR::SQ, "BeamTaskSequence" },
-  { 0x00741022, VR::CS, "BeamTaskType" },
-  { 0x00741025, VR::CS, "AutosequenceFlag" },
-  { 0x00741026, VR::FD, "TableTopVerticalAdjustedPosition" },
-  { 0x00741027, VR::FD, "TableTopLongitudinalAdjustedPosition" },
-  { 0x00741028, VR::FD, "TableTopLateralAdjustedPosition" },
-  { 0x0074102A, VR::FD, "PatientSupportAdjustedAngle" },
-  { 0x0074102B, VR::FD, "TableTopEccentricAdjustedAngle" },
-  { 0x0074102C, VR::FD, "TableTopPitchAdjustedAngle" },
-  { 0x0074102D, VR::FD, "TableTopRollAdjustedAngle" },
-  { 0x00741030, VR::SQ, "DeliveryVerificationImageSequence" },
-  { 0x00741032, VR::CS, "VerificationImageTiming" },
-  { 0x00741034, VR::CS, "DoubleExposureFlag" },
-  { 0x00741036, VR::CS, "DoubleExposureOrdering" },
-  { 0x00741040, VR::SQ, "RelatedReferenceRTImageSequence" },
-  { 0x00741042, VR::SQ, "GeneralMachineVerificationSequence" },
-  { 0x00741044, VR::SQ, "ConventionalMachineVerificationSequence" },
-  { 0x00741046, VR::SQ, "IonMachineVerificationSequence" },
-  { 0x00741048, VR::SQ, "FailedAttributesSequence" },
-  { 0x0074104A, VR::SQ, "OverriddenAttributesSequence" },
-  { 0x0074104C, VR::SQ, "ConventionalControlPointVerificationSequence" },
-  { 0x0074104E, VR::SQ, "IonControlPointVerificationSequence" },
-  { 0x00741050, VR::SQ, "AttributeOccurrenceSequence" },
-  { 0x00741052, VR::AT, "AttributeOccurrencePointer" },
-  { 0x00741054, VR::UL, "AttributeItemSelector" },
-  { 0x00741056, VR::LO, "AttributeOccurrencePrivateCreator" },
-  { 0x00741057, VR::IS, "SelectorSequencePointerItems" },
-  { 0x00741200, VR::CS, "ScheduledProcedureStepPriority" },
-  { 0x00741202, VR::LO, "WorklistLabel" },
-  { 0x00741204, VR::LO, "ProcedureStepLabel" },
-  { 0x00741210, VR::SQ, "ScheduledProcessingParametersSequence" },
-  { 0x00741212, VR::SQ, "PerformedProcessingParametersSequence" },
-  { 0x00741216, VR::SQ, "UnifiedProcedureStepPerformedProcedureSequence" },
-  { 0x00741224, VR::SQ, "ReplacedProcedureStepSequence" },
-  { 0x00741230, VR::LO, "DeletionLock" },
-  { 0x00741234, VR::AE, "ReceivingAE" },
-  { 0x00741236, VR::AE, "RequestingAE" },
-  { 0x00741238, VR::LT, "ReasonForCancellation" },
-  { 0x00741242, VR::CS, "SCPStatus" },
-  { 0x00741244, VR::CS, "SubscriptionListStatus" },
-  { 0x00741246, VR::CS, "UnifiedProcedureStepListStatus" },
-  { 0x00741324, VR::UL, "BeamOrderIndex" },
-  { 0x00741338, VR::FD, "DoubleExposureMeterset" },
-  { 0x0074133A, VR::FD, "DoubleExposureFieldDelta" },
-  { 0x00741401, VR::SQ, "BrachyTaskSequence" },
-  { 0x00741402, VR::DS, "ContinuationStartTotalReferenceAirKerma" },
-  { 0x00741403, VR::DS, "ContinuationEndTotalReferenceAirKerma" },
-  { 0x00741404, VR::IS, "ContinuationPulseNumber" },
-  { 0x00741405, VR::SQ, "ChannelDeliveryOrderSequence" },
-  { 0x00741406, VR::IS, "ReferencedChannelNumber" },
-  { 0x00741407, VR::DS, "StartCumulativeTimeWeight" },
-  { 0x00741408, VR::DS, "EndCumulativeTimeWeight" },
-  { 0x00741409, VR::SQ, "OmittedChannelSequence" },
-  { 0x0074140A, VR::CS, "ReasonForChannelOmission" },
-  { 0x0074140B, VR::LO, "ReasonForChannelOmissionDescription" },
-  { 0x0074140C, VR::IS, "ChannelDeliveryOrderIndex" },
-  { 0x0074140D, VR::SQ, "ChannelDeliveryContinuationSequence" },
-  { 0x0074140E, VR::SQ, "OmittedApplicationSetupSequence" },
-  { 0x00760001, VR::LO, "ImplantAssemblyTemplateName" },
-  { 0x00760003, VR::LO, "ImplantAssemblyTemplateIssuer" },
-  { 0x00760006, VR::LO, "ImplantAssemblyTemplateVersion" },
-  { 0x00760008, VR::SQ, "ReplacedImplantAssemblyTemplateSequence" },
-  { 0x0076000A, VR::CS, "ImplantAssemblyTemplateType" },
-  { 0x0076000C, VR::SQ, "OriginalImplantAssemblyTemplateSequence" },
-  { 0x0076000E, VR::SQ, "DerivationImplantAssemblyTemplateSequence" },
-  { 0x00760010, VR::SQ, "ImplantAssemblyTemplateTargetAnatomySequence" },
-  { 0x00760020, VR::SQ, "ProcedureTypeCodeSequence" },
-  { 0x00760030, VR::LO, "SurgicalTechnique" },
-  { 0x00760032, VR::SQ, "ComponentTypesSequence" },
-  { 0x00760034, VR::CS, "ComponentTypeCodeSequence" },
-  { 0x00760036, VR::CS, "ExclusiveComponentType" },
-  { 0x00760038, VR::CS, "MandatoryComponentType" },
-  { 0x00760040, VR::SQ, "ComponentSequence" },
-  { 0x00760055, VR::US, "ComponentID" },
-  { 0x00760060, VR::SQ, "ComponentAssemblySequence" },
-  { 0x00760070, VR::US, "Component1ReferencedID" },
-  { 0x00760080, VR::US, "Component1ReferencedMatingFeatureSetID" },
-  { 0x00760090, VR::US, "Component1ReferencedMatingFeatureID" },
-  { 0x007600A0, VR::US, "Component2ReferencedID" },
-  { 0x007600B0, VR::US, "Component2ReferencedMatingFeatureSetID" },
-  { 0x007600C0, VR::US, "Component2ReferencedMatingFeatureID" },
-  { 0x00780001, VR::LO, "ImplantTemplateGroupName" },
-  { 0x00780010, VR::ST, "ImplantTemplateGroupDescription" },
-  { 0x00780020, VR::LO, "ImplantTemplateGroupIssuer" },
-  { 0x00780024, VR::LO, "ImplantTemplateGroupVersion" },
-  { 0x00780026, VR::SQ, "ReplacedImplantTemplateGroupSequence" },
-  { 0x00780028, VR::SQ, "ImplantTemplateGroupTargetAnatomySequence" },
-  { 0x0078002A, VR::SQ, "ImplantTemplateGroupMembersSequence" },
-  { 0x0078002E, VR::US, "ImplantTemplateGroupMemberID" },
-  { 0x00780050, VR::FD, "ThreeDImplantTemplateGroupMemberMatchingPoint" },
-  { 0x00780060, VR::FD, "ThreeDImplantTemplateGroupMemberMatchingAxes" },
-  { 0x00780070, VR::SQ, "ImplantTemplateGroupMemberMatching2DCoordinatesSequence" },
-  { 0x00780090, VR::FD, "TwoDImplantTemplateGroupMemberMatchingPoint" },
-  { 0x007800A0, VR::FD, "TwoDImplantTemplateGroupMemberMatchingAxes" },
-  { 0x007800B0, VR::SQ, "ImplantTemplateGroupVariationDimensionSequence" },
-  { 0x007800B2, VR::LO, "ImplantTemplateGroupVariationDimensionName" },
-  { 0x007800B4, VR::SQ, "ImplantTemplateGroupVariationDimensionRankSequence" },
-  { 0x007800B6, VR::US, "ReferencedImplantTemplateGroupMemberID" },
-  { 0x007800B8, VR::US, "ImplantTemplateGroupVariationDimensionRank" },
-  { 0x00800001, VR::SQ, "SurfaceScanAcquisitionTypeCodeSequence" },
-  { 0x00800002, VR::SQ, "SurfaceScanModeCodeSequence" },
-  { 0x00800003, VR::SQ, "RegistrationMethodCodeSequence" },
-  { 0x00800004, VR::FD, "ShotDurationTime" },
-  { 0x00800005, VR::FD, "ShotOffsetTime" },
-  { 0x00800006, VR::US, "SurfacePointPresentationValueData" },
-  { 0x00800007, VR::US, "SurfacePointColorCIELabValueData" },
-  { 0x00800008, VR::SQ, "UVMappingSequence" },
-  { 0x00800009, VR::SH, "TextureLabel" },
-  { 0x00800010, VR::OF, "UValueData" },
-  { 0x00800011, VR::OF, "VValueData" },
-  { 0x00800012, VR::SQ, "ReferencedTextureSequence" },
-  { 0x00800013, VR::SQ, "ReferencedSurfaceDataSequence" },
-  { 0x00880130, VR::SH, "StorageMediaFileSetID" },
-  { 0x00880140, VR::UI, "StorageMediaFileSetUID" },
-  { 0x00880200, VR::SQ, "IconImageSequence" },
-  { 0x01000410, VR::CS, "SOPInstanceStatus" },
-  { 0x01000420, VR::DT, "SOPAuthorizationDateTime" },
-  { 0x01000424, VR::LT, "SOPAuthorizationComment" },
-  { 0x01000426, VR::LO, "AuthorizationEquipmentCertificationNumber" },
-  { 0x04000005, VR::US, "MACIDNumber" },
-  { 0x04000010, VR::UI, "MACCalculationTransferSyntaxUID" },
-  { 0x04000015, VR::CS, "MACAlgorithm" },
-  { 0x04000020, VR::AT, "DataElementsSigned" },
-  { 0x04000100, VR::UI, "DigitalSignatureUID" },
-  { 0x04000105, VR::DT, "DigitalSignatureDateTime" },
-  { 0x04000110, VR::CS, "CertificateType" },
-  { 0x04000115, VR::OB, "CertificateOfSigner" },
-  { 0x04000120, VR::OB, "Signature" },
-  { 0x04000305, VR::CS, "CertifiedTimestampType" },
-  { 0x04000310, VR::OB, "CertifiedTimestamp" },
-  { 0x04000401, VR::SQ, "DigitalSignaturePurposeCodeSequence" },
-  { 0x04000402, VR::SQ, "ReferencedDigitalSignatureSequence" },
-  { 0x04000403, VR::SQ, "ReferencedSOPInstanceMACSequence" },
-  { 0x04000404, VR::OB, "MAC" },
-  { 0x04000500, VR::SQ, "EncryptedAttributesSequence" },
-  { 0x04000510, VR::UI, "EncryptedContentTransferSyntaxUID" },
-  { 0x04000520, VR::OB, "EncryptedContent" },
-  { 0x04000550, VR::SQ, "ModifiedAttributesSequence" },
-  { 0x04000561, VR::SQ, "OriginalAttributesSequence" },
-  { 0x04000562, VR::DT, "AttributeModificationDateTime" },
-  { 0x04000563, VR::LO, "ModifyingSystem" },
-  { 0x04000564, VR::LO, "SourceOfPreviousValues" },
-  { 0x04000565, VR::CS, "ReasonForTheAttributeModification" },
-  { 0x20000010, VR::IS, "NumberOfCopies" },
-  { 0x2000001E, VR::SQ, "PrinterConfigurationSequence" },
-  { 0x20000020, VR::CS, "PrintPriority" },
-  { 0x20000030, VR::CS, "MediumType" },
-  { 0x20000040, VR::CS, "FilmDestination" },
-  { 0x20000050, VR::LO, "FilmSessionLabel" },
-  { 0x20000060, VR::IS, "MemoryAllocation" },
-  { 0x20000061, VR::IS, "MaximumMemoryAllocation" },
-  { 0x200000A0, VR::US, "MemoryBitDepth" },
-  { 0x200000A1, VR::US, "PrintingBitDepth" },
-  { 0x200000A2, VR::SQ, "MediaInstalledSequence" },
-  { 0x200000A4, VR::SQ, "OtherMediaAvailableSequence" },
-  { 0x200000A8, VR::SQ, "SupportedImageDisplayFormatsSequence" },
-  { 0x20000500, VR::SQ, "ReferencedFilmBoxSequence" },
-  { 0x20100010, VR::ST, "ImageDisplayFormat" },
-  { 0x20100030, VR::CS, "AnnotationDisplayFormatID" },
-  { 0x20100040, VR::CS, "FilmOrientation" },
-  { 0x20100050, VR::CS, "FilmSizeID" },
-  { 0x20100052, VR::CS, "PrinterResolutionID" },
-  { 0x20100054, VR::CS, "DefaultPrinterResolutionID" },
-  { 0x20100060, VR::CS, "MagnificationType" },
-  { 0x20100080, VR::CS, "SmoothingType" },
-  { 0x201000A6, VR::CS, "DefaultMagnificationType" },
-  { 0x201000A7, VR::CS, "OtherMagnificationTypesAvailable" },
-  { 0x201000A8, VR::CS, "DefaultSmoothingType" },
-  { 0x201000A9, VR::CS, "OtherSmoothingTypesAvailable" },
-  { 0x20100100, VR::CS, "BorderDensity" },
-  { 0x20100110, VR::CS, "EmptyImageDensity" },
-  { 0x20100120, VR::US, "MinDensity" },
-  { 0x20100130, VR::US, "MaxDensity" },
-  { 0x20100140, VR::CS, "Trim" },
-  { 0x20100150, VR::ST, "ConfigurationInformation" },
-  { 0x20100152, VR::LT, "ConfigurationInformationDescription" },
-  { 0x20100154, VR::IS, "MaximumCollatedFilms" },
-  { 0x2010015E, VR::US, "Illumination" },
-  { 0x20100160, VR::US, "ReflectedAmbientLight" },
-  { 0x20100376, VR::DS, "PrinterPixelSpacing" },
-  { 0x20100500, VR::SQ, "ReferencedFilmSessionSequence" },
-  { 0x20100510, VR::SQ, "ReferencedImageBoxSequence" },
-  { 0x20100520, VR::SQ, "ReferencedBasicAnnotationBoxSequence" },
-  { 0x20200010, VR::US, "ImageBoxPosition" },
-  { 0x20200020, VR::CS, "Polarity" },
-  { 0x20200030, VR::DS, "RequestedImageSize" },
-  { 0x20200040, VR::CS, "RequestedDecimateCropBehavior" },
-  { 0x20200050, VR::CS, "RequestedResolutionID" },
-  { 0x202000A0, VR::CS, "RequestedImageSizeFlag" },
-  { 0x202000A2, VR::CS, "DecimateCropResult" },
-  { 0x20200110, VR::SQ, "BasicGrayscaleImageSequence" },
-  { 0x20200111, VR::SQ, "BasicColorImageSequence" },
-  { 0x20300010, VR::US, "AnnotationPosition" },
-  { 0x20300020, VR::LO, "TextString" },
-  { 0x20500010, VR::SQ, "PresentationLUTSequence" },
-  { 0x20500020, VR::CS, "PresentationLUTShape" },
-  { 0x20500500, VR::SQ, "ReferencedPresentationLUTSequence" },
-  { 0x21000020, VR::CS, "ExecutionStatus" },
-  { 0x21000030, VR::CS, "ExecutionStatusInfo" },
-  { 0x21000040, VR::DA, "CreationDate" },
-  { 0x21000050, VR::TM, "CreationTime" },
-  { 0x21000070, VR::AE, "Originator" },
-  { 0x21000140, VR::AE, "DestinationAE" },
-  { 0x21000160, VR::SH, "OwnerID" },
-  { 0x21000170, VR::IS, "NumberOfFilms" },
-  { 0x21100010, VR::CS, "PrinterStatus" },
-  { 0x21100020, VR::CS, "PrinterStatusInfo" },
-  { 0x21100030, VR::LO, "PrinterName" },
-  { 0x22000001, VR::CS, "LabelUsingInformationExtractedFromInstances" },
-  { 0x22000002, VR::UT, "LabelText" },
-  { 0x22000003, VR::CS, "LabelStyleSelection" },
-  { 0x22000004, VR::LT, "MediaDisposition" },
-  { 0x22000005, VR::LT, "BarcodeValue" },
-  { 0x22000006, VR::CS, "BarcodeSymbology" },
-  { 0x22000007, VR::CS, "AllowMediaSplitting" },
-  { 0x22000008, VR::CS, "IncludeNonDICOMObjects" },
-  { 0x22000009, VR::CS, "IncludeDisplayApplication" },
-  { 0x2200000A, VR::CS, "PreserveCompositeInstancesAfterMediaCreation" },
-  { 0x2200000B, VR::US, "TotalNumberOfPiecesOfMediaCreated" },
-  { 0x2200000C, VR::LO, "RequestedMediaApplicationProfile" },
-  { 0x2200000D, VR::SQ, "ReferencedStorageMediaSequence" },
-  { 0x2200000E, VR::AT, "FailureAttributes" },
-  { 0x2200000F, VR::CS, "AllowLossyCompression" },
-  { 0x22000020, VR::CS, "RequestPriority" },
-  { 0x30020002, VR::SH, "RTImageLabel" },
-  { 0x30020003, VR::LO, "RTImageName" },
-  { 0x30020004, VR::ST, "RTImageDescription" },
-  { 0x3002000A, VR::CS, "ReportedValuesOrigin" },
-  { 0x3002000C, VR::CS, "RTImagePlane" },
-  { 0x3002000D, VR::DS, "XRayImageReceptorTranslation" },
-  { 0x3002000E, VR::DS, "XRayImageReceptorAngle" },
-  { 0x30020010, VR::DS, "RTImageOrientation" },
-  { 0x30020011, VR::DS, "ImagePlanePixelSpacing" },
-  { 0x30020012, VR::DS, "RTImagePosition" },
-  { 0x30020020, VR::SH, "RadiationMachineName" },
-  { 0x30020022, VR::DS, "RadiationMachineSAD" },
-  { 0x30020024, VR::DS, "RadiationMachineSSD" },
-  { 0x30020026, VR::DS, "RTImageSID" },
-  { 0x30020028, VR::DS, "SourceToReferenceObjectDistance" },
-  { 0x30020029, VR::IS, "FractionNumber" },
-  { 0x30020030, VR::SQ, "ExposureSequence" },
-  { 0x30020032, VR::DS, "MetersetExposure" },
-  { 0x30020034, VR::DS, "DiaphragmPosition" },
-  { 0x30020040, VR::SQ, "FluenceMapSequence" },
-  { 0x30020041, VR::CS, "FluenceDataSource" },
-  { 0x30020042, VR::DS, "FluenceDataScale" },
-  { 0x30020050, VR::SQ, "PrimaryFluenceModeSequence" },
-  { 0x30020051, VR::CS, "FluenceMode" },
-  { 0x30020052, VR::SH, "FluenceModeID" },
-  { 0x30040001, VR::CS, "DVHType" },
-  { 0x30040002, VR::CS, "DoseUnits" },
-  { 0x30040004, VR::CS, "DoseType" },
-  { 0x30040005, VR::CS, "SpatialTransformOfDose" },
-  { 0x30040006, VR::LO, "DoseComment" },
-  { 0x30040008, VR::DS, "NormalizationPoint" },
-  { 0x3004000A, VR::CS, "DoseSummationType" },
-  { 0x3004000C, VR::DS, "GridFrameOffsetVector" },
-  { 0x3004000E, VR::DS, "DoseGridScaling" },
-  { 0x30040010, VR::SQ, "RTDoseROISequence" },
-  { 0x30040012, VR::DS, "DoseValue" },
-  { 0x30040014, VR::CS, "TissueHeterogeneityCorrection" },
-  { 0x30040040, VR::DS, "DVHNormalizationPoint" },
-  { 0x30040042, VR::DS, "DVHNormalizationDoseValue" },
-  { 0x30040050, VR::SQ, "DVHSequence" },
-  { 0x30040052, VR::DS, "DVHDoseScaling" },
-  { 0x30040054, VR::CS, "DVHVolumeUnits" },
-  { 0x30040056, VR::IS, "DVHNumberOfBins" },
-  { 0x30040058, VR::DS, "DVHData" },
-  { 0x30040060, VR::SQ, "DVHReferencedROISequence" },
-  { 0x30040062, VR::CS, "DVHROIContributionType" },
-  { 0x30040070, VR::DS, "DVHMinimumDose" },
-  { 0x30040072, VR::DS, "DVHMaximumDose" },
-  { 0x30040074, VR::DS, "DVHMeanDose" },
-  { 0x30060002, VR::SH, "StructureSetLabel" },
-  { 0x30060004, VR::LO, "StructureSetName" },
-  { 0x30060006, VR::ST, "StructureSetDescription" },
-  { 0x30060008, VR::DA, "StructureSetDate" },
-  { 0x30060009, VR::TM, "StructureSetTime" },
-  { 0x30060010, VR::SQ, "ReferencedFrameOfReferenceSequence" },
-  { 0x30060012, VR::SQ, "RTReferencedStudySequence" },
-  { 0x30060014, VR::SQ, "RTReferencedSeriesSequence" },
-  { 0x30060016, VR::SQ, "ContourImageSequence" },
-  { 0x30060018, VR::SQ, "PredecessorStructureSetSequence" },
-  { 0x30060020, VR::SQ, "StructureSetROISequence" },
-  { 0x30060022, VR::IS, "ROINumber" },
-  { 0x30060024, VR::UI, "ReferencedFrameOfReferenceUID" },
-  { 0x30060026, VR::LO, "ROIName" },
-  { 0x30060028, VR::ST, "ROIDescription" },
-  { 0x3006002A, VR::IS, "ROIDisplayColor" },
-  { 0x3006002C, VR::DS, "ROIVolume" },
-  { 0x30060030, VR::SQ, "RTRelatedROISequence" },
-  { 0x30060033, VR::CS, "RTROIRelationship" },
-  { 0x30060036, VR::CS, "ROIGenerationAlgorithm" },
-  { 0x30060038, VR::LO, "ROIGenerationDescription" },
-  { 0x30060039, VR::SQ, "ROIContourSequence" },
-  { 0x30060040, VR::SQ, "ContourSequence" },
-  { 0x30060042, VR::CS, "ContourGeometricType" },
-  { 0x30060044, VR::DS, "ContourSlabThickness" },
-  { 0x30060045, VR::DS, "ContourOffsetVector" },
-  { 0x30060046, VR::IS, "NumberOfContourPoints" },
-  { 0x30060048, VR::IS, "ContourNumber" },
-  { 0x30060049, VR::IS, "AttachedContours" },
-  { 0x30060050, VR::DS, "ContourData" },
-  { 0x30060080, VR::SQ, "RTROIObservationsSequence" },
-  { 0x30060082, VR::IS, "ObservationNumber" },
-  { 0x30060084, VR::IS, "ReferencedROINumber" },
-  { 0x30060085, VR::SH, "ROIObservationLabel" },
-  { 0x30060086, VR::SQ, "RTROIIdentificationCodeSequence" },
-  { 0x30060088, VR::ST, "ROIObservationDescription" },
-  { 0x300600A0, VR::SQ, "RelatedRTROIObservationsSequence" },
-  { 0x300600A4, VR::CS, "RTROIInterpretedType" },
-  { 0x300600A6, VR::PN, "ROIInterpreter" },
-  { 0x300600B0, VR::SQ, "ROIPhysicalPropertiesSequence" },
-  { 0x300600B2, VR::CS, "ROIPhysicalProperty" },
-  { 0x300600B4, VR::DS, "ROIPhysicalPropertyValue" },
-  { 0x300600B6, VR::SQ, "ROIElementalCompositionSequence" },
-  { 0x300600B7, VR::US, "ROIElementalCompositionAtomicNumber" },
-  { 0x300600B8, VR::FL, "ROIElementalCompositionAtomicMassFraction" },
-  { 0x300600B9, VR::SQ, "AdditionalRTROIIdentificationCodeSequence" },
-  { 0x300600C6, VR::DS, "FrameOfReferenceTransformationMatrix" },
-  { 0x300600C8, VR::LO, "FrameOfReferenceTransformationComment" },
-  { 0x30080010, VR::SQ, "MeasuredDoseReferenceSequence" },
-  { 0x30080012, VR::ST, "MeasuredDoseDescription" },
-  { 0x30080014, VR::CS, "MeasuredDoseType" },
-  { 0x30080016, VR::DS, "MeasuredDoseValue" },
-  { 0x30080020, VR::SQ, "TreatmentSessionBeamSequence" },
-  { 0x30080021, VR::SQ, "TreatmentSessionIonBeamSequence" },
-  { 0x30080022, VR::IS, "CurrentFractionNumber" },
-  { 0x30080024, VR::DA, "TreatmentControlPointDate" },
-  { 0x30080025, VR::TM, "TreatmentControlPointTime" },
-  { 0x3008002A, VR::CS, "TreatmentTerminationStatus" },
-  { 0x3008002B, VR::SH, "TreatmentTerminationCode" },
-  { 0x3008002C, VR::CS, "TreatmentVerificationStatus" },
-  { 0x30080030, VR::SQ, "ReferencedTreatmentRecordSequence" },
-  { 0x30080032, VR::DS, "SpecifiedPrimaryMeterset" },
-  { 0x30080033, VR::DS, "SpecifiedSecondaryMeterset" },
-  { 0x30080036, VR::DS, "DeliveredPrimaryMeterset" },
-  { 0x30080037, VR::DS, "DeliveredSecondaryMeterset" },
-  { 0x3008003A, VR::DS, "SpecifiedTreatmentTime" },
-  { 0x3008003B, VR::DS, "DeliveredTreatmentTime" },
-  { 0x30080040, VR::SQ, "ControlPointDeliverySequence" },
-  { 0x30080041, VR::SQ, "IonControlPointDeliverySequence" },
-  { 0x30080042, VR::DS, "SpecifiedMeterset" },
-  { 0x30080044, VR::DS, "DeliveredMeterset" },
-  { 0x30080045, VR::FL, "MetersetRateSet" },
-  { 0x30080046, VR::FL, "MetersetRateDelivered" },
-  { 0x30080047, VR::FL, "ScanSpotMetersetsDelivered" },
-  { 0x30080048, VR::DS, "DoseRateDelivered" },
-  { 0x30080050, VR::SQ, "TreatmentSummaryCalculatedDoseReferenceSequence" },
-  { 0x30080052, VR::DS, "CumulativeDoseToDoseReference" },
-  { 0x30080054, VR::DA, "FirstTreatmentDate" },
-  { 0x30080056, VR::DA, "MostRecentTreatmentDate" },
-  { 0x3008005A, VR::IS, "NumberOfFractionsDelivered" },
-  { 0x30080060, VR::SQ, "OverrideSequence" },
-  { 0x30080061, VR::AT, "ParameterSequencePointer" },
-  { 0x30080062, VR::AT, "OverrideParameterPointer" },
-  { 0x30080063, VR::IS, "ParameterItemIndex" },
-  { 0x30080064, VR::IS, "MeasuredDoseReferenceNumber" },
-  { 0x30080065, VR::AT, "ParameterPointer" },
-  { 0x30080066, VR::ST, "OverrideReason" },
-  { 0x30080068, VR::SQ, "CorrectedParameterSequence" },
-  { 0x3008006A, VR::FL, "CorrectionValue" },
-  { 0x30080070, VR::SQ, "CalculatedDoseReferenceSequence" },
-  { 0x30080072, VR::IS, "CalculatedDoseReferenceNumber" },
-  { 0x30080074, VR::ST, "CalculatedDoseReferenceDescription" },
-  { 0x30080076, VR::DS, "CalculatedDoseReferenceDoseValue" },
-  { 0x30080078, VR::DS, "StartMeterset" },
-  { 0x3008007A, VR::DS, "EndMeterset" },
-  { 0x30080080, VR::SQ, "ReferencedMeasuredDoseReferenceSequence" },
-  { 0x30080082, VR::IS, "ReferencedMeasuredDoseReferenceNumber" },
-  { 0x30080090, VR::SQ, "ReferencedCalculatedDoseReferenceSequence" },
-  { 0x30080092, VR::IS, "ReferencedCalculatedDoseReferenceNumber" },
-  { 0x300800A0, VR::SQ, "BeamLimitingDeviceLeafPairsSequence" },
-  { 0x300800B0, VR::SQ, "RecordedWedgeSequence" },
-  { 0x300800C0, VR::SQ, "RecordedCompensatorSequence" },
-  { 0x300800D0, VR::SQ, "RecordedBlockSequence" },
-  { 0x300800E0, VR::SQ, "TreatmentSummaryMeasuredDoseReferenceSequence" },
-  { 0x300800F0, VR::SQ, "RecordedSnoutSequence" },
-  { 0x300800F2, VR::SQ, "RecordedRangeShifterSequence" },
-  { 0x300800F4, VR::SQ, "RecordedLateralSpreadingDeviceSequence" },
-  { 0x300800F6, VR::SQ, "RecordedRangeModulatorSequence" },
-  { 0x30080100, VR::SQ, "RecordedSourceSequence" },
-  { 0x30080105, VR::LO, "SourceSerialNumber" },
-  { 0x30080110, VR::SQ, "TreatmentSessionApplicationSetupSequence" },
-  { 0x30080116, VR::CS, "ApplicationSetupCheck" },
-  { 0x30080120, VR::SQ, "RecordedBrachyAccessoryDeviceSequence" },
-  { 0x30080122, VR::IS, "ReferencedBrachyAccessoryDeviceNumber" },
-  { 0x30080130, VR::SQ, "RecordedChannelSequence" },
-  { 0x30080132, VR::DS, "SpecifiedChannelTotalTime" },
-  { 0x30080134, VR::DS, "DeliveredChannelTotalTime" },
-  { 0x30080136, VR::IS, "SpecifiedNumberOfPulses" },
-  { 0x30080138, VR::IS, "DeliveredNumberOfPulses" },
-  { 0x3008013A, VR::DS, "SpecifiedPulseRepetitionInterval" },
-  { 0x3008013C, VR::DS, "DeliveredPulseRepetitionInterval" },
-  { 0x30080140, VR::SQ, "RecordedSourceApplicatorSequence" },
-  { 0x30080142, VR::IS, "ReferencedSourceApplicatorNumber" },
-  { 0x30080150, VR::SQ, "RecordedChannelShieldSequence" },
-  { 0x30080152, VR::IS, "ReferencedChannelShieldNumber" },
-  { 0x30080160, VR::SQ, "BrachyControlPointDeliveredSequence" },
-  { 0x30080162, VR::DA, "SafePositionExitDate" },
-  { 0x30080164, VR::TM, "SafePositionExitTime" },
-  { 0x30080166, VR::DA, "SafePositionReturnDate" },
-  { 0x30080168, VR::TM, "SafePositionReturnTime" },
-  { 0x30080171, VR::SQ, "PulseSpecificBrachyControlPointDeliveredSequence" },
-  { 0x30080172, VR::US, "PulseNumber" },
-  { 0x30080173, VR::SQ, "BrachyPulseControlPointDeliveredSequence" },
-  { 0x30080200, VR::CS, "CurrentTreatmentStatus" },
-  { 0x30080202, VR::ST, "TreatmentStatusComment" },
-  { 0x30080220, VR::SQ, "FractionGroupSummarySequence" },
-  { 0x30080223, VR::IS, "ReferencedFractionNumber" },
-  { 0x30080224, VR::CS, "FractionGroupType" },
-  { 0x30080230, VR::CS, "BeamStopperPosition" },
-  { 0x30080240, VR::SQ, "FractionStatusSummarySequence" },
-  { 0x30080250, VR::DA, "TreatmentDate" },
-  { 0x30080251, VR::TM, "TreatmentTime" },
-  { 0x300A0002, VR::SH, "RTPlanLabel" },
-  { 0x300A0003, VR::LO, "RTPlanName" },
-  { 0x300A0004, VR::ST, "RTPlanDescription" },
-  { 0x300A0006, VR::DA, "RTPlanDate" },
-  { 0x300A0007, VR::TM, "RTPlanTime" },
-  { 0x300A0009, VR::LO, "TreatmentProtocols" },
-  { 0x300A000A, VR::CS, "PlanIntent" },
-  { 0x300A000B, VR::LO, "TreatmentSites" },
-  { 0x300A000C, VR::CS, "RTPlanGeometry" },
-  { 0x300A000E, VR::ST, "PrescriptionDescription" },
-  { 0x300A0010, VR::SQ, "DoseReferenceSequence" },
-  { 0x300A0012, VR::IS, "DoseReferenceNumber" },
-  { 0x300A0013, VR::UI, "DoseReferenceUID" },
-  { 0x300A0014, VR::CS, "DoseReferenceStructureType" },
-  { 0x300A0015, VR::CS, "NominalBeamEnergyUnit" },
-  { 0x300A0016, VR::LO, "DoseReferenceDescription" },
-  { 0x300A0018, VR::DS, "DoseReferencePointCoordinates" },
-  { 0x300A001A, VR::DS, "NominalPriorDose" },
-  { 0x300A0020, VR::CS, "DoseReferenceType" },
-  { 0x300A0021, VR::DS, "ConstraintWeight" },
-  { 0x300A0022, VR::DS, "DeliveryWarningDose" },
-  { 0x300A0023, VR::DS, "DeliveryMaximumDose" },
-  { 0x300A0025, VR::DS, "TargetMinimumDose" },
-  { 0x300A0026, VR::DS, "TargetPrescriptionDose" },
-  { 0x300A0027, VR::DS, "TargetMaximumDose" },
-  { 0x300A0028, VR::DS, "TargetUnderdoseVolumeFraction" },
-  { 0x300A002A, VR::DS, "OrganAtRiskFullVolumeDose" },
-  { 0x300A002B, VR::DS, "OrganAtRiskLimitDose" },
-  { 0x300A002C, VR::DS, "OrganAtRiskMaximumDose" },
-  { 0x300A002D, VR::DS, "OrganAtRiskOverdoseVolumeFraction" },
-  { 0x300A0040, VR::SQ, "ToleranceTableSequence" },
-  { 0x300A0042, VR::IS, "ToleranceTableNumber" },
-  { 0x300A0043, VR::SH, "ToleranceTableLabel" },
-  { 0x300A0044, VR::DS, "GantryAngleTolerance" },
-  { 0x300A0046, VR::DS, "BeamLimitingDeviceAngleTolerance" },
-  { 0x300A0048, VR::SQ, "BeamLimitingDeviceToleranceSequence" },
-  { 0x300A004A, VR::DS, "BeamLimitingDevicePositionTolerance" },
-  { 0x300A004B, VR::FL, "SnoutPositionTolerance" },
-  { 0x300A004C, VR::DS, "PatientSupportAngleTolerance" },
-  { 0x300A004E, VR::DS, "TableTopEccentricAngleTolerance" },
-  { 0x300A004F, VR::FL, "TableTopPitchAngleTolerance" },
-  { 0x300A0050, VR::FL, "TableTopRollAngleTolerance" },
-  { 0x300A0051, VR::DS, "TableTopVerticalPositionTolerance" },
-  { 0x300A0052, VR::DS, "TableTopLongitudinalPositionTolerance" },
-  { 0x300A0053, VR::DS, "TableTopLateralPositionTolerance" },
-  { 0x300A0055, VR::CS, "RTPlanRelationship" },
-  { 0x300A0070, VR::SQ, "FractionGroupSequence" },
-  { 0x300A0071, VR::IS, "FractionGroupNumber" },
-  { 0x300A0072, VR::LO, "FractionGroupDescription" },
-  { 0x300A0078, VR::IS, "NumberOfFractionsPlanned" },
-  { 0x300A0079, VR::IS, "NumberOfFractionPatternDigitsPerDay" },
-  { 0x300A007A, VR::IS, "RepeatFractionCycleLength" },
-  { 0x300A007B, VR::LT, "FractionPattern" },
-  { 0x300A0080, VR::IS, "NumberOfBeams" },
-  { 0x300A0082, VR::DS, "BeamDoseSpecificationPoint" },
-  { 0x300A0084, VR::DS, "BeamDose" },
-  { 0x300A0086, VR::DS, "BeamMeterset" },
-  { 0x300A008B, VR::CS, "BeamDoseMeaning" },
-  { 0x300A008C, VR::SQ, "BeamDoseVerificationControlPointSequence" },
-  { 0x300A008D, VR::FL, "AverageBeamDosePointDepth" },
-  { 0x300A008E, VR::FL, "AverageBeamDosePointEquivalentDepth" },
-  { 0x300A008F, VR::FL, "AverageBeamDosePointSSD" },
-  { 0x300A0090, VR::CS, "BeamDoseType" },
-  { 0x300A0091, VR::DS, "AlternateBeamDose" },
-  { 0x300A0092, VR::CS, "AlternateBeamDoseType" },
-  { 0x300A00A0, VR::IS, "NumberOfBrachyApplicationSetups" },
-  { 0x300A00A2, VR::DS, "BrachyApplicationSetupDoseSpecificationPoint" },
-  { 0x300A00A4, VR::DS, "BrachyApplicationSetupDose" },
-  { 0x300A00B0, VR::SQ, "BeamSequence" },
-  { 0x300A00B2, VR::SH, "TreatmentMachineName" },
-  { 0x300A00B3, VR::CS, "PrimaryDosimeterUnit" },
-  { 0x300A00B4, VR::DS, "SourceAxisDistance" },
-  { 0x300A00B6, VR::SQ, "BeamLimitingDeviceSequence" },
-  { 0x300A00B8, VR::CS, "RTBeamLimitingDeviceType" },
-  { 0x300A00BA, VR::DS, "SourceToBeamLimitingDeviceDistance" },
-  { 0x300A00BB, VR::FL, "IsocenterToBeamLimitingDeviceDistance" },
-  { 0x300A00BC, VR::IS, "NumberOfLeafJawPairs" },
-  { 0x300A00BE, VR::DS, "LeafPositionBoundaries" },
-  { 0x300A00C0, VR::IS, "BeamNumber" },
-  { 0x300A00C2, VR::LO, "BeamName" },
-  { 0x300A00C3, VR::ST, "BeamDescription" },
-  { 0x300A00C4, VR::CS, "BeamType" },
-  { 0x300A00C5, VR::FD, "BeamDeliveryDurationLimit" },
-  { 0x300A00C6, VR::CS, "RadiationType" },
-  { 0x300A00C7, VR::CS, "HighDoseTechniqueType" },
-  { 0x300A00C8, VR::IS, "ReferenceImageNumber" },
-  { 0x300A00CA, VR::SQ, "PlannedVerificationImageSequence" },
-  { 0x300A00CC, VR::LO, "ImagingDeviceSpecificAcquisitionParameters" },
-  { 0x300A00CE, VR::CS, "TreatmentDeliveryType" },
-  { 0x300A00D0, VR::IS, "NumberOfWedges" },
-  { 0x300A00D1, VR::SQ, "WedgeSequence" },
-  { 0x300A00D2, VR::IS, "WedgeNumber" },
-  { 0x300A00D3, VR::CS, "WedgeType" },
-  { 0x300A00D4, VR::SH, "WedgeID" },
-  { 0x300A00D5, VR::IS, "WedgeAngle" },
-  { 0x300A00D6, VR::DS, "WedgeFactor" },
-  { 0x300A00D7, VR::FL, "TotalWedgeTrayWaterEquivalentThickness" },
-  { 0x300A00D8, VR::DS, "WedgeOrientation" },
-  { 0x300A00D9, VR::FL, "IsocenterToWedgeTrayDistance" },
-  { 0x300A00DA, VR::DS, "SourceToWedgeTrayDistance" },
-  { 0x300A00DB, VR::FL, "WedgeThinEdgePosition" },
-  { 0x300A00DC, VR::SH, "BolusID" },
-  { 0x300A00DD, VR::ST, "BolusDescription" },
-  { 0x300A00DE, VR::DS, "EffectiveWedgeAngle" },
-  { 0x300A00E0, VR::IS, "NumberOfCompensators" },
-  { 0x300A00E1, VR::SH, "MaterialID" },
-  { 0x300A00E2, VR::DS, "TotalCompensatorTrayFactor" },
-  { 0x300A00E3, VR::SQ, "CompensatorSequence" },
-  { 0x300A00E4, VR::IS, "CompensatorNumber" },
-  { 0x300A00E5, VR::SH, "CompensatorID" },
-  { 0x300A00E6, VR::DS, "SourceToCompensatorTrayDistance" },
-  { 0x300A00E7, VR::IS, "CompensatorRows" },
-  { 0x300A00E8, VR::IS, "CompensatorColumns" },
-  { 0x300A00E9, VR::DS, "CompensatorPixelSpacing" },
-  { 0x300A00EA, VR::DS, "CompensatorPosition" },
-  { 0x300A00EB, VR::DS, "CompensatorTransmissionData" },
-  { 0x300A00EC, VR::DS, "CompensatorThicknessData" },
-  { 0x300A00ED, VR::IS, "NumberOfBoli" },
-  { 0x300A00EE, VR::CS, "CompensatorType" },
-  { 0x300A00EF, VR::SH, "CompensatorTrayID" },
-  { 0x300A00F0, VR::IS, "NumberOfBlocks" },
-  { 0x300A00F2, VR::DS, "TotalBlockTrayFactor" },
-  { 0x300A00F3, VR::FL, "TotalBlockTrayWaterEquivalentThickness" },
-  { 0x300A00F4, VR::SQ, "BlockSequence" },
-  { 0x300A00F5, VR::SH, "BlockTrayID" },
-  { 0x300A00F6, VR::DS, "SourceToBlockTrayDistance" },
-  { 0x300A00F7, VR::FL, "IsocenterToBlockTrayDistance" },
-  { 0x300A00F8, VR::CS, "BlockType" },
-  { 0x300A00F9, VR::LO, "AccessoryCode" },
-  { 0x300A00FA, VR::CS, "BlockDivergence" },
-  { 0x300A00FB, VR::CS, "BlockMountingPosition" },
-  { 0x300A00FC, VR::IS, "BlockNumber" },
-  { 0x300A00FE, VR::LO, "BlockName" },
-  { 0x300A0100, VR::DS, "BlockThickness" },
-  { 0x300A0102, VR::DS, "BlockTransmission" },
-  { 0x300A0104, VR::IS, "BlockNumberOfPoints" },
-  { 0x300A0106, VR::DS, "BlockData" },
-  { 0x300A0107, VR::SQ, "ApplicatorSequence" },
-  { 0x300A0108, VR::SH, "ApplicatorID" },
-  { 0x300A0109, VR::CS, "ApplicatorType" },
-  { 0x300A010A, VR::LO, "ApplicatorDescription" },
-  { 0x300A010C, VR::DS, "CumulativeDoseReferenceCoefficient" },
-  { 0x300A010E, VR::DS, "FinalCumulativeMetersetWeight" },
-  { 0x300A0110, VR::IS, "NumberOfControlPoints" },
-  { 0x300A0111, VR::SQ, "ControlPointSequence" },
-  { 0x300A0112, VR::IS, "ControlPointIndex" },
-  { 0x300A0114, VR::DS, "NominalBeamEnergy" },
-  { 0x300A0115, VR::DS, "DoseRateSet" },
-  { 0x300A0116, VR::SQ, "WedgePositionSequence" },
-  { 0x300A0118, VR::CS, "WedgePosition" },
-  { 0x300A011A, VR::SQ, "BeamLimitingDevicePositionSequence" },
-  { 0x300A011C, VR::DS, "LeafJawPositions" },
-  { 0x300A011E, VR::DS, "GantryAngle" },
-  { 0x300A011F, VR::CS, "GantryRotationDirection" },
-  { 0x300A0120, VR::DS, "BeamLimitingDeviceAngle" },
-  { 0x300A0121, VR::CS, "BeamLimitingDeviceRotationDirection" },
-  { 0x300A0122, VR::DS, "PatientSupportAngle" },
-  { 0x300A0123, VR::CS, "PatientSupportRotationDirection" },
-  { 0x300A0124, VR::DS, "TableTopEccentricAxisDistance" },
-  { 0x300A0125, VR::DS, "TableTopEccentricAngle" },
-  { 0x300A0126, VR::CS, "TableTopEccentricRotationDirection" },
-  { 0x300A0128, VR::DS, "TableTopVerticalPosition" },
-  { 0x300A0129, VR::DS, "TableTopLongitudinalPosition" },
-  { 0x300A012A, VR::DS, "TableTopLateralPosition" },
-  { 0x300A012C, VR::DS, "IsocenterPosition" },
-  { 0x300A012E, VR::DS, "SurfaceEntryPoint" },
-  { 0x300A0130, VR::DS, "SourceToSurfaceDistance" },
-  { 0x300A0131, VR::FL, "AverageBeamDosePointSourceToExternalContourDistance" },
-  { 0x300A0132, VR::FL, "SourceToExternalContourDistance" },
-  { 0x300A0133, VR::FL, "ExternalContourEntryPoint" },
-  { 0x300A0134, VR::DS, "CumulativeMetersetWeight" },
-  { 0x300A0140, VR::FL, "TableTopPitchAngle" },
-  { 0x300A0142, VR::CS, "TableTopPitchRotationDirection" },
-  { 0x300A0144, VR::FL, "TableTopRollAngle" },
-  { 0x300A0146, VR::CS, "TableTopRollRotationDirection" },
-  { 0x300A0148, VR::FL, "HeadFixationAngle" },
-  { 0x300A014A, VR::FL, "GantryPitchAngle" },
-  { 0x300A014C, VR::CS, "GantryPitchRotationDirection" },
-  { 0x300A014E, VR::FL, "GantryPitchAngleTolerance" },
-  { 0x300A0180, VR::SQ, "PatientSetupSequence" },
-  { 0x300A0182, VR::IS, "PatientSetupNumber" },
-  { 0x300A0183, VR::LO, "PatientSetupLabel" },
-  { 0x300A0184, VR::LO, "PatientAdditionalPosition" },
-  { 0x300A0190, VR::SQ, "FixationDeviceSequence" },
-  { 0x300A0192, VR::CS, "FixationDeviceType" },
-  { 0x300A0194, VR::SH, "FixationDeviceLabel" },
-  { 0x300A0196, VR::ST, "FixationDeviceDescription" },
-  { 0x300A0198, VR::SH, "FixationDevicePosition" },
-  { 0x300A0199, VR::FL, "FixationDevicePitchAngle" },
-  { 0x300A019A, VR::FL, "FixationDeviceRollAngle" },
-  { 0x300A01A0, VR::SQ, "ShieldingDeviceSequence" },
-  { 0x300A01A2, VR::CS, "ShieldingDeviceType" },
-  { 0x300A01A4, VR::SH, "ShieldingDeviceLabel" },
-  { 0x300A01A6, VR::ST, "ShieldingDeviceDescription" },
-  { 0x300A01A8, VR::SH, "ShieldingDevicePosition" },
-  { 0x300A01B0, VR::CS, "SetupTechnique" },
-  { 0x300A01B2, VR::ST, "SetupTechniqueDescription" },
-  { 0x300A01B4, VR::SQ, "SetupDeviceSequence" },
-  { 0x300A01B6, VR::CS, "SetupDeviceType" },
-  { 0x300A01B8, VR::SH, "SetupDeviceLabel" },
-  { 0x300A01BA, VR::ST, "SetupDeviceDescription" },
-  { 0x300A01BC, VR::DS, "SetupDeviceParameter" },
-  { 0x300A01D0, VR::ST, "SetupReferenceDescription" },
-  { 0x300A01D2, VR::DS, "TableTopVerticalSetupDisplacement" },
-  { 0x300A01D4, VR::DS, "TableTopLongitudinalSetupDisplacement" },
-  { 0x300A01D6, VR::DS, "TableTopLateralSetupDisplacement" },
-  { 0x300A0200, VR::CS, "BrachyTreatmentTechnique" },
-  { 0x300A0202, VR::CS, "BrachyTreatmentType" },
-  { 0x300A0206, VR::SQ, "TreatmentMachineSequence" },
-  { 0x300A0210, VR::SQ, "SourceSequence" },
-  { 0x300A0212, VR::IS, "SourceNumber" },
-  { 0x300A0214, VR::CS, "SourceType" },
-  { 0x300A0216, VR::LO, "SourceManufacturer" },
-  { 0x300A0218, VR::DS, "ActiveSourceDiameter" },
-  { 0x300A021A, VR::DS, "ActiveSourceLength" },
-  { 0x300A021B, VR::SH, "SourceModelID" },
-  { 0x300A021C, VR::LO, "SourceDescription" },
-  { 0x300A0222, VR::DS, "SourceEncapsulationNominalThickness" },
-  { 0x300A0224, VR::DS, "SourceEncapsulationNominalTransmission" },
-  { 0x300A0226, VR::LO, "SourceIsotopeName" },
-  { 0x300A0228, VR::DS, "SourceIsotopeHalfLife" },
-  { 0x300A0229, VR::CS, "SourceStrengthUnits" },
-  { 0x300A022A, VR::DS, "ReferenceAirKermaRate" },
-  { 0x300A022B, VR::DS, "SourceStrength" },
-  { 0x300A022C, VR::DA, "SourceStrengthReferenceDate" },
-  { 0x300A022E, VR::TM, "SourceStrengthReferenceTime" },
-  { 0x300A0230, VR::SQ, "ApplicationSetupSequence" },
-  { 0x300A0232, VR::CS, "ApplicationSetupType" },
-  { 0x300A0234, VR::IS, "ApplicationSetupNumber" },
-  { 0x300A0236, VR::LO, "ApplicationSetupName" },
-  { 0x300A0238, VR::LO, "ApplicationSetupManufacturer" },
-  { 0x300A0240, VR::IS, "TemplateNumber" },
-  { 0x300A0242, VR::SH, "TemplateType" },
-  { 0x300A0244, VR::LO, "TemplateName" },
-  { 0x300A0250, VR::DS, "TotalReferenceAirKerma" },
-  { 0x300A0260, VR::SQ, "BrachyAccessoryDeviceSequence" },
-  { 0x300A0262, VR::IS, "BrachyAccessoryDeviceNumber" },
-  { 0x300A0263, VR::SH, "BrachyAccessoryDeviceID" },
-  { 0x300A0264, VR::CS, "BrachyAccessoryDeviceType" },
-  { 0x300A0266, VR::LO, "BrachyAccessoryDeviceName" },
-  { 0x300A026A, VR::DS, "BrachyAccessoryDeviceNominalThickness" },
-  { 0x300A026C, VR::DS, "BrachyAccessoryDeviceNominalTransmission" },
-  { 0x300A0280, VR::SQ, "ChannelSequence" },
-  { 0x300A0282, VR::IS, "ChannelNumber" },
-  { 0x300A0284, VR::DS, "ChannelLength" },
-  { 0x300A0286, VR::DS, "ChannelTotalTime" },
-  { 0x300A0288, VR::CS, "SourceMovementType" },
-  { 0x300A028A, VR::IS, "NumberOfPulses" },
-  { 0x300A028C, VR::DS, "PulseRepetitionInterval" },
-  { 0x300A0290, VR::IS, "SourceApplicatorNumber" },
-  { 0x300A0291, VR::SH, "SourceApplicatorID" },
-  { 0x300A0292, VR::CS, "SourceApplicatorType" },
-  { 0x300A0294, VR::LO, "SourceApplicatorName" },
-  { 0x300A0296, VR::DS, "SourceApplicatorLength" },
-  { 0x300A0298, VR::LO, "SourceApplicatorManufacturer" },
-  { 0x300A029C, VR::DS, "SourceApplicatorWallNominalThickness" },
-  { 0x300A029E, VR::DS, "SourceApplicatorWallNominalTransmission" },
-  { 0x300A02A0, VR::DS, "SourceApplicatorStepSize" },
-  { 0x300A02A2, VR::IS, "TransferTubeNumber" },
-  { 0x300A02A4, VR::DS, "TransferTubeLength" },
-  { 0x300A02B0, VR::SQ, "ChannelShieldSequence" },
-  { 0x300A02B2, VR::IS, "ChannelShieldNumber" },
-  { 0x300A02B3, VR::SH, "ChannelShieldID" },
-  { 0x300A02B4, VR::LO, "ChannelShieldName" },
-  { 0x300A02B8, VR::DS, "ChannelShieldNominalThickness" },
-  { 0x300A02BA, VR::DS, "ChannelShieldNominalTransmission" },
-  { 0x300A02C8, VR::DS, "FinalCumulativeTimeWeight" },
-  { 0x300A02D0, VR::SQ, "BrachyControlPointSequence" },
-  { 0x300A02D2, VR::DS, "ControlPointRelativePosition" },
-  { 0x300A02D4, VR::DS, "ControlPoint3DPosition" },
-  { 0x300A02D6, VR::DS, "CumulativeTimeWeight" },
-  { 0x300A02E0, VR::CS, "CompensatorDivergence" },
-  { 0x300A02E1, VR::CS, "CompensatorMountingPosition" },
-  { 0x300A02E2, VR::DS, "SourceToCompensatorDistance" },
-  { 0x300A02E3, VR::FL, "TotalCompensatorTrayWaterEquivalentThickness" },
-  { 0x300A02E4, VR::FL, "IsocenterToCompensatorTrayDistance" },
-  { 0x300A02E5, VR::FL, "CompensatorColumnOffset" },
-  { 0x300A02E6, VR::FL, "IsocenterToCompensatorDistances" },
-  { 0x300A02E7, VR::FL, "CompensatorRelativeStoppingPowerRatio" },
-  { 0x300A02E8, VR::FL, "CompensatorMillingToolDiameter" },
-  { 0x300A02EA, VR::SQ, "IonRangeCompensatorSequence" },
-  { 0x300A02EB, VR::LT, "CompensatorDescription" },
-  { 0x300A0302, VR::IS, "RadiationMassNumber" },
-  { 0x300A0304, VR::IS, "RadiationAtomicNumber" },
-  { 0x300A0306, VR::SS, "RadiationChargeState" },
-  { 0x300A0308, VR::CS, "ScanMode" },
-  { 0x300A0309, VR::CS, "ModulatedScanModeType" },
-  { 0x300A030A, VR::FL, "VirtualSourceAxisDistances" },
-  { 0x300A030C, VR::SQ, "SnoutSequence" },
-  { 0x300A030D, VR::FL, "SnoutPosition" },
-  { 0x300A030F, VR::SH, "SnoutID" },
-  { 0x300A0312, VR::IS, "NumberOfRangeShifters" },
-  { 0x300A0314, VR::SQ, "RangeShifterSequence" },
-  { 0x300A0316, VR::IS, "RangeShifterNumber" },
-  { 0x300A0318, VR::SH, "RangeShifterID" },
-  { 0x300A0320, VR::CS, "RangeShifterType" },
-  { 0x300A0322, VR::LO, "RangeShifterDescription" },
-  { 0x300A0330, VR::IS, "NumberOfLateralSpreadingDevices" },
-  { 0x300A0332, VR::SQ, "LateralSpreadingDeviceSequence" },
-  { 0x300A0334, VR::IS, "LateralSpreadingDeviceNumber" },
-  { 0x300A0336, VR::SH, "LateralSpreadingDeviceID" },
-  { 0x300A0338, VR::CS, "LateralSpreadingDeviceType" },
-  { 0x300A033A, VR::LO, "LateralSpreadingDeviceDescription" },
-  { 0x300A033C, VR::FL, "LateralSpreadingDeviceWaterEquivalentThickness" },
-  { 0x300A0340, VR::IS, "NumberOfRangeModulators" },
-  { 0x300A0342, VR::SQ, "RangeModulatorSequence" },
-  { 0x300A0344, VR::IS, "RangeModulatorNumber" },
-  { 0x300A0346, VR::SH, "RangeModulatorID" },
-  { 0x300A0348, VR::CS, "RangeModulatorType" },
-  { 0x300A034A, VR::LO, "RangeModulatorDescription" },
-  { 0x300A034C, VR::SH, "BeamCurrentModulationID" },
-  { 0x300A0350, VR::CS, "PatientSupportType" },
-  { 0x300A0352, VR::SH, "PatientSupportID" },
-  { 0x300A0354, VR::LO, "PatientSupportAccessoryCode" },
-  { 0x300A0355, VR::LO, "TrayAccessoryCode" },
-  { 0x300A0356, VR::FL, "FixationLightAzimuthalAngle" },
-  { 0x300A0358, VR::FL, "FixationLightPolarAngle" },
-  { 0x300A035A, VR::FL, "MetersetRate" },
-  { 0x300A0360, VR::SQ, "RangeShifterSettingsSequence" },
-  { 0x300A0362, VR::LO, "RangeShifterSetting" },
-  { 0x300A0364, VR::FL, "IsocenterToRangeShifterDistance" },
-  { 0x300A0366, VR::FL, "RangeShifterWaterEquivalentThickness" },
-  { 0x300A0370, VR::SQ, "LateralSpreadingDeviceSettingsSequence" },
-  { 0x300A0372, VR::LO, "LateralSpreadingDeviceSetting" },
-  { 0x300A0374, VR::FL, "IsocenterToLateralSpreadingDeviceDistance" },
-  { 0x300A0380, VR::SQ, "RangeModulatorSettingsSequence" },
-  { 0x300A0382, VR::FL, "RangeModulatorGatingStartValue" },
-  { 0x300A0384, VR::FL, "RangeModulatorGatingStopValue" },
-  { 0x300A0386, VR::FL, "RangeModulatorGatingStartWaterEquivalentThickness" },
-  { 0x300A0388, VR::FL, "RangeModulatorGatingStopWaterEquivalentThickness" },
-  { 0x300A038A, VR::FL, "IsocenterToRangeModulatorDistance" },
-  { 0x300A0390, VR::SH, "ScanSpotTuneID" },
-  { 0x300A0392, VR::IS, "NumberOfScanSpotPositions" },
-  { 0x300A0394, VR::FL, "ScanSpotPositionMap" },
-  { 0x300A0396, VR::FL, "ScanSpotMetersetWeights" },
-  { 0x300A0398, VR::FL, "ScanningSpotSize" },
-  { 0x300A039A, VR::IS, "NumberOfPaintings" },
-  { 0x300A03A0, VR::SQ, "IonToleranceTableSequence" },
-  { 0x300A03A2, VR::SQ, "IonBeamSequence" },
-  { 0x300A03A4, VR::SQ, "IonBeamLimitingDeviceSequence" },
-  { 0x300A03A6, VR::SQ, "IonBlockSequence" },
-  { 0x300A03A8, VR::SQ, "IonControlPointSequence" },
-  { 0x300A03AA, VR::SQ, "IonWedgeSequence" },
-  { 0x300A03AC, VR::SQ, "IonWedgePositionSequence" },
-  { 0x300A0401, VR::SQ, "ReferencedSetupImageSequence" },
-  { 0x300A0402, VR::ST, "SetupImageComment" },
-  { 0x300A0410, VR::SQ, "MotionSynchronizationSequence" },
-  { 0x300A0412, VR::FL, "ControlPointOrientation" },
-  { 0x300A0420, VR::SQ, "GeneralAccessorySequence" },
-  { 0x300A0421, VR::SH, "GeneralAccessoryID" },
-  { 0x300A0422, VR::ST, "GeneralAccessoryDescription" },
-  { 0x300A0423, VR::CS, "GeneralAccessoryType" },
-  { 0x300A0424, VR::IS, "GeneralAccessoryNumber" },
-  { 0x300A0425, VR::FL, "SourceToGeneralAccessoryDistance" },
-  { 0x300A0431, VR::SQ, "ApplicatorGeometrySequence" },
-  { 0x300A0432, VR::CS, "ApplicatorApertureShape" },
-  { 0x300A0433, VR::FL, "ApplicatorOpening" },
-  { 0x300A0434, VR::FL, "ApplicatorOpeningX" },
-  { 0x300A0435, VR::FL, "ApplicatorOpeningY" },
-  { 0x300A0436, VR::FL, "SourceToApplicatorMountingPositionDistance" },
-  { 0x300A0440, VR::IS, "NumberOfBlockSlabItems" },
-  { 0x300A0441, VR::SQ, "BlockSlabSequence" },
-  { 0x300A0442, VR::DS, "BlockSlabThickness" },
-  { 0x300A0443, VR::US, "BlockSlabNumber" },
-  { 0x300A0450, VR::SQ, "DeviceMotionControlSequence" },
-  { 0x300A0451, VR::CS, "DeviceMotionExecutionMode" },
-  { 0x300A0452, VR::CS, "DeviceMotionObservationMode" },
-  { 0x300A0453, VR::SQ, "DeviceMotionParameterCodeSequence" },
-  { 0x300A0501, VR::FL, "DistalDepthFraction" },
-  { 0x300A0502, VR::FL, "DistalDepth" },
-  { 0x300A0503, VR::FL, "NominalRangeModulationFractions" },
-  { 0x300A0504, VR::FL, "NominalRangeModulatedRegionDepths" },
-  { 0x300A0505, VR::SQ, "DepthDoseParametersSequence" },
-  { 0x300A0506, VR::SQ, "DeliveredDepthDoseParametersSequence" },
-  { 0x300A0507, VR::FL, "DeliveredDistalDepthFraction" },
-  { 0x300A0508, VR::FL, "DeliveredDistalDepth" },
-  { 0x300A0509, VR::FL, "DeliveredNominalRangeModulationFractions" },
-  { 0x300A0510, VR::FL, "DeliveredNominalRangeModulatedRegionDepths" },
-  { 0x300A0511, VR::CS, "DeliveredReferenceDoseDefinition" },
-  { 0x300A0512, VR::CS, "ReferenceDoseDefinition" },
-  { 0x300C0002, VR::SQ, "ReferencedRTPlanSequence" },
-  { 0x300C0004, VR::SQ, "ReferencedBeamSequence" },
-  { 0x300C0006, VR::IS, "ReferencedBeamNumber" },
-  { 0x300C0007, VR::IS, "ReferencedReferenceImageNumber" },
-  { 0x300C0008, VR::DS, "StartCumulativeMetersetWeight" },
-  { 0x300C0009, VR::DS, "EndCumulativeMetersetWeight" },
-  { 0x300C000A, VR::SQ, "ReferencedBrachyApplicationSetupSequence" },
-  { 0x300C000C, VR::IS, "ReferencedBrachyApplicationSetupNumber" },
-  { 0x300C000E, VR::IS, "ReferencedSourceNumber" },
-  { 0x300C0020, VR::SQ, "ReferencedFractionGroupSequence" },
-  { 0x300C0022, VR::IS, "ReferencedFractionGroupNumber" },
-  { 0x300C0040, VR::SQ, "ReferencedVerificationImageSequence" },
-  { 0x300C0042, VR::SQ, "ReferencedReferenceImageSequence" },
-  { 0x300C0050, VR::SQ, "ReferencedDoseReferenceSequence" },
-  { 0x300C0051, VR::IS, "ReferencedDoseReferenceNumber" },
-  { 0x300C0055, VR::SQ, "BrachyReferencedDoseReferenceSequence" },
-  { 0x300C0060, VR::SQ, "ReferencedStructureSetSequence" },
-  { 0x300C006A, VR::IS, "ReferencedPatientSetupNumber" },
-  { 0x300C0080, VR::SQ, "ReferencedDoseSequence" },
-  { 0x300C00A0, VR::IS, "ReferencedToleranceTableNumber" },
-  { 0x300C00B0, VR::SQ, "ReferencedBolusSequence" },
-  { 0x300C00C0, VR::IS, "ReferencedWedgeNumber" },
-  { 0x300C00D0, VR::IS, "ReferencedCompensatorNumber" },
-  { 0x300C00E0, VR::IS, "ReferencedBlockNumber" },
-  { 0x300C00F0, VR::IS, "ReferencedControlPointIndex" },
-  { 0x300C00F2, VR::SQ, "ReferencedControlPointSequence" },
-  { 0x300C00F4, VR::IS, "ReferencedStartControlPointIndex" },
-  { 0x300C00F6, VR::IS, "ReferencedStopControlPointIndex" },
-  { 0x300C0100, VR::IS, "ReferencedRangeShifterNumber" },
-  { 0x300C0102, VR::IS, "ReferencedLateralSpreadingDeviceNumber" },
-  { 0x300C0104, VR::IS, "ReferencedRangeModulatorNumber" },
-  { 0x300C0111, VR::SQ, "OmittedBeamTaskSequence" },
-  { 0x300C0112, VR::CS, "ReasonForOmission" },
-  { 0x300C0113, VR::LO, "ReasonForOmissionDescription" },
-  { 0x300E0002, VR::CS, "ApprovalStatus" },
-  { 0x300E0004, VR::DA, "ReviewDate" },
-  { 0x300E0005, VR::TM, "ReviewTime" },
-  { 0x300E0008, VR::PN, "ReviewerName" },
-  { 0x40100001, VR::CS, "LowEnergyDetectors" },
-  { 0x40100002, VR::CS, "HighEnergyDetectors" },
-  { 0x40100004, VR::SQ, "DetectorGeometrySequence" },
-  { 0x40101001, VR::SQ, "ThreatROIVoxelSequence" },
-  { 0x40101004, VR::FL, "ThreatROIBase" },
-  { 0x40101005, VR::FL, "ThreatROIExtents" },
-  { 0x40101006, VR::OB, "ThreatROIBitmap" },
-  { 0x40101007, VR::SH, "RouteSegmentID" },
-  { 0x40101008, VR::CS, "GantryType" },
-  { 0x40101009, VR::CS, "OOIOwnerType" },
-  { 0x4010100A, VR::SQ, "RouteSegmentSequence" },
-  { 0x40101010, VR::US, "PotentialThreatObjectID" },
-  { 0x40101011, VR::SQ, "ThreatSequence" },
-  { 0x40101012, VR::CS, "ThreatCategory" },
-  { 0x40101013, VR::LT, "ThreatCategoryDescription" },
-  { 0x40101014, VR::CS, "ATDAbilityAssessment" },
-  { 0x40101015, VR::CS, "ATDAssessmentFlag" },
-  { 0x40101016, VR::FL, "ATDAssessmentProbability" },
-  { 0x40101017, VR::FL, "Mass" },
-  { 0x40101018, VR::FL, "Density" },
-  { 0x40101019, VR::FL, "ZEffective" },
-  { 0x4010101A, VR::SH, "BoardingPassID" },
-  { 0x4010101B, VR::FL, "CenterOfMass" },
-  { 0x4010101C, VR::FL, "CenterOfPTO" },
-  { 0x4010101D, VR::FL, "BoundingPolygon" },
-  { 0x4010101E, VR::SH, "RouteSegmentStartLocationID" },
-  { 0x4010101F, VR::SH, "RouteSegmentEndLocationID" },
-  { 0x40101020, VR::CS, "RouteSegmentLocationIDType" },
-  { 0x40101021, VR::CS, "AbortReason" },
-  { 0x40101023, VR::FL, "VolumeOfPTO" },
-  { 0x40101024, VR::CS, "AbortFlag" },
-  { 0x40101025, VR::DT, "RouteSegmentStartTime" },
-  { 0x40101026, VR::DT, "RouteSegmentEndTime" },
-  { 0x40101027, VR::CS, "TDRType" },
-  { 0x40101028, VR::CS, "InternationalRouteSegment" },
-  { 0x40101029, VR::LO, "ThreatDetectionAlgorithmandVersion" },
-  { 0x4010102A, VR::SH, "AssignedLocation" },
-  { 0x4010102B, VR::DT, "AlarmDecisionTime" },
-  { 0x40101031, VR::CS, "AlarmDecision" },
-  { 0x40101033, VR::US, "NumberOfTotalObjects" },
-  { 0x40101034, VR::US, "NumberOfAlarmObjects" },
-  { 0x40101037, VR::SQ, "PTORepresentationSequence" },
-  { 0x40101038, VR::SQ, "ATDAssessmentSequence" },
-  { 0x40101039, VR::CS, "TIPType" },
-  { 0x4010103A, VR::CS, "DICOSVersion" },
-  { 0x40101041, VR::DT, "OOIOwnerCreationTime" },
-  { 0x40101042, VR::CS, "OOIType" },
-  { 0x40101043, VR::FL, "OOISize" },
-  { 0x40101044, VR::CS, "AcquisitionStatus" },
-  { 0x40101045, VR::SQ, "BasisMaterialsCodeSequence" },
-  { 0x40101046, VR::CS, "PhantomType" },
-  { 0x40101047, VR::SQ, "OOIOwnerSequence" },
-  { 0x40101048, VR::CS, "ScanType" },
-  { 0x40101051, VR::LO, "ItineraryID" },
-  { 0x40101052, VR::SH, "ItineraryIDType" },
-  { 0x40101053, VR::LO, "ItineraryIDAssigningAuthority" },
-  { 0x40101054, VR::SH, "RouteID" },
-  { 0x40101055, VR::SH, "RouteIDAssigningAuthority" },
-  { 0x40101056, VR::CS, "InboundArrivalType" },
-  { 0x40101058, VR::SH, "CarrierID" },
-  { 0x40101059, VR::CS, "CarrierIDAssigningAuthority" },
-  { 0x40101060, VR::FL, "SourceOrientation" },
-  { 0x40101061, VR::FL, "SourcePosition" },
-  { 0x40101062, VR::FL, "BeltHeight" },
-  { 0x40101064, VR::SQ, "AlgorithmRoutingCodeSequence" },
-  { 0x40101067, VR::CS, "TransportClassification" },
-  { 0x40101068, VR::LT, "OOITypeDescriptor" },
-  { 0x40101069, VR::FL, "TotalProcessingTime" },
-  { 0x4010106C, VR::OB, "DetectorCalibrationData" },
-  { 0x4010106D, VR::CS, "AdditionalScreeningPerformed" },
-  { 0x4010106E, VR::CS, "AdditionalInspectionSelectionCriteria" },
-  { 0x4010106F, VR::SQ, "AdditionalInspectionMethodSequence" },
-  { 0x40101070, VR::CS, "AITDeviceType" },
-  { 0x40101071, VR::SQ, "QRMeasurementsSequence" },
-  { 0x40101072, VR::SQ, "TargetMaterialSequence" },
-  { 0x40101073, VR::FD, "SNRThreshold" },
-  { 0x40101075, VR::DS, "ImageScaleRepresentation" },
-  { 0x40101076, VR::SQ, "ReferencedPTOSequence" },
-  { 0x40101077, VR::SQ, "ReferencedTDRInstanceSequence" },
-  { 0x40101078, VR::ST, "PTOLocationDescription" },
-  { 0x40101079, VR::SQ, "AnomalyLocatorIndicatorSequence" },
-  { 0x4010107A, VR::FL, "AnomalyLocatorIndicator" },
-  { 0x4010107B, VR::SQ, "PTORegionSequence" },
-  { 0x4010107C, VR::CS, "InspectionSelectionCriteria" },
-  { 0x4010107D, VR::SQ, "SecondaryInspectionMethodSequence" },
-  { 0x4010107E, VR::DS, "PRCSToRCSOrientation" },
-  { 0x4FFE0001, VR::SQ, "MACParametersSequence" },
-  { 0x52009229, VR::SQ, "SharedFunctionalGroupsSequence" },
-  { 0x52009230, VR::SQ, "PerFrameFunctionalGroupsSequence" },
-  { 0x54000100, VR::SQ, "WaveformSequence" },
-  { 0x54000110, VR::OB, "ChannelMinimumValue" },
-  { 0x54000112, VR::OB, "ChannelMaximumValue" },
-  { 0x54001004, VR::US, "WaveformBitsAllocated" },
-  { 0x54001006, VR::CS, "WaveformSampleInterpretation" },
-  { 0x5400100A, VR::OB, "WaveformPaddingValue" },
-  { 0x54001010, VR::OB, "WaveformData" },
-  { 0x56000010, VR::OF, "FirstOrderPhaseCorrectionAngle" },
-  { 0x56000020, VR::OF, "SpectroscopyData" },
-  { 0x60000010, VR::US, "OverlayRows" },
-  { 0x60000011, VR::US, "OverlayColumns" },
-  { 0x60000015, VR::IS, "NumberOfFramesInOverlay" },
-  { 0x60000022, VR::LO, "OverlayDescription" },
-  { 0x60000040, VR::CS, "OverlayType" },
-  { 0x60000045, VR::LO, "OverlaySubtype" },
-  { 0x60000050, VR::SS, "OverlayOrigin" },
-  { 0x60000051, VR::US, "ImageFrameOrigin" },
-  { 0x60000100, VR::US, "OverlayBitsAllocated" },
-  { 0x60000102, VR::US, "OverlayBitPosition" },
-  { 0x60001001, VR::CS, "OverlayActivationLayer" },
-  { 0x60001301, VR::IS, "ROIArea" },
-  { 0x60001302, VR::DS, "ROIMean" },
-  { 0x60001303, VR::DS, "ROIStandardDeviation" },
-  { 0x60001500, VR::LO, "OverlayLabel" },
-  { 0x60003000, VR::OB, "OverlayData" },
-  { 0x7FE00008, VR::OF, "FloatPixelData" },
-  { 0x7FE00009, VR::OD, "DoubleFloatPixelData" },
-  { 0x7FE00010, VR::OB, "PixelData" },
-  { 0xFFFAFFFA, VR::SQ, "DigitalSignaturesSequence" },
-  { 0xFFFCFFFC, VR::OB, "DataSetTrailingPadding" },
+  { 0x00000901, VR::AT, VM(1, VM::N, 1), "OffendingElement" },
+  { 0x00001005, VR::AT, VM(1, VM::N, 1), "AttributeIdentifierList" },
+  { 0x00020000, VR::UL, VM(1, 1, 1), "FileMetaInformationGroupLength" },
+  { 0x00020001, VR::OB, VM(1, 1, 1), "FileMetaInformationVersion" },
+  { 0x00020002, VR::UI, VM(1, 1, 1), "MediaStorageSOPClassUID" },
+  { 0x00020003, VR::UI, VM(1, 1, 1), "MediaStorageSOPInstanceUID" },
+  { 0x00020010, VR::UI, VM(1, 1, 1), "TransferSyntaxUID" },
+  { 0x00020012, VR::UI, VM(1, 1, 1), "ImplementationClassUID" },
+  { 0x00020013, VR::SH, VM(1, 1, 1), "ImplementationVersionName" },
+  { 0x00020016, VR::AE, VM(1, 1, 1), "SourceApplicationEntityTitle" },
+  { 0x00020017, VR::AE, VM(1, 1, 1), "SendingApplicationEntityTitle" },
+  { 0x00020018, VR::AE, VM(1, 1, 1), "ReceivingApplicationEntityTitle" },
+  { 0x00020100, VR::UI, VM(1, 1, 1), "PrivateInformationCreatorUID" },
+  { 0x00020102, VR::OB, VM(1, 1, 1), "PrivateInformation" },
+  { 0x00041130, VR::CS, VM(1, 1, 1), "FileSetID" },
+  { 0x00041141, VR::CS, VM(1, 8, 1), "FileSetDescriptorFileID" },
+  { 0x00041142, VR::CS, VM(1, 1, 1), "SpecificCharacterSetOfFileSetDescriptorFile" },
+  { 0x00041200, VR::UL, VM(1, 1, 1), "OffsetOfTheFirstDirectoryRecordOfTheRootDirectoryEntity" },
+  { 0x00041202, VR::UL, VM(1, 1, 1), "OffsetOfTheLastDirectoryRecordOfTheRootDirectoryEntity" },
+  { 0x00041212, VR::US, VM(1, 1, 1), "FileSetConsistencyFlag" },
+  { 0x00041220, VR::SQ, VM(1, 1, 1), "DirectoryRecordSequence" },
+  { 0x00041400, VR::UL, VM(1, 1, 1), "OffsetOfTheNextDirectoryRecord" },
+  { 0x00041410, VR::US, VM(1, 1, 1), "RecordInUseFlag" },
+  { 0x00041420, VR::UL, VM(1, 1, 1), "OffsetOfReferencedLowerLevelDirectoryEntity" },
+  { 0x00041430, VR::CS, VM(1, 1, 1), "DirectoryRecordType" },
+  { 0x00041432, VR::UI, VM(1, 1, 1), "PrivateRecordUID" },
+  { 0x00041500, VR::CS, VM(1, 8, 1), "ReferencedFileID" },
+  { 0x00041510, VR::UI, VM(1, 1, 1), "ReferencedSOPClassUIDInFile" },
+  { 0x00041511, VR::UI, VM(1, 1, 1), "ReferencedSOPInstanceUIDInFile" },
+  { 0x00041512, VR::UI, VM(1, 1, 1), "ReferencedTransferSyntaxUIDInFile" },
+  { 0x0004151A, VR::UI, VM(1, VM::N, 1), "ReferencedRelatedGeneralSOPClassUIDInFile" },
+  { 0x00080005, VR::CS, VM(1, VM::N, 1), "SpecificCharacterSet" },
+  { 0x00080006, VR::SQ, VM(1, 1, 1), "LanguageCodeSequence" },
+  { 0x00080008, VR::CS, VM(2, VM::N, 1), "ImageType" },
+  { 0x00080012, VR::DA, VM(1, 1, 1), "InstanceCreationDate" },
+  { 0x00080013, VR::TM, VM(1, 1, 1), "InstanceCreationTime" },
+  { 0x00080014, VR::UI, VM(1, 1, 1), "InstanceCreatorUID" },
+  { 0x00080015, VR::DT, VM(1, 1, 1), "InstanceCoercionDateTime" },
+  { 0x00080016, VR::UI, VM(1, 1, 1), "SOPClassUID" },
+  { 0x00080018, VR::UI, VM(1, 1, 1), "SOPInstanceUID" },
+  { 0x0008001A, VR::UI, VM(1, VM::N, 1), "RelatedGeneralSOPClassUID" },
+  { 0x0008001B, VR::UI, VM(1, 1, 1), "OriginalSpecializedSOPClassUID" },
+  { 0x00080020, VR::DA, VM(1, 1, 1), "StudyDate" },
+  { 0x00080021, VR::DA, VM(1, 1, 1), "SeriesDate" },
+  { 0x00080022, VR::DA, VM(1, 1, 1), "AcquisitionDate" },
+  { 0x00080023, VR::DA, VM(1, 1, 1), "ContentDate" },
+  { 0x0008002A, VR::DT, VM(1, 1, 1), "AcquisitionDateTime" },
+  { 0x00080030, VR::TM, VM(1, 1, 1), "StudyTime" },
+  { 0x00080031, VR::TM, VM(1, 1, 1), "SeriesTime" },
+  { 0x00080032, VR::TM, VM(1, 1, 1), "AcquisitionTime" },
+  { 0x00080033, VR::TM, VM(1, 1, 1), "ContentTime" },
+  { 0x00080050, VR::SH, VM(1, 1, 1), "AccessionNumber" },
+  { 0x00080051, VR::SQ, VM(1, 1, 1), "IssuerOfAccessionNumberSequence" },
+  { 0x00080052, VR::CS, VM(1, 1, 1), "QueryRetrieveLevel" },
+  { 0x00080053, VR::CS, VM(1, 1, 1), "QueryRetrieveView" },
+  { 0x00080054, VR::AE, VM(1, VM::N, 1), "RetrieveAETitle" },
+  { 0x00080055, VR::AE, VM(1, 1, 1), "StationAETitle" },
+  { 0x00080056, VR::CS, VM(1, 1, 1), "InstanceAvailability" },
+  { 0x00080058, VR::UI, VM(1, VM::N, 1), "FailedSOPInstanceUIDList" },
+  { 0x00080060, VR::CS, VM(1, 1, 1), "Modality" },
+  { 0x00080061, VR::CS, VM(1, VM::N, 1), "ModalitiesInStudy" },
+  { 0x00080062, VR::UI, VM(1, VM::N, 1), "SOPClassesInStudy" },
+  { 0x00080064, VR::CS, VM(1, 1, 1), "ConversionType" },
+  { 0x00080068, VR::CS, VM(1, 1, 1), "PresentationIntentType" },
+  { 0x00080070, VR::LO, VM(1, 1, 1), "Manufacturer" },
+  { 0x00080080, VR::LO, VM(1, 1, 1), "InstitutionName" },
+  { 0x00080081, VR::ST, VM(1, 1, 1), "InstitutionAddress" },
+  { 0x00080082, VR::SQ, VM(1, 1, 1), "InstitutionCodeSequence" },
+  { 0x00080090, VR::PN, VM(1, 1, 1), "ReferringPhysicianName" },
+  { 0x00080092, VR::ST, VM(1, 1, 1), "ReferringPhysicianAddress" },
+  { 0x00080094, VR::SH, VM(1, VM::N, 1), "ReferringPhysicianTelephoneNumbers" },
+  { 0x00080096, VR::SQ, VM(1, 1, 1), "ReferringPhysicianIdentificationSequence" },
+  { 0x0008009C, VR::PN, VM(1, VM::N, 1), "ConsultingPhysicianName" },
+  { 0x0008009D, VR::SQ, VM(1, 1, 1), "ConsultingPhysicianIdentificationSequence" },
+  { 0x00080100, VR::SH, VM(1, 1, 1), "CodeValue" },
+  { 0x00080101, VR::LO, VM(1, 1, 1), "ExtendedCodeValue" },
+  { 0x00080102, VR::SH, VM(1, 1, 1), "CodingSchemeDesignator" },
+  { 0x00080103, VR::SH, VM(1, 1, 1), "CodingSchemeVersion" },
+  { 0x00080104, VR::LO, VM(1, 1, 1), "CodeMeaning" },
+  { 0x00080105, VR::CS, VM(1, 1, 1), "MappingResource" },
+  { 0x00080106, VR::DT, VM(1, 1, 1), "ContextGroupVersion" },
+  { 0x00080107, VR::DT, VM(1, 1, 1), "ContextGroupLocalVersion" },
+  { 0x00080108, VR::LT, VM(1, 1, 1), "ExtendedCodeMeaning" },
+  { 0x0008010B, VR::CS, VM(1, 1, 1), "ContextGroupExtensionFlag" },
+  { 0x0008010C, VR::UI, VM(1, 1, 1), "CodingSchemeUID" },
+  { 0x0008010D, VR::UI, VM(1, 1, 1), "ContextGroupExtensionCreatorUID" },
+  { 0x0008010F, VR::CS, VM(1, 1, 1), "ContextIdentifier" },
+  { 0x00080110, VR::SQ, VM(1, 1, 1), "CodingSchemeIdentificationSequence" },
+  { 0x00080112, VR::LO, VM(1, 1, 1), "CodingSchemeRegistry" },
+  { 0x00080114, VR::ST, VM(1, 1, 1), "CodingSchemeExternalID" },
+  { 0x00080115, VR::ST, VM(1, 1, 1), "CodingSchemeName" },
+  { 0x00080116, VR::ST, VM(1, 1, 1), "CodingSchemeResponsibleOrganization" },
+  { 0x00080117, VR::UI, VM(1, 1, 1), "ContextUID" },
+  { 0x00080118, VR::UI, VM(1, 1, 1), "MappingResourceUID" },
+  { 0x00080119, VR::UC, VM(1, 1, 1), "LongCodeValue" },
+  { 0x00080120, VR::UR, VM(1, 1, 1), "URNCodeValue" },
+  { 0x00080121, VR::SQ, VM(1, 1, 1), "EquivalentCodeSequence" },
+  { 0x00080201, VR::SH, VM(1, 1, 1), "TimezoneOffsetFromUTC" },
+  { 0x00080300, VR::SQ, VM(1, 1, 1), "PrivateDataElementCharacteristicsSequence" },
+  { 0x00080301, VR::US, VM(1, 1, 1), "PrivateGroupReference" },
+  { 0x00080302, VR::LO, VM(1, 1, 1), "PrivateCreatorReference" },
+  { 0x00080303, VR::CS, VM(1, 1, 1), "BlockIdentifyingInformationStatus" },
+  { 0x00080304, VR::US, VM(1, VM::N, 1), "NonidentifyingPrivateElements" },
+  { 0x00080305, VR::SQ, VM(1, 1, 1), "DeidentificationActionSequence" },
+  { 0x00080306, VR::US, VM(1, VM::N, 1), "IdentifyingPrivateElements" },
+  { 0x00080307, VR::CS, VM(1, 1, 1), "DeidentificationAction" },
+  { 0x00080309, VR::UL, VM(1, 3, 1), "PrivateDataElementValueMultiplicity" },
+  { 0x0008030B, VR::UL, VM(1, 2, 1), "PrivateDataElementNumberOfItems" },
+  { 0x00081010, VR::SH, VM(1, 1, 1), "StationName" },
+  { 0x00081030, VR::LO, VM(1, 1, 1), "StudyDescription" },
+  { 0x00081032, VR::SQ, VM(1, 1, 1), "ProcedureCodeSequence" },
+  { 0x0008103E, VR::LO, VM(1, 1, 1), "SeriesDescription" },
+  { 0x0008103F, VR::SQ, VM(1, 1, 1), "SeriesDescriptionCodeSequence" },
+  { 0x00081040, VR::LO, VM(1, 1, 1), "InstitutionalDepartmentName" },
+  { 0x00081048, VR::PN, VM(1, VM::N, 1), "PhysiciansOfRecord" },
+  { 0x00081049, VR::SQ, VM(1, 1, 1), "PhysiciansOfRecordIdentificationSequence" },
+  { 0x00081050, VR::PN, VM(1, VM::N, 1), "PerformingPhysicianName" },
+  { 0x00081052, VR::SQ, VM(1, 1, 1), "PerformingPhysicianIdentificationSequence" },
+  { 0x00081060, VR::PN, VM(1, VM::N, 1), "NameOfPhysiciansReadingStudy" },
+  { 0x00081062, VR::SQ, VM(1, 1, 1), "PhysiciansReadingStudyIdentificationSequence" },
+  { 0x00081070, VR::PN, VM(1, VM::N, 1), "OperatorsName" },
+  { 0x00081072, VR::SQ, VM(1, 1, 1), "OperatorIdentificationSequence" },
+  { 0x00081080, VR::LO, VM(1, VM::N, 1), "AdmittingDiagnosesDescription" },
+  { 0x00081084, VR::SQ, VM(1, 1, 1), "AdmittingDiagnosesCodeSequence" },
+  { 0x00081090, VR::LO, VM(1, 1, 1), "ManufacturerModelName" },
+  { 0x00081110, VR::SQ, VM(1, 1, 1), "ReferencedStudySequence" },
+  { 0x00081111, VR::SQ, VM(1, 1, 1), "ReferencedPerformedProcedureStepSequence" },
+  { 0x00081115, VR::SQ, VM(1, 1, 1), "ReferencedSeriesSequence" },
+  { 0x00081120, VR::SQ, VM(1, 1, 1), "ReferencedPatientSequence" },
+  { 0x00081125, VR::SQ, VM(1, 1, 1), "ReferencedVisitSequence" },
+  { 0x00081134, VR::SQ, VM(1, 1, 1), "ReferencedStereometricInstanceSequence" },
+  { 0x0008113A, VR::SQ, VM(1, 1, 1), "ReferencedWaveformSequence" },
+  { 0x00081140, VR::SQ, VM(1, 1, 1), "ReferencedImageSequence" },
+  { 0x0008114A, VR::SQ, VM(1, 1, 1), "ReferencedInstanceSequence" },
+  { 0x0008114B, VR::SQ, VM(1, 1, 1), "ReferencedRealWorldValueMappingInstanceSequence" },
+  { 0x00081150, VR::UI, VM(1, 1, 1), "ReferencedSOPClassUID" },
+  { 0x00081155, VR::UI, VM(1, 1, 1), "ReferencedSOPInstanceUID" },
+  { 0x0008115A, VR::UI, VM(1, VM::N, 1), "SOPClassesSupported" },
+  { 0x00081160, VR::IS, VM(1, VM::N, 1), "ReferencedFrameNumber" },
+  { 0x00081161, VR::UL, VM(1, VM::N, 1), "SimpleFrameList" },
+  { 0x00081162, VR::UL, VM(1, VM::N, 3), "CalculatedFrameList" },
+  { 0x00081163, VR::FD, VM(2, 2, 1), "TimeRange" },
+  { 0x00081164, VR::SQ, VM(1, 1, 1), "FrameExtractionSequence" },
+  { 0x00081167, VR::UI, VM(1, 1, 1), "MultiFrameSourceSOPInstanceUID" },
+  { 0x00081190, VR::UR, VM(1, 1, 1), "RetrieveURL" },
+  { 0x00081195, VR::UI, VM(1, 1, 1), "TransactionUID" },
+  { 0x00081196, VR::US, VM(1, 1, 1), "WarningReason" },
+  { 0x00081197, VR::US, VM(1, 1, 1), "FailureReason" },
+  { 0x00081198, VR::SQ, VM(1, 1, 1), "FailedSOPSequence" },
+  { 0x00081199, VR::SQ, VM(1, 1, 1), "ReferencedSOPSequence" },
+  { 0x0008119A, VR::SQ, VM(1, 1, 1), "OtherFailuresSequence" },
+  { 0x00081200, VR::SQ, VM(1, 1, 1), "StudiesContainingOtherReferencedInstancesSequence" },
+  { 0x00081250, VR::SQ, VM(1, 1, 1), "RelatedSeriesSequence" },
+  { 0x00082111, VR::ST, VM(1, 1, 1), "DerivationDescription" },
+  { 0x00082112, VR::SQ, VM(1, 1, 1), "SourceImageSequence" },
+  { 0x00082120, VR::SH, VM(1, 1, 1), "StageName" },
+  { 0x00082122, VR::IS, VM(1, 1, 1), "StageNumber" },
+  { 0x00082124, VR::IS, VM(1, 1, 1), "NumberOfStages" },
+  { 0x00082127, VR::SH, VM(1, 1, 1), "ViewName" },
+  { 0x00082128, VR::IS, VM(1, 1, 1), "ViewNumber" },
+  { 0x00082129, VR::IS, VM(1, 1, 1), "NumberOfEventTimers" },
+  { 0x0008212A, VR::IS, VM(1, 1, 1), "NumberOfViewsInStage" },
+  { 0x00082130, VR::DS, VM(1, VM::N, 1), "EventElapsedTimes" },
+  { 0x00082132, VR::LO, VM(1, VM::N, 1), "EventTimerNames" },
+  { 0x00082133, VR::SQ, VM(1, 1, 1), "EventTimerSequence" },
+  { 0x00082134, VR::FD, VM(1, 1, 1), "EventTimeOffset" },
+  { 0x00082135, VR::SQ, VM(1, 1, 1), "EventCodeSequence" },
+  { 0x00082142, VR::IS, VM(1, 1, 1), "StartTrim" },
+  { 0x00082143, VR::IS, VM(1, 1, 1), "StopTrim" },
+  { 0x00082144, VR::IS, VM(1, 1, 1), "RecommendedDisplayFrameRate" },
+  { 0x00082218, VR::SQ, VM(1, 1, 1), "AnatomicRegionSequence" },
+  { 0x00082220, VR::SQ, VM(1, 1, 1), "AnatomicRegionModifierSequence" },
+  { 0x00082228, VR::SQ, VM(1, 1, 1), "PrimaryAnatomicStructureSequence" },
+  { 0x00082229, VR::SQ, VM(1, 1, 1), "AnatomicStructureSpaceOrRegionSequence" },
+  { 0x00082230, VR::SQ, VM(1, 1, 1), "PrimaryAnatomicStructureModifierSequence" },
+  { 0x00083001, VR::SQ, VM(1, 1, 1), "AlternateRepresentationSequence" },
+  { 0x00083010, VR::UI, VM(1, VM::N, 1), "IrradiationEventUID" },
+  { 0x00083011, VR::SQ, VM(1, 1, 1), "SourceIrradiationEventSequence" },
+  { 0x00083012, VR::UI, VM(1, 1, 1), "RadiopharmaceuticalAdministrationEventUID" },
+  { 0x00089007, VR::CS, VM(4, 4, 1), "FrameType" },
+  { 0x00089092, VR::SQ, VM(1, 1, 1), "ReferencedImageEvidenceSequence" },
+  { 0x00089121, VR::SQ, VM(1, 1, 1), "ReferencedRawDataSequence" },
+  { 0x00089123, VR::UI, VM(1, 1, 1), "CreatorVersionUID" },
+  { 0x00089124, VR::SQ, VM(1, 1, 1), "DerivationImageSequence" },
+  { 0x00089154, VR::SQ, VM(1, 1, 1), "SourceImageEvidenceSequence" },
+  { 0x00089205, VR::CS, VM(1, 1, 1), "PixelPresentation" },
+  { 0x00089206, VR::CS, VM(1, 1, 1), "VolumetricProperties" },
+  { 0x00089207, VR::CS, VM(1, 1, 1), "VolumeBasedCalculationTechnique" },
+  { 0x00089208, VR::CS, VM(1, 1, 1), "ComplexImageComponent" },
+  { 0x00089209, VR::CS, VM(1, 1, 1), "AcquisitionContrast" },
+  { 0x00089215, VR::SQ, VM(1, 1, 1), "DerivationCodeSequence" },
+  { 0x00089237, VR::SQ, VM(1, 1, 1), "ReferencedPresentationStateSequence" },
+  { 0x00089410, VR::SQ, VM(1, 1, 1), "ReferencedOtherPlaneSequence" },
+  { 0x00089458, VR::SQ, VM(1, 1, 1), "FrameDisplaySequence" },
+  { 0x00089459, VR::FL, VM(1, 1, 1), "RecommendedDisplayFrameRateInFloat" },
+  { 0x00089460, VR::CS, VM(1, 1, 1), "SkipFrameRangeFlag" },
+  { 0x00100010, VR::PN, VM(1, 1, 1), "PatientName" },
+  { 0x00100020, VR::LO, VM(1, 1, 1), "PatientID" },
+  { 0x00100021, VR::LO, VM(1, 1, 1), "IssuerOfPatientID" },
+  { 0x00100022, VR::CS, VM(1, 1, 1), "TypeOfPatientID" },
+  { 0x00100024, VR::SQ, VM(1, 1, 1), "IssuerOfPatientIDQualifiersSequence" },
+  { 0x00100026, VR::SQ, VM(1, 1, 1), "SourcePatientGroupIdentificationSequence" },
+  { 0x00100027, VR::SQ, VM(1, 1, 1), "GroupOfPatientsIdentificationSequence" },
+  { 0x00100028, VR::US, VM(3, 3, 1), "SubjectRelativePositionInImage" },
+  { 0x00100030, VR::DA, VM(1, 1, 1), "PatientBirthDate" },
+  { 0x00100032, VR::TM, VM(1, 1, 1), "PatientBirthTime" },
+  { 0x00100040, VR::CS, VM(1, 1, 1), "PatientSex" },
+  { 0x00100050, VR::SQ, VM(1, 1, 1), "PatientInsurancePlanCodeSequence" },
+  { 0x00100101, VR::SQ, VM(1, 1, 1), "PatientPrimaryLanguageCodeSequence" },
+  { 0x00100102, VR::SQ, VM(1, 1, 1), "PatientPrimaryLanguageModifierCodeSequence" },
+  { 0x00100200, VR::CS, VM(1, 1, 1), "QualityControlSubject" },
+  { 0x00100201, VR::SQ, VM(1, 1, 1), "QualityControlSubjectTypeCodeSequence" },
+  { 0x00100212, VR::UC, VM(1, 1, 1), "StrainDescription" },
+  { 0x00100213, VR::LO, VM(1, 1, 1), "StrainNomenclature" },
+  { 0x00100214, VR::LO, VM(1, 1, 1), "StrainStockNumber" },
+  { 0x00100215, VR::SQ, VM(1, 1, 1), "StrainSourceRegistryCodeSequence" },
+  { 0x00100216, VR::SQ, VM(1, 1, 1), "StrainStockSequence" },
+  { 0x00100217, VR::LO, VM(1, 1, 1), "StrainSource" },
+  { 0x00100218, VR::UT, VM(1, 1, 1), "StrainAdditionalInformation" },
+  { 0x00100219, VR::SQ, VM(1, 1, 1), "StrainCodeSequence" },
+  { 0x00101000, VR::LO, VM(1, 1, 1), "OtherPatientIDs" },
+  { 0x00101001, VR::PN, VM(1, VM::N, 1), "OtherPatientNames" },
+  { 0x00101002, VR::SQ, VM(1, 1, 1), "OtherPatientIDsSequence" },
+  { 0x00101005, VR::PN, VM(1, 1, 1), "PatientBirthName" },
+  { 0x00101010, VR::AS, VM(1, 1, 1), "PatientAge" },
+  { 0x00101020, VR::DS, VM(1, 1, 1), "PatientSize" },
+  { 0x00101021, VR::SQ, VM(1, 1, 1), "PatientSizeCodeSequence" },
+  { 0x00101030, VR::DS, VM(1, 1, 1), "PatientWeight" },
+  { 0x00101040, VR::LO, VM(1, 1, 1), "PatientAddress" },
+  { 0x00101060, VR::PN, VM(1, 1, 1), "PatientMotherBirthName" },
+  { 0x00101080, VR::LO, VM(1, 1, 1), "MilitaryRank" },
+  { 0x00101081, VR::LO, VM(1, 1, 1), "BranchOfService" },
+  { 0x00101090, VR::LO, VM(1, 1, 1), "MedicalRecordLocator" },
+  { 0x00101100, VR::SQ, VM(1, 1, 1), "ReferencedPatientPhotoSequence" },
+  { 0x00102000, VR::LO, VM(1, VM::N, 1), "MedicalAlerts" },
+  { 0x00102110, VR::LO, VM(1, VM::N, 1), "Allergies" },
+  { 0x00102150, VR::LO, VM(1, 1, 1), "CountryOfResidence" },
+  { 0x00102152, VR::LO, VM(1, 1, 1), "RegionOfResidence" },
+  { 0x00102154, VR::SH, VM(1, VM::N, 1), "PatientTelephoneNumbers" },
+  { 0x00102155, VR::LT, VM(1, 1, 1), "PatientTelecomInformation" },
+  { 0x00102160, VR::SH, VM(1, 1, 1), "EthnicGroup" },
+  { 0x00102180, VR::SH, VM(1, 1, 1), "Occupation" },
+  { 0x001021A0, VR::CS, VM(1, 1, 1), "SmokingStatus" },
+  { 0x001021B0, VR::LT, VM(1, 1, 1), "AdditionalPatientHistory" },
+  { 0x001021C0, VR::US, VM(1, 1, 1), "PregnancyStatus" },
+  { 0x001021D0, VR::DA, VM(1, 1, 1), "LastMenstrualDate" },
+  { 0x001021F0, VR::LO, VM(1, 1, 1), "PatientReligiousPreference" },
+  { 0x00102201, VR::LO, VM(1, 1, 1), "PatientSpeciesDescription" },
+  { 0x00102202, VR::SQ, VM(1, 1, 1), "PatientSpeciesCodeSequence" },
+  { 0x00102203, VR::CS, VM(1, 1, 1), "PatientSexNeutered" },
+  { 0x00102210, VR::CS, VM(1, 1, 1), "AnatomicalOrientationType" },
+  { 0x00102292, VR::LO, VM(1, 1, 1), "PatientBreedDescription" },
+  { 0x00102293, VR::SQ, VM(1, 1, 1), "PatientBreedCodeSequence" },
+  { 0x00102294, VR::SQ, VM(1, 1, 1), "BreedRegistrationSequence" },
+  { 0x00102295, VR::LO, VM(1, 1, 1), "BreedRegistrationNumber" },
+  { 0x00102296, VR::SQ, VM(1, 1, 1), "BreedRegistryCodeSequence" },
+  { 0x00102297, VR::PN, VM(1, 1, 1), "ResponsiblePerson" },
+  { 0x00102298, VR::CS, VM(1, 1, 1), "ResponsiblePersonRole" },
+  { 0x00102299, VR::LO, VM(1, 1, 1), "ResponsibleOrganization" },
+  { 0x00104000, VR::LT, VM(1, 1, 1), "PatientComments" },
+  { 0x00109431, VR::FL, VM(1, 1, 1), "ExaminedBodyThickness" },
+  { 0x00120010, VR::LO, VM(1, 1, 1), "ClinicalTrialSponsorName" },
+  { 0x00120020, VR::LO, VM(1, 1, 1), "ClinicalTrialProtocolID" },
+  { 0x00120021, VR::LO, VM(1, 1, 1), "ClinicalTrialProtocolName" },
+  { 0x00120030, VR::LO, VM(1, 1, 1), "ClinicalTrialSiteID" },
+  { 0x00120031, VR::LO, VM(1, 1, 1), "ClinicalTrialSiteName" },
+  { 0x00120040, VR::LO, VM(1, 1, 1), "ClinicalTrialSubjectID" },
+  { 0x00120042, VR::LO, VM(1, 1, 1), "ClinicalTrialSubjectReadingID" },
+  { 0x00120050, VR::LO, VM(1, 1, 1), "ClinicalTrialTimePointID" },
+  { 0x00120051, VR::ST, VM(1, 1, 1), "ClinicalTrialTimePointDescription" },
+  { 0x00120060, VR::LO, VM(1, 1, 1), "ClinicalTrialCoordinatingCenterName" },
+  { 0x00120062, VR::CS, VM(1, 1, 1), "PatientIdentityRemoved" },
+  { 0x00120063, VR::LO, VM(1, VM::N, 1), "DeidentificationMethod" },
+  { 0x00120064, VR::SQ, VM(1, 1, 1), "DeidentificationMethodCodeSequence" },
+  { 0x00120071, VR::LO, VM(1, 1, 1), "ClinicalTrialSeriesID" },
+  { 0x00120072, VR::LO, VM(1, 1, 1), "ClinicalTrialSeriesDescription" },
+  { 0x00120081, VR::LO, VM(1, 1, 1), "ClinicalTrialProtocolEthicsCommitteeName" },
+  { 0x00120082, VR::LO, VM(1, 1, 1), "ClinicalTrialProtocolEthicsCommitteeApprovalNumber" },
+  { 0x00120083, VR::SQ, VM(1, 1, 1), "ConsentForClinicalTrialUseSequence" },
+  { 0x00120084, VR::CS, VM(1, 1, 1), "DistributionType" },
+  { 0x00120085, VR::CS, VM(1, 1, 1), "ConsentForDistributionFlag" },
+  { 0x00140025, VR::ST, VM(1, 1, 1), "ComponentManufacturingProcedure" },
+  { 0x00140028, VR::ST, VM(1, 1, 1), "ComponentManufacturer" },
+  { 0x00140030, VR::DS, VM(1, VM::N, 1), "MaterialThickness" },
+  { 0x00140032, VR::DS, VM(1, VM::N, 1), "MaterialPipeDiameter" },
+  { 0x00140034, VR::DS, VM(1, VM::N, 1), "MaterialIsolationDiameter" },
+  { 0x00140042, VR::ST, VM(1, 1, 1), "MaterialGrade" },
+  { 0x00140044, VR::ST, VM(1, 1, 1), "MaterialPropertiesDescription" },
+  { 0x00140046, VR::LT, VM(1, 1, 1), "MaterialNotes" },
+  { 0x00140050, VR::CS, VM(1, 1, 1), "ComponentShape" },
+  { 0x00140052, VR::CS, VM(1, 1, 1), "CurvatureType" },
+  { 0x00140054, VR::DS, VM(1, 1, 1), "OuterDiameter" },
+  { 0x00140056, VR::DS, VM(1, 1, 1), "InnerDiameter" },
+  { 0x00140100, VR::LO, VM(1, VM::N, 1), "ComponentWelderIDs" },
+  { 0x00140101, VR::CS, VM(1, 1, 1), "SecondaryApprovalStatus" },
+  { 0x00140102, VR::DA, VM(1, 1, 1), "SecondaryReviewDate" },
+  { 0x00140103, VR::TM, VM(1, 1, 1), "SecondaryReviewTime" },
+  { 0x00140104, VR::PN, VM(1, 1, 1), "SecondaryReviewerName" },
+  { 0x00140105, VR::ST, VM(1, 1, 1), "RepairID" },
+  { 0x00140106, VR::SQ, VM(1, 1, 1), "MultipleComponentApprovalSequence" },
+  { 0x00140107, VR::CS, VM(1, VM::N, 1), "OtherApprovalStatus" },
+  { 0x00140108, VR::CS, VM(1, VM::N, 1), "OtherSecondaryApprovalStatus" },
+  { 0x00141010, VR::ST, VM(1, 1, 1), "ActualEnvironmentalConditions" },
+  { 0x00141020, VR::DA, VM(1, 1, 1), "ExpiryDate" },
+  { 0x00141040, VR::ST, VM(1, 1, 1), "EnvironmentalConditions" },
+  { 0x00142002, VR::SQ, VM(1, 1, 1), "EvaluatorSequence" },
+  { 0x00142004, VR::IS, VM(1, 1, 1), "EvaluatorNumber" },
+  { 0x00142006, VR::PN, VM(1, 1, 1), "EvaluatorName" },
+  { 0x00142008, VR::IS, VM(1, 1, 1), "EvaluationAttempt" },
+  { 0x00142012, VR::SQ, VM(1, 1, 1), "IndicationSequence" },
+  { 0x00142014, VR::IS, VM(1, 1, 1), "IndicationNumber" },
+  { 0x00142016, VR::SH, VM(1, 1, 1), "IndicationLabel" },
+  { 0x00142018, VR::ST, VM(1, 1, 1), "IndicationDescription" },
+  { 0x0014201A, VR::CS, VM(1, VM::N, 1), "IndicationType" },
+  { 0x0014201C, VR::CS, VM(1, 1, 1), "IndicationDisposition" },
+  { 0x0014201E, VR::SQ, VM(1, 1, 1), "IndicationROISequence" },
+  { 0x00142030, VR::SQ, VM(1, 1, 1), "IndicationPhysicalPropertySequence" },
+  { 0x00142032, VR::SH, VM(1, 1, 1), "PropertyLabel" },
+  { 0x00142202, VR::IS, VM(1, 1, 1), "CoordinateSystemNumberOfAxes" },
+  { 0x00142204, VR::SQ, VM(1, 1, 1), "CoordinateSystemAxesSequence" },
+  { 0x00142206, VR::ST, VM(1, 1, 1), "CoordinateSystemAxisDescription" },
+  { 0x00142208, VR::CS, VM(1, 1, 1), "CoordinateSystemDataSetMapping" },
+  { 0x0014220A, VR::IS, VM(1, 1, 1), "CoordinateSystemAxisNumber" },
+  { 0x0014220C, VR::CS, VM(1, 1, 1), "CoordinateSystemAxisType" },
+  { 0x0014220E, VR::CS, VM(1, 1, 1), "CoordinateSystemAxisUnits" },
+  { 0x00142210, VR::OB, VM(1, 1, 1), "CoordinateSystemAxisValues" },
+  { 0x00142220, VR::SQ, VM(1, 1, 1), "CoordinateSystemTransformSequence" },
+  { 0x00142222, VR::ST, VM(1, 1, 1), "TransformDescription" },
+  { 0x00142224, VR::IS, VM(1, 1, 1), "TransformNumberOfAxes" },
+  { 0x00142226, VR::IS, VM(1, VM::N, 1), "TransformOrderOfAxes" },
+  { 0x00142228, VR::CS, VM(1, 1, 1), "TransformedAxisUnits" },
+  { 0x0014222A, VR::DS, VM(1, VM::N, 1), "CoordinateSystemTransformRotationAndScaleMatrix" },
+  { 0x0014222C, VR::DS, VM(1, VM::N, 1), "CoordinateSystemTransformTranslationMatrix" },
+  { 0x00143011, VR::DS, VM(1, 1, 1), "InternalDetectorFrameTime" },
+  { 0x00143012, VR::DS, VM(1, 1, 1), "NumberOfFramesIntegrated" },
+  { 0x00143020, VR::SQ, VM(1, 1, 1), "DetectorTemperatureSequence" },
+  { 0x00143022, VR::ST, VM(1, 1, 1), "SensorName" },
+  { 0x00143024, VR::DS, VM(1, 1, 1), "HorizontalOffsetOfSensor" },
+  { 0x00143026, VR::DS, VM(1, 1, 1), "VerticalOffsetOfSensor" },
+  { 0x00143028, VR::DS, VM(1, 1, 1), "SensorTemperature" },
+  { 0x00143040, VR::SQ, VM(1, 1, 1), "DarkCurrentSequence" },
+  { 0x00143050, VR::OB, VM(1, 1, 1), "DarkCurrentCounts" },
+  { 0x00143060, VR::SQ, VM(1, 1, 1), "GainCorrectionReferenceSequence" },
+  { 0x00143070, VR::OB, VM(1, 1, 1), "AirCounts" },
+  { 0x00143071, VR::DS, VM(1, 1, 1), "KVUsedInGainCalibration" },
+  { 0x00143072, VR::DS, VM(1, 1, 1), "MAUsedInGainCalibration" },
+  { 0x00143073, VR::DS, VM(1, 1, 1), "NumberOfFramesUsedForIntegration" },
+  { 0x00143074, VR::LO, VM(1, 1, 1), "FilterMaterialUsedInGainCalibration" },
+  { 0x00143075, VR::DS, VM(1, 1, 1), "FilterThicknessUsedInGainCalibration" },
+  { 0x00143076, VR::DA, VM(1, 1, 1), "DateOfGainCalibration" },
+  { 0x00143077, VR::TM, VM(1, 1, 1), "TimeOfGainCalibration" },
+  { 0x00143080, VR::OB, VM(1, 1, 1), "BadPixelImage" },
+  { 0x00143099, VR::LT, VM(1, 1, 1), "CalibrationNotes" },
+  { 0x00144002, VR::SQ, VM(1, 1, 1), "PulserEquipmentSequence" },
+  { 0x00144004, VR::CS, VM(1, 1, 1), "PulserType" },
+  { 0x00144006, VR::LT, VM(1, 1, 1), "PulserNotes" },
+  { 0x00144008, VR::SQ, VM(1, 1, 1), "ReceiverEquipmentSequence" },
+  { 0x0014400A, VR::CS, VM(1, 1, 1), "AmplifierType" },
+  { 0x0014400C, VR::LT, VM(1, 1, 1), "ReceiverNotes" },
+  { 0x0014400E, VR::SQ, VM(1, 1, 1), "PreAmplifierEquipmentSequence" },
+  { 0x0014400F, VR::LT, VM(1, 1, 1), "PreAmplifierNotes" },
+  { 0x00144010, VR::SQ, VM(1, 1, 1), "TransmitTransducerSequence" },
+  { 0x00144011, VR::SQ, VM(1, 1, 1), "ReceiveTransducerSequence" },
+  { 0x00144012, VR::US, VM(1, 1, 1), "NumberOfElements" },
+  { 0x00144013, VR::CS, VM(1, 1, 1), "ElementShape" },
+  { 0x00144014, VR::DS, VM(1, 1, 1), "ElementDimensionA" },
+  { 0x00144015, VR::DS, VM(1, 1, 1), "ElementDimensionB" },
+  { 0x00144016, VR::DS, VM(1, 1, 1), "ElementPitchA" },
+  { 0x00144017, VR::DS, VM(1, 1, 1), "MeasuredBeamDimensionA" },
+  { 0x00144018, VR::DS, VM(1, 1, 1), "MeasuredBeamDimensionB" },
+  { 0x00144019, VR::DS, VM(1, 1, 1), "LocationOfMeasuredBeamDiameter" },
+  { 0x0014401A, VR::DS, VM(1, 1, 1), "NominalFrequency" },
+  { 0x0014401B, VR::DS, VM(1, 1, 1), "MeasuredCenterFrequency" },
+  { 0x0014401C, VR::DS, VM(1, 1, 1), "MeasuredBandwidth" },
+  { 0x0014401D, VR::DS, VM(1, 1, 1), "ElementPitchB" },
+  { 0x00144020, VR::SQ, VM(1, 1, 1), "PulserSettingsSequence" },
+  { 0x00144022, VR::DS, VM(1, 1, 1), "PulseWidth" },
+  { 0x00144024, VR::DS, VM(1, 1, 1), "ExcitationFrequency" },
+  { 0x00144026, VR::CS, VM(1, 1, 1), "ModulationType" },
+  { 0x00144028, VR::DS, VM(1, 1, 1), "Damping" },
+  { 0x00144030, VR::SQ, VM(1, 1, 1), "ReceiverSettingsSequence" },
+  { 0x00144031, VR::DS, VM(1, 1, 1), "AcquiredSoundpathLength" },
+  { 0x00144032, VR::CS, VM(1, 1, 1), "AcquisitionCompressionType" },
+  { 0x00144033, VR::IS, VM(1, 1, 1), "AcquisitionSampleSize" },
+  { 0x00144034, VR::DS, VM(1, 1, 1), "RectifierSmoothing" },
+  { 0x00144035, VR::SQ, VM(1, 1, 1), "DACSequence" },
+  { 0x00144036, VR::CS, VM(1, 1, 1), "DACType" },
+  { 0x00144038, VR::DS, VM(1, VM::N, 1), "DACGainPoints" },
+  { 0x0014403A, VR::DS, VM(1, VM::N, 1), "DACTimePoints" },
+  { 0x0014403C, VR::DS, VM(1, VM::N, 1), "DACAmplitude" },
+  { 0x00144040, VR::SQ, VM(1, 1, 1), "PreAmplifierSettingsSequence" },
+  { 0x00144050, VR::SQ, VM(1, 1, 1), "TransmitTransducerSettingsSequence" },
+  { 0x00144051, VR::SQ, VM(1, 1, 1), "ReceiveTransducerSettingsSequence" },
+  { 0x00144052, VR::DS, VM(1, 1, 1), "IncidentAngle" },
+  { 0x00144054, VR::ST, VM(1, 1, 1), "CouplingTechnique" },
+  { 0x00144056, VR::ST, VM(1, 1, 1), "CouplingMedium" },
+  { 0x00144057, VR::DS, VM(1, 1, 1), "CouplingVelocity" },
+  { 0x00144058, VR::DS, VM(1, 1, 1), "ProbeCenterLocationX" },
+  { 0x00144059, VR::DS, VM(1, 1, 1), "ProbeCenterLocationZ" },
+  { 0x0014405A, VR::DS, VM(1, 1, 1), "SoundPathLength" },
+  { 0x0014405C, VR::ST, VM(1, 1, 1), "DelayLawIdentifier" },
+  { 0x00144060, VR::SQ, VM(1, 1, 1), "GateSettingsSequence" },
+  { 0x00144062, VR::DS, VM(1, 1, 1), "GateThreshold" },
+  { 0x00144064, VR::DS, VM(1, 1, 1), "VelocityOfSound" },
+  { 0x00144070, VR::SQ, VM(1, 1, 1), "CalibrationSettingsSequence" },
+  { 0x00144072, VR::ST, VM(1, 1, 1), "CalibrationProcedure" },
+  { 0x00144074, VR::SH, VM(1, 1, 1), "ProcedureVersion" },
+  { 0x00144076, VR::DA, VM(1, 1, 1), "ProcedureCreationDate" },
+  { 0x00144078, VR::DA, VM(1, 1, 1), "ProcedureExpirationDate" },
+  { 0x0014407A, VR::DA, VM(1, 1, 1), "ProcedureLastModifiedDate" },
+  { 0x0014407C, VR::TM, VM(1, VM::N, 1), "CalibrationTime" },
+  { 0x0014407E, VR::DA, VM(1, VM::N, 1), "CalibrationDate" },
+  { 0x00144080, VR::SQ, VM(1, 1, 1), "ProbeDriveEquipmentSequence" },
+  { 0x00144081, VR::CS, VM(1, 1, 1), "DriveType" },
+  { 0x00144082, VR::LT, VM(1, 1, 1), "ProbeDriveNotes" },
+  { 0x00144083, VR::SQ, VM(1, 1, 1), "DriveProbeSequence" },
+  { 0x00144084, VR::DS, VM(1, 1, 1), "ProbeInductance" },
+  { 0x00144085, VR::DS, VM(1, 1, 1), "ProbeResistance" },
+  { 0x00144086, VR::SQ, VM(1, 1, 1), "ReceiveProbeSequence" },
+  { 0x00144087, VR::SQ, VM(1, 1, 1), "ProbeDriveSettingsSequence" },
+  { 0x00144088, VR::DS, VM(1, 1, 1), "BridgeResistors" },
+  { 0x00144089, VR::DS, VM(1, 1, 1), "ProbeOrientationAngle" },
+  { 0x0014408B, VR::DS, VM(1, 1, 1), "UserSelectedGainY" },
+  { 0x0014408C, VR::DS, VM(1, 1, 1), "UserSelectedPhase" },
+  { 0x0014408D, VR::DS, VM(1, 1, 1), "UserSelectedOffsetX" },
+  { 0x0014408E, VR::DS, VM(1, 1, 1), "UserSelectedOffsetY" },
+  { 0x00144091, VR::SQ, VM(1, 1, 1), "ChannelSettingsSequence" },
+  { 0x00144092, VR::DS, VM(1, 1, 1), "ChannelThreshold" },
+  { 0x0014409A, VR::SQ, VM(1, 1, 1), "ScannerSettingsSequence" },
+  { 0x0014409B, VR::ST, VM(1, 1, 1), "ScanProcedure" },
+  { 0x0014409C, VR::DS, VM(1, 1, 1), "TranslationRateX" },
+  { 0x0014409D, VR::DS, VM(1, 1, 1), "TranslationRateY" },
+  { 0x0014409F, VR::DS, VM(1, 1, 1), "ChannelOverlap" },
+  { 0x001440A0, VR::LO, VM(1, 1, 1), "ImageQualityIndicatorType" },
+  { 0x001440A1, VR::LO, VM(1, 1, 1), "ImageQualityIndicatorMaterial" },
+  { 0x001440A2, VR::LO, VM(1, 1, 1), "ImageQualityIndicatorSize" },
+  { 0x00145002, VR::IS, VM(1, 1, 1), "LINACEnergy" },
+  { 0x00145004, VR::IS, VM(1, 1, 1), "LINACOutput" },
+  { 0x00145100, VR::US, VM(1, 1, 1), "ActiveAperture" },
+  { 0x00145101, VR::DS, VM(1, 1, 1), "TotalAperture" },
+  { 0x00145102, VR::DS, VM(1, 1, 1), "ApertureElevation" },
+  { 0x00145103, VR::DS, VM(1, 1, 1), "MainLobeAngle" },
+  { 0x00145104, VR::DS, VM(1, 1, 1), "MainRoofAngle" },
+  { 0x00145105, VR::CS, VM(1, 1, 1), "ConnectorType" },
+  { 0x00145106, VR::SH, VM(1, 1, 1), "WedgeModelNumber" },
+  { 0x00145107, VR::DS, VM(1, 1, 1), "WedgeAngleFloat" },
+  { 0x00145108, VR::DS, VM(1, 1, 1), "WedgeRoofAngle" },
+  { 0x00145109, VR::CS, VM(1, 1, 1), "WedgeElement1Position" },
+  { 0x0014510A, VR::DS, VM(1, 1, 1), "WedgeMaterialVelocity" },
+  { 0x0014510B, VR::SH, VM(1, 1, 1), "WedgeMaterial" },
+  { 0x0014510C, VR::DS, VM(1, 1, 1), "WedgeOffsetZ" },
+  { 0x0014510D, VR::DS, VM(1, 1, 1), "WedgeOriginOffsetX" },
+  { 0x0014510E, VR::DS, VM(1, 1, 1), "WedgeTimeDelay" },
+  { 0x0014510F, VR::SH, VM(1, 1, 1), "WedgeName" },
+  { 0x00145110, VR::SH, VM(1, 1, 1), "WedgeManufacturerName" },
+  { 0x00145111, VR::LO, VM(1, 1, 1), "WedgeDescription" },
+  { 0x00145112, VR::DS, VM(1, 1, 1), "NominalBeamAngle" },
+  { 0x00145113, VR::DS, VM(1, 1, 1), "WedgeOffsetX" },
+  { 0x00145114, VR::DS, VM(1, 1, 1), "WedgeOffsetY" },
+  { 0x00145115, VR::DS, VM(1, 1, 1), "WedgeTotalLength" },
+  { 0x00145116, VR::DS, VM(1, 1, 1), "WedgeInContactLength" },
+  { 0x00145117, VR::DS, VM(1, 1, 1), "WedgeFrontGap" },
+  { 0x00145118, VR::DS, VM(1, 1, 1), "WedgeTotalHeight" },
+  { 0x00145119, VR::DS, VM(1, 1, 1), "WedgeFrontHeight" },
+  { 0x0014511A, VR::DS, VM(1, 1, 1), "WedgeRearHeight" },
+  { 0x0014511B, VR::DS, VM(1, 1, 1), "WedgeTotalWidth" },
+  { 0x0014511C, VR::DS, VM(1, 1, 1), "WedgeInContactWidth" },
+  { 0x0014511D, VR::DS, VM(1, 1, 1), "WedgeChamferHeight" },
+  { 0x0014511E, VR::CS, VM(1, 1, 1), "WedgeCurve" },
+  { 0x0014511F, VR::DS, VM(1, 1, 1), "RadiusAlongWedge" },
+  { 0x00180010, VR::LO, VM(1, 1, 1), "ContrastBolusAgent" },
+  { 0x00180012, VR::SQ, VM(1, 1, 1), "ContrastBolusAgentSequence" },
+  { 0x00180013, VR::FL, VM(1, 1, 1), "ContrastBolusT1Relaxivity" },
+  { 0x00180014, VR::SQ, VM(1, 1, 1), "ContrastBolusAdministrationRouteSequence" },
+  { 0x00180015, VR::CS, VM(1, 1, 1), "BodyPartExamined" },
+  { 0x00180020, VR::CS, VM(1, VM::N, 1), "ScanningSequence" },
+  { 0x00180021, VR::CS, VM(1, VM::N, 1), "SequenceVariant" },
+  { 0x00180022, VR::CS, VM(1, VM::N, 1), "ScanOptions" },
+  { 0x00180023, VR::CS, VM(1, 1, 1), "MRAcquisitionType" },
+  { 0x00180024, VR::SH, VM(1, 1, 1), "SequenceName" },
+  { 0x00180025, VR::CS, VM(1, 1, 1), "AngioFlag" },
+  { 0x00180026, VR::SQ, VM(1, 1, 1), "InterventionDrugInformationSequence" },
+  { 0x00180027, VR::TM, VM(1, 1, 1), "InterventionDrugStopTime" },
+  { 0x00180028, VR::DS, VM(1, 1, 1), "InterventionDrugDose" },
+  { 0x00180029, VR::SQ, VM(1, 1, 1), "InterventionDrugCodeSequence" },
+  { 0x0018002A, VR::SQ, VM(1, 1, 1), "AdditionalDrugSequence" },
+  { 0x00180031, VR::LO, VM(1, 1, 1), "Radiopharmaceutical" },
+  { 0x00180034, VR::LO, VM(1, 1, 1), "InterventionDrugName" },
+  { 0x00180035, VR::TM, VM(1, 1, 1), "InterventionDrugStartTime" },
+  { 0x00180036, VR::SQ, VM(1, 1, 1), "InterventionSequence" },
+  { 0x00180038, VR::CS, VM(1, 1, 1), "InterventionStatus" },
+  { 0x0018003A, VR::ST, VM(1, 1, 1), "InterventionDescription" },
+  { 0x00180040, VR::IS, VM(1, 1, 1), "CineRate" },
+  { 0x00180042, VR::CS, VM(1, 1, 1), "InitialCineRunState" },
+  { 0x00180050, VR::DS, VM(1, 1, 1), "SliceThickness" },
+  { 0x00180060, VR::DS, VM(1, 1, 1), "KVP" },
+  { 0x00180070, VR::IS, VM(1, 1, 1), "CountsAccumulated" },
+  { 0x00180071, VR::CS, VM(1, 1, 1), "AcquisitionTerminationCondition" },
+  { 0x00180072, VR::DS, VM(1, 1, 1), "EffectiveDuration" },
+  { 0x00180073, VR::CS, VM(1, 1, 1), "AcquisitionStartCondition" },
+  { 0x00180074, VR::IS, VM(1, 1, 1), "AcquisitionStartConditionData" },
+  { 0x00180075, VR::IS, VM(1, 1, 1), "AcquisitionTerminationConditionData" },
+  { 0x00180080, VR::DS, VM(1, 1, 1), "RepetitionTime" },
+  { 0x00180081, VR::DS, VM(1, 1, 1), "EchoTime" },
+  { 0x00180082, VR::DS, VM(1, 1, 1), "InversionTime" },
+  { 0x00180083, VR::DS, VM(1, 1, 1), "NumberOfAverages" },
+  { 0x00180084, VR::DS, VM(1, 1, 1), "ImagingFrequency" },
+  { 0x00180085, VR::SH, VM(1, 1, 1), "ImagedNucleus" },
+  { 0x00180086, VR::IS, VM(1, VM::N, 1), "EchoNumbers" },
+  { 0x00180087, VR::DS, VM(1, 1, 1), "MagneticFieldStrength" },
+  { 0x00180088, VR::DS, VM(1, 1, 1), "SpacingBetweenSlices" },
+  { 0x00180089, VR::IS, VM(1, 1, 1), "NumberOfPhaseEncodingSteps" },
+  { 0x00180090, VR::DS, VM(1, 1, 1), "DataCollectionDiameter" },
+  { 0x00180091, VR::IS, VM(1, 1, 1), "EchoTrainLength" },
+  { 0x00180093, VR::DS, VM(1, 1, 1), "PercentSampling" },
+  { 0x00180094, VR::DS, VM(1, 1, 1), "PercentPhaseFieldOfView" },
+  { 0x00180095, VR::DS, VM(1, 1, 1), "PixelBandwidth" },
+  { 0x00181000, VR::LO, VM(1, 1, 1), "DeviceSerialNumber" },
+  { 0x00181002, VR::UI, VM(1, 1, 1), "DeviceUID" },
+  { 0x00181003, VR::LO, VM(1, 1, 1), "DeviceID" },
+  { 0x00181004, VR::LO, VM(1, 1, 1), "PlateID" },
+  { 0x00181005, VR::LO, VM(1, 1, 1), "GeneratorID" },
+  { 0x00181006, VR::LO, VM(1, 1, 1), "GridID" },
+  { 0x00181007, VR::LO, VM(1, 1, 1), "CassetteID" },
+  { 0x00181008, VR::LO, VM(1, 1, 1), "GantryID" },
+  { 0x00181010, VR::LO, VM(1, 1, 1), "SecondaryCaptureDeviceID" },
+  { 0x00181012, VR::DA, VM(1, 1, 1), "DateOfSecondaryCapture" },
+  { 0x00181014, VR::TM, VM(1, 1, 1), "TimeOfSecondaryCapture" },
+  { 0x00181016, VR::LO, VM(1, 1, 1), "SecondaryCaptureDeviceManufacturer" },
+  { 0x00181018, VR::LO, VM(1, 1, 1), "SecondaryCaptureDeviceManufacturerModelName" },
+  { 0x00181019, VR::LO, VM(1, VM::N, 1), "SecondaryCaptureDeviceSoftwareVersions" },
+  { 0x00181020, VR::LO, VM(1, VM::N, 1), "SoftwareVersions" },
+  { 0x00181022, VR::SH, VM(1, 1, 1), "VideoImageFormatAcquired" },
+  { 0x00181023, VR::LO, VM(1, 1, 1), "DigitalImageFormatAcquired" },
+  { 0x00181030, VR::LO, VM(1, 1, 1), "ProtocolName" },
+  { 0x00181040, VR::LO, VM(1, 1, 1), "ContrastBolusRoute" },
+  { 0x00181041, VR::DS, VM(1, 1, 1), "ContrastBolusVolume" },
+  { 0x00181042, VR::TM, VM(1, 1, 1), "ContrastBolusStartTime" },
+  { 0x00181043, VR::TM, VM(1, 1, 1), "ContrastBolusStopTime" },
+  { 0x00181044, VR::DS, VM(1, 1, 1), "ContrastBolusTotalDose" },
+  { 0x00181045, VR::IS, VM(1, 1, 1), "SyringeCounts" },
+  { 0x00181046, VR::DS, VM(1, VM::N, 1), "ContrastFlowRate" },
+  { 0x00181047, VR::DS, VM(1, VM::N, 1), "ContrastFlowDuration" },
+  { 0x00181048, VR::CS, VM(1, 1, 1), "ContrastBolusIngredient" },
+  { 0x00181049, VR::DS, VM(1, 1, 1), "ContrastBolusIngredientConcentration" },
+  { 0x00181050, VR::DS, VM(1, 1, 1), "SpatialResolution" },
+  { 0x00181060, VR::DS, VM(1, 1, 1), "TriggerTime" },
+  { 0x00181061, VR::LO, VM(1, 1, 1), "TriggerSourceOrType" },
+  { 0x00181062, VR::IS, VM(1, 1, 1), "NominalInterval" },
+  { 0x00181063, VR::DS, VM(1, 1, 1), "FrameTime" },
+  { 0x00181064, VR::LO, VM(1, 1, 1), "CardiacFramingType" },
+  { 0x00181065, VR::DS, VM(1, VM::N, 1), "FrameTimeVector" },
+  { 0x00181066, VR::DS, VM(1, 1, 1), "FrameDelay" },
+  { 0x00181067, VR::DS, VM(1, 1, 1), "ImageTriggerDelay" },
+  { 0x00181068, VR::DS, VM(1, 1, 1), "MultiplexGroupTimeOffset" },
+  { 0x00181069, VR::DS, VM(1, 1, 1), "TriggerTimeOffset" },
+  { 0x0018106A, VR::CS, VM(1, 1, 1), "SynchronizationTrigger" },
+  { 0x0018106C, VR::US, VM(2, 2, 1), "SynchronizationChannel" },
+  { 0x0018106E, VR::UL, VM(1, 1, 1), "TriggerSamplePosition" },
+  { 0x00181070, VR::LO, VM(1, 1, 1), "RadiopharmaceuticalRoute" },
+  { 0x00181071, VR::DS, VM(1, 1, 1), "RadiopharmaceuticalVolume" },
+  { 0x00181072, VR::TM, VM(1, 1, 1), "RadiopharmaceuticalStartTime" },
+  { 0x00181073, VR::TM, VM(1, 1, 1), "RadiopharmaceuticalStopTime" },
+  { 0x00181074, VR::DS, VM(1, 1, 1), "RadionuclideTotalDose" },
+  { 0x00181075, VR::DS, VM(1, 1, 1), "RadionuclideHalfLife" },
+  { 0x00181076, VR::DS, VM(1, 1, 1), "RadionuclidePositronFraction" },
+  { 0x00181077, VR::DS, VM(1, 1, 1), "RadiopharmaceuticalSpecificActivity" },
+  { 0x00181078, VR::DT, VM(1, 1, 1), "RadiopharmaceuticalStartDateTime" },
+  { 0x00181079, VR::DT, VM(1, 1, 1), "RadiopharmaceuticalStopDateTime" },
+  { 0x00181080, VR::CS, VM(1, 1, 1), "BeatRejectionFlag" },
+  { 0x00181081, VR::IS, VM(1, 1, 1), "LowRRValue" },
+  { 0x00181082, VR::IS, VM(1, 1, 1), "HighRRValue" },
+  { 0x00181083, VR::IS, VM(1, 1, 1), "IntervalsAcquired" },
+  { 0x00181084, VR::IS, VM(1, 1, 1), "IntervalsRejected" },
+  { 0x00181085, VR::LO, VM(1, 1, 1), "PVCRejection" },
+  { 0x00181086, VR::IS, VM(1, 1, 1), "SkipBeats" },
+  { 0x00181088, VR::IS, VM(1, 1, 1), "HeartRate" },
+  { 0x00181090, VR::IS, VM(1, 1, 1), "CardiacNumberOfImages" },
+  { 0x00181094, VR::IS, VM(1, 1, 1), "TriggerWindow" },
+  { 0x00181100, VR::DS, VM(1, 1, 1), "ReconstructionDiameter" },
+  { 0x00181110, VR::DS, VM(1, 1, 1), "DistanceSourceToDetector" },
+  { 0x00181111, VR::DS, VM(1, 1, 1), "DistanceSourceToPatient" },
+  { 0x00181114, VR::DS, VM(1, 1, 1), "EstimatedRadiographicMagnificationFactor" },
+  { 0x00181120, VR::DS, VM(1, 1, 1), "GantryDetectorTilt" },
+  { 0x00181121, VR::DS, VM(1, 1, 1), "GantryDetectorSlew" },
+  { 0x00181130, VR::DS, VM(1, 1, 1), "TableHeight" },
+  { 0x00181131, VR::DS, VM(1, 1, 1), "TableTraverse" },
+  { 0x00181134, VR::CS, VM(1, 1, 1), "TableMotion" },
+  { 0x00181135, VR::DS, VM(1, VM::N, 1), "TableVerticalIncrement" },
+  { 0x00181136, VR::DS, VM(1, VM::N, 1), "TableLateralIncrement" },
+  { 0x00181137, VR::DS, VM(1, VM::N, 1), "TableLongitudinalIncrement" },
+  { 0x00181138, VR::DS, VM(1, 1, 1), "TableAngle" },
+  { 0x0018113A, VR::CS, VM(1, 1, 1), "TableType" },
+  { 0x00181140, VR::CS, VM(1, 1, 1), "RotationDirection" },
+  { 0x00181142, VR::DS, VM(1, VM::N, 1), "RadialPosition" },
+  { 0x00181143, VR::DS, VM(1, 1, 1), "ScanArc" },
+  { 0x00181144, VR::DS, VM(1, 1, 1), "AngularStep" },
+  { 0x00181145, VR::DS, VM(1, 1, 1), "CenterOfRotationOffset" },
+  { 0x00181147, VR::CS, VM(1, 1, 1), "FieldOfViewShape" },
+  { 0x00181149, VR::IS, VM(1, 2, 1), "FieldOfViewDimensions" },
+  { 0x00181150, VR::IS, VM(1, 1, 1), "ExposureTime" },
+  { 0x00181151, VR::IS, VM(1, 1, 1), "XRayTubeCurrent" },
+  { 0x00181152, VR::IS, VM(1, 1, 1), "Exposure" },
+  { 0x00181153, VR::IS, VM(1, 1, 1), "ExposureInuAs" },
+  { 0x00181154, VR::DS, VM(1, 1, 1), "AveragePulseWidth" },
+  { 0x00181155, VR::CS, VM(1, 1, 1), "RadiationSetting" },
+  { 0x00181156, VR::CS, VM(1, 1, 1), "RectificationType" },
+  { 0x0018115A, VR::CS, VM(1, 1, 1), "RadiationMode" },
+  { 0x0018115E, VR::DS, VM(1, 1, 1), "ImageAndFluoroscopyAreaDoseProduct" },
+  { 0x00181160, VR::SH, VM(1, 1, 1), "FilterType" },
+  { 0x00181161, VR::LO, VM(1, VM::N, 1), "TypeOfFilters" },
+  { 0x00181162, VR::DS, VM(1, 1, 1), "IntensifierSize" },
+  { 0x00181164, VR::DS, VM(2, 2, 1), "ImagerPixelSpacing" },
+  { 0x00181166, VR::CS, VM(1, VM::N, 1), "Grid" },
+  { 0x00181170, VR::IS, VM(1, 1, 1), "GeneratorPower" },
+  { 0x00181180, VR::SH, VM(1, 1, 1), "CollimatorGridName" },
+  { 0x00181181, VR::CS, VM(1, 1, 1), "CollimatorType" },
+  { 0x00181182, VR::IS, VM(1, 2, 1), "FocalDistance" },
+  { 0x00181183, VR::DS, VM(1, 2, 1), "XFocusCenter" },
+  { 0x00181184, VR::DS, VM(1, 2, 1), "YFocusCenter" },
+  { 0x00181190, VR::DS, VM(1, VM::N, 1), "FocalSpots" },
+  { 0x00181191, VR::CS, VM(1, 1, 1), "AnodeTargetMaterial" },
+  { 0x001811A0, VR::DS, VM(1, 1, 1), "BodyPartThickness" },
+  { 0x001811A2, VR::DS, VM(1, 1, 1), "CompressionForce" },
+  { 0x001811A4, VR::LO, VM(1, 1, 1), "PaddleDescription" },
+  { 0x00181200, VR::DA, VM(1, VM::N, 1), "DateOfLastCalibration" },
+  { 0x00181201, VR::TM, VM(1, VM::N, 1), "TimeOfLastCalibration" },
+  { 0x00181202, VR::DT, VM(1, 1, 1), "DateTimeOfLastCalibration" },
+  { 0x00181210, VR::SH, VM(1, VM::N, 1), "ConvolutionKernel" },
+  { 0x00181242, VR::IS, VM(1, 1, 1), "ActualFrameDuration" },
+  { 0x00181243, VR::IS, VM(1, 1, 1), "CountRate" },
+  { 0x00181244, VR::US, VM(1, 1, 1), "PreferredPlaybackSequencing" },
+  { 0x00181250, VR::SH, VM(1, 1, 1), "ReceiveCoilName" },
+  { 0x00181251, VR::SH, VM(1, 1, 1), "TransmitCoilName" },
+  { 0x00181260, VR::SH, VM(1, 1, 1), "PlateType" },
+  { 0x00181261, VR::LO, VM(1, 1, 1), "PhosphorType" },
+  { 0x00181300, VR::DS, VM(1, 1, 1), "ScanVelocity" },
+  { 0x00181301, VR::CS, VM(1, VM::N, 1), "WholeBodyTechnique" },
+  { 0x00181302, VR::IS, VM(1, 1, 1), "ScanLength" },
+  { 0x00181310, VR::US, VM(4, 4, 1), "AcquisitionMatrix" },
+  { 0x00181312, VR::CS, VM(1, 1, 1), "InPlanePhaseEncodingDirection" },
+  { 0x00181314, VR::DS, VM(1, 1, 1), "FlipAngle" },
+  { 0x00181315, VR::CS, VM(1, 1, 1), "VariableFlipAngleFlag" },
+  { 0x00181316, VR::DS, VM(1, 1, 1), "SAR" },
+  { 0x00181318, VR::DS, VM(1, 1, 1), "dBdt" },
+  { 0x00181320, VR::FL, VM(1, 1, 1), "B1rms" },
+  { 0x00181400, VR::LO, VM(1, 1, 1), "AcquisitionDeviceProcessingDescription" },
+  { 0x00181401, VR::LO, VM(1, 1, 1), "AcquisitionDeviceProcessingCode" },
+  { 0x00181402, VR::CS, VM(1, 1, 1), "CassetteOrientation" },
+  { 0x00181403, VR::CS, VM(1, 1, 1), "CassetteSize" },
+  { 0x00181404, VR::US, VM(1, 1, 1), "ExposuresOnPlate" },
+  { 0x00181405, VR::IS, VM(1, 1, 1), "RelativeXRayExposure" },
+  { 0x00181411, VR::DS, VM(1, 1, 1), "ExposureIndex" },
+  { 0x00181412, VR::DS, VM(1, 1, 1), "TargetExposureIndex" },
+  { 0x00181413, VR::DS, VM(1, 1, 1), "DeviationIndex" },
+  { 0x00181450, VR::DS, VM(1, 1, 1), "ColumnAngulation" },
+  { 0x00181460, VR::DS, VM(1, 1, 1), "TomoLayerHeight" },
+  { 0x00181470, VR::DS, VM(1, 1, 1), "TomoAngle" },
+  { 0x00181480, VR::DS, VM(1, 1, 1), "TomoTime" },
+  { 0x00181490, VR::CS, VM(1, 1, 1), "TomoType" },
+  { 0x00181491, VR::CS, VM(1, 1, 1), "TomoClass" },
+  { 0x00181495, VR::IS, VM(1, 1, 1), "NumberOfTomosynthesisSourceImages" },
+  { 0x00181500, VR::CS, VM(1, 1, 1), "PositionerMotion" },
+  { 0x00181508, VR::CS, VM(1, 1, 1), "PositionerType" },
+  { 0x00181510, VR::DS, VM(1, 1, 1), "PositionerPrimaryAngle" },
+  { 0x00181511, VR::DS, VM(1, 1, 1), "PositionerSecondaryAngle" },
+  { 0x00181520, VR::DS, VM(1, VM::N, 1), "PositionerPrimaryAngleIncrement" },
+  { 0x00181521, VR::DS, VM(1, VM::N, 1), "PositionerSecondaryAngleIncrement" },
+  { 0x00181530, VR::DS, VM(1, 1, 1), "DetectorPrimaryAngle" },
+  { 0x00181531, VR::DS, VM(1, 1, 1), "DetectorSecondaryAngle" },
+  { 0x00181600, VR::CS, VM(1, 3, 1), "ShutterShape" },
+  { 0x00181602, VR::IS, VM(1, 1, 1), "ShutterLeftVerticalEdge" },
+  { 0x00181604, VR::IS, VM(1, 1, 1), "ShutterRightVerticalEdge" },
+  { 0x00181606, VR::IS, VM(1, 1, 1), "ShutterUpperHorizontalEdge" },
+  { 0x00181608, VR::IS, VM(1, 1, 1), "ShutterLowerHorizontalEdge" },
+  { 0x00181610, VR::IS, VM(2, 2, 1), "CenterOfCircularShutter" },
+  { 0x00181612, VR::IS, VM(1, 1, 1), "RadiusOfCircularShutter" },
+  { 0x00181620, VR::IS, VM(1, VM::N, 2), "VerticesOfThePolygonalShutter" },
+  { 0x00181622, VR::US, VM(1, 1, 1), "ShutterPresentationValue" },
+  { 0x00181623, VR::US, VM(1, 1, 1), "ShutterOverlayGroup" },
+  { 0x00181624, VR::US, VM(3, 3, 1), "ShutterPresentationColorCIELabValue" },
+  { 0x00181700, VR::CS, VM(1, 3, 1), "CollimatorShape" },
+  { 0x00181702, VR::IS, VM(1, 1, 1), "CollimatorLeftVerticalEdge" },
+  { 0x00181704, VR::IS, VM(1, 1, 1), "CollimatorRightVerticalEdge" },
+  { 0x00181706, VR::IS, VM(1, 1, 1), "CollimatorUpperHorizontalEdge" },
+  { 0x00181708, VR::IS, VM(1, 1, 1), "CollimatorLowerHorizontalEdge" },
+  { 0x00181710, VR::IS, VM(2, 2, 1), "CenterOfCircularCollimator" },
+  { 0x00181712, VR::IS, VM(1, 1, 1), "RadiusOfCircularCollimator" },
+  { 0x00181720, VR::IS, VM(1, VM::N, 2), "VerticesOfThePolygonalCollimator" },
+  { 0x00181800, VR::CS, VM(1, 1, 1), "AcquisitionTimeSynchronized" },
+  { 0x00181801, VR::SH, VM(1, 1, 1), "TimeSource" },
+  { 0x00181802, VR::CS, VM(1, 1, 1), "TimeDistributionProtocol" },
+  { 0x00181803, VR::LO, VM(1, 1, 1), "NTPSourceAddress" },
+  { 0x00182001, VR::IS, VM(1, VM::N, 1), "PageNumberVector" },
+  { 0x00182002, VR::SH, VM(1, VM::N, 1), "FrameLabelVector" },
+  { 0x00182003, VR::DS, VM(1, VM::N, 1), "FramePrimaryAngleVector" },
+  { 0x00182004, VR::DS, VM(1, VM::N, 1), "FrameSecondaryAngleVector" },
+  { 0x00182005, VR::DS, VM(1, VM::N, 1), "SliceLocationVector" },
+  { 0x00182006, VR::SH, VM(1, VM::N, 1), "DisplayWindowLabelVector" },
+  { 0x00182010, VR::DS, VM(2, 2, 1), "NominalScannedPixelSpacing" },
+  { 0x00182020, VR::CS, VM(1, 1, 1), "DigitizingDeviceTransportDirection" },
+  { 0x00182030, VR::DS, VM(1, 1, 1), "RotationOfScannedFilm" },
+  { 0x00182041, VR::SQ, VM(1, 1, 1), "BiopsyTargetSequence" },
+  { 0x00182042, VR::UI, VM(1, 1, 1), "TargetUID" },
+  { 0x00182043, VR::FL, VM(2, 2, 1), "LocalizingCursorPosition" },
+  { 0x00182044, VR::FL, VM(3, 3, 1), "CalculatedTargetPosition" },
+  { 0x00182045, VR::SH, VM(1, 1, 1), "TargetLabel" },
+  { 0x00182046, VR::FL, VM(1, 1, 1), "DisplayedZValue" },
+  { 0x00183100, VR::CS, VM(1, 1, 1), "IVUSAcquisition" },
+  { 0x00183101, VR::DS, VM(1, 1, 1), "IVUSPullbackRate" },
+  { 0x00183102, VR::DS, VM(1, 1, 1), "IVUSGatedRate" },
+  { 0x00183103, VR::IS, VM(1, 1, 1), "IVUSPullbackStartFrameNumber" },
+  { 0x00183104, VR::IS, VM(1, 1, 1), "IVUSPullbackStopFrameNumber" },
+  { 0x00183105, VR::IS, VM(1, VM::N, 1), "LesionNumber" },
+  { 0x00185000, VR::SH, VM(1, VM::N, 1), "OutputPower" },
+  { 0x00185010, VR::LO, VM(1, VM::N, 1), "TransducerData" },
+  { 0x00185012, VR::DS, VM(1, 1, 1), "FocusDepth" },
+  { 0x00185020, VR::LO, VM(1, 1, 1), "ProcessingFunction" },
+  { 0x00185022, VR::DS, VM(1, 1, 1), "MechanicalIndex" },
+  { 0x00185024, VR::DS, VM(1, 1, 1), "BoneThermalIndex" },
+  { 0x00185026, VR::DS, VM(1, 1, 1), "CranialThermalIndex" },
+  { 0x00185027, VR::DS, VM(1, 1, 1), "SoftTissueThermalIndex" },
+  { 0x00185028, VR::DS, VM(1, 1, 1), "SoftTissueFocusThermalIndex" },
+  { 0x00185029, VR::DS, VM(1, 1, 1), "SoftTissueSurfaceThermalIndex" },
+  { 0x00185050, VR::IS, VM(1, 1, 1), "DepthOfScanField" },
+  { 0x00185100, VR::CS, VM(1, 1, 1), "PatientPosition" },
+  { 0x00185101, VR::CS, VM(1, 1, 1), "ViewPosition" },
+  { 0x00185104, VR::SQ, VM(1, 1, 1), "ProjectionEponymousNameCodeSequence" },
+  { 0x00186000, VR::DS, VM(1, 1, 1), "Sensitivity" },
+  { 0x00186011, VR::SQ, VM(1, 1, 1), "SequenceOfUltrasoundRegions" },
+  { 0x00186012, VR::US, VM(1, 1, 1), "RegionSpatialFormat" },
+  { 0x00186014, VR::US, VM(1, 1, 1), "RegionDataType" },
+  { 0x00186016, VR::UL, VM(1, 1, 1), "RegionFlags" },
+  { 0x00186018, VR::UL, VM(1, 1, 1), "RegionLocationMinX0" },
+  { 0x0018601A, VR::UL, VM(1, 1, 1), "RegionLocationMinY0" },
+  { 0x0018601C, VR::UL, VM(1, 1, 1), "RegionLocationMaxX1" },
+  { 0x0018601E, VR::UL, VM(1, 1, 1), "RegionLocationMaxY1" },
+  { 0x00186020, VR::SL, VM(1, 1, 1), "ReferencePixelX0" },
+  { 0x00186022, VR::SL, VM(1, 1, 1), "ReferencePixelY0" },
+  { 0x00186024, VR::US, VM(1, 1, 1), "PhysicalUnitsXDirection" },
+  { 0x00186026, VR::US, VM(1, 1, 1), "PhysicalUnitsYDirection" },
+  { 0x00186028, VR::FD, VM(1, 1, 1), "ReferencePixelPhysicalValueX" },
+  { 0x0018602A, VR::FD, VM(1, 1, 1), "ReferencePixelPhysicalValueY" },
+  { 0x0018602C, VR::FD, VM(1, 1, 1), "PhysicalDeltaX" },
+  { 0x0018602E, VR::FD, VM(1, 1, 1), "PhysicalDeltaY" },
+  { 0x00186030, VR::UL, VM(1, 1, 1), "TransducerFrequency" },
+  { 0x00186031, VR::CS, VM(1, 1, 1), "TransducerType" },
+  { 0x00186032, VR::UL, VM(1, 1, 1), "PulseRepetitionFrequency" },
+  { 0x00186034, VR::FD, VM(1, 1, 1), "DopplerCorrectionAngle" },
+  { 0x00186036, VR::FD, VM(1, 1, 1), "SteeringAngle" },
+  { 0x00186039, VR::SL, VM(1, 1, 1), "DopplerSampleVolumeXPosition" },
+  { 0x0018603B, VR::SL, VM(1, 1, 1), "DopplerSampleVolumeYPosition" },
+  { 0x0018603D, VR::SL, VM(1, 1, 1), "TMLinePositionX0" },
+  { 0x0018603F, VR::SL, VM(1, 1, 1), "TMLinePositionY0" },
+  { 0x00186041, VR::SL, VM(1, 1, 1), "TMLinePositionX1" },
+  { 0x00186043, VR::SL, VM(1, 1, 1), "TMLinePositionY1" },
+  { 0x00186044, VR::US, VM(1, 1, 1), "PixelComponentOrganization" },
+  { 0x00186046, VR::UL, VM(1, 1, 1), "PixelComponentMask" },
+  { 0x00186048, VR::UL, VM(1, 1, 1), "PixelComponentRangeStart" },
+  { 0x0018604A, VR::UL, VM(1, 1, 1), "PixelComponentRangeStop" },
+  { 0x0018604C, VR::US, VM(1, 1, 1), "PixelComponentPhysicalUnits" },
+  { 0x0018604E, VR::US, VM(1, 1, 1), "PixelComponentDataType" },
+  { 0x00186050, VR::UL, VM(1, 1, 1), "NumberOfTableBreakPoints" },
+  { 0x00186052, VR::UL, VM(1, VM::N, 1), "TableOfXBreakPoints" },
+  { 0x00186054, VR::FD, VM(1, VM::N, 1), "TableOfYBreakPoints" },
+  { 0x00186056, VR::UL, VM(1, 1, 1), "NumberOfTableEntries" },
+  { 0x00186058, VR::UL, VM(1, VM::N, 1), "TableOfPixelValues" },
+  { 0x0018605A, VR::FL, VM(1, VM::N, 1), "TableOfParameterValues" },
+  { 0x00186060, VR::FL, VM(1, VM::N, 1), "RWaveTimeVector" },
+  { 0x00187000, VR::CS, VM(1, 1, 1), "DetectorConditionsNominalFlag" },
+  { 0x00187001, VR::DS, VM(1, 1, 1), "DetectorTemperature" },
+  { 0x00187004, VR::CS, VM(1, 1, 1), "DetectorType" },
+  { 0x00187005, VR::CS, VM(1, 1, 1), "DetectorConfiguration" },
+  { 0x00187006, VR::LT, VM(1, 1, 1), "DetectorDescription" },
+  { 0x00187008, VR::LT, VM(1, 1, 1), "DetectorMode" },
+  { 0x0018700A, VR::SH, VM(1, 1, 1), "DetectorID" },
+  { 0x0018700C, VR::DA, VM(1, 1, 1), "DateOfLastDetectorCalibration" },
+  { 0x0018700E, VR::TM, VM(1, 1, 1), "TimeOfLastDetectorCalibration" },
+  { 0x00187010, VR::IS, VM(1, 1, 1), "ExposuresOnDetectorSinceLastCalibration" },
+  { 0x00187011, VR::IS, VM(1, 1, 1), "ExposuresOnDetectorSinceManufactured" },
+  { 0x00187012, VR::DS, VM(1, 1, 1), "DetectorTimeSinceLastExposure" },
+  { 0x00187014, VR::DS, VM(1, 1, 1), "DetectorActiveTime" },
+  { 0x00187016, VR::DS, VM(1, 1, 1), "DetectorActivationOffsetFromExposure" },
+  { 0x0018701A, VR::DS, VM(2, 2, 1), "DetectorBinning" },
+  { 0x00187020, VR::DS, VM(2, 2, 1), "DetectorElementPhysicalSize" },
+  { 0x00187022, VR::DS, VM(2, 2, 1), "DetectorElementSpacing" },
+  { 0x00187024, VR::CS, VM(1, 1, 1), "DetectorActiveShape" },
+  { 0x00187026, VR::DS, VM(1, 2, 1), "DetectorActiveDimensions" },
+  { 0x00187028, VR::DS, VM(2, 2, 1), "DetectorActiveOrigin" },
+  { 0x0018702A, VR::LO, VM(1, 1, 1), "DetectorManufacturerName" },
+  { 0x0018702B, VR::LO, VM(1, 1, 1), "DetectorManufacturerModelName" },
+  { 0x00187030, VR::DS, VM(2, 2, 1), "FieldOfViewOrigin" },
+  { 0x00187032, VR::DS, VM(1, 1, 1), "FieldOfViewRotation" },
+  { 0x00187034, VR::CS, VM(1, 1, 1), "FieldOfViewHorizontalFlip" },
+  { 0x00187036, VR::FL, VM(2, 2, 1), "PixelDataAreaOriginRelativeToFOV" },
+  { 0x00187038, VR::FL, VM(1, 1, 1), "PixelDataAreaRotationAngleRelativeToFOV" },
+  { 0x00187040, VR::LT, VM(1, 1, 1), "GridAbsorbingMaterial" },
+  { 0x00187041, VR::LT, VM(1, 1, 1), "GridSpacingMaterial" },
+  { 0x00187042, VR::DS, VM(1, 1, 1), "GridThickness" },
+  { 0x00187044, VR::DS, VM(1, 1, 1), "GridPitch" },
+  { 0x00187046, VR::IS, VM(2, 2, 1), "GridAspectRatio" },
+  { 0x00187048, VR::DS, VM(1, 1, 1), "GridPeriod" },
+  { 0x0018704C, VR::DS, VM(1, 1, 1), "GridFocalDistance" },
+  { 0x00187050, VR::CS, VM(1, VM::N, 1), "FilterMaterial" },
+  { 0x00187052, VR::DS, VM(1, VM::N, 1), "FilterThicknessMinimum" },
+  { 0x00187054, VR::DS, VM(1, VM::N, 1), "FilterThicknessMaximum" },
+  { 0x00187056, VR::FL, VM(1, VM::N, 1), "FilterBeamPathLengthMinimum" },
+  { 0x00187058, VR::FL, VM(1, VM::N, 1), "FilterBeamPathLengthMaximum" },
+  { 0x00187060, VR::CS, VM(1, 1, 1), "ExposureControlMode" },
+  { 0x00187062, VR::LT, VM(1, 1, 1), "ExposureControlModeDescription" },
+  { 0x00187064, VR::CS, VM(1, 1, 1), "ExposureStatus" },
+  { 0x00187065, VR::DS, VM(1, 1, 1), "PhototimerSetting" },
+  { 0x00188150, VR::DS, VM(1, 1, 1), "ExposureTimeInuS" },
+  { 0x00188151, VR::DS, VM(1, 1, 1), "XRayTubeCurrentInuA" },
+  { 0x00189004, VR::CS, VM(1, 1, 1), "ContentQualification" },
+  { 0x00189005, VR::SH, VM(1, 1, 1), "PulseSequenceName" },
+  { 0x00189006, VR::SQ, VM(1, 1, 1), "MRImagingModifierSequence" },
+  { 0x00189008, VR::CS, VM(1, 1, 1), "EchoPulseSequence" },
+  { 0x00189009, VR::CS, VM(1, 1, 1), "InversionRecovery" },
+  { 0x00189010, VR::CS, VM(1, 1, 1), "FlowCompensation" },
+  { 0x00189011, VR::CS, VM(1, 1, 1), "MultipleSpinEcho" },
+  { 0x00189012, VR::CS, VM(1, 1, 1), "MultiPlanarExcitation" },
+  { 0x00189014, VR::CS, VM(1, 1, 1), "PhaseContrast" },
+  { 0x00189015, VR::CS, VM(1, 1, 1), "TimeOfFlightContrast" },
+  { 0x00189016, VR::CS, VM(1, 1, 1), "Spoiling" },
+  { 0x00189017, VR::CS, VM(1, 1, 1), "SteadyStatePulseSequence" },
+  { 0x00189018, VR::CS, VM(1, 1, 1), "EchoPlanarPulseSequence" },
+  { 0x00189019, VR::FD, VM(1, 1, 1), "TagAngleFirstAxis" },
+  { 0x00189020, VR::CS, VM(1, 1, 1), "MagnetizationTransfer" },
+  { 0x00189021, VR::CS, VM(1, 1, 1), "T2Preparation" },
+  { 0x00189022, VR::CS, VM(1, 1, 1), "BloodSignalNulling" },
+  { 0x00189024, VR::CS, VM(1, 1, 1), "SaturationRecovery" },
+  { 0x00189025, VR::CS, VM(1, 1, 1), "SpectrallySelectedSuppression" },
+  { 0x00189026, VR::CS, VM(1, 1, 1), "SpectrallySelectedExcitation" },
+  { 0x00189027, VR::CS, VM(1, 1, 1), "SpatialPresaturation" },
+  { 0x00189028, VR::CS, VM(1, 1, 1), "Tagging" },
+  { 0x00189029, VR::CS, VM(1, 1, 1), "OversamplingPhase" },
+  { 0x00189030, VR::FD, VM(1, 1, 1), "TagSpacingFirstDimension" },
+  { 0x00189032, VR::CS, VM(1, 1, 1), "GeometryOfKSpaceTraversal" },
+  { 0x00189033, VR::CS, VM(1, 1, 1), "SegmentedKSpaceTraversal" },
+  { 0x00189034, VR::CS, VM(1, 1, 1), "RectilinearPhaseEncodeReordering" },
+  { 0x00189035, VR::FD, VM(1, 1, 1), "TagThickness" },
+  { 0x00189036, VR::CS, VM(1, 1, 1), "PartialFourierDirection" },
+  { 0x00189037, VR::CS, VM(1, 1, 1), "CardiacSynchronizationTechnique" },
+  { 0x00189041, VR::LO, VM(1, 1, 1), "ReceiveCoilManufacturerName" },
+  { 0x00189042, VR::SQ, VM(1, 1, 1), "MRReceiveCoilSequence" },
+  { 0x00189043, VR::CS, VM(1, 1, 1), "ReceiveCoilType" },
+  { 0x00189044, VR::CS, VM(1, 1, 1), "QuadratureReceiveCoil" },
+  { 0x00189045, VR::SQ, VM(1, 1, 1), "MultiCoilDefinitionSequence" },
+  { 0x00189046, VR::LO, VM(1, 1, 1), "MultiCoilConfiguration" },
+  { 0x00189047, VR::SH, VM(1, 1, 1), "MultiCoilElementName" },
+  { 0x00189048, VR::CS, VM(1, 1, 1), "MultiCoilElementUsed" },
+  { 0x00189049, VR::SQ, VM(1, 1, 1), "MRTransmitCoilSequence" },
+  { 0x00189050, VR::LO, VM(1, 1, 1), "TransmitCoilManufacturerName" },
+  { 0x00189051, VR::CS, VM(1, 1, 1), "TransmitCoilType" },
+  { 0x00189052, VR::FD, VM(1, 2, 1), "SpectralWidth" },
+  { 0x00189053, VR::FD, VM(1, 2, 1), "ChemicalShiftReference" },
+  { 0x00189054, VR::CS, VM(1, 1, 1), "VolumeLocalizationTechnique" },
+  { 0x00189058, VR::US, VM(1, 1, 1), "MRAcquisitionFrequencyEncodingSteps" },
+  { 0x00189059, VR::CS, VM(1, 1, 1), "Decoupling" },
+  { 0x00189060, VR::CS, VM(1, 2, 1), "DecoupledNucleus" },
+  { 0x00189061, VR::FD, VM(1, 2, 1), "DecouplingFrequency" },
+  { 0x00189062, VR::CS, VM(1, 1, 1), "DecouplingMethod" },
+  { 0x00189063, VR::FD, VM(1, 2, 1), "DecouplingChemicalShiftReference" },
+  { 0x00189064, VR::CS, VM(1, 1, 1), "KSpaceFiltering" },
+  { 0x00189065, VR::CS, VM(1, 2, 1), "TimeDomainFiltering" },
+  { 0x00189066, VR::US, VM(1, 2, 1), "NumberOfZeroFills" },
+  { 0x00189067, VR::CS, VM(1, 1, 1), "BaselineCorrection" },
+  { 0x00189069, VR::FD, VM(1, 1, 1), "ParallelReductionFactorInPlane" },
+  { 0x00189070, VR::FD, VM(1, 1, 1), "CardiacRRIntervalSpecified" },
+  { 0x00189073, VR::FD, VM(1, 1, 1), "AcquisitionDuration" },
+  { 0x00189074, VR::DT, VM(1, 1, 1), "FrameAcquisitionDateTime" },
+  { 0x00189075, VR::CS, VM(1, 1, 1), "DiffusionDirectionality" },
+  { 0x00189076, VR::SQ, VM(1, 1, 1), "DiffusionGradientDirectionSequence" },
+  { 0x00189077, VR::CS, VM(1, 1, 1), "ParallelAcquisition" },
+  { 0x00189078, VR::CS, VM(1, 1, 1), "ParallelAcquisitionTechnique" },
+  { 0x00189079, VR::FD, VM(1, VM::N, 1), "InversionTimes" },
+  { 0x00189080, VR::ST, VM(1, 1, 1), "MetaboliteMapDescription" },
+  { 0x00189081, VR::CS, VM(1, 1, 1), "PartialFourier" },
+  { 0x00189082, VR::FD, VM(1, 1, 1), "EffectiveEchoTime" },
+  { 0x00189083, VR::SQ, VM(1, 1, 1), "MetaboliteMapCodeSequence" },
+  { 0x00189084, VR::SQ, VM(1, 1, 1), "ChemicalShiftSequence" },
+  { 0x00189085, VR::CS, VM(1, 1, 1), "CardiacSignalSource" },
+  { 0x00189087, VR::FD, VM(1, 1, 1), "DiffusionBValue" },
+  { 0x00189089, VR::FD, VM(3, 3, 1), "DiffusionGradientOrientation" },
+  { 0x00189090, VR::FD, VM(3, 3, 1), "VelocityEncodingDirection" },
+  { 0x00189091, VR::FD, VM(1, 1, 1), "VelocityEncodingMinimumValue" },
+  { 0x00189092, VR::SQ, VM(1, 1, 1), "VelocityEncodingAcquisitionSequence" },
+  { 0x00189093, VR::US, VM(1, 1, 1), "NumberOfKSpaceTrajectories" },
+  { 0x00189094, VR::CS, VM(1, 1, 1), "CoverageOfKSpace" },
+  { 0x00189095, VR::UL, VM(1, 1, 1), "SpectroscopyAcquisitionPhaseRows" },
+  { 0x00189098, VR::FD, VM(1, 2, 1), "TransmitterFrequency" },
+  { 0x00189100, VR::CS, VM(1, 2, 1), "ResonantNucleus" },
+  { 0x00189101, VR::CS, VM(1, 1, 1), "FrequencyCorrection" },
+  { 0x00189103, VR::SQ, VM(1, 1, 1), "MRSpectroscopyFOVGeometrySequence" },
+  { 0x00189104, VR::FD, VM(1, 1, 1), "SlabThickness" },
+  { 0x00189105, VR::FD, VM(3, 3, 1), "SlabOrientation" },
+  { 0x00189106, VR::FD, VM(3, 3, 1), "MidSlabPosition" },
+  { 0x00189107, VR::SQ, VM(1, 1, 1), "MRSpatialSaturationSequence" },
+  { 0x00189112, VR::SQ, VM(1, 1, 1), "MRTimingAndRelatedParametersSequence" },
+  { 0x00189114, VR::SQ, VM(1, 1, 1), "MREchoSequence" },
+  { 0x00189115, VR::SQ, VM(1, 1, 1), "MRModifierSequence" },
+  { 0x00189117, VR::SQ, VM(1, 1, 1), "MRDiffusionSequence" },
+  { 0x00189118, VR::SQ, VM(1, 1, 1), "CardiacSynchronizationSequence" },
+  { 0x00189119, VR::SQ, VM(1, 1, 1), "MRAveragesSequence" },
+  { 0x00189125, VR::SQ, VM(1, 1, 1), "MRFOVGeometrySequence" },
+  { 0x00189126, VR::SQ, VM(1, 1, 1), "VolumeLocalizationSequence" },
+  { 0x00189127, VR::UL, VM(1, 1, 1), "SpectroscopyAcquisitionDataColumns" },
+  { 0x00189147, VR::CS, VM(1, 1, 1), "DiffusionAnisotropyType" },
+  { 0x00189151, VR::DT, VM(1, 1, 1), "FrameReferenceDateTime" },
+  { 0x00189152, VR::SQ, VM(1, 1, 1), "MRMetaboliteMapSequence" },
+  { 0x00189155, VR::FD, VM(1, 1, 1), "ParallelReductionFactorOutOfPlane" },
+  { 0x00189159, VR::UL, VM(1, 1, 1), "SpectroscopyAcquisitionOutOfPlanePhaseSteps" },
+  { 0x00189168, VR::FD, VM(1, 1, 1), "ParallelReductionFactorSecondInPlane" },
+  { 0x00189169, VR::CS, VM(1, 1, 1), "CardiacBeatRejectionTechnique" },
+  { 0x00189170, VR::CS, VM(1, 1, 1), "RespiratoryMotionCompensationTechnique" },
+  { 0x00189171, VR::CS, VM(1, 1, 1), "RespiratorySignalSource" },
+  { 0x00189172, VR::CS, VM(1, 1, 1), "BulkMotionCompensationTechnique" },
+  { 0x00189173, VR::CS, VM(1, 1, 1), "BulkMotionSignalSource" },
+  { 0x00189174, VR::CS, VM(1, 1, 1), "ApplicableSafetyStandardAgency" },
+  { 0x00189175, VR::LO, VM(1, 1, 1), "ApplicableSafetyStandardDescription" },
+  { 0x00189176, VR::SQ, VM(1, 1, 1), "OperatingModeSequence" },
+  { 0x00189177, VR::CS, VM(1, 1, 1), "OperatingModeType" },
+  { 0x00189178, VR::CS, VM(1, 1, 1), "OperatingMode" },
+  { 0x00189179, VR::CS, VM(1, 1, 1), "SpecificAbsorptionRateDefinition" },
+  { 0x00189180, VR::CS, VM(1, 1, 1), "GradientOutputType" },
+  { 0x00189181, VR::FD, VM(1, 1, 1), "SpecificAbsorptionRateValue" },
+  { 0x00189182, VR::FD, VM(1, 1, 1), "GradientOutput" },
+  { 0x00189183, VR::CS, VM(1, 1, 1), "FlowCompensationDirection" },
+  { 0x00189184, VR::FD, VM(1, 1, 1), "TaggingDelay" },
+  { 0x00189185, VR::ST, VM(1, 1, 1), "RespiratoryMotionCompensationTechniqueDescription" },
+  { 0x00189186, VR::SH, VM(1, 1, 1), "RespiratorySignalSourceID" },
+  { 0x00189197, VR::SQ, VM(1, 1, 1), "MRVelocityEncodingSequence" },
+  { 0x00189198, VR::CS, VM(1, 1, 1), "FirstOrderPhaseCorrection" },
+  { 0x00189199, VR::CS, VM(1, 1, 1), "WaterReferencedPhaseCorrection" },
+  { 0x00189200, VR::CS, VM(1, 1, 1), "MRSpectroscopyAcquisitionType" },
+  { 0x00189214, VR::CS, VM(1, 1, 1), "RespiratoryCyclePosition" },
+  { 0x00189217, VR::FD, VM(1, 1, 1), "VelocityEncodingMaximumValue" },
+  { 0x00189218, VR::FD, VM(1, 1, 1), "TagSpacingSecondDimension" },
+  { 0x00189219, VR::SS, VM(1, 1, 1), "TagAngleSecondAxis" },
+  { 0x00189220, VR::FD, VM(1, 1, 1), "FrameAcquisitionDuration" },
+  { 0x00189226, VR::SQ, VM(1, 1, 1), "MRImageFrameTypeSequence" },
+  { 0x00189227, VR::SQ, VM(1, 1, 1), "MRSpectroscopyFrameTypeSequence" },
+  { 0x00189231, VR::US, VM(1, 1, 1), "MRAcquisitionPhaseEncodingStepsInPlane" },
+  { 0x00189232, VR::US, VM(1, 1, 1), "MRAcquisitionPhaseEncodingStepsOutOfPlane" },
+  { 0x00189234, VR::UL, VM(1, 1, 1), "SpectroscopyAcquisitionPhaseColumns" },
+  { 0x00189236, VR::CS, VM(1, 1, 1), "CardiacCyclePosition" },
+  { 0x00189239, VR::SQ, VM(1, 1, 1), "SpecificAbsorptionRateSequence" },
+  { 0x00189240, VR::US, VM(1, 1, 1), "RFEchoTrainLength" },
+  { 0x00189241, VR::US, VM(1, 1, 1), "GradientEchoTrainLength" },
+  { 0x00189250, VR::CS, VM(1, 1, 1), "ArterialSpinLabelingContrast" },
+  { 0x00189251, VR::SQ, VM(1, 1, 1), "MRArterialSpinLabelingSequence" },
+  { 0x00189252, VR::LO, VM(1, 1, 1), "ASLTechniqueDescription" },
+  { 0x00189253, VR::US, VM(1, 1, 1), "ASLSlabNumber" },
+  { 0x00189254, VR::FD, VM(1, 1, 1), "ASLSlabThickness" },
+  { 0x00189255, VR::FD, VM(3, 3, 1), "ASLSlabOrientation" },
+  { 0x00189256, VR::FD, VM(3, 3, 1), "ASLMidSlabPosition" },
+  { 0x00189257, VR::CS, VM(1, 1, 1), "ASLContext" },
+  { 0x00189258, VR::UL, VM(1, 1, 1), "ASLPulseTrainDuration" },
+  { 0x00189259, VR::CS, VM(1, 1, 1), "ASLCrusherFlag" },
+  { 0x0018925A, VR::FD, VM(1, 1, 1), "ASLCrusherFlowLimit" },
+  { 0x0018925B, VR::LO, VM(1, 1, 1), "ASLCrusherDescription" },
+  { 0x0018925C, VR::CS, VM(1, 1, 1), "ASLBolusCutoffFlag" },
+  { 0x0018925D, VR::SQ, VM(1, 1, 1), "ASLBolusCutoffTimingSequence" },
+  { 0x0018925E, VR::LO, VM(1, 1, 1), "ASLBolusCutoffTechnique" },
+  { 0x0018925F, VR::UL, VM(1, 1, 1), "ASLBolusCutoffDelayTime" },
+  { 0x00189260, VR::SQ, VM(1, 1, 1), "ASLSlabSequence" },
+  { 0x00189295, VR::FD, VM(1, 1, 1), "ChemicalShiftMinimumIntegrationLimitInppm" },
+  { 0x00189296, VR::FD, VM(1, 1, 1), "ChemicalShiftMaximumIntegrationLimitInppm" },
+  { 0x00189297, VR::CS, VM(1, 1, 1), "WaterReferenceAcquisition" },
+  { 0x00189298, VR::IS, VM(1, 1, 1), "EchoPeakPosition" },
+  { 0x00189301, VR::SQ, VM(1, 1, 1), "CTAcquisitionTypeSequence" },
+  { 0x00189302, VR::CS, VM(1, 1, 1), "AcquisitionType" },
+  { 0x00189303, VR::FD, VM(1, 1, 1), "TubeAngle" },
+  { 0x00189304, VR::SQ, VM(1, 1, 1), "CTAcquisitionDetailsSequence" },
+  { 0x00189305, VR::FD, VM(1, 1, 1), "RevolutionTime" },
+  { 0x00189306, VR::FD, VM(1, 1, 1), "SingleCollimationWidth" },
+  { 0x00189307, VR::FD, VM(1, 1, 1), "TotalCollimationWidth" },
+  { 0x00189308, VR::SQ, VM(1, 1, 1), "CTTableDynamicsSequence" },
+  { 0x00189309, VR::FD, VM(1, 1, 1), "TableSpeed" },
+  { 0x00189310, VR::FD, VM(1, 1, 1), "TableFeedPerRotation" },
+  { 0x00189311, VR::FD, VM(1, 1, 1), "SpiralPitchFactor" },
+  { 0x00189312, VR::SQ, VM(1, 1, 1), "CTGeometrySequence" },
+  { 0x00189313, VR::FD, VM(3, 3, 1), "DataCollectionCenterPatient" },
+  { 0x00189314, VR::SQ, VM(1, 1, 1), "CTReconstructionSequence" },
+  { 0x00189315, VR::CS, VM(1, 1, 1), "ReconstructionAlgorithm" },
+  { 0x00189316, VR::CS, VM(1, 1, 1), "ConvolutionKernelGroup" },
+  { 0x00189317, VR::FD, VM(2, 2, 1), "ReconstructionFieldOfView" },
+  { 0x00189318, VR::FD, VM(3, 3, 1), "ReconstructionTargetCenterPatient" },
+  { 0x00189319, VR::FD, VM(1, 1, 1), "ReconstructionAngle" },
+  { 0x00189320, VR::SH, VM(1, 1, 1), "ImageFilter" },
+  { 0x00189321, VR::SQ, VM(1, 1, 1), "CTExposureSequence" },
+  { 0x00189322, VR::FD, VM(2, 2, 1), "ReconstructionPixelSpacing" },
+  { 0x00189323, VR::CS, VM(1, VM::N, 1), "ExposureModulationType" },
+  { 0x00189324, VR::FD, VM(1, 1, 1), "EstimatedDoseSaving" },
+  { 0x00189325, VR::SQ, VM(1, 1, 1), "CTXRayDetailsSequence" },
+  { 0x00189326, VR::SQ, VM(1, 1, 1), "CTPositionSequence" },
+  { 0x00189327, VR::FD, VM(1, 1, 1), "TablePosition" },
+  { 0x00189328, VR::FD, VM(1, 1, 1), "ExposureTimeInms" },
+  { 0x00189329, VR::SQ, VM(1, 1, 1), "CTImageFrameTypeSequence" },
+  { 0x00189330, VR::FD, VM(1, 1, 1), "XRayTubeCurrentInmA" },
+  { 0x00189332, VR::FD, VM(1, 1, 1), "ExposureInmAs" },
+  { 0x00189333, VR::CS, VM(1, 1, 1), "ConstantVolumeFlag" },
+  { 0x00189334, VR::CS, VM(1, 1, 1), "FluoroscopyFlag" },
+  { 0x00189335, VR::FD, VM(1, 1, 1), "DistanceSourceToDataCollectionCenter" },
+  { 0x00189337, VR::US, VM(1, 1, 1), "ContrastBolusAgentNumber" },
+  { 0x00189338, VR::SQ, VM(1, 1, 1), "ContrastBolusIngredientCodeSequence" },
+  { 0x00189340, VR::SQ, VM(1, 1, 1), "ContrastAdministrationProfileSequence" },
+  { 0x00189341, VR::SQ, VM(1, 1, 1), "ContrastBolusUsageSequence" },
+  { 0x00189342, VR::CS, VM(1, 1, 1), "ContrastBolusAgentAdministered" },
+  { 0x00189343, VR::CS, VM(1, 1, 1), "ContrastBolusAgentDetected" },
+  { 0x00189344, VR::CS, VM(1, 1, 1), "ContrastBolusAgentPhase" },
+  { 0x00189345, VR::FD, VM(1, 1, 1), "CTDIvol" },
+  { 0x00189346, VR::SQ, VM(1, 1, 1), "CTDIPhantomTypeCodeSequence" },
+  { 0x00189351, VR::FL, VM(1, 1, 1), "CalciumScoringMassFactorPatient" },
+  { 0x00189352, VR::FL, VM(3, 3, 1), "CalciumScoringMassFactorDevice" },
+  { 0x00189353, VR::FL, VM(1, 1, 1), "EnergyWeightingFactor" },
+  { 0x00189360, VR::SQ, VM(1, 1, 1), "CTAdditionalXRaySourceSequence" },
+  { 0x00189376, VR::US, VM(1, VM::N, 1), "ReferencedXRayDetectorIndex" },
+  { 0x00189377, VR::US, VM(1, VM::N, 1), "ReferencedXRaySourceIndex" },
+  { 0x00189378, VR::US, VM(1, VM::N, 1), "ReferencedPathIndex" },
+  { 0x00189401, VR::SQ, VM(1, 1, 1), "ProjectionPixelCalibrationSequence" },
+  { 0x00189402, VR::FL, VM(1, 1, 1), "DistanceSourceToIsocenter" },
+  { 0x00189403, VR::FL, VM(1, 1, 1), "DistanceObjectToTableTop" },
+  { 0x00189404, VR::FL, VM(2, 2, 1), "ObjectPixelSpacingInCenterOfBeam" },
+  { 0x00189405, VR::SQ, VM(1, 1, 1), "PositionerPositionSequence" },
+  { 0x00189406, VR::SQ, VM(1, 1, 1), "TablePositionSequence" },
+  { 0x00189407, VR::SQ, VM(1, 1, 1), "CollimatorShapeSequence" },
+  { 0x00189410, VR::CS, VM(1, 1, 1), "PlanesInAcquisition" },
+  { 0x00189412, VR::SQ, VM(1, 1, 1), "XAXRFFrameCharacteristicsSequence" },
+  { 0x00189417, VR::SQ, VM(1, 1, 1), "FrameAcquisitionSequence" },
+  { 0x00189420, VR::CS, VM(1, 1, 1), "XRayReceptorType" },
+  { 0x00189423, VR::LO, VM(1, 1, 1), "AcquisitionProtocolName" },
+  { 0x00189424, VR::LT, VM(1, 1, 1), "AcquisitionProtocolDescription" },
+  { 0x00189425, VR::CS, VM(1, 1, 1), "ContrastBolusIngredientOpaque" },
+  { 0x00189426, VR::FL, VM(1, 1, 1), "DistanceReceptorPlaneToDetectorHousing" },
+  { 0x00189427, VR::CS, VM(1, 1, 1), "IntensifierActiveShape" },
+  { 0x00189428, VR::FL, VM(1, 2, 1), "IntensifierActiveDimensions" },
+  { 0x00189429, VR::FL, VM(2, 2, 1), "PhysicalDetectorSize" },
+  { 0x00189430, VR::FL, VM(2, 2, 1), "PositionOfIsocenterProjection" },
+  { 0x00189432, VR::SQ, VM(1, 1, 1), "FieldOfViewSequence" },
+  { 0x00189433, VR::LO, VM(1, 1, 1), "FieldOfViewDescription" },
+  { 0x00189434, VR::SQ, VM(1, 1, 1), "ExposureControlSensingRegionsSequence" },
+  { 0x00189435, VR::CS, VM(1, 1, 1), "ExposureControlSensingRegionShape" },
+  { 0x00189436, VR::SS, VM(1, 1, 1), "ExposureControlSensingRegionLeftVerticalEdge" },
+  { 0x00189437, VR::SS, VM(1, 1, 1), "ExposureControlSensingRegionRightVerticalEdge" },
+  { 0x00189438, VR::SS, VM(1, 1, 1), "ExposureControlSensingRegionUpperHorizontalEdge" },
+  { 0x00189439, VR::SS, VM(1, 1, 1), "ExposureControlSensingRegionLowerHorizontalEdge" },
+  { 0x00189440, VR::SS, VM(2, 2, 1), "CenterOfCircularExposureControlSensingRegion" },
+  { 0x00189441, VR::US, VM(1, 1, 1), "RadiusOfCircularExposureControlSensingRegion" },
+  { 0x00189442, VR::SS, VM(2, VM::N, 1), "VerticesOfThePolygonalExposureControlSensingRegion" },
+  { 0x00189447, VR::FL, VM(1, 1, 1), "ColumnAngulationPatient" },
+  { 0x00189449, VR::FL, VM(1, 1, 1), "BeamAngle" },
+  { 0x00189451, VR::SQ, VM(1, 1, 1), "FrameDetectorParametersSequence" },
+  { 0x00189452, VR::FL, VM(1, 1, 1), "CalculatedAnatomyThickness" },
+  { 0x00189455, VR::SQ, VM(1, 1, 1), "CalibrationSequence" },
+  { 0x00189456, VR::SQ, VM(1, 1, 1), "ObjectThicknessSequence" },
+  { 0x00189457, VR::CS, VM(1, 1, 1), "PlaneIdentification" },
+  { 0x00189461, VR::FL, VM(1, 2, 1), "FieldOfViewDimensionsInFloat" },
+  { 0x00189462, VR::SQ, VM(1, 1, 1), "IsocenterReferenceSystemSequence" },
+  { 0x00189463, VR::FL, VM(1, 1, 1), "PositionerIsocenterPrimaryAngle" },
+  { 0x00189464, VR::FL, VM(1, 1, 1), "PositionerIsocenterSecondaryAngle" },
+  { 0x00189465, VR::FL, VM(1, 1, 1), "PositionerIsocenterDetectorRotationAngle" },
+  { 0x00189466, VR::FL, VM(1, 1, 1), "TableXPositionToIsocenter" },
+  { 0x00189467, VR::FL, VM(1, 1, 1), "TableYPositionToIsocenter" },
+  { 0x00189468, VR::FL, VM(1, 1, 1), "TableZPositionToIsocenter" },
+  { 0x00189469, VR::FL, VM(1, 1, 1), "TableHorizontalRotationAngle" },
+  { 0x00189470, VR::FL, VM(1, 1, 1), "TableHeadTiltAngle" },
+  { 0x00189471, VR::FL, VM(1, 1, 1), "TableCradleTiltAngle" },
+  { 0x00189472, VR::SQ, VM(1, 1, 1), "FrameDisplayShutterSequence" },
+  { 0x00189473, VR::FL, VM(1, 1, 1), "AcquiredImageAreaDoseProduct" },
+  { 0x00189474, VR::CS, VM(1, 1, 1), "CArmPositionerTabletopRelationship" },
+  { 0x00189476, VR::SQ, VM(1, 1, 1), "XRayGeometrySequence" },
+  { 0x00189477, VR::SQ, VM(1, 1, 1), "IrradiationEventIdentificationSequence" },
+  { 0x00189504, VR::SQ, VM(1, 1, 1), "XRay3DFrameTypeSequence" },
+  { 0x00189506, VR::SQ, VM(1, 1, 1), "ContributingSourcesSequence" },
+  { 0x00189507, VR::SQ, VM(1, 1, 1), "XRay3DAcquisitionSequence" },
+  { 0x00189508, VR::FL, VM(1, 1, 1), "PrimaryPositionerScanArc" },
+  { 0x00189509, VR::FL, VM(1, 1, 1), "SecondaryPositionerScanArc" },
+  { 0x00189510, VR::FL, VM(1, 1, 1), "PrimaryPositionerScanStartAngle" },
+  { 0x00189511, VR::FL, VM(1, 1, 1), "SecondaryPositionerScanStartAngle" },
+  { 0x00189514, VR::FL, VM(1, 1, 1), "PrimaryPositionerIncrement" },
+  { 0x00189515, VR::FL, VM(1, 1, 1), "SecondaryPositionerIncrement" },
+  { 0x00189516, VR::DT, VM(1, 1, 1), "StartAcquisitionDateTime" },
+  { 0x00189517, VR::DT, VM(1, 1, 1), "EndAcquisitionDateTime" },
+  { 0x00189518, VR::SS, VM(1, 1, 1), "PrimaryPositionerIncrementSign" },
+  { 0x00189519, VR::SS, VM(1, 1, 1), "SecondaryPositionerIncrementSign" },
+  { 0x00189524, VR::LO, VM(1, 1, 1), "ApplicationName" },
+  { 0x00189525, VR::LO, VM(1, 1, 1), "ApplicationVersion" },
+  { 0x00189526, VR::LO, VM(1, 1, 1), "ApplicationManufacturer" },
+  { 0x00189527, VR::CS, VM(1, 1, 1), "AlgorithmType" },
+  { 0x00189528, VR::LO, VM(1, 1, 1), "AlgorithmDescription" },
+  { 0x00189530, VR::SQ, VM(1, 1, 1), "XRay3DReconstructionSequence" },
+  { 0x00189531, VR::LO, VM(1, 1, 1), "ReconstructionDescription" },
+  { 0x00189538, VR::SQ, VM(1, 1, 1), "PerProjectionAcquisitionSequence" },
+  { 0x00189541, VR::SQ, VM(1, 1, 1), "DetectorPositionSequence" },
+  { 0x00189542, VR::SQ, VM(1, 1, 1), "XRayAcquisitionDoseSequence" },
+  { 0x00189543, VR::FD, VM(1, 1, 1), "XRaySourceIsocenterPrimaryAngle" },
+  { 0x00189544, VR::FD, VM(1, 1, 1), "XRaySourceIsocenterSecondaryAngle" },
+  { 0x00189545, VR::FD, VM(1, 1, 1), "BreastSupportIsocenterPrimaryAngle" },
+  { 0x00189546, VR::FD, VM(1, 1, 1), "BreastSupportIsocenterSecondaryAngle" },
+  { 0x00189547, VR::FD, VM(1, 1, 1), "BreastSupportXPositionToIsocenter" },
+  { 0x00189548, VR::FD, VM(1, 1, 1), "BreastSupportYPositionToIsocenter" },
+  { 0x00189549, VR::FD, VM(1, 1, 1), "BreastSupportZPositionToIsocenter" },
+  { 0x00189550, VR::FD, VM(1, 1, 1), "DetectorIsocenterPrimaryAngle" },
+  { 0x00189551, VR::FD, VM(1, 1, 1), "DetectorIsocenterSecondaryAngle" },
+  { 0x00189552, VR::FD, VM(1, 1, 1), "DetectorXPositionToIsocenter" },
+  { 0x00189553, VR::FD, VM(1, 1, 1), "DetectorYPositionToIsocenter" },
+  { 0x00189554, VR::FD, VM(1, 1, 1), "DetectorZPositionToIsocenter" },
+  { 0x00189555, VR::SQ, VM(1, 1, 1), "XRayGridSequence" },
+  { 0x00189556, VR::SQ, VM(1, 1, 1), "XRayFilterSequence" },
+  { 0x00189557, VR::FD, VM(3, 3, 1), "DetectorActiveAreaTLHCPosition" },
+  { 0x00189558, VR::FD, VM(6, 6, 1), "DetectorActiveAreaOrientation" },
+  { 0x00189559, VR::CS, VM(1, 1, 1), "PositionerPrimaryAngleDirection" },
+  { 0x00189601, VR::SQ, VM(1, 1, 1), "DiffusionBMatrixSequence" },
+  { 0x00189602, VR::FD, VM(1, 1, 1), "DiffusionBValueXX" },
+  { 0x00189603, VR::FD, VM(1, 1, 1), "DiffusionBValueXY" },
+  { 0x00189604, VR::FD, VM(1, 1, 1), "DiffusionBValueXZ" },
+  { 0x00189605, VR::FD, VM(1, 1, 1), "DiffusionBValueYY" },
+  { 0x00189606, VR::FD, VM(1, 1, 1), "DiffusionBValueYZ" },
+  { 0x00189607, VR::FD, VM(1, 1, 1), "DiffusionBValueZZ" },
+  { 0x00189621, VR::SQ, VM(1, 1, 1), "FunctionalMRSequence" },
+  { 0x00189622, VR::CS, VM(1, 1, 1), "FunctionalSettlingPhaseFramesPresent" },
+  { 0x00189623, VR::DT, VM(1, 1, 1), "FunctionalSyncPulse" },
+  { 0x00189624, VR::CS, VM(1, 1, 1), "SettlingPhaseFrame" },
+  { 0x00189701, VR::DT, VM(1, 1, 1), "DecayCorrectionDateTime" },
+  { 0x00189715, VR::FD, VM(1, 1, 1), "StartDensityThreshold" },
+  { 0x00189716, VR::FD, VM(1, 1, 1), "StartRelativeDensityDifferenceThreshold" },
+  { 0x00189717, VR::FD, VM(1, 1, 1), "StartCardiacTriggerCountThreshold" },
+  { 0x00189718, VR::FD, VM(1, 1, 1), "StartRespiratoryTriggerCountThreshold" },
+  { 0x00189719, VR::FD, VM(1, 1, 1), "TerminationCountsThreshold" },
+  { 0x00189720, VR::FD, VM(1, 1, 1), "TerminationDensityThreshold" },
+  { 0x00189721, VR::FD, VM(1, 1, 1), "TerminationRelativeDensityThreshold" },
+  { 0x00189722, VR::FD, VM(1, 1, 1), "TerminationTimeThreshold" },
+  { 0x00189723, VR::FD, VM(1, 1, 1), "TerminationCardiacTriggerCountThreshold" },
+  { 0x00189724, VR::FD, VM(1, 1, 1), "TerminationRespiratoryTriggerCountThreshold" },
+  { 0x00189725, VR::CS, VM(1, 1, 1), "DetectorGeometry" },
+  { 0x00189726, VR::FD, VM(1, 1, 1), "TransverseDetectorSeparation" },
+  { 0x00189727, VR::FD, VM(1, 1, 1), "AxialDetectorDimension" },
+  { 0x00189729, VR::US, VM(1, 1, 1), "RadiopharmaceuticalAgentNumber" },
+  { 0x00189732, VR::SQ, VM(1, 1, 1), "PETFrameAcquisitionSequence" },
+  { 0x00189733, VR::SQ, VM(1, 1, 1), "PETDetectorMotionDetailsSequence" },
+  { 0x00189734, VR::SQ, VM(1, 1, 1), "PETTableDynamicsSequence" },
+  { 0x00189735, VR::SQ, VM(1, 1, 1), "PETPositionSequence" },
+  { 0x00189736, VR::SQ, VM(1, 1, 1), "PETFrameCorrectionFactorsSequence" },
+  { 0x00189737, VR::SQ, VM(1, 1, 1), "RadiopharmaceuticalUsageSequence" },
+  { 0x00189738, VR::CS, VM(1, 1, 1), "AttenuationCorrectionSource" },
+  { 0x00189739, VR::US, VM(1, 1, 1), "NumberOfIterations" },
+  { 0x00189740, VR::US, VM(1, 1, 1), "NumberOfSubsets" },
+  { 0x00189749, VR::SQ, VM(1, 1, 1), "PETReconstructionSequence" },
+  { 0x00189751, VR::SQ, VM(1, 1, 1), "PETFrameTypeSequence" },
+  { 0x00189755, VR::CS, VM(1, 1, 1), "TimeOfFlightInformationUsed" },
+  { 0x00189756, VR::CS, VM(1, 1, 1), "ReconstructionType" },
+  { 0x00189758, VR::CS, VM(1, 1, 1), "DecayCorrected" },
+  { 0x00189759, VR::CS, VM(1, 1, 1), "AttenuationCorrected" },
+  { 0x00189760, VR::CS, VM(1, 1, 1), "ScatterCorrected" },
+  { 0x00189761, VR::CS, VM(1, 1, 1), "DeadTimeCorrected" },
+  { 0x00189762, VR::CS, VM(1, 1, 1), "GantryMotionCorrected" },
+  { 0x00189763, VR::CS, VM(1, 1, 1), "PatientMotionCorrected" },
+  { 0x00189764, VR::CS, VM(1, 1, 1), "CountLossNormalizationCorrected" },
+  { 0x00189765, VR::CS, VM(1, 1, 1), "RandomsCorrected" },
+  { 0x00189766, VR::CS, VM(1, 1, 1), "NonUniformRadialSamplingCorrected" },
+  { 0x00189767, VR::CS, VM(1, 1, 1), "SensitivityCalibrated" },
+  { 0x00189768, VR::CS, VM(1, 1, 1), "DetectorNormalizationCorrection" },
+  { 0x00189769, VR::CS, VM(1, 1, 1), "IterativeReconstructionMethod" },
+  { 0x00189770, VR::CS, VM(1, 1, 1), "AttenuationCorrectionTemporalRelationship" },
+  { 0x00189771, VR::SQ, VM(1, 1, 1), "PatientPhysiologicalStateSequence" },
+  { 0x00189772, VR::SQ, VM(1, 1, 1), "PatientPhysiologicalStateCodeSequence" },
+  { 0x00189801, VR::FD, VM(1, VM::N, 1), "DepthsOfFocus" },
+  { 0x00189803, VR::SQ, VM(1, 1, 1), "ExcludedIntervalsSequence" },
+  { 0x00189804, VR::DT, VM(1, 1, 1), "ExclusionStartDateTime" },
+  { 0x00189805, VR::FD, VM(1, 1, 1), "ExclusionDuration" },
+  { 0x00189806, VR::SQ, VM(1, 1, 1), "USImageDescriptionSequence" },
+  { 0x00189807, VR::SQ, VM(1, 1, 1), "ImageDataTypeSequence" },
+  { 0x00189808, VR::CS, VM(1, 1, 1), "DataType" },
+  { 0x00189809, VR::SQ, VM(1, 1, 1), "TransducerScanPatternCodeSequence" },
+  { 0x0018980B, VR::CS, VM(1, 1, 1), "AliasedDataType" },
+  { 0x0018980C, VR::CS, VM(1, 1, 1), "PositionMeasuringDeviceUsed" },
+  { 0x0018980D, VR::SQ, VM(1, 1, 1), "TransducerGeometryCodeSequence" },
+  { 0x0018980E, VR::SQ, VM(1, 1, 1), "TransducerBeamSteeringCodeSequence" },
+  { 0x0018980F, VR::SQ, VM(1, 1, 1), "TransducerApplicationCodeSequence" },
+  { 0x00189810, VR::US, VM(1, 1, 1), "ZeroVelocityPixelValue" },
+  { 0x00189908, VR::UC, VM(1, VM::N, 1), "PotentialReasonsForProcedure" },
+  { 0x0018990A, VR::UC, VM(1, VM::N, 1), "PotentialDiagnosticTasks" },
+  { 0x00189938, VR::US, VM(1, VM::N, 1), "SourceAcquisitionProtocolElementNumber" },
+  { 0x00189939, VR::US, VM(1, VM::N, 1), "SourceAcquisitionBeamNumber" },
+  { 0x0018993A, VR::US, VM(1, VM::N, 1), "SourceReconstructionProtocolElementNumber" },
+  { 0x0018A001, VR::SQ, VM(1, 1, 1), "ContributingEquipmentSequence" },
+  { 0x0018A002, VR::DT, VM(1, 1, 1), "ContributionDateTime" },
+  { 0x0018A003, VR::ST, VM(1, 1, 1), "ContributionDescription" },
+  { 0x0020000D, VR::UI, VM(1, 1, 1), "StudyInstanceUID" },
+  { 0x0020000E, VR::UI, VM(1, 1, 1), "SeriesInstanceUID" },
+  { 0x00200010, VR::SH, VM(1, 1, 1), "StudyID" },
+  { 0x00200011, VR::IS, VM(1, 1, 1), "SeriesNumber" },
+  { 0x00200012, VR::IS, VM(1, 1, 1), "AcquisitionNumber" },
+  { 0x00200013, VR::IS, VM(1, 1, 1), "InstanceNumber" },
+  { 0x00200019, VR::IS, VM(1, 1, 1), "ItemNumber" },
+  { 0x00200020, VR::CS, VM(2, 2, 1), "PatientOrientation" },
+  { 0x00200032, VR::DS, VM(3, 3, 1), "ImagePositionPatient" },
+  { 0x00200037, VR::DS, VM(6, 6, 1), "ImageOrientationPatient" },
+  { 0x00200052, VR::UI, VM(1, 1, 1), "FrameOfReferenceUID" },
+  { 0x00200060, VR::CS, VM(1, 1, 1), "Laterality" },
+  { 0x00200062, VR::CS, VM(1, 1, 1), "ImageLaterality" },
+  { 0x00200100, VR::IS, VM(1, 1, 1), "TemporalPositionIdentifier" },
+  { 0x00200105, VR::IS, VM(1, 1, 1), "NumberOfTemporalPositions" },
+  { 0x00200110, VR::DS, VM(1, 1, 1), "TemporalResolution" },
+  { 0x00200200, VR::UI, VM(1, 1, 1), "SynchronizationFrameOfReferenceUID" },
+  { 0x00200242, VR::UI, VM(1, 1, 1), "SOPInstanceUIDOfConcatenationSource" },
+  { 0x00201002, VR::IS, VM(1, 1, 1), "ImagesInAcquisition" },
+  { 0x00201040, VR::LO, VM(1, 1, 1), "PositionReferenceIndicator" },
+  { 0x00201041, VR::DS, VM(1, 1, 1), "SliceLocation" },
+  { 0x00201200, VR::IS, VM(1, 1, 1), "NumberOfPatientRelatedStudies" },
+  { 0x00201202, VR::IS, VM(1, 1, 1), "NumberOfPatientRelatedSeries" },
+  { 0x00201204, VR::IS, VM(1, 1, 1), "NumberOfPatientRelatedInstances" },
+  { 0x00201206, VR::IS, VM(1, 1, 1), "NumberOfStudyRelatedSeries" },
+  { 0x00201208, VR::IS, VM(1, 1, 1), "NumberOfStudyRelatedInstances" },
+  { 0x00201209, VR::IS, VM(1, 1, 1), "NumberOfSeriesRelatedInstances" },
+  { 0x00204000, VR::LT, VM(1, 1, 1), "ImageComments" },
+  { 0x00209056, VR::SH, VM(1, 1, 1), "StackID" },
+  { 0x00209057, VR::UL, VM(1, 1, 1), "InStackPositionNumber" },
+  { 0x00209071, VR::SQ, VM(1, 1, 1), "FrameAnatomySequence" },
+  { 0x00209072, VR::CS, VM(1, 1, 1), "FrameLaterality" },
+  { 0x00209111, VR::SQ, VM(1, 1, 1), "FrameContentSequence" },
+  { 0x00209113, VR::SQ, VM(1, 1, 1), "PlanePositionSequence" },
+  { 0x00209116, VR::SQ, VM(1, 1, 1), "PlaneOrientationSequence" },
+  { 0x00209128, VR::UL, VM(1, 1, 1), "TemporalPositionIndex" },
+  { 0x00209153, VR::FD, VM(1, 1, 1), "NominalCardiacTriggerDelayTime" },
+  { 0x00209154, VR::FL, VM(1, 1, 1), "NominalCardiacTriggerTimePriorToRPeak" },
+  { 0x00209155, VR::FL, VM(1, 1, 1), "ActualCardiacTriggerTimePriorToRPeak" },
+  { 0x00209156, VR::US, VM(1, 1, 1), "FrameAcquisitionNumber" },
+  { 0x00209157, VR::UL, VM(1, VM::N, 1), "DimensionIndexValues" },
+  { 0x00209158, VR::LT, VM(1, 1, 1), "FrameComments" },
+  { 0x00209161, VR::UI, VM(1, 1, 1), "ConcatenationUID" },
+  { 0x00209162, VR::US, VM(1, 1, 1), "InConcatenationNumber" },
+  { 0x00209163, VR::US, VM(1, 1, 1), "InConcatenationTotalNumber" },
+  { 0x00209164, VR::UI, VM(1, 1, 1), "DimensionOrganizationUID" },
+  { 0x00209165, VR::AT, VM(1, 1, 1), "DimensionIndexPointer" },
+  { 0x00209167, VR::AT, VM(1, 1, 1), "FunctionalGroupPointer" },
+  { 0x00209170, VR::SQ, VM(1, 1, 1), "UnassignedSharedConvertedAttributesSequence" },
+  { 0x00209171, VR::SQ, VM(1, 1, 1), "UnassignedPerFrameConvertedAttributesSequence" },
+  { 0x00209172, VR::SQ, VM(1, 1, 1), "ConversionSourceAttributesSequence" },
+  { 0x00209213, VR::LO, VM(1, 1, 1), "DimensionIndexPrivateCreator" },
+  { 0x00209221, VR::SQ, VM(1, 1, 1), "DimensionOrganizationSequence" },
+  { 0x00209222, VR::SQ, VM(1, 1, 1), "DimensionIndexSequence" },
+  { 0x00209228, VR::UL, VM(1, 1, 1), "ConcatenationFrameOffsetNumber" },
+  { 0x00209238, VR::LO, VM(1, 1, 1), "FunctionalGroupPrivateCreator" },
+  { 0x00209241, VR::FL, VM(1, 1, 1), "NominalPercentageOfCardiacPhase" },
+  { 0x00209245, VR::FL, VM(1, 1, 1), "NominalPercentageOfRespiratoryPhase" },
+  { 0x00209246, VR::FL, VM(1, 1, 1), "StartingRespiratoryAmplitude" },
+  { 0x00209247, VR::CS, VM(1, 1, 1), "StartingRespiratoryPhase" },
+  { 0x00209248, VR::FL, VM(1, 1, 1), "EndingRespiratoryAmplitude" },
+  { 0x00209249, VR::CS, VM(1, 1, 1), "EndingRespiratoryPhase" },
+  { 0x00209250, VR::CS, VM(1, 1, 1), "RespiratoryTriggerType" },
+  { 0x00209251, VR::FD, VM(1, 1, 1), "RRIntervalTimeNominal" },
+  { 0x00209252, VR::FD, VM(1, 1, 1), "ActualCardiacTriggerDelayTime" },
+  { 0x00209253, VR::SQ, VM(1, 1, 1), "RespiratorySynchronizationSequence" },
+  { 0x00209254, VR::FD, VM(1, 1, 1), "RespiratoryIntervalTime" },
+  { 0x00209255, VR::FD, VM(1, 1, 1), "NominalRespiratoryTriggerDelayTime" },
+  { 0x00209256, VR::FD, VM(1, 1, 1), "RespiratoryTriggerDelayThreshold" },
+  { 0x00209257, VR::FD, VM(1, 1, 1), "ActualRespiratoryTriggerDelayTime" },
+  { 0x00209301, VR::FD, VM(3, 3, 1), "ImagePositionVolume" },
+  { 0x00209302, VR::FD, VM(6, 6, 1), "ImageOrientationVolume" },
+  { 0x00209307, VR::CS, VM(1, 1, 1), "UltrasoundAcquisitionGeometry" },
+  { 0x00209308, VR::FD, VM(3, 3, 1), "ApexPosition" },
+  { 0x00209309, VR::FD, VM(16, 16, 1), "VolumeToTransducerMappingMatrix" },
+  { 0x0020930A, VR::FD, VM(16, 16, 1), "VolumeToTableMappingMatrix" },
+  { 0x0020930B, VR::CS, VM(1, 1, 1), "VolumeToTransducerRelationship" },
+  { 0x0020930C, VR::CS, VM(1, 1, 1), "PatientFrameOfReferenceSource" },
+  { 0x0020930D, VR::FD, VM(1, 1, 1), "TemporalPositionTimeOffset" },
+  { 0x0020930E, VR::SQ, VM(1, 1, 1), "PlanePositionVolumeSequence" },
+  { 0x0020930F, VR::SQ, VM(1, 1, 1), "PlaneOrientationVolumeSequence" },
+  { 0x00209310, VR::SQ, VM(1, 1, 1), "TemporalPositionSequence" },
+  { 0x00209311, VR::CS, VM(1, 1, 1), "DimensionOrganizationType" },
+  { 0x00209312, VR::UI, VM(1, 1, 1), "VolumeFrameOfReferenceUID" },
+  { 0x00209313, VR::UI, VM(1, 1, 1), "TableFrameOfReferenceUID" },
+  { 0x00209421, VR::LO, VM(1, 1, 1), "DimensionDescriptionLabel" },
+  { 0x00209450, VR::SQ, VM(1, 1, 1), "PatientOrientationInFrameSequence" },
+  { 0x00209453, VR::LO, VM(1, 1, 1), "FrameLabel" },
+  { 0x00209518, VR::US, VM(1, VM::N, 1), "AcquisitionIndex" },
+  { 0x00209529, VR::SQ, VM(1, 1, 1), "ContributingSOPInstancesReferenceSequence" },
+  { 0x00209536, VR::US, VM(1, 1, 1), "ReconstructionIndex" },
+  { 0x00220001, VR::US, VM(1, 1, 1), "LightPathFilterPassThroughWavelength" },
+  { 0x00220002, VR::US, VM(2, 2, 1), "LightPathFilterPassBand" },
+  { 0x00220003, VR::US, VM(1, 1, 1), "ImagePathFilterPassThroughWavelength" },
+  { 0x00220004, VR::US, VM(2, 2, 1), "ImagePathFilterPassBand" },
+  { 0x00220005, VR::CS, VM(1, 1, 1), "PatientEyeMovementCommanded" },
+  { 0x00220006, VR::SQ, VM(1, 1, 1), "PatientEyeMovementCommandCodeSequence" },
+  { 0x00220007, VR::FL, VM(1, 1, 1), "SphericalLensPower" },
+  { 0x00220008, VR::FL, VM(1, 1, 1), "CylinderLensPower" },
+  { 0x00220009, VR::FL, VM(1, 1, 1), "CylinderAxis" },
+  { 0x0022000A, VR::FL, VM(1, 1, 1), "EmmetropicMagnification" },
+  { 0x0022000B, VR::FL, VM(1, 1, 1), "IntraOcularPressure" },
+  { 0x0022000C, VR::FL, VM(1, 1, 1), "HorizontalFieldOfView" },
+  { 0x0022000D, VR::CS, VM(1, 1, 1), "PupilDilated" },
+  { 0x0022000E, VR::FL, VM(1, 1, 1), "DegreeOfDilation" },
+  { 0x00220010, VR::FL, VM(1, 1, 1), "StereoBaselineAngle" },
+  { 0x00220011, VR::FL, VM(1, 1, 1), "StereoBaselineDisplacement" },
+  { 0x00220012, VR::FL, VM(1, 1, 1), "StereoHorizontalPixelOffset" },
+  { 0x00220013, VR::FL, VM(1, 1, 1), "StereoVerticalPixelOffset" },
+  { 0x00220014, VR::FL, VM(1, 1, 1), "StereoRotation" },
+  { 0x00220015, VR::SQ, VM(1, 1, 1), "AcquisitionDeviceTypeCodeSequence" },
+  { 0x00220016, VR::SQ, VM(1, 1, 1), "IlluminationTypeCodeSequence" },
+  { 0x00220017, VR::SQ, VM(1, 1, 1), "LightPathFilterTypeStackCodeSequence" },
+  { 0x00220018, VR::SQ, VM(1, 1, 1), "ImagePathFilterTypeStackCodeSequence" },
+  { 0x00220019, VR::SQ, VM(1, 1, 1), "LensesCodeSequence" },
+  { 0x0022001A, VR::SQ, VM(1, 1, 1), "ChannelDescriptionCodeSequence" },
+  { 0x0022001B, VR::SQ, VM(1, 1, 1), "RefractiveStateSequence" },
+  { 0x0022001C, VR::SQ, VM(1, 1, 1), "MydriaticAgentCodeSequence" },
+  { 0x0022001D, VR::SQ, VM(1, 1, 1), "RelativeImagePositionCodeSequence" },
+  { 0x0022001E, VR::FL, VM(1, 1, 1), "CameraAngleOfView" },
+  { 0x00220020, VR::SQ, VM(1, 1, 1), "StereoPairsSequence" },
+  { 0x00220021, VR::SQ, VM(1, 1, 1), "LeftImageSequence" },
+  { 0x00220022, VR::SQ, VM(1, 1, 1), "RightImageSequence" },
+  { 0x00220028, VR::CS, VM(1, 1, 1), "StereoPairsPresent" },
+  { 0x00220030, VR::FL, VM(1, 1, 1), "AxialLengthOfTheEye" },
+  { 0x00220031, VR::SQ, VM(1, 1, 1), "OphthalmicFrameLocationSequence" },
+  { 0x00220032, VR::FL, VM(1, VM::N, 2), "ReferenceCoordinates" },
+  { 0x00220035, VR::FL, VM(1, 1, 1), "DepthSpatialResolution" },
+  { 0x00220036, VR::FL, VM(1, 1, 1), "MaximumDepthDistortion" },
+  { 0x00220037, VR::FL, VM(1, 1, 1), "AlongScanSpatialResolution" },
+  { 0x00220038, VR::FL, VM(1, 1, 1), "MaximumAlongScanDistortion" },
+  { 0x00220039, VR::CS, VM(1, 1, 1), "OphthalmicImageOrientation" },
+  { 0x00220041, VR::FL, VM(1, 1, 1), "DepthOfTransverseImage" },
+  { 0x00220042, VR::SQ, VM(1, 1, 1), "MydriaticAgentConcentrationUnitsSequence" },
+  { 0x00220048, VR::FL, VM(1, 1, 1), "AcrossScanSpatialResolution" },
+  { 0x00220049, VR::FL, VM(1, 1, 1), "MaximumAcrossScanDistortion" },
+  { 0x0022004E, VR::DS, VM(1, 1, 1), "MydriaticAgentConcentration" },
+  { 0x00220055, VR::FL, VM(1, 1, 1), "IlluminationWaveLength" },
+  { 0x00220056, VR::FL, VM(1, 1, 1), "IlluminationPower" },
+  { 0x00220057, VR::FL, VM(1, 1, 1), "IlluminationBandwidth" },
+  { 0x00220058, VR::SQ, VM(1, 1, 1), "MydriaticAgentSequence" },
+  { 0x00221007, VR::SQ, VM(1, 1, 1), "OphthalmicAxialMeasurementsRightEyeSequence" },
+  { 0x00221008, VR::SQ, VM(1, 1, 1), "OphthalmicAxialMeasurementsLeftEyeSequence" },
+  { 0x00221009, VR::CS, VM(1, 1, 1), "OphthalmicAxialMeasurementsDeviceType" },
+  { 0x00221010, VR::CS, VM(1, 1, 1), "OphthalmicAxialLengthMeasurementsType" },
+  { 0x00221012, VR::SQ, VM(1, 1, 1), "OphthalmicAxialLengthSequence" },
+  { 0x00221019, VR::FL, VM(1, 1, 1), "OphthalmicAxialLength" },
+  { 0x00221024, VR::SQ, VM(1, 1, 1), "LensStatusCodeSequence" },
+  { 0x00221025, VR::SQ, VM(1, 1, 1), "VitreousStatusCodeSequence" },
+  { 0x00221028, VR::SQ, VM(1, 1, 1), "IOLFormulaCodeSequence" },
+  { 0x00221029, VR::LO, VM(1, 1, 1), "IOLFormulaDetail" },
+  { 0x00221033, VR::FL, VM(1, 1, 1), "KeratometerIndex" },
+  { 0x00221035, VR::SQ, VM(1, 1, 1), "SourceOfOphthalmicAxialLengthCodeSequence" },
+  { 0x00221037, VR::FL, VM(1, 1, 1), "TargetRefraction" },
+  { 0x00221039, VR::CS, VM(1, 1, 1), "RefractiveProcedureOccurred" },
+  { 0x00221040, VR::SQ, VM(1, 1, 1), "RefractiveSurgeryTypeCodeSequence" },
+  { 0x00221044, VR::SQ, VM(1, 1, 1), "OphthalmicUltrasoundMethodCodeSequence" },
+  { 0x00221050, VR::SQ, VM(1, 1, 1), "OphthalmicAxialLengthMeasurementsSequence" },
+  { 0x00221053, VR::FL, VM(1, 1, 1), "IOLPower" },
+  { 0x00221054, VR::FL, VM(1, 1, 1), "PredictedRefractiveError" },
+  { 0x00221059, VR::FL, VM(1, 1, 1), "OphthalmicAxialLengthVelocity" },
+  { 0x00221065, VR::LO, VM(1, 1, 1), "LensStatusDescription" },
+  { 0x00221066, VR::LO, VM(1, 1, 1), "VitreousStatusDescription" },
+  { 0x00221090, VR::SQ, VM(1, 1, 1), "IOLPowerSequence" },
+  { 0x00221092, VR::SQ, VM(1, 1, 1), "LensConstantSequence" },
+  { 0x00221093, VR::LO, VM(1, 1, 1), "IOLManufacturer" },
+  { 0x00221095, VR::LO, VM(1, 1, 1), "ImplantName" },
+  { 0x00221096, VR::SQ, VM(1, 1, 1), "KeratometryMeasurementTypeCodeSequence" },
+  { 0x00221097, VR::LO, VM(1, 1, 1), "ImplantPartNumber" },
+  { 0x00221100, VR::SQ, VM(1, 1, 1), "ReferencedOphthalmicAxialMeasurementsSequence" },
+  { 0x00221101, VR::SQ, VM(1, 1, 1), "OphthalmicAxialLengthMeasurementsSegmentNameCodeSequence" },
+  { 0x00221103, VR::SQ, VM(1, 1, 1), "RefractiveErrorBeforeRefractiveSurgeryCodeSequence" },
+  { 0x00221121, VR::FL, VM(1, 1, 1), "IOLPowerForExactEmmetropia" },
+  { 0x00221122, VR::FL, VM(1, 1, 1), "IOLPowerForExactTargetRefraction" },
+  { 0x00221125, VR::SQ, VM(1, 1, 1), "AnteriorChamberDepthDefinitionCodeSequence" },
+  { 0x00221127, VR::SQ, VM(1, 1, 1), "LensThicknessSequence" },
+  { 0x00221128, VR::SQ, VM(1, 1, 1), "AnteriorChamberDepthSequence" },
+  { 0x00221130, VR::FL, VM(1, 1, 1), "LensThickness" },
+  { 0x00221131, VR::FL, VM(1, 1, 1), "AnteriorChamberDepth" },
+  { 0x00221132, VR::SQ, VM(1, 1, 1), "SourceOfLensThicknessDataCodeSequence" },
+  { 0x00221133, VR::SQ, VM(1, 1, 1), "SourceOfAnteriorChamberDepthDataCodeSequence" },
+  { 0x00221134, VR::SQ, VM(1, 1, 1), "SourceOfRefractiveMeasurementsSequence" },
+  { 0x00221135, VR::SQ, VM(1, 1, 1), "SourceOfRefractiveMeasurementsCodeSequence" },
+  { 0x00221140, VR::CS, VM(1, 1, 1), "OphthalmicAxialLengthMeasurementModified" },
+  { 0x00221150, VR::SQ, VM(1, 1, 1), "OphthalmicAxialLengthDataSourceCodeSequence" },
+  { 0x00221155, VR::FL, VM(1, 1, 1), "SignalToNoiseRatio" },
+  { 0x00221159, VR::LO, VM(1, 1, 1), "OphthalmicAxialLengthDataSourceDescription" },
+  { 0x00221210, VR::SQ, VM(1, 1, 1), "OphthalmicAxialLengthMeasurementsTotalLengthSequence" },
+  { 0x00221211, VR::SQ, VM(1, 1, 1), "OphthalmicAxialLengthMeasurementsSegmentalLengthSequence" },
+  { 0x00221212, VR::SQ, VM(1, 1, 1), "OphthalmicAxialLengthMeasurementsLengthSummationSequence" },
+  { 0x00221220, VR::SQ, VM(1, 1, 1), "UltrasoundOphthalmicAxialLengthMeasurementsSequence" },
+  { 0x00221225, VR::SQ, VM(1, 1, 1), "OpticalOphthalmicAxialLengthMeasurementsSequence" },
+  { 0x00221230, VR::SQ, VM(1, 1, 1), "UltrasoundSelectedOphthalmicAxialLengthSequence" },
+  { 0x00221250, VR::SQ, VM(1, 1, 1), "OphthalmicAxialLengthSelectionMethodCodeSequence" },
+  { 0x00221255, VR::SQ, VM(1, 1, 1), "OpticalSelectedOphthalmicAxialLengthSequence" },
+  { 0x00221257, VR::SQ, VM(1, 1, 1), "SelectedSegmentalOphthalmicAxialLengthSequence" },
+  { 0x00221260, VR::SQ, VM(1, 1, 1), "SelectedTotalOphthalmicAxialLengthSequence" },
+  { 0x00221262, VR::SQ, VM(1, 1, 1), "OphthalmicAxialLengthQualityMetricSequence" },
+  { 0x00221300, VR::SQ, VM(1, 1, 1), "IntraocularLensCalculationsRightEyeSequence" },
+  { 0x00221310, VR::SQ, VM(1, 1, 1), "IntraocularLensCalculationsLeftEyeSequence" },
+  { 0x00221330, VR::SQ, VM(1, 1, 1), "ReferencedOphthalmicAxialLengthMeasurementQCImageSequence" },
+  { 0x00221415, VR::CS, VM(1, 1, 1), "OphthalmicMappingDeviceType" },
+  { 0x00221420, VR::SQ, VM(1, 1, 1), "AcquisitionMethodCodeSequence" },
+  { 0x00221423, VR::SQ, VM(1, 1, 1), "AcquisitionMethodAlgorithmSequence" },
+  { 0x00221436, VR::SQ, VM(1, 1, 1), "OphthalmicThicknessMapTypeCodeSequence" },
+  { 0x00221443, VR::SQ, VM(1, 1, 1), "OphthalmicThicknessMappingNormalsSequence" },
+  { 0x00221445, VR::SQ, VM(1, 1, 1), "RetinalThicknessDefinitionCodeSequence" },
+  { 0x00221450, VR::SQ, VM(1, 1, 1), "PixelValueMappingToCodedConceptSequence" },
+  { 0x00221452, VR::US, VM(1, 1, 1), "MappedPixelValue" },
+  { 0x00221454, VR::LO, VM(1, 1, 1), "PixelValueMappingExplanation" },
+  { 0x00221458, VR::SQ, VM(1, 1, 1), "OphthalmicThicknessMapQualityThresholdSequence" },
+  { 0x00221460, VR::FL, VM(1, 1, 1), "OphthalmicThicknessMapThresholdQualityRating" },
+  { 0x00221463, VR::FL, VM(2, 2, 1), "AnatomicStructureReferencePoint" },
+  { 0x00221465, VR::SQ, VM(1, 1, 1), "RegistrationToLocalizerSequence" },
+  { 0x00221466, VR::CS, VM(1, 1, 1), "RegisteredLocalizerUnits" },
+  { 0x00221467, VR::FL, VM(2, 2, 1), "RegisteredLocalizerTopLeftHandCorner" },
+  { 0x00221468, VR::FL, VM(2, 2, 1), "RegisteredLocalizerBottomRightHandCorner" },
+  { 0x00221470, VR::SQ, VM(1, 1, 1), "OphthalmicThicknessMapQualityRatingSequence" },
+  { 0x00221472, VR::SQ, VM(1, 1, 1), "RelevantOPTAttributesSequence" },
+  { 0x00221512, VR::SQ, VM(1, 1, 1), "TransformationMethodCodeSequence" },
+  { 0x00221513, VR::SQ, VM(1, 1, 1), "TransformationAlgorithmSequence" },
+  { 0x00221515, VR::CS, VM(1, 1, 1), "OphthalmicAxialLengthMethod" },
+  { 0x00221517, VR::FL, VM(1, 1, 1), "OphthalmicFOV" },
+  { 0x00221518, VR::SQ, VM(1, 1, 1), "TwoDimensionalToThreeDimensionalMapSequence" },
+  { 0x00221525, VR::SQ, VM(1, 1, 1), "WideFieldOphthalmicPhotographyQualityRatingSequence" },
+  { 0x00221526, VR::SQ, VM(1, 1, 1), "WideFieldOphthalmicPhotographyQualityThresholdSequence" },
+  { 0x00221527, VR::FL, VM(1, 1, 1), "WideFieldOphthalmicPhotographyThresholdQualityRating" },
+  { 0x00221528, VR::FL, VM(1, 1, 1), "XCoordinatesCenterPixelViewAngle" },
+  { 0x00221529, VR::FL, VM(1, 1, 1), "YCoordinatesCenterPixelViewAngle" },
+  { 0x00221530, VR::UL, VM(1, 1, 1), "NumberOfMapPoints" },
+  { 0x00221531, VR::OF, VM(1, 1, 1), "TwoDimensionalToThreeDimensionalMapData" },
+  { 0x00221646, VR::FL, VM(1, VM::N, 1), "BscanCycleTimeVector" },
+  { 0x00240010, VR::FL, VM(1, 1, 1), "VisualFieldHorizontalExtent" },
+  { 0x00240011, VR::FL, VM(1, 1, 1), "VisualFieldVerticalExtent" },
+  { 0x00240012, VR::CS, VM(1, 1, 1), "VisualFieldShape" },
+  { 0x00240016, VR::SQ, VM(1, 1, 1), "ScreeningTestModeCodeSequence" },
+  { 0x00240018, VR::FL, VM(1, 1, 1), "MaximumStimulusLuminance" },
+  { 0x00240020, VR::FL, VM(1, 1, 1), "BackgroundLuminance" },
+  { 0x00240021, VR::SQ, VM(1, 1, 1), "StimulusColorCodeSequence" },
+  { 0x00240024, VR::SQ, VM(1, 1, 1), "BackgroundIlluminationColorCodeSequence" },
+  { 0x00240025, VR::FL, VM(1, 1, 1), "StimulusArea" },
+  { 0x00240028, VR::FL, VM(1, 1, 1), "StimulusPresentationTime" },
+  { 0x00240032, VR::SQ, VM(1, 1, 1), "FixationSequence" },
+  { 0x00240033, VR::SQ, VM(1, 1, 1), "FixationMonitoringCodeSequence" },
+  { 0x00240034, VR::SQ, VM(1, 1, 1), "VisualFieldCatchTrialSequence" },
+  { 0x00240035, VR::US, VM(1, 1, 1), "FixationCheckedQuantity" },
+  { 0x00240036, VR::US, VM(1, 1, 1), "PatientNotProperlyFixatedQuantity" },
+  { 0x00240037, VR::CS, VM(1, 1, 1), "PresentedVisualStimuliDataFlag" },
+  { 0x00240038, VR::US, VM(1, 1, 1), "NumberOfVisualStimuli" },
+  { 0x00240039, VR::CS, VM(1, 1, 1), "ExcessiveFixationLossesDataFlag" },
+  { 0x00240040, VR::CS, VM(1, 1, 1), "ExcessiveFixationLosses" },
+  { 0x00240042, VR::US, VM(1, 1, 1), "StimuliRetestingQuantity" },
+  { 0x00240044, VR::LT, VM(1, 1, 1), "CommentsOnPatientPerformanceOfVisualField" },
+  { 0x00240045, VR::CS, VM(1, 1, 1), "FalseNegativesEstimateFlag" },
+  { 0x00240046, VR::FL, VM(1, 1, 1), "FalseNegativesEstimate" },
+  { 0x00240048, VR::US, VM(1, 1, 1), "NegativeCatchTrialsQuantity" },
+  { 0x00240050, VR::US, VM(1, 1, 1), "FalseNegativesQuantity" },
+  { 0x00240051, VR::CS, VM(1, 1, 1), "ExcessiveFalseNegativesDataFlag" },
+  { 0x00240052, VR::CS, VM(1, 1, 1), "ExcessiveFalseNegatives" },
+  { 0x00240053, VR::CS, VM(1, 1, 1), "FalsePositivesEstimateFlag" },
+  { 0x00240054, VR::FL, VM(1, 1, 1), "FalsePositivesEstimate" },
+  { 0x00240055, VR::CS, VM(1, 1, 1), "CatchTrialsDataFlag" },
+  { 0x00240056, VR::US, VM(1, 1, 1), "PositiveCatchTrialsQuantity" },
+  { 0x00240057, VR::CS, VM(1, 1, 1), "TestPointNormalsDataFlag" },
+  { 0x00240058, VR::SQ, VM(1, 1, 1), "TestPointNormalsSequence" },
+  { 0x00240059, VR::CS, VM(1, 1, 1), "GlobalDeviationProbabilityNormalsFlag" },
+  { 0x00240060, VR::US, VM(1, 1, 1), "FalsePositivesQuantity" },
+  { 0x00240061, VR::CS, VM(1, 1, 1), "ExcessiveFalsePositivesDataFlag" },
+  { 0x00240062, VR::CS, VM(1, 1, 1), "ExcessiveFalsePositives" },
+  { 0x00240063, VR::CS, VM(1, 1, 1), "VisualFieldTestNormalsFlag" },
+  { 0x00240064, VR::SQ, VM(1, 1, 1), "ResultsNormalsSequence" },
+  { 0x00240065, VR::SQ, VM(1, 1, 1), "AgeCorrectedSensitivityDeviationAlgorithmSequence" },
+  { 0x00240066, VR::FL, VM(1, 1, 1), "GlobalDeviationFromNormal" },
+  { 0x00240067, VR::SQ, VM(1, 1, 1), "GeneralizedDefectSensitivityDeviationAlgorithmSequence" },
+  { 0x00240068, VR::FL, VM(1, 1, 1), "LocalizedDeviationFromNormal" },
+  { 0x00240069, VR::LO, VM(1, 1, 1), "PatientReliabilityIndicator" },
+  { 0x00240070, VR::FL, VM(1, 1, 1), "VisualFieldMeanSensitivity" },
+  { 0x00240071, VR::FL, VM(1, 1, 1), "GlobalDeviationProbability" },
+  { 0x00240072, VR::CS, VM(1, 1, 1), "LocalDeviationProbabilityNormalsFlag" },
+  { 0x00240073, VR::FL, VM(1, 1, 1), "LocalizedDeviationProbability" },
+  { 0x00240074, VR::CS, VM(1, 1, 1), "ShortTermFluctuationCalculated" },
+  { 0x00240075, VR::FL, VM(1, 1, 1), "ShortTermFluctuation" },
+  { 0x00240076, VR::CS, VM(1, 1, 1), "ShortTermFluctuationProbabilityCalculated" },
+  { 0x00240077, VR::FL, VM(1, 1, 1), "ShortTermFluctuationProbability" },
+  { 0x00240078, VR::CS, VM(1, 1, 1), "CorrectedLocalizedDeviationFromNormalCalculated" },
+  { 0x00240079, VR::FL, VM(1, 1, 1), "CorrectedLocalizedDeviationFromNormal" },
+  { 0x00240080, VR::CS, VM(1, 1, 1), "CorrectedLocalizedDeviationFromNormalProbabilityCalculated" },
+  { 0x00240081, VR::FL, VM(1, 1, 1), "CorrectedLocalizedDeviationFromNormalProbability" },
+  { 0x00240083, VR::SQ, VM(1, 1, 1), "GlobalDeviationProbabilitySequence" },
+  { 0x00240085, VR::SQ, VM(1, 1, 1), "LocalizedDeviationProbabilitySequence" },
+  { 0x00240086, VR::CS, VM(1, 1, 1), "FovealSensitivityMeasured" },
+  { 0x00240087, VR::FL, VM(1, 1, 1), "FovealSensitivity" },
+  { 0x00240088, VR::FL, VM(1, 1, 1), "VisualFieldTestDuration" },
+  { 0x00240089, VR::SQ, VM(1, 1, 1), "VisualFieldTestPointSequence" },
+  { 0x00240090, VR::FL, VM(1, 1, 1), "VisualFieldTestPointXCoordinate" },
+  { 0x00240091, VR::FL, VM(1, 1, 1), "VisualFieldTestPointYCoordinate" },
+  { 0x00240092, VR::FL, VM(1, 1, 1), "AgeCorrectedSensitivityDeviationValue" },
+  { 0x00240093, VR::CS, VM(1, 1, 1), "StimulusResults" },
+  { 0x00240094, VR::FL, VM(1, 1, 1), "SensitivityValue" },
+  { 0x00240095, VR::CS, VM(1, 1, 1), "RetestStimulusSeen" },
+  { 0x00240096, VR::FL, VM(1, 1, 1), "RetestSensitivityValue" },
+  { 0x00240097, VR::SQ, VM(1, 1, 1), "VisualFieldTestPointNormalsSequence" },
+  { 0x00240098, VR::FL, VM(1, 1, 1), "QuantifiedDefect" },
+  { 0x00240100, VR::FL, VM(1, 1, 1), "AgeCorrectedSensitivityDeviationProbabilityValue" },
+  { 0x00240102, VR::CS, VM(1, 1, 1), "GeneralizedDefectCorrectedSensitivityDeviationFlag" },
+  { 0x00240103, VR::FL, VM(1, 1, 1), "GeneralizedDefectCorrectedSensitivityDeviationValue" },
+  { 0x00240104, VR::FL, VM(1, 1, 1), "GeneralizedDefectCorrectedSensitivityDeviationProbabilityValue" },
+  { 0x00240105, VR::FL, VM(1, 1, 1), "MinimumSensitivityValue" },
+  { 0x00240106, VR::CS, VM(1, 1, 1), "BlindSpotLocalized" },
+  { 0x00240107, VR::FL, VM(1, 1, 1), "BlindSpotXCoordinate" },
+  { 0x00240108, VR::FL, VM(1, 1, 1), "BlindSpotYCoordinate" },
+  { 0x00240110, VR::SQ, VM(1, 1, 1), "VisualAcuityMeasurementSequence" },
+  { 0x00240112, VR::SQ, VM(1, 1, 1), "RefractiveParametersUsedOnPatientSequence" },
+  { 0x00240113, VR::CS, VM(1, 1, 1), "MeasurementLaterality" },
+  { 0x00240114, VR::SQ, VM(1, 1, 1), "OphthalmicPatientClinicalInformationLeftEyeSequence" },
+  { 0x00240115, VR::SQ, VM(1, 1, 1), "OphthalmicPatientClinicalInformationRightEyeSequence" },
+  { 0x00240117, VR::CS, VM(1, 1, 1), "FovealPointNormativeDataFlag" },
+  { 0x00240118, VR::FL, VM(1, 1, 1), "FovealPointProbabilityValue" },
+  { 0x00240120, VR::CS, VM(1, 1, 1), "ScreeningBaselineMeasured" },
+  { 0x00240122, VR::SQ, VM(1, 1, 1), "ScreeningBaselineMeasuredSequence" },
+  { 0x00240124, VR::CS, VM(1, 1, 1), "ScreeningBaselineType" },
+  { 0x00240126, VR::FL, VM(1, 1, 1), "ScreeningBaselineValue" },
+  { 0x00240202, VR::LO, VM(1, 1, 1), "AlgorithmSource" },
+  { 0x00240306, VR::LO, VM(1, 1, 1), "DataSetName" },
+  { 0x00240307, VR::LO, VM(1, 1, 1), "DataSetVersion" },
+  { 0x00240308, VR::LO, VM(1, 1, 1), "DataSetSource" },
+  { 0x00240309, VR::LO, VM(1, 1, 1), "DataSetDescription" },
+  { 0x00240317, VR::SQ, VM(1, 1, 1), "VisualFieldTestReliabilityGlobalIndexSequence" },
+  { 0x00240320, VR::SQ, VM(1, 1, 1), "VisualFieldGlobalResultsIndexSequence" },
+  { 0x00240325, VR::SQ, VM(1, 1, 1), "DataObservationSequence" },
+  { 0x00240338, VR::CS, VM(1, 1, 1), "IndexNormalsFlag" },
+  { 0x00240341, VR::FL, VM(1, 1, 1), "IndexProbability" },
+  { 0x00240344, VR::SQ, VM(1, 1, 1), "IndexProbabilitySequence" },
+  { 0x00280002, VR::US, VM(1, 1, 1), "SamplesPerPixel" },
+  { 0x00280003, VR::US, VM(1, 1, 1), "SamplesPerPixelUsed" },
+  { 0x00280004, VR::CS, VM(1, 1, 1), "PhotometricInterpretation" },
+  { 0x00280006, VR::US, VM(1, 1, 1), "PlanarConfiguration" },
+  { 0x00280008, VR::IS, VM(1, 1, 1), "NumberOfFrames" },
+  { 0x00280009, VR::AT, VM(1, VM::N, 1), "FrameIncrementPointer" },
+  { 0x0028000A, VR::AT, VM(1, VM::N, 1), "FrameDimensionPointer" },
+  { 0x00280010, VR::US, VM(1, 1, 1), "Rows" },
+  { 0x00280011, VR::US, VM(1, 1, 1), "Columns" },
+  { 0x00280014, VR::US, VM(1, 1, 1), "UltrasoundColorDataPresent" },
+  { 0x00280030, VR::DS, VM(2, 2, 1), "PixelSpacing" },
+  { 0x00280031, VR::DS, VM(2, 2, 1), "ZoomFactor" },
+  { 0x00280032, VR::DS, VM(2, 2, 1), "ZoomCenter" },
+  { 0x00280034, VR::IS, VM(2, 2, 1), "PixelAspectRatio" },
+  { 0x00280051, VR::CS, VM(1, VM::N, 1), "CorrectedImage" },
+  { 0x00280100, VR::US, VM(1, 1, 1), "BitsAllocated" },
+  { 0x00280101, VR::US, VM(1, 1, 1), "BitsStored" },
+  { 0x00280102, VR::US, VM(1, 1, 1), "HighBit" },
+  { 0x00280103, VR::US, VM(1, 1, 1), "PixelRepresentation" },
+  { 0x00280106, VR::US, VM(1, 1, 1), "SmallestImagePixelValue" },
+  { 0x00280107, VR::US, VM(1, 1, 1), "LargestImagePixelValue" },
+  { 0x00280108, VR::US, VM(1, 1, 1), "SmallestPixelValueInSeries" },
+  { 0x00280109, VR::US, VM(1, 1, 1), "LargestPixelValueInSeries" },
+  { 0x00280120, VR::US, VM(1, 1, 1), "PixelPaddingValue" },
+  { 0x00280121, VR::US, VM(1, 1, 1), "PixelPaddingRangeLimit" },
+  { 0x00280122, VR::FL, VM(1, 1, 1), "FloatPixelPaddingValue" },
+  { 0x00280123, VR::FD, VM(1, 1, 1), "DoubleFloatPixelPaddingValue" },
+  { 0x00280124, VR::FL, VM(1, 1, 1), "FloatPixelPaddingRangeLimit" },
+  { 0x00280125, VR::FD, VM(1, 1, 1), "DoubleFloatPixelPaddingRangeLimit" },
+  { 0x00280300, VR::CS, VM(1, 1, 1), "QualityControlImage" },
+  { 0x00280301, VR::CS, VM(1, 1, 1), "BurnedInAnnotation" },
+  { 0x00280302, VR::CS, VM(1, 1, 1), "RecognizableVisualFeatures" },
+  { 0x00280303, VR::CS, VM(1, 1, 1), "LongitudinalTemporalInformationModified" },
+  { 0x00280304, VR::UI, VM(1, 1, 1), "ReferencedColorPaletteInstanceUID" },
+  { 0x00280A02, VR::CS, VM(1, 1, 1), "PixelSpacingCalibrationType" },
+  { 0x00280A04, VR::LO, VM(1, 1, 1), "PixelSpacingCalibrationDescription" },
+  { 0x00281040, VR::CS, VM(1, 1, 1), "PixelIntensityRelationship" },
+  { 0x00281041, VR::SS, VM(1, 1, 1), "PixelIntensityRelationshipSign" },
+  { 0x00281050, VR::DS, VM(1, VM::N, 1), "WindowCenter" },
+  { 0x00281051, VR::DS, VM(1, VM::N, 1), "WindowWidth" },
+  { 0x00281052, VR::DS, VM(1, 1, 1), "RescaleIntercept" },
+  { 0x00281053, VR::DS, VM(1, 1, 1), "RescaleSlope" },
+  { 0x00281054, VR::LO, VM(1, 1, 1), "RescaleType" },
+  { 0x00281055, VR::LO, VM(1, VM::N, 1), "WindowCenterWidthExplanation" },
+  { 0x00281056, VR::CS, VM(1, 1, 1), "VOILUTFunction" },
+  { 0x00281090, VR::CS, VM(1, 1, 1), "RecommendedViewingMode" },
+  { 0x00281101, VR::US, VM(3, 3, 1), "RedPaletteColorLookupTableDescriptor" },
+  { 0x00281102, VR::US, VM(3, 3, 1), "GreenPaletteColorLookupTableDescriptor" },
+  { 0x00281103, VR::US, VM(3, 3, 1), "BluePaletteColorLookupTableDescriptor" },
+  { 0x00281104, VR::US, VM(3, 3, 1), "AlphaPaletteColorLookupTableDescriptor" },
+  { 0x00281199, VR::UI, VM(1, 1, 1), "PaletteColorLookupTableUID" },
+  { 0x00281201, VR::OW, VM(1, 1, 1), "RedPaletteColorLookupTableData" },
+  { 0x00281202, VR::OW, VM(1, 1, 1), "GreenPaletteColorLookupTableData" },
+  { 0x00281203, VR::OW, VM(1, 1, 1), "BluePaletteColorLookupTableData" },
+  { 0x00281204, VR::OW, VM(1, 1, 1), "AlphaPaletteColorLookupTableData" },
+  { 0x00281221, VR::OW, VM(1, 1, 1), "SegmentedRedPaletteColorLookupTableData" },
+  { 0x00281222, VR::OW, VM(1, 1, 1), "SegmentedGreenPaletteColorLookupTableData" },
+  { 0x00281223, VR::OW, VM(1, 1, 1), "SegmentedBluePaletteColorLookupTableData" },
+  { 0x00281224, VR::OW, VM(1, 1, 1), "SegmentedAlphaPaletteColorLookupTableData" },
+  { 0x00281300, VR::CS, VM(1, 1, 1), "BreastImplantPresent" },
+  { 0x00281350, VR::CS, VM(1, 1, 1), "PartialView" },
+  { 0x00281351, VR::ST, VM(1, 1, 1), "PartialViewDescription" },
+  { 0x00281352, VR::SQ, VM(1, 1, 1), "PartialViewCodeSequence" },
+  { 0x0028135A, VR::CS, VM(1, 1, 1), "SpatialLocationsPreserved" },
+  { 0x00281401, VR::SQ, VM(1, 1, 1), "DataFrameAssignmentSequence" },
+  { 0x00281402, VR::CS, VM(1, 1, 1), "DataPathAssignment" },
+  { 0x00281403, VR::US, VM(1, 1, 1), "BitsMappedToColorLookupTable" },
+  { 0x00281404, VR::SQ, VM(1, 1, 1), "BlendingLUT1Sequence" },
+  { 0x00281405, VR::CS, VM(1, 1, 1), "BlendingLUT1TransferFunction" },
+  { 0x00281406, VR::FD, VM(1, 1, 1), "BlendingWeightConstant" },
+  { 0x00281407, VR::US, VM(3, 3, 1), "BlendingLookupTableDescriptor" },
+  { 0x00281408, VR::OW, VM(1, 1, 1), "BlendingLookupTableData" },
+  { 0x0028140B, VR::SQ, VM(1, 1, 1), "EnhancedPaletteColorLookupTableSequence" },
+  { 0x0028140C, VR::SQ, VM(1, 1, 1), "BlendingLUT2Sequence" },
+  { 0x0028140D, VR::CS, VM(1, 1, 1), "BlendingLUT2TransferFunction" },
+  { 0x0028140E, VR::CS, VM(1, 1, 1), "DataPathID" },
+  { 0x0028140F, VR::CS, VM(1, 1, 1), "RGBLUTTransferFunction" },
+  { 0x00281410, VR::CS, VM(1, 1, 1), "AlphaLUTTransferFunction" },
+  { 0x00282000, VR::OB, VM(1, 1, 1), "ICCProfile" },
+  { 0x00282002, VR::CS, VM(1, 1, 1), "ColorSpace" },
+  { 0x00282110, VR::CS, VM(1, 1, 1), "LossyImageCompression" },
+  { 0x00282112, VR::DS, VM(1, VM::N, 1), "LossyImageCompressionRatio" },
+  { 0x00282114, VR::CS, VM(1, VM::N, 1), "LossyImageCompressionMethod" },
+  { 0x00283000, VR::SQ, VM(1, 1, 1), "ModalityLUTSequence" },
+  { 0x00283002, VR::US, VM(3, 3, 1), "LUTDescriptor" },
+  { 0x00283003, VR::LO, VM(1, 1, 1), "LUTExplanation" },
+  { 0x00283004, VR::LO, VM(1, 1, 1), "ModalityLUTType" },
+  { 0x00283006, VR::US, VM(1, VM::N, 1), "LUTData" },
+  { 0x00283010, VR::SQ, VM(1, 1, 1), "VOILUTSequence" },
+  { 0x00283110, VR::SQ, VM(1, 1, 1), "SoftcopyVOILUTSequence" },
+  { 0x00286010, VR::US, VM(1, 1, 1), "RepresentativeFrameNumber" },
+  { 0x00286020, VR::US, VM(1, VM::N, 1), "FrameNumbersOfInterest" },
+  { 0x00286022, VR::LO, VM(1, VM::N, 1), "FrameOfInterestDescription" },
+  { 0x00286023, VR::CS, VM(1, VM::N, 1), "FrameOfInterestType" },
+  { 0x00286040, VR::US, VM(1, VM::N, 1), "RWavePointer" },
+  { 0x00286100, VR::SQ, VM(1, 1, 1), "MaskSubtractionSequence" },
+  { 0x00286101, VR::CS, VM(1, 1, 1), "MaskOperation" },
+  { 0x00286102, VR::US, VM(1, VM::N, 2), "ApplicableFrameRange" },
+  { 0x00286110, VR::US, VM(1, VM::N, 1), "MaskFrameNumbers" },
+  { 0x00286112, VR::US, VM(1, 1, 1), "ContrastFrameAveraging" },
+  { 0x00286114, VR::FL, VM(2, 2, 1), "MaskSubPixelShift" },
+  { 0x00286120, VR::SS, VM(1, 1, 1), "TIDOffset" },
+  { 0x00286190, VR::ST, VM(1, 1, 1), "MaskOperationExplanation" },
+  { 0x00287000, VR::SQ, VM(1, 1, 1), "EquipmentAdministratorSequence" },
+  { 0x00287001, VR::US, VM(1, 1, 1), "NumberOfDisplaySubsystems" },
+  { 0x00287002, VR::US, VM(1, 1, 1), "CurrentConfigurationID" },
+  { 0x00287003, VR::US, VM(1, 1, 1), "DisplaySubsystemID" },
+  { 0x00287004, VR::SH, VM(1, 1, 1), "DisplaySubsystemName" },
+  { 0x00287005, VR::LO, VM(1, 1, 1), "DisplaySubsystemDescription" },
+  { 0x00287006, VR::CS, VM(1, 1, 1), "SystemStatus" },
+  { 0x00287007, VR::LO, VM(1, 1, 1), "SystemStatusComment" },
+  { 0x00287008, VR::SQ, VM(1, 1, 1), "TargetLuminanceCharacteristicsSequence" },
+  { 0x00287009, VR::US, VM(1, 1, 1), "LuminanceCharacteristicsID" },
+  { 0x0028700A, VR::SQ, VM(1, 1, 1), "DisplaySubsystemConfigurationSequence" },
+  { 0x0028700B, VR::US, VM(1, 1, 1), "ConfigurationID" },
+  { 0x0028700C, VR::SH, VM(1, 1, 1), "ConfigurationName" },
+  { 0x0028700D, VR::LO, VM(1, 1, 1), "ConfigurationDescription" },
+  { 0x0028700E, VR::US, VM(1, 1, 1), "ReferencedTargetLuminanceCharacteristicsID" },
+  { 0x0028700F, VR::SQ, VM(1, 1, 1), "QAResultsSequence" },
+  { 0x00287010, VR::SQ, VM(1, 1, 1), "DisplaySubsystemQAResultsSequence" },
+  { 0x00287011, VR::SQ, VM(1, 1, 1), "ConfigurationQAResultsSequence" },
+  { 0x00287012, VR::SQ, VM(1, 1, 1), "MeasurementEquipmentSequence" },
+  { 0x00287013, VR::CS, VM(1, VM::N, 1), "MeasurementFunctions" },
+  { 0x00287014, VR::CS, VM(1, 1, 1), "MeasurementEquipmentType" },
+  { 0x00287015, VR::SQ, VM(1, 1, 1), "VisualEvaluationResultSequence" },
+  { 0x00287016, VR::SQ, VM(1, 1, 1), "DisplayCalibrationResultSequence" },
+  { 0x00287017, VR::US, VM(1, 1, 1), "DDLValue" },
+  { 0x00287018, VR::FL, VM(2, 2, 1), "CIExyWhitePoint" },
+  { 0x00287019, VR::CS, VM(1, 1, 1), "DisplayFunctionType" },
+  { 0x0028701A, VR::FL, VM(1, 1, 1), "GammaValue" },
+  { 0x0028701B, VR::US, VM(1, 1, 1), "NumberOfLuminancePoints" },
+  { 0x0028701C, VR::SQ, VM(1, 1, 1), "LuminanceResponseSequence" },
+  { 0x0028701D, VR::FL, VM(1, 1, 1), "TargetMinimumLuminance" },
+  { 0x0028701E, VR::FL, VM(1, 1, 1), "TargetMaximumLuminance" },
+  { 0x0028701F, VR::FL, VM(1, 1, 1), "LuminanceValue" },
+  { 0x00287020, VR::LO, VM(1, 1, 1), "LuminanceResponseDescription" },
+  { 0x00287021, VR::CS, VM(1, 1, 1), "WhitePointFlag" },
+  { 0x00287022, VR::SQ, VM(1, 1, 1), "DisplayDeviceTypeCodeSequence" },
+  { 0x00287023, VR::SQ, VM(1, 1, 1), "DisplaySubsystemSequence" },
+  { 0x00287024, VR::SQ, VM(1, 1, 1), "LuminanceResultSequence" },
+  { 0x00287025, VR::CS, VM(1, 1, 1), "AmbientLightValueSource" },
+  { 0x00287026, VR::CS, VM(1, VM::N, 1), "MeasuredCharacteristics" },
+  { 0x00287027, VR::SQ, VM(1, 1, 1), "LuminanceUniformityResultSequence" },
+  { 0x00287028, VR::SQ, VM(1, 1, 1), "VisualEvaluationTestSequence" },
+  { 0x00287029, VR::CS, VM(1, 1, 1), "TestResult" },
+  { 0x0028702A, VR::LO, VM(1, 1, 1), "TestResultComment" },
+  { 0x0028702B, VR::CS, VM(1, 1, 1), "TestImageValidation" },
+  { 0x0028702C, VR::SQ, VM(1, 1, 1), "TestPatternCodeSequence" },
+  { 0x0028702D, VR::SQ, VM(1, 1, 1), "MeasurementPatternCodeSequence" },
+  { 0x0028702E, VR::SQ, VM(1, 1, 1), "VisualEvaluationMethodCodeSequence" },
+  { 0x00287FE0, VR::UR, VM(1, 1, 1), "PixelDataProviderURL" },
+  { 0x00289001, VR::UL, VM(1, 1, 1), "DataPointRows" },
+  { 0x00289002, VR::UL, VM(1, 1, 1), "DataPointColumns" },
+  { 0x00289003, VR::CS, VM(1, 1, 1), "SignalDomainColumns" },
+  { 0x00289108, VR::CS, VM(1, 1, 1), "DataRepresentation" },
+  { 0x00289110, VR::SQ, VM(1, 1, 1), "PixelMeasuresSequence" },
+  { 0x00289132, VR::SQ, VM(1, 1, 1), "FrameVOILUTSequence" },
+  { 0x00289145, VR::SQ, VM(1, 1, 1), "PixelValueTransformationSequence" },
+  { 0x00289235, VR::CS, VM(1, 1, 1), "SignalDomainRows" },
+  { 0x00289411, VR::FL, VM(1, 1, 1), "DisplayFilterPercentage" },
+  { 0x00289415, VR::SQ, VM(1, 1, 1), "FramePixelShiftSequence" },
+  { 0x00289416, VR::US, VM(1, 1, 1), "SubtractionItemID" },
+  { 0x00289422, VR::SQ, VM(1, 1, 1), "PixelIntensityRelationshipLUTSequence" },
+  { 0x00289443, VR::SQ, VM(1, 1, 1), "FramePixelDataPropertiesSequence" },
+  { 0x00289444, VR::CS, VM(1, 1, 1), "GeometricalProperties" },
+  { 0x00289445, VR::FL, VM(1, 1, 1), "GeometricMaximumDistortion" },
+  { 0x00289446, VR::CS, VM(1, VM::N, 1), "ImageProcessingApplied" },
+  { 0x00289454, VR::CS, VM(1, 1, 1), "MaskSelectionMode" },
+  { 0x00289474, VR::CS, VM(1, 1, 1), "LUTFunction" },
+  { 0x00289478, VR::FL, VM(1, 1, 1), "MaskVisibilityPercentage" },
+  { 0x00289501, VR::SQ, VM(1, 1, 1), "PixelShiftSequence" },
+  { 0x00289502, VR::SQ, VM(1, 1, 1), "RegionPixelShiftSequence" },
+  { 0x00289503, VR::SS, VM(1, VM::N, 2), "VerticesOfTheRegion" },
+  { 0x00289505, VR::SQ, VM(1, 1, 1), "MultiFramePresentationSequence" },
+  { 0x00289506, VR::US, VM(1, VM::N, 2), "PixelShiftFrameRange" },
+  { 0x00289507, VR::US, VM(1, VM::N, 2), "LUTFrameRange" },
+  { 0x00289520, VR::DS, VM(16, 16, 1), "ImageToEquipmentMappingMatrix" },
+  { 0x00289537, VR::CS, VM(1, 1, 1), "EquipmentCoordinateSystemIdentification" },
+  { 0x00321031, VR::SQ, VM(1, 1, 1), "RequestingPhysicianIdentificationSequence" },
+  { 0x00321032, VR::PN, VM(1, 1, 1), "RequestingPhysician" },
+  { 0x00321033, VR::LO, VM(1, 1, 1), "RequestingService" },
+  { 0x00321034, VR::SQ, VM(1, 1, 1), "RequestingServiceCodeSequence" },
+  { 0x00321060, VR::LO, VM(1, 1, 1), "RequestedProcedureDescription" },
+  { 0x00321064, VR::SQ, VM(1, 1, 1), "RequestedProcedureCodeSequence" },
+  { 0x00321070, VR::LO, VM(1, 1, 1), "RequestedContrastAgent" },
+  { 0x00380004, VR::SQ, VM(1, 1, 1), "ReferencedPatientAliasSequence" },
+  { 0x00380008, VR::CS, VM(1, 1, 1), "VisitStatusID" },
+  { 0x00380010, VR::LO, VM(1, 1, 1), "AdmissionID" },
+  { 0x00380014, VR::SQ, VM(1, 1, 1), "IssuerOfAdmissionIDSequence" },
+  { 0x00380016, VR::LO, VM(1, 1, 1), "RouteOfAdmissions" },
+  { 0x00380020, VR::DA, VM(1, 1, 1), "AdmittingDate" },
+  { 0x00380021, VR::TM, VM(1, 1, 1), "AdmittingTime" },
+  { 0x00380050, VR::LO, VM(1, 1, 1), "SpecialNeeds" },
+  { 0x00380060, VR::LO, VM(1, 1, 1), "ServiceEpisodeID" },
+  { 0x00380062, VR::LO, VM(1, 1, 1), "ServiceEpisodeDescription" },
+  { 0x00380064, VR::SQ, VM(1, 1, 1), "IssuerOfServiceEpisodeIDSequence" },
+  { 0x00380100, VR::SQ, VM(1, 1, 1), "PertinentDocumentsSequence" },
+  { 0x00380101, VR::SQ, VM(1, 1, 1), "PertinentResourcesSequence" },
+  { 0x00380102, VR::LO, VM(1, 1, 1), "ResourceDescription" },
+  { 0x00380300, VR::LO, VM(1, 1, 1), "CurrentPatientLocation" },
+  { 0x00380400, VR::LO, VM(1, 1, 1), "PatientInstitutionResidence" },
+  { 0x00380500, VR::LO, VM(1, 1, 1), "PatientState" },
+  { 0x00380502, VR::SQ, VM(1, 1, 1), "PatientClinicalTrialParticipationSequence" },
+  { 0x00384000, VR::LT, VM(1, 1, 1), "VisitComments" },
+  { 0x003A0004, VR::CS, VM(1, 1, 1), "WaveformOriginality" },
+  { 0x003A0005, VR::US, VM(1, 1, 1), "NumberOfWaveformChannels" },
+  { 0x003A0010, VR::UL, VM(1, 1, 1), "NumberOfWaveformSamples" },
+  { 0x003A001A, VR::DS, VM(1, 1, 1), "SamplingFrequency" },
+  { 0x003A0020, VR::SH, VM(1, 1, 1), "MultiplexGroupLabel" },
+  { 0x003A0200, VR::SQ, VM(1, 1, 1), "ChannelDefinitionSequence" },
+  { 0x003A0202, VR::IS, VM(1, 1, 1), "WaveformChannelNumber" },
+  { 0x003A0203, VR::SH, VM(1, 1, 1), "ChannelLabel" },
+  { 0x003A0205, VR::CS, VM(1, VM::N, 1), "ChannelStatus" },
+  { 0x003A0208, VR::SQ, VM(1, 1, 1), "ChannelSourceSequence" },
+  { 0x003A0209, VR::SQ, VM(1, 1, 1), "ChannelSourceModifiersSequence" },
+  { 0x003A020A, VR::SQ, VM(1, 1, 1), "SourceWaveformSequence" },
+  { 0x003A020C, VR::LO, VM(1, 1, 1), "ChannelDerivationDescription" },
+  { 0x003A0210, VR::DS, VM(1, 1, 1), "ChannelSensitivity" },
+  { 0x003A0211, VR::SQ, VM(1, 1, 1), "ChannelSensitivityUnitsSequence" },
+  { 0x003A0212, VR::DS, VM(1, 1, 1), "ChannelSensitivityCorrectionFactor" },
+  { 0x003A0213, VR::DS, VM(1, 1, 1), "ChannelBaseline" },
+  { 0x003A0214, VR::DS, VM(1, 1, 1), "ChannelTimeSkew" },
+  { 0x003A0215, VR::DS, VM(1, 1, 1), "ChannelSampleSkew" },
+  { 0x003A0218, VR::DS, VM(1, 1, 1), "ChannelOffset" },
+  { 0x003A021A, VR::US, VM(1, 1, 1), "WaveformBitsStored" },
+  { 0x003A0220, VR::DS, VM(1, 1, 1), "FilterLowFrequency" },
+  { 0x003A0221, VR::DS, VM(1, 1, 1), "FilterHighFrequency" },
+  { 0x003A0222, VR::DS, VM(1, 1, 1), "NotchFilterFrequency" },
+  { 0x003A0223, VR::DS, VM(1, 1, 1), "NotchFilterBandwidth" },
+  { 0x003A0230, VR::FL, VM(1, 1, 1), "WaveformDataDisplayScale" },
+  { 0x003A0231, VR::US, VM(3, 3, 1), "WaveformDisplayBackgroundCIELabValue" },
+  { 0x003A0240, VR::SQ, VM(1, 1, 1), "WaveformPresentationGroupSequence" },
+  { 0x003A0241, VR::US, VM(1, 1, 1), "PresentationGroupNumber" },
+  { 0x003A0242, VR::SQ, VM(1, 1, 1), "ChannelDisplaySequence" },
+  { 0x003A0244, VR::US, VM(3, 3, 1), "ChannelRecommendedDisplayCIELabValue" },
+  { 0x003A0245, VR::FL, VM(1, 1, 1), "ChannelPosition" },
+  { 0x003A0246, VR::CS, VM(1, 1, 1), "DisplayShadingFlag" },
+  { 0x003A0247, VR::FL, VM(1, 1, 1), "FractionalChannelDisplayScale" },
+  { 0x003A0248, VR::FL, VM(1, 1, 1), "AbsoluteChannelDisplayScale" },
+  { 0x003A0300, VR::SQ, VM(1, 1, 1), "MultiplexedAudioChannelsDescriptionCodeSequence" },
+  { 0x003A0301, VR::IS, VM(1, 1, 1), "ChannelIdentificationCode" },
+  { 0x003A0302, VR::CS, VM(1, 1, 1), "ChannelMode" },
+  { 0x00400001, VR::AE, VM(1, VM::N, 1), "ScheduledStationAETitle" },
+  { 0x00400002, VR::DA, VM(1, 1, 1), "ScheduledProcedureStepStartDate" },
+  { 0x00400003, VR::TM, VM(1, 1, 1), "ScheduledProcedureStepStartTime" },
+  { 0x00400004, VR::DA, VM(1, 1, 1), "ScheduledProcedureStepEndDate" },
+  { 0x00400005, VR::TM, VM(1, 1, 1), "ScheduledProcedureStepEndTime" },
+  { 0x00400006, VR::PN, VM(1, 1, 1), "ScheduledPerformingPhysicianName" },
+  { 0x00400007, VR::LO, VM(1, 1, 1), "ScheduledProcedureStepDescription" },
+  { 0x00400008, VR::SQ, VM(1, 1, 1), "ScheduledProtocolCodeSequence" },
+  { 0x00400009, VR::SH, VM(1, 1, 1), "ScheduledProcedureStepID" },
+  { 0x0040000A, VR::SQ, VM(1, 1, 1), "StageCodeSequence" },
+  { 0x0040000B, VR::SQ, VM(1, 1, 1), "ScheduledPerformingPhysicianIdentificationSequence" },
+  { 0x00400010, VR::SH, VM(1, VM::N, 1), "ScheduledStationName" },
+  { 0x00400011, VR::SH, VM(1, 1, 1), "ScheduledProcedureStepLocation" },
+  { 0x00400012, VR::LO, VM(1, 1, 1), "PreMedication" },
+  { 0x00400020, VR::CS, VM(1, 1, 1), "ScheduledProcedureStepStatus" },
+  { 0x00400026, VR::SQ, VM(1, 1, 1), "OrderPlacerIdentifierSequence" },
+  { 0x00400027, VR::SQ, VM(1, 1, 1), "OrderFillerIdentifierSequence" },
+  { 0x00400031, VR::UT, VM(1, 1, 1), "LocalNamespaceEntityID" },
+  { 0x00400032, VR::UT, VM(1, 1, 1), "UniversalEntityID" },
+  { 0x00400033, VR::CS, VM(1, 1, 1), "UniversalEntityIDType" },
+  { 0x00400035, VR::CS, VM(1, 1, 1), "IdentifierTypeCode" },
+  { 0x00400036, VR::SQ, VM(1, 1, 1), "AssigningFacilitySequence" },
+  { 0x00400039, VR::SQ, VM(1, 1, 1), "AssigningJurisdictionCodeSequence" },
+  { 0x0040003A, VR::SQ, VM(1, 1, 1), "AssigningAgencyOrDepartmentCodeSequence" },
+  { 0x00400100, VR::SQ, VM(1, 1, 1), "ScheduledProcedureStepSequence" },
+  { 0x00400220, VR::SQ, VM(1, 1, 1), "ReferencedNonImageCompositeSOPInstanceSequence" },
+  { 0x00400241, VR::AE, VM(1, 1, 1), "PerformedStationAETitle" },
+  { 0x00400242, VR::SH, VM(1, 1, 1), "PerformedStationName" },
+  { 0x00400243, VR::SH, VM(1, 1, 1), "PerformedLocation" },
+  { 0x00400244, VR::DA, VM(1, 1, 1), "PerformedProcedureStepStartDate" },
+  { 0x00400245, VR::TM, VM(1, 1, 1), "PerformedProcedureStepStartTime" },
+  { 0x00400250, VR::DA, VM(1, 1, 1), "PerformedProcedureStepEndDate" },
+  { 0x00400251, VR::TM, VM(1, 1, 1), "PerformedProcedureStepEndTime" },
+  { 0x00400252, VR::CS, VM(1, 1, 1), "PerformedProcedureStepStatus" },
+  { 0x00400253, VR::SH, VM(1, 1, 1), "PerformedProcedureStepID" },
+  { 0x00400254, VR::LO, VM(1, 1, 1), "PerformedProcedureStepDescription" },
+  { 0x00400255, VR::LO, VM(1, 1, 1), "PerformedProcedureTypeDescription" },
+  { 0x00400260, VR::SQ, VM(1, 1, 1), "PerformedProtocolCodeSequence" },
+  { 0x00400261, VR::CS, VM(1, 1, 1), "PerformedProtocolType" },
+  { 0x00400270, VR::SQ, VM(1, 1, 1), "ScheduledStepAttributesSequence" },
+  { 0x00400275, VR::SQ, VM(1, 1, 1), "RequestAttributesSequence" },
+  { 0x00400280, VR::ST, VM(1, 1, 1), "CommentsOnThePerformedProcedureStep" },
+  { 0x00400281, VR::SQ, VM(1, 1, 1), "PerformedProcedureStepDiscontinuationReasonCodeSequence" },
+  { 0x00400293, VR::SQ, VM(1, 1, 1), "QuantitySequence" },
+  { 0x00400294, VR::DS, VM(1, 1, 1), "Quantity" },
+  { 0x00400295, VR::SQ, VM(1, 1, 1), "MeasuringUnitsSequence" },
+  { 0x00400296, VR::SQ, VM(1, 1, 1), "BillingItemSequence" },
+  { 0x00400300, VR::US, VM(1, 1, 1), "TotalTimeOfFluoroscopy" },
+  { 0x00400301, VR::US, VM(1, 1, 1), "TotalNumberOfExposures" },
+  { 0x00400302, VR::US, VM(1, 1, 1), "EntranceDose" },
+  { 0x00400303, VR::US, VM(1, 2, 1), "ExposedArea" },
+  { 0x00400306, VR::DS, VM(1, 1, 1), "DistanceSourceToEntrance" },
+  { 0x0040030E, VR::SQ, VM(1, 1, 1), "ExposureDoseSequence" },
+  { 0x00400310, VR::ST, VM(1, 1, 1), "CommentsOnRadiationDose" },
+  { 0x00400312, VR::DS, VM(1, 1, 1), "XRayOutput" },
+  { 0x00400314, VR::DS, VM(1, 1, 1), "HalfValueLayer" },
+  { 0x00400316, VR::DS, VM(1, 1, 1), "OrganDose" },
+  { 0x00400318, VR::CS, VM(1, 1, 1), "OrganExposed" },
+  { 0x00400320, VR::SQ, VM(1, 1, 1), "BillingProcedureStepSequence" },
+  { 0x00400321, VR::SQ, VM(1, 1, 1), "FilmConsumptionSequence" },
+  { 0x00400324, VR::SQ, VM(1, 1, 1), "BillingSuppliesAndDevicesSequence" },
+  { 0x00400340, VR::SQ, VM(1, 1, 1), "PerformedSeriesSequence" },
+  { 0x00400400, VR::LT, VM(1, 1, 1), "CommentsOnTheScheduledProcedureStep" },
+  { 0x00400440, VR::SQ, VM(1, 1, 1), "ProtocolContextSequence" },
+  { 0x00400441, VR::SQ, VM(1, 1, 1), "ContentItemModifierSequence" },
+  { 0x00400500, VR::SQ, VM(1, 1, 1), "ScheduledSpecimenSequence" },
+  { 0x00400512, VR::LO, VM(1, 1, 1), "ContainerIdentifier" },
+  { 0x00400513, VR::SQ, VM(1, 1, 1), "IssuerOfTheContainerIdentifierSequence" },
+  { 0x00400515, VR::SQ, VM(1, 1, 1), "AlternateContainerIdentifierSequence" },
+  { 0x00400518, VR::SQ, VM(1, 1, 1), "ContainerTypeCodeSequence" },
+  { 0x0040051A, VR::LO, VM(1, 1, 1), "ContainerDescription" },
+  { 0x00400520, VR::SQ, VM(1, 1, 1), "ContainerComponentSequence" },
+  { 0x00400551, VR::LO, VM(1, 1, 1), "SpecimenIdentifier" },
+  { 0x00400554, VR::UI, VM(1, 1, 1), "SpecimenUID" },
+  { 0x00400555, VR::SQ, VM(1, 1, 1), "AcquisitionContextSequence" },
+  { 0x00400556, VR::ST, VM(1, 1, 1), "AcquisitionContextDescription" },
+  { 0x00400560, VR::SQ, VM(1, 1, 1), "SpecimenDescriptionSequence" },
+  { 0x00400562, VR::SQ, VM(1, 1, 1), "IssuerOfTheSpecimenIdentifierSequence" },
+  { 0x0040059A, VR::SQ, VM(1, 1, 1), "SpecimenTypeCodeSequence" },
+  { 0x00400600, VR::LO, VM(1, 1, 1), "SpecimenShortDescription" },
+  { 0x00400602, VR::UT, VM(1, 1, 1), "SpecimenDetailedDescription" },
+  { 0x00400610, VR::SQ, VM(1, 1, 1), "SpecimenPreparationSequence" },
+  { 0x00400612, VR::SQ, VM(1, 1, 1), "SpecimenPreparationStepContentItemSequence" },
+  { 0x00400620, VR::SQ, VM(1, 1, 1), "SpecimenLocalizationContentItemSequence" },
+  { 0x0040071A, VR::SQ, VM(1, 1, 1), "ImageCenterPointCoordinatesSequence" },
+  { 0x0040072A, VR::DS, VM(1, 1, 1), "XOffsetInSlideCoordinateSystem" },
+  { 0x0040073A, VR::DS, VM(1, 1, 1), "YOffsetInSlideCoordinateSystem" },
+  { 0x0040074A, VR::DS, VM(1, 1, 1), "ZOffsetInSlideCoordinateSystem" },
+  { 0x004008EA, VR::SQ, VM(1, 1, 1), "MeasurementUnitsCodeSequence" },
+  { 0x00401001, VR::SH, VM(1, 1, 1), "RequestedProcedureID" },
+  { 0x00401002, VR::LO, VM(1, 1, 1), "ReasonForTheRequestedProcedure" },
+  { 0x00401003, VR::SH, VM(1, 1, 1), "RequestedProcedurePriority" },
+  { 0x00401004, VR::LO, VM(1, 1, 1), "PatientTransportArrangements" },
+  { 0x00401005, VR::LO, VM(1, 1, 1), "RequestedProcedureLocation" },
+  { 0x00401008, VR::LO, VM(1, 1, 1), "ConfidentialityCode" },
+  { 0x00401009, VR::SH, VM(1, 1, 1), "ReportingPriority" },
+  { 0x0040100A, VR::SQ, VM(1, 1, 1), "ReasonForRequestedProcedureCodeSequence" },
+  { 0x00401010, VR::PN, VM(1, VM::N, 1), "NamesOfIntendedRecipientsOfResults" },
+  { 0x00401011, VR::SQ, VM(1, 1, 1), "IntendedRecipientsOfResultsIdentificationSequence" },
+  { 0x00401012, VR::SQ, VM(1, 1, 1), "ReasonForPerformedProcedureCodeSequence" },
+  { 0x00401101, VR::SQ, VM(1, 1, 1), "PersonIdentificationCodeSequence" },
+  { 0x00401102, VR::ST, VM(1, 1, 1), "PersonAddress" },
+  { 0x00401103, VR::LO, VM(1, VM::N, 1), "PersonTelephoneNumbers" },
+  { 0x00401104, VR::LT, VM(1, 1, 1), "PersonTelecomInformation" },
+  { 0x00401400, VR::LT, VM(1, 1, 1), "RequestedProcedureComments" },
+  { 0x00402004, VR::DA, VM(1, 1, 1), "IssueDateOfImagingServiceRequest" },
+  { 0x00402005, VR::TM, VM(1, 1, 1), "IssueTimeOfImagingServiceRequest" },
+  { 0x00402008, VR::PN, VM(1, 1, 1), "OrderEnteredBy" },
+  { 0x00402009, VR::SH, VM(1, 1, 1), "OrderEntererLocation" },
+  { 0x00402010, VR::SH, VM(1, 1, 1), "OrderCallbackPhoneNumber" },
+  { 0x00402011, VR::LT, VM(1, 1, 1), "OrderCallbackTelecomInformation" },
+  { 0x00402016, VR::LO, VM(1, 1, 1), "PlacerOrderNumberImagingServiceRequest" },
+  { 0x00402017, VR::LO, VM(1, 1, 1), "FillerOrderNumberImagingServiceRequest" },
+  { 0x00402400, VR::LT, VM(1, 1, 1), "ImagingServiceRequestComments" },
+  { 0x00403001, VR::LO, VM(1, 1, 1), "ConfidentialityConstraintOnPatientDataDescription" },
+  { 0x00404005, VR::DT, VM(1, 1, 1), "ScheduledProcedureStepStartDateTime" },
+  { 0x00404007, VR::SQ, VM(1, 1, 1), "PerformedProcessingApplicationsCodeSequence" },
+  { 0x00404009, VR::SQ, VM(1, 1, 1), "HumanPerformerCodeSequence" },
+  { 0x00404010, VR::DT, VM(1, 1, 1), "ScheduledProcedureStepModificationDateTime" },
+  { 0x00404011, VR::DT, VM(1, 1, 1), "ExpectedCompletionDateTime" },
+  { 0x00404018, VR::SQ, VM(1, 1, 1), "ScheduledWorkitemCodeSequence" },
+  { 0x00404019, VR::SQ, VM(1, 1, 1), "PerformedWorkitemCodeSequence" },
+  { 0x00404020, VR::CS, VM(1, 1, 1), "InputAvailabilityFlag" },
+  { 0x00404021, VR::SQ, VM(1, 1, 1), "InputInformationSequence" },
+  { 0x00404025, VR::SQ, VM(1, 1, 1), "ScheduledStationNameCodeSequence" },
+  { 0x00404026, VR::SQ, VM(1, 1, 1), "ScheduledStationClassCodeSequence" },
+  { 0x00404027, VR::SQ, VM(1, 1, 1), "ScheduledStationGeographicLocationCodeSequence" },
+  { 0x00404028, VR::SQ, VM(1, 1, 1), "PerformedStationNameCodeSequence" },
+  { 0x00404029, VR::SQ, VM(1, 1, 1), "PerformedStationClassCodeSequence" },
+  { 0x00404030, VR::SQ, VM(1, 1, 1), "PerformedStationGeographicLocationCodeSequence" },
+  { 0x00404033, VR::SQ, VM(1, 1, 1), "OutputInformationSequence" },
+  { 0x00404034, VR::SQ, VM(1, 1, 1), "ScheduledHumanPerformersSequence" },
+  { 0x00404035, VR::SQ, VM(1, 1, 1), "ActualHumanPerformersSequence" },
+  { 0x00404036, VR::LO, VM(1, 1, 1), "HumanPerformerOrganization" },
+  { 0x00404037, VR::PN, VM(1, 1, 1), "HumanPerformerName" },
+  { 0x00404040, VR::CS, VM(1, 1, 1), "RawDataHandling" },
+  { 0x00404041, VR::CS, VM(1, 1, 1), "InputReadinessState" },
+  { 0x00404050, VR::DT, VM(1, 1, 1), "PerformedProcedureStepStartDateTime" },
+  { 0x00404051, VR::DT, VM(1, 1, 1), "PerformedProcedureStepEndDateTime" },
+  { 0x00404052, VR::DT, VM(1, 1, 1), "ProcedureStepCancellationDateTime" },
+  { 0x00404070, VR::SQ, VM(1, 1, 1), "OutputDestinationSequence" },
+  { 0x00404071, VR::SQ, VM(1, 1, 1), "DICOMStorageSequence" },
+  { 0x00404072, VR::SQ, VM(1, 1, 1), "STOWRSStorageSequence" },
+  { 0x00404073, VR::UR, VM(1, 1, 1), "StorageURL" },
+  { 0x00404074, VR::SQ, VM(1, 1, 1), "XDSStorageSequence" },
+  { 0x00408302, VR::DS, VM(1, 1, 1), "EntranceDoseInmGy" },
+  { 0x00409092, VR::SQ, VM(1, 1, 1), "ParametricMapFrameTypeSequence" },
+  { 0x00409094, VR::SQ, VM(1, 1, 1), "ReferencedImageRealWorldValueMappingSequence" },
+  { 0x00409096, VR::SQ, VM(1, 1, 1), "RealWorldValueMappingSequence" },
+  { 0x00409098, VR::SQ, VM(1, 1, 1), "PixelValueMappingCodeSequence" },
+  { 0x00409210, VR::SH, VM(1, 1, 1), "LUTLabel" },
+  { 0x00409211, VR::US, VM(1, 1, 1), "RealWorldValueLastValueMapped" },
+  { 0x00409212, VR::FD, VM(1, VM::N, 1), "RealWorldValueLUTData" },
+  { 0x00409213, VR::FD, VM(1, 1, 1), "DoubleFloatRealWorldValueLastValueMapped" },
+  { 0x00409214, VR::FD, VM(1, 1, 1), "DoubleFloatRealWorldValueFirstValueMapped" },
+  { 0x00409216, VR::US, VM(1, 1, 1), "RealWorldValueFirstValueMapped" },
+  { 0x00409220, VR::SQ, VM(1, 1, 1), "QuantityDefinitionSequence" },
+  { 0x00409224, VR::FD, VM(1, 1, 1), "RealWorldValueIntercept" },
+  { 0x00409225, VR::FD, VM(1, 1, 1), "RealWorldValueSlope" },
+  { 0x0040A010, VR::CS, VM(1, 1, 1), "RelationshipType" },
+  { 0x0040A027, VR::LO, VM(1, 1, 1), "VerifyingOrganization" },
+  { 0x0040A030, VR::DT, VM(1, 1, 1), "VerificationDateTime" },
+  { 0x0040A032, VR::DT, VM(1, 1, 1), "ObservationDateTime" },
+  { 0x0040A040, VR::CS, VM(1, 1, 1), "ValueType" },
+  { 0x0040A043, VR::SQ, VM(1, 1, 1), "ConceptNameCodeSequence" },
+  { 0x0040A050, VR::CS, VM(1, 1, 1), "ContinuityOfContent" },
+  { 0x0040A073, VR::SQ, VM(1, 1, 1), "VerifyingObserverSequence" },
+  { 0x0040A075, VR::PN, VM(1, 1, 1), "VerifyingObserverName" },
+  { 0x0040A078, VR::SQ, VM(1, 1, 1), "AuthorObserverSequence" },
+  { 0x0040A07A, VR::SQ, VM(1, 1, 1), "ParticipantSequence" },
+  { 0x0040A07C, VR::SQ, VM(1, 1, 1), "CustodialOrganizationSequence" },
+  { 0x0040A080, VR::CS, VM(1, 1, 1), "ParticipationType" },
+  { 0x0040A082, VR::DT, VM(1, 1, 1), "ParticipationDateTime" },
+  { 0x0040A084, VR::CS, VM(1, 1, 1), "ObserverType" },
+  { 0x0040A088, VR::SQ, VM(1, 1, 1), "VerifyingObserverIdentificationCodeSequence" },
+  { 0x0040A0B0, VR::US, VM(1, VM::N, 2), "ReferencedWaveformChannels" },
+  { 0x0040A120, VR::DT, VM(1, 1, 1), "DateTime" },
+  { 0x0040A121, VR::DA, VM(1, 1, 1), "Date" },
+  { 0x0040A122, VR::TM, VM(1, 1, 1), "Time" },
+  { 0x0040A123, VR::PN, VM(1, 1, 1), "PersonName" },
+  { 0x0040A124, VR::UI, VM(1, 1, 1), "UID" },
+  { 0x0040A130, VR::CS, VM(1, 1, 1), "TemporalRangeType" },
+  { 0x0040A132, VR::UL, VM(1, VM::N, 1), "ReferencedSamplePositions" },
+  { 0x0040A136, VR::US, VM(1, VM::N, 1), "ReferencedFrameNumbers" },
+  { 0x0040A138, VR::DS, VM(1, VM::N, 1), "ReferencedTimeOffsets" },
+  { 0x0040A13A, VR::DT, VM(1, VM::N, 1), "ReferencedDateTime" },
+  { 0x0040A160, VR::UT, VM(1, 1, 1), "TextValue" },
+  { 0x0040A161, VR::FD, VM(1, VM::N, 1), "FloatingPointValue" },
+  { 0x0040A162, VR::SL, VM(1, VM::N, 1), "RationalNumeratorValue" },
+  { 0x0040A163, VR::UL, VM(1, VM::N, 1), "RationalDenominatorValue" },
+  { 0x0040A168, VR::SQ, VM(1, 1, 1), "ConceptCodeSequence" },
+  { 0x0040A170, VR::SQ, VM(1, 1, 1), "PurposeOfReferenceCodeSequence" },
+  { 0x0040A171, VR::UI, VM(1, 1, 1), "ObservationUID" },
+  { 0x0040A180, VR::US, VM(1, 1, 1), "AnnotationGroupNumber" },
+  { 0x0040A195, VR::SQ, VM(1, 1, 1), "ModifierCodeSequence" },
+  { 0x0040A300, VR::SQ, VM(1, 1, 1), "MeasuredValueSequence" },
+  { 0x0040A301, VR::SQ, VM(1, 1, 1), "NumericValueQualifierCodeSequence" },
+  { 0x0040A30A, VR::DS, VM(1, VM::N, 1), "NumericValue" },
+  { 0x0040A360, VR::SQ, VM(1, 1, 1), "PredecessorDocumentsSequence" },
+  { 0x0040A370, VR::SQ, VM(1, 1, 1), "ReferencedRequestSequence" },
+  { 0x0040A372, VR::SQ, VM(1, 1, 1), "PerformedProcedureCodeSequence" },
+  { 0x0040A375, VR::SQ, VM(1, 1, 1), "CurrentRequestedProcedureEvidenceSequence" },
+  { 0x0040A385, VR::SQ, VM(1, 1, 1), "PertinentOtherEvidenceSequence" },
+  { 0x0040A390, VR::SQ, VM(1, 1, 1), "HL7StructuredDocumentReferenceSequence" },
+  { 0x0040A491, VR::CS, VM(1, 1, 1), "CompletionFlag" },
+  { 0x0040A492, VR::LO, VM(1, 1, 1), "CompletionFlagDescription" },
+  { 0x0040A493, VR::CS, VM(1, 1, 1), "VerificationFlag" },
+  { 0x0040A494, VR::CS, VM(1, 1, 1), "ArchiveRequested" },
+  { 0x0040A496, VR::CS, VM(1, 1, 1), "PreliminaryFlag" },
+  { 0x0040A504, VR::SQ, VM(1, 1, 1), "ContentTemplateSequence" },
+  { 0x0040A525, VR::SQ, VM(1, 1, 1), "IdenticalDocumentsSequence" },
+  { 0x0040A730, VR::SQ, VM(1, 1, 1), "ContentSequence" },
+  { 0x0040B020, VR::SQ, VM(1, 1, 1), "WaveformAnnotationSequence" },
+  { 0x0040DB00, VR::CS, VM(1, 1, 1), "TemplateIdentifier" },
+  { 0x0040DB73, VR::UL, VM(1, VM::N, 1), "ReferencedContentItemIdentifier" },
+  { 0x0040E001, VR::ST, VM(1, 1, 1), "HL7InstanceIdentifier" },
+  { 0x0040E004, VR::DT, VM(1, 1, 1), "HL7DocumentEffectiveTime" },
+  { 0x0040E006, VR::SQ, VM(1, 1, 1), "HL7DocumentTypeCodeSequence" },
+  { 0x0040E008, VR::SQ, VM(1, 1, 1), "DocumentClassCodeSequence" },
+  { 0x0040E010, VR::UR, VM(1, 1, 1), "RetrieveURI" },
+  { 0x0040E011, VR::UI, VM(1, 1, 1), "RetrieveLocationUID" },
+  { 0x0040E020, VR::CS, VM(1, 1, 1), "TypeOfInstances" },
+  { 0x0040E021, VR::SQ, VM(1, 1, 1), "DICOMRetrievalSequence" },
+  { 0x0040E022, VR::SQ, VM(1, 1, 1), "DICOMMediaRetrievalSequence" },
+  { 0x0040E023, VR::SQ, VM(1, 1, 1), "WADORetrievalSequence" },
+  { 0x0040E024, VR::SQ, VM(1, 1, 1), "XDSRetrievalSequence" },
+  { 0x0040E025, VR::SQ, VM(1, 1, 1), "WADORSRetrievalSequence" },
+  { 0x0040E030, VR::UI, VM(1, 1, 1), "RepositoryUniqueID" },
+  { 0x0040E031, VR::UI, VM(1, 1, 1), "HomeCommunityID" },
+  { 0x00420010, VR::ST, VM(1, 1, 1), "DocumentTitle" },
+  { 0x00420011, VR::OB, VM(1, 1, 1), "EncapsulatedDocument" },
+  { 0x00420012, VR::LO, VM(1, 1, 1), "MIMETypeOfEncapsulatedDocument" },
+  { 0x00420013, VR::SQ, VM(1, 1, 1), "SourceInstanceSequence" },
+  { 0x00420014, VR::LO, VM(1, VM::N, 1), "ListOfMIMETypes" },
+  { 0x00440001, VR::ST, VM(1, 1, 1), "ProductPackageIdentifier" },
+  { 0x00440002, VR::CS, VM(1, 1, 1), "SubstanceAdministrationApproval" },
+  { 0x00440003, VR::LT, VM(1, 1, 1), "ApprovalStatusFurtherDescription" },
+  { 0x00440004, VR::DT, VM(1, 1, 1), "ApprovalStatusDateTime" },
+  { 0x00440007, VR::SQ, VM(1, 1, 1), "ProductTypeCodeSequence" },
+  { 0x00440008, VR::LO, VM(1, VM::N, 1), "ProductName" },
+  { 0x00440009, VR::LT, VM(1, 1, 1), "ProductDescription" },
+  { 0x0044000A, VR::LO, VM(1, 1, 1), "ProductLotIdentifier" },
+  { 0x0044000B, VR::DT, VM(1, 1, 1), "ProductExpirationDateTime" },
+  { 0x00440010, VR::DT, VM(1, 1, 1), "SubstanceAdministrationDateTime" },
+  { 0x00440011, VR::LO, VM(1, 1, 1), "SubstanceAdministrationNotes" },
+  { 0x00440012, VR::LO, VM(1, 1, 1), "SubstanceAdministrationDeviceID" },
+  { 0x00440013, VR::SQ, VM(1, 1, 1), "ProductParameterSequence" },
+  { 0x00440019, VR::SQ, VM(1, 1, 1), "SubstanceAdministrationParameterSequence" },
+  { 0x00460012, VR::LO, VM(1, 1, 1), "LensDescription" },
+  { 0x00460014, VR::SQ, VM(1, 1, 1), "RightLensSequence" },
+  { 0x00460015, VR::SQ, VM(1, 1, 1), "LeftLensSequence" },
+  { 0x00460016, VR::SQ, VM(1, 1, 1), "UnspecifiedLateralityLensSequence" },
+  { 0x00460018, VR::SQ, VM(1, 1, 1), "CylinderSequence" },
+  { 0x00460028, VR::SQ, VM(1, 1, 1), "PrismSequence" },
+  { 0x00460030, VR::FD, VM(1, 1, 1), "HorizontalPrismPower" },
+  { 0x00460032, VR::CS, VM(1, 1, 1), "HorizontalPrismBase" },
+  { 0x00460034, VR::FD, VM(1, 1, 1), "VerticalPrismPower" },
+  { 0x00460036, VR::CS, VM(1, 1, 1), "VerticalPrismBase" },
+  { 0x00460038, VR::CS, VM(1, 1, 1), "LensSegmentType" },
+  { 0x00460040, VR::FD, VM(1, 1, 1), "OpticalTransmittance" },
+  { 0x00460042, VR::FD, VM(1, 1, 1), "ChannelWidth" },
+  { 0x00460044, VR::FD, VM(1, 1, 1), "PupilSize" },
+  { 0x00460046, VR::FD, VM(1, 1, 1), "CornealSize" },
+  { 0x00460050, VR::SQ, VM(1, 1, 1), "AutorefractionRightEyeSequence" },
+  { 0x00460052, VR::SQ, VM(1, 1, 1), "AutorefractionLeftEyeSequence" },
+  { 0x00460060, VR::FD, VM(1, 1, 1), "DistancePupillaryDistance" },
+  { 0x00460062, VR::FD, VM(1, 1, 1), "NearPupillaryDistance" },
+  { 0x00460063, VR::FD, VM(1, 1, 1), "IntermediatePupillaryDistance" },
+  { 0x00460064, VR::FD, VM(1, 1, 1), "OtherPupillaryDistance" },
+  { 0x00460070, VR::SQ, VM(1, 1, 1), "KeratometryRightEyeSequence" },
+  { 0x00460071, VR::SQ, VM(1, 1, 1), "KeratometryLeftEyeSequence" },
+  { 0x00460074, VR::SQ, VM(1, 1, 1), "SteepKeratometricAxisSequence" },
+  { 0x00460075, VR::FD, VM(1, 1, 1), "RadiusOfCurvature" },
+  { 0x00460076, VR::FD, VM(1, 1, 1), "KeratometricPower" },
+  { 0x00460077, VR::FD, VM(1, 1, 1), "KeratometricAxis" },
+  { 0x00460080, VR::SQ, VM(1, 1, 1), "FlatKeratometricAxisSequence" },
+  { 0x00460092, VR::CS, VM(1, 1, 1), "BackgroundColor" },
+  { 0x00460094, VR::CS, VM(1, 1, 1), "Optotype" },
+  { 0x00460095, VR::CS, VM(1, 1, 1), "OptotypePresentation" },
+  { 0x00460097, VR::SQ, VM(1, 1, 1), "SubjectiveRefractionRightEyeSequence" },
+  { 0x00460098, VR::SQ, VM(1, 1, 1), "SubjectiveRefractionLeftEyeSequence" },
+  { 0x00460100, VR::SQ, VM(1, 1, 1), "AddNearSequence" },
+  { 0x00460101, VR::SQ, VM(1, 1, 1), "AddIntermediateSequence" },
+  { 0x00460102, VR::SQ, VM(1, 1, 1), "AddOtherSequence" },
+  { 0x00460104, VR::FD, VM(1, 1, 1), "AddPower" },
+  { 0x00460106, VR::FD, VM(1, 1, 1), "ViewingDistance" },
+  { 0x00460121, VR::SQ, VM(1, 1, 1), "VisualAcuityTypeCodeSequence" },
+  { 0x00460122, VR::SQ, VM(1, 1, 1), "VisualAcuityRightEyeSequence" },
+  { 0x00460123, VR::SQ, VM(1, 1, 1), "VisualAcuityLeftEyeSequence" },
+  { 0x00460124, VR::SQ, VM(1, 1, 1), "VisualAcuityBothEyesOpenSequence" },
+  { 0x00460125, VR::CS, VM(1, 1, 1), "ViewingDistanceType" },
+  { 0x00460135, VR::SS, VM(2, 2, 1), "VisualAcuityModifiers" },
+  { 0x00460137, VR::FD, VM(1, 1, 1), "DecimalVisualAcuity" },
+  { 0x00460139, VR::LO, VM(1, 1, 1), "OptotypeDetailedDefinition" },
+  { 0x00460145, VR::SQ, VM(1, 1, 1), "ReferencedRefractiveMeasurementsSequence" },
+  { 0x00460146, VR::FD, VM(1, 1, 1), "SpherePower" },
+  { 0x00460147, VR::FD, VM(1, 1, 1), "CylinderPower" },
+  { 0x00460201, VR::CS, VM(1, 1, 1), "CornealTopographySurface" },
+  { 0x00460202, VR::FL, VM(2, 2, 1), "CornealVertexLocation" },
+  { 0x00460203, VR::FL, VM(1, 1, 1), "PupilCentroidXCoordinate" },
+  { 0x00460204, VR::FL, VM(1, 1, 1), "PupilCentroidYCoordinate" },
+  { 0x00460205, VR::FL, VM(1, 1, 1), "EquivalentPupilRadius" },
+  { 0x00460207, VR::SQ, VM(1, 1, 1), "CornealTopographyMapTypeCodeSequence" },
+  { 0x00460208, VR::IS, VM(1, VM::N, 2), "VerticesOfTheOutlineOfPupil" },
+  { 0x00460210, VR::SQ, VM(1, 1, 1), "CornealTopographyMappingNormalsSequence" },
+  { 0x00460211, VR::SQ, VM(1, 1, 1), "MaximumCornealCurvatureSequence" },
+  { 0x00460212, VR::FL, VM(1, 1, 1), "MaximumCornealCurvature" },
+  { 0x00460213, VR::FL, VM(2, 2, 1), "MaximumCornealCurvatureLocation" },
+  { 0x00460215, VR::SQ, VM(1, 1, 1), "MinimumKeratometricSequence" },
+  { 0x00460218, VR::SQ, VM(1, 1, 1), "SimulatedKeratometricCylinderSequence" },
+  { 0x00460220, VR::FL, VM(1, 1, 1), "AverageCornealPower" },
+  { 0x00460224, VR::FL, VM(1, 1, 1), "CornealISValue" },
+  { 0x00460227, VR::FL, VM(1, 1, 1), "AnalyzedArea" },
+  { 0x00460230, VR::FL, VM(1, 1, 1), "SurfaceRegularityIndex" },
+  { 0x00460232, VR::FL, VM(1, 1, 1), "SurfaceAsymmetryIndex" },
+  { 0x00460234, VR::FL, VM(1, 1, 1), "CornealEccentricityIndex" },
+  { 0x00460236, VR::FL, VM(1, 1, 1), "KeratoconusPredictionIndex" },
+  { 0x00460238, VR::FL, VM(1, 1, 1), "DecimalPotentialVisualAcuity" },
+  { 0x00460242, VR::CS, VM(1, 1, 1), "CornealTopographyMapQualityEvaluation" },
+  { 0x00460244, VR::SQ, VM(1, 1, 1), "SourceImageCornealProcessedDataSequence" },
+  { 0x00460247, VR::FL, VM(3, 3, 1), "CornealPointLocation" },
+  { 0x00460248, VR::CS, VM(1, 1, 1), "CornealPointEstimated" },
+  { 0x00460249, VR::FL, VM(1, 1, 1), "AxialPower" },
+  { 0x00460250, VR::FL, VM(1, 1, 1), "TangentialPower" },
+  { 0x00460251, VR::FL, VM(1, 1, 1), "RefractivePower" },
+  { 0x00460252, VR::FL, VM(1, 1, 1), "RelativeElevation" },
+  { 0x00460253, VR::FL, VM(1, 1, 1), "CornealWavefront" },
+  { 0x00480001, VR::FL, VM(1, 1, 1), "ImagedVolumeWidth" },
+  { 0x00480002, VR::FL, VM(1, 1, 1), "ImagedVolumeHeight" },
+  { 0x00480003, VR::FL, VM(1, 1, 1), "ImagedVolumeDepth" },
+  { 0x00480006, VR::UL, VM(1, 1, 1), "TotalPixelMatrixColumns" },
+  { 0x00480007, VR::UL, VM(1, 1, 1), "TotalPixelMatrixRows" },
+  { 0x00480008, VR::SQ, VM(1, 1, 1), "TotalPixelMatrixOriginSequence" },
+  { 0x00480010, VR::CS, VM(1, 1, 1), "SpecimenLabelInImage" },
+  { 0x00480011, VR::CS, VM(1, 1, 1), "FocusMethod" },
+  { 0x00480012, VR::CS, VM(1, 1, 1), "ExtendedDepthOfField" },
+  { 0x00480013, VR::US, VM(1, 1, 1), "NumberOfFocalPlanes" },
+  { 0x00480014, VR::FL, VM(1, 1, 1), "DistanceBetweenFocalPlanes" },
+  { 0x00480015, VR::US, VM(3, 3, 1), "RecommendedAbsentPixelCIELabValue" },
+  { 0x00480100, VR::SQ, VM(1, 1, 1), "IlluminatorTypeCodeSequence" },
+  { 0x00480102, VR::DS, VM(6, 6, 1), "ImageOrientationSlide" },
+  { 0x00480105, VR::SQ, VM(1, 1, 1), "OpticalPathSequence" },
+  { 0x00480106, VR::SH, VM(1, 1, 1), "OpticalPathIdentifier" },
+  { 0x00480107, VR::ST, VM(1, 1, 1), "OpticalPathDescription" },
+  { 0x00480108, VR::SQ, VM(1, 1, 1), "IlluminationColorCodeSequence" },
+  { 0x00480110, VR::SQ, VM(1, 1, 1), "SpecimenReferenceSequence" },
+  { 0x00480111, VR::DS, VM(1, 1, 1), "CondenserLensPower" },
+  { 0x00480112, VR::DS, VM(1, 1, 1), "ObjectiveLensPower" },
+  { 0x00480113, VR::DS, VM(1, 1, 1), "ObjectiveLensNumericalAperture" },
+  { 0x00480120, VR::SQ, VM(1, 1, 1), "PaletteColorLookupTableSequence" },
+  { 0x00480200, VR::SQ, VM(1, 1, 1), "ReferencedImageNavigationSequence" },
+  { 0x00480201, VR::US, VM(2, 2, 1), "TopLeftHandCornerOfLocalizerArea" },
+  { 0x00480202, VR::US, VM(2, 2, 1), "BottomRightHandCornerOfLocalizerArea" },
+  { 0x00480207, VR::SQ, VM(1, 1, 1), "OpticalPathIdentificationSequence" },
+  { 0x0048021A, VR::SQ, VM(1, 1, 1), "PlanePositionSlideSequence" },
+  { 0x0048021E, VR::SL, VM(1, 1, 1), "ColumnPositionInTotalImagePixelMatrix" },
+  { 0x0048021F, VR::SL, VM(1, 1, 1), "RowPositionInTotalImagePixelMatrix" },
+  { 0x00480301, VR::CS, VM(1, 1, 1), "PixelOriginInterpretation" },
+  { 0x00500004, VR::CS, VM(1, 1, 1), "CalibrationImage" },
+  { 0x00500010, VR::SQ, VM(1, 1, 1), "DeviceSequence" },
+  { 0x00500012, VR::SQ, VM(1, 1, 1), "ContainerComponentTypeCodeSequence" },
+  { 0x00500013, VR::FD, VM(1, 1, 1), "ContainerComponentThickness" },
+  { 0x00500014, VR::DS, VM(1, 1, 1), "DeviceLength" },
+  { 0x00500015, VR::FD, VM(1, 1, 1), "ContainerComponentWidth" },
+  { 0x00500016, VR::DS, VM(1, 1, 1), "DeviceDiameter" },
+  { 0x00500017, VR::CS, VM(1, 1, 1), "DeviceDiameterUnits" },
+  { 0x00500018, VR::DS, VM(1, 1, 1), "DeviceVolume" },
+  { 0x00500019, VR::DS, VM(1, 1, 1), "InterMarkerDistance" },
+  { 0x0050001A, VR::CS, VM(1, 1, 1), "ContainerComponentMaterial" },
+  { 0x0050001B, VR::LO, VM(1, 1, 1), "ContainerComponentID" },
+  { 0x0050001C, VR::FD, VM(1, 1, 1), "ContainerComponentLength" },
+  { 0x0050001D, VR::FD, VM(1, 1, 1), "ContainerComponentDiameter" },
+  { 0x0050001E, VR::LO, VM(1, 1, 1), "ContainerComponentDescription" },
+  { 0x00500020, VR::LO, VM(1, 1, 1), "DeviceDescription" },
+  { 0x00520001, VR::FL, VM(1, 1, 1), "ContrastBolusIngredientPercentByVolume" },
+  { 0x00520002, VR::FD, VM(1, 1, 1), "OCTFocalDistance" },
+  { 0x00520003, VR::FD, VM(1, 1, 1), "BeamSpotSize" },
+  { 0x00520004, VR::FD, VM(1, 1, 1), "EffectiveRefractiveIndex" },
+  { 0x00520006, VR::CS, VM(1, 1, 1), "OCTAcquisitionDomain" },
+  { 0x00520007, VR::FD, VM(1, 1, 1), "OCTOpticalCenterWavelength" },
+  { 0x00520008, VR::FD, VM(1, 1, 1), "AxialResolution" },
+  { 0x00520009, VR::FD, VM(1, 1, 1), "RangingDepth" },
+  { 0x00520011, VR::FD, VM(1, 1, 1), "ALineRate" },
+  { 0x00520012, VR::US, VM(1, 1, 1), "ALinesPerFrame" },
+  { 0x00520013, VR::FD, VM(1, 1, 1), "CatheterRotationalRate" },
+  { 0x00520014, VR::FD, VM(1, 1, 1), "ALinePixelSpacing" },
+  { 0x00520016, VR::SQ, VM(1, 1, 1), "ModeOfPercutaneousAccessSequence" },
+  { 0x00520025, VR::SQ, VM(1, 1, 1), "IntravascularOCTFrameTypeSequence" },
+  { 0x00520026, VR::CS, VM(1, 1, 1), "OCTZOffsetApplied" },
+  { 0x00520027, VR::SQ, VM(1, 1, 1), "IntravascularFrameContentSequence" },
+  { 0x00520028, VR::FD, VM(1, 1, 1), "IntravascularLongitudinalDistance" },
+  { 0x00520029, VR::SQ, VM(1, 1, 1), "IntravascularOCTFrameContentSequence" },
+  { 0x00520030, VR::SS, VM(1, 1, 1), "OCTZOffsetCorrection" },
+  { 0x00520031, VR::CS, VM(1, 1, 1), "CatheterDirectionOfRotation" },
+  { 0x00520033, VR::FD, VM(1, 1, 1), "SeamLineLocation" },
+  { 0x00520034, VR::FD, VM(1, 1, 1), "FirstALineLocation" },
+  { 0x00520036, VR::US, VM(1, 1, 1), "SeamLineIndex" },
+  { 0x00520038, VR::US, VM(1, 1, 1), "NumberOfPaddedALines" },
+  { 0x00520039, VR::CS, VM(1, 1, 1), "InterpolationType" },
+  { 0x0052003A, VR::CS, VM(1, 1, 1), "RefractiveIndexApplied" },
+  { 0x00540010, VR::US, VM(1, VM::N, 1), "EnergyWindowVector" },
+  { 0x00540011, VR::US, VM(1, 1, 1), "NumberOfEnergyWindows" },
+  { 0x00540012, VR::SQ, VM(1, 1, 1), "EnergyWindowInformationSequence" },
+  { 0x00540013, VR::SQ, VM(1, 1, 1), "EnergyWindowRangeSequence" },
+  { 0x00540014, VR::DS, VM(1, 1, 1), "EnergyWindowLowerLimit" },
+  { 0x00540015, VR::DS, VM(1, 1, 1), "EnergyWindowUpperLimit" },
+  { 0x00540016, VR::SQ, VM(1, 1, 1), "RadiopharmaceuticalInformationSequence" },
+  { 0x00540017, VR::IS, VM(1, 1, 1), "ResidualSyringeCounts" },
+  { 0x00540018, VR::SH, VM(1, 1, 1), "EnergyWindowName" },
+  { 0x00540020, VR::US, VM(1, VM::N, 1), "DetectorVector" },
+  { 0x00540021, VR::US, VM(1, 1, 1), "NumberOfDetectors" },
+  { 0x00540022, VR::SQ, VM(1, 1, 1), "DetectorInformationSequence" },
+  { 0x00540030, VR::US, VM(1, VM::N, 1), "PhaseVector" },
+  { 0x00540031, VR::US, VM(1, 1, 1), "NumberOfPhases" },
+  { 0x00540032, VR::SQ, VM(1, 1, 1), "PhaseInformationSequence" },
+  { 0x00540033, VR::US, VM(1, 1, 1), "NumberOfFramesInPhase" },
+  { 0x00540036, VR::IS, VM(1, 1, 1), "PhaseDelay" },
+  { 0x00540038, VR::IS, VM(1, 1, 1), "PauseBetweenFrames" },
+  { 0x00540039, VR::CS, VM(1, 1, 1), "PhaseDescription" },
+  { 0x00540050, VR::US, VM(1, VM::N, 1), "RotationVector" },
+  { 0x00540051, VR::US, VM(1, 1, 1), "NumberOfRotations" },
+  { 0x00540052, VR::SQ, VM(1, 1, 1), "RotationInformationSequence" },
+  { 0x00540053, VR::US, VM(1, 1, 1), "NumberOfFramesInRotation" },
+  { 0x00540060, VR::US, VM(1, VM::N, 1), "RRIntervalVector" },
+  { 0x00540061, VR::US, VM(1, 1, 1), "NumberOfRRIntervals" },
+  { 0x00540062, VR::SQ, VM(1, 1, 1), "GatedInformationSequence" },
+  { 0x00540063, VR::SQ, VM(1, 1, 1), "DataInformationSequence" },
+  { 0x00540070, VR::US, VM(1, VM::N, 1), "TimeSlotVector" },
+  { 0x00540071, VR::US, VM(1, 1, 1), "NumberOfTimeSlots" },
+  { 0x00540072, VR::SQ, VM(1, 1, 1), "TimeSlotInformationSequence" },
+  { 0x00540073, VR::DS, VM(1, 1, 1), "TimeSlotTime" },
+  { 0x00540080, VR::US, VM(1, VM::N, 1), "SliceVector" },
+  { 0x00540081, VR::US, VM(1, 1, 1), "NumberOfSlices" },
+  { 0x00540090, VR::US, VM(1, VM::N, 1), "AngularViewVector" },
+  { 0x00540100, VR::US, VM(1, VM::N, 1), "TimeSliceVector" },
+  { 0x00540101, VR::US, VM(1, 1, 1), "NumberOfTimeSlices" },
+  { 0x00540200, VR::DS, VM(1, 1, 1), "StartAngle" },
+  { 0x00540202, VR::CS, VM(1, 1, 1), "TypeOfDetectorMotion" },
+  { 0x00540210, VR::IS, VM(1, VM::N, 1), "TriggerVector" },
+  { 0x00540211, VR::US, VM(1, 1, 1), "NumberOfTriggersInPhase" },
+  { 0x00540220, VR::SQ, VM(1, 1, 1), "ViewCodeSequence" },
+  { 0x00540222, VR::SQ, VM(1, 1, 1), "ViewModifierCodeSequence" },
+  { 0x00540300, VR::SQ, VM(1, 1, 1), "RadionuclideCodeSequence" },
+  { 0x00540302, VR::SQ, VM(1, 1, 1), "AdministrationRouteCodeSequence" },
+  { 0x00540304, VR::SQ, VM(1, 1, 1), "RadiopharmaceuticalCodeSequence" },
+  { 0x00540306, VR::SQ, VM(1, 1, 1), "CalibrationDataSequence" },
+  { 0x00540308, VR::US, VM(1, 1, 1), "EnergyWindowNumber" },
+  { 0x00540400, VR::SH, VM(1, 1, 1), "ImageID" },
+  { 0x00540410, VR::SQ, VM(1, 1, 1), "PatientOrientationCodeSequence" },
+  { 0x00540412, VR::SQ, VM(1, 1, 1), "PatientOrientationModifierCodeSequence" },
+  { 0x00540414, VR::SQ, VM(1, 1, 1), "PatientGantryRelationshipCodeSequence" },
+  { 0x00540500, VR::CS, VM(1, 1, 1), "SliceProgressionDirection" },
+  { 0x00540501, VR::CS, VM(1, 1, 1), "ScanProgressionDirection" },
+  { 0x00541000, VR::CS, VM(2, 2, 1), "SeriesType" },
+  { 0x00541001, VR::CS, VM(1, 1, 1), "Units" },
+  { 0x00541002, VR::CS, VM(1, 1, 1), "CountsSource" },
+  { 0x00541004, VR::CS, VM(1, 1, 1), "ReprojectionMethod" },
+  { 0x00541006, VR::CS, VM(1, 1, 1), "SUVType" },
+  { 0x00541100, VR::CS, VM(1, 1, 1), "RandomsCorrectionMethod" },
+  { 0x00541101, VR::LO, VM(1, 1, 1), "AttenuationCorrectionMethod" },
+  { 0x00541102, VR::CS, VM(1, 1, 1), "DecayCorrection" },
+  { 0x00541103, VR::LO, VM(1, 1, 1), "ReconstructionMethod" },
+  { 0x00541104, VR::LO, VM(1, 1, 1), "DetectorLinesOfResponseUsed" },
+  { 0x00541105, VR::LO, VM(1, 1, 1), "ScatterCorrectionMethod" },
+  { 0x00541200, VR::DS, VM(1, 1, 1), "AxialAcceptance" },
+  { 0x00541201, VR::IS, VM(2, 2, 1), "AxialMash" },
+  { 0x00541202, VR::IS, VM(1, 1, 1), "TransverseMash" },
+  { 0x00541203, VR::DS, VM(2, 2, 1), "DetectorElementSize" },
+  { 0x00541210, VR::DS, VM(1, 1, 1), "CoincidenceWindowWidth" },
+  { 0x00541220, VR::CS, VM(1, VM::N, 1), "SecondaryCountsType" },
+  { 0x00541300, VR::DS, VM(1, 1, 1), "FrameReferenceTime" },
+  { 0x00541310, VR::IS, VM(1, 1, 1), "PrimaryPromptsCountsAccumulated" },
+  { 0x00541311, VR::IS, VM(1, VM::N, 1), "SecondaryCountsAccumulated" },
+  { 0x00541320, VR::DS, VM(1, 1, 1), "SliceSensitivityFactor" },
+  { 0x00541321, VR::DS, VM(1, 1, 1), "DecayFactor" },
+  { 0x00541322, VR::DS, VM(1, 1, 1), "DoseCalibrationFactor" },
+  { 0x00541323, VR::DS, VM(1, 1, 1), "ScatterFractionFactor" },
+  { 0x00541324, VR::DS, VM(1, 1, 1), "DeadTimeFactor" },
+  { 0x00541330, VR::US, VM(1, 1, 1), "ImageIndex" },
+  { 0x00603000, VR::SQ, VM(1, 1, 1), "HistogramSequence" },
+  { 0x00603002, VR::US, VM(1, 1, 1), "HistogramNumberOfBins" },
+  { 0x00603004, VR::US, VM(1, 1, 1), "HistogramFirstBinValue" },
+  { 0x00603006, VR::US, VM(1, 1, 1), "HistogramLastBinValue" },
+  { 0x00603008, VR::US, VM(1, 1, 1), "HistogramBinWidth" },
+  { 0x00603010, VR::LO, VM(1, 1, 1), "HistogramExplanation" },
+  { 0x00603020, VR::UL, VM(1, VM::N, 1), "HistogramData" },
+  { 0x00620001, VR::CS, VM(1, 1, 1), "SegmentationType" },
+  { 0x00620002, VR::SQ, VM(1, 1, 1), "SegmentSequence" },
+  { 0x00620003, VR::SQ, VM(1, 1, 1), "SegmentedPropertyCategoryCodeSequence" },
+  { 0x00620004, VR::US, VM(1, 1, 1), "SegmentNumber" },
+  { 0x00620005, VR::LO, VM(1, 1, 1), "SegmentLabel" },
+  { 0x00620006, VR::ST, VM(1, 1, 1), "SegmentDescription" },
+  { 0x00620008, VR::CS, VM(1, 1, 1), "SegmentAlgorithmType" },
+  { 0x00620009, VR::LO, VM(1, 1, 1), "SegmentAlgorithmName" },
+  { 0x0062000A, VR::SQ, VM(1, 1, 1), "SegmentIdentificationSequence" },
+  { 0x0062000B, VR::US, VM(1, VM::N, 1), "ReferencedSegmentNumber" },
+  { 0x0062000C, VR::US, VM(1, 1, 1), "RecommendedDisplayGrayscaleValue" },
+  { 0x0062000D, VR::US, VM(3, 3, 1), "RecommendedDisplayCIELabValue" },
+  { 0x0062000E, VR::US, VM(1, 1, 1), "MaximumFractionalValue" },
+  { 0x0062000F, VR::SQ, VM(1, 1, 1), "SegmentedPropertyTypeCodeSequence" },
+  { 0x00620010, VR::CS, VM(1, 1, 1), "SegmentationFractionalType" },
+  { 0x00620011, VR::SQ, VM(1, 1, 1), "SegmentedPropertyTypeModifierCodeSequence" },
+  { 0x00620012, VR::SQ, VM(1, 1, 1), "UsedSegmentsSequence" },
+  { 0x00620020, VR::UT, VM(1, 1, 1), "TrackingID" },
+  { 0x00620021, VR::UI, VM(1, 1, 1), "TrackingUID" },
+  { 0x00640002, VR::SQ, VM(1, 1, 1), "DeformableRegistrationSequence" },
+  { 0x00640003, VR::UI, VM(1, 1, 1), "SourceFrameOfReferenceUID" },
+  { 0x00640005, VR::SQ, VM(1, 1, 1), "DeformableRegistrationGridSequence" },
+  { 0x00640007, VR::UL, VM(3, 3, 1), "GridDimensions" },
+  { 0x00640008, VR::FD, VM(3, 3, 1), "GridResolution" },
+  { 0x00640009, VR::OF, VM(1, 1, 1), "VectorGridData" },
+  { 0x0064000F, VR::SQ, VM(1, 1, 1), "PreDeformationMatrixRegistrationSequence" },
+  { 0x00640010, VR::SQ, VM(1, 1, 1), "PostDeformationMatrixRegistrationSequence" },
+  { 0x00660001, VR::UL, VM(1, 1, 1), "NumberOfSurfaces" },
+  { 0x00660002, VR::SQ, VM(1, 1, 1), "SurfaceSequence" },
+  { 0x00660003, VR::UL, VM(1, 1, 1), "SurfaceNumber" },
+  { 0x00660004, VR::LT, VM(1, 1, 1), "SurfaceComments" },
+  { 0x00660009, VR::CS, VM(1, 1, 1), "SurfaceProcessing" },
+  { 0x0066000A, VR::FL, VM(1, 1, 1), "SurfaceProcessingRatio" },
+  { 0x0066000B, VR::LO, VM(1, 1, 1), "SurfaceProcessingDescription" },
+  { 0x0066000C, VR::FL, VM(1, 1, 1), "RecommendedPresentationOpacity" },
+  { 0x0066000D, VR::CS, VM(1, 1, 1), "RecommendedPresentationType" },
+  { 0x0066000E, VR::CS, VM(1, 1, 1), "FiniteVolume" },
+  { 0x00660010, VR::CS, VM(1, 1, 1), "Manifold" },
+  { 0x00660011, VR::SQ, VM(1, 1, 1), "SurfacePointsSequence" },
+  { 0x00660012, VR::SQ, VM(1, 1, 1), "SurfacePointsNormalsSequence" },
+  { 0x00660013, VR::SQ, VM(1, 1, 1), "SurfaceMeshPrimitivesSequence" },
+  { 0x00660015, VR::UL, VM(1, 1, 1), "NumberOfSurfacePoints" },
+  { 0x00660016, VR::OF, VM(1, 1, 1), "PointCoordinatesData" },
+  { 0x00660017, VR::FL, VM(3, 3, 1), "PointPositionAccuracy" },
+  { 0x00660018, VR::FL, VM(1, 1, 1), "MeanPointDistance" },
+  { 0x00660019, VR::FL, VM(1, 1, 1), "MaximumPointDistance" },
+  { 0x0066001A, VR::FL, VM(6, 6, 1), "PointsBoundingBoxCoordinates" },
+  { 0x0066001B, VR::FL, VM(3, 3, 1), "AxisOfRotation" },
+  { 0x0066001C, VR::FL, VM(3, 3, 1), "CenterOfRotation" },
+  { 0x0066001E, VR::UL, VM(1, 1, 1), "NumberOfVectors" },
+  { 0x0066001F, VR::US, VM(1, 1, 1), "VectorDimensionality" },
+  { 0x00660020, VR::FL, VM(1, VM::N, 1), "VectorAccuracy" },
+  { 0x00660021, VR::OF, VM(1, 1, 1), "VectorCoordinateData" },
+  { 0x00660026, VR::SQ, VM(1, 1, 1), "TriangleStripSequence" },
+  { 0x00660027, VR::SQ, VM(1, 1, 1), "TriangleFanSequence" },
+  { 0x00660028, VR::SQ, VM(1, 1, 1), "LineSequence" },
+  { 0x0066002A, VR::UL, VM(1, 1, 1), "SurfaceCount" },
+  { 0x0066002B, VR::SQ, VM(1, 1, 1), "ReferencedSurfaceSequence" },
+  { 0x0066002C, VR::UL, VM(1, 1, 1), "ReferencedSurfaceNumber" },
+  { 0x0066002D, VR::SQ, VM(1, 1, 1), "SegmentSurfaceGenerationAlgorithmIdentificationSequence" },
+  { 0x0066002E, VR::SQ, VM(1, 1, 1), "SegmentSurfaceSourceInstanceSequence" },
+  { 0x0066002F, VR::SQ, VM(1, 1, 1), "AlgorithmFamilyCodeSequence" },
+  { 0x00660030, VR::SQ, VM(1, 1, 1), "AlgorithmNameCodeSequence" },
+  { 0x00660031, VR::LO, VM(1, 1, 1), "AlgorithmVersion" },
+  { 0x00660032, VR::LT, VM(1, 1, 1), "AlgorithmParameters" },
+  { 0x00660034, VR::SQ, VM(1, 1, 1), "FacetSequence" },
+  { 0x00660035, VR::SQ, VM(1, 1, 1), "SurfaceProcessingAlgorithmIdentificationSequence" },
+  { 0x00660036, VR::LO, VM(1, 1, 1), "AlgorithmName" },
+  { 0x00660037, VR::FL, VM(1, 1, 1), "RecommendedPointRadius" },
+  { 0x00660038, VR::FL, VM(1, 1, 1), "RecommendedLineThickness" },
+  { 0x00660040, VR::OL, VM(1, 1, 1), "LongPrimitivePointIndexList" },
+  { 0x00660041, VR::OL, VM(1, 1, 1), "LongTrianglePointIndexList" },
+  { 0x00660042, VR::OL, VM(1, 1, 1), "LongEdgePointIndexList" },
+  { 0x00660043, VR::OL, VM(1, 1, 1), "LongVertexPointIndexList" },
+  { 0x00660101, VR::SQ, VM(1, 1, 1), "TrackSetSequence" },
+  { 0x00660102, VR::SQ, VM(1, 1, 1), "TrackSequence" },
+  { 0x00660103, VR::OW, VM(1, 1, 1), "RecommendedDisplayCIELabValueList" },
+  { 0x00660104, VR::SQ, VM(1, 1, 1), "TrackingAlgorithmIdentificationSequence" },
+  { 0x00660105, VR::UL, VM(1, 1, 1), "TrackSetNumber" },
+  { 0x00660106, VR::LO, VM(1, 1, 1), "TrackSetLabel" },
+  { 0x00660107, VR::UT, VM(1, 1, 1), "TrackSetDescription" },
+  { 0x00660108, VR::SQ, VM(1, 1, 1), "TrackSetAnatomicalTypeCodeSequence" },
+  { 0x00660121, VR::SQ, VM(1, 1, 1), "MeasurementsSequence" },
+  { 0x00660124, VR::SQ, VM(1, 1, 1), "TrackSetStatisticsSequence" },
+  { 0x00660125, VR::OF, VM(1, 1, 1), "FloatingPointValues" },
+  { 0x00660129, VR::OL, VM(1, 1, 1), "TrackPointIndexList" },
+  { 0x00660130, VR::SQ, VM(1, 1, 1), "TrackStatisticsSequence" },
+  { 0x00660132, VR::SQ, VM(1, 1, 1), "MeasurementValuesSequence" },
+  { 0x00660133, VR::SQ, VM(1, 1, 1), "DiffusionAcquisitionCodeSequence" },
+  { 0x00660134, VR::SQ, VM(1, 1, 1), "DiffusionModelCodeSequence" },
+  { 0x00686210, VR::LO, VM(1, 1, 1), "ImplantSize" },
+  { 0x00686221, VR::LO, VM(1, 1, 1), "ImplantTemplateVersion" },
+  { 0x00686222, VR::SQ, VM(1, 1, 1), "ReplacedImplantTemplateSequence" },
+  { 0x00686223, VR::CS, VM(1, 1, 1), "ImplantType" },
+  { 0x00686224, VR::SQ, VM(1, 1, 1), "DerivationImplantTemplateSequence" },
+  { 0x00686225, VR::SQ, VM(1, 1, 1), "OriginalImplantTemplateSequence" },
+  { 0x00686226, VR::DT, VM(1, 1, 1), "EffectiveDateTime" },
+  { 0x00686230, VR::SQ, VM(1, 1, 1), "ImplantTargetAnatomySequence" },
+  { 0x00686260, VR::SQ, VM(1, 1, 1), "InformationFromManufacturerSequence" },
+  { 0x00686265, VR::SQ, VM(1, 1, 1), "NotificationFromManufacturerSequence" },
+  { 0x00686270, VR::DT, VM(1, 1, 1), "InformationIssueDateTime" },
+  { 0x00686280, VR::ST, VM(1, 1, 1), "InformationSummary" },
+  { 0x006862A0, VR::SQ, VM(1, 1, 1), "ImplantRegulatoryDisapprovalCodeSequence" },
+  { 0x006862A5, VR::FD, VM(1, 1, 1), "OverallTemplateSpatialTolerance" },
+  { 0x006862C0, VR::SQ, VM(1, 1, 1), "HPGLDocumentSequence" },
+  { 0x006862D0, VR::US, VM(1, 1, 1), "HPGLDocumentID" },
+  { 0x006862D5, VR::LO, VM(1, 1, 1), "HPGLDocumentLabel" },
+  { 0x006862E0, VR::SQ, VM(1, 1, 1), "ViewOrientationCodeSequence" },
+  { 0x006862F0, VR::FD, VM(1, 1, 1), "ViewOrientationModifier" },
+  { 0x006862F2, VR::FD, VM(1, 1, 1), "HPGLDocumentScaling" },
+  { 0x00686300, VR::OB, VM(1, 1, 1), "HPGLDocument" },
+  { 0x00686310, VR::US, VM(1, 1, 1), "HPGLContourPenNumber" },
+  { 0x00686320, VR::SQ, VM(1, 1, 1), "HPGLPenSequence" },
+  { 0x00686330, VR::US, VM(1, 1, 1), "HPGLPenNumber" },
+  { 0x00686340, VR::LO, VM(1, 1, 1), "HPGLPenLabel" },
+  { 0x00686345, VR::ST, VM(1, 1, 1), "HPGLPenDescription" },
+  { 0x00686346, VR::FD, VM(2, 2, 1), "RecommendedRotationPoint" },
+  { 0x00686347, VR::FD, VM(4, 4, 1), "BoundingRectangle" },
+  { 0x00686350, VR::US, VM(1, VM::N, 1), "ImplantTemplate3DModelSurfaceNumber" },
+  { 0x00686360, VR::SQ, VM(1, 1, 1), "SurfaceModelDescriptionSequence" },
+  { 0x00686380, VR::LO, VM(1, 1, 1), "SurfaceModelLabel" },
+  { 0x00686390, VR::FD, VM(1, 1, 1), "SurfaceModelScalingFactor" },
+  { 0x006863A0, VR::SQ, VM(1, 1, 1), "MaterialsCodeSequence" },
+  { 0x006863A4, VR::SQ, VM(1, 1, 1), "CoatingMaterialsCodeSequence" },
+  { 0x006863A8, VR::SQ, VM(1, 1, 1), "ImplantTypeCodeSequence" },
+  { 0x006863AC, VR::SQ, VM(1, 1, 1), "FixationMethodCodeSequence" },
+  { 0x006863B0, VR::SQ, VM(1, 1, 1), "MatingFeatureSetsSequence" },
+  { 0x006863C0, VR::US, VM(1, 1, 1), "MatingFeatureSetID" },
+  { 0x006863D0, VR::LO, VM(1, 1, 1), "MatingFeatureSetLabel" },
+  { 0x006863E0, VR::SQ, VM(1, 1, 1), "MatingFeatureSequence" },
+  { 0x006863F0, VR::US, VM(1, 1, 1), "MatingFeatureID" },
+  { 0x00686400, VR::SQ, VM(1, 1, 1), "MatingFeatureDegreeOfFreedomSequence" },
+  { 0x00686410, VR::US, VM(1, 1, 1), "DegreeOfFreedomID" },
+  { 0x00686420, VR::CS, VM(1, 1, 1), "DegreeOfFreedomType" },
+  { 0x00686430, VR::SQ, VM(1, 1, 1), "TwoDMatingFeatureCoordinatesSequence" },
+  { 0x00686440, VR::US, VM(1, 1, 1), "ReferencedHPGLDocumentID" },
+  { 0x00686450, VR::FD, VM(2, 2, 1), "TwoDMatingPoint" },
+  { 0x00686460, VR::FD, VM(4, 4, 1), "TwoDMatingAxes" },
+  { 0x00686470, VR::SQ, VM(1, 1, 1), "TwoDDegreeOfFreedomSequence" },
+  { 0x00686490, VR::FD, VM(3, 3, 1), "ThreeDDegreeOfFreedomAxis" },
+  { 0x006864A0, VR::FD, VM(2, 2, 1), "RangeOfFreedom" },
+  { 0x006864C0, VR::FD, VM(3, 3, 1), "ThreeDMatingPoint" },
+  { 0x006864D0, VR::FD, VM(9, 9, 1), "ThreeDMatingAxes" },
+  { 0x006864F0, VR::FD, VM(3, 3, 1), "TwoDDegreeOfFreedomAxis" },
+  { 0x00686500, VR::SQ, VM(1, 1, 1), "PlanningLandmarkPointSequence" },
+  { 0x00686510, VR::SQ, VM(1, 1, 1), "PlanningLandmarkLineSequence" },
+  { 0x00686520, VR::SQ, VM(1, 1, 1), "PlanningLandmarkPlaneSequence" },
+  { 0x00686530, VR::US, VM(1, 1, 1), "PlanningLandmarkID" },
+  { 0x00686540, VR::LO, VM(1, 1, 1), "PlanningLandmarkDescription" },
+  { 0x00686545, VR::SQ, VM(1, 1, 1), "PlanningLandmarkIdentificationCodeSequence" },
+  { 0x00686550, VR::SQ, VM(1, 1, 1), "TwoDPointCoordinatesSequence" },
+  { 0x00686560, VR::FD, VM(2, 2, 1), "TwoDPointCoordinates" },
+  { 0x00686590, VR::FD, VM(3, 3, 1), "ThreeDPointCoordinates" },
+  { 0x006865A0, VR::SQ, VM(1, 1, 1), "TwoDLineCoordinatesSequence" },
+  { 0x006865B0, VR::FD, VM(4, 4, 1), "TwoDLineCoordinates" },
+  { 0x006865D0, VR::FD, VM(6, 6, 1), "ThreeDLineCoordinates" },
+  { 0x006865E0, VR::SQ, VM(1, 1, 1), "TwoDPlaneCoordinatesSequence" },
+  { 0x006865F0, VR::FD, VM(4, 4, 1), "TwoDPlaneIntersection" },
+  { 0x00686610, VR::FD, VM(3, 3, 1), "ThreeDPlaneOrigin" },
+  { 0x00686620, VR::FD, VM(3, 3, 1), "ThreeDPlaneNormal" },
+  { 0x00700001, VR::SQ, VM(1, 1, 1), "GraphicAnnotationSequence" },
+  { 0x00700002, VR::CS, VM(1, 1, 1), "GraphicLayer" },
+  { 0x00700003, VR::CS, VM(1, 1, 1), "BoundingBoxAnnotationUnits" },
+  { 0x00700004, VR::CS, VM(1, 1, 1), "AnchorPointAnnotationUnits" },
+  { 0x00700005, VR::CS, VM(1, 1, 1), "GraphicAnnotationUnits" },
+  { 0x00700006, VR::ST, VM(1, 1, 1), "UnformattedTextValue" },
+  { 0x00700008, VR::SQ, VM(1, 1, 1), "TextObjectSequence" },
+  { 0x00700009, VR::SQ, VM(1, 1, 1), "GraphicObjectSequence" },
+  { 0x00700010, VR::FL, VM(2, 2, 1), "BoundingBoxTopLeftHandCorner" },
+  { 0x00700011, VR::FL, VM(2, 2, 1), "BoundingBoxBottomRightHandCorner" },
+  { 0x00700012, VR::CS, VM(1, 1, 1), "BoundingBoxTextHorizontalJustification" },
+  { 0x00700014, VR::FL, VM(2, 2, 1), "AnchorPoint" },
+  { 0x00700015, VR::CS, VM(1, 1, 1), "AnchorPointVisibility" },
+  { 0x00700020, VR::US, VM(1, 1, 1), "GraphicDimensions" },
+  { 0x00700021, VR::US, VM(1, 1, 1), "NumberOfGraphicPoints" },
+  { 0x00700022, VR::FL, VM(2, VM::N, 1), "GraphicData" },
+  { 0x00700023, VR::CS, VM(1, 1, 1), "GraphicType" },
+  { 0x00700024, VR::CS, VM(1, 1, 1), "GraphicFilled" },
+  { 0x00700041, VR::CS, VM(1, 1, 1), "ImageHorizontalFlip" },
+  { 0x00700042, VR::US, VM(1, 1, 1), "ImageRotation" },
+  { 0x00700052, VR::SL, VM(2, 2, 1), "DisplayedAreaTopLeftHandCorner" },
+  { 0x00700053, VR::SL, VM(2, 2, 1), "DisplayedAreaBottomRightHandCorner" },
+  { 0x0070005A, VR::SQ, VM(1, 1, 1), "DisplayedAreaSelectionSequence" },
+  { 0x00700060, VR::SQ, VM(1, 1, 1), "GraphicLayerSequence" },
+  { 0x00700062, VR::IS, VM(1, 1, 1), "GraphicLayerOrder" },
+  { 0x00700066, VR::US, VM(1, 1, 1), "GraphicLayerRecommendedDisplayGrayscaleValue" },
+  { 0x00700068, VR::LO, VM(1, 1, 1), "GraphicLayerDescription" },
+  { 0x00700080, VR::CS, VM(1, 1, 1), "ContentLabel" },
+  { 0x00700081, VR::LO, VM(1, 1, 1), "ContentDescription" },
+  { 0x00700082, VR::DA, VM(1, 1, 1), "PresentationCreationDate" },
+  { 0x00700083, VR::TM, VM(1, 1, 1), "PresentationCreationTime" },
+  { 0x00700084, VR::PN, VM(1, 1, 1), "ContentCreatorName" },
+  { 0x00700086, VR::SQ, VM(1, 1, 1), "ContentCreatorIdentificationCodeSequence" },
+  { 0x00700087, VR::SQ, VM(1, 1, 1), "AlternateContentDescriptionSequence" },
+  { 0x00700100, VR::CS, VM(1, 1, 1), "PresentationSizeMode" },
+  { 0x00700101, VR::DS, VM(2, 2, 1), "PresentationPixelSpacing" },
+  { 0x00700102, VR::IS, VM(2, 2, 1), "PresentationPixelAspectRatio" },
+  { 0x00700103, VR::FL, VM(1, 1, 1), "PresentationPixelMagnificationRatio" },
+  { 0x00700207, VR::LO, VM(1, 1, 1), "GraphicGroupLabel" },
+  { 0x00700208, VR::ST, VM(1, 1, 1), "GraphicGroupDescription" },
+  { 0x00700209, VR::SQ, VM(1, 1, 1), "CompoundGraphicSequence" },
+  { 0x00700226, VR::UL, VM(1, 1, 1), "CompoundGraphicInstanceID" },
+  { 0x00700227, VR::LO, VM(1, 1, 1), "FontName" },
+  { 0x00700228, VR::CS, VM(1, 1, 1), "FontNameType" },
+  { 0x00700229, VR::LO, VM(1, 1, 1), "CSSFontName" },
+  { 0x00700230, VR::FD, VM(1, 1, 1), "RotationAngle" },
+  { 0x00700231, VR::SQ, VM(1, 1, 1), "TextStyleSequence" },
+  { 0x00700232, VR::SQ, VM(1, 1, 1), "LineStyleSequence" },
+  { 0x00700233, VR::SQ, VM(1, 1, 1), "FillStyleSequence" },
+  { 0x00700234, VR::SQ, VM(1, 1, 1), "GraphicGroupSequence" },
+  { 0x00700241, VR::US, VM(3, 3, 1), "TextColorCIELabValue" },
+  { 0x00700242, VR::CS, VM(1, 1, 1), "HorizontalAlignment" },
+  { 0x00700243, VR::CS, VM(1, 1, 1), "VerticalAlignment" },
+  { 0x00700244, VR::CS, VM(1, 1, 1), "ShadowStyle" },
+  { 0x00700245, VR::FL, VM(1, 1, 1), "ShadowOffsetX" },
+  { 0x00700246, VR::FL, VM(1, 1, 1), "ShadowOffsetY" },
+  { 0x00700247, VR::US, VM(3, 3, 1), "ShadowColorCIELabValue" },
+  { 0x00700248, VR::CS, VM(1, 1, 1), "Underlined" },
+  { 0x00700249, VR::CS, VM(1, 1, 1), "Bold" },
+  { 0x00700250, VR::CS, VM(1, 1, 1), "Italic" },
+  { 0x00700251, VR::US, VM(3, 3, 1), "PatternOnColorCIELabValue" },
+  { 0x00700252, VR::US, VM(3, 3, 1), "PatternOffColorCIELabValue" },
+  { 0x00700253, VR::FL, VM(1, 1, 1), "LineThickness" },
+  { 0x00700254, VR::CS, VM(1, 1, 1), "LineDashingStyle" },
+  { 0x00700255, VR::UL, VM(1, 1, 1), "LinePattern" },
+  { 0x00700256, VR::OB, VM(1, 1, 1), "FillPattern" },
+  { 0x00700257, VR::CS, VM(1, 1, 1), "FillMode" },
+  { 0x00700258, VR::FL, VM(1, 1, 1), "ShadowOpacity" },
+  { 0x00700261, VR::FL, VM(1, 1, 1), "GapLength" },
+  { 0x00700262, VR::FL, VM(1, 1, 1), "DiameterOfVisibility" },
+  { 0x00700273, VR::FL, VM(2, 2, 1), "RotationPoint" },
+  { 0x00700274, VR::CS, VM(1, 1, 1), "TickAlignment" },
+  { 0x00700278, VR::CS, VM(1, 1, 1), "ShowTickLabel" },
+  { 0x00700279, VR::CS, VM(1, 1, 1), "TickLabelAlignment" },
+  { 0x00700282, VR::CS, VM(1, 1, 1), "CompoundGraphicUnits" },
+  { 0x00700284, VR::FL, VM(1, 1, 1), "PatternOnOpacity" },
+  { 0x00700285, VR::FL, VM(1, 1, 1), "PatternOffOpacity" },
+  { 0x00700287, VR::SQ, VM(1, 1, 1), "MajorTicksSequence" },
+  { 0x00700288, VR::FL, VM(1, 1, 1), "TickPosition" },
+  { 0x00700289, VR::SH, VM(1, 1, 1), "TickLabel" },
+  { 0x00700294, VR::CS, VM(1, 1, 1), "CompoundGraphicType" },
+  { 0x00700295, VR::UL, VM(1, 1, 1), "GraphicGroupID" },
+  { 0x00700306, VR::CS, VM(1, 1, 1), "ShapeType" },
+  { 0x00700308, VR::SQ, VM(1, 1, 1), "RegistrationSequence" },
+  { 0x00700309, VR::SQ, VM(1, 1, 1), "MatrixRegistrationSequence" },
+  { 0x0070030A, VR::SQ, VM(1, 1, 1), "MatrixSequence" },
+  { 0x0070030B, VR::FD, VM(16, 16, 1), "FrameOfReferenceToDisplayedCoordinateSystemTransformationMatrix" },
+  { 0x0070030C, VR::CS, VM(1, 1, 1), "FrameOfReferenceTransformationMatrixType" },
+  { 0x0070030D, VR::SQ, VM(1, 1, 1), "RegistrationTypeCodeSequence" },
+  { 0x0070030F, VR::ST, VM(1, 1, 1), "FiducialDescription" },
+  { 0x00700310, VR::SH, VM(1, 1, 1), "FiducialIdentifier" },
+  { 0x00700311, VR::SQ, VM(1, 1, 1), "FiducialIdentifierCodeSequence" },
+  { 0x00700312, VR::FD, VM(1, 1, 1), "ContourUncertaintyRadius" },
+  { 0x00700314, VR::SQ, VM(1, 1, 1), "UsedFiducialsSequence" },
+  { 0x00700318, VR::SQ, VM(1, 1, 1), "GraphicCoordinatesDataSequence" },
+  { 0x0070031A, VR::UI, VM(1, 1, 1), "FiducialUID" },
+  { 0x0070031C, VR::SQ, VM(1, 1, 1), "FiducialSetSequence" },
+  { 0x0070031E, VR::SQ, VM(1, 1, 1), "FiducialSequence" },
+  { 0x00700401, VR::US, VM(3, 3, 1), "GraphicLayerRecommendedDisplayCIELabValue" },
+  { 0x00700402, VR::SQ, VM(1, 1, 1), "BlendingSequence" },
+  { 0x00700403, VR::FL, VM(1, 1, 1), "RelativeOpacity" },
+  { 0x00700404, VR::SQ, VM(1, 1, 1), "ReferencedSpatialRegistrationSequence" },
+  { 0x00700405, VR::CS, VM(1, 1, 1), "BlendingPosition" },
+  { 0x00701101, VR::UI, VM(1, 1, 1), "PresentationDisplayCollectionUID" },
+  { 0x00701102, VR::UI, VM(1, 1, 1), "PresentationSequenceCollectionUID" },
+  { 0x00701103, VR::US, VM(1, 1, 1), "PresentationSequencePositionIndex" },
+  { 0x00701104, VR::SQ, VM(1, 1, 1), "RenderedImageReferenceSequence" },
+  { 0x00701201, VR::SQ, VM(1, 1, 1), "VolumetricPresentationStateInputSequence" },
+  { 0x00701202, VR::CS, VM(1, 1, 1), "PresentationInputType" },
+  { 0x00701203, VR::US, VM(1, 1, 1), "InputSequencePositionIndex" },
+  { 0x00701204, VR::CS, VM(1, 1, 1), "Crop" },
+  { 0x00701205, VR::US, VM(1, VM::N, 1), "CroppingSpecificationIndex" },
+  { 0x00701206, VR::CS, VM(1, 1, 1), "CompositingMethod" },
+  { 0x00701207, VR::US, VM(1, 1, 1), "VolumetricPresentationInputNumber" },
+  { 0x00701208, VR::CS, VM(1, 1, 1), "ImageVolumeGeometry" },
+  { 0x0070120C, VR::US, VM(1, VM::N, 1), "GlobalCroppingSpecificationIndex" },
+  { 0x00701301, VR::SQ, VM(1, 1, 1), "VolumeCroppingSequence" },
+  { 0x00701302, VR::CS, VM(1, 1, 1), "VolumeCroppingMethod" },
+  { 0x00701303, VR::FD, VM(6, 6, 1), "BoundingBoxCrop" },
+  { 0x00701304, VR::SQ, VM(1, 1, 1), "ObliqueCroppingPlaneSequence" },
+  { 0x00701305, VR::FD, VM(4, 4, 1), "Plane" },
+  { 0x00701306, VR::FD, VM(3, 3, 1), "PlaneNormal" },
+  { 0x00701309, VR::US, VM(1, 1, 1), "CroppingSpecificationNumber" },
+  { 0x00701501, VR::CS, VM(1, 1, 1), "MultiPlanarReconstructionStyle" },
+  { 0x00701502, VR::CS, VM(1, 1, 1), "MPRThicknessType" },
+  { 0x00701503, VR::FD, VM(1, 1, 1), "MPRSlabThickness" },
+  { 0x00701505, VR::FD, VM(3, 3, 1), "MPRTopLeftHandCorner" },
+  { 0x00701507, VR::FD, VM(3, 3, 1), "MPRViewWidthDirection" },
+  { 0x00701508, VR::FD, VM(1, 1, 1), "MPRViewWidth" },
+  { 0x0070150C, VR::UL, VM(1, 1, 1), "NumberOfVolumetricCurvePoints" },
+  { 0x0070150D, VR::OD, VM(1, 1, 1), "VolumetricCurvePoints" },
+  { 0x00701511, VR::FD, VM(3, 3, 1), "MPRViewHeightDirection" },
+  { 0x00701512, VR::FD, VM(1, 1, 1), "MPRViewHeight" },
+  { 0x00701603, VR::FD, VM(3, 3, 1), "ViewpointPosition" },
+  { 0x00701604, VR::FD, VM(3, 3, 1), "ViewpointLookAtPoint" },
+  { 0x00701605, VR::FD, VM(3, 3, 1), "ViewpointUpDirection" },
+  { 0x00701606, VR::FD, VM(6, 6, 1), "RenderFieldOfView" },
+  { 0x00701703, VR::FD, VM(3, 3, 1), "LightDirection" },
+  { 0x00701801, VR::SQ, VM(1, 1, 1), "PresentationStateClassificationComponentSequence" },
+  { 0x00701802, VR::CS, VM(1, 1, 1), "ComponentType" },
+  { 0x00701803, VR::SQ, VM(1, 1, 1), "ComponentInputSequence" },
+  { 0x00701804, VR::US, VM(1, 1, 1), "VolumetricPresentationInputIndex" },
+  { 0x00701805, VR::SQ, VM(1, 1, 1), "PresentationStateCompositorComponentSequence" },
+  { 0x00701806, VR::SQ, VM(1, 1, 1), "WeightingTransferFunctionSequence" },
+  { 0x00701807, VR::US, VM(3, 3, 1), "WeightingLookupTableDescriptor" },
+  { 0x00701808, VR::OB, VM(1, 1, 1), "WeightingLookupTableData" },
+  { 0x00701901, VR::SQ, VM(1, 1, 1), "VolumetricAnnotationSequence" },
+  { 0x00701903, VR::SQ, VM(1, 1, 1), "ReferencedStructuredContextSequence" },
+  { 0x00701904, VR::UI, VM(1, 1, 1), "ReferencedContentItem" },
+  { 0x00701905, VR::SQ, VM(1, 1, 1), "VolumetricPresentationInputAnnotationSequence" },
+  { 0x00701907, VR::CS, VM(1, 1, 1), "AnnotationClipping" },
+  { 0x00701A01, VR::CS, VM(1, 1, 1), "PresentationAnimationStyle" },
+  { 0x00701A03, VR::FD, VM(1, 1, 1), "RecommendedAnimationRate" },
+  { 0x00701A04, VR::SQ, VM(1, 1, 1), "AnimationCurveSequence" },
+  { 0x00701A05, VR::FD, VM(1, 1, 1), "AnimationStepSize" },
+  { 0x00720002, VR::SH, VM(1, 1, 1), "HangingProtocolName" },
+  { 0x00720004, VR::LO, VM(1, 1, 1), "HangingProtocolDescription" },
+  { 0x00720006, VR::CS, VM(1, 1, 1), "HangingProtocolLevel" },
+  { 0x00720008, VR::LO, VM(1, 1, 1), "HangingProtocolCreator" },
+  { 0x0072000A, VR::DT, VM(1, 1, 1), "HangingProtocolCreationDateTime" },
+  { 0x0072000C, VR::SQ, VM(1, 1, 1), "HangingProtocolDefinitionSequence" },
+  { 0x0072000E, VR::SQ, VM(1, 1, 1), "HangingProtocolUserIdentificationCodeSequence" },
+  { 0x00720010, VR::LO, VM(1, 1, 1), "HangingProtocolUserGroupName" },
+  { 0x00720012, VR::SQ, VM(1, 1, 1), "SourceHangingProtocolSequence" },
+  { 0x00720014, VR::US, VM(1, 1, 1), "NumberOfPriorsReferenced" },
+  { 0x00720020, VR::SQ, VM(1, 1, 1), "ImageSetsSequence" },
+  { 0x00720022, VR::SQ, VM(1, 1, 1), "ImageSetSelectorSequence" },
+  { 0x00720024, VR::CS, VM(1, 1, 1), "ImageSetSelectorUsageFlag" },
+  { 0x00720026, VR::AT, VM(1, 1, 1), "SelectorAttribute" },
+  { 0x00720028, VR::US, VM(1, 1, 1), "SelectorValueNumber" },
+  { 0x00720030, VR::SQ, VM(1, 1, 1), "TimeBasedImageSetsSequence" },
+  { 0x00720032, VR::US, VM(1, 1, 1), "ImageSetNumber" },
+  { 0x00720034, VR::CS, VM(1, 1, 1), "ImageSetSelectorCategory" },
+  { 0x00720038, VR::US, VM(2, 2, 1), "RelativeTime" },
+  { 0x0072003A, VR::CS, VM(1, 1, 1), "RelativeTimeUnits" },
+  { 0x0072003C, VR::SS, VM(2, 2, 1), "AbstractPriorValue" },
+  { 0x0072003E, VR::SQ, VM(1, 1, 1), "AbstractPriorCodeSequence" },
+  { 0x00720040, VR::LO, VM(1, 1, 1), "ImageSetLabel" },
+  { 0x00720050, VR::CS, VM(1, 1, 1), "SelectorAttributeVR" },
+  { 0x00720052, VR::AT, VM(1, VM::N, 1), "SelectorSequencePointer" },
+  { 0x00720054, VR::LO, VM(1, VM::N, 1), "SelectorSequencePointerPrivateCreator" },
+  { 0x00720056, VR::LO, VM(1, 1, 1), "SelectorAttributePrivateCreator" },
+  { 0x0072005E, VR::AE, VM(1, VM::N, 1), "SelectorAEValue" },
+  { 0x0072005F, VR::AS, VM(1, VM::N, 1), "SelectorASValue" },
+  { 0x00720060, VR::AT, VM(1, VM::N, 1), "SelectorATValue" },
+  { 0x00720061, VR::DA, VM(1, VM::N, 1), "SelectorDAValue" },
+  { 0x00720062, VR::CS, VM(1, VM::N, 1), "SelectorCSValue" },
+  { 0x00720063, VR::DT, VM(1, VM::N, 1), "SelectorDTValue" },
+  { 0x00720064, VR::IS, VM(1, VM::N, 1), "SelectorISValue" },
+  { 0x00720066, VR::LO, VM(1, VM::N, 1), "SelectorLOValue" },
+  { 0x00720068, VR::LT, VM(1, 1, 1), "SelectorLTValue" },
+  { 0x0072006A, VR::PN, VM(1, VM::N, 1), "SelectorPNValue" },
+  { 0x0072006B, VR::TM, VM(1, VM::N, 1), "SelectorTMValue" },
+  { 0x0072006C, VR::SH, VM(1, VM::N, 1), "SelectorSHValue" },
+  { 0x0072006E, VR::ST, VM(1, 1, 1), "SelectorSTValue" },
+  { 0x0072006F, VR::UC, VM(1, VM::N, 1), "SelectorUCValue" },
+  { 0x00720070, VR::UT, VM(1, 1, 1), "SelectorUTValue" },
+  { 0x00720072, VR::DS, VM(1, VM::N, 1), "SelectorDSValue" },
+  { 0x00720074, VR::FD, VM(1, VM::N, 1), "SelectorFDValue" },
+  { 0x00720076, VR::FL, VM(1, VM::N, 1), "SelectorFLValue" },
+  { 0x00720078, VR::UL, VM(1, VM::N, 1), "SelectorULValue" },
+  { 0x0072007A, VR::US, VM(1, VM::N, 1), "SelectorUSValue" },
+  { 0x0072007C, VR::SL, VM(1, VM::N, 1), "SelectorSLValue" },
+  { 0x0072007E, VR::SS, VM(1, VM::N, 1), "SelectorSSValue" },
+  { 0x0072007F, VR::UI, VM(1, VM::N, 1), "SelectorUIValue" },
+  { 0x00720080, VR::SQ, VM(1, 1, 1), "SelectorCodeSequenceValue" },
+  { 0x00720100, VR::US, VM(1, 1, 1), "NumberOfScreens" },
+  { 0x00720102, VR::SQ, VM(1, 1, 1), "NominalScreenDefinitionSequence" },
+  { 0x00720104, VR::US, VM(1, 1, 1), "NumberOfVerticalPixels" },
+  { 0x00720106, VR::US, VM(1, 1, 1), "NumberOfHorizontalPixels" },
+  { 0x00720108, VR::FD, VM(4, 4, 1), "DisplayEnvironmentSpatialPosition" },
+  { 0x0072010A, VR::US, VM(1, 1, 1), "ScreenMinimumGrayscaleBitDepth" },
+  { 0x0072010C, VR::US, VM(1, 1, 1), "ScreenMinimumColorBitDepth" },
+  { 0x0072010E, VR::US, VM(1, 1, 1), "ApplicationMaximumRepaintTime" },
+  { 0x00720200, VR::SQ, VM(1, 1, 1), "DisplaySetsSequence" },
+  { 0x00720202, VR::US, VM(1, 1, 1), "DisplaySetNumber" },
+  { 0x00720203, VR::LO, VM(1, 1, 1), "DisplaySetLabel" },
+  { 0x00720204, VR::US, VM(1, 1, 1), "DisplaySetPresentationGroup" },
+  { 0x00720206, VR::LO, VM(1, 1, 1), "DisplaySetPresentationGroupDescription" },
+  { 0x00720208, VR::CS, VM(1, 1, 1), "PartialDataDisplayHandling" },
+  { 0x00720210, VR::SQ, VM(1, 1, 1), "SynchronizedScrollingSequence" },
+  { 0x00720212, VR::US, VM(2, VM::N, 1), "DisplaySetScrollingGroup" },
+  { 0x00720214, VR::SQ, VM(1, 1, 1), "NavigationIndicatorSequence" },
+  { 0x00720216, VR::US, VM(1, 1, 1), "NavigationDisplaySet" },
+  { 0x00720218, VR::US, VM(1, VM::N, 1), "ReferenceDisplaySets" },
+  { 0x00720300, VR::SQ, VM(1, 1, 1), "ImageBoxesSequence" },
+  { 0x00720302, VR::US, VM(1, 1, 1), "ImageBoxNumber" },
+  { 0x00720304, VR::CS, VM(1, 1, 1), "ImageBoxLayoutType" },
+  { 0x00720306, VR::US, VM(1, 1, 1), "ImageBoxTileHorizontalDimension" },
+  { 0x00720308, VR::US, VM(1, 1, 1), "ImageBoxTileVerticalDimension" },
+  { 0x00720310, VR::CS, VM(1, 1, 1), "ImageBoxScrollDirection" },
+  { 0x00720312, VR::CS, VM(1, 1, 1), "ImageBoxSmallScrollType" },
+  { 0x00720314, VR::US, VM(1, 1, 1), "ImageBoxSmallScrollAmount" },
+  { 0x00720316, VR::CS, VM(1, 1, 1), "ImageBoxLargeScrollType" },
+  { 0x00720318, VR::US, VM(1, 1, 1), "ImageBoxLargeScrollAmount" },
+  { 0x00720320, VR::US, VM(1, 1, 1), "ImageBoxOverlapPriority" },
+  { 0x00720330, VR::FD, VM(1, 1, 1), "CineRelativeToRealTime" },
+  { 0x00720400, VR::SQ, VM(1, 1, 1), "FilterOperationsSequence" },
+  { 0x00720402, VR::CS, VM(1, 1, 1), "FilterByCategory" },
+  { 0x00720404, VR::CS, VM(1, 1, 1), "FilterByAttributePresence" },
+  { 0x00720406, VR::CS, VM(1, 1, 1), "FilterByOperator" },
+  { 0x00720420, VR::US, VM(3, 3, 1), "StructuredDisplayBackgroundCIELabValue" },
+  { 0x00720421, VR::US, VM(3, 3, 1), "EmptyImageBoxCIELabValue" },
+  { 0x00720422, VR::SQ, VM(1, 1, 1), "StructuredDisplayImageBoxSequence" },
+  { 0x00720424, VR::SQ, VM(1, 1, 1), "StructuredDisplayTextBoxSequence" },
+  { 0x00720427, VR::SQ, VM(1, 1, 1), "ReferencedFirstFrameSequence" },
+  { 0x00720430, VR::SQ, VM(1, 1, 1), "ImageBoxSynchronizationSequence" },
+  { 0x00720432, VR::US, VM(2, VM::N, 1), "SynchronizedImageBoxList" },
+  { 0x00720434, VR::CS, VM(1, 1, 1), "TypeOfSynchronization" },
+  { 0x00720500, VR::CS, VM(1, 1, 1), "BlendingOperationType" },
+  { 0x00720510, VR::CS, VM(1, 1, 1), "ReformattingOperationType" },
+  { 0x00720512, VR::FD, VM(1, 1, 1), "ReformattingThickness" },
+  { 0x00720514, VR::FD, VM(1, 1, 1), "ReformattingInterval" },
+  { 0x00720516, VR::CS, VM(1, 1, 1), "ReformattingOperationInitialViewDirection" },
+  { 0x00720520, VR::CS, VM(1, VM::N, 1), "ThreeDRenderingType" },
+  { 0x00720600, VR::SQ, VM(1, 1, 1), "SortingOperationsSequence" },
+  { 0x00720602, VR::CS, VM(1, 1, 1), "SortByCategory" },
+  { 0x00720604, VR::CS, VM(1, 1, 1), "SortingDirection" },
+  { 0x00720700, VR::CS, VM(2, 2, 1), "DisplaySetPatientOrientation" },
+  { 0x00720702, VR::CS, VM(1, 1, 1), "VOIType" },
+  { 0x00720704, VR::CS, VM(1, 1, 1), "PseudoColorType" },
+  { 0x00720705, VR::SQ, VM(1, 1, 1), "PseudoColorPaletteInstanceReferenceSequence" },
+  { 0x00720706, VR::CS, VM(1, 1, 1), "ShowGrayscaleInverted" },
+  { 0x00720710, VR::CS, VM(1, 1, 1), "ShowImageTrueSizeFlag" },
+  { 0x00720712, VR::CS, VM(1, 1, 1), "ShowGraphicAnnotationFlag" },
+  { 0x00720714, VR::CS, VM(1, 1, 1), "ShowPatientDemographicsFlag" },
+  { 0x00720716, VR::CS, VM(1, 1, 1), "ShowAcquisitionTechniquesFlag" },
+  { 0x00720717, VR::CS, VM(1, 1, 1), "DisplaySetHorizontalJustification" },
+  { 0x00720718, VR::CS, VM(1, 1, 1), "DisplaySetVerticalJustification" },
+  { 0x00740120, VR::FD, VM(1, 1, 1), "ContinuationStartMeterset" },
+  { 0x00740121, VR::FD, VM(1, 1, 1), "ContinuationEndMeterset" },
+  { 0x00741000, VR::CS, VM(1, 1, 1), "ProcedureStepState" },
+  { 0x00741002, VR::SQ, VM(1, 1, 1), "ProcedureStepProgressInformationSequence" },
+  { 0x00741004, VR::DS, VM(1, 1, 1), "ProcedureStepProgress" },
+  { 0x00741006, VR::ST, VM(1, 1, 1), "ProcedureStepProgressDescription" },
+  { 0x00741008, VR::SQ, VM(1, 1, 1), "ProcedureStepCommunicationsURISequence" },
+  { 0x0074100A, VR::UR, VM(1, 1, 1), "ContactURI" },
+  { 0x0074100C, VR::LO, VM(1, 1, 1), "ContactDisplayName" },
+  { 0x0074100E, VR::SQ, VM(1, 1, 1), "ProcedureStepDiscontinuationReasonCodeSequence" },
+  { 0x00741020, VR::SQ, VM(1, 1, 1), "BeamTaskSequence" },
+  { 0x00741022, VR::CS, VM(1, 1, 1), "BeamTaskType" },
+  { 0x00741025, VR::CS, VM(1, 1, 1), "AutosequenceFlag" },
+  { 0x00741026, VR::FD, VM(1, 1, 1), "TableTopVerticalAdjustedPosition" },
+  { 0x00741027, VR::FD, VM(1, 1, 1), "TableTopLongitudinalAdjustedPosition" },
+  { 0x00741028, VR::FD, VM(1, 1, 1), "TableTopLateralAdjustedPosition" },
+  { 0x0074102A, VR::FD, VM(1, 1, 1), "PatientSupportAdjustedAngle" },
+  { 0x0074102B, VR::FD, VM(1, 1, 1), "TableTopEccentricAdjustedAngle" },
+  { 0x0074102C, VR::FD, VM(1, 1, 1), "TableTopPitchAdjustedAngle" },
+  { 0x0074102D, VR::FD, VM(1, 1, 1), "TableTopRollAdjustedAngle" },
+  { 0x00741030, VR::SQ, VM(1, 1, 1), "DeliveryVerificationImageSequence" },
+  { 0x00741032, VR::CS, VM(1, 1, 1), "VerificationImageTiming" },
+  { 0x00741034, VR::CS, VM(1, 1, 1), "DoubleExposureFlag" },
+  { 0x00741036, VR::CS, VM(1, 1, 1), "DoubleExposureOrdering" },
+  { 0x00741040, VR::SQ, VM(1, 1, 1), "RelatedReferenceRTImageSequence" },
+  { 0x00741042, VR::SQ, VM(1, 1, 1), "GeneralMachineVerificationSequence" },
+  { 0x00741044, VR::SQ, VM(1, 1, 1), "ConventionalMachineVerificationSequence" },
+  { 0x00741046, VR::SQ, VM(1, 1, 1), "IonMachineVerificationSequence" },
+  { 0x00741048, VR::SQ, VM(1, 1, 1), "FailedAttributesSequence" },
+  { 0x0074104A, VR::SQ, VM(1, 1, 1), "OverriddenAttributesSequence" },
+  { 0x0074104C, VR::SQ, VM(1, 1, 1), "ConventionalControlPointVerificationSequence" },
+  { 0x0074104E, VR::SQ, VM(1, 1, 1), "IonControlPointVerificationSequence" },
+  { 0x00741050, VR::SQ, VM(1, 1, 1), "AttributeOccurrenceSequence" },
+  { 0x00741052, VR::AT, VM(1, 1, 1), "AttributeOccurrencePointer" },
+  { 0x00741054, VR::UL, VM(1, 1, 1), "AttributeItemSelector" },
+  { 0x00741056, VR::LO, VM(1, 1, 1), "AttributeOccurrencePrivateCreator" },
+  { 0x00741057, VR::IS, VM(1, VM::N, 1), "SelectorSequencePointerItems" },
+  { 0x00741200, VR::CS, VM(1, 1, 1), "ScheduledProcedureStepPriority" },
+  { 0x00741202, VR::LO, VM(1, 1, 1), "WorklistLabel" },
+  { 0x00741204, VR::LO, VM(1, 1, 1), "ProcedureStepLabel" },
+  { 0x00741210, VR::SQ, VM(1, 1, 1), "ScheduledProcessingParametersSequence" },
+  { 0x00741212, VR::SQ, VM(1, 1, 1), "PerformedProcessingParametersSequence" },
+  { 0x00741216, VR::SQ, VM(1, 1, 1), "UnifiedProcedureStepPerformedProcedureSequence" },
+  { 0x00741224, VR::SQ, VM(1, 1, 1), "ReplacedProcedureStepSequence" },
+  { 0x00741230, VR::LO, VM(1, 1, 1), "DeletionLock" },
+  { 0x00741234, VR::AE, VM(1, 1, 1), "ReceivingAE" },
+  { 0x00741236, VR::AE, VM(1, 1, 1), "RequestingAE" },
+  { 0x00741238, VR::LT, VM(1, 1, 1), "ReasonForCancellation" },
+  { 0x00741242, VR::CS, VM(1, 1, 1), "SCPStatus" },
+  { 0x00741244, VR::CS, VM(1, 1, 1), "SubscriptionListStatus" },
+  { 0x00741246, VR::CS, VM(1, 1, 1), "UnifiedProcedureStepListStatus" },
+  { 0x00741324, VR::UL, VM(1, 1, 1), "BeamOrderIndex" },
+  { 0x00741338, VR::FD, VM(1, 1, 1), "DoubleExposureMeterset" },
+  { 0x0074133A, VR::FD, VM(4, 4, 1), "DoubleExposureFieldDelta" },
+  { 0x00741401, VR::SQ, VM(1, 1, 1), "BrachyTaskSequence" },
+  { 0x00741402, VR::DS, VM(1, 1, 1), "ContinuationStartTotalReferenceAirKerma" },
+  { 0x00741403, VR::DS, VM(1, 1, 1), "ContinuationEndTotalReferenceAirKerma" },
+  { 0x00741404, VR::IS, VM(1, 1, 1), "ContinuationPulseNumber" },
+  { 0x00741405, VR::SQ, VM(1, 1, 1), "ChannelDeliveryOrderSequence" },
+  { 0x00741406, VR::IS, VM(1, 1, 1), "ReferencedChannelNumber" },
+  { 0x00741407, VR::DS, VM(1, 1, 1), "StartCumulativeTimeWeight" },
+  { 0x00741408, VR::DS, VM(1, 1, 1), "EndCumulativeTimeWeight" },
+  { 0x00741409, VR::SQ, VM(1, 1, 1), "OmittedChannelSequence" },
+  { 0x0074140A, VR::CS, VM(1, 1, 1), "ReasonForChannelOmission" },
+  { 0x0074140B, VR::LO, VM(1, 1, 1), "ReasonForChannelOmissionDescription" },
+  { 0x0074140C, VR::IS, VM(1, 1, 1), "ChannelDeliveryOrderIndex" },
+  { 0x0074140D, VR::SQ, VM(1, 1, 1), "ChannelDeliveryContinuationSequence" },
+  { 0x0074140E, VR::SQ, VM(1, 1, 1), "OmittedApplicationSetupSequence" },
+  { 0x00760001, VR::LO, VM(1, 1, 1), "ImplantAssemblyTemplateName" },
+  { 0x00760003, VR::LO, VM(1, 1, 1), "ImplantAssemblyTemplateIssuer" },
+  { 0x00760006, VR::LO, VM(1, 1, 1), "ImplantAssemblyTemplateVersion" },
+  { 0x00760008, VR::SQ, VM(1, 1, 1), "ReplacedImplantAssemblyTemplateSequence" },
+  { 0x0076000A, VR::CS, VM(1, 1, 1), "ImplantAssemblyTemplateType" },
+  { 0x0076000C, VR::SQ, VM(1, 1, 1), "OriginalImplantAssemblyTemplateSequence" },
+  { 0x0076000E, VR::SQ, VM(1, 1, 1), "DerivationImplantAssemblyTemplateSequence" },
+  { 0x00760010, VR::SQ, VM(1, 1, 1), "ImplantAssemblyTemplateTargetAnatomySequence" },
+  { 0x00760020, VR::SQ, VM(1, 1, 1), "ProcedureTypeCodeSequence" },
+  { 0x00760030, VR::LO, VM(1, 1, 1), "SurgicalTechnique" },
+  { 0x00760032, VR::SQ, VM(1, 1, 1), "ComponentTypesSequence" },
+  { 0x00760034, VR::CS, VM(1, 1, 1), "ComponentTypeCodeSequence" },
+  { 0x00760036, VR::CS, VM(1, 1, 1), "ExclusiveComponentType" },
+  { 0x00760038, VR::CS, VM(1, 1, 1), "MandatoryComponentType" },
+  { 0x00760040, VR::SQ, VM(1, 1, 1), "ComponentSequence" },
+  { 0x00760055, VR::US, VM(1, 1, 1), "ComponentID" },
+  { 0x00760060, VR::SQ, VM(1, 1, 1), "ComponentAssemblySequence" },
+  { 0x00760070, VR::US, VM(1, 1, 1), "Component1ReferencedID" },
+  { 0x00760080, VR::US, VM(1, 1, 1), "Component1ReferencedMatingFeatureSetID" },
+  { 0x00760090, VR::US, VM(1, 1, 1), "Component1ReferencedMatingFeatureID" },
+  { 0x007600A0, VR::US, VM(1, 1, 1), "Component2ReferencedID" },
+  { 0x007600B0, VR::US, VM(1, 1, 1), "Component2ReferencedMatingFeatureSetID" },
+  { 0x007600C0, VR::US, VM(1, 1, 1), "Component2ReferencedMatingFeatureID" },
+  { 0x00780001, VR::LO, VM(1, 1, 1), "ImplantTemplateGroupName" },
+  { 0x00780010, VR::ST, VM(1, 1, 1), "ImplantTemplateGroupDescription" },
+  { 0x00780020, VR::LO, VM(1, 1, 1), "ImplantTemplateGroupIssuer" },
+  { 0x00780024, VR::LO, VM(1, 1, 1), "ImplantTemplateGroupVersion" },
+  { 0x00780026, VR::SQ, VM(1, 1, 1), "ReplacedImplantTemplateGroupSequence" },
+  { 0x00780028, VR::SQ, VM(1, 1, 1), "ImplantTemplateGroupTargetAnatomySequence" },
+  { 0x0078002A, VR::SQ, VM(1, 1, 1), "ImplantTemplateGroupMembersSequence" },
+  { 0x0078002E, VR::US, VM(1, 1, 1), "ImplantTemplateGroupMemberID" },
+  { 0x00780050, VR::FD, VM(3, 3, 1), "ThreeDImplantTemplateGroupMemberMatchingPoint" },
+  { 0x00780060, VR::FD, VM(9, 9, 1), "ThreeDImplantTemplateGroupMemberMatchingAxes" },
+  { 0x00780070, VR::SQ, VM(1, 1, 1), "ImplantTemplateGroupMemberMatching2DCoordinatesSequence" },
+  { 0x00780090, VR::FD, VM(2, 2, 1), "TwoDImplantTemplateGroupMemberMatchingPoint" },
+  { 0x007800A0, VR::FD, VM(4, 4, 1), "TwoDImplantTemplateGroupMemberMatchingAxes" },
+  { 0x007800B0, VR::SQ, VM(1, 1, 1), "ImplantTemplateGroupVariationDimensionSequence" },
+  { 0x007800B2, VR::LO, VM(1, 1, 1), "ImplantTemplateGroupVariationDimensionName" },
+  { 0x007800B4, VR::SQ, VM(1, 1, 1), "ImplantTemplateGroupVariationDimensionRankSequence" },
+  { 0x007800B6, VR::US, VM(1, 1, 1), "ReferencedImplantTemplateGroupMemberID" },
+  { 0x007800B8, VR::US, VM(1, 1, 1), "ImplantTemplateGroupVariationDimensionRank" },
+  { 0x00800001, VR::SQ, VM(1, 1, 1), "SurfaceScanAcquisitionTypeCodeSequence" },
+  { 0x00800002, VR::SQ, VM(1, 1, 1), "SurfaceScanModeCodeSequence" },
+  { 0x00800003, VR::SQ, VM(1, 1, 1), "RegistrationMethodCodeSequence" },
+  { 0x00800004, VR::FD, VM(1, 1, 1), "ShotDurationTime" },
+  { 0x00800005, VR::FD, VM(1, 1, 1), "ShotOffsetTime" },
+  { 0x00800006, VR::US, VM(1, VM::N, 1), "SurfacePointPresentationValueData" },
+  { 0x00800007, VR::US, VM(1, VM::N, 3), "SurfacePointColorCIELabValueData" },
+  { 0x00800008, VR::SQ, VM(1, 1, 1), "UVMappingSequence" },
+  { 0x00800009, VR::SH, VM(1, 1, 1), "TextureLabel" },
+  { 0x00800010, VR::OF, VM(1, 1, 1), "UValueData" },
+  { 0x00800011, VR::OF, VM(1, 1, 1), "VValueData" },
+  { 0x00800012, VR::SQ, VM(1, 1, 1), "ReferencedTextureSequence" },
+  { 0x00800013, VR::SQ, VM(1, 1, 1), "ReferencedSurfaceDataSequence" },
+  { 0x00880130, VR::SH, VM(1, 1, 1), "StorageMediaFileSetID" },
+  { 0x00880140, VR::UI, VM(1, 1, 1), "StorageMediaFileSetUID" },
+  { 0x00880200, VR::SQ, VM(1, 1, 1), "IconImageSequence" },
+  { 0x01000410, VR::CS, VM(1, 1, 1), "SOPInstanceStatus" },
+  { 0x01000420, VR::DT, VM(1, 1, 1), "SOPAuthorizationDateTime" },
+  { 0x01000424, VR::LT, VM(1, 1, 1), "SOPAuthorizationComment" },
+  { 0x01000426, VR::LO, VM(1, 1, 1), "AuthorizationEquipmentCertificationNumber" },
+  { 0x04000005, VR::US, VM(1, 1, 1), "MACIDNumber" },
+  { 0x04000010, VR::UI, VM(1, 1, 1), "MACCalculationTransferSyntaxUID" },
+  { 0x04000015, VR::CS, VM(1, 1, 1), "MACAlgorithm" },
+  { 0x04000020, VR::AT, VM(1, VM::N, 1), "DataElementsSigned" },
+  { 0x04000100, VR::UI, VM(1, 1, 1), "DigitalSignatureUID" },
+  { 0x04000105, VR::DT, VM(1, 1, 1), "DigitalSignatureDateTime" },
+  { 0x04000110, VR::CS, VM(1, 1, 1), "CertificateType" },
+  { 0x04000115, VR::OB, VM(1, 1, 1), "CertificateOfSigner" },
+  { 0x04000120, VR::OB, VM(1, 1, 1), "Signature" },
+  { 0x04000305, VR::CS, VM(1, 1, 1), "CertifiedTimestampType" },
+  { 0x04000310, VR::OB, VM(1, 1, 1), "CertifiedTimestamp" },
+  { 0x04000401, VR::SQ, VM(1, 1, 1), "DigitalSignaturePurposeCodeSequence" },
+  { 0x04000402, VR::SQ, VM(1, 1, 1), "ReferencedDigitalSignatureSequence" },
+  { 0x04000403, VR::SQ, VM(1, 1, 1), "ReferencedSOPInstanceMACSequence" },
+  { 0x04000404, VR::OB, VM(1, 1, 1), "MAC" },
+  { 0x04000500, VR::SQ, VM(1, 1, 1), "EncryptedAttributesSequence" },
+  { 0x04000510, VR::UI, VM(1, 1, 1), "EncryptedContentTransferSyntaxUID" },
+  { 0x04000520, VR::OB, VM(1, 1, 1), "EncryptedContent" },
+  { 0x04000550, VR::SQ, VM(1, 1, 1), "ModifiedAttributesSequence" },
+  { 0x04000561, VR::SQ, VM(1, 1, 1), "OriginalAttributesSequence" },
+  { 0x04000562, VR::DT, VM(1, 1, 1), "AttributeModificationDateTime" },
+  { 0x04000563, VR::LO, VM(1, 1, 1), "ModifyingSystem" },
+  { 0x04000564, VR::LO, VM(1, 1, 1), "SourceOfPreviousValues" },
+  { 0x04000565, VR::CS, VM(1, 1, 1), "ReasonForTheAttributeModification" },
+  { 0x20000010, VR::IS, VM(1, 1, 1), "NumberOfCopies" },
+  { 0x2000001E, VR::SQ, VM(1, 1, 1), "PrinterConfigurationSequence" },
+  { 0x20000020, VR::CS, VM(1, 1, 1), "PrintPriority" },
+  { 0x20000030, VR::CS, VM(1, 1, 1), "MediumType" },
+  { 0x20000040, VR::CS, VM(1, 1, 1), "FilmDestination" },
+  { 0x20000050, VR::LO, VM(1, 1, 1), "FilmSessionLabel" },
+  { 0x20000060, VR::IS, VM(1, 1, 1), "MemoryAllocation" },
+  { 0x20000061, VR::IS, VM(1, 1, 1), "MaximumMemoryAllocation" },
+  { 0x200000A0, VR::US, VM(1, 1, 1), "MemoryBitDepth" },
+  { 0x200000A1, VR::US, VM(1, 1, 1), "PrintingBitDepth" },
+  { 0x200000A2, VR::SQ, VM(1, 1, 1), "MediaInstalledSequence" },
+  { 0x200000A4, VR::SQ, VM(1, 1, 1), "OtherMediaAvailableSequence" },
+  { 0x200000A8, VR::SQ, VM(1, 1, 1), "SupportedImageDisplayFormatsSequence" },
+  { 0x20000500, VR::SQ, VM(1, 1, 1), "ReferencedFilmBoxSequence" },
+  { 0x20100010, VR::ST, VM(1, 1, 1), "ImageDisplayFormat" },
+  { 0x20100030, VR::CS, VM(1, 1, 1), "AnnotationDisplayFormatID" },
+  { 0x20100040, VR::CS, VM(1, 1, 1), "FilmOrientation" },
+  { 0x20100050, VR::CS, VM(1, 1, 1), "FilmSizeID" },
+  { 0x20100052, VR::CS, VM(1, 1, 1), "PrinterResolutionID" },
+  { 0x20100054, VR::CS, VM(1, 1, 1), "DefaultPrinterResolutionID" },
+  { 0x20100060, VR::CS, VM(1, 1, 1), "MagnificationType" },
+  { 0x20100080, VR::CS, VM(1, 1, 1), "SmoothingType" },
+  { 0x201000A6, VR::CS, VM(1, 1, 1), "DefaultMagnificationType" },
+  { 0x201000A7, VR::CS, VM(1, VM::N, 1), "OtherMagnificationTypesAvailable" },
+  { 0x201000A8, VR::CS, VM(1, 1, 1), "DefaultSmoothingType" },
+  { 0x201000A9, VR::CS, VM(1, VM::N, 1), "OtherSmoothingTypesAvailable" },
+  { 0x20100100, VR::CS, VM(1, 1, 1), "BorderDensity" },
+  { 0x20100110, VR::CS, VM(1, 1, 1), "EmptyImageDensity" },
+  { 0x20100120, VR::US, VM(1, 1, 1), "MinDensity" },
+  { 0x20100130, VR::US, VM(1, 1, 1), "MaxDensity" },
+  { 0x20100140, VR::CS, VM(1, 1, 1), "Trim" },
+  { 0x20100150, VR::ST, VM(1, 1, 1), "ConfigurationInformation" },
+  { 0x20100152, VR::LT, VM(1, 1, 1), "ConfigurationInformationDescription" },
+  { 0x20100154, VR::IS, VM(1, 1, 1), "MaximumCollatedFilms" },
+  { 0x2010015E, VR::US, VM(1, 1, 1), "Illumination" },
+  { 0x20100160, VR::US, VM(1, 1, 1), "ReflectedAmbientLight" },
+  { 0x20100376, VR::DS, VM(2, 2, 1), "PrinterPixelSpacing" },
+  { 0x20100500, VR::SQ, VM(1, 1, 1), "ReferencedFilmSessionSequence" },
+  { 0x20100510, VR::SQ, VM(1, 1, 1), "ReferencedImageBoxSequence" },
+  { 0x20100520, VR::SQ, VM(1, 1, 1), "ReferencedBasicAnnotationBoxSequence" },
+  { 0x20200010, VR::US, VM(1, 1, 1), "ImageBoxPosition" },
+  { 0x20200020, VR::CS, VM(1, 1, 1), "Polarity" },
+  { 0x20200030, VR::DS, VM(1, 1, 1), "RequestedImageSize" },
+  { 0x20200040, VR::CS, VM(1, 1, 1), "RequestedDecimateCropBehavior" },
+  { 0x20200050, VR::CS, VM(1, 1, 1), "RequestedResolutionID" },
+  { 0x202000A0, VR::CS, VM(1, 1, 1), "RequestedImageSizeFlag" },
+  { 0x202000A2, VR::CS, VM(1, 1, 1), "DecimateCropResult" },
+  { 0x20200110, VR::SQ, VM(1, 1, 1), "BasicGrayscaleImageSequence" },
+  { 0x20200111, VR::SQ, VM(1, 1, 1), "BasicColorImageSequence" },
+  { 0x20300010, VR::US, VM(1, 1, 1), "AnnotationPosition" },
+  { 0x20300020, VR::LO, VM(1, 1, 1), "TextString" },
+  { 0x20500010, VR::SQ, VM(1, 1, 1), "PresentationLUTSequence" },
+  { 0x20500020, VR::CS, VM(1, 1, 1), "PresentationLUTShape" },
+  { 0x20500500, VR::SQ, VM(1, 1, 1), "ReferencedPresentationLUTSequence" },
+  { 0x21000020, VR::CS, VM(1, 1, 1), "ExecutionStatus" },
+  { 0x21000030, VR::CS, VM(1, 1, 1), "ExecutionStatusInfo" },
+  { 0x21000040, VR::DA, VM(1, 1, 1), "CreationDate" },
+  { 0x21000050, VR::TM, VM(1, 1, 1), "CreationTime" },
+  { 0x21000070, VR::AE, VM(1, 1, 1), "Originator" },
+  { 0x21000140, VR::AE, VM(1, 1, 1), "DestinationAE" },
+  { 0x21000160, VR::SH, VM(1, 1, 1), "OwnerID" },
+  { 0x21000170, VR::IS, VM(1, 1, 1), "NumberOfFilms" },
+  { 0x21100010, VR::CS, VM(1, 1, 1), "PrinterStatus" },
+  { 0x21100020, VR::CS, VM(1, 1, 1), "PrinterStatusInfo" },
+  { 0x21100030, VR::LO, VM(1, 1, 1), "PrinterName" },
+  { 0x22000001, VR::CS, VM(1, 1, 1), "LabelUsingInformationExtractedFromInstances" },
+  { 0x22000002, VR::UT, VM(1, 1, 1), "LabelText" },
+  { 0x22000003, VR::CS, VM(1, 1, 1), "LabelStyleSelection" },
+  { 0x22000004, VR::LT, VM(1, 1, 1), "MediaDisposition" },
+  { 0x22000005, VR::LT, VM(1, 1, 1), "BarcodeValue" },
+  { 0x22000006, VR::CS, VM(1, 1, 1), "BarcodeSymbology" },
+  { 0x22000007, VR::CS, VM(1, 1, 1), "AllowMediaSplitting" },
+  { 0x22000008, VR::CS, VM(1, 1, 1), "IncludeNonDICOMObjects" },
+  { 0x22000009, VR::CS, VM(1, 1, 1), "IncludeDisplayApplication" },
+  { 0x2200000A, VR::CS, VM(1, 1, 1), "PreserveCompositeInstancesAfterMediaCreation" },
+  { 0x2200000B, VR::US, VM(1, 1, 1), "TotalNumberOfPiecesOfMediaCreated" },
+  { 0x2200000C, VR::LO, VM(1, 1, 1), "RequestedMediaApplicationProfile" },
+  { 0x2200000D, VR::SQ, VM(1, 1, 1), "ReferencedStorageMediaSequence" },
+  { 0x2200000E, VR::AT, VM(1, VM::N, 1), "FailureAttributes" },
+  { 0x2200000F, VR::CS, VM(1, 1, 1), "AllowLossyCompression" },
+  { 0x22000020, VR::CS, VM(1, 1, 1), "RequestPriority" },
+  { 0x30020002, VR::SH, VM(1, 1, 1), "RTImageLabel" },
+  { 0x30020003, VR::LO, VM(1, 1, 1), "RTImageName" },
+  { 0x30020004, VR::ST, VM(1, 1, 1), "RTImageDescription" },
+  { 0x3002000A, VR::CS, VM(1, 1, 1), "ReportedValuesOrigin" },
+  { 0x3002000C, VR::CS, VM(1, 1, 1), "RTImagePlane" },
+  { 0x3002000D, VR::DS, VM(3, 3, 1), "XRayImageReceptorTranslation" },
+  { 0x3002000E, VR::DS, VM(1, 1, 1), "XRayImageReceptorAngle" },
+  { 0x30020010, VR::DS, VM(6, 6, 1), "RTImageOrientation" },
+  { 0x30020011, VR::DS, VM(2, 2, 1), "ImagePlanePixelSpacing" },
+  { 0x30020012, VR::DS, VM(2, 2, 1), "RTImagePosition" },
+  { 0x30020020, VR::SH, VM(1, 1, 1), "RadiationMachineName" },
+  { 0x30020022, VR::DS, VM(1, 1, 1), "RadiationMachineSAD" },
+  { 0x30020024, VR::DS, VM(1, 1, 1), "RadiationMachineSSD" },
+  { 0x30020026, VR::DS, VM(1, 1, 1), "RTImageSID" },
+  { 0x30020028, VR::DS, VM(1, 1, 1), "SourceToReferenceObjectDistance" },
+  { 0x30020029, VR::IS, VM(1, 1, 1), "FractionNumber" },
+  { 0x30020030, VR::SQ, VM(1, 1, 1), "ExposureSequence" },
+  { 0x30020032, VR::DS, VM(1, 1, 1), "MetersetExposure" },
+  { 0x30020034, VR::DS, VM(4, 4, 1), "DiaphragmPosition" },
+  { 0x30020040, VR::SQ, VM(1, 1, 1), "FluenceMapSequence" },
+  { 0x30020041, VR::CS, VM(1, 1, 1), "FluenceDataSource" },
+  { 0x30020042, VR::DS, VM(1, 1, 1), "FluenceDataScale" },
+  { 0x30020050, VR::SQ, VM(1, 1, 1), "PrimaryFluenceModeSequence" },
+  { 0x30020051, VR::CS, VM(1, 1, 1), "FluenceMode" },
+  { 0x30020052, VR::SH, VM(1, 1, 1), "FluenceModeID" },
+  { 0x30040001, VR::CS, VM(1, 1, 1), "DVHType" },
+  { 0x30040002, VR::CS, VM(1, 1, 1), "DoseUnits" },
+  { 0x30040004, VR::CS, VM(1, 1, 1), "DoseType" },
+  { 0x30040005, VR::CS, VM(1, 1, 1), "SpatialTransformOfDose" },
+  { 0x30040006, VR::LO, VM(1, 1, 1), "DoseComment" },
+  { 0x30040008, VR::DS, VM(3, 3, 1), "NormalizationPoint" },
+  { 0x3004000A, VR::CS, VM(1, 1, 1), "DoseSummationType" },
+  { 0x3004000C, VR::DS, VM(2, VM::N, 1), "GridFrameOffsetVector" },
+  { 0x3004000E, VR::DS, VM(1, 1, 1), "DoseGridScaling" },
+  { 0x30040010, VR::SQ, VM(1, 1, 1), "RTDoseROISequence" },
+  { 0x30040012, VR::DS, VM(1, 1, 1), "DoseValue" },
+  { 0x30040014, VR::CS, VM(1, 3, 1), "TissueHeterogeneityCorrection" },
+  { 0x30040040, VR::DS, VM(3, 3, 1), "DVHNormalizationPoint" },
+  { 0x30040042, VR::DS, VM(1, 1, 1), "DVHNormalizationDoseValue" },
+  { 0x30040050, VR::SQ, VM(1, 1, 1), "DVHSequence" },
+  { 0x30040052, VR::DS, VM(1, 1, 1), "DVHDoseScaling" },
+  { 0x30040054, VR::CS, VM(1, 1, 1), "DVHVolumeUnits" },
+  { 0x30040056, VR::IS, VM(1, 1, 1), "DVHNumberOfBins" },
+  { 0x30040058, VR::DS, VM(1, VM::N, 2), "DVHData" },
+  { 0x30040060, VR::SQ, VM(1, 1, 1), "DVHReferencedROISequence" },
+  { 0x30040062, VR::CS, VM(1, 1, 1), "DVHROIContributionType" },
+  { 0x30040070, VR::DS, VM(1, 1, 1), "DVHMinimumDose" },
+  { 0x30040072, VR::DS, VM(1, 1, 1), "DVHMaximumDose" },
+  { 0x30040074, VR::DS, VM(1, 1, 1), "DVHMeanDose" },
+  { 0x30060002, VR::SH, VM(1, 1, 1), "StructureSetLabel" },
+  { 0x30060004, VR::LO, VM(1, 1, 1), "StructureSetName" },
+  { 0x30060006, VR::ST, VM(1, 1, 1), "StructureSetDescription" },
+  { 0x30060008, VR::DA, VM(1, 1, 1), "StructureSetDate" },
+  { 0x30060009, VR::TM, VM(1, 1, 1), "StructureSetTime" },
+  { 0x30060010, VR::SQ, VM(1, 1, 1), "ReferencedFrameOfReferenceSequence" },
+  { 0x30060012, VR::SQ, VM(1, 1, 1), "RTReferencedStudySequence" },
+  { 0x30060014, VR::SQ, VM(1, 1, 1), "RTReferencedSeriesSequence" },
+  { 0x30060016, VR::SQ, VM(1, 1, 1), "ContourImageSequence" },
+  { 0x30060018, VR::SQ, VM(1, 1, 1), "PredecessorStructureSetSequence" },
+  { 0x30060020, VR::SQ, VM(1, 1, 1), "StructureSetROISequence" },
+  { 0x30060022, VR::IS, VM(1, 1, 1), "ROINumber" },
+  { 0x30060024, VR::UI, VM(1, 1, 1), "ReferencedFrameOfReferenceUID" },
+  { 0x30060026, VR::LO, VM(1, 1, 1), "ROIName" },
+  { 0x30060028, VR::ST, VM(1, 1, 1), "ROIDescription" },
+  { 0x3006002A, VR::IS, VM(3, 3, 1), "ROIDisplayColor" },
+  { 0x3006002C, VR::DS, VM(1, 1, 1), "ROIVolume" },
+  { 0x30060030, VR::SQ, VM(1, 1, 1), "RTRelatedROISequence" },
+  { 0x30060033, VR::CS, VM(1, 1, 1), "RTROIRelationship" },
+  { 0x30060036, VR::CS, VM(1, 1, 1), "ROIGenerationAlgorithm" },
+  { 0x30060038, VR::LO, VM(1, 1, 1), "ROIGenerationDescription" },
+  { 0x30060039, VR::SQ, VM(1, 1, 1), "ROIContourSequence" },
+  { 0x30060040, VR::SQ, VM(1, 1, 1), "ContourSequence" },
+  { 0x30060042, VR::CS, VM(1, 1, 1), "ContourGeometricType" },
+  { 0x30060044, VR::DS, VM(1, 1, 1), "ContourSlabThickness" },
+  { 0x30060045, VR::DS, VM(3, 3, 1), "ContourOffsetVector" },
+  { 0x30060046, VR::IS, VM(1, 1, 1), "NumberOfContourPoints" },
+  { 0x30060048, VR::IS, VM(1, 1, 1), "ContourNumber" },
+  { 0x30060049, VR::IS, VM(1, VM::N, 1), "AttachedContours" },
+  { 0x30060050, VR::DS, VM(1, VM::N, 3), "ContourData" },
+  { 0x30060080, VR::SQ, VM(1, 1, 1), "RTROIObservationsSequence" },
+  { 0x30060082, VR::IS, VM(1, 1, 1), "ObservationNumber" },
+  { 0x30060084, VR::IS, VM(1, 1, 1), "ReferencedROINumber" },
+  { 0x30060085, VR::SH, VM(1, 1, 1), "ROIObservationLabel" },
+  { 0x30060086, VR::SQ, VM(1, 1, 1), "RTROIIdentificationCodeSequence" },
+  { 0x30060088, VR::ST, VM(1, 1, 1), "ROIObservationDescription" },
+  { 0x300600A0, VR::SQ, VM(1, 1, 1), "RelatedRTROIObservationsSequence" },
+  { 0x300600A4, VR::CS, VM(1, 1, 1), "RTROIInterpretedType" },
+  { 0x300600A6, VR::PN, VM(1, 1, 1), "ROIInterpreter" },
+  { 0x300600B0, VR::SQ, VM(1, 1, 1), "ROIPhysicalPropertiesSequence" },
+  { 0x300600B2, VR::CS, VM(1, 1, 1), "ROIPhysicalProperty" },
+  { 0x300600B4, VR::DS, VM(1, 1, 1), "ROIPhysicalPropertyValue" },
+  { 0x300600B6, VR::SQ, VM(1, 1, 1), "ROIElementalCompositionSequence" },
+  { 0x300600B7, VR::US, VM(1, 1, 1), "ROIElementalCompositionAtomicNumber" },
+  { 0x300600B8, VR::FL, VM(1, 1, 1), "ROIElementalCompositionAtomicMassFraction" },
+  { 0x300600B9, VR::SQ, VM(1, 1, 1), "AdditionalRTROIIdentificationCodeSequence" },
+  { 0x300600C6, VR::DS, VM(16, 16, 1), "FrameOfReferenceTransformationMatrix" },
+  { 0x300600C8, VR::LO, VM(1, 1, 1), "FrameOfReferenceTransformationComment" },
+  { 0x30080010, VR::SQ, VM(1, 1, 1), "MeasuredDoseReferenceSequence" },
+  { 0x30080012, VR::ST, VM(1, 1, 1), "MeasuredDoseDescription" },
+  { 0x30080014, VR::CS, VM(1, 1, 1), "MeasuredDoseType" },
+  { 0x30080016, VR::DS, VM(1, 1, 1), "MeasuredDoseValue" },
+  { 0x30080020, VR::SQ, VM(1, 1, 1), "TreatmentSessionBeamSequence" },
+  { 0x30080021, VR::SQ, VM(1, 1, 1), "TreatmentSessionIonBeamSequence" },
+  { 0x30080022, VR::IS, VM(1, 1, 1), "CurrentFractionNumber" },
+  { 0x30080024, VR::DA, VM(1, 1, 1), "TreatmentControlPointDate" },
+  { 0x30080025, VR::TM, VM(1, 1, 1), "TreatmentControlPointTime" },
+  { 0x3008002A, VR::CS, VM(1, 1, 1), "TreatmentTerminationStatus" },
+  { 0x3008002B, VR::SH, VM(1, 1, 1), "TreatmentTerminationCode" },
+  { 0x3008002C, VR::CS, VM(1, 1, 1), "TreatmentVerificationStatus" },
+  { 0x30080030, VR::SQ, VM(1, 1, 1), "ReferencedTreatmentRecordSequence" },
+  { 0x30080032, VR::DS, VM(1, 1, 1), "SpecifiedPrimaryMeterset" },
+  { 0x30080033, VR::DS, VM(1, 1, 1), "SpecifiedSecondaryMeterset" },
+  { 0x30080036, VR::DS, VM(1, 1, 1), "DeliveredPrimaryMeterset" },
+  { 0x30080037, VR::DS, VM(1, 1, 1), "DeliveredSecondaryMeterset" },
+  { 0x3008003A, VR::DS, VM(1, 1, 1), "SpecifiedTreatmentTime" },
+  { 0x3008003B, VR::DS, VM(1, 1, 1), "DeliveredTreatmentTime" },
+  { 0x30080040, VR::SQ, VM(1, 1, 1), "ControlPointDeliverySequence" },
+  { 0x30080041, VR::SQ, VM(1, 1, 1), "IonControlPointDeliverySequence" },
+  { 0x30080042, VR::DS, VM(1, 1, 1), "SpecifiedMeterset" },
+  { 0x30080044, VR::DS, VM(1, 1, 1), "DeliveredMeterset" },
+  { 0x30080045, VR::FL, VM(1, 1, 1), "MetersetRateSet" },
+  { 0x30080046, VR::FL, VM(1, 1, 1), "MetersetRateDelivered" },
+  { 0x30080047, VR::FL, VM(1, VM::N, 1), "ScanSpotMetersetsDelivered" },
+  { 0x30080048, VR::DS, VM(1, 1, 1), "DoseRateDelivered" },
+  { 0x30080050, VR::SQ, VM(1, 1, 1), "TreatmentSummaryCalculatedDoseReferenceSequence" },
+  { 0x30080052, VR::DS, VM(1, 1, 1), "CumulativeDoseToDoseReference" },
+  { 0x30080054, VR::DA, VM(1, 1, 1), "FirstTreatmentDate" },
+  { 0x30080056, VR::DA, VM(1, 1, 1), "MostRecentTreatmentDate" },
+  { 0x3008005A, VR::IS, VM(1, 1, 1), "NumberOfFractionsDelivered" },
+  { 0x30080060, VR::SQ, VM(1, 1, 1), "OverrideSequence" },
+  { 0x30080061, VR::AT, VM(1, 1, 1), "ParameterSequencePointer" },
+  { 0x30080062, VR::AT, VM(1, 1, 1), "OverrideParameterPointer" },
+  { 0x30080063, VR::IS, VM(1, 1, 1), "ParameterItemIndex" },
+  { 0x30080064, VR::IS, VM(1, 1, 1), "MeasuredDoseReferenceNumber" },
+  { 0x30080065, VR::AT, VM(1, 1, 1), "ParameterPointer" },
+  { 0x30080066, VR::ST, VM(1, 1, 1), "OverrideReason" },
+  { 0x30080068, VR::SQ, VM(1, 1, 1), "CorrectedParameterSequence" },
+  { 0x3008006A, VR::FL, VM(1, 1, 1), "CorrectionValue" },
+  { 0x30080070, VR::SQ, VM(1, 1, 1), "CalculatedDoseReferenceSequence" },
+  { 0x30080072, VR::IS, VM(1, 1, 1), "CalculatedDoseReferenceNumber" },
+  { 0x30080074, VR::ST, VM(1, 1, 1), "CalculatedDoseReferenceDescription" },
+  { 0x30080076, VR::DS, VM(1, 1, 1), "CalculatedDoseReferenceDoseValue" },
+  { 0x30080078, VR::DS, VM(1, 1, 1), "StartMeterset" },
+  { 0x3008007A, VR::DS, VM(1, 1, 1), "EndMeterset" },
+  { 0x30080080, VR::SQ, VM(1, 1, 1), "ReferencedMeasuredDoseReferenceSequence" },
+  { 0x30080082, VR::IS, VM(1, 1, 1), "ReferencedMeasuredDoseReferenceNumber" },
+  { 0x30080090, VR::SQ, VM(1, 1, 1), "ReferencedCalculatedDoseReferenceSequence" },
+  { 0x30080092, VR::IS, VM(1, 1, 1), "ReferencedCalculatedDoseReferenceNumber" },
+  { 0x300800A0, VR::SQ, VM(1, 1, 1), "BeamLimitingDeviceLeafPairsSequence" },
+  { 0x300800B0, VR::SQ, VM(1, 1, 1), "RecordedWedgeSequence" },
+  { 0x300800C0, VR::SQ, VM(1, 1, 1), "RecordedCompensatorSequence" },
+  { 0x300800D0, VR::SQ, VM(1, 1, 1), "RecordedBlockSequence" },
+  { 0x300800E0, VR::SQ, VM(1, 1, 1), "TreatmentSummaryMeasuredDoseReferenceSequence" },
+  { 0x300800F0, VR::SQ, VM(1, 1, 1), "RecordedSnoutSequence" },
+  { 0x300800F2, VR::SQ, VM(1, 1, 1), "RecordedRangeShifterSequence" },
+  { 0x300800F4, VR::SQ, VM(1, 1, 1), "RecordedLateralSpreadingDeviceSequence" },
+  { 0x300800F6, VR::SQ, VM(1, 1, 1), "RecordedRangeModulatorSequence" },
+  { 0x30080100, VR::SQ, VM(1, 1, 1), "RecordedSourceSequence" },
+  { 0x30080105, VR::LO, VM(1, 1, 1), "SourceSerialNumber" },
+  { 0x30080110, VR::SQ, VM(1, 1, 1), "TreatmentSessionApplicationSetupSequence" },
+  { 0x30080116, VR::CS, VM(1, 1, 1), "ApplicationSetupCheck" },
+  { 0x30080120, VR::SQ, VM(1, 1, 1), "RecordedBrachyAccessoryDeviceSequence" },
+  { 0x30080122, VR::IS, VM(1, 1, 1), "ReferencedBrachyAccessoryDeviceNumber" },
+  { 0x30080130, VR::SQ, VM(1, 1, 1), "RecordedChannelSequence" },
+  { 0x30080132, VR::DS, VM(1, 1, 1), "SpecifiedChannelTotalTime" },
+  { 0x30080134, VR::DS, VM(1, 1, 1), "DeliveredChannelTotalTime" },
+  { 0x30080136, VR::IS, VM(1, 1, 1), "SpecifiedNumberOfPulses" },
+  { 0x30080138, VR::IS, VM(1, 1, 1), "DeliveredNumberOfPulses" },
+  { 0x3008013A, VR::DS, VM(1, 1, 1), "SpecifiedPulseRepetitionInterval" },
+  { 0x3008013C, VR::DS, VM(1, 1, 1), "DeliveredPulseRepetitionInterval" },
+  { 0x30080140, VR::SQ, VM(1, 1, 1), "RecordedSourceApplicatorSequence" },
+  { 0x30080142, VR::IS, VM(1, 1, 1), "ReferencedSourceApplicatorNumber" },
+  { 0x30080150, VR::SQ, VM(1, 1, 1), "RecordedChannelShieldSequence" },
+  { 0x30080152, VR::IS, VM(1, 1, 1), "ReferencedChannelShieldNumber" },
+  { 0x30080160, VR::SQ, VM(1, 1, 1), "BrachyControlPointDeliveredSequence" },
+  { 0x30080162, VR::DA, VM(1, 1, 1), "SafePositionExitDate" },
+  { 0x30080164, VR::TM, VM(1, 1, 1), "SafePositionExitTime" },
+  { 0x30080166, VR::DA, VM(1, 1, 1), "SafePositionReturnDate" },
+  { 0x30080168, VR::TM, VM(1, 1, 1), "SafePositionReturnTime" },
+  { 0x30080171, VR::SQ, VM(1, 1, 1), "PulseSpecificBrachyControlPointDeliveredSequence" },
+  { 0x30080172, VR::US, VM(1, 1, 1), "PulseNumber" },
+  { 0x30080173, VR::SQ, VM(1, 1, 1), "BrachyPulseControlPointDeliveredSequence" },
+  { 0x30080200, VR::CS, VM(1, 1, 1), "CurrentTreatmentStatus" },
+  { 0x30080202, VR::ST, VM(1, 1, 1), "TreatmentStatusComment" },
+  { 0x30080220, VR::SQ, VM(1, 1, 1), "FractionGroupSummarySequence" },
+  { 0x30080223, VR::IS, VM(1, 1, 1), "ReferencedFractionNumber" },
+  { 0x30080224, VR::CS, VM(1, 1, 1), "FractionGroupType" },
+  { 0x30080230, VR::CS, VM(1, 1, 1), "BeamStopperPosition" },
+  { 0x30080240, VR::SQ, VM(1, 1, 1), "FractionStatusSummarySequence" },
+  { 0x30080250, VR::DA, VM(1, 1, 1), "TreatmentDate" },
+  { 0x30080251, VR::TM, VM(1, 1, 1), "TreatmentTime" },
+  { 0x300A0002, VR::SH, VM(1, 1, 1), "RTPlanLabel" },
+  { 0x300A0003, VR::LO, VM(1, 1, 1), "RTPlanName" },
+  { 0x300A0004, VR::ST, VM(1, 1, 1), "RTPlanDescription" },
+  { 0x300A0006, VR::DA, VM(1, 1, 1), "RTPlanDate" },
+  { 0x300A0007, VR::TM, VM(1, 1, 1), "RTPlanTime" },
+  { 0x300A0009, VR::LO, VM(1, VM::N, 1), "TreatmentProtocols" },
+  { 0x300A000A, VR::CS, VM(1, 1, 1), "PlanIntent" },
+  { 0x300A000B, VR::LO, VM(1, VM::N, 1), "TreatmentSites" },
+  { 0x300A000C, VR::CS, VM(1, 1, 1), "RTPlanGeometry" },
+  { 0x300A000E, VR::ST, VM(1, 1, 1), "PrescriptionDescription" },
+  { 0x300A0010, VR::SQ, VM(1, 1, 1), "DoseReferenceSequence" },
+  { 0x300A0012, VR::IS, VM(1, 1, 1), "DoseReferenceNumber" },
+  { 0x300A0013, VR::UI, VM(1, 1, 1), "DoseReferenceUID" },
+  { 0x300A0014, VR::CS, VM(1, 1, 1), "DoseReferenceStructureType" },
+  { 0x300A0015, VR::CS, VM(1, 1, 1), "NominalBeamEnergyUnit" },
+  { 0x300A0016, VR::LO, VM(1, 1, 1), "DoseReferenceDescription" },
+  { 0x300A0018, VR::DS, VM(3, 3, 1), "DoseReferencePointCoordinates" },
+  { 0x300A001A, VR::DS, VM(1, 1, 1), "NominalPriorDose" },
+  { 0x300A0020, VR::CS, VM(1, 1, 1), "DoseReferenceType" },
+  { 0x300A0021, VR::DS, VM(1, 1, 1), "ConstraintWeight" },
+  { 0x300A0022, VR::DS, VM(1, 1, 1), "DeliveryWarningDose" },
+  { 0x300A0023, VR::DS, VM(1, 1, 1), "DeliveryMaximumDose" },
+  { 0x300A0025, VR::DS, VM(1, 1, 1), "TargetMinimumDose" },
+  { 0x300A0026, VR::DS, VM(1, 1, 1), "TargetPrescriptionDose" },
+  { 0x300A0027, VR::DS, VM(1, 1, 1), "TargetMaximumDose" },
+  { 0x300A0028, VR::DS, VM(1, 1, 1), "TargetUnderdoseVolumeFraction" },
+  { 0x300A002A, VR::DS, VM(1, 1, 1), "OrganAtRiskFullVolumeDose" },
+  { 0x300A002B, VR::DS, VM(1, 1, 1), "OrganAtRiskLimitDose" },
+  { 0x300A002C, VR::DS, VM(1, 1, 1), "OrganAtRiskMaximumDose" },
+  { 0x300A002D, VR::DS, VM(1, 1, 1), "OrganAtRiskOverdoseVolumeFraction" },
+  { 0x300A0040, VR::SQ, VM(1, 1, 1), "ToleranceTableSequence" },
+  { 0x300A0042, VR::IS, VM(1, 1, 1), "ToleranceTableNumber" },
+  { 0x300A0043, VR::SH, VM(1, 1, 1), "ToleranceTableLabel" },
+  { 0x300A0044, VR::DS, VM(1, 1, 1), "GantryAngleTolerance" },
+  { 0x300A0046, VR::DS, VM(1, 1, 1), "BeamLimitingDeviceAngleTolerance" },
+  { 0x300A0048, VR::SQ, VM(1, 1, 1), "BeamLimitingDeviceToleranceSequence" },
+  { 0x300A004A, VR::DS, VM(1, 1, 1), "BeamLimitingDevicePositionTolerance" },
+  { 0x300A004B, VR::FL, VM(1, 1, 1), "SnoutPositionTolerance" },
+  { 0x300A004C, VR::DS, VM(1, 1, 1), "PatientSupportAngleTolerance" },
+  { 0x300A004E, VR::DS, VM(1, 1, 1), "TableTopEccentricAngleTolerance" },
+  { 0x300A004F, VR::FL, VM(1, 1, 1), "TableTopPitchAngleTolerance" },
+  { 0x300A0050, VR::FL, VM(1, 1, 1), "TableTopRollAngleTolerance" },
+  { 0x300A0051, VR::DS, VM(1, 1, 1), "TableTopVerticalPositionTolerance" },
+  { 0x300A0052, VR::DS, VM(1, 1, 1), "TableTopLongitudinalPositionTolerance" },
+  { 0x300A0053, VR::DS, VM(1, 1, 1), "TableTopLateralPositionTolerance" },
+  { 0x300A0055, VR::CS, VM(1, 1, 1), "RTPlanRelationship" },
+  { 0x300A0070, VR::SQ, VM(1, 1, 1), "FractionGroupSequence" },
+  { 0x300A0071, VR::IS, VM(1, 1, 1), "FractionGroupNumber" },
+  { 0x300A0072, VR::LO, VM(1, 1, 1), "FractionGroupDescription" },
+  { 0x300A0078, VR::IS, VM(1, 1, 1), "NumberOfFractionsPlanned" },
+  { 0x300A0079, VR::IS, VM(1, 1, 1), "NumberOfFractionPatternDigitsPerDay" },
+  { 0x300A007A, VR::IS, VM(1, 1, 1), "RepeatFractionCycleLength" },
+  { 0x300A007B, VR::LT, VM(1, 1, 1), "FractionPattern" },
+  { 0x300A0080, VR::IS, VM(1, 1, 1), "NumberOfBeams" },
+  { 0x300A0082, VR::DS, VM(3, 3, 1), "BeamDoseSpecificationPoint" },
+  { 0x300A0084, VR::DS, VM(1, 1, 1), "BeamDose" },
+  { 0x300A0086, VR::DS, VM(1, 1, 1), "BeamMeterset" },
+  { 0x300A008B, VR::CS, VM(1, 1, 1), "BeamDoseMeaning" },
+  { 0x300A008C, VR::SQ, VM(1, 1, 1), "BeamDoseVerificationControlPointSequence" },
+  { 0x300A008D, VR::FL, VM(1, 1, 1), "AverageBeamDosePointDepth" },
+  { 0x300A008E, VR::FL, VM(1, 1, 1), "AverageBeamDosePointEquivalentDepth" },
+  { 0x300A008F, VR::FL, VM(1, 1, 1), "AverageBeamDosePointSSD" },
+  { 0x300A0090, VR::CS, VM(1, 1, 1), "BeamDoseType" },
+  { 0x300A0091, VR::DS, VM(1, 1, 1), "AlternateBeamDose" },
+  { 0x300A0092, VR::CS, VM(1, 1, 1), "AlternateBeamDoseType" },
+  { 0x300A00A0, VR::IS, VM(1, 1, 1), "NumberOfBrachyApplicationSetups" },
+  { 0x300A00A2, VR::DS, VM(3, 3, 1), "BrachyApplicationSetupDoseSpecificationPoint" },
+  { 0x300A00A4, VR::DS, VM(1, 1, 1), "BrachyApplicationSetupDose" },
+  { 0x300A00B0, VR::SQ, VM(1, 1, 1), "BeamSequence" },
+  { 0x300A00B2, VR::SH, VM(1, 1, 1), "TreatmentMachineName" },
+  { 0x300A00B3, VR::CS, VM(1, 1, 1), "PrimaryDosimeterUnit" },
+  { 0x300A00B4, VR::DS, VM(1, 1, 1), "SourceAxisDistance" },
+  { 0x300A00B6, VR::SQ, VM(1, 1, 1), "BeamLimitingDeviceSequence" },
+  { 0x300A00B8, VR::CS, VM(1, 1, 1), "RTBeamLimitingDeviceType" },
+  { 0x300A00BA, VR::DS, VM(1, 1, 1), "SourceToBeamLimitingDeviceDistance" },
+  { 0x300A00BB, VR::FL, VM(1, 1, 1), "IsocenterToBeamLimitingDeviceDistance" },
+  { 0x300A00BC, VR::IS, VM(1, 1, 1), "NumberOfLeafJawPairs" },
+  { 0x300A00BE, VR::DS, VM(3, VM::N, 1), "LeafPositionBoundaries" },
+  { 0x300A00C0, VR::IS, VM(1, 1, 1), "BeamNumber" },
+  { 0x300A00C2, VR::LO, VM(1, 1, 1), "BeamName" },
+  { 0x300A00C3, VR::ST, VM(1, 1, 1), "BeamDescription" },
+  { 0x300A00C4, VR::CS, VM(1, 1, 1), "BeamType" },
+  { 0x300A00C5, VR::FD, VM(1, 1, 1), "BeamDeliveryDurationLimit" },
+  { 0x300A00C6, VR::CS, VM(1, 1, 1), "RadiationType" },
+  { 0x300A00C7, VR::CS, VM(1, 1, 1), "HighDoseTechniqueType" },
+  { 0x300A00C8, VR::IS, VM(1, 1, 1), "ReferenceImageNumber" },
+  { 0x300A00CA, VR::SQ, VM(1, 1, 1), "PlannedVerificationImageSequence" },
+  { 0x300A00CC, VR::LO, VM(1, VM::N, 1), "ImagingDeviceSpecificAcquisitionParameters" },
+  { 0x300A00CE, VR::CS, VM(1, 1, 1), "TreatmentDeliveryType" },
+  { 0x300A00D0, VR::IS, VM(1, 1, 1), "NumberOfWedges" },
+  { 0x300A00D1, VR::SQ, VM(1, 1, 1), "WedgeSequence" },
+  { 0x300A00D2, VR::IS, VM(1, 1, 1), "WedgeNumber" },
+  { 0x300A00D3, VR::CS, VM(1, 1, 1), "WedgeType" },
+  { 0x300A00D4, VR::SH, VM(1, 1, 1), "WedgeID" },
+  { 0x300A00D5, VR::IS, VM(1, 1, 1), "WedgeAngle" },
+  { 0x300A00D6, VR::DS, VM(1, 1, 1), "WedgeFactor" },
+  { 0x300A00D7, VR::FL, VM(1, 1, 1), "TotalWedgeTrayWaterEquivalentThickness" },
+  { 0x300A00D8, VR::DS, VM(1, 1, 1), "WedgeOrientation" },
+  { 0x300A00D9, VR::FL, VM(1, 1, 1), "IsocenterToWedgeTrayDistance" },
+  { 0x300A00DA, VR::DS, VM(1, 1, 1), "SourceToWedgeTrayDistance" },
+  { 0x300A00DB, VR::FL, VM(1, 1, 1), "WedgeThinEdgePosition" },
+  { 0x300A00DC, VR::SH, VM(1, 1, 1), "BolusID" },
+  { 0x300A00DD, VR::ST, VM(1, 1, 1), "BolusDescription" },
+  { 0x300A00DE, VR::DS, VM(1, 1, 1), "EffectiveWedgeAngle" },
+  { 0x300A00E0, VR::IS, VM(1, 1, 1), "NumberOfCompensators" },
+  { 0x300A00E1, VR::SH, VM(1, 1, 1), "MaterialID" },
+  { 0x300A00E2, VR::DS, VM(1, 1, 1), "TotalCompensatorTrayFactor" },
+  { 0x300A00E3, VR::SQ, VM(1, 1, 1), "CompensatorSequence" },
+  { 0x300A00E4, VR::IS, VM(1, 1, 1), "CompensatorNumber" },
+  { 0x300A00E5, VR::SH, VM(1, 1, 1), "CompensatorID" },
+  { 0x300A00E6, VR::DS, VM(1, 1, 1), "SourceToCompensatorTrayDistance" },
+  { 0x300A00E7, VR::IS, VM(1, 1, 1), "CompensatorRows" },
+  { 0x300A00E8, VR::IS, VM(1, 1, 1), "CompensatorColumns" },
+  { 0x300A00E9, VR::DS, VM(2, 2, 1), "CompensatorPixelSpacing" },
+  { 0x300A00EA, VR::DS, VM(2, 2, 1), "CompensatorPosition" },
+  { 0x300A00EB, VR::DS, VM(1, VM::N, 1), "CompensatorTransmissionData" },
+  { 0x300A00EC, VR::DS, VM(1, VM::N, 1), "CompensatorThicknessData" },
+  { 0x300A00ED, VR::IS, VM(1, 1, 1), "NumberOfBoli" },
+  { 0x300A00EE, VR::CS, VM(1, 1, 1), "CompensatorType" },
+  { 0x300A00EF, VR::SH, VM(1, 1, 1), "CompensatorTrayID" },
+  { 0x300A00F0, VR::IS, VM(1, 1, 1), "NumberOfBlocks" },
+  { 0x300A00F2, VR::DS, VM(1, 1, 1), "TotalBlockTrayFactor" },
+  { 0x300A00F3, VR::FL, VM(1, 1, 1), "TotalBlockTrayWaterEquivalentThickness" },
+  { 0x300A00F4, VR::SQ, VM(1, 1, 1), "BlockSequence" },
+  { 0x300A00F5, VR::SH, VM(1, 1, 1), "BlockTrayID" },
+  { 0x300A00F6, VR::DS, VM(1, 1, 1), "SourceToBlockTrayDistance" },
+  { 0x300A00F7, VR::FL, VM(1, 1, 1), "IsocenterToBlockTrayDistance" },
+  { 0x300A00F8, VR::CS, VM(1, 1, 1), "BlockType" },
+  { 0x300A00F9, VR::LO, VM(1, 1, 1), "AccessoryCode" },
+  { 0x300A00FA, VR::CS, VM(1, 1, 1), "BlockDivergence" },
+  { 0x300A00FB, VR::CS, VM(1, 1, 1), "BlockMountingPosition" },
+  { 0x300A00FC, VR::IS, VM(1, 1, 1), "BlockNumber" },
+  { 0x300A00FE, VR::LO, VM(1, 1, 1), "BlockName" },
+  { 0x300A0100, VR::DS, VM(1, 1, 1), "BlockThickness" },
+  { 0x300A0102, VR::DS, VM(1, 1, 1), "BlockTransmission" },
+  { 0x300A0104, VR::IS, VM(1, 1, 1), "BlockNumberOfPoints" },
+  { 0x300A0106, VR::DS, VM(1, VM::N, 2), "BlockData" },
+  { 0x300A0107, VR::SQ, VM(1, 1, 1), "ApplicatorSequence" },
+  { 0x300A0108, VR::SH, VM(1, 1, 1), "ApplicatorID" },
+  { 0x300A0109, VR::CS, VM(1, 1, 1), "ApplicatorType" },
+  { 0x300A010A, VR::LO, VM(1, 1, 1), "ApplicatorDescription" },
+  { 0x300A010C, VR::DS, VM(1, 1, 1), "CumulativeDoseReferenceCoefficient" },
+  { 0x300A010E, VR::DS, VM(1, 1, 1), "FinalCumulativeMetersetWeight" },
+  { 0x300A0110, VR::IS, VM(1, 1, 1), "NumberOfControlPoints" },
+  { 0x300A0111, VR::SQ, VM(1, 1, 1), "ControlPointSequence" },
+  { 0x300A0112, VR::IS, VM(1, 1, 1), "ControlPointIndex" },
+  { 0x300A0114, VR::DS, VM(1, 1, 1), "NominalBeamEnergy" },
+  { 0x300A0115, VR::DS, VM(1, 1, 1), "DoseRateSet" },
+  { 0x300A0116, VR::SQ, VM(1, 1, 1), "WedgePositionSequence" },
+  { 0x300A0118, VR::CS, VM(1, 1, 1), "WedgePosition" },
+  { 0x300A011A, VR::SQ, VM(1, 1, 1), "BeamLimitingDevicePositionSequence" },
+  { 0x300A011C, VR::DS, VM(1, VM::N, 2), "LeafJawPositions" },
+  { 0x300A011E, VR::DS, VM(1, 1, 1), "GantryAngle" },
+  { 0x300A011F, VR::CS, VM(1, 1, 1), "GantryRotationDirection" },
+  { 0x300A0120, VR::DS, VM(1, 1, 1), "BeamLimitingDeviceAngle" },
+  { 0x300A0121, VR::CS, VM(1, 1, 1), "BeamLimitingDeviceRotationDirection" },
+  { 0x300A0122, VR::DS, VM(1, 1, 1), "PatientSupportAngle" },
+  { 0x300A0123, VR::CS, VM(1, 1, 1), "PatientSupportRotationDirection" },
+  { 0x300A0124, VR::DS, VM(1, 1, 1), "TableTopEccentricAxisDistance" },
+  { 0x300A0125, VR::DS, VM(1, 1, 1), "TableTopEccentricAngle" },
+  { 0x300A0126, VR::CS, VM(1, 1, 1), "TableTopEccentricRotationDirection" },
+  { 0x300A0128, VR::DS, VM(1, 1, 1), "TableTopVerticalPosition" },
+  { 0x300A0129, VR::DS, VM(1, 1, 1), "TableTopLongitudinalPosition" },
+  { 0x300A012A, VR::DS, VM(1, 1, 1), "TableTopLateralPosition" },
+  { 0x300A012C, VR::DS, VM(3, 3, 1), "IsocenterPosition" },
+  { 0x300A012E, VR::DS, VM(3, 3, 1), "SurfaceEntryPoint" },
+  { 0x300A0130, VR::DS, VM(1, 1, 1), "SourceToSurfaceDistance" },
+  { 0x300A0131, VR::FL, VM(1, 1, 1), "AverageBeamDosePointSourceToExternalContourDistance" },
+  { 0x300A0132, VR::FL, VM(1, 1, 1), "SourceToExternalContourDistance" },
+  { 0x300A0133, VR::FL, VM(3, 3, 1), "ExternalContourEntryPoint" },
+  { 0x300A0134, VR::DS, VM(1, 1, 1), "CumulativeMetersetWeight" },
+  { 0x300A0140, VR::FL, VM(1, 1, 1), "TableTopPitchAngle" },
+  { 0x300A0142, VR::CS, VM(1, 1, 1), "TableTopPitchRotationDirection" },
+  { 0x300A0144, VR::FL, VM(1, 1, 1), "TableTopRollAngle" },
+  { 0x300A0146, VR::CS, VM(1, 1, 1), "TableTopRollRotationDirection" },
+  { 0x300A0148, VR::FL, VM(1, 1, 1), "HeadFixationAngle" },
+  { 0x300A014A, VR::FL, VM(1, 1, 1), "GantryPitchAngle" },
+  { 0x300A014C, VR::CS, VM(1, 1, 1), "GantryPitchRotationDirection" },
+  { 0x300A014E, VR::FL, VM(1, 1, 1), "GantryPitchAngleTolerance" },
+  { 0x300A0180, VR::SQ, VM(1, 1, 1), "PatientSetupSequence" },
+  { 0x300A0182, VR::IS, VM(1, 1, 1), "PatientSetupNumber" },
+  { 0x300A0183, VR::LO, VM(1, 1, 1), "PatientSetupLabel" },
+  { 0x300A0184, VR::LO, VM(1, 1, 1), "PatientAdditionalPosition" },
+  { 0x300A0190, VR::SQ, VM(1, 1, 1), "FixationDeviceSequence" },
+  { 0x300A0192, VR::CS, VM(1, 1, 1), "FixationDeviceType" },
+  { 0x300A0194, VR::SH, VM(1, 1, 1), "FixationDeviceLabel" },
+  { 0x300A0196, VR::ST, VM(1, 1, 1), "FixationDeviceDescription" },
+  { 0x300A0198, VR::SH, VM(1, 1, 1), "FixationDevicePosition" },
+  { 0x300A0199, VR::FL, VM(1, 1, 1), "FixationDevicePitchAngle" },
+  { 0x300A019A, VR::FL, VM(1, 1, 1), "FixationDeviceRollAngle" },
+  { 0x300A01A0, VR::SQ, VM(1, 1, 1), "ShieldingDeviceSequence" },
+  { 0x300A01A2, VR::CS, VM(1, 1, 1), "ShieldingDeviceType" },
+  { 0x300A01A4, VR::SH, VM(1, 1, 1), "ShieldingDeviceLabel" },
+  { 0x300A01A6, VR::ST, VM(1, 1, 1), "ShieldingDeviceDescription" },
+  { 0x300A01A8, VR::SH, VM(1, 1, 1), "ShieldingDevicePosition" },
+  { 0x300A01B0, VR::CS, VM(1, 1, 1), "SetupTechnique" },
+  { 0x300A01B2, VR::ST, VM(1, 1, 1), "SetupTechniqueDescription" },
+  { 0x300A01B4, VR::SQ, VM(1, 1, 1), "SetupDeviceSequence" },
+  { 0x300A01B6, VR::CS, VM(1, 1, 1), "SetupDeviceType" },
+  { 0x300A01B8, VR::SH, VM(1, 1, 1), "SetupDeviceLabel" },
+  { 0x300A01BA, VR::ST, VM(1, 1, 1), "SetupDeviceDescription" },
+  { 0x300A01BC, VR::DS, VM(1, 1, 1), "SetupDeviceParameter" },
+  { 0x300A01D0, VR::ST, VM(1, 1, 1), "SetupReferenceDescription" },
+  { 0x300A01D2, VR::DS, VM(1, 1, 1), "TableTopVerticalSetupDisplacement" },
+  { 0x300A01D4, VR::DS, VM(1, 1, 1), "TableTopLongitudinalSetupDisplacement" },
+  { 0x300A01D6, VR::DS, VM(1, 1, 1), "TableTopLateralSetupDisplacement" },
+  { 0x300A0200, VR::CS, VM(1, 1, 1), "BrachyTreatmentTechnique" },
+  { 0x300A0202, VR::CS, VM(1, 1, 1), "BrachyTreatmentType" },
+  { 0x300A0206, VR::SQ, VM(1, 1, 1), "TreatmentMachineSequence" },
+  { 0x300A0210, VR::SQ, VM(1, 1, 1), "SourceSequence" },
+  { 0x300A0212, VR::IS, VM(1, 1, 1), "SourceNumber" },
+  { 0x300A0214, VR::CS, VM(1, 1, 1), "SourceType" },
+  { 0x300A0216, VR::LO, VM(1, 1, 1), "SourceManufacturer" },
+  { 0x300A0218, VR::DS, VM(1, 1, 1), "ActiveSourceDiameter" },
+  { 0x300A021A, VR::DS, VM(1, 1, 1), "ActiveSourceLength" },
+  { 0x300A021B, VR::SH, VM(1, 1, 1), "SourceModelID" },
+  { 0x300A021C, VR::LO, VM(1, 1, 1), "SourceDescription" },
+  { 0x300A0222, VR::DS, VM(1, 1, 1), "SourceEncapsulationNominalThickness" },
+  { 0x300A0224, VR::DS, VM(1, 1, 1), "SourceEncapsulationNominalTransmission" },
+  { 0x300A0226, VR::LO, VM(1, 1, 1), "SourceIsotopeName" },
+  { 0x300A0228, VR::DS, VM(1, 1, 1), "SourceIsotopeHalfLife" },
+  { 0x300A0229, VR::CS, VM(1, 1, 1), "SourceStrengthUnits" },
+  { 0x300A022A, VR::DS, VM(1, 1, 1), "ReferenceAirKermaRate" },
+  { 0x300A022B, VR::DS, VM(1, 1, 1), "SourceStrength" },
+  { 0x300A022C, VR::DA, VM(1, 1, 1), "SourceStrengthReferenceDate" },
+  { 0x300A022E, VR::TM, VM(1, 1, 1), "SourceStrengthReferenceTime" },
+  { 0x300A0230, VR::SQ, VM(1, 1, 1), "ApplicationSetupSequence" },
+  { 0x300A0232, VR::CS, VM(1, 1, 1), "ApplicationSetupType" },
+  { 0x300A0234, VR::IS, VM(1, 1, 1), "ApplicationSetupNumber" },
+  { 0x300A0236, VR::LO, VM(1, 1, 1), "ApplicationSetupName" },
+  { 0x300A0238, VR::LO, VM(1, 1, 1), "ApplicationSetupManufacturer" },
+  { 0x300A0240, VR::IS, VM(1, 1, 1), "TemplateNumber" },
+  { 0x300A0242, VR::SH, VM(1, 1, 1), "TemplateType" },
+  { 0x300A0244, VR::LO, VM(1, 1, 1), "TemplateName" },
+  { 0x300A0250, VR::DS, VM(1, 1, 1), "TotalReferenceAirKerma" },
+  { 0x300A0260, VR::SQ, VM(1, 1, 1), "BrachyAccessoryDeviceSequence" },
+  { 0x300A0262, VR::IS, VM(1, 1, 1), "BrachyAccessoryDeviceNumber" },
+  { 0x300A0263, VR::SH, VM(1, 1, 1), "BrachyAccessoryDeviceID" },
+  { 0x300A0264, VR::CS, VM(1, 1, 1), "BrachyAccessoryDeviceType" },
+  { 0x300A0266, VR::LO, VM(1, 1, 1), "BrachyAccessoryDeviceName" },
+  { 0x300A026A, VR::DS, VM(1, 1, 1), "BrachyAccessoryDeviceNominalThickness" },
+  { 0x300A026C, VR::DS, VM(1, 1, 1), "BrachyAccessoryDeviceNominalTransmission" },
+  { 0x300A0280, VR::SQ, VM(1, 1, 1), "ChannelSequence" },
+  { 0x300A0282, VR::IS, VM(1, 1, 1), "ChannelNumber" },
+  { 0x300A0284, VR::DS, VM(1, 1, 1), "ChannelLength" },
+  { 0x300A0286, VR::DS, VM(1, 1, 1), "ChannelTotalTime" },
+  { 0x300A0288, VR::CS, VM(1, 1, 1), "SourceMovementType" },
+  { 0x300A028A, VR::IS, VM(1, 1, 1), "NumberOfPulses" },
+  { 0x300A028C, VR::DS, VM(1, 1, 1), "PulseRepetitionInterval" },
+  { 0x300A0290, VR::IS, VM(1, 1, 1), "SourceApplicatorNumber" },
+  { 0x300A0291, VR::SH, VM(1, 1, 1), "SourceApplicatorID" },
+  { 0x300A0292, VR::CS, VM(1, 1, 1), "SourceApplicatorType" },
+  { 0x300A0294, VR::LO, VM(1, 1, 1), "SourceApplicatorName" },
+  { 0x300A0296, VR::DS, VM(1, 1, 1), "SourceApplicatorLength" },
+  { 0x300A0298, VR::LO, VM(1, 1, 1), "SourceApplicatorManufacturer" },
+  { 0x300A029C, VR::DS, VM(1, 1, 1), "SourceApplicatorWallNominalThickness" },
+  { 0x300A029E, VR::DS, VM(1, 1, 1), "SourceApplicatorWallNominalTransmission" },
+  { 0x300A02A0, VR::DS, VM(1, 1, 1), "SourceApplicatorStepSize" },
+  { 0x300A02A2, VR::IS, VM(1, 1, 1), "TransferTubeNumber" },
+  { 0x300A02A4, VR::DS, VM(1, 1, 1), "TransferTubeLength" },
+  { 0x300A02B0, VR::SQ, VM(1, 1, 1), "ChannelShieldSequence" },
+  { 0x300A02B2, VR::IS, VM(1, 1, 1), "ChannelShieldNumber" },
+  { 0x300A02B3, VR::SH, VM(1, 1, 1), "ChannelShieldID" },
+  { 0x300A02B4, VR::LO, VM(1, 1, 1), "ChannelShieldName" },
+  { 0x300A02B8, VR::DS, VM(1, 1, 1), "ChannelShieldNominalThickness" },
+  { 0x300A02BA, VR::DS, VM(1, 1, 1), "ChannelShieldNominalTransmission" },
+  { 0x300A02C8, VR::DS, VM(1, 1, 1), "FinalCumulativeTimeWeight" },
+  { 0x300A02D0, VR::SQ, VM(1, 1, 1), "BrachyControlPointSequence" },
+  { 0x300A02D2, VR::DS, VM(1, 1, 1), "ControlPointRelativePosition" },
+  { 0x300A02D4, VR::DS, VM(3, 3, 1), "ControlPoint3DPosition" },
+  { 0x300A02D6, VR::DS, VM(1, 1, 1), "CumulativeTimeWeight" },
+  { 0x300A02E0, VR::CS, VM(1, 1, 1), "CompensatorDivergence" },
+  { 0x300A02E1, VR::CS, VM(1, 1, 1), "CompensatorMountingPosition" },
+  { 0x300A02E2, VR::DS, VM(1, VM::N, 1), "SourceToCompensatorDistance" },
+  { 0x300A02E3, VR::FL, VM(1, 1, 1), "TotalCompensatorTrayWaterEquivalentThickness" },
+  { 0x300A02E4, VR::FL, VM(1, 1, 1), "IsocenterToCompensatorTrayDistance" },
+  { 0x300A02E5, VR::FL, VM(1, 1, 1), "CompensatorColumnOffset" },
+  { 0x300A02E6, VR::FL, VM(1, VM::N, 1), "IsocenterToCompensatorDistances" },
+  { 0x300A02E7, VR::FL, VM(1, 1, 1), "CompensatorRelativeStoppingPowerRatio" },
+  { 0x300A02E8, VR::FL, VM(1, 1, 1), "CompensatorMillingToolDiameter" },
+  { 0x300A02EA, VR::SQ, VM(1, 1, 1), "IonRangeCompensatorSequence" },
+  { 0x300A02EB, VR::LT, VM(1, 1, 1), "CompensatorDescription" },
+  { 0x300A0302, VR::IS, VM(1, 1, 1), "RadiationMassNumber" },
+  { 0x300A0304, VR::IS, VM(1, 1, 1), "RadiationAtomicNumber" },
+  { 0x300A0306, VR::SS, VM(1, 1, 1), "RadiationChargeState" },
+  { 0x300A0308, VR::CS, VM(1, 1, 1), "ScanMode" },
+  { 0x300A0309, VR::CS, VM(1, 1, 1), "ModulatedScanModeType" },
+  { 0x300A030A, VR::FL, VM(2, 2, 1), "VirtualSourceAxisDistances" },
+  { 0x300A030C, VR::SQ, VM(1, 1, 1), "SnoutSequence" },
+  { 0x300A030D, VR::FL, VM(1, 1, 1), "SnoutPosition" },
+  { 0x300A030F, VR::SH, VM(1, 1, 1), "SnoutID" },
+  { 0x300A0312, VR::IS, VM(1, 1, 1), "NumberOfRangeShifters" },
+  { 0x300A0314, VR::SQ, VM(1, 1, 1), "RangeShifterSequence" },
+  { 0x300A0316, VR::IS, VM(1, 1, 1), "RangeShifterNumber" },
+  { 0x300A0318, VR::SH, VM(1, 1, 1), "RangeShifterID" },
+  { 0x300A0320, VR::CS, VM(1, 1, 1), "RangeShifterType" },
+  { 0x300A0322, VR::LO, VM(1, 1, 1), "RangeShifterDescription" },
+  { 0x300A0330, VR::IS, VM(1, 1, 1), "NumberOfLateralSpreadingDevices" },
+  { 0x300A0332, VR::SQ, VM(1, 1, 1), "LateralSpreadingDeviceSequence" },
+  { 0x300A0334, VR::IS, VM(1, 1, 1), "LateralSpreadingDeviceNumber" },
+  { 0x300A0336, VR::SH, VM(1, 1, 1), "LateralSpreadingDeviceID" },
+  { 0x300A0338, VR::CS, VM(1, 1, 1), "LateralSpreadingDeviceType" },
+  { 0x300A033A, VR::LO, VM(1, 1, 1), "LateralSpreadingDeviceDescription" },
+  { 0x300A033C, VR::FL, VM(1, 1, 1), "LateralSpreadingDeviceWaterEquivalentThickness" },
+  { 0x300A0340, VR::IS, VM(1, 1, 1), "NumberOfRangeModulators" },
+  { 0x300A0342, VR::SQ, VM(1, 1, 1), "RangeModulatorSequence" },
+  { 0x300A0344, VR::IS, VM(1, 1, 1), "RangeModulatorNumber" },
+  { 0x300A0346, VR::SH, VM(1, 1, 1), "RangeModulatorID" },
+  { 0x300A0348, VR::CS, VM(1, 1, 1), "RangeModulatorType" },
+  { 0x300A034A, VR::LO, VM(1, 1, 1), "RangeModulatorDescription" },
+  { 0x300A034C, VR::SH, VM(1, 1, 1), "BeamCurrentModulationID" },
+  { 0x300A0350, VR::CS, VM(1, 1, 1), "PatientSupportType" },
+  { 0x300A0352, VR::SH, VM(1, 1, 1), "PatientSupportID" },
+  { 0x300A0354, VR::LO, VM(1, 1, 1), "PatientSupportAccessoryCode" },
+  { 0x300A0355, VR::LO, VM(1, 1, 1), "TrayAccessoryCode" },
+  { 0x300A0356, VR::FL, VM(1, 1, 1), "FixationLightAzimuthalAngle" },
+  { 0x300A0358, VR::FL, VM(1, 1, 1), "FixationLightPolarAngle" },
+  { 0x300A035A, VR::FL, VM(1, 1, 1), "MetersetRate" },
+  { 0x300A0360, VR::SQ, VM(1, 1, 1), "RangeShifterSettingsSequence" },
+  { 0x300A0362, VR::LO, VM(1, 1, 1), "RangeShifterSetting" },
+  { 0x300A0364, VR::FL, VM(1, 1, 1), "IsocenterToRangeShifterDistance" },
+  { 0x300A0366, VR::FL, VM(1, 1, 1), "RangeShifterWaterEquivalentThickness" },
+  { 0x300A0370, VR::SQ, VM(1, 1, 1), "LateralSpreadingDeviceSettingsSequence" },
+  { 0x300A0372, VR::LO, VM(1, 1, 1), "LateralSpreadingDeviceSetting" },
+  { 0x300A0374, VR::FL, VM(1, 1, 1), "IsocenterToLateralSpreadingDeviceDistance" },
+  { 0x300A0380, VR::SQ, VM(1, 1, 1), "RangeModulatorSettingsSequence" },
+  { 0x300A0382, VR::FL, VM(1, 1, 1), "RangeModulatorGatingStartValue" },
+  { 0x300A0384, VR::FL, VM(1, 1, 1), "RangeModulatorGatingStopValue" },
+  { 0x300A0386, VR::FL, VM(1, 1, 1), "RangeModulatorGatingStartWaterEquivalentThickness" },
+  { 0x300A0388, VR::FL, VM(1, 1, 1), "RangeModulatorGatingStopWaterEquivalentThickness" },
+  { 0x300A038A, VR::FL, VM(1, 1, 1), "IsocenterToRangeModulatorDistance" },
+  { 0x300A038F, VR::FL, VM(1, VM::N, 1), "ScanSpotTimeOffset" },
+  { 0x300A0390, VR::SH, VM(1, 1, 1), "ScanSpotTuneID" },
+  { 0x300A0391, VR::IS, VM(1, VM::N, 1), "ScanSpotPrescribedIndices" },
+  { 0x300A0392, VR::IS, VM(1, 1, 1), "NumberOfScanSpotPositions" },
+  { 0x300A0394, VR::FL, VM(1, VM::N, 1), "ScanSpotPositionMap" },
+  { 0x300A0396, VR::FL, VM(1, VM::N, 1), "ScanSpotMetersetWeights" },
+  { 0x300A0398, VR::FL, VM(2, 2, 1), "ScanningSpotSize" },
+  { 0x300A039A, VR::IS, VM(1, 1, 1), "NumberOfPaintings" },
+  { 0x300A03A0, VR::SQ, VM(1, 1, 1), "IonToleranceTableSequence" },
+  { 0x300A03A2, VR::SQ, VM(1, 1, 1), "IonBeamSequence" },
+  { 0x300A03A4, VR::SQ, VM(1, 1, 1), "IonBeamLimitingDeviceSequence" },
+  { 0x300A03A6, VR::SQ, VM(1, 1, 1), "IonBlockSequence" },
+  { 0x300A03A8, VR::SQ, VM(1, 1, 1), "IonControlPointSequence" },
+  { 0x300A03AA, VR::SQ, VM(1, 1, 1), "IonWedgeSequence" },
+  { 0x300A03AC, VR::SQ, VM(1, 1, 1), "IonWedgePositionSequence" },
+  { 0x300A0401, VR::SQ, VM(1, 1, 1), "ReferencedSetupImageSequence" },
+  { 0x300A0402, VR::ST, VM(1, 1, 1), "SetupImageComment" },
+  { 0x300A0410, VR::SQ, VM(1, 1, 1), "MotionSynchronizationSequence" },
+  { 0x300A0412, VR::FL, VM(3, 3, 1), "ControlPointOrientation" },
+  { 0x300A0420, VR::SQ, VM(1, 1, 1), "GeneralAccessorySequence" },
+  { 0x300A0421, VR::SH, VM(1, 1, 1), "GeneralAccessoryID" },
+  { 0x300A0422, VR::ST, VM(1, 1, 1), "GeneralAccessoryDescription" },
+  { 0x300A0423, VR::CS, VM(1, 1, 1), "GeneralAccessoryType" },
+  { 0x300A0424, VR::IS, VM(1, 1, 1), "GeneralAccessoryNumber" },
+  { 0x300A0425, VR::FL, VM(1, 1, 1), "SourceToGeneralAccessoryDistance" },
+  { 0x300A0431, VR::SQ, VM(1, 1, 1), "ApplicatorGeometrySequence" },
+  { 0x300A0432, VR::CS, VM(1, 1, 1), "ApplicatorApertureShape" },
+  { 0x300A0433, VR::FL, VM(1, 1, 1), "ApplicatorOpening" },
+  { 0x300A0434, VR::FL, VM(1, 1, 1), "ApplicatorOpeningX" },
+  { 0x300A0435, VR::FL, VM(1, 1, 1), "ApplicatorOpeningY" },
+  { 0x300A0436, VR::FL, VM(1, 1, 1), "SourceToApplicatorMountingPositionDistance" },
+  { 0x300A0440, VR::IS, VM(1, 1, 1), "NumberOfBlockSlabItems" },
+  { 0x300A0441, VR::SQ, VM(1, 1, 1), "BlockSlabSequence" },
+  { 0x300A0442, VR::DS, VM(1, 1, 1), "BlockSlabThickness" },
+  { 0x300A0443, VR::US, VM(1, 1, 1), "BlockSlabNumber" },
+  { 0x300A0450, VR::SQ, VM(1, 1, 1), "DeviceMotionControlSequence" },
+  { 0x300A0451, VR::CS, VM(1, 1, 1), "DeviceMotionExecutionMode" },
+  { 0x300A0452, VR::CS, VM(1, 1, 1), "DeviceMotionObservationMode" },
+  { 0x300A0453, VR::SQ, VM(1, 1, 1), "DeviceMotionParameterCodeSequence" },
+  { 0x300A0501, VR::FL, VM(1, 1, 1), "DistalDepthFraction" },
+  { 0x300A0502, VR::FL, VM(1, 1, 1), "DistalDepth" },
+  { 0x300A0503, VR::FL, VM(2, 2, 1), "NominalRangeModulationFractions" },
+  { 0x300A0504, VR::FL, VM(2, 2, 1), "NominalRangeModulatedRegionDepths" },
+  { 0x300A0505, VR::SQ, VM(1, 1, 1), "DepthDoseParametersSequence" },
+  { 0x300A0506, VR::SQ, VM(1, 1, 1), "DeliveredDepthDoseParametersSequence" },
+  { 0x300A0507, VR::FL, VM(1, 1, 1), "DeliveredDistalDepthFraction" },
+  { 0x300A0508, VR::FL, VM(1, 1, 1), "DeliveredDistalDepth" },
+  { 0x300A0509, VR::FL, VM(2, 2, 1), "DeliveredNominalRangeModulationFractions" },
+  { 0x300A0510, VR::FL, VM(2, 2, 1), "DeliveredNominalRangeModulatedRegionDepths" },
+  { 0x300A0511, VR::CS, VM(1, 1, 1), "DeliveredReferenceDoseDefinition" },
+  { 0x300A0512, VR::CS, VM(1, 1, 1), "ReferenceDoseDefinition" },
+  { 0x300C0002, VR::SQ, VM(1, 1, 1), "ReferencedRTPlanSequence" },
+  { 0x300C0004, VR::SQ, VM(1, 1, 1), "ReferencedBeamSequence" },
+  { 0x300C0006, VR::IS, VM(1, 1, 1), "ReferencedBeamNumber" },
+  { 0x300C0007, VR::IS, VM(1, 1, 1), "ReferencedReferenceImageNumber" },
+  { 0x300C0008, VR::DS, VM(1, 1, 1), "StartCumulativeMetersetWeight" },
+  { 0x300C0009, VR::DS, VM(1, 1, 1), "EndCumulativeMetersetWeight" },
+  { 0x300C000A, VR::SQ, VM(1, 1, 1), "ReferencedBrachyApplicationSetupSequence" },
+  { 0x300C000C, VR::IS, VM(1, 1, 1), "ReferencedBrachyApplicationSetupNumber" },
+  { 0x300C000E, VR::IS, VM(1, 1, 1), "ReferencedSourceNumber" },
+  { 0x300C0020, VR::SQ, VM(1, 1, 1), "ReferencedFractionGroupSequence" },
+  { 0x300C0022, VR::IS, VM(1, 1, 1), "ReferencedFractionGroupNumber" },
+  { 0x300C0040, VR::SQ, VM(1, 1, 1), "ReferencedVerificationImageSequence" },
+  { 0x300C0042, VR::SQ, VM(1, 1, 1), "ReferencedReferenceImageSequence" },
+  { 0x300C0050, VR::SQ, VM(1, 1, 1), "ReferencedDoseReferenceSequence" },
+  { 0x300C0051, VR::IS, VM(1, 1, 1), "ReferencedDoseReferenceNumber" },
+  { 0x300C0055, VR::SQ, VM(1, 1, 1), "BrachyReferencedDoseReferenceSequence" },
+  { 0x300C0060, VR::SQ, VM(1, 1, 1), "ReferencedStructureSetSequence" },
+  { 0x300C006A, VR::IS, VM(1, 1, 1), "ReferencedPatientSetupNumber" },
+  { 0x300C0080, VR::SQ, VM(1, 1, 1), "ReferencedDoseSequence" },
+  { 0x300C00A0, VR::IS, VM(1, 1, 1), "ReferencedToleranceTableNumber" },
+  { 0x300C00B0, VR::SQ, VM(1, 1, 1), "ReferencedBolusSequence" },
+  { 0x300C00C0, VR::IS, VM(1, 1, 1), "ReferencedWedgeNumber" },
+  { 0x300C00D0, VR::IS, VM(1, 1, 1), "ReferencedCompensatorNumber" },
+  { 0x300C00E0, VR::IS, VM(1, 1, 1), "ReferencedBlockNumber" },
+  { 0x300C00F0, VR::IS, VM(1, 1, 1), "ReferencedControlPointIndex" },
+  { 0x300C00F2, VR::SQ, VM(1, 1, 1), "ReferencedControlPointSequence" },
+  { 0x300C00F4, VR::IS, VM(1, 1, 1), "ReferencedStartControlPointIndex" },
+  { 0x300C00F6, VR::IS, VM(1, 1, 1), "ReferencedStopControlPointIndex" },
+  { 0x300C0100, VR::IS, VM(1, 1, 1), "ReferencedRangeShifterNumber" },
+  { 0x300C0102, VR::IS, VM(1, 1, 1), "ReferencedLateralSpreadingDeviceNumber" },
+  { 0x300C0104, VR::IS, VM(1, 1, 1), "ReferencedRangeModulatorNumber" },
+  { 0x300C0111, VR::SQ, VM(1, 1, 1), "OmittedBeamTaskSequence" },
+  { 0x300C0112, VR::CS, VM(1, 1, 1), "ReasonForOmission" },
+  { 0x300C0113, VR::LO, VM(1, 1, 1), "ReasonForOmissionDescription" },
+  { 0x300E0002, VR::CS, VM(1, 1, 1), "ApprovalStatus" },
+  { 0x300E0004, VR::DA, VM(1, 1, 1), "ReviewDate" },
+  { 0x300E0005, VR::TM, VM(1, 1, 1), "ReviewTime" },
+  { 0x300E0008, VR::PN, VM(1, 1, 1), "ReviewerName" },
+  { 0x40100001, VR::CS, VM(1, 1, 1), "LowEnergyDetectors" },
+  { 0x40100002, VR::CS, VM(1, 1, 1), "HighEnergyDetectors" },
+  { 0x40100004, VR::SQ, VM(1, 1, 1), "DetectorGeometrySequence" },
+  { 0x40101001, VR::SQ, VM(1, 1, 1), "ThreatROIVoxelSequence" },
+  { 0x40101004, VR::FL, VM(3, 3, 1), "ThreatROIBase" },
+  { 0x40101005, VR::FL, VM(3, 3, 1), "ThreatROIExtents" },
+  { 0x40101006, VR::OB, VM(1, 1, 1), "ThreatROIBitmap" },
+  { 0x40101007, VR::SH, VM(1, 1, 1), "RouteSegmentID" },
+  { 0x40101008, VR::CS, VM(1, 1, 1), "GantryType" },
+  { 0x40101009, VR::CS, VM(1, 1, 1), "OOIOwnerType" },
+  { 0x4010100A, VR::SQ, VM(1, 1, 1), "RouteSegmentSequence" },
+  { 0x40101010, VR::US, VM(1, 1, 1), "PotentialThreatObjectID" },
+  { 0x40101011, VR::SQ, VM(1, 1, 1), "ThreatSequence" },
+  { 0x40101012, VR::CS, VM(1, 1, 1), "ThreatCategory" },
+  { 0x40101013, VR::LT, VM(1, 1, 1), "ThreatCategoryDescription" },
+  { 0x40101014, VR::CS, VM(1, 1, 1), "ATDAbilityAssessment" },
+  { 0x40101015, VR::CS, VM(1, 1, 1), "ATDAssessmentFlag" },
+  { 0x40101016, VR::FL, VM(1, 1, 1), "ATDAssessmentProbability" },
+  { 0x40101017, VR::FL, VM(1, 1, 1), "Mass" },
+  { 0x40101018, VR::FL, VM(1, 1, 1), "Density" },
+  { 0x40101019, VR::FL, VM(1, 1, 1), "ZEffective" },
+  { 0x4010101A, VR::SH, VM(1, 1, 1), "BoardingPassID" },
+  { 0x4010101B, VR::FL, VM(3, 3, 1), "CenterOfMass" },
+  { 0x4010101C, VR::FL, VM(3, 3, 1), "CenterOfPTO" },
+  { 0x4010101D, VR::FL, VM(6, VM::N, 1), "BoundingPolygon" },
+  { 0x4010101E, VR::SH, VM(1, 1, 1), "RouteSegmentStartLocationID" },
+  { 0x4010101F, VR::SH, VM(1, 1, 1), "RouteSegmentEndLocationID" },
+  { 0x40101020, VR::CS, VM(1, 1, 1), "RouteSegmentLocationIDType" },
+  { 0x40101021, VR::CS, VM(1, VM::N, 1), "AbortReason" },
+  { 0x40101023, VR::FL, VM(1, 1, 1), "VolumeOfPTO" },
+  { 0x40101024, VR::CS, VM(1, 1, 1), "AbortFlag" },
+  { 0x40101025, VR::DT, VM(1, 1, 1), "RouteSegmentStartTime" },
+  { 0x40101026, VR::DT, VM(1, 1, 1), "RouteSegmentEndTime" },
+  { 0x40101027, VR::CS, VM(1, 1, 1), "TDRType" },
+  { 0x40101028, VR::CS, VM(1, 1, 1), "InternationalRouteSegment" },
+  { 0x40101029, VR::LO, VM(1, VM::N, 1), "ThreatDetectionAlgorithmandVersion" },
+  { 0x4010102A, VR::SH, VM(1, 1, 1), "AssignedLocation" },
+  { 0x4010102B, VR::DT, VM(1, 1, 1), "AlarmDecisionTime" },
+  { 0x40101031, VR::CS, VM(1, 1, 1), "AlarmDecision" },
+  { 0x40101033, VR::US, VM(1, 1, 1), "NumberOfTotalObjects" },
+  { 0x40101034, VR::US, VM(1, 1, 1), "NumberOfAlarmObjects" },
+  { 0x40101037, VR::SQ, VM(1, 1, 1), "PTORepresentationSequence" },
+  { 0x40101038, VR::SQ, VM(1, 1, 1), "ATDAssessmentSequence" },
+  { 0x40101039, VR::CS, VM(1, 1, 1), "TIPType" },
+  { 0x4010103A, VR::CS, VM(1, 1, 1), "DICOSVersion" },
+  { 0x40101041, VR::DT, VM(1, 1, 1), "OOIOwnerCreationTime" },
+  { 0x40101042, VR::CS, VM(1, 1, 1), "OOIType" },
+  { 0x40101043, VR::FL, VM(3, 3, 1), "OOISize" },
+  { 0x40101044, VR::CS, VM(1, 1, 1), "AcquisitionStatus" },
+  { 0x40101045, VR::SQ, VM(1, 1, 1), "BasisMaterialsCodeSequence" },
+  { 0x40101046, VR::CS, VM(1, 1, 1), "PhantomType" },
+  { 0x40101047, VR::SQ, VM(1, 1, 1), "OOIOwnerSequence" },
+  { 0x40101048, VR::CS, VM(1, 1, 1), "ScanType" },
+  { 0x40101051, VR::LO, VM(1, 1, 1), "ItineraryID" },
+  { 0x40101052, VR::SH, VM(1, 1, 1), "ItineraryIDType" },
+  { 0x40101053, VR::LO, VM(1, 1, 1), "ItineraryIDAssigningAuthority" },
+  { 0x40101054, VR::SH, VM(1, 1, 1), "RouteID" },
+  { 0x40101055, VR::SH, VM(1, 1, 1), "RouteIDAssigningAuthority" },
+  { 0x40101056, VR::CS, VM(1, 1, 1), "InboundArrivalType" },
+  { 0x40101058, VR::SH, VM(1, 1, 1), "CarrierID" },
+  { 0x40101059, VR::CS, VM(1, 1, 1), "CarrierIDAssigningAuthority" },
+  { 0x40101060, VR::FL, VM(3, 3, 1), "SourceOrientation" },
+  { 0x40101061, VR::FL, VM(3, 3, 1), "SourcePosition" },
+  { 0x40101062, VR::FL, VM(1, 1, 1), "BeltHeight" },
+  { 0x40101064, VR::SQ, VM(1, 1, 1), "AlgorithmRoutingCodeSequence" },
+  { 0x40101067, VR::CS, VM(1, 1, 1), "TransportClassification" },
+  { 0x40101068, VR::LT, VM(1, 1, 1), "OOITypeDescriptor" },
+  { 0x40101069, VR::FL, VM(1, 1, 1), "TotalProcessingTime" },
+  { 0x4010106C, VR::OB, VM(1, 1, 1), "DetectorCalibrationData" },
+  { 0x4010106D, VR::CS, VM(1, 1, 1), "AdditionalScreeningPerformed" },
+  { 0x4010106E, VR::CS, VM(1, 1, 1), "AdditionalInspectionSelectionCriteria" },
+  { 0x4010106F, VR::SQ, VM(1, 1, 1), "AdditionalInspectionMethodSequence" },
+  { 0x40101070, VR::CS, VM(1, 1, 1), "AITDeviceType" },
+  { 0x40101071, VR::SQ, VM(1, 1, 1), "QRMeasurementsSequence" },
+  { 0x40101072, VR::SQ, VM(1, 1, 1), "TargetMaterialSequence" },
+  { 0x40101073, VR::FD, VM(1, 1, 1), "SNRThreshold" },
+  { 0x40101075, VR::DS, VM(1, 1, 1), "ImageScaleRepresentation" },
+  { 0x40101076, VR::SQ, VM(1, 1, 1), "ReferencedPTOSequence" },
+  { 0x40101077, VR::SQ, VM(1, 1, 1), "ReferencedTDRInstanceSequence" },
+  { 0x40101078, VR::ST, VM(1, 1, 1), "PTOLocationDescription" },
+  { 0x40101079, VR::SQ, VM(1, 1, 1), "AnomalyLocatorIndicatorSequence" },
+  { 0x4010107A, VR::FL, VM(3, 3, 1), "AnomalyLocatorIndicator" },
+  { 0x4010107B, VR::SQ, VM(1, 1, 1), "PTORegionSequence" },
+  { 0x4010107C, VR::CS, VM(1, 1, 1), "InspectionSelectionCriteria" },
+  { 0x4010107D, VR::SQ, VM(1, 1, 1), "SecondaryInspectionMethodSequence" },
+  { 0x4010107E, VR::DS, VM(6, 6, 1), "PRCSToRCSOrientation" },
+  { 0x4FFE0001, VR::SQ, VM(1, 1, 1), "MACParametersSequence" },
+  { 0x52009229, VR::SQ, VM(1, 1, 1), "SharedFunctionalGroupsSequence" },
+  { 0x52009230, VR::SQ, VM(1, 1, 1), "PerFrameFunctionalGroupsSequence" },
+  { 0x54000100, VR::SQ, VM(1, 1, 1), "WaveformSequence" },
+  { 0x54000110, VR::OB, VM(1, 1, 1), "ChannelMinimumValue" },
+  { 0x54000112, VR::OB, VM(1, 1, 1), "ChannelMaximumValue" },
+  { 0x54001004, VR::US, VM(1, 1, 1), "WaveformBitsAllocated" },
+  { 0x54001006, VR::CS, VM(1, 1, 1), "WaveformSampleInterpretation" },
+  { 0x5400100A, VR::OB, VM(1, 1, 1), "WaveformPaddingValue" },
+  { 0x54001010, VR::OB, VM(1, 1, 1), "WaveformData" },
+  { 0x56000010, VR::OF, VM(1, 1, 1), "FirstOrderPhaseCorrectionAngle" },
+  { 0x56000020, VR::OF, VM(1, 1, 1), "SpectroscopyData" },
+  { 0x60000010, VR::US, VM(1, 1, 1), "OverlayRows" },
+  { 0x60000011, VR::US, VM(1, 1, 1), "OverlayColumns" },
+  { 0x60000015, VR::IS, VM(1, 1, 1), "NumberOfFramesInOverlay" },
+  { 0x60000022, VR::LO, VM(1, 1, 1), "OverlayDescription" },
+  { 0x60000040, VR::CS, VM(1, 1, 1), "OverlayType" },
+  { 0x60000045, VR::LO, VM(1, 1, 1), "OverlaySubtype" },
+  { 0x60000050, VR::SS, VM(1, 1, 1), "OverlayOrigin" },
+  { 0x60000051, VR::US, VM(1, 1, 1), "ImageFrameOrigin" },
+  { 0x60000100, VR::US, VM(1, 1, 1), "OverlayBitsAllocated" },
+  { 0x60000102, VR::US, VM(1, 1, 1), "OverlayBitPosition" },
+  { 0x60001001, VR::CS, VM(1, 1, 1), "OverlayActivationLayer" },
+  { 0x60001301, VR::IS, VM(1, 1, 1), "ROIArea" },
+  { 0x60001302, VR::DS, VM(1, 1, 1), "ROIMean" },
+  { 0x60001303, VR::DS, VM(1, 1, 1), "ROIStandardDeviation" },
+  { 0x60001500, VR::LO, VM(1, 1, 1), "OverlayLabel" },
+  { 0x60003000, VR::OB, VM(1, 1, 1), "OverlayData" },
+  { 0x7FE00008, VR::OF, VM(1, 1, 1), "FloatPixelData" },
+  { 0x7FE00009, VR::OD, VM(1, 1, 1), "DoubleFloatPixelData" },
+  { 0x7FE00010, VR::OB, VM(1, 1, 1), "PixelData" },
+  { 0xFFFAFFFA, VR::SQ, VM(1, 1, 1), "DigitalSignaturesSequence" },
+  { 0xFFFCFFFC, VR::OB, VM(1, 1, 1), "DataSetTrailingPadding" },
 };
+
+static const int kBucketBits = 10;
+static const int kSlotBits = 13;
+
+// The displacement of the second level hash for each bucket.
+static const std::uint16_t g_dict_displacements[] = {
+  0x0001, 0x0000, 0x0006, 0x0001, 0x0002, 0x0002, 0x0004, 0x0003, 0x0001, 0x0002, 0x0001, 0x0001,
+  0x0001, 0x0002, 0x0001, 0x0001, 0x0003, 0x0002, 0x0002, 0x0001, 0x0002, 0x0001, 0x0003, 0x0004,
+  0x0002, 0x0004, 0x0002, 0x0002, 0x0002, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0004, 0x0002,
+  0x0000, 0x0001, 0x0005, 0x0001, 0x0003, 0x0004, 0x0001, 0x0001, 0x0003, 0x0001, 0x0001, 0x0001,
+  0x0002, 0x0003, 0x0002, 0x0002, 0x0001, 0x0000, 0x0001, 0x0002, 0x0001, 0x0002, 0x000A, 0x0002,
+  0x0003, 0x0003, 0x0001, 0x0006, 0x0002, 0x0001, 0x0004, 0x0001, 0x0008, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0003, 0x0002, 0x0002, 0x0001, 0x0003, 0x0003, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0001, 0x0003, 0x0002, 0x0001, 0x0001, 0x0003, 0x0005, 0x0001, 0x0000, 0x0003, 0x0000, 0x0001,
+  0x0001, 0x0005, 0x0001, 0x0001, 0x0002, 0x0002, 0x0001, 0x0008, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0002, 0x0004, 0x0002, 0x0001, 0x0004, 0x0002, 0x0002, 0x0004, 0x0002, 0x0000, 0x0001,
+  0x0003, 0x0006, 0x0008, 0x0002, 0x0001, 0x0006, 0x0003, 0x0007, 0x0001, 0x0002, 0x0004, 0x0001,
+  0x0007, 0x0001, 0x0001, 0x0001, 0x0003, 0x0001, 0x0000, 0x0002, 0x0002, 0x0002, 0x0001, 0x0005,
+  0x0004, 0x0001, 0x0001, 0x0001, 0x0002, 0x0001, 0x0002, 0x0001, 0x0002, 0x0002, 0x0003, 0x0002,
+  0x0001, 0x0008, 0x0001, 0x0004, 0x0002, 0x0004, 0x0001, 0x0005, 0x0001, 0x0002, 0x0002, 0x0000,
+  0x0003, 0x0003, 0x0002, 0x000C, 0x0001, 0x0003, 0x0002, 0x0002, 0x0003, 0x0002, 0x0001, 0x0004,
+  0x0001, 0x0002, 0x0001, 0x0004, 0x0000, 0x0004, 0x0002, 0x0000, 0x0002, 0x0003, 0x0002, 0x0001,
+  0x0004, 0x0001, 0x0002, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0001, 0x0002, 0x0001, 0x0002,
+  0x0001, 0x0002, 0x0001, 0x0001, 0x0004, 0x0001, 0x0003, 0x0006, 0x0001, 0x0001, 0x0001, 0x0002,
+  0x0002, 0x0003, 0x0002, 0x0001, 0x0001, 0x0001, 0x0001, 0x0004, 0x0004, 0x0002, 0x0005, 0x0003,
+  0x0002, 0x0001, 0x0001, 0x0003, 0x0001, 0x0002, 0x0001, 0x0001, 0x0004, 0x0008, 0x0001, 0x0001,
+  0x0004, 0x0005, 0x0004, 0x0001, 0x0001, 0x0002, 0x0001, 0x0002, 0x0002, 0x0001, 0x0002, 0x0002,
+  0x0005, 0x0002, 0x0001, 0x0002, 0x0001, 0x0001, 0x0005, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002,
+  0x0002, 0x0001, 0x0001, 0x0001, 0x0005, 0x0001, 0x0004, 0x0003, 0x0007, 0x0001, 0x0001, 0x0001,
+  0x0002, 0x0003, 0x0001, 0x0002, 0x0006, 0x0000, 0x0004, 0x0001, 0x0005, 0x0001, 0x0001, 0x0001,
+  0x0005, 0x0002, 0x0002, 0x0002, 0x0001, 0x0001, 0x0002, 0x0006, 0x0002, 0x0003, 0x0001, 0x0002,
+  0x000C, 0x0008, 0x0002, 0x0004, 0x0002, 0x0002, 0x0001, 0x0002, 0x0001, 0x0001, 0x0001, 0x000B,
+  0x0003, 0x0001, 0x0000, 0x0001, 0x0001, 0x0001, 0x0002, 0x0005, 0x0004, 0x0001, 0x0003, 0x0002,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0004, 0x0005, 0x0001, 0x0004, 0x0001,
+  0x0001, 0x0001, 0x0007, 0x0002, 0x0002, 0x0003, 0x0001, 0x0005, 0x0001, 0x0001, 0x0006, 0x0002,
+  0x0001, 0x0001, 0x0006, 0x0005, 0x0001, 0x0001, 0x0005, 0x0003, 0x0003, 0x0005, 0x0003, 0x0001,
+  0x0001, 0x0003, 0x0001, 0x0001, 0x0006, 0x0003, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0001, 0x0002, 0x0010, 0x0008, 0x0004, 0x0001, 0x0004, 0x0004, 0x0001, 0x0000, 0x0006, 0x0002,
+  0x0006, 0x0003, 0x0002, 0x0007, 0x0001, 0x0002, 0x0004, 0x0004, 0x0001, 0x0002, 0x0001, 0x0000,
+  0x000B, 0x0003, 0x0001, 0x0001, 0x0003, 0x0002, 0x0001, 0x0006, 0x0009, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0007, 0x0006, 0x0001, 0x0004, 0x0002, 0x0001, 0x0001, 0x0001, 0x0001, 0x0004, 0x0002,
+  0x0001, 0x000C, 0x0000, 0x0001, 0x0004, 0x0001, 0x0001, 0x0009, 0x0002, 0x0002, 0x0003, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0002, 0x0006, 0x0002, 0x0003, 0x0003, 0x0001, 0x0002, 0x0003, 0x0003,
+  0x000A, 0x0001, 0x0002, 0x0003, 0x0001, 0x0003, 0x0002, 0x0001, 0x0003, 0x0003, 0x0001, 0x0003,
+  0x0002, 0x0002, 0x0004, 0x0001, 0x0003, 0x0001, 0x0003, 0x0007, 0x0003, 0x0002, 0x0007, 0x0001,
+  0x0003, 0x0002, 0x0003, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x000A, 0x0001, 0x0002,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0003, 0x0001, 0x0001, 0x0002, 0x0001, 0x0001, 0x0002, 0x0001,
+  0x000A, 0x0003, 0x0001, 0x0002, 0x0002, 0x0005, 0x0004, 0x0001, 0x0002, 0x0003, 0x0003, 0x0001,
+  0x0008, 0x0002, 0x0002, 0x0006, 0x0002, 0x0005, 0x0001, 0x0002, 0x0001, 0x0003, 0x0001, 0x0002,
+  0x0002, 0x0002, 0x0001, 0x0003, 0x0001, 0x0002, 0x0001, 0x0001, 0x0005, 0x0003, 0x0000, 0x0002,
+  0x0004, 0x0002, 0x0002, 0x0003, 0x0008, 0x0003, 0x0005, 0x0001, 0x0008, 0x0003, 0x0002, 0x0003,
+  0x0005, 0x0002, 0x0002, 0x0003, 0x0001, 0x0002, 0x0003, 0x0003, 0x0007, 0x0001, 0x0003, 0x0003,
+  0x0001, 0x0003, 0x0001, 0x0001, 0x0004, 0x0003, 0x0001, 0x0008, 0x0009, 0x0003, 0x0000, 0x0001,
+  0x0000, 0x0001, 0x0001, 0x0004, 0x0002, 0x0001, 0x000C, 0x0001, 0x0001, 0x0001, 0x0008, 0x0008,
+  0x0005, 0x0002, 0x0002, 0x0002, 0x0001, 0x0002, 0x0003, 0x0003, 0x0002, 0x0003, 0x0004, 0x0003,
+  0x0001, 0x0005, 0x0002, 0x0001, 0x0001, 0x0002, 0x0001, 0x0002, 0x0004, 0x0001, 0x0000, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0003, 0x0001, 0x0001, 0x0009, 0x0002, 0x0002, 0x0006, 0x0003, 0x0004,
+  0x000A, 0x0002, 0x0003, 0x0004, 0x0002, 0x0001, 0x0003, 0x0001, 0x0002, 0x0002, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0008, 0x0002, 0x0001, 0x0001, 0x0005, 0x0001, 0x0001, 0x0001, 0x0003,
+  0x0004, 0x0006, 0x0003, 0x0001, 0x0002, 0x0001, 0x0002, 0x0004, 0x0006, 0x0003, 0x0002, 0x0001,
+  0x0002, 0x0001, 0x0004, 0x0005, 0x0002, 0x0007, 0x0002, 0x0001, 0x0004, 0x0002, 0x0002, 0x0007,
+  0x0001, 0x0001, 0x0002, 0x0001, 0x0003, 0x0002, 0x0001, 0x0003, 0x0001, 0x0003, 0x0001, 0x0000,
+  0x0001, 0x0006, 0x0000, 0x0004, 0x0003, 0x0001, 0x0000, 0x0004, 0x0004, 0x0001, 0x0004, 0x0002,
+  0x0002, 0x0005, 0x000A, 0x0004, 0x0003, 0x0001, 0x0007, 0x0002, 0x0008, 0x0006, 0x0003, 0x0002,
+  0x0002, 0x0003, 0x0003, 0x0001, 0x0003, 0x0001, 0x0005, 0x0001, 0x0002, 0x0006, 0x0002, 0x0004,
+  0x0013, 0x0003, 0x0002, 0x0001, 0x0002, 0x0004, 0x0001, 0x0001, 0x0001, 0x0003, 0x0001, 0x0001,
+  0x0004, 0x0002, 0x0000, 0x0009, 0x0005, 0x0008, 0x0002, 0x0005, 0x0001, 0x0004, 0x0001, 0x0003,
+  0x0001, 0x0001, 0x0003, 0x0001, 0x0002, 0x0004, 0x0003, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0003, 0x0001, 0x0001, 0x0003, 0x0001, 0x0006, 0x0001, 0x000B, 0x000C, 0x0001, 0x0001, 0x0002,
+  0x0001, 0x0001, 0x0001, 0x0007, 0x0001, 0x0001, 0x0000, 0x0003, 0x0000, 0x0009, 0x0002, 0x0001,
+  0x0003, 0x0001, 0x0001, 0x0001, 0x0001, 0x0003, 0x0002, 0x0001, 0x0002, 0x0002, 0x0003, 0x0002,
+  0x0007, 0x0004, 0x0004, 0x0004, 0x0002, 0x0004, 0x0001, 0x0001, 0x000F, 0x0003, 0x0001, 0x0001,
+  0x0000, 0x0006, 0x0003, 0x0004, 0x0001, 0x0003, 0x0007, 0x0001, 0x0001, 0x0008, 0x0005, 0x0003,
+  0x0001, 0x0003, 0x0006, 0x0004, 0x0001, 0x0003, 0x0001, 0x000A, 0x0001, 0x0001, 0x0000, 0x0001,
+  0x0004, 0x0003, 0x0007, 0x0002, 0x0016, 0x0001, 0x0001, 0x0001, 0x0004, 0x0002, 0x0008, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0003, 0x0001, 0x0001, 0x0001, 0x0002, 0x0011, 0x0002, 0x0004, 0x0001,
+  0x0007, 0x0000, 0x0003, 0x0001, 0x0004, 0x0002, 0x0007, 0x0001, 0x0002, 0x0003, 0x0002, 0x0005,
+  0x0001, 0x0002, 0x0010, 0x0000, 0x0003, 0x0009, 0x0001, 0x0004, 0x0001, 0x0001, 0x0003, 0x0002,
+  0x0003, 0x0002, 0x0002, 0x0001, 0x0000, 0x0002, 0x0002, 0x0001, 0x0001, 0x0001, 0x0008, 0x0004,
+  0x0001, 0x0000, 0x0001, 0x0009, 0x0002, 0x0003, 0x0000, 0x0001, 0x0003, 0x0001, 0x0001, 0x0007,
+  0x0002, 0x0001, 0x0002, 0x0002, 0x0004, 0x0002, 0x0007, 0x0003, 0x0005, 0x0010, 0x0005, 0x0002,
+  0x0001, 0x0001, 0x0002, 0x0003, 0x0003, 0x0007, 0x0002, 0x000D, 0x0010, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0000, 0x0001, 0x0007, 0x0003, 0x0002, 0x0001, 0x0004, 0x0001, 0x0005, 0x0004, 0x0002,
+  0x0001, 0x0000, 0x0003, 0x0001, 0x0000, 0x0002, 0x0001, 0x0002, 0x0002, 0x0008, 0x0001, 0x0004,
+  0x0004, 0x0003, 0x000B, 0x0003, 0x0003, 0x0001, 0x0003, 0x0002, 0x0005, 0x0002, 0x0001, 0x0004,
+  0x0001, 0x0001, 0x0004, 0x0001, 0x0007, 0x0002, 0x0002, 0x0004, 0x0003, 0x0002, 0x0002, 0x0001,
+  0x0004, 0x0001, 0x0001, 0x0007, 0x0001, 0x0005, 0x0001, 0x0004, 0x0007, 0x0001, 0x000A, 0x0006,
+  0x0003, 0x0001, 0x0001, 0x0001, 0x0002, 0x0006, 0x0008, 0x0000, 0x0005, 0x0002, 0x0004, 0x0003,
+  0x0001, 0x0001, 0x0003, 0x0006, 0x0001, 0x0001, 0x0003, 0x0001, 0x0001, 0x0001, 0x0003, 0x0004,
+  0x0001, 0x0002, 0x0001, 0x0001, 0x000A, 0x0001, 0x0001, 0x0001, 0x0005, 0x0002, 0x0002, 0x0001,
+  0x0002, 0x0004, 0x0001, 0x0008, 0x0006, 0x0007, 0x0015, 0x0003, 0x0006, 0x0001, 0x0001, 0x0005,
+  0x0001, 0x0001, 0x0004, 0x0008,
+};
+
+// The index of the entry in g_dict for each slot, or kNoEntry.
+static const std::uint16_t g_dict_slots[] = {
+  0x0027, 0x0516, 0xFFFF, 0x0DAB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0091,
+  0x004B, 0xFFFF, 0x00FB, 0xFFFF, 0x02D4, 0x08FB, 0xFFFF, 0x0340, 0x0116, 0x0BC7, 0x02B5, 0x02DC,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x096E, 0x0596, 0xFFFF, 0x0E1F, 0x0D0F, 0x0372, 0xFFFF, 0x006A, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x036C, 0x0988, 0x09B2, 0xFFFF, 0xFFFF, 0xFFFF, 0x06D8, 0x0187, 0xFFFF, 0x0D6B,
+  0xFFFF, 0x01CA, 0x0CDF, 0x0A18, 0xFFFF, 0xFFFF, 0x00BC, 0xFFFF, 0x0159, 0xFFFF, 0x0D01, 0xFFFF,
+  0x0699, 0xFFFF, 0x0436, 0xFFFF, 0x06A4, 0x072D, 0x043E, 0x00C2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0B6A, 0xFFFF, 0x091C, 0xFFFF, 0xFFFF, 0xFFFF, 0x0C35, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x04DB, 0x010C, 0xFFFF, 0x068B, 0x0130,
+  0xFFFF, 0x0BBD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0355, 0x0CFA, 0x027D, 0x02C1, 0x0938, 0x0643,
+  0xFFFF, 0x07EE, 0x0C22, 0x0599, 0x01B1, 0xFFFF, 0x0C0E, 0x06F4, 0xFFFF, 0x0D88, 0x0B79, 0x0D3E,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0509, 0x0036, 0xFFFF, 0xFFFF, 0xFFFF, 0x0473, 0x0923, 0xFFFF, 0x0460,
+  0x0D78, 0xFFFF, 0x0DE2, 0xFFFF, 0xFFFF, 0x0542, 0x054E, 0x0DD2, 0xFFFF, 0x0CAA, 0x096B, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0281, 0x02F4, 0xFFFF, 0xFFFF, 0x0AD9, 0xFFFF, 0xFFFF, 0x06FD, 0x0002, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x07E7, 0xFFFF, 0x096A, 0x0C59, 0xFFFF, 0x0C5F, 0xFFFF, 0x0722, 0x06D6, 0xFFFF,
+  0x06DC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0C4E, 0x08DF, 0x084A, 0x00F6, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x08A4, 0x04F4, 0x0DC5, 0x0756, 0xFFFF, 0xFFFF, 0x0D0E, 0xFFFF, 0xFFFF, 0x0299, 0xFFFF,
+  0x0A5E, 0xFFFF, 0x05ED, 0xFFFF, 0x0AEE, 0x08BB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x075B, 0xFFFF,
+  0xFFFF, 0x0A22, 0x0D6F, 0xFFFF, 0x0B30, 0x016A, 0xFFFF, 0xFFFF, 0xFFFF, 0x0666, 0xFFFF, 0x0CA2,
+  0x0867, 0x06A1, 0x09A0, 0xFFFF, 0x0A0A, 0xFFFF, 0xFFFF, 0xFFFF, 0x03C7, 0xFFFF, 0x0B9C, 0x0755,
+  0xFFFF, 0x01B8, 0xFFFF, 0x0E32, 0x0494, 0x0D94, 0xFFFF, 0x02F8, 0xFFFF, 0x0B1D, 0x04B9, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x026E, 0x0AC3, 0xFFFF, 0x0C7A, 0x06F2, 0x043F, 0x08D2, 0x0710, 0x0A85,
+  0xFFFF, 0xFFFF, 0x0BEB, 0xFFFF, 0x079D, 0xFFFF, 0x0CFB, 0x0B3E, 0xFFFF, 0x050F, 0x0B02, 0x0152,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0B68, 0xFFFF, 0xFFFF, 0x0AA5, 0xFFFF, 0x0CE4, 0xFFFF,
+  0x03D4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0916, 0xFFFF, 0xFFFF,
+  0x07B2, 0xFFFF, 0xFFFF, 0x0E27, 0x0BBF, 0x0038, 0xFFFF, 0x08CD, 0x07B8, 0x0BA0, 0x0AF9, 0xFFFF,
+  0x08A1, 0x03EE, 0x083A, 0x0C5B, 0x05FE, 0x0E31, 0x0ACB, 0x0609, 0xFFFF, 0x0CAE, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x05D5, 0xFFFF, 0x0AF2, 0xFFFF, 0xFFFF, 0x0CF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0999, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x044B, 0xFFFF, 0xFFFF, 0x01E2, 0xFFFF, 0x06B6, 0x03C1,
+  0xFFFF, 0xFFFF, 0x0B87, 0xFFFF, 0xFFFF, 0x0785, 0x02B7, 0xFFFF, 0x00B7, 0x0632, 0xFFFF, 0xFFFF,
+  0x0452, 0x0582, 0x0696, 0xFFFF, 0x0A96, 0xFFFF, 0x04E1, 0x0612, 0xFFFF, 0x098E, 0x0E20, 0xFFFF,
+  0xFFFF, 0x08FF, 0xFFFF, 0xFFFF, 0x0C01, 0x012C, 0xFFFF, 0xFFFF, 0x07BE, 0xFFFF, 0xFFFF, 0x0108,
+  0xFFFF, 0x0221, 0xFFFF, 0xFFFF, 0xFFFF, 0x0376, 0xFFFF, 0xFFFF, 0xFFFF, 0x064D, 0x066E, 0xFFFF,
+  0x0497, 0x03B7, 0xFFFF, 0xFFFF, 0x01B6, 0xFFFF, 0x0819, 0x0B66, 0x0B33, 0x0C95, 0x05F4, 0xFFFF,
+  0x005E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0A9F, 0x0B50, 0x05F8, 0x0539, 0x042E, 0xFFFF, 0xFFFF,
+  0x0D76, 0x0B14, 0x02DD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0B52, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x013D, 0xFFFF, 0xFFFF, 0x0A0D, 0xFFFF, 0x0238, 0x09D4, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x059E, 0x0D71, 0xFFFF, 0x073B, 0xFFFF, 0x0BFB, 0xFFFF, 0xFFFF, 0x0CC9, 0x0BE9, 0x0286, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0C3C, 0xFFFF, 0xFFFF, 0x0C05, 0xFFFF, 0xFFFF, 0x0E2E, 0xFFFF, 0x0480,
+  0x04FD, 0x064B, 0xFFFF, 0xFFFF, 0x0D23, 0xFFFF, 0x0530, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0882, 0xFFFF, 0x04C8, 0xFFFF, 0xFFFF, 0x05D9, 0xFFFF, 0xFFFF,
+  0x025C, 0x0293, 0xFFFF, 0x0E1E, 0x0312, 0x0965, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x032E, 0xFFFF,
+  0xFFFF, 0x008B, 0xFFFF, 0xFFFF, 0x002A, 0xFFFF, 0x069F, 0xFFFF, 0xFFFF, 0x01CD, 0xFFFF, 0xFFFF,
+  0x0E12, 0xFFFF, 0xFFFF, 0x060F, 0xFFFF, 0x0808, 0xFFFF, 0x0DF8, 0xFFFF, 0x02CA, 0xFFFF, 0xFFFF,
+  0x0682, 0x08BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x08B5, 0xFFFF, 0x0254, 0x01A6, 0x026F, 0x0B96, 0xFFFF, 0x0BAF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x059B, 0x0BD1, 0xFFFF, 0x0810, 0x0A6D, 0xFFFF, 0x0BD9, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x04E3, 0xFFFF, 0xFFFF, 0x0B55, 0x07F8,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x017B, 0xFFFF, 0xFFFF, 0x091A, 0xFFFF, 0x01D7,
+  0xFFFF, 0x0AD5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0AA4, 0x0949, 0x01B5, 0x0D9E, 0xFFFF, 0x055B,
+  0x076D, 0xFFFF, 0xFFFF, 0x0D44, 0xFFFF, 0x02FE, 0xFFFF, 0xFFFF, 0x0748, 0xFFFF, 0x08FE, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0D2B, 0xFFFF, 0xFFFF, 0x0B28, 0x07FD, 0xFFFF, 0xFFFF, 0xFFFF, 0x04BC,
+  0x08F1, 0xFFFF, 0xFFFF, 0x0B1C, 0x0D6C, 0x0028, 0xFFFF, 0x03FC, 0xFFFF, 0x05AA, 0x0C7B, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0B38, 0xFFFF, 0x07E2, 0x0A67, 0xFFFF, 0xFFFF, 0x0B5A, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0A9D, 0xFFFF, 0x0E0D, 0xFFFF, 0xFFFF, 0x0797, 0xFFFF, 0x099E, 0x03D5, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0B05, 0xFFFF, 0x017C, 0x01E4, 0x0A06, 0x003E, 0x0402, 0xFFFF, 0xFFFF, 0x01EE, 0x08CF, 0xFFFF,
+  0xFFFF, 0x0CF0, 0xFFFF, 0x0827, 0x09C9, 0xFFFF, 0x0B25, 0xFFFF, 0x0BC8, 0x05A6, 0xFFFF, 0x0510,
+  0xFFFF, 0x097B, 0x040F, 0x0757, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x06F3, 0xFFFF, 0xFFFF, 0x0807,
+  0xFFFF, 0x0C62, 0xFFFF, 0x055A, 0x0541, 0x00E8, 0xFFFF, 0x03CE, 0xFFFF, 0x0110, 0xFFFF, 0x087E,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0A2B, 0x011B, 0x0B3D, 0xFFFF, 0x0C47, 0x08FC, 0x06EC, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0678, 0x03D0, 0x08BD, 0x0656, 0x04AC, 0x027A, 0xFFFF, 0xFFFF, 0xFFFF, 0x0CF3, 0xFFFF,
+  0x0026, 0xFFFF, 0xFFFF, 0x0647, 0x08E7, 0xFFFF, 0x074B, 0xFFFF, 0xFFFF, 0x0407, 0x035D, 0x0358,
+  0xFFFF, 0xFFFF, 0x0DAA, 0xFFFF, 0x0614, 0x07CD, 0xFFFF, 0xFFFF, 0xFFFF, 0x0784, 0x0B43, 0x084B,
+  0xFFFF, 0xFFFF, 0x09BD, 0x0373, 0xFFFF, 0xFFFF, 0x0C06, 0xFFFF, 0x05DE, 0x0E2A, 0x0E24, 0x0C27,
+  0xFFFF, 0x07F7, 0xFFFF, 0x0AED, 0x0B85, 0x0591, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0B7F, 0xFFFF,
+  0xFFFF, 0x0243, 0x047B, 0xFFFF, 0xFFFF, 0x0181, 0x025F, 0xFFFF, 0x09C8, 0x09CC, 0x00C8, 0xFFFF,
+  0xFFFF, 0x02C0, 0x0289, 0x05C7, 0x026A, 0x03D7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0C3D, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x02F2, 0xFFFF, 0xFFFF, 0x0413, 0xFFFF, 0x070F, 0xFFFF, 0xFFFF, 0x0B45, 0xFFFF,
+  0xFFFF, 0x0DBF, 0x0577, 0x0C52, 0x04EB, 0xFFFF, 0x0779, 0x0A0C, 0xFFFF, 0x01EA, 0xFFFF, 0x0744,
+  0xFFFF, 0x059C, 0xFFFF, 0xFFFF, 0x064A, 0x0641, 0x0C77, 0xFFFF, 0xFFFF, 0x0C26, 0xFFFF, 0x07F5,
+  0x0623, 0x00EB, 0x0A4B, 0x0496, 0x0234, 0x01BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x073F,
+  0x0B1B, 0x06E4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0DBD, 0x0D39, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0D33, 0x0AF5, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0DFC, 0xFFFF, 0x0532, 0x077A, 0x0AEA, 0xFFFF, 0xFFFF, 0x086C, 0x0296, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x046F, 0xFFFF, 0x0BA3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x07E8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0952, 0xFFFF, 0xFFFF, 0x0821, 0x03FB,
+  0x051C, 0xFFFF, 0xFFFF, 0x0226, 0xFFFF, 0x0061, 0xFFFF, 0x0216, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x03B5, 0x0737, 0xFFFF, 0x07AB, 0xFFFF, 0x0CD9, 0x0634, 0xFFFF, 0xFFFF, 0x0060, 0xFFFF, 0xFFFF,
+  0x018E, 0xFFFF, 0x08AC, 0x021D, 0xFFFF, 0x0CF4, 0x0073, 0x0194, 0xFFFF, 0xFFFF, 0x02B8, 0xFFFF,
+  0x0DFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0ADE, 0xFFFF, 0xFFFF, 0x0701, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0C15, 0xFFFF, 0x0CC2, 0x0698, 0x0314, 0xFFFF, 0xFFFF, 0xFFFF, 0x05F0,
+  0x098F, 0xFFFF, 0xFFFF, 0x085C, 0x0BF4, 0xFFFF, 0x0D1B, 0x0419, 0x0966, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x063E, 0xFFFF, 0xFFFF, 0x0E34, 0x020F, 0x0479, 0xFFFF, 0xFFFF, 0x038C,
+  0x08AF, 0xFFFF, 0x0DCE, 0x01AB, 0xFFFF, 0xFFFF, 0x02E0, 0x0870, 0xFFFF, 0x017D, 0xFFFF, 0x09D5,
+  0x02C9, 0xFFFF, 0x0A55, 0x066C, 0x05CA, 0xFFFF, 0x0CCB, 0xFFFF, 0x0456, 0x028D, 0x0434, 0xFFFF,
+  0x0557, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x01C2, 0x0DAD, 0xFFFF, 0x0ADD,
+  0x0951, 0xFFFF, 0xFFFF, 0x0E23, 0x044D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x031D,
+  0xFFFF, 0x0183, 0xFFFF, 0xFFFF, 0x0A78, 0xFFFF, 0x0894, 0x0320, 0x02FB, 0x0511, 0x0DAC, 0x0926,
+  0x0B5B, 0xFFFF, 0xFFFF, 0xFFFF, 0x0927, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x08EB, 0xFFFF, 0x090E, 0xFFFF, 0xFFFF, 0x04D5, 0xFFFF, 0x0D6E,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0DB3, 0x0B18, 0xFFFF, 0x09C2, 0xFFFF, 0xFFFF, 0x0288, 0x0E06,
+  0x0490, 0x08A8, 0x0375, 0xFFFF, 0x0466, 0xFFFF, 0xFFFF, 0x0D60, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0B93, 0x087D, 0x0933, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0B7B, 0xFFFF, 0x0613, 0x03AC, 0x0AE1, 0x0A5F, 0xFFFF, 0xFFFF, 0xFFFF, 0x0A42, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0D37, 0x027C, 0x0A2A, 0x0A9E, 0x0BA1, 0xFFFF, 0x02C6, 0xFFFF, 0x020E, 0x0135,
+  0xFFFF, 0x03DE, 0x0962, 0xFFFF, 0xFFFF, 0x08DD, 0xFFFF, 0x01D6, 0x036D, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0D79, 0x0C2E, 0xFFFF, 0x0193, 0xFFFF, 0xFFFF, 0x0B73, 0xFFFF, 0x0A28, 0xFFFF,
+  0xFFFF, 0x0BA6, 0xFFFF, 0x0500, 0xFFFF, 0xFFFF, 0xFFFF, 0x0C82, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0A58, 0xFFFF, 0xFFFF, 0x0597, 0xFFFF, 0x019E, 0x08AB, 0x00EE, 0x01B2, 0x03B8,
+  0xFFFF, 0xFFFF, 0x0A0E, 0xFFFF, 0xFFFF, 0x0094, 0x0CA1, 0x0D55, 0x00CB, 0x084E, 0x0B11, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0C3F, 0x0572, 0x0707, 0x064C, 0xFFFF, 0xFFFF, 0x0611, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x073E, 0x0406, 0x0721, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x03C3, 0x0C38, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0C20, 0x076C, 0xFFFF, 0x014A, 0x0DEC, 0xFFFF, 0xFFFF, 0xFFFF, 0x0A08, 0xFFFF, 0x0D81,
+  0xFFFF, 0x05BC, 0x05C0, 0x009C, 0x078E, 0xFFFF, 0x0851, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x04A6, 0xFFFF, 0x0B03, 0xFFFF, 0xFFFF, 0x070E, 0xFFFF, 0xFFFF, 0x0C9C, 0xFFFF, 0x0034, 0x04D8,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0D5D, 0xFFFF, 0x0121, 0x055C, 0x0D97, 0x0BF8, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0D36, 0xFFFF, 0xFFFF, 0xFFFF, 0x0865, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0C69, 0xFFFF, 0xFFFF, 0x009D, 0xFFFF, 0x0A19, 0x0C24, 0xFFFF, 0x050E, 0x08B9, 0xFFFF, 0x0474,
+  0x00F8, 0x0CD6, 0x05CE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x066D, 0x02FC, 0xFFFF, 0x0832,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x00C0, 0x0072, 0xFFFF, 0x044E, 0xFFFF, 0xFFFF, 0x0089, 0x0759,
+  0x0DBB, 0xFFFF, 0xFFFF, 0xFFFF, 0x0C74, 0x0191, 0x0B75, 0x08BA, 0x07B5, 0x0257, 0x0440, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x03CC, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x05E2, 0xFFFF, 0x0BD0, 0x0231, 0x0C7E, 0xFFFF, 0xFFFF, 0x065D, 0xFFFF, 0x06D3,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0717, 0x034A, 0x00BD, 0xFFFF, 0x068A, 0x03DA, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x01E8, 0x0E22, 0xFFFF, 0xFFFF, 0x0556, 0x0A7A, 0xFFFF, 0xFFFF, 0x0037, 0x09EB, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0A80, 0x06E3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x04CB, 0x0030, 0xFFFF, 0x0CD7,
+  0xFFFF, 0x0AFA, 0x0098, 0x0125, 0x0CFF, 0xFFFF, 0x0154, 0x002D, 0xFFFF, 0x0690, 0x01F7, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0BF7, 0xFFFF, 0xFFFF, 0xFFFF, 0x0AF1, 0x0562, 0xFFFF, 0xFFFF, 0x0A5A, 0xFFFF,
+  0x0983, 0xFFFF, 0xFFFF, 0xFFFF, 0x0C0C, 0x0A5C, 0x067B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0B86, 0xFFFF, 0xFFFF, 0x0103, 0xFFFF, 0x09FC, 0xFFFF, 0x0658,
+  0x0B56, 0xFFFF, 0x0602, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0773, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x05F9, 0xFFFF, 0xFFFF, 0xFFFF, 0x0B21, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0B12,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x05B8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x054B,
+  0xFFFF, 0x0454, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0543, 0xFFFF, 0xFFFF, 0xFFFF, 0x0124, 0x0651,
+  0xFFFF, 0x0D24, 0x0A13, 0xFFFF, 0xFFFF, 0x0E0A, 0x0A95, 0x0841, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0CB3, 0xFFFF, 0xFFFF, 0x0783, 0xFFFF, 0x0C4F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x07EA, 0x0CD2,
+  0xFFFF, 0x0857, 0xFFFF, 0xFFFF, 0x0C54, 0xFFFF, 0xFFFF, 0xFFFF, 0x049C, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0653, 0x0E16, 0xFFFF, 0x09C1, 0xFFFF, 0x0D20, 0x027E, 0x0876, 0x0294, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x092C, 0x0621, 0xFFFF, 0xFFFF, 0x0DD4, 0xFFFF, 0xFFFF, 0xFFFF, 0x018C, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x02C5, 0x02C4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0DA7, 0xFFFF, 0x078B, 0xFFFF, 0x0E02,
+  0xFFFF, 0x0178, 0x04DD, 0xFFFF, 0x07C9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0CA5, 0xFFFF, 0x0465,
+  0xFFFF, 0x0533, 0x0754, 0xFFFF, 0x03BE, 0x06E0, 0xFFFF, 0xFFFF, 0x03AE, 0x07D5, 0xFFFF, 0x0525,
+  0x04F5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0090, 0xFFFF, 0xFFFF, 0xFFFF, 0x0C50, 0x051D, 0x005D,
+  0xFFFF, 0x09D7, 0x0C30, 0xFFFF, 0xFFFF, 0x09F2, 0xFFFF, 0xFFFF, 0xFFFF, 0x04E5, 0x0172, 0x091D,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x023E, 0x04AE, 0xFFFF, 0xFFFF, 0xFFFF, 0x02BB, 0x0475, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0771, 0xFFFF, 0x0911, 0xFFFF, 0xFFFF, 0xFFFF, 0x0A03, 0xFFFF, 0xFFFF, 0x05E9, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0527, 0xFFFF, 0x0B8E, 0x0688, 0x025A, 0xFFFF, 0xFFFF, 0x0266, 0xFFFF,
+  0xFFFF, 0x0568, 0xFFFF, 0x06BF, 0xFFFF, 0x0B42, 0xFFFF, 0x0129, 0xFFFF, 0xFFFF, 0x01C3, 0x0C34,
+  0x0740, 0x0BE1, 0x0B98, 0xFFFF, 0x0BBE, 0x0435, 0xFFFF, 0x0AF8, 0x053A, 0xFFFF, 0xFFFF, 0x0223,
+  0x0B2D, 0x0B4C, 0x0A00, 0xFFFF, 0x0083, 0x08DE, 0xFFFF, 0xFFFF, 0xFFFF, 0x0167, 0xFFFF, 0x0092,
+  0x032B, 0x0344, 0xFFFF, 0xFFFF, 0xFFFF, 0x005C, 0x0D51, 0x05EB, 0xFFFF, 0xFFFF, 0x0604, 0x00B2,
+  0xFFFF, 0x0E38, 0x0C9B, 0xFFFF, 0x0016, 0xFFFF, 0xFFFF, 0x0006, 0xFFFF, 0xFFFF, 0x037A, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0C1E,
+  0xFFFF, 0x0550, 0xFFFF, 0x04D3, 0x06D5, 0xFFFF, 0xFFFF, 0x0A8A, 0x019A, 0x0B76, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0DF9, 0xFFFF, 0xFFFF, 0xFFFF, 0x0535, 0x0B51, 0xFFFF, 0xFFFF, 0x00BB,
+  0xFFFF, 0xFFFF, 0x0410, 0xFFFF, 0x0921, 0xFFFF, 0xFFFF, 0x072C, 0x0A73, 0x0603, 0x085A, 0xFFFF,
+  0xFFFF, 0x0D4D, 0xFFFF, 0x0B6C, 0x0400, 0xFFFF, 0xFFFF, 0xFFFF, 0x07C0, 0xFFFF, 0xFFFF, 0x03C5,
+  0x0996, 0xFFFF, 0xFFFF, 0x08C6, 0xFFFF, 0x0317, 0xFFFF, 0x0273, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0164, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0778, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0207,
+  0x0401, 0xFFFF, 0x0C65, 0x0501, 0xFFFF, 0x08D6, 0xFFFF, 0xFFFF, 0x0297, 0x072F, 0x0259, 0x039C,
+  0xFFFF, 0x0553, 0x05B5, 0x05C2, 0x0B94, 0xFFFF, 0xFFFF, 0x0ACA, 0xFFFF, 0x0CB6, 0xFFFF, 0x07BB,
+  0xFFFF, 0x0680, 0xFFFF, 0xFFFF, 0x05E1, 0x0863, 0xFFFF, 0xFFFF, 0xFFFF, 0x04AF, 0x04A8, 0xFFFF,
+  0x05A3, 0xFFFF, 0x0DA3, 0xFFFF, 0xFFFF, 0x0B48, 0x08F8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x018D,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x030A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0DA8, 0xFFFF,
+  0x0B99, 0x022C, 0xFFFF, 0x015F, 0xFFFF, 0xFFFF, 0xFFFF, 0x052F, 0xFFFF, 0xFFFF, 0xFFFF, 0x0D93,
+  0x0B07, 0xFFFF, 0xFFFF, 0x0AA9, 0x00D3, 0xFFFF, 0xFFFF, 0xFFFF, 0x0260, 0xFFFF, 0x088E, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x099F, 0x0095, 0x01C7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0776, 0xFFFF, 0xFFFF,
+  0x0AA0, 0xFFFF, 0x007A, 0xFFFF, 0xFFFF, 0x032C, 0xFFFF, 0x03DD, 0x062C, 0xFFFF, 0x0920, 0x0631,
+  0xFFFF, 0xFFFF, 0x0364, 0x0CAC, 0xFFFF, 0x068C, 0x0C31, 0x07A5, 0x0944, 0xFFFF, 0x089F, 0x01F2,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x074F, 0x0817, 0x0998, 0x0D43, 0xFFFF, 0x0144, 0xFFFF, 0x0B84,
+  0x0B36, 0xFFFF, 0x010D, 0xFFFF, 0xFFFF, 0x065C, 0x0AA2, 0x0A43, 0x016D, 0xFFFF, 0xFFFF, 0x0BB9,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0050, 0xFFFF, 0x0076, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x008C, 0x0CE3, 0xFFFF, 0x070C, 0xFFFF, 0x0ABB, 0x0AF6, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x089D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x00DD, 0xFFFF,
+  0x0719, 0xFFFF, 0xFFFF, 0x0DE1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0227, 0xFFFF, 0x095E, 0xFFFF,
+  0x02F9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x038E, 0xFFFF, 0xFFFF, 0x08B6, 0x011E, 0xFFFF, 0xFFFF,
+  0x000D, 0xFFFF, 0xFFFF, 0x0B01, 0x027B, 0x0105, 0x04D6, 0xFFFF, 0xFFFF, 0x0646, 0x0A57, 0x0E13,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0C99, 0xFFFF, 0xFFFF,
+  0x08D9, 0xFFFF, 0x001A, 0x046A, 0x062E, 0xFFFF, 0x0537, 0x0C13, 0x03F1, 0x0A29, 0xFFFF, 0x0D63,
+  0xFFFF, 0x0CDA, 0x08D5, 0xFFFF, 0x0760, 0x039F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x01D4, 0x0A25,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0B9E, 0x07FA, 0xFFFF, 0x0928, 0x07EB, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x03A3, 0xFFFF, 0x0063, 0x07E9, 0x00B0, 0xFFFF, 0xFFFF, 0xFFFF, 0x096C,
+  0xFFFF, 0x04C4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x00A8, 0xFFFF, 0xFFFF, 0xFFFF, 0x0C8E,
+  0x0BDF, 0xFFFF, 0xFFFF, 0x03CA, 0x0408, 0xFFFF, 0x065A, 0x0C53, 0x0219, 0xFFFF, 0x0728, 0xFFFF,
+  0x04B5, 0xFFFF, 0x0C75, 0x0CB0, 0x002E, 0x092E, 0xFFFF, 0x09BE, 0x0A3A, 0x0C61, 0xFFFF, 0xFFFF,
+  0x00B9, 0x0461, 0xFFFF, 0x081F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0789, 0xFFFF, 0x09F3,
+  0x05AC, 0xFFFF, 0x0889, 0x0495, 0x0302, 0xFFFF, 0xFFFF, 0xFFFF, 0x0727, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x04AD, 0x0251, 0x0350, 0xFFFF, 0xFFFF, 0x0973, 0x0BA8, 0xFFFF, 0x0285, 0x06DB, 0x0361, 0xFFFF,
+  0x03F6, 0x0DC3, 0xFFFF, 0x0C1A, 0x0CA6, 0x09CE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0E37, 0xFFFF,
+  0xFFFF, 0x034F, 0xFFFF, 0xFFFF, 0x0C42, 0x03D2, 0x0C83, 0x0AFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x07BF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0DE4, 0xFFFF, 0x0AE5, 0xFFFF, 0x03E1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0C5E,
+  0x0D80, 0xFFFF, 0xFFFF, 0x0D84, 0x00D1, 0xFFFF, 0x0820, 0x0478, 0xFFFF, 0xFFFF, 0x0492, 0xFFFF,
+  0x01B3, 0x0AB0, 0xFFFF, 0x080A, 0x08E9, 0x08C0, 0xFFFF, 0x09F6, 0xFFFF, 0xFFFF, 0xFFFF, 0x0C86,
+  0x0679, 0x0768, 0xFFFF, 0xFFFF, 0x07F2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0C94, 0x08E3,
+  0xFFFF, 0x062A, 0xFFFF, 0x08AE, 0xFFFF, 0xFFFF, 0xFFFF, 0x0315, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0837, 0x07D2, 0xFFFF, 0xFFFF, 0x00E1, 0x00F5, 0xFFFF, 0xFFFF, 0x052D, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0C5D, 0x086F, 0xFFFF, 0x0CF9, 0xFFFF, 0x0CAF, 0x0818, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x03FD, 0x0CDE, 0xFFFF, 0x07F9, 0x058A, 0x00F1, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0CC8, 0xFFFF, 0x0976, 0xFFFF, 0xFFFF, 0x0425, 0xFFFF, 0xFFFF, 0x041A, 0xFFFF, 0x06DE,
+  0xFFFF, 0x0A1A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x064E, 0xFFFF, 0x0156, 0x0925, 0x0199, 0xFFFF,
+  0xFFFF, 0x0AC7, 0x0824, 0xFFFF, 0x00D6, 0xFFFF, 0x0AC4, 0xFFFF, 0x0D8F, 0x07BC, 0x09A3, 0x07E4,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x00A6, 0x0BC1, 0x0683, 0xFFFF, 0xFFFF, 0x0981, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0CFE, 0xFFFF, 0xFFFF, 0x046D, 0xFFFF, 0x0C7C, 0x0118, 0x0793, 0xFFFF, 0x07CF, 0xFFFF, 0x03E8,
+  0xFFFF, 0x0B7D, 0x01FA, 0x02AD, 0x014D, 0x0684, 0x00D8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0B6D,
+  0xFFFF, 0x036B, 0x0057, 0xFFFF, 0x010B, 0xFFFF, 0xFFFF, 0x0338, 0x07D0, 0x04F1, 0xFFFF, 0x0DE0,
+  0xFFFF, 0x0C0B, 0xFFFF, 0x00DA, 0x0715, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x01EB, 0xFFFF, 0xFFFF, 0xFFFF, 0x0378, 0x01A8, 0x0347, 0x04E2, 0x006F, 0x0447, 0x0362,
+  0x0134, 0xFFFF, 0xFFFF, 0x07DC, 0xFFFF, 0xFFFF, 0x0B63, 0x0606, 0xFFFF, 0xFFFF, 0x0D6A, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0BAB, 0x0035, 0xFFFF, 0x0049, 0x02D9, 0x0459, 0xFFFF, 0x013E,
+  0x0A9C, 0xFFFF, 0xFFFF, 0x08B3, 0x0197, 0x000B, 0x0393, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x013B, 0xFFFF, 0xFFFF, 0x0012, 0xFFFF, 0x0906, 0xFFFF, 0x0BAE, 0xFFFF, 0x02E2, 0x011D, 0x0476,
+  0xFFFF, 0xFFFF, 0x0E1C, 0xFFFF, 0x0B08, 0xFFFF, 0x01DB, 0xFFFF, 0xFFFF, 0x0384, 0x0031, 0x001E,
+  0xFFFF, 0x035E, 0xFFFF, 0x06C2, 0x0C40, 0x053E, 0x0305, 0x0046, 0x06A6, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0357, 0x0014, 0x047E, 0x0184, 0x04CD, 0xFFFF, 0x04CA, 0x0B5E, 0xFFFF, 0xFFFF, 0x0E36,
+  0xFFFF, 0xFFFF, 0x0E35, 0xFFFF, 0x0CA0, 0xFFFF, 0xFFFF, 0xFFFF, 0x0706, 0x07B6, 0xFFFF, 0xFFFF,
+  0x0C9E, 0x03A2, 0x0CA7, 0xFFFF, 0xFFFF, 0x05D1, 0x024E, 0x0607, 0xFFFF, 0xFFFF, 0x00A9, 0xFFFF,
+  0x015C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0C4C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x01AF, 0xFFFF, 0xFFFF, 0x0B88, 0x0940, 0x00E3, 0x087B, 0x0ADC, 0x00E0, 0x0DF0, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x01D1, 0xFFFF, 0x0B24, 0x09DE, 0xFFFF, 0xFFFF, 0x00E5, 0xFFFF, 0x066B, 0x01A4, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0451, 0x0751, 0x01C5, 0x0815, 0xFFFF, 0x08F5, 0xFFFF, 0xFFFF, 0x01F3, 0x0615,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0DA0, 0x0DF3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0A7D, 0x075F, 0x07DB, 0xFFFF, 0x0775, 0x0995, 0x0B83, 0x07ED, 0xFFFF, 0xFFFF, 0x0CE2, 0xFFFF,
+  0x0D02, 0xFFFF, 0x0BD8, 0xFFFF, 0xFFFF, 0x09D2, 0x0DE8, 0xFFFF, 0xFFFF, 0x0CDC, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0D35, 0x01CC, 0x01A9, 0xFFFF, 0x0E26, 0xFFFF, 0xFFFF, 0x048A, 0x0D59, 0xFFFF,
+  0xFFFF, 0x09D3, 0xFFFF, 0xFFFF, 0x0D73, 0x01ED, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0064, 0xFFFF,
+  0x0847, 0x0CD3, 0xFFFF, 0x0004, 0x09E2, 0xFFFF, 0x0A1B, 0x0A62, 0x03D6, 0xFFFF, 0x00B8, 0x08ED,
+  0x0A30, 0xFFFF, 0xFFFF, 0x0D41, 0x01E6, 0x0426, 0x0650, 0x08E8, 0xFFFF, 0x0DDE, 0x0508, 0xFFFF,
+  0x05E3, 0xFFFF, 0x0045, 0xFFFF, 0xFFFF, 0xFFFF, 0x098C, 0x09E7, 0xFFFF, 0x0BE4, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x095C, 0xFFFF, 0x0DB7, 0xFFFF, 0xFFFF, 0x00D0, 0xFFFF, 0xFFFF,
+  0x0901, 0x09AB, 0xFFFF, 0x045A, 0x0D5B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x07C2, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0484, 0x0470, 0x0854, 0xFFFF, 0xFFFF, 0x0272, 0x0D9D, 0xFFFF, 0xFFFF, 0x04EC,
+  0xFFFF, 0x0D54, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0942, 0xFFFF, 0xFFFF,
+  0x0B8F, 0xFFFF, 0xFFFF, 0x08EF, 0x031F, 0x0AF3, 0xFFFF, 0x05B3, 0xFFFF, 0xFFFF, 0xFFFF, 0x0628,
+  0x0AE6, 0x007B, 0xFFFF, 0x0DCB, 0xFFFF, 0x063F, 0x0C28, 0x0833, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x090C, 0xFFFF, 0x061B, 0x0659, 0xFFFF, 0x0005, 0xFFFF, 0xFFFF, 0x0165, 0x0BEC,
+  0xFFFF, 0x05D3, 0xFFFF, 0x0277, 0x0A75, 0xFFFF, 0x04AB, 0xFFFF, 0x0069, 0x0C60, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x04AA, 0x0B09, 0x0368, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0240, 0xFFFF, 0x0834, 0xFFFF, 0xFFFF, 0xFFFF, 0x0E19, 0xFFFF, 0xFFFF, 0x08C8, 0x0160, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x01CB, 0x0BD6, 0xFFFF, 0x0A6F, 0x06C0, 0xFFFF, 0xFFFF, 0x06B5, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x05DD, 0xFFFF, 0xFFFF, 0x08DA, 0x0CBB, 0x01B4, 0x0245,
+  0xFFFF, 0xFFFF, 0x0D9F, 0xFFFF, 0xFFFF, 0x030F, 0xFFFF, 0x0D86, 0x0168, 0xFFFF, 0x00E7, 0xFFFF,
+  0x0B29, 0x0843, 0x0708, 0x049A, 0xFFFF, 0xFFFF, 0xFFFF, 0x035A, 0x0D3C, 0x069D, 0xFFFF, 0xFFFF,
+  0x0432, 0x0856, 0x07D9, 0xFFFF, 0xFFFF, 0x0359, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0716, 0xFFFF, 0xFFFF, 0xFFFF, 0x057D, 0xFFFF, 0xFFFF, 0x0A9A, 0xFFFF, 0x004D, 0x059A,
+  0x0421, 0xFFFF, 0x07E1, 0x0138, 0xFFFF, 0xFFFF, 0x0B57, 0xFFFF, 0xFFFF, 0xFFFF, 0x07EF, 0x05CD,
+  0xFFFF, 0x0D56, 0xFFFF, 0xFFFF, 0x04F3, 0xFFFF, 0xFFFF, 0xFFFF, 0x0342, 0x094F, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0145, 0x079A, 0xFFFF, 0xFFFF, 0x02B2, 0x09CF, 0x038F, 0x0033, 0x05CB, 0x068D, 0x0A2D,
+  0xFFFF, 0xFFFF, 0x0023, 0x0896, 0x0831, 0x03A4, 0xFFFF, 0xFFFF, 0x046C, 0xFFFF, 0x008D, 0xFFFF,
+  0x0256, 0x0AEB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x01E1, 0xFFFF, 0x0C90, 0xFFFF, 0xFFFF, 0x0BDC,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x057E, 0xFFFF, 0xFFFF, 0xFFFF, 0x077D, 0x02D5, 0x01F9, 0xFFFF,
+  0x0ACF, 0x0790, 0xFFFF, 0xFFFF, 0x0858, 0x0D6D, 0x08A2, 0xFFFF, 0x0263, 0x02B3, 0x097D, 0x050D,
+  0xFFFF, 0xFFFF, 0x0A90, 0xFFFF, 0xFFFF, 0xFFFF, 0x027F, 0xFFFF, 0xFFFF, 0x03A5, 0x0A0B, 0xFFFF,
+  0xFFFF, 0x0A54, 0x0B6E, 0xFFFF, 0x0D06, 0x0C6D, 0x0559, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0D1D, 0x077B, 0xFFFF, 0x036A, 0xFFFF, 0x02FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0CC5, 0xFFFF, 0xFFFF, 0xFFFF, 0x008A, 0xFFFF, 0x02DF, 0xFFFF, 0x004C, 0xFFFF, 0xFFFF,
+  0x020C, 0x0136, 0x05DA, 0xFFFF, 0xFFFF, 0x0887, 0xFFFF, 0x0D99, 0xFFFF, 0xFFFF, 0x06FC, 0x0D5E,
+  0x05A8, 0x01AC, 0x0C02, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0B58, 0x036E, 0xFFFF, 0xFFFF, 0x0746,
+  0xFFFF, 0x03C6, 0xFFFF, 0xFFFF, 0xFFFF, 0x086A, 0xFFFF, 0x0246, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0D62, 0xFFFF, 0x0337, 0xFFFF, 0xFFFF, 0xFFFF, 0x0DF5, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0620, 0x0BAA, 0x0387, 0xFFFF, 0x0B71, 0x03AB, 0xFFFF, 0x02D8, 0x0594, 0x0D77, 0x0BB4,
+  0xFFFF, 0x04A1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0D1A, 0xFFFF, 0x0D40, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x082C, 0xFFFF, 0xFFFF, 0x0671, 0xFFFF, 0xFFFF, 0x041F, 0xFFFF,
+  0xFFFF, 0x0A12, 0xFFFF, 0xFFFF, 0x0271, 0xFFFF, 0x082E, 0x057F, 0xFFFF, 0xFFFF, 0x0917, 0xFFFF,
+  0x0C8F, 0x04F9, 0xFFFF, 0xFFFF, 0xFFFF, 0x0352, 0xFFFF, 0xFFFF, 0x0804, 0x07B1, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x02EA, 0x0AAD, 0x0B39, 0xFFFF, 0xFFFF, 0x0578,
+  0x054F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0580, 0xFFFF, 0x06D0, 0xFFFF, 0xFFFF,
+  0x0939, 0xFFFF, 0xFFFF, 0xFFFF, 0x0C10, 0x0109, 0x0A2C, 0xFFFF, 0x0008, 0x00FD, 0xFFFF, 0x088F,
+  0x06FB, 0x0BA4, 0x06F8, 0x0DA9, 0x0A98, 0xFFFF, 0x0ABD, 0x00D2, 0xFFFF, 0x0CEF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x044A, 0xFFFF, 0x079E, 0x00DC, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0946, 0x0633, 0xFFFF, 0x063B, 0xFFFF, 0x0E2F, 0xFFFF, 0x0A33, 0x03A0, 0x00DF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0A93, 0xFFFF, 0xFFFF, 0x04F2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0C81, 0xFFFF, 0x0616, 0xFFFF, 0xFFFF, 0xFFFF, 0x0AFF, 0xFFFF,
+  0xFFFF, 0x0DAE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0079, 0x0C2C, 0xFFFF, 0x053C, 0xFFFF, 0x0C07,
+  0x09D1, 0xFFFF, 0x07C7, 0x02ED, 0x0992, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x07BA, 0xFFFF,
+  0x0AFE, 0xFFFF, 0x05DF, 0x049F, 0x041B, 0x0782, 0x0CB4, 0xFFFF, 0xFFFF, 0x0587, 0x0D5F, 0x034D,
+  0x066A, 0x0DD7, 0xFFFF, 0xFFFF, 0x0382, 0xFFFF, 0xFFFF, 0x04E6, 0xFFFF, 0x0DDA, 0x07FF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x050A, 0x03B2, 0x0CBA, 0xFFFF, 0xFFFF, 0x0A27, 0xFFFF, 0xFFFF, 0x0149,
+  0x0E21, 0x0253, 0xFFFF, 0x0411, 0x0619, 0xFFFF, 0x0704, 0x0040, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0C4D, 0xFFFF, 0xFFFF, 0x022A, 0x0AAE, 0xFFFF, 0xFFFF, 0x04C7, 0xFFFF, 0x0222,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0610, 0xFFFF, 0xFFFF, 0x08D4, 0xFFFF, 0xFFFF, 0xFFFF, 0x06E6, 0xFFFF,
+  0x098D, 0x009F, 0xFFFF, 0xFFFF, 0xFFFF, 0x03AA, 0x019D, 0x05B0, 0x05AE, 0xFFFF, 0x0B9D, 0xFFFF,
+  0xFFFF, 0x009E, 0xFFFF, 0xFFFF, 0xFFFF, 0x05C8, 0xFFFF, 0xFFFF, 0x021C, 0xFFFF, 0x0D74, 0x0DBE,
+  0xFFFF, 0x08CB, 0x0A84, 0xFFFF, 0x06B0, 0xFFFF, 0x0CC1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x02D0, 0xFFFF, 0x0336, 0x0BB5, 0x0388, 0x01C6, 0x0374, 0xFFFF, 0x0346, 0x0398,
+  0x0DBC, 0x0241, 0x0761, 0xFFFF, 0x0950, 0xFFFF, 0x0195, 0xFFFF, 0x00C3, 0xFFFF, 0x0BF2, 0x03E5,
+  0x0879, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x02C3, 0xFFFF, 0x0BCA, 0xFFFF, 0x0788,
+  0x072B, 0xFFFF, 0x045F, 0x0418, 0x00D9, 0xFFFF, 0x0AAC, 0xFFFF, 0x0163, 0xFFFF, 0x0CED, 0x00F2,
+  0xFFFF, 0x0A8F, 0xFFFF, 0xFFFF, 0xFFFF, 0x0A1F, 0x0481, 0x06B9, 0xFFFF, 0xFFFF, 0x0450, 0xFFFF,
+  0x009A, 0x093C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x000F, 0xFFFF, 0x0838, 0x098B, 0xFFFF,
+  0x06AC, 0xFFFF, 0xFFFF, 0x067E, 0xFFFF, 0x0960, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x029C,
+  0xFFFF, 0xFFFF, 0x0065, 0x097A, 0x079C, 0xFFFF, 0x0672, 0xFFFF, 0xFFFF, 0x082F, 0x09AD, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0483, 0xFFFF, 0xFFFF, 0xFFFF, 0x0DD8, 0x0924,
+  0xFFFF, 0xFFFF, 0x0C21, 0xFFFF, 0x0561, 0xFFFF, 0xFFFF, 0xFFFF, 0x0D1C, 0x0DF6, 0xFFFF, 0x0416,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0CC7, 0xFFFF, 0xFFFF, 0x04CC, 0x000C, 0xFFFF, 0x093D, 0x0605,
+  0xFFFF, 0x02C7, 0xFFFF, 0xFFFF, 0x0880, 0x0D25, 0x07D3, 0x06B7, 0xFFFF, 0xFFFF, 0xFFFF, 0x0D38,
+  0xFFFF, 0x0747, 0x065E, 0x0BD7, 0x0931, 0xFFFF, 0x0548, 0xFFFF, 0x05F6, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0A16, 0x0C44, 0x0809, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x09B0, 0x0D22, 0x04A5, 0x04C9, 0x0D2F, 0xFFFF, 0x06B3, 0x004A, 0xFFFF, 0x0BDD,
+  0xFFFF, 0x07A2, 0x0B40, 0x014B, 0xFFFF, 0x07D1, 0x0A5B, 0x00FA, 0xFFFF, 0xFFFF, 0x04EE, 0x02E7,
+  0x02EE, 0xFFFF, 0x02CF, 0xFFFF, 0xFFFF, 0x080D, 0x0175, 0xFFFF, 0x0576, 0xFFFF, 0xFFFF, 0x0A4F,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x033F, 0x03EF, 0xFFFF, 0x0664, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0CE0, 0xFFFF, 0xFFFF, 0x0997, 0xFFFF, 0x0B31, 0xFFFF, 0xFFFF, 0x04BA, 0x0A74, 0x0270, 0xFFFF,
+  0x0B7E, 0xFFFF, 0xFFFF, 0x0A53, 0xFFFF, 0xFFFF, 0xFFFF, 0x0019, 0xFFFF, 0xFFFF, 0x0A39, 0xFFFF,
+  0xFFFF, 0x0D29, 0x05B2, 0xFFFF, 0xFFFF, 0xFFFF, 0x0B74, 0xFFFF, 0x071A, 0x07AA, 0xFFFF, 0x009B,
+  0x022B, 0x079B, 0x0649, 0xFFFF, 0x0711, 0xFFFF, 0xFFFF, 0x0C00, 0x0898, 0x04C6, 0xFFFF, 0x0C25,
+  0xFFFF, 0x017F, 0xFFFF, 0x06E7, 0xFFFF, 0x04DE, 0xFFFF, 0xFFFF, 0x0517, 0xFFFF, 0xFFFF, 0x0A61,
+  0x023F, 0x071C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0C2F, 0xFFFF, 0xFFFF, 0xFFFF, 0x072A, 0x0332,
+  0xFFFF, 0x019F, 0xFFFF, 0xFFFF, 0x0428, 0x0BE5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x01BD, 0xFFFF, 0x0975, 0x0067, 0x0D83, 0x0D58, 0xFFFF, 0xFFFF, 0xFFFF, 0x0390,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0A6E, 0xFFFF, 0xFFFF, 0xFFFF, 0x075D, 0xFFFF, 0x095F, 0x0C49, 0xFFFF,
+  0x0770, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x076B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0010,
+  0x04FE, 0x0677, 0x0BD2, 0xFFFF, 0x05B6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x06FA, 0xFFFF, 0x0AD6,
+  0xFFFF, 0xFFFF, 0x03E0, 0xFFFF, 0x0883, 0x0B46, 0xFFFF, 0xFFFF, 0xFFFF, 0x09DC, 0x05AF, 0xFFFF,
+  0x0626, 0xFFFF, 0x0058, 0xFFFF, 0xFFFF, 0x0CC0, 0xFFFF, 0xFFFF, 0xFFFF, 0x06CC, 0x063A, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x06B8, 0x063D, 0xFFFF, 0x0A1D, 0xFFFF, 0xFFFF, 0x052C, 0x0D8A,
+  0xFFFF, 0x0170, 0xFFFF, 0x03FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x01AE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0AE4, 0x05DC, 0x07F4,
+  0x0C8C, 0x022E, 0xFFFF, 0xFFFF, 0x0CE8, 0x0823, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0C11,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0C98, 0x0BAC, 0xFFFF, 0x054C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0579, 0xFFFF, 0x02A3, 0x03CB, 0x0BEA, 0x019C, 0x050B, 0xFFFF, 0xFFFF, 0x0636, 0xFFFF, 0x0871,
+  0xFFFF, 0x094D, 0x0D00, 0xFFFF, 0x043A, 0x0593, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x024C, 0xFFFF,
+  0x0BCB, 0x0430, 0x0528, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x08FD,
+  0xFFFF, 0x090B, 0xFFFF, 0x0D61, 0x0E3B, 0xFFFF, 0x02D3, 0x0E29, 0xFFFF, 0x08E5, 0x0CCD, 0x07AC,
+  0xFFFF, 0xFFFF, 0x098A, 0xFFFF, 0x061C, 0x07FC, 0x0675, 0x0961, 0x0DB6, 0x00BA, 0x07F6, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x08B1, 0x03BA, 0xFFFF, 0x058B, 0xFFFF, 0x014F, 0xFFFF, 0xFFFF, 0x0A68, 0x02B0,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0A21, 0xFFFF, 0xFFFF, 0xFFFF, 0x0264, 0x0137, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x06D7, 0xFFFF, 0x092F, 0x0513, 0xFFFF, 0x0C85, 0xFFFF, 0x06BB, 0xFFFF, 0xFFFF, 0x0945, 0x02CD,
+  0x0075, 0xFFFF, 0xFFFF, 0x0161, 0x042A, 0x0D8B, 0xFFFF, 0xFFFF, 0x02DB, 0xFFFF, 0x03E2, 0x0464,
+  0xFFFF, 0xFFFF, 0x0333, 0xFFFF, 0x0AB5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x002C, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x06A0, 0x0C87, 0xFFFF, 0x0142, 0xFFFF, 0xFFFF, 0xFFFF, 0x0B53, 0x0644, 0xFFFF,
+  0x0814, 0xFFFF, 0x09A9, 0xFFFF, 0x0AC6, 0xFFFF, 0x0524, 0xFFFF, 0xFFFF, 0x0763, 0x0CDD, 0x0733,
+  0xFFFF, 0x05D4, 0xFFFF, 0x05C6, 0xFFFF, 0xFFFF, 0xFFFF, 0x0218, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x02EB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0339, 0x0BFF, 0x0229, 0xFFFF,
+  0x09CD, 0xFFFF, 0xFFFF, 0x0B6F, 0x08F4, 0x0C1D, 0xFFFF, 0x0C4B, 0x0348, 0x067F, 0xFFFF, 0xFFFF,
+  0x04E8, 0x0A7B, 0xFFFF, 0xFFFF, 0x03BC, 0xFFFF, 0x08DC, 0xFFFF, 0x0B34, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0D45, 0x02A0, 0x0AA1, 0xFFFF, 0x0A1C, 0xFFFF, 0xFFFF, 0x06CA, 0xFFFF, 0xFFFF, 0x051A,
+  0xFFFF, 0xFFFF, 0x029B, 0x01AA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0C63, 0xFFFF, 0xFFFF,
+  0x003F, 0xFFFF, 0x080F, 0x0455, 0xFFFF, 0x0905, 0x04C1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0CCF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x068F, 0x0622, 0xFFFF, 0x0AB8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x03B3, 0x01F8, 0x094B, 0x03C2, 0xFFFF, 0x00DE, 0xFFFF, 0x099B, 0xFFFF, 0x070A, 0xFFFF,
+  0xFFFF, 0x0DED, 0xFFFF, 0x01CF, 0x0AE7, 0xFFFF, 0xFFFF, 0x05BB, 0xFFFF, 0x0B92, 0x0A14, 0xFFFF,
+  0xFFFF, 0x0438, 0x0DDB, 0x034B, 0xFFFF, 0xFFFF, 0x047D, 0xFFFF, 0xFFFF, 0x029E, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x03A9, 0xFFFF, 0xFFFF, 0x01F1, 0x0D3B, 0xFFFF, 0xFFFF, 0x020D, 0xFFFF, 0x09B4,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0DB9, 0xFFFF, 0xFFFF, 0x0414,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0A51, 0x013A, 0xFFFF, 0xFFFF, 0x0150, 0xFFFF, 0xFFFF, 0x0B54, 0xFFFF,
+  0x0772, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0B59, 0x0BC3, 0x0595, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0115, 0x0982, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x07DA, 0xFFFF, 0xFFFF, 0xFFFF, 0x0777, 0xFFFF, 0xFFFF, 0x021F, 0xFFFF, 0xFFFF, 0xFFFF, 0x04A0,
+  0xFFFF, 0xFFFF, 0x0B61, 0xFFFF, 0xFFFF, 0x0E11, 0xFFFF, 0xFFFF, 0x0CD8, 0xFFFF, 0x0DE7, 0x00A0,
+  0x0A6B, 0xFFFF, 0x0828, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0608, 0x083B, 0xFFFF, 0xFFFF, 0x0AD3,
+  0xFFFF, 0xFFFF, 0x00B5, 0x0964, 0x06A3, 0x003B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x02E1, 0x01B0, 0x0166, 0x0846, 0xFFFF, 0x0936, 0x0AB9, 0x0702, 0xFFFF,
+  0x0D68, 0x03EA, 0xFFFF, 0x0292, 0xFFFF, 0x0D70, 0xFFFF, 0xFFFF, 0x0C5C, 0x09B5, 0x01C0, 0xFFFF,
+  0x06D9, 0xFFFF, 0x03DF, 0xFFFF, 0x0D3A, 0x0392, 0xFFFF, 0xFFFF, 0x085B, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x08D1, 0xFFFF, 0xFFFF, 0xFFFF, 0x02A8, 0x0729, 0x0AAB, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x03C8, 0x091E, 0x00C5, 0x07E3, 0xFFFF, 0x01C1, 0x001F, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x09A7, 0x0904, 0x060D, 0x04B7, 0xFFFF, 0xFFFF, 0x0681, 0xFFFF, 0xFFFF, 0x0DEF, 0xFFFF, 0x01A5,
+  0x061F, 0x082A, 0xFFFF, 0x0B0A, 0x0B47, 0xFFFF, 0xFFFF, 0x08FA, 0xFFFF, 0x0929, 0x073D, 0xFFFF,
+  0x0E09, 0x05F2, 0xFFFF, 0xFFFF, 0xFFFF, 0x01A3, 0xFFFF, 0x0B19, 0xFFFF, 0x02A5, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x02C2, 0xFFFF, 0xFFFF, 0xFFFF, 0x067C, 0x0365, 0x03B6,
+  0x0D95, 0x02F7, 0x0298, 0x0502, 0x0C1B, 0x0A4D, 0xFFFF, 0xFFFF, 0xFFFF, 0x0806, 0x0158, 0x041D,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x011A, 0xFFFF, 0x0D4B, 0xFFFF, 0xFFFF, 0xFFFF, 0x0CEE, 0xFFFF, 0xFFFF,
+  0x094E, 0xFFFF, 0x0D1E, 0xFFFF, 0xFFFF, 0x047C, 0x06F6, 0xFFFF, 0x0BDE, 0xFFFF, 0xFFFF, 0x07C5,
+  0x06BA, 0xFFFF, 0xFFFF, 0xFFFF, 0x0E30, 0x0836, 0x0B4B, 0xFFFF, 0x06ED, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0BD3, 0xFFFF, 0x081B, 0x04D0, 0x03F9, 0x09CB, 0xFFFF, 0x09FF, 0x0B20, 0x06DA, 0x061E, 0xFFFF,
+  0xFFFF, 0x0C29, 0x0A4E, 0xFFFF, 0x02F3, 0x0AE8, 0x089C, 0xFFFF, 0xFFFF, 0x0686, 0x0CA8, 0x06AB,
+  0x04A3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x090F, 0x0697, 0x0233, 0xFFFF, 0xFFFF, 0x0335,
+  0xFFFF, 0xFFFF, 0x0890, 0xFFFF, 0x02BE, 0x0753, 0x0399, 0x0AD4, 0xFFFF, 0xFFFF, 0xFFFF, 0x0C97,
+  0x0B8A, 0xFFFF, 0x0C32, 0x0151, 0xFFFF, 0x02AA, 0xFFFF, 0x08C9, 0xFFFF, 0xFFFF, 0xFFFF, 0x0C73,
+  0x04D9, 0x019B, 0xFFFF, 0xFFFF, 0xFFFF, 0x0DDD, 0x0E1B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0B78,
+  0x093F, 0xFFFF, 0xFFFF, 0xFFFF, 0x0968, 0x0A8E, 0xFFFF, 0xFFFF, 0x00FC, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x07DF, 0xFFFF, 0x0850, 0x0692, 0xFFFF, 0xFFFF, 0xFFFF, 0x08C4, 0xFFFF, 0x0261, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x054D, 0xFFFF, 0x0BC4, 0x0BF5, 0x0442, 0xFFFF, 0xFFFF, 0x0573, 0x03E3, 0xFFFF,
+  0x0CC6, 0xFFFF, 0x033E, 0xFFFF, 0xFFFF, 0xFFFF, 0x09A8, 0xFFFF, 0x0D87, 0x0540, 0x0CC3, 0x030C,
+  0xFFFF, 0xFFFF, 0x0CE7, 0x0B13, 0xFFFF, 0xFFFF, 0x0AD0, 0x0B5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0830, 0x044C, 0xFFFF, 0xFFFF, 0xFFFF, 0x00CE, 0xFFFF, 0x0D7A, 0xFFFF, 0xFFFF, 0x043D,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x08A7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0379, 0x0C17, 0x0DFF, 0xFFFF, 0xFFFF, 0x0042, 0xFFFF, 0xFFFF, 0x0CB5, 0xFFFF,
+  0x09DF, 0xFFFF, 0xFFFF, 0xFFFF, 0x01C4, 0x0802, 0x07B3, 0xFFFF, 0x0380, 0x0D31, 0xFFFF, 0x084C,
+  0xFFFF, 0x0ADF, 0x0CE5, 0x097E, 0xFFFF, 0x029F, 0xFFFF, 0xFFFF, 0xFFFF, 0x0491, 0xFFFF, 0x05FB,
+  0x0E1D, 0x0394, 0xFFFF, 0x0CBE, 0xFFFF, 0x0DF2, 0x0282, 0xFFFF, 0xFFFF, 0x031B, 0x0B06, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0885, 0x05F7, 0xFFFF, 0xFFFF, 0x0801, 0xFFFF, 0xFFFF, 0x046B, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x008E, 0x0694, 0x0329, 0x015B, 0x07A1, 0x02B4, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0873, 0xFFFF, 0xFFFF, 0x0A41, 0x0BB1, 0xFFFF, 0x065B, 0x074A, 0xFFFF, 0x014C, 0x0176, 0x01BC,
+  0x01B9, 0x0844, 0x0762, 0x02F1, 0xFFFF, 0xFFFF, 0x0D18, 0x0589, 0x0B17, 0x0213, 0xFFFF, 0xFFFF,
+  0x0DB8, 0x0689, 0x0DE6, 0xFFFF, 0x0A44, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x099A, 0xFFFF, 0x0018,
+  0xFFFF, 0x039E, 0x06A7, 0xFFFF, 0xFFFF, 0xFFFF, 0x0B82, 0xFFFF, 0xFFFF, 0x038B, 0xFFFF, 0x0874,
+  0x05E6, 0xFFFF, 0xFFFF, 0xFFFF, 0x0469, 0xFFFF, 0x088D, 0x00C4, 0xFFFF, 0x07A8, 0xFFFF, 0x01FC,
+  0xFFFF, 0x0522, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0CCE, 0x0A45, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x071B, 0x085F, 0xFFFF, 0x0554, 0x0C76, 0x074D, 0x0812, 0x02B1, 0x0893, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x05F3, 0xFFFF, 0xFFFF, 0x0A05, 0x0954, 0xFFFF, 0x0642, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x048F, 0x0845, 0xFFFF, 0x0D9C, 0xFFFF, 0x0126, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0DC6, 0x0370, 0xFFFF, 0xFFFF, 0x05CF, 0xFFFF, 0x070D, 0xFFFF,
+  0x0909, 0xFFFF, 0xFFFF, 0x0C12, 0xFFFF, 0xFFFF, 0x06C6, 0xFFFF, 0xFFFF, 0x0D1F, 0xFFFF, 0x0953,
+  0xFFFF, 0x0BCD, 0x0DCD, 0xFFFF, 0xFFFF, 0x09BA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0BA2, 0xFFFF,
+  0x0106, 0xFFFF, 0x076A, 0xFFFF, 0xFFFF, 0x00AD, 0xFFFF, 0x00A5, 0xFFFF, 0x01A7, 0x02BF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x02AF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0A10, 0xFFFF, 0x0123, 0xFFFF, 0x07D6, 0xFFFF,
+  0x06E2, 0xFFFF, 0x0781, 0x07FB, 0x0D72, 0x0720, 0xFFFF, 0xFFFF, 0xFFFF, 0x0571, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0A87, 0x034E, 0xFFFF, 0xFFFF, 0x03E7, 0xFFFF, 0x08EC, 0xFFFF, 0x06C5, 0xFFFF,
+  0x0A11, 0x06EB, 0x0794, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0AAA, 0x067A, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0132, 0xFFFF, 0xFFFF, 0x0DA1, 0x01DD, 0xFFFF, 0xFFFF, 0xFFFF, 0x044F, 0xFFFF, 0x0822,
+  0x09C6, 0xFFFF, 0x0BCC, 0x0CCC, 0xFFFF, 0xFFFF, 0x0405, 0xFFFF, 0x025E, 0x017E, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0202, 0xFFFF, 0xFFFF, 0x00BF, 0xFFFF, 0xFFFF, 0x093A, 0x0DC8, 0xFFFF, 0x060C,
+  0xFFFF, 0x0044, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x051B, 0xFFFF, 0xFFFF, 0x0431, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x09E5, 0xFFFF, 0x0BEE, 0x0A24, 0x09F9, 0x0652, 0xFFFF, 0x0A9B, 0xFFFF,
+  0x01BF, 0x0CE1, 0xFFFF, 0xFFFF, 0x02B9, 0xFFFF, 0xFFFF, 0xFFFF, 0x03ED, 0x0A3C, 0x06C1, 0x0371,
+  0x007E, 0x0215, 0x0C71, 0xFFFF, 0xFFFF, 0xFFFF, 0x0DC9, 0xFFFF, 0x09D9, 0xFFFF, 0x058C, 0x0BFA,
+  0xFFFF, 0x0654, 0x033D, 0xFFFF, 0xFFFF, 0xFFFF, 0x07C8, 0xFFFF, 0xFFFF, 0x056D, 0xFFFF, 0x03A7,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x03CD, 0x0463, 0x0CB7, 0x0113, 0xFFFF, 0xFFFF, 0xFFFF, 0x0A6A, 0xFFFF,
+  0xFFFF, 0x0DF4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x036F, 0xFFFF, 0x0CD4, 0xFFFF, 0x021A, 0xFFFF, 0xFFFF, 0x0029, 0xFFFF, 0xFFFF, 0x0143,
+  0xFFFF, 0x0A20, 0xFFFF, 0x0825, 0x04DC, 0x0B91, 0x00AA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0CA3, 0xFFFF, 0xFFFF, 0x0A6C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0662, 0xFFFF, 0xFFFF, 0xFFFF, 0x00C7, 0xFFFF, 0xFFFF, 0xFFFF, 0x0732, 0x0068, 0xFFFF, 0x090A,
+  0xFFFF, 0x0977, 0x03F8, 0xFFFF, 0x09F0, 0x09FA, 0x03F4, 0xFFFF, 0xFFFF, 0x00AE, 0xFFFF, 0x087A,
+  0x0AC0, 0x00ED, 0xFFFF, 0x04B4, 0xFFFF, 0x07C6, 0x0E07, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0A71,
+  0x0D0B, 0xFFFF, 0x0AD7, 0x04B8, 0x02BA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x02EF, 0x0503, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x05A7, 0xFFFF, 0xFFFF, 0x0E28, 0x02E4, 0xFFFF, 0x071D, 0x0021, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0E01, 0x05A1, 0xFFFF, 0xFFFF, 0xFFFF, 0x0111, 0xFFFF, 0x0714, 0x043B, 0x04DF, 0x07A9,
+  0x0D2D, 0xFFFF, 0xFFFF, 0x037E, 0x0974, 0x03A8, 0x0B26, 0xFFFF, 0xFFFF, 0x08C7, 0x02D7, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0201, 0x024F, 0x0AFD, 0xFFFF, 0xFFFF, 0x02DE, 0xFFFF, 0x0515, 0xFFFF,
+  0xFFFF, 0x0DA6, 0xFFFF, 0x0DF7, 0x09AE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0CB8, 0xFFFF, 0x08B0,
+  0x0DCC, 0xFFFF, 0xFFFF, 0xFFFF, 0x0200, 0x0749, 0xFFFF, 0x0B4A, 0xFFFF, 0x0695, 0x0B4E, 0xFFFF,
+  0x0313, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0A79, 0x0B69, 0x0668, 0x0E0E, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0A04, 0xFFFF, 0x00D5, 0xFFFF, 0x0504, 0xFFFF, 0xFFFF, 0x0919, 0xFFFF, 0x00A4, 0xFFFF,
+  0xFFFF, 0x024D, 0x0DFE, 0xFFFF, 0x0210, 0xFFFF, 0x04EF, 0x0C14, 0xFFFF, 0x05C1, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0862, 0x088A, 0xFFFF, 0x04BB, 0xFFFF, 0x0750, 0x0BEF, 0x0AE0, 0x04E9, 0x0C18, 0x0CB2,
+  0xFFFF, 0x0667, 0xFFFF, 0xFFFF, 0xFFFF, 0x0D91, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x06EF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0937, 0xFFFF, 0x045B, 0xFFFF, 0x0CF5, 0x0B44, 0x02AE,
+  0xFFFF, 0xFFFF, 0x0498, 0xFFFF, 0x01FD, 0x033A, 0x092A, 0xFFFF, 0xFFFF, 0x06FE, 0xFFFF, 0x0D04,
+  0xFFFF, 0x06F7, 0xFFFF, 0x0BB2, 0xFFFF, 0xFFFF, 0xFFFF, 0x012B, 0x04A4, 0xFFFF, 0x02AB, 0xFFFF,
+  0xFFFF, 0x067D, 0xFFFF, 0xFFFF, 0xFFFF, 0x0169, 0xFFFF, 0xFFFF, 0x07A0, 0x05EA, 0x0396, 0xFFFF,
+  0xFFFF, 0x0891, 0xFFFF, 0x0D2A, 0xFFFF, 0xFFFF, 0x0588, 0x0B62, 0xFFFF, 0xFFFF, 0xFFFF, 0x0AE9,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x04D7, 0x0ADA, 0xFFFF, 0xFFFF, 0x0C88, 0x057A, 0xFFFF, 0x0BA9,
+  0x0555, 0x0B22, 0x03F7, 0x042D, 0x06EA, 0x0E18, 0xFFFF, 0x095A, 0xFFFF, 0xFFFF, 0xFFFF, 0x0673,
+  0x0734, 0x00C9, 0x0521, 0x0BE6, 0x0071, 0x0174, 0x0420, 0xFFFF, 0x09F5, 0xFFFF, 0x0886, 0x030B,
+  0xFFFF, 0xFFFF, 0x04DA, 0xFFFF, 0x0BC6, 0x0AAF, 0x0E00, 0x0B00, 0x0902, 0xFFFF, 0x0128, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0CA9, 0x0BBC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0278, 0xFFFF, 0xFFFF, 0x0712, 0xFFFF, 0x0581, 0xFFFF, 0xFFFF, 0x0B0D, 0xFFFF, 0xFFFF,
+  0x09B8, 0xFFFF, 0x03F5, 0xFFFF, 0x003C, 0x0E17, 0xFFFF, 0x0BBA, 0x0C9D, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x09A1, 0x0E0F, 0xFFFF, 0xFFFF, 0xFFFF, 0x0122, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0D16, 0x013C, 0xFFFF, 0xFFFF, 0x026B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x03BB, 0x087F,
+  0x0BA5, 0xFFFF, 0xFFFF, 0x0549, 0xFFFF, 0x0A63, 0xFFFF, 0x0099, 0x0766, 0xFFFF, 0xFFFF, 0x031E,
+  0xFFFF, 0xFFFF, 0x0767, 0x0AC9, 0x0848, 0xFFFF, 0x0972, 0x0745, 0xFFFF, 0x011F, 0x080B, 0xFFFF,
+  0xFFFF, 0x050C, 0x04D4, 0xFFFF, 0xFFFF, 0x0482, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0A70, 0x0BB3,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x045D, 0xFFFF, 0xFFFF, 0xFFFF, 0x030E, 0xFFFF, 0xFFFF, 0x0D12,
+  0xFFFF, 0x023B, 0xFFFF, 0xFFFF, 0x0584, 0xFFFF, 0x0C3E, 0xFFFF, 0x0C72, 0x040B, 0x0AB7, 0xFFFF,
+  0xFFFF, 0x0D47, 0xFFFF, 0xFFFF, 0x0BFC, 0x021E, 0xFFFF, 0x09D8, 0xFFFF, 0x0531, 0x087C, 0x0D13,
+  0xFFFF, 0x08E2, 0xFFFF, 0xFFFF, 0x0409, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0445, 0xFFFF,
+  0x04C0, 0xFFFF, 0x0625, 0xFFFF, 0x0D42, 0xFFFF, 0x04B6, 0xFFFF, 0x01EC, 0x0326, 0x0CC4, 0x04A2,
+  0x0864, 0xFFFF, 0x0990, 0x042C, 0x01D8, 0xFFFF, 0xFFFF, 0x022F, 0xFFFF, 0x045E, 0xFFFF, 0xFFFF,
+  0x0BFD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x05D0, 0xFFFF, 0xFFFF, 0x0112, 0xFFFF,
+  0xFFFF, 0x0386, 0x09C0, 0x0209, 0xFFFF, 0xFFFF, 0xFFFF, 0x0971, 0xFFFF, 0x02A6, 0xFFFF, 0xFFFF,
+  0x0C67, 0xFFFF, 0x0640, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0934, 0xFFFF, 0x0585,
+  0x0DB4, 0x0D26, 0x09B1, 0xFFFF, 0x099D, 0x0590, 0xFFFF, 0x0472, 0xFFFF, 0x02E3, 0x0CB1, 0xFFFF,
+  0xFFFF, 0x0CEA, 0xFFFF, 0xFFFF, 0xFFFF, 0x0617, 0x04C3, 0x000E, 0xFFFF, 0xFFFF, 0x041C, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x05F1, 0x0295, 0xFFFF, 0xFFFF, 0x0B95, 0x0DA4, 0xFFFF,
+  0x00DB, 0xFFFF, 0xFFFF, 0x052A, 0x0403, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x028E, 0x06C7,
+  0xFFFF, 0x047F, 0x04D1, 0x048B, 0x0C6C, 0x048E, 0x0258, 0x0198, 0xFFFF, 0xFFFF, 0xFFFF, 0x0D52,
+  0xFFFF, 0xFFFF, 0x031C, 0xFFFF, 0xFFFF, 0xFFFF, 0x086E, 0xFFFF, 0x0958, 0x00B3, 0xFFFF, 0x0488,
+  0xFFFF, 0x0B5C, 0xFFFF, 0x0015, 0x080C, 0xFFFF, 0xFFFF, 0x0D7D, 0x0AFC, 0xFFFF, 0x0D69, 0x0978,
+  0x09B7, 0xFFFF, 0x00AC, 0x052B, 0x020B, 0x0D48, 0x0A4A, 0x022D, 0xFFFF, 0x0206, 0x0CBF, 0x018F,
+  0xFFFF, 0x045C, 0x0D49, 0x05D2, 0xFFFF, 0xFFFF, 0xFFFF, 0x02D1, 0x0262, 0x0157, 0xFFFF, 0x0799,
+  0xFFFF, 0x09D6, 0xFFFF, 0x0066, 0x06B2, 0x0AA6, 0xFFFF, 0xFFFF, 0x02CC, 0x0A82, 0xFFFF, 0x03DB,
+  0x04E0, 0x08B8, 0xFFFF, 0xFFFF, 0xFFFF, 0x0DD9, 0xFFFF, 0x0B35, 0xFFFF, 0xFFFF, 0x0B90, 0x05A9,
+  0x0618, 0xFFFF, 0x042F, 0xFFFF, 0x0AA3, 0xFFFF, 0x0764, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0859, 0x0E2B, 0xFFFF, 0xFFFF, 0xFFFF, 0x08B4, 0x012F, 0x0CE9, 0x083E, 0x0798, 0xFFFF, 0x0B3B,
+  0x0A46, 0xFFFF, 0x05BA, 0x07FE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0249, 0x07C1, 0x0225, 0xFFFF, 0xFFFF, 0x0437, 0xFFFF, 0xFFFF, 0x08BF, 0x0DD5, 0x088B, 0x09E9,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0D32, 0xFFFF, 0x0047, 0x0B2E, 0xFFFF, 0x0366, 0xFFFF, 0xFFFF, 0x078C,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x086D, 0x00CC, 0xFFFF, 0x0A7C, 0x05E8, 0xFFFF, 0xFFFF, 0x0477,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x059F, 0xFFFF, 0x06E1, 0xFFFF, 0x04D2, 0xFFFF, 0xFFFF, 0x023C, 0x05BF,
+  0x0351, 0xFFFF, 0x0791, 0x03D9, 0x0ABE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0DD3, 0x016B, 0xFFFF,
+  0x0E2D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0A02, 0xFFFF, 0xFFFF, 0xFFFF, 0x0220, 0xFFFF,
+  0xFFFF, 0x028A, 0x0311, 0x0CE6, 0x0D65, 0x0A48, 0x04A7, 0x0013, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0217, 0xFFFF, 0xFFFF, 0xFFFF, 0x0D0A, 0xFFFF, 0x0DB2, 0xFFFF, 0x06CB, 0x0811,
+  0xFFFF, 0xFFFF, 0x04EA, 0xFFFF, 0xFFFF, 0xFFFF, 0x0CF6, 0xFFFF, 0x00C1, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x084F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x016E, 0x0C03, 0xFFFF, 0xFFFF, 0x0D19, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x05D6, 0xFFFF, 0x0391, 0xFFFF, 0x0DE3, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0C09, 0xFFFF, 0x035B, 0x0A09, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x06EE,
+  0x0055, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0881, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x00BE, 0xFFFF,
+  0x07E6, 0xFFFF, 0x0C92, 0x031A, 0x078D, 0x0994, 0xFFFF, 0xFFFF, 0x0872, 0xFFFF, 0x0AD1, 0xFFFF,
+  0xFFFF, 0x0B67, 0xFFFF, 0xFFFF, 0xFFFF, 0x0545, 0xFFFF, 0x048D, 0x05AB, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0A97, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0A69, 0x05A5, 0x038A, 0xFFFF, 0x0691, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0875, 0x00B6, 0x0DC7, 0x032D, 0xFFFF, 0x0349, 0x0B3A, 0x04B3, 0xFFFF, 0x01E9, 0xFFFF, 0xFFFF,
+  0x05B1, 0xFFFF, 0x040D, 0xFFFF, 0xFFFF, 0x0230, 0x0B7C, 0xFFFF, 0xFFFF, 0x03EC, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0009, 0xFFFF, 0xFFFF, 0x0A65, 0x0070, 0x0C91, 0xFFFF, 0x0B2C, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x07F1, 0xFFFF, 0x053D, 0xFFFF, 0x07CB, 0xFFFF, 0x092B, 0x0CEB, 0xFFFF, 0x0629,
+  0x09F8, 0xFFFF, 0x0985, 0x038D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0E3A, 0x0BF6, 0xFFFF, 0x04BD,
+  0x0C6B, 0x0774, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0D34, 0x09F7, 0x0211, 0xFFFF, 0x0204,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x08E1, 0x033C, 0xFFFF, 0x0835, 0xFFFF, 0xFFFF, 0xFFFF, 0x0512,
+  0xFFFF, 0xFFFF, 0x0900, 0xFFFF, 0x0153, 0x0A81, 0xFFFF, 0x0D98, 0x0D5C, 0x03AD, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x089E, 0x068E, 0x05E4, 0xFFFF, 0xFFFF, 0xFFFF, 0x06F0, 0x0BB0, 0xFFFF, 0x01D2, 0x037C,
+  0xFFFF, 0x0412, 0xFFFF, 0x04E7, 0x056C, 0x076E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x05E5, 0x09CA,
+  0xFFFF, 0x0D5A, 0xFFFF, 0xFFFF, 0x0054, 0xFFFF, 0xFFFF, 0x006D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0415, 0x0892, 0x079F, 0xFFFF, 0xFFFF, 0xFFFF, 0x0BDB, 0xFFFF, 0x0CFD, 0x066F, 0x0BE3,
+  0x0816, 0x0056, 0xFFFF, 0xFFFF, 0xFFFF, 0x0D4A, 0xFFFF, 0xFFFF, 0x088C, 0xFFFF, 0x0032, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x01DC, 0x0B15, 0x05BD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x037F, 0x0ACD, 0xFFFF, 0x0189, 0xFFFF, 0xFFFF, 0x0D90, 0x0CCA, 0x0ABF,
+  0x07E0, 0x0D82, 0x0D7F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x09DB, 0x0A83, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0A2F, 0x0787, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0C6F, 0x04E4, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x069C, 0xFFFF, 0xFFFF, 0x08C3, 0xFFFF, 0x0467, 0xFFFF, 0x0B9B, 0x0663, 0xFFFF, 0x0DDC,
+  0xFFFF, 0xFFFF, 0x0237, 0x0DB0, 0xFFFF, 0x09DA, 0xFFFF, 0xFFFF, 0x0493, 0xFFFF, 0xFFFF, 0x0752,
+  0xFFFF, 0xFFFF, 0x04FF, 0xFFFF, 0x014E, 0xFFFF, 0xFFFF, 0x090D, 0xFFFF, 0x0B2A, 0xFFFF, 0x08E0,
+  0x0449, 0x083F, 0x043C, 0x003D, 0xFFFF, 0x0ACC, 0xFFFF, 0x0088, 0xFFFF, 0xFFFF, 0x085E, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0186, 0x09E8, 0x0C41, 0xFFFF, 0xFFFF, 0xFFFF, 0x0993, 0x08AA, 0x053F, 0x0564,
+  0xFFFF, 0x0B10, 0xFFFF, 0x057B, 0xFFFF, 0xFFFF, 0x073C, 0xFFFF, 0xFFFF, 0x0989, 0xFFFF, 0x0D8E,
+  0xFFFF, 0x081A, 0x01DA, 0x052E, 0xFFFF, 0x0133, 0xFFFF, 0x0303, 0x0A26, 0x08CC, 0xFFFF, 0xFFFF,
+  0x0D05, 0x0363, 0xFFFF, 0xFFFF, 0xFFFF, 0x09AC, 0x053B, 0xFFFF, 0x0077, 0xFFFF, 0x06B4, 0x0E14,
+  0xFFFF, 0x0062, 0x0861, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0443, 0x0670, 0xFFFF,
+  0xFFFF, 0x0506, 0xFFFF, 0xFFFF, 0xFFFF, 0x006C, 0x0E08, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0323,
+  0x00EC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0446, 0x0022, 0x0367, 0xFFFF, 0x0146, 0xFFFF, 0x0C8B,
+  0xFFFF, 0x0322, 0xFFFF, 0x0723, 0x0441, 0xFFFF, 0xFFFF, 0x0B80, 0xFFFF, 0x078F, 0xFFFF, 0xFFFF,
+  0x01FE, 0x0897, 0xFFFF, 0x0B1F, 0xFFFF, 0xFFFF, 0x061A, 0xFFFF, 0xFFFF, 0x09A5, 0xFFFF, 0xFFFF,
+  0x01D5, 0xFFFF, 0x05F5, 0x047A, 0xFFFF, 0xFFFF, 0x0C78, 0xFFFF, 0x07BD, 0x06B1, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0796, 0x03B0, 0xFFFF, 0x0001, 0x01F5, 0x05E7,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0967, 0xFFFF, 0x0C43, 0xFFFF, 0xFFFF, 0x0DFD, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0A91, 0xFFFF, 0xFFFF, 0x0700, 0xFFFF, 0xFFFF, 0x080E, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0703, 0x0007, 0xFFFF, 0xFFFF, 0x0592, 0x089B, 0x0A88, 0xFFFF, 0x00FE, 0xFFFF, 0x0C64, 0xFFFF,
+  0x082D, 0x0280, 0x041E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x081E, 0xFFFF, 0x0DC2, 0x0182,
+  0x0287, 0xFFFF, 0xFFFF, 0x09FE, 0xFFFF, 0xFFFF, 0xFFFF, 0x03E4, 0xFFFF, 0xFFFF, 0x0786, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x08A0, 0x0868, 0x02E6, 0xFFFF, 0xFFFF, 0xFFFF, 0x0957, 0x0239, 0x0BCF, 0x0736,
+  0x0725, 0x0232, 0x0100, 0xFFFF, 0x0369, 0x0839, 0x07A4, 0xFFFF, 0xFFFF, 0x0C8A, 0x07CE, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x00B4, 0x0487, 0xFFFF, 0xFFFF, 0x024A, 0xFFFF, 0xFFFF, 0xFFFF, 0x0ADB,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0265, 0xFFFF, 0x0D07, 0x0304, 0x0268, 0xFFFF, 0x0A38, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x01E5, 0xFFFF, 0xFFFF, 0x0345, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0B97, 0x0BD5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x06A2,
+  0x048C, 0xFFFF, 0xFFFF, 0xFFFF, 0x0D7C, 0x073A, 0x0D3F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0D89, 0x06AE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x09EC, 0x0CF2, 0xFFFF,
+  0x0084, 0x0D75, 0x0895, 0x03FA, 0xFFFF, 0x0709, 0x0B23, 0xFFFF, 0xFFFF, 0x0AC8, 0x03EB, 0xFFFF,
+  0x0DB1, 0xFFFF, 0x0E10, 0xFFFF, 0x02CB, 0xFFFF, 0xFFFF, 0xFFFF, 0x002F, 0xFFFF, 0x0534, 0xFFFF,
+  0x03C4, 0xFFFF, 0x0D0C, 0xFFFF, 0x03BD, 0xFFFF, 0x081D, 0xFFFF, 0x0DF1, 0xFFFF, 0x02EC, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0A8B, 0xFFFF, 0xFFFF, 0xFFFF, 0x0803, 0xFFFF, 0xFFFF, 0xFFFF, 0x005B, 0xFFFF,
+  0x0283, 0xFFFF, 0x060A, 0x06FF, 0xFFFF, 0x05EF, 0x077C, 0xFFFF, 0xFFFF, 0x0DAF, 0x004F, 0xFFFF,
+  0xFFFF, 0x0242, 0xFFFF, 0x042B, 0xFFFF, 0xFFFF, 0xFFFF, 0x0A01, 0x07AE, 0xFFFF, 0x0AC5, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0DFA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0433, 0x000A, 0x07F0,
+  0x091F, 0x06F5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0A4C, 0xFFFF, 0x0CAD, 0x05CC,
+  0xFFFF, 0x0324, 0x0444, 0xFFFF, 0x084D, 0x0AD8, 0x0321, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0BBB,
+  0x0CA4, 0x0417, 0xFFFF, 0x007D, 0x0235, 0x0D10, 0x0840, 0x05E0, 0x09FB, 0x0D50, 0xFFFF, 0xFFFF,
+  0x03B4, 0xFFFF, 0x0422, 0x0131, 0x07A6, 0xFFFF, 0xFFFF, 0x0645, 0x0043, 0x0C84, 0x0918, 0xFFFF,
+  0x0743, 0xFFFF, 0x01F0, 0xFFFF, 0x096F, 0xFFFF, 0xFFFF, 0xFFFF, 0x05C5, 0xFFFF, 0x0724, 0x049E,
+  0x0507, 0x0B0C, 0xFFFF, 0xFFFF, 0x0BC5, 0x077F, 0x0A3E, 0x0661, 0xFFFF, 0xFFFF, 0xFFFF, 0x01FF,
+  0x09BB, 0xFFFF, 0x056B, 0xFFFF, 0xFFFF, 0x09E1, 0x02F5, 0x021B, 0x0B70, 0x04F0, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0669, 0x0423, 0x0E04, 0x09A6, 0xFFFF, 0x01FB,
+  0xFFFF, 0x01A1, 0x0397, 0x0B32, 0x07B0, 0x0CEC, 0xFFFF, 0x0CD1, 0xFFFF, 0x012D, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0D64, 0x0A07, 0xFFFF, 0x01D3, 0xFFFF, 0xFFFF, 0x0C2B, 0x010A, 0x01AD, 0xFFFF, 0x099C,
+  0xFFFF, 0xFFFF, 0x09B6, 0x0203, 0xFFFF, 0xFFFF, 0x0025, 0xFFFF, 0xFFFF, 0xFFFF, 0x04FA, 0x04F7,
+  0xFFFF, 0x023A, 0xFFFF, 0xFFFF, 0x0457, 0xFFFF, 0xFFFF, 0x03CF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0C79,
+  0xFFFF, 0xFFFF, 0x06DD, 0x0A17, 0x0B64, 0xFFFF, 0x09C5, 0x0BA7, 0x0489, 0x00AB, 0xFFFF, 0xFFFF,
+  0x0C2A, 0x0A99, 0x0C1F, 0xFFFF, 0x0713, 0x039B, 0xFFFF, 0x0A66, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x034C, 0xFFFF, 0xFFFF, 0x0155, 0x0C33, 0x0DE9, 0x0276,
+  0x0354, 0x0738, 0xFFFF, 0x0448, 0x03D3, 0xFFFF, 0xFFFF, 0x0514, 0xFFFF, 0xFFFF, 0x05D7, 0x0C46,
+  0xFFFF, 0x08EA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x016F, 0xFFFF, 0xFFFF, 0x0C56, 0x0730,
+  0xFFFF, 0x03D1, 0x0086, 0xFFFF, 0x0A37, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x02A2,
+  0x00A3, 0x0462, 0x0AB6, 0xFFFF, 0x0AEC, 0x02E8, 0xFFFF, 0xFFFF, 0xFFFF, 0x013F, 0x0D53, 0x0D7E,
+  0xFFFF, 0x0ACE, 0xFFFF, 0xFFFF, 0x010F, 0xFFFF, 0x0A31, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0039, 0x035C, 0x09C4, 0x093B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x07C4, 0x075C, 0x0C96, 0xFFFF,
+  0xFFFF, 0x03E6, 0x0A40, 0xFFFF, 0x035F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0275, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0248, 0x0B1E, 0xFFFF, 0xFFFF, 0x0D4C, 0x012A, 0xFFFF, 0xFFFF, 0x08E6,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0AE2, 0x0214, 0x05A4, 0xFFFF, 0xFFFF, 0x0A0F, 0x055F, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x02D2, 0xFFFF, 0xFFFF, 0xFFFF, 0x05EC, 0xFFFF, 0x09F4, 0x0DCF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x078A, 0xFFFF, 0x0BAD, 0x001C, 0xFFFF, 0x0DEE, 0x07EC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0A7E, 0xFFFF, 0xFFFF, 0xFFFF, 0x018A, 0xFFFF, 0xFFFF, 0x0912, 0x03F0, 0x0C89, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0BB8, 0xFFFF, 0x09BF, 0xFFFF, 0xFFFF, 0xFFFF, 0x026D, 0x0520, 0x0DD0, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0B8C, 0xFFFF, 0x0D96, 0xFFFF, 0x00E6, 0xFFFF, 0x0D67, 0xFFFF, 0xFFFF, 0x09A2,
+  0xFFFF, 0xFFFF, 0x03FE, 0xFFFF, 0x040A, 0xFFFF, 0x00EF, 0x0DCA, 0x0C9F, 0x0558, 0xFFFF, 0xFFFF,
+  0x0624, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x09ED, 0x06C8, 0x023D, 0xFFFF, 0xFFFF, 0x0356,
+  0xFFFF, 0x051E, 0x08C1, 0xFFFF, 0x08D8, 0xFFFF, 0x02BD, 0xFFFF, 0x0BB7, 0x0A1E, 0x0255, 0x02CE,
+  0xFFFF, 0x02DA, 0x0795, 0x069E, 0xFFFF, 0x032F, 0x0BE7, 0x0922, 0xFFFF, 0x0B3F, 0xFFFF, 0x0196,
+  0xFFFF, 0x04CF, 0x0CB9, 0xFFFF, 0xFFFF, 0x06E8, 0x04B0, 0xFFFF, 0x0BFE, 0xFFFF, 0xFFFF, 0x0826,
+  0xFFFF, 0x00A2, 0xFFFF, 0x025B, 0xFFFF, 0x07CA, 0x0B72, 0xFFFF, 0xFFFF, 0x0D85, 0x0096, 0x0660,
+  0xFFFF, 0xFFFF, 0x015E, 0xFFFF, 0x083C, 0xFFFF, 0x0104, 0x0B4F, 0xFFFF, 0x06F1, 0xFFFF, 0x0D17,
+  0x0758, 0xFFFF, 0x0A8D, 0xFFFF, 0xFFFF, 0x0907, 0x0C8D, 0x0852, 0x07DD, 0x0560, 0x0301, 0x06BE,
+  0xFFFF, 0xFFFF, 0x07A3, 0xFFFF, 0x0D4E, 0xFFFF, 0x02BC, 0xFFFF, 0x0B8D, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x08AD, 0x06F9, 0x09E3, 0xFFFF, 0xFFFF, 0x0947, 0xFFFF, 0x0B04, 0xFFFF, 0x00F4, 0x056F, 0xFFFF,
+  0xFFFF, 0x0B2B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x08EE, 0xFFFF, 0x0731, 0xFFFF, 0x0AA8, 0xFFFF,
+  0xFFFF, 0x0552, 0xFFFF, 0xFFFF, 0xFFFF, 0x07C3, 0x026C, 0x0D92, 0xFFFF, 0xFFFF, 0x00CD, 0xFFFF,
+  0xFFFF, 0x0E25, 0x092D, 0xFFFF, 0xFFFF, 0xFFFF, 0x0D8D, 0x056A, 0xFFFF, 0xFFFF, 0x0648, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x06D1, 0x0C68, 0xFFFF, 0x0162, 0xFFFF, 0xFFFF, 0xFFFF, 0x093E, 0xFFFF,
+  0x0173, 0xFFFF, 0x0377, 0xFFFF, 0xFFFF, 0xFFFF, 0x06D2, 0x02A1, 0xFFFF, 0x0DA5, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0AB1, 0xFFFF, 0x061D, 0xFFFF,
+  0xFFFF, 0x01DF, 0x0C2D, 0x0800, 0xFFFF, 0x091B, 0xFFFF, 0x001D, 0xFFFF, 0xFFFF, 0x09FD, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0BF1, 0xFFFF, 0xFFFF, 0xFFFF, 0x0D14, 0xFFFF, 0x0AEF,
+  0x01BA, 0xFFFF, 0x0551, 0x04A9, 0xFFFF, 0xFFFF, 0x0600, 0x0930, 0xFFFF, 0x018B, 0x059D, 0xFFFF,
+  0xFFFF, 0x0250, 0xFFFF, 0x0DB5, 0xFFFF, 0xFFFF, 0x0306, 0x0C3A, 0xFFFF, 0xFFFF, 0x0E33, 0x075E,
+  0x0AA7, 0x0AC2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0290, 0xFFFF, 0xFFFF, 0x0932, 0xFFFF, 0x0C70,
+  0xFFFF, 0x0980, 0x006B, 0x08D7, 0x0B49, 0xFFFF, 0x0ABA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x005F, 0xFFFF, 0xFFFF, 0xFFFF, 0x0A89, 0x0805,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x07B4, 0x0D57, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x032A, 0x0A60,
+  0xFFFF, 0x06E5, 0xFFFF, 0x0529, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0D2E, 0x0C3B, 0xFFFF,
+  0x0DD6, 0x071F, 0xFFFF, 0xFFFF, 0xFFFF, 0x0C48, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0DC4, 0x074E,
+  0x0693, 0xFFFF, 0x0574, 0x0B1A, 0xFFFF, 0x06A8, 0x094C, 0x0300, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0B27, 0x0BE8, 0x017A, 0xFFFF, 0x0A8C, 0xFFFF, 0x0780, 0x0CD5, 0x0575, 0xFFFF, 0x0DBA, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x00F0, 0xFFFF, 0x024B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x08E4, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x054A, 0x0B9F, 0xFFFF, 0xFFFF, 0xFFFF, 0x0003, 0x0635, 0x0024,
+  0x03C0, 0x060E, 0x076F, 0xFFFF, 0xFFFF, 0x05AD, 0xFFFF, 0xFFFF, 0x04CE, 0xFFFF, 0x0570, 0x06A5,
+  0xFFFF, 0xFFFF, 0x055E, 0xFFFF, 0x06CD, 0x039D, 0xFFFF, 0x0D27, 0x0148, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0638, 0x07F3, 0x0074, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x01EF,
+  0x0B81, 0x058D, 0xFFFF, 0xFFFF, 0xFFFF, 0x0171, 0xFFFF, 0xFFFF, 0x0051, 0x04FC, 0xFFFF, 0x0CDB,
+  0xFFFF, 0x0190, 0xFFFF, 0x058E, 0x0C57, 0xFFFF, 0xFFFF, 0xFFFF, 0x077E, 0x0274, 0x097C, 0x0B60,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0395, 0xFFFF, 0xFFFF, 0xFFFF, 0x0316, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x07B9, 0x0655, 0xFFFF, 0x095D, 0xFFFF, 0x0CF8, 0x0991, 0xFFFF, 0x0C0D, 0x08DB, 0xFFFF,
+  0x071E, 0xFFFF, 0xFFFF, 0x0A3B, 0xFFFF, 0x039A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x002B, 0xFFFF,
+  0x0903, 0xFFFF, 0xFFFF, 0x0252, 0xFFFF, 0x03B9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x09E6, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x01DE, 0xFFFF, 0x09EE, 0x0BF3, 0xFFFF, 0xFFFF, 0x0471, 0xFFFF, 0x0B37, 0x08D0,
+  0xFFFF, 0xFFFF, 0x0127, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0328, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x062B, 0xFFFF, 0x06C4, 0x01A0, 0x0B16, 0xFFFF, 0x07AF, 0x0941, 0xFFFF, 0xFFFF, 0x069A,
+  0x040E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0053, 0x08A6, 0x0B7A, 0x0081, 0x0C58, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0523, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0813, 0x03DC, 0xFFFF, 0xFFFF, 0x028F, 0xFFFF, 0xFFFF, 0x07A7, 0x09EF, 0x08A3, 0x0327, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x03D8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x04B2, 0xFFFF, 0xFFFF, 0x0657, 0x0284,
+  0x072E, 0xFFFF, 0x062F, 0xFFFF, 0xFFFF, 0x0C6E, 0x0343, 0xFFFF, 0xFFFF, 0x0CFC, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x04ED, 0x0C37, 0x09B3, 0x0D7B, 0xFFFF, 0x0567, 0x0A3F, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x012E, 0x0310, 0xFFFF, 0x0955, 0x033B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x05D8, 0x0A34, 0x0C08,
+  0x060B, 0xFFFF, 0x08F3, 0xFFFF, 0x01E0, 0x015A, 0x0948, 0x0A5D, 0xFFFF, 0x09AA, 0xFFFF, 0xFFFF,
+  0x040C, 0x011C, 0xFFFF, 0x0353, 0x05B7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0093, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x05FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0C1C, 0x001B, 0x0915, 0xFFFF, 0xFFFF, 0x070B,
+  0x0E0C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0A94, 0x0078, 0x05A2, 0x0389, 0x0097, 0xFFFF, 0x01E7,
+  0xFFFF, 0x02F6, 0xFFFF, 0xFFFF, 0x0C45, 0xFFFF, 0x0082, 0xFFFF, 0xFFFF, 0x0140, 0x05FA, 0xFFFF,
+  0xFFFF, 0x083D, 0x0687, 0xFFFF, 0x028B, 0x0486, 0xFFFF, 0xFFFF, 0x03F2, 0x0B9A, 0xFFFF, 0x0C0F,
+  0xFFFF, 0xFFFF, 0x0970, 0xFFFF, 0xFFFF, 0x0849, 0xFFFF, 0x09BC, 0x0639, 0xFFFF, 0xFFFF, 0x0D3D,
+  0xFFFF, 0xFFFF, 0x09AF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x058F, 0xFFFF, 0x09D0, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0424, 0xFFFF, 0x00C6, 0xFFFF, 0xFFFF, 0x063C, 0xFFFF, 0x0188, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0330, 0x0C9A, 0xFFFF, 0x0630, 0xFFFF, 0xFFFF, 0x09E0,
+  0x046E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x065F, 0x0519, 0xFFFF, 0xFFFF, 0x056E, 0xFFFF, 0x0DD1,
+  0xFFFF, 0xFFFF, 0x0DC0, 0xFFFF, 0xFFFF, 0x0291, 0x0A7F, 0xFFFF, 0xFFFF, 0x04BF, 0x02C8, 0x0C6A,
+  0x0429, 0x0468, 0xFFFF, 0x069B, 0xFFFF, 0xFFFF, 0x03A1, 0xFFFF, 0x05FC, 0x037D, 0xFFFF, 0xFFFF,
+  0x01E3, 0x0C80, 0xFFFF, 0x08F0, 0xFFFF, 0xFFFF, 0xFFFF, 0x06A9, 0x0180, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0899, 0x0BD4, 0x0309, 0xFFFF, 0x0A86, 0x0A47, 0xFFFF, 0x0B41, 0x00E4, 0xFFFF, 0x0AF4, 0xFFFF,
+  0x0205, 0xFFFF, 0x0C4A, 0xFFFF, 0xFFFF, 0xFFFF, 0x00E9, 0x0A72, 0x0307, 0x06CF, 0x02F0, 0xFFFF,
+  0x0BB6, 0x0224, 0x0325, 0xFFFF, 0xFFFF, 0x0601, 0xFFFF, 0xFFFF, 0x0B4D, 0xFFFF, 0x03BF, 0xFFFF,
+  0x0D08, 0xFFFF, 0x09DD, 0xFFFF, 0x01F4, 0x007F, 0x0586, 0x0A3D, 0x00EA, 0x0676, 0x03F3, 0x0563,
+  0x0C39, 0xFFFF, 0x08D3, 0x0244, 0xFFFF, 0xFFFF, 0xFFFF, 0x0177, 0x0120, 0xFFFF, 0x0E15, 0xFFFF,
+  0x05DB, 0x0DC1, 0x005A, 0xFFFF, 0x0735, 0x0544, 0xFFFF, 0x0107, 0xFFFF, 0xFFFF, 0xFFFF, 0x09EA,
+  0xFFFF, 0x0C55, 0xFFFF, 0xFFFF, 0xFFFF, 0x02FD, 0xFFFF, 0xFFFF, 0xFFFF, 0x08B7, 0x029D, 0x0D09,
+  0xFFFF, 0xFFFF, 0x0741, 0x00CF, 0x0884, 0x01B7, 0x07DE, 0x00D7, 0xFFFF, 0x0B3C, 0xFFFF, 0x0866,
+  0x05C4, 0x0E2C, 0xFFFF, 0x051F, 0x02A4, 0xFFFF, 0x0A35, 0x00CA, 0x0D21, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0BED, 0x0485, 0xFFFF, 0x03E9, 0x0279, 0xFFFF, 0x062D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0546,
+  0xFFFF, 0x0D9B, 0x0331, 0xFFFF, 0x08F9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0C93, 0x0041, 0xFFFF,
+  0x00F3, 0xFFFF, 0x0A32, 0xFFFF, 0x05FD, 0xFFFF, 0x030D, 0x015D, 0xFFFF, 0x028C, 0x0CBC, 0x081C,
+  0x0385, 0xFFFF, 0x095B, 0x004E, 0x049B, 0x0829, 0x089A, 0xFFFF, 0xFFFF, 0xFFFF, 0x00F7, 0x0705,
+  0xFFFF, 0x06E9, 0xFFFF, 0xFFFF, 0xFFFF, 0x0085, 0xFFFF, 0xFFFF, 0x0A15, 0xFFFF, 0x0DDF, 0xFFFF,
+  0x0B0E, 0x029A, 0xFFFF, 0x0ABC, 0x0518, 0x0877, 0x0CBD, 0xFFFF, 0x06DF, 0x08CE, 0x02A9, 0xFFFF,
+  0x07D7, 0x0842, 0xFFFF, 0xFFFF, 0x05B4, 0xFFFF, 0x0C36, 0xFFFF, 0xFFFF, 0x0020, 0xFFFF, 0x0855,
+  0xFFFF, 0xFFFF, 0x0B0B, 0x0439, 0xFFFF, 0xFFFF, 0x0A59, 0x0538, 0xFFFF, 0x0914, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x003A, 0xFFFF, 0x04BE, 0xFFFF, 0xFFFF, 0x0765, 0x0AB3, 0xFFFF, 0xFFFF, 0x0565,
+  0x08F7, 0x0853, 0x0C16, 0xFFFF, 0x02B6, 0x0A49, 0xFFFF, 0xFFFF, 0x03A6, 0xFFFF, 0x0A36, 0xFFFF,
+  0xFFFF, 0x0598, 0xFFFF, 0x0726, 0xFFFF, 0xFFFF, 0x0A92, 0xFFFF, 0x01A2, 0xFFFF, 0x09C7, 0x0B65,
+  0xFFFF, 0x09B9, 0x01C9, 0xFFFF, 0xFFFF, 0xFFFF, 0x0E0B, 0xFFFF, 0x07B7, 0xFFFF, 0x0CF1, 0xFFFF,
+  0x096D, 0x0674, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0B77, 0xFFFF, 0x0910, 0x02A7, 0xFFFF, 0xFFFF,
+  0x0C23, 0xFFFF, 0xFFFF, 0x0B89, 0x0208, 0x06D4, 0xFFFF, 0x0048, 0xFFFF, 0x008F, 0xFFFF, 0xFFFF,
+  0x00D4, 0xFFFF, 0xFFFF, 0x04F6, 0xFFFF, 0xFFFF, 0x04F8, 0xFFFF, 0x0228, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x05C3, 0x07E5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x094A, 0x04B1, 0x0583, 0xFFFF,
+  0xFFFF, 0x0BF0, 0xFFFF, 0x0D66, 0x0BE2, 0x0308, 0x07AD, 0x0141, 0x0AB4, 0x05C9, 0xFFFF, 0x057C,
+  0x01D9, 0x0B2F, 0x0212, 0xFFFF, 0x0908, 0x0117, 0xFFFF, 0x0267, 0xFFFF, 0xFFFF, 0x00AF, 0xFFFF,
+  0xFFFF, 0x0665, 0x0C7F, 0xFFFF, 0x0979, 0xFFFF, 0x0E39, 0xFFFF, 0x0341, 0xFFFF, 0x0935, 0x01BB,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0AF0, 0x01C8, 0xFFFF, 0x0A23,
+  0xFFFF, 0x0D4F, 0x0087, 0xFFFF, 0x0319, 0xFFFF, 0xFFFF, 0x08C5, 0xFFFF, 0xFFFF, 0x0BE0, 0xFFFF,
+  0x064F, 0xFFFF, 0xFFFF, 0x016C, 0x0959, 0x0C04, 0xFFFF, 0xFFFF, 0x0C51, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x06C9, 0x05BE, 0x09A4, 0x06AD, 0xFFFF, 0x0B8B, 0x09C3, 0xFFFF, 0xFFFF,
+  0x0AD2, 0x085D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x03B1, 0x0119, 0x0D9A, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x06BD, 0xFFFF, 0x0869, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0566, 0xFFFF, 0xFFFF, 0xFFFF, 0x0C7D, 0x082B, 0x086B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x075A, 0xFFFF, 0x0C5A, 0x0179, 0xFFFF, 0xFFFF, 0x0505, 0x08F2, 0x0627, 0x0247, 0x049D, 0xFFFF,
+  0x04FB, 0x0453, 0xFFFF, 0x0BC9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x04C2, 0xFFFF,
+  0x0381, 0xFFFF, 0xFFFF, 0x08C2, 0x0059, 0xFFFF, 0xFFFF, 0x08B2, 0x0318, 0xFFFF, 0x02FA, 0xFFFF,
+  0x025D, 0xFFFF, 0xFFFF, 0x01F6, 0x0A50, 0x02E9, 0x0D15, 0x0458, 0xFFFF, 0xFFFF, 0xFFFF, 0x0D30,
+  0x0CAB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0360, 0x08BC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0052, 0xFFFF, 0x00F9, 0x0739, 0xFFFF, 0x0DEB, 0x0A2E, 0xFFFF, 0xFFFF, 0x0987, 0xFFFF, 0x0AE3,
+  0x08A9, 0xFFFF, 0x0D03, 0xFFFF, 0xFFFF, 0x02E5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0AB2,
+  0x010E, 0xFFFF, 0x09F1, 0xFFFF, 0x0C19, 0xFFFF, 0x0E05, 0x0769, 0xFFFF, 0xFFFF, 0x0888, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0236, 0xFFFF, 0xFFFF, 0xFFFF, 0x0860, 0x08CA, 0x007C, 0xFFFF, 0x037B,
+  0xFFFF, 0x0080, 0xFFFF, 0xFFFF, 0x0569, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x006E, 0x0BCE, 0x0139, 0xFFFF, 0xFFFF, 0x05B9, 0xFFFF, 0xFFFF, 0xFFFF, 0x0BC2, 0x0A76,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0D8C, 0xFFFF, 0xFFFF, 0xFFFF, 0x00E2, 0x08F6, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0963, 0xFFFF, 0xFFFF, 0x0D11, 0xFFFF, 0x00A1, 0x0017, 0x01D0, 0x0956, 0xFFFF, 0xFFFF,
+  0x0718, 0xFFFF, 0x03C9, 0xFFFF, 0x0792, 0xFFFF, 0x0AF7, 0xFFFF, 0xFFFF, 0x0101, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x074C, 0xFFFF, 0x0986, 0x0E03, 0x0404, 0xFFFF, 0xFFFF, 0x0147, 0x0878,
+  0xFFFF, 0xFFFF, 0x0BDA, 0xFFFF, 0x02AC, 0xFFFF, 0x0685, 0xFFFF, 0x0969, 0x0536, 0xFFFF, 0x0B5F,
+  0xFFFF, 0xFFFF, 0x07D4, 0xFFFF, 0x0E1A, 0x0A52, 0xFFFF, 0x06BC, 0x0943, 0x020A, 0xFFFF, 0x01CE,
+  0xFFFF, 0x06AF, 0xFFFF, 0xFFFF, 0x05EE, 0xFFFF, 0xFFFF, 0xFFFF, 0x0547, 0x0BF9, 0xFFFF, 0x0A64,
+  0xFFFF, 0x08A5, 0x0637, 0x0526, 0xFFFF, 0xFFFF, 0xFFFF, 0x055D, 0xFFFF, 0xFFFF, 0x0DEA, 0x0B0F,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0011, 0xFFFF, 0x05A0, 0x04C5, 0xFFFF, 0x0A56, 0x06C3, 0x0102, 0xFFFF,
+  0xFFFF, 0x06AA, 0x0984, 0x0BC0, 0xFFFF, 0x0C66, 0x0913, 0x0CD0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0C0A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x06CE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x00FF,
+  0xFFFF, 0x03AF, 0xFFFF, 0xFFFF, 0x0DA2, 0xFFFF, 0x097F, 0xFFFF, 0x07D8, 0xFFFF, 0xFFFF, 0x0192,
+  0x00A7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x09E4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x00B1,
+  0xFFFF, 0x07CC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0185, 0x0D46, 0x0742, 0xFFFF, 0xFFFF,
+  0x0334, 0xFFFF, 0x0DE5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0383, 0xFFFF, 0x0114, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0D0D, 0x0269, 0xFFFF, 0xFFFF, 0x0B6B, 0xFFFF, 0xFFFF, 0xFFFF, 0x0AC1, 0xFFFF, 0x0427,
+  0xFFFF, 0x0D28, 0xFFFF, 0x02D6, 0x0D2C, 0x0A77, 0xFFFF, 0x0499,
+};
+
+// The perfect hash of the keywords, see GetTag().
+static const std::uint16_t g_keyword_displacements[] = {
+  0x0001, 0x0003, 0x0002, 0x0001, 0x0002, 0x0002, 0x0001, 0x0001, 0x0002, 0x0002, 0x0001, 0x0002,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0004, 0x0007, 0x0007, 0x0001, 0x0001, 0x0004, 0x0001, 0x0001,
+  0x0002, 0x0002, 0x0002, 0x0001, 0x0002, 0x0000, 0x0003, 0x0004, 0x0002, 0x0002, 0x0005, 0x0001,
+  0x0001, 0x0001, 0x0002, 0x0001, 0x0003, 0x0004, 0x0001, 0x0004, 0x0000, 0x0001, 0x0002, 0x0001,
+  0x0001, 0x0004, 0x0001, 0x0003, 0x0001, 0x0001, 0x0001, 0x0000, 0x0001, 0x0002, 0x0002, 0x0003,
+  0x0001, 0x0001, 0x0002, 0x0002, 0x0005, 0x0001, 0x0002, 0x0002, 0x0001, 0x0003, 0x0001, 0x0004,
+  0x0002, 0x0005, 0x0001, 0x0001, 0x0002, 0x0002, 0x0001, 0x0003, 0x0001, 0x000C, 0x0001, 0x0001,
+  0x0001, 0x0006, 0x0008, 0x0001, 0x0002, 0x0001, 0x0001, 0x0002, 0x0003, 0x0001, 0x0001, 0x0001,
+  0x0003, 0x0001, 0x0005, 0x0001, 0x0005, 0x0001, 0x0006, 0x0001, 0x0003, 0x0001, 0x0005, 0x0003,
+  0x0002, 0x0001, 0x0008, 0x0001, 0x0006, 0x0002, 0x0002, 0x0003, 0x0003, 0x0000, 0x0001, 0x0004,
+  0x0001, 0x0006, 0x0000, 0x0001, 0x0001, 0x0002, 0x0001, 0x0001, 0x0002, 0x0001, 0x0001, 0x0003,
+  0x0001, 0x0003, 0x0001, 0x0001, 0x0001, 0x0008, 0x0001, 0x0001, 0x0002, 0x0003, 0x0002, 0x0001,
+  0x0007, 0x0006, 0x0002, 0x0001, 0x0001, 0x0002, 0x0004, 0x0009, 0x0003, 0x0002, 0x0003, 0x0007,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0003, 0x0004, 0x0001, 0x0004, 0x0001, 0x0002, 0x0001,
+  0x0001, 0x0002, 0x0001, 0x0007, 0x0003, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0001, 0x0006,
+  0x0002, 0x0003, 0x0001, 0x0000, 0x0005, 0x0001, 0x0001, 0x0002, 0x0001, 0x0001, 0x0002, 0x0002,
+  0x0003, 0x0001, 0x0006, 0x0002, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0001,
+  0x0004, 0x0001, 0x0003, 0x0002, 0x0001, 0x0001, 0x0002, 0x0001, 0x0000, 0x0002, 0x0002, 0x0000,
+  0x0004, 0x0001, 0x0001, 0x0003, 0x0004, 0x0002, 0x0005, 0x0001, 0x000B, 0x0001, 0x0001, 0x0002,
+  0x0001, 0x0001, 0x0006, 0x0002, 0x0001, 0x0005, 0x0005, 0x0002, 0x0006, 0x0001, 0x0005, 0x0001,
+  0x0002, 0x0002, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0007, 0x0001, 0x0003, 0x0002, 0x0003,
+  0x0008, 0x0003, 0x0002, 0x0001, 0x0005, 0x0001, 0x0000, 0x0003, 0x0003, 0x0001, 0x0004, 0x0001,
+  0x0002, 0x0001, 0x0001, 0x0005, 0x0001, 0x000F, 0x0000, 0x0004, 0x0001, 0x0002, 0x0001, 0x0002,
+  0x0004, 0x0003, 0x0001, 0x0000, 0x0003, 0x000B, 0x0001, 0x0001, 0x0001, 0x0003, 0x0003, 0x0001,
+  0x0001, 0x0001, 0x0007, 0x0001, 0x0001, 0x0002, 0x0006, 0x0001, 0x0001, 0x0002, 0x0003, 0x0003,
+  0x0002, 0x0002, 0x0001, 0x0005, 0x0001, 0x0004, 0x0003, 0x0006, 0x0007, 0x0007, 0x0004, 0x0001,
+  0x0001, 0x0001, 0x0002, 0x0001, 0x0002, 0x0001, 0x0007, 0x0001, 0x0001, 0x0005, 0x0005, 0x0004,
+  0x0001, 0x0001, 0x0005, 0x0002, 0x0001, 0x0002, 0x0002, 0x0001, 0x0003, 0x0002, 0x0003, 0x0002,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0004, 0x0003, 0x0003, 0x0002, 0x0001, 0x0001, 0x0002,
+  0x0006, 0x0005, 0x0009, 0x0001, 0x0002, 0x0001, 0x0001, 0x0004, 0x0001, 0x0001, 0x0005, 0x0001,
+  0x0003, 0x0002, 0x0000, 0x0004, 0x0002, 0x0002, 0x0001, 0x0002, 0x0003, 0x0005, 0x0005, 0x0002,
+  0x0003, 0x0003, 0x0004, 0x0001, 0x0001, 0x0003, 0x0005, 0x0002, 0x0001, 0x0003, 0x0001, 0x0000,
+  0x0001, 0x0001, 0x0001, 0x0005, 0x0001, 0x0003, 0x0003, 0x0001, 0x0005, 0x0007, 0x0002, 0x0006,
+  0x0001, 0x0002, 0x0003, 0x0001, 0x0001, 0x0003, 0x0002, 0x0001, 0x0000, 0x0005, 0x0002, 0x0009,
+  0x0001, 0x0002, 0x0001, 0x0002, 0x0001, 0x0002, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0003,
+  0x0003, 0x0003, 0x0001, 0x0001, 0x0002, 0x0001, 0x0001, 0x0007, 0x0002, 0x0002, 0x0002, 0x0008,
+  0x0001, 0x0002, 0x0004, 0x0009, 0x0002, 0x0001, 0x0002, 0x0001, 0x0001, 0x0002, 0x0002, 0x0003,
+  0x0002, 0x0001, 0x0004, 0x0001, 0x0001, 0x0001, 0x0004, 0x0001, 0x0001, 0x0004, 0x0001, 0x0002,
+  0x000C, 0x0001, 0x0001, 0x0002, 0x0004, 0x0001, 0x0001, 0x0007, 0x0001, 0x0000, 0x0001, 0x000B,
+  0x0001, 0x0002, 0x0002, 0x0002, 0x0001, 0x0002, 0x0003, 0x0002, 0x0001, 0x0009, 0x0001, 0x0001,
+  0x0003, 0x0001, 0x000A, 0x0001, 0x0001, 0x0001, 0x0002, 0x0001, 0x0003, 0x0006, 0x0001, 0x0002,
+  0x0002, 0x0004, 0x0003, 0x0003, 0x0001, 0x0006, 0x0001, 0x0001, 0x0004, 0x0005, 0x0004, 0x0002,
+  0x0003, 0x0004, 0x0001, 0x0001, 0x0002, 0x0002, 0x0001, 0x0001, 0x0001, 0x0005, 0x0002, 0x0001,
+  0x0002, 0x000E, 0x0003, 0x0014, 0x0008, 0x0005, 0x0006, 0x0003, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0003, 0x0002, 0x0002, 0x0001, 0x0001, 0x0002, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0001,
+  0x0004, 0x0001, 0x0001, 0x0002, 0x0001, 0x0004, 0x0002, 0x0007, 0x0004, 0x0001, 0x0003, 0x0001,
+  0x0005, 0x0002, 0x0004, 0x0001, 0x0007, 0x0001, 0x0003, 0x0003, 0x0004, 0x0001, 0x0003, 0x0004,
+  0x0002, 0x0002, 0x0001, 0x0001, 0x0001, 0x0004, 0x0003, 0x0002, 0x0004, 0x0002, 0x0001, 0x0007,
+  0x0001, 0x0003, 0x0004, 0x0000, 0x0001, 0x0006, 0x0000, 0x0002, 0x000C, 0x0006, 0x0002, 0x0002,
+  0x0001, 0x0008, 0x0009, 0x0000, 0x0002, 0x0001, 0x0003, 0x0003, 0x0010, 0x0000, 0x0003, 0x0001,
+  0x0004, 0x0002, 0x0004, 0x0001, 0x0000, 0x0006, 0x0003, 0x0004, 0x0005, 0x000D, 0x0003, 0x0002,
+  0x0002, 0x0002, 0x0001, 0x0001, 0x0002, 0x0002, 0x0007, 0x0003, 0x0002, 0x0001, 0x0001, 0x0003,
+  0x0001, 0x0002, 0x0001, 0x0002, 0x0004, 0x0004, 0x0002, 0x0003, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0003, 0x0001, 0x0006, 0x0003, 0x0004, 0x0002, 0x0003, 0x0004, 0x0004, 0x0001, 0x0001, 0x0000,
+  0x0001, 0x0004, 0x0006, 0x000E, 0x0001, 0x0001, 0x0007, 0x0001, 0x0002, 0x0001, 0x0007, 0x0001,
+  0x0001, 0x0002, 0x0001, 0x0002, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0003, 0x0004, 0x0003,
+  0x0003, 0x0007, 0x0001, 0x0003, 0x0001, 0x0007, 0x0002, 0x0003, 0x0002, 0x0004, 0x0001, 0x0002,
+  0x0008, 0x0001, 0x0001, 0x0001, 0x0004, 0x0007, 0x0002, 0x0001, 0x0000, 0x0001, 0x0004, 0x0000,
+  0x0001, 0x0002, 0x0003, 0x0006, 0x0002, 0x0006, 0x0003, 0x0001, 0x0005, 0x0000, 0x0002, 0x0007,
+  0x0002, 0x0001, 0x0001, 0x0004, 0x0005, 0x0006, 0x0002, 0x0001, 0x0003, 0x0003, 0x0001, 0x0002,
+  0x0001, 0x0000, 0x0001, 0x0001, 0x0005, 0x0007, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002,
+  0x0001, 0x0004, 0x0002, 0x0001, 0x0003, 0x0001, 0x0001, 0x0001, 0x0002, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0003, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0004, 0x0001, 0x0003,
+  0x0001, 0x0001, 0x0002, 0x0001, 0x0001, 0x0003, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0004,
+  0x0005, 0x0002, 0x0002, 0x0007, 0x0002, 0x0001, 0x0003, 0x0001, 0x0001, 0x0001, 0x0004, 0x0001,
+  0x0002, 0x0004, 0x0002, 0x0005, 0x0002, 0x0000, 0x0001, 0x0008, 0x0002, 0x0002, 0x0003, 0x0001,
+  0x0008, 0x0001, 0x0005, 0x0002, 0x0001, 0x000C, 0x0001, 0x0001, 0x0002, 0x0001, 0x0001, 0x0007,
+  0x0002, 0x0008, 0x0001, 0x0004, 0x0000, 0x0001, 0x0002, 0x0002, 0x0001, 0x0001, 0x0001, 0x0002,
+  0x0003, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0001, 0x0002, 0x0002, 0x0002, 0x0003,
+  0x0000, 0x0003, 0x0004, 0x0001, 0x0007, 0x0002, 0x0001, 0x0007, 0x0002, 0x0009, 0x0002, 0x0002,
+  0x0001, 0x0001, 0x0001, 0x0005, 0x0001, 0x0002, 0x0000, 0x0009, 0x0001, 0x0002, 0x0003, 0x0003,
+  0x0001, 0x0002, 0x0001, 0x0002, 0x0003, 0x0002, 0x0001, 0x0001, 0x0001, 0x0003, 0x0001, 0x0001,
+  0x0003, 0x0001, 0x0007, 0x0001, 0x0003, 0x0002, 0x0003, 0x0001, 0x0001, 0x0005, 0x0001, 0x0007,
+  0x0001, 0x0002, 0x0001, 0x0002, 0x0002, 0x0001, 0x0001, 0x0001, 0x0001, 0x000C, 0x0001, 0x0001,
+  0x0007, 0x0001, 0x0005, 0x0005, 0x0008, 0x0000, 0x0002, 0x0002, 0x0003, 0x0001, 0x0003, 0x0006,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x000F, 0x0002, 0x0002, 0x0007, 0x0005, 0x0001, 0x000A,
+  0x0001, 0x0003, 0x000C, 0x0003, 0x0001, 0x0001, 0x0004, 0x0002, 0x0007, 0x0007, 0x0003, 0x0001,
+  0x0001, 0x0002, 0x0001, 0x0001, 0x0002, 0x0004, 0x000A, 0x0002, 0x0001, 0x0001, 0x0004, 0x0001,
+  0x0001, 0x0001, 0x0005, 0x0003, 0x0002, 0x0005, 0x0001, 0x0007, 0x000A, 0x0001, 0x0003, 0x0005,
+  0x0003, 0x0007, 0x0001, 0x0003, 0x0002, 0x0008, 0x0002, 0x0003, 0x0007, 0x0004, 0x0002, 0x000B,
+  0x0002, 0x0002, 0x0001, 0x0001, 0x000E, 0x0006, 0x0002, 0x0009, 0x0001, 0x0002, 0x0003, 0x000E,
+  0x0008, 0x0007, 0x0006, 0x0002, 0x0005, 0x0001, 0x0007, 0x0002, 0x0001, 0x0001, 0x000A, 0x0002,
+  0x0001, 0x0003, 0x0003, 0x0004, 0x0005, 0x0003, 0x0002, 0x000C, 0x0004, 0x0005, 0x0002, 0x0001,
+  0x0004, 0x0001, 0x000C, 0x0002, 0x0003, 0x0001, 0x0002, 0x000D, 0x0001, 0x000B, 0x0001, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0001, 0x0002, 0x0008, 0x0002, 0x0002, 0x0000, 0x0004, 0x0002, 0x0003,
+  0x0000, 0x0000, 0x0001, 0x0002,
+};
+
+static const std::uint16_t g_keyword_slots[] = {
+  0x0D8B, 0xFFFF, 0x053D, 0x067D, 0xFFFF, 0x0A3E, 0xFFFF, 0x0E15, 0x006F, 0xFFFF, 0xFFFF, 0x0A42,
+  0x04F8, 0xFFFF, 0x059F, 0x005B, 0x0615, 0xFFFF, 0xFFFF, 0x03FC, 0x06EF, 0xFFFF, 0xFFFF, 0x017D,
+  0x0430, 0xFFFF, 0xFFFF, 0x052F, 0xFFFF, 0x0265, 0x0105, 0x095C, 0xFFFF, 0x009A, 0xFFFF, 0x03CB,
+  0xFFFF, 0x09E8, 0x0C6F, 0x0AD7, 0xFFFF, 0x0225, 0x0511, 0xFFFF, 0x0080, 0x0158, 0xFFFF, 0x08FD,
+  0xFFFF, 0x036D, 0x0471, 0x044F, 0xFFFF, 0x0CD9, 0x04ED, 0x0169, 0xFFFF, 0xFFFF, 0xFFFF, 0x05B5,
+  0x08A9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0584, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x02F5, 0xFFFF, 0x09DC, 0xFFFF, 0x0AE4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x06A3, 0xFFFF, 0xFFFF, 0xFFFF, 0x0D1C, 0x0C0B, 0x03FE, 0xFFFF, 0x0A67, 0xFFFF, 0x025B,
+  0x0403, 0x0366, 0xFFFF, 0x0B2D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x025A, 0xFFFF, 0xFFFF,
+  0x02C3, 0xFFFF, 0xFFFF, 0x00E5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0255, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x09EE, 0xFFFF, 0xFFFF, 0x0063, 0x0563, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0769,
+  0xFFFF, 0x0DA2, 0x0822, 0xFFFF, 0xFFFF, 0x065D, 0x066B, 0x0874, 0xFFFF, 0x0376, 0xFFFF, 0xFFFF,
+  0x09C7, 0x02B4, 0x0914, 0x0916, 0xFFFF, 0x061A, 0xFFFF, 0xFFFF, 0xFFFF, 0x014D, 0x01D7, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0234, 0xFFFF, 0x036F, 0xFFFF, 0xFFFF, 0x07BA, 0x0438, 0xFFFF, 0x0D79, 0xFFFF,
+  0xFFFF, 0x0387, 0x09A0, 0x0C71, 0x0B58, 0xFFFF, 0x071D, 0x012E, 0xFFFF, 0xFFFF, 0x037E, 0xFFFF,
+  0x01E8, 0xFFFF, 0x0237, 0xFFFF, 0x003D, 0x0E08, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x08B3,
+  0xFFFF, 0x0DC1, 0xFFFF, 0xFFFF, 0x0688, 0x0356, 0xFFFF, 0x08CC, 0xFFFF, 0x08AC, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0B14, 0xFFFF, 0xFFFF, 0x0B8F, 0xFFFF, 0xFFFF, 0xFFFF, 0x04CF, 0x09CD, 0x05F0, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0841, 0xFFFF, 0x0BA4, 0xFFFF, 0xFFFF, 0x0E34, 0xFFFF, 0x0A09, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0DCC, 0x0AEB, 0x0687, 0x00A9, 0x04A7, 0xFFFF, 0x0302, 0x0373, 0xFFFF, 0xFFFF,
+  0x0A7F, 0xFFFF, 0x075C, 0xFFFF, 0x03EE, 0x0328, 0x0CFC, 0xFFFF, 0xFFFF, 0x01ED, 0x03D1, 0xFFFF,
+  0x065A, 0x0731, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x06A0, 0xFFFF, 0x0CD7, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0A58, 0x0BD8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0B74, 0x0821, 0x0D39, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x09FE, 0x0815, 0x0020, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x06D9, 0x0997, 0x0B35, 0xFFFF, 0xFFFF, 0xFFFF, 0x0A49, 0x0BA6, 0x00A3, 0x02F9, 0x0844, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0549, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x074A, 0xFFFF, 0x0701, 0x0600, 0xFFFF,
+  0x03C5, 0x0675, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0A65, 0xFFFF, 0xFFFF, 0x0405, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x018D, 0x0849, 0x02CB, 0x0747, 0x087C, 0xFFFF, 0x062D, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0D72, 0x0B27, 0x0216, 0xFFFF, 0x079E, 0x071E, 0x0711, 0x08F0, 0xFFFF, 0x0D88, 0xFFFF,
+  0x058E, 0x06F1, 0x0241, 0xFFFF, 0xFFFF, 0x0056, 0xFFFF, 0xFFFF, 0x0C3C, 0xFFFF, 0x027C, 0xFFFF,
+  0x01C0, 0xFFFF, 0xFFFF, 0x01FA, 0xFFFF, 0xFFFF, 0x01DD, 0x01F4, 0x0C1D, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x04D1, 0xFFFF, 0x02E9, 0xFFFF, 0x03DF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0810,
+  0x0D6A, 0xFFFF, 0xFFFF, 0x07A4, 0xFFFF, 0xFFFF, 0x0162, 0xFFFF, 0xFFFF, 0x0C90, 0xFFFF, 0xFFFF,
+  0x08DB, 0x09A1, 0xFFFF, 0x0335, 0xFFFF, 0x0425, 0x095B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x018B,
+  0xFFFF, 0x03F7, 0x0927, 0x0953, 0xFFFF, 0x0BD3, 0xFFFF, 0xFFFF, 0xFFFF, 0x0CC3, 0xFFFF, 0xFFFF,
+  0x01A6, 0x092D, 0x06BC, 0xFFFF, 0x096C, 0x0457, 0xFFFF, 0xFFFF, 0xFFFF, 0x031A, 0x0DCA, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0B36, 0x039E, 0x0138, 0xFFFF, 0xFFFF, 0x0AF7, 0x03D5, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0BDE, 0xFFFF, 0x0BF5, 0xFFFF, 0xFFFF, 0x0879, 0x0B7F, 0x07EF, 0x0D7A, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0A90, 0x03A4, 0x000A, 0x0014, 0x0A41, 0x0383, 0xFFFF, 0x042A, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0434, 0x0110, 0xFFFF, 0x08B7, 0x0DDC, 0xFFFF, 0x05D2, 0x03F6, 0x038F, 0x0C2B,
+  0xFFFF, 0xFFFF, 0x0639, 0xFFFF, 0xFFFF, 0xFFFF, 0x0379, 0x02E5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0272, 0x0445, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0894, 0x0AD9,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0C58, 0xFFFF, 0x0D57, 0x0CBB, 0xFFFF, 0x0DA6, 0xFFFF, 0xFFFF, 0x017A,
+  0xFFFF, 0x04F0, 0xFFFF, 0x0B9E, 0xFFFF, 0xFFFF, 0xFFFF, 0x0A80, 0xFFFF, 0xFFFF, 0xFFFF, 0x01B0,
+  0x054B, 0xFFFF, 0xFFFF, 0x0B9A, 0xFFFF, 0xFFFF, 0x05D9, 0x0E30, 0xFFFF, 0xFFFF, 0xFFFF, 0x0AFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0D20, 0x02D2, 0xFFFF, 0xFFFF, 0x080F, 0x0DE8, 0x09CA,
+  0x0164, 0x0E01, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x08B6, 0x0B94, 0xFFFF, 0x00DB,
+  0x0D86, 0xFFFF, 0x0A70, 0x0946, 0x05C7, 0x08A6, 0xFFFF, 0x0030, 0x0C16, 0xFFFF, 0xFFFF, 0x09FF,
+  0xFFFF, 0xFFFF, 0x0DF0, 0xFFFF, 0x030E, 0x0612, 0xFFFF, 0xFFFF, 0x0E31, 0xFFFF, 0x0D4B, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0CAE, 0x0DBA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0842, 0xFFFF, 0xFFFF,
+  0x0025, 0xFFFF, 0xFFFF, 0xFFFF, 0x0A76, 0xFFFF, 0x0086, 0xFFFF, 0x0322, 0xFFFF, 0x0B61, 0x052C,
+  0x044C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x03C7, 0x03A2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0673,
+  0xFFFF, 0x0695, 0xFFFF, 0x06D0, 0xFFFF, 0x0D38, 0xFFFF, 0x04BC, 0x0B44, 0xFFFF, 0xFFFF, 0x0DD9,
+  0xFFFF, 0x0061, 0xFFFF, 0x0510, 0x09E5, 0xFFFF, 0x02DD, 0xFFFF, 0x022C, 0x0E13, 0xFFFF, 0x03BF,
+  0x05C3, 0x0095, 0xFFFF, 0xFFFF, 0xFFFF, 0x03A1, 0x066D, 0x006E, 0x07FD, 0xFFFF, 0x02B3, 0x0A0E,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x09B8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0678, 0x0050,
+  0x09F1, 0xFFFF, 0xFFFF, 0xFFFF, 0x0957, 0xFFFF, 0x06AA, 0x07E2, 0xFFFF, 0x0733, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0807, 0x03D6, 0xFFFF, 0xFFFF, 0xFFFF, 0x0649, 0xFFFF, 0xFFFF, 0x0023, 0xFFFF, 0x0159,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x022D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0CDA, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0C8D, 0x0752, 0x0A9C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x006D,
+  0x0A4C, 0xFFFF, 0x07C3, 0x07BC, 0xFFFF, 0x0693, 0xFFFF, 0x0AB2, 0x0132, 0x03B6, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x04B7, 0xFFFF, 0x0185, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0A1D, 0x09EA, 0xFFFF,
+  0xFFFF, 0x0306, 0x07E8, 0xFFFF, 0x0342, 0xFFFF, 0x0174, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0B7E,
+  0xFFFF, 0x04DD, 0xFFFF, 0x057C, 0xFFFF, 0x04D7, 0xFFFF, 0x0BD9, 0x04F9, 0xFFFF, 0x076B, 0x08C5,
+  0x02FA, 0x0329, 0xFFFF, 0x0CA0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0D6D, 0x0C5B, 0x0BE2, 0xFFFF,
+  0xFFFF, 0x0E2B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0DD3, 0xFFFF, 0xFFFF, 0x08C0, 0x02B2,
+  0xFFFF, 0xFFFF, 0x0C48, 0xFFFF, 0x0850, 0xFFFF, 0x0A25, 0xFFFF, 0x030A, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x03B5, 0x0642, 0xFFFF, 0xFFFF, 0xFFFF, 0x0DA4, 0x06C0, 0x038D, 0x0885, 0x094B, 0xFFFF,
+  0xFFFF, 0x09DF, 0xFFFF, 0x0B0E, 0x01AC, 0x0246, 0x0334, 0xFFFF, 0xFFFF, 0x08C7, 0x0A47, 0x0B4F,
+  0x0111, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0C0A, 0xFFFF, 0x036E, 0xFFFF, 0x06FB,
+  0x07A6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0CF6, 0x0AF0, 0x0D16, 0xFFFF, 0x0542, 0x0382, 0x0A45,
+  0x0325, 0xFFFF, 0xFFFF, 0x0A16, 0xFFFF, 0x027D, 0x059A, 0xFFFF, 0xFFFF, 0x070D, 0x0995, 0xFFFF,
+  0xFFFF, 0x076F, 0xFFFF, 0x0C30, 0x0C85, 0x04E7, 0x09DD, 0xFFFF, 0xFFFF, 0x0207, 0x0263, 0x0C9D,
+  0xFFFF, 0xFFFF, 0x041F, 0xFFFF, 0x03B0, 0xFFFF, 0x05E7, 0xFFFF, 0x06EC, 0xFFFF, 0xFFFF, 0x0C05,
+  0x0579, 0xFFFF, 0xFFFF, 0xFFFF, 0x099B, 0x079D, 0x0637, 0xFFFF, 0x0D52, 0x0773, 0x060F, 0x0E0C,
+  0xFFFF, 0xFFFF, 0x07FB, 0xFFFF, 0xFFFF, 0x00D0, 0x0720, 0x017F, 0xFFFF, 0x05F1, 0xFFFF, 0xFFFF,
+  0x0312, 0xFFFF, 0xFFFF, 0x06A1, 0xFFFF, 0x07C6, 0xFFFF, 0xFFFF, 0xFFFF, 0x001F, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0939, 0x055A, 0xFFFF, 0xFFFF, 0x0346, 0xFFFF, 0x0D89, 0x0C6B, 0x068B, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0D14, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0049, 0xFFFF, 0xFFFF, 0x02E6, 0xFFFF,
+  0x0C7A, 0x094C, 0x0B3E, 0x08D0, 0xFFFF, 0xFFFF, 0xFFFF, 0x0BB2, 0x0509, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x09CB, 0xFFFF, 0xFFFF, 0x07C2, 0xFFFF, 0x070B, 0xFFFF, 0xFFFF, 0x058F, 0x0B0F, 0xFFFF, 0xFFFF,
+  0x0224, 0xFFFF, 0x07A1, 0xFFFF, 0x0D77, 0x0206, 0x020C, 0xFFFF, 0xFFFF, 0x01CA, 0xFFFF, 0x0A3B,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0440, 0xFFFF, 0xFFFF, 0x0869, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0DBD, 0x0C2D, 0xFFFF, 0xFFFF, 0x0AE3, 0xFFFF, 0x0876, 0xFFFF, 0xFFFF,
+  0x023C, 0xFFFF, 0x0DE1, 0xFFFF, 0xFFFF, 0xFFFF, 0x08E3, 0x0653, 0xFFFF, 0x0B11, 0x0D66, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0E0B, 0x0B82, 0x0C84, 0xFFFF, 0xFFFF, 0xFFFF, 0x04F7, 0x0BD6, 0x064B,
+  0xFFFF, 0x0DB5, 0x015B, 0xFFFF, 0xFFFF, 0x0628, 0x0992, 0x053E, 0x0C10, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0D9C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0C15,
+  0xFFFF, 0x0058, 0x0118, 0x010D, 0x09D6, 0xFFFF, 0x034F, 0xFFFF, 0xFFFF, 0xFFFF, 0x0AA5, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0A0D, 0x0C22, 0xFFFF, 0x0011, 0x01BA, 0xFFFF,
+  0x0190, 0x0C7C, 0x0633, 0x0779, 0x05DE, 0xFFFF, 0x07CA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x017C, 0x082F, 0xFFFF, 0x0CD3, 0x038E, 0x0704, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x00CF, 0x0D2F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x05E1, 0x032C, 0x022F, 0x056C,
+  0x01C4, 0x0B26, 0x0757, 0xFFFF, 0xFFFF, 0xFFFF, 0x0D3C, 0x02C7, 0xFFFF, 0x0729, 0xFFFF, 0x031E,
+  0x051B, 0xFFFF, 0xFFFF, 0xFFFF, 0x03D2, 0x05A9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x068A, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0354, 0xFFFF, 0xFFFF, 0xFFFF, 0x085D, 0xFFFF, 0x050B, 0xFFFF, 0x02BE, 0xFFFF,
+  0x0146, 0xFFFF, 0xFFFF, 0x0888, 0xFFFF, 0x0537, 0xFFFF, 0xFFFF, 0x0B8C, 0x04FF, 0xFFFF, 0xFFFF,
+  0x021C, 0x02AF, 0x0744, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0DF7, 0xFFFF, 0x0259, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0E25, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0331, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x095E, 0x022E, 0xFFFF, 0xFFFF, 0x01B8, 0xFFFF, 0x0B2A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0689, 0x0BB7, 0x0CE5, 0x0C11, 0xFFFF, 0xFFFF, 0x0BB3, 0x03DA, 0xFFFF, 0x0AD8, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0BE7, 0x0B8D, 0x0DB2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0460, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0AD6, 0x09B0, 0xFFFF, 0x0462, 0xFFFF, 0x0A72, 0x033A, 0x0635, 0x088C, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x005A, 0x00AF, 0xFFFF, 0x0A4D, 0x0DA8, 0x0245, 0x0A86, 0x0634, 0xFFFF, 0xFFFF,
+  0x03A0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x055E, 0x0564, 0xFFFF, 0x0068, 0xFFFF, 0x0C0E, 0x052E,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0481, 0x0AEA, 0x0368, 0xFFFF, 0xFFFF,
+  0x0DB8, 0xFFFF, 0x0BC7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x08CD, 0x0315, 0xFFFF, 0xFFFF, 0x0029,
+  0xFFFF, 0x074F, 0x0999, 0x05BF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0B30, 0xFFFF, 0x00EE, 0x023E,
+  0xFFFF, 0xFFFF, 0x09E6, 0x04E2, 0x07FA, 0xFFFF, 0xFFFF, 0x0845, 0x0487, 0x0C20, 0xFFFF, 0x0891,
+  0x01A2, 0xFFFF, 0x0ADE, 0xFFFF, 0xFFFF, 0xFFFF, 0x0B8B, 0x09F7, 0xFFFF, 0xFFFF, 0x093F, 0x0B23,
+  0xFFFF, 0xFFFF, 0x04E0, 0x0477, 0xFFFF, 0x0B67, 0xFFFF, 0x092A, 0xFFFF, 0x0250, 0xFFFF, 0xFFFF,
+  0x06CD, 0x018A, 0x05E2, 0xFFFF, 0x0DF8, 0xFFFF, 0x0650, 0xFFFF, 0x08C4, 0xFFFF, 0x04B8, 0xFFFF,
+  0xFFFF, 0x01F7, 0xFFFF, 0x090F, 0x0D42, 0xFFFF, 0x03EA, 0x07A0, 0x04B3, 0xFFFF, 0x0A23, 0x090E,
+  0x0150, 0x021F, 0x0D2A, 0xFFFF, 0xFFFF, 0xFFFF, 0x0555, 0x0359, 0x0625, 0x0B57, 0xFFFF, 0xFFFF,
+  0x057E, 0x07D8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0A5C, 0x06E5, 0xFFFF, 0x0651, 0xFFFF,
+  0x0E2E, 0x0998, 0xFFFF, 0x08A4, 0x0ACF, 0xFFFF, 0xFFFF, 0x033C, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0BC2, 0x0804, 0xFFFF, 0x07DE, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x03C0, 0xFFFF, 0xFFFF, 0x0698, 0x073E, 0x0765, 0x03D7, 0x026C, 0xFFFF, 0xFFFF, 0xFFFF, 0x091C,
+  0xFFFF, 0x03DE, 0xFFFF, 0xFFFF, 0x0218, 0xFFFF, 0x0502, 0xFFFF, 0x0B6B, 0x0A69, 0xFFFF, 0xFFFF,
+  0x00BA, 0x00C1, 0x0944, 0xFFFF, 0xFFFF, 0xFFFF, 0x02D6, 0xFFFF, 0xFFFF, 0xFFFF, 0x002A, 0x0AF5,
+  0xFFFF, 0x013E, 0x0B46, 0xFFFF, 0xFFFF, 0x0B6D, 0x0308, 0xFFFF, 0xFFFF, 0xFFFF, 0x0910, 0xFFFF,
+  0x0703, 0x0D22, 0xFFFF, 0x043B, 0xFFFF, 0xFFFF, 0x04D8, 0x095F, 0xFFFF, 0xFFFF, 0x02E3, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0E16, 0xFFFF, 0xFFFF, 0x0DEB, 0x0A44, 0xFFFF, 0x0AC3, 0xFFFF, 0x0A1C, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0463, 0xFFFF, 0xFFFF, 0xFFFF, 0x035D, 0xFFFF, 0x0293, 0x0A5F, 0xFFFF,
+  0xFFFF, 0x0B96, 0x0C69, 0xFFFF, 0x01FF, 0xFFFF, 0x0D94, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x08C8, 0x0AB0, 0x0853, 0xFFFF, 0x0BEE, 0xFFFF, 0x00BC, 0x020B, 0x0618, 0xFFFF,
+  0x03C8, 0xFFFF, 0xFFFF, 0x049F, 0xFFFF, 0xFFFF, 0xFFFF, 0x00F1, 0x0D2C, 0xFFFF, 0xFFFF, 0x0454,
+  0x0CC7, 0xFFFF, 0xFFFF, 0xFFFF, 0x047B, 0xFFFF, 0x0129, 0xFFFF, 0x0386, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x076D, 0xFFFF, 0x077C, 0xFFFF, 0x0452, 0xFFFF, 0x06BA, 0xFFFF, 0x0951, 0x0BFA, 0xFFFF, 0x0833,
+  0x069D, 0x09C3, 0x0AC5, 0xFFFF, 0xFFFF, 0xFFFF, 0x02A5, 0x0855, 0x0847, 0xFFFF, 0xFFFF, 0x0DC9,
+  0xFFFF, 0xFFFF, 0x00E3, 0xFFFF, 0x0725, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0AE7, 0x0C93, 0xFFFF,
+  0xFFFF, 0x05A5, 0xFFFF, 0xFFFF, 0x0547, 0x0287, 0xFFFF, 0x0B31, 0x0413, 0x080C, 0x0A6B, 0xFFFF,
+  0x0A7C, 0xFFFF, 0xFFFF, 0x07EC, 0x0493, 0x0593, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x078B, 0x0902, 0xFFFF, 0x03C6, 0x09FD, 0xFFFF, 0xFFFF, 0x01CD, 0x014A, 0xFFFF, 0x016A, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0D0A, 0x0DDA, 0x0700, 0xFFFF, 0xFFFF, 0x071C, 0x0CEA, 0x08B5, 0xFFFF,
+  0xFFFF, 0x05F7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x08F6, 0xFFFF, 0xFFFF, 0x003A,
+  0xFFFF, 0x01D1, 0x0D10, 0xFFFF, 0xFFFF, 0x0022, 0x0830, 0x0337, 0xFFFF, 0xFFFF, 0xFFFF, 0x0832,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0706, 0x0CB3, 0x04E3, 0xFFFF, 0x0CCC, 0x0CA5, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0026, 0xFFFF, 0x0B24, 0x02AD, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x090D, 0x07F6, 0x0DF5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x07FC, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0498, 0xFFFF, 0xFFFF, 0x0DC5, 0xFFFF, 0xFFFF, 0x0A01, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0A4E, 0xFFFF, 0x04BA, 0xFFFF, 0x0DBF, 0x0143, 0xFFFF, 0xFFFF, 0x01CB, 0x02EE,
+  0x0070, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0DE2, 0x00F2, 0x0787, 0xFFFF, 0xFFFF, 0x0990, 0x010F,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0921, 0xFFFF, 0x01A0, 0xFFFF,
+  0x0210, 0x0764, 0xFFFF, 0x0D7D, 0x0904, 0x030C, 0x0C39, 0xFFFF, 0xFFFF, 0xFFFF, 0x0802, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0655, 0x0A98, 0x092B, 0x01B3, 0xFFFF, 0x03C9, 0xFFFF, 0x01BC, 0x0595,
+  0x00E0, 0xFFFF, 0x097C, 0xFFFF, 0x0037, 0xFFFF, 0x0349, 0x0795, 0x0321, 0xFFFF, 0xFFFF, 0x0D40,
+  0xFFFF, 0x0AA0, 0x0753, 0xFFFF, 0xFFFF, 0xFFFF, 0x0B5C, 0xFFFF, 0x0377, 0x0347, 0xFFFF, 0x00DD,
+  0xFFFF, 0x0586, 0xFFFF, 0xFFFF, 0x04F5, 0x0896, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x02B7, 0xFFFF,
+  0x04E4, 0x0D84, 0x0976, 0xFFFF, 0xFFFF, 0x0D4A, 0x064C, 0x065B, 0xFFFF, 0x05BD, 0xFFFF, 0x0606,
+  0x0512, 0xFFFF, 0x08D3, 0xFFFF, 0xFFFF, 0x0552, 0xFFFF, 0xFFFF, 0x074E, 0x05B8, 0xFFFF, 0xFFFF,
+  0x07DF, 0x0B18, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0248, 0x0D50, 0xFFFF, 0x0285, 0xFFFF, 0xFFFF,
+  0x0222, 0xFFFF, 0x0551, 0xFFFF, 0xFFFF, 0x0311, 0xFFFF, 0x0372, 0xFFFF, 0x0AD3, 0xFFFF, 0xFFFF,
+  0x0837, 0xFFFF, 0xFFFF, 0x0D4F, 0x0817, 0xFFFF, 0x09BB, 0xFFFF, 0x01F8, 0x0DAF, 0xFFFF, 0xFFFF,
+  0x0378, 0x025F, 0xFFFF, 0xFFFF, 0x04A0, 0x0124, 0xFFFF, 0x061D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x07B0, 0xFFFF, 0x0508, 0xFFFF, 0xFFFF, 0x0B86, 0x01E0, 0x041D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0103, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x02E0, 0x045F, 0x0D95, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0A51, 0xFFFF, 0xFFFF, 0xFFFF, 0x0109, 0x0590, 0x048E, 0x0B2F, 0xFFFF, 0xFFFF, 0x0435,
+  0x04FD, 0xFFFF, 0x0924, 0x076E, 0x0DC7, 0xFFFF, 0x0B85, 0xFFFF, 0x0521, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x06F9, 0xFFFF, 0x0300, 0xFFFF, 0xFFFF, 0xFFFF, 0x0204, 0xFFFF, 0xFFFF, 0xFFFF, 0x0C99, 0x0100,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x01B9, 0xFFFF, 0xFFFF, 0xFFFF, 0x0613, 0x0D18, 0x0834, 0x039C, 0xFFFF,
+  0xFFFF, 0x0170, 0xFFFF, 0x0E1C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0469, 0x0C60, 0xFFFF,
+  0x071F, 0x0C63, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x04CC,
+  0x013B, 0xFFFF, 0xFFFF, 0x06B0, 0x010E, 0xFFFF, 0xFFFF, 0x04DB, 0xFFFF, 0x01DB, 0x0CE2, 0xFFFF,
+  0x0A1B, 0xFFFF, 0xFFFF, 0x01C6, 0xFFFF, 0xFFFF, 0xFFFF, 0x08D2, 0x0986, 0x026A, 0x0466, 0x02C1,
+  0xFFFF, 0xFFFF, 0x0993, 0x0670, 0x00D1, 0xFFFF, 0xFFFF, 0xFFFF, 0x0D56, 0x08B9, 0x069A, 0x0313,
+  0xFFFF, 0xFFFF, 0x0223, 0x0BA1, 0x0A30, 0xFFFF, 0xFFFF, 0xFFFF, 0x01FC, 0xFFFF, 0xFFFF, 0x0864,
+  0x07FE, 0x0407, 0xFFFF, 0xFFFF, 0x0A05, 0x0D46, 0xFFFF, 0xFFFF, 0x09C2, 0xFFFF, 0xFFFF, 0x074C,
+  0x086C, 0x05BB, 0x0291, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x03E6, 0xFFFF, 0x0A77, 0xFFFF,
+  0x0BA2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x07B3, 0x0890, 0x09EF,
+  0x0710, 0x0975, 0xFFFF, 0x0CC8, 0xFFFF, 0x00CC, 0xFFFF, 0xFFFF, 0xFFFF, 0x081D, 0x0B38, 0xFFFF,
+  0xFFFF, 0x06CB, 0xFFFF, 0x014C, 0x0C8F, 0x0BC4, 0x075F, 0x07EE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0145, 0x0D93, 0x0DE9, 0xFFFF, 0x0309, 0x0035, 0xFFFF, 0xFFFF, 0x08F5, 0x0C0C, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0C56,
+  0x05ED, 0xFFFF, 0x032B, 0xFFFF, 0x0D96, 0xFFFF, 0xFFFF, 0x0937, 0x0B41, 0xFFFF, 0xFFFF, 0x08ED,
+  0xFFFF, 0x0755, 0x08D1, 0xFFFF, 0x0304, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x034C, 0xFFFF, 0x071A,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x087D, 0x0C5D, 0xFFFF, 0xFFFF, 0xFFFF, 0x0BAB,
+  0x0DB9, 0xFFFF, 0x0397, 0xFFFF, 0x02CF, 0xFFFF, 0x0C1E, 0xFFFF, 0x03CE, 0xFFFF, 0x040C, 0xFFFF,
+  0x0DAD, 0xFFFF, 0x06C7, 0xFFFF, 0xFFFF, 0x05C6, 0x04CE, 0xFFFF, 0x03A5, 0x0DC3, 0x055F, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0513, 0x0D6C, 0x00E1, 0x0814, 0x0AE9, 0x0D97, 0x0540, 0x09CF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0767, 0xFFFF, 0xFFFF, 0xFFFF, 0x0D2D, 0xFFFF, 0x0C50, 0x0C31, 0x0B6C, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x03B7, 0x0A03, 0xFFFF, 0x0CD2, 0x0DD0, 0xFFFF, 0x03AA, 0xFFFF, 0x0AFA, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x01B1, 0xFFFF, 0x0851, 0xFFFF, 0xFFFF, 0x00D4, 0xFFFF, 0x012F,
+  0x0B6E, 0x0DD5, 0x0A8D, 0xFFFF, 0x092C, 0x0B75, 0xFFFF, 0xFFFF, 0x0BCD, 0xFFFF, 0x0C70, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x038B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x00F9, 0xFFFF, 0x0201, 0x0B3B, 0xFFFF,
+  0x0432, 0xFFFF, 0x0886, 0xFFFF, 0x0A9F, 0x0DE6, 0xFFFF, 0x09A8, 0xFFFF, 0xFFFF, 0x099C, 0xFFFF,
+  0xFFFF, 0x0568, 0x0528, 0x09CE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x02DB, 0xFFFF, 0x0ADA, 0x08D4,
+  0xFFFF, 0xFFFF, 0x0BCE, 0xFFFF, 0x0C8A, 0x0DB0, 0x0422, 0x0AB3, 0xFFFF, 0xFFFF, 0x0DC0, 0x02F7,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x03AD, 0x0B40, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0705,
+  0xFFFF, 0x0682, 0x06C5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0D03, 0xFFFF, 0xFFFF, 0x077E,
+  0xFFFF, 0x08B2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0028, 0x0486, 0x0088, 0x0131, 0x0B3F, 0xFFFF,
+  0x08E8, 0x0AC7, 0xFFFF, 0xFFFF, 0x0933, 0xFFFF, 0xFFFF, 0xFFFF, 0x000E, 0xFFFF, 0x0544, 0xFFFF,
+  0x0467, 0xFFFF, 0x053B, 0xFFFF, 0xFFFF, 0x0BAE, 0x0AAE, 0xFFFF, 0x043C, 0x0793, 0xFFFF, 0xFFFF,
+  0x0A61, 0x0CFE, 0x040E, 0xFFFF, 0xFFFF, 0x0212, 0xFFFF, 0xFFFF, 0xFFFF, 0x0031, 0xFFFF, 0x05B1,
+  0xFFFF, 0xFFFF, 0x0A74, 0xFFFF, 0xFFFF, 0x01C9, 0xFFFF, 0x0044, 0x0BD0, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x02D8, 0xFFFF, 0x028C, 0xFFFF, 0xFFFF, 0x0239, 0x09D2, 0xFFFF, 0x06BD, 0xFFFF, 0x0C33, 0xFFFF,
+  0x00A7, 0xFFFF, 0x0D36, 0xFFFF, 0x0772, 0xFFFF, 0xFFFF, 0x084A, 0x0BA9, 0x0AAD, 0x09F8, 0xFFFF,
+  0xFFFF, 0x0654, 0xFFFF, 0x0DDE, 0x03EF, 0xFFFF, 0x0468, 0xFFFF, 0x0059, 0xFFFF, 0xFFFF, 0x008A,
+  0xFFFF, 0x046D, 0x0431, 0x0DBB, 0xFFFF, 0xFFFF, 0xFFFF, 0x09B1, 0xFFFF, 0xFFFF, 0x0D58, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0BED, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0345, 0x00E6, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x081C, 0x0B5D, 0xFFFF, 0xFFFF, 0x0292, 0xFFFF, 0x08BF, 0x0577, 0xFFFF, 0xFFFF, 0x0616, 0x02B1,
+  0x09F6, 0xFFFF, 0xFFFF, 0x077F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0303, 0xFFFF, 0x0BF9, 0x0C78,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x09EC, 0xFFFF, 0x09D3, 0x038A, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0423, 0xFFFF, 0xFFFF, 0x08E6, 0x0D61, 0x098C, 0xFFFF, 0x0B37, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0B65, 0x0257, 0x0812, 0x0D64, 0x05FD, 0x024E, 0xFFFF, 0x0786, 0x026B, 0xFFFF, 0x0479,
+  0x027A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0D99, 0xFFFF, 0xFFFF, 0x0268, 0x0BFE, 0x0B64, 0x03B3,
+  0xFFFF, 0x069C, 0xFFFF, 0x08A3, 0xFFFF, 0x04F3, 0xFFFF, 0xFFFF, 0x0038, 0x0281, 0xFFFF, 0x0B9C,
+  0x03AE, 0x02D0, 0x0115, 0x0167, 0x0583, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0515, 0x0429, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x092E, 0xFFFF, 0x00FA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x004E, 0xFFFF, 0x0B20,
+  0x08B4, 0xFFFF, 0xFFFF, 0xFFFF, 0x0D53, 0xFFFF, 0xFFFF, 0x0384, 0xFFFF, 0xFFFF, 0x0258, 0xFFFF,
+  0xFFFF, 0x0119, 0x0C01, 0x0B1C, 0xFFFF, 0xFFFF, 0x09AA, 0x02FB, 0xFFFF, 0x0010, 0x0B73, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x027E, 0x08E0, 0x0722, 0xFFFF, 0xFFFF, 0xFFFF, 0x0A2F, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0BBF, 0xFFFF, 0xFFFF, 0x093D, 0x02D1, 0x0B66, 0xFFFF, 0x0CA6, 0xFFFF, 0x0455,
+  0xFFFF, 0x0840, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x097B, 0x04E5, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0500, 0x03F8, 0xFFFF, 0xFFFF, 0x0BC8, 0xFFFF, 0xFFFF, 0x023A, 0x012A, 0x0D29, 0xFFFF, 0x0929,
+  0xFFFF, 0x0B79, 0xFFFF, 0x0A6C, 0xFFFF, 0xFFFF, 0xFFFF, 0x0941, 0x0B62, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x085F, 0xFFFF, 0xFFFF, 0xFFFF, 0x085A, 0x0A1F, 0x0562, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x06FC, 0xFFFF, 0x0266, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0DD8, 0xFFFF, 0xFFFF,
+  0x009F, 0x00C2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0571, 0xFFFF, 0xFFFF, 0xFFFF, 0x05E8, 0xFFFF,
+  0xFFFF, 0x0BEF, 0xFFFF, 0x0045, 0x0623, 0x03BD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0BA5, 0x0D24,
+  0x08C1, 0xFFFF, 0x0871, 0xFFFF, 0xFFFF, 0x0759, 0x08E4, 0x05DF, 0x0C96, 0x0683, 0x0B39, 0xFFFF,
+  0x0BF6, 0x037B, 0x0E37, 0xFFFF, 0x0BF2, 0x0761, 0xFFFF, 0x06C3, 0x05F2, 0x0A20, 0xFFFF, 0x0209,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x07F8, 0x01D3, 0x05EF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x00C7,
+  0xFFFF, 0xFFFF, 0x0117, 0xFFFF, 0x0DCD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0094, 0x0123,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0052, 0xFFFF, 0x00B1, 0x0CA7, 0x049C, 0xFFFF, 0x059D, 0xFFFF, 0x0470,
+  0x0A35, 0x0E2C, 0x09FC, 0xFFFF, 0x0B83, 0xFFFF, 0xFFFF, 0x07D4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0CD8, 0xFFFF, 0x06A2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x075A, 0x0797, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x06A9, 0xFFFF, 0x0D91, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0244, 0x082A, 0xFFFF, 0xFFFF, 0x0C2C, 0xFFFF, 0x0932, 0xFFFF,
+  0x089E, 0x0CF7, 0x09DB, 0xFFFF, 0x04C8, 0xFFFF, 0x0BCA, 0x0428, 0xFFFF, 0x0780, 0x0C88, 0x0474,
+  0xFFFF, 0x0489, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x00F6, 0x0B07, 0x0CF2, 0xFFFF, 0xFFFF, 0x048C,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x07E3, 0x06D5, 0x02EF, 0xFFFF, 0xFFFF, 0x07ED, 0xFFFF, 0x0732, 0xFFFF, 0xFFFF, 0x0DC4, 0xFFFF,
+  0xFFFF, 0x078F, 0xFFFF, 0xFFFF, 0x02FF, 0x04E9, 0x02B0, 0x0DBE, 0xFFFF, 0x08C3, 0x0217, 0x075B,
+  0xFFFF, 0xFFFF, 0x0113, 0x0A64, 0xFFFF, 0xFFFF, 0x026F, 0x05CA, 0xFFFF, 0xFFFF, 0x0B0D, 0x0ABA,
+  0x0915, 0xFFFF, 0x06F0, 0xFFFF, 0xFFFF, 0xFFFF, 0x0E35, 0x0CDC, 0xFFFF, 0xFFFF, 0x0D5C, 0xFFFF,
+  0x00C0, 0x0959, 0xFFFF, 0x0B63, 0x0775, 0x049E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x074B,
+  0x072C, 0x067A, 0x072B, 0xFFFF, 0x02D4, 0x0776, 0x0DDF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0C74, 0xFFFF,
+  0x09F2, 0x086F, 0xFFFF, 0xFFFF, 0x0B72, 0xFFFF, 0x0640, 0xFFFF, 0x0818, 0x0060, 0xFFFF, 0x02BC,
+  0xFFFF, 0x087F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x06ED, 0xFFFF,
+  0x0197, 0x0277, 0xFFFF, 0xFFFF, 0x01E6, 0xFFFF, 0xFFFF, 0xFFFF, 0x03BC, 0xFFFF, 0x01B4, 0x0CAD,
+  0xFFFF, 0x0DD6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0791, 0xFFFF, 0xFFFF, 0x0192, 0xFFFF, 0xFFFF, 0x0D8F, 0xFFFF, 0xFFFF, 0x0B6F, 0xFFFF, 0xFFFF,
+  0x0557, 0xFFFF, 0x0C1F, 0x01AE, 0xFFFF, 0x0E26, 0xFFFF, 0xFFFF, 0xFFFF, 0x0D87, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x05D7, 0x0784, 0x08EF, 0xFFFF, 0xFFFF, 0x09C8, 0x0545, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x005E, 0x0CE3, 0x0928, 0x0702, 0x0252, 0x00A0, 0x0339, 0x0989, 0xFFFF, 0xFFFF, 0x093C, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x00E8, 0xFFFF, 0xFFFF, 0x013F, 0x00EA, 0xFFFF, 0x02EA, 0xFFFF,
+  0x0CBC, 0x0144, 0xFFFF, 0xFFFF, 0xFFFF, 0x0D07, 0x0A29, 0xFFFF, 0x0617, 0xFFFF, 0x0741, 0x0514,
+  0x0BC3, 0xFFFF, 0x01AA, 0x019D, 0x058C, 0xFFFF, 0xFFFF, 0xFFFF, 0x0B7D, 0xFFFF, 0xFFFF, 0x05CF,
+  0x06EB, 0x03ED, 0xFFFF, 0xFFFF, 0x05EA, 0x0C92, 0x0D7F, 0xFFFF, 0xFFFF, 0x0451, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x01C7, 0xFFFF, 0xFFFF, 0xFFFF, 0x0C49, 0x09F5, 0xFFFF, 0x0CAC, 0x08A8, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x06EA, 0xFFFF, 0x05B7, 0x0DCE, 0xFFFF, 0x0BC9, 0xFFFF, 0x0408, 0x0400, 0xFFFF, 0xFFFF,
+  0x0B84, 0xFFFF, 0x005C, 0xFFFF, 0x0D4C, 0x02F0, 0xFFFF, 0xFFFF, 0x01F0, 0x08A0, 0x0A81, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0D00, 0xFFFF, 0x0048, 0x0163, 0xFFFF, 0xFFFF, 0x070A, 0x06D2,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0C4F, 0x0194, 0xFFFF, 0x07F7, 0x0DEC, 0xFFFF, 0x0B0A, 0xFFFF, 0xFFFF,
+  0x09B4, 0xFFFF, 0xFFFF, 0x074D, 0x029F, 0x0B1E, 0x01D9, 0xFFFF, 0x0494, 0x0231, 0x0900, 0x0809,
+  0x08FE, 0x0096, 0x000D, 0xFFFF, 0x0DE7, 0x081F, 0xFFFF, 0x0D78, 0x0DA0, 0x0DAA, 0xFFFF, 0x08C9,
+  0x0BCF, 0x02AB, 0x0D23, 0x012D, 0xFFFF, 0xFFFF, 0x0A97, 0x0286, 0x0490, 0xFFFF, 0x07E0, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x02C8, 0x0274, 0xFFFF, 0xFFFF, 0x024C, 0x0CE0, 0xFFFF, 0x0033, 0x0E04, 0x0805,
+  0x05F5, 0x0727, 0xFFFF, 0xFFFF, 0x072E, 0x0591, 0x0AA2, 0xFFFF, 0x043A, 0xFFFF, 0x0A18, 0xFFFF,
+  0x03E5, 0x0343, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x01FD, 0xFFFF, 0x0B17, 0xFFFF, 0x0949, 0x083D,
+  0x0C4A, 0x0631, 0x0CBD, 0xFFFF, 0xFFFF, 0x0D06, 0x0867, 0x0A75, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0BEA, 0x0A9D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0073, 0x0A83, 0xFFFF, 0x003F, 0xFFFF, 0xFFFF, 0xFFFF, 0x06E6, 0xFFFF, 0x0884, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0B02, 0x022A, 0x001A, 0xFFFF, 0x0326, 0xFFFF, 0xFFFF, 0xFFFF, 0x09AE, 0x0861,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0C6A, 0x01D2, 0x07A8, 0x07A5, 0xFFFF, 0xFFFF, 0x06C8,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0CE9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0019, 0xFFFF, 0x07D1, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x057B, 0xFFFF, 0xFFFF, 0xFFFF, 0x08FB, 0xFFFF, 0xFFFF, 0x07F5, 0xFFFF, 0x0DF9,
+  0xFFFF, 0xFFFF, 0x050F, 0xFFFF, 0x0567, 0x0A9B, 0xFFFF, 0xFFFF, 0x0D68, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0956, 0xFFFF, 0x008F, 0xFFFF, 0xFFFF, 0xFFFF, 0x0D63, 0xFFFF, 0x0762, 0x0A1A, 0x05FE,
+  0x0935, 0x098E, 0xFFFF, 0xFFFF, 0xFFFF, 0x0B4D, 0xFFFF, 0x024D, 0xFFFF, 0xFFFF, 0x0A6A, 0xFFFF,
+  0x026E, 0x0522, 0x0C94, 0xFFFF, 0x0556, 0xFFFF, 0x0684, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x03E7, 0xFFFF, 0xFFFF, 0xFFFF, 0x0AF1, 0x068F, 0x0001, 0x0B3D, 0xFFFF, 0xFFFF, 0xFFFF, 0x0AEC,
+  0x06FD, 0xFFFF, 0x0DEF, 0xFFFF, 0xFFFF, 0x044E, 0x01A3, 0xFFFF, 0xFFFF, 0xFFFF, 0x0099, 0xFFFF,
+  0x0182, 0x02C4, 0x0774, 0x0BF0, 0xFFFF, 0xFFFF, 0x048A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0BF3, 0x09E7, 0xFFFF, 0xFFFF, 0x0433, 0x0BE1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x063E, 0xFFFF,
+  0xFFFF, 0x08CE, 0x0171, 0x0D5D, 0xFFFF, 0xFFFF, 0x0D0B, 0xFFFF, 0xFFFF, 0x0391, 0xFFFF, 0x09E4,
+  0xFFFF, 0x077B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x07DA, 0xFFFF, 0x0C82, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0024, 0xFFFF, 0x0BB8, 0x0142, 0x06AB, 0xFFFF, 0x038C, 0xFFFF, 0x0444, 0xFFFF, 0x0B54,
+  0x070E, 0xFFFF, 0x02E7, 0xFFFF, 0xFFFF, 0xFFFF, 0x0B5B, 0x0DFF, 0xFFFF, 0xFFFF, 0x043D, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x05D8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0A04, 0x04D2, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0295, 0xFFFF, 0x0948, 0x0918, 0x05A6, 0xFFFF, 0x0AB1, 0x0AFD, 0xFFFF, 0xFFFF, 0x0594, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x01F3, 0x024B, 0xFFFF, 0x0193, 0xFFFF, 0xFFFF, 0x0D02, 0x0198,
+  0x068D, 0xFFFF, 0xFFFF, 0x015E, 0x0D17, 0xFFFF, 0x0C73, 0xFFFF, 0x09BD, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0A26, 0x06E0, 0x0153, 0x0473, 0x088A, 0xFFFF, 0x0AF9, 0xFFFF, 0x0CE7, 0x03DB, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0C66, 0x075E, 0xFFFF, 0xFFFF, 0x084F, 0x0A3A, 0xFFFF, 0xFFFF, 0x0D2B, 0x05B0, 0x0AC6,
+  0x0041, 0x03DC, 0x0669, 0xFFFF, 0xFFFF, 0x03FA, 0x0647, 0x0BA0, 0x0604, 0x04DC, 0x019E, 0x00CA,
+  0x0624, 0x077D, 0x073C, 0xFFFF, 0xFFFF, 0xFFFF, 0x0770, 0x06AD, 0x0176, 0x0A12, 0x0BDD, 0xFFFF,
+  0x008C, 0x0C77, 0xFFFF, 0xFFFF, 0x0943, 0x00BF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0485, 0x04C0, 0x0659,
+  0xFFFF, 0x01A5, 0x029A, 0xFFFF, 0xFFFF, 0x0629, 0xFFFF, 0xFFFF, 0xFFFF, 0x0C18, 0xFFFF, 0x01DE,
+  0x0B05, 0x0739, 0xFFFF, 0x07D5, 0x02FC, 0x01CE, 0xFFFF, 0xFFFF, 0x0200, 0x045C, 0x032E, 0xFFFF,
+  0xFFFF, 0x0578, 0xFFFF, 0x0968, 0x0317, 0x0021, 0xFFFF, 0x0D80, 0x0AD2, 0x0DFD, 0xFFFF, 0x0645,
+  0x001B, 0x02A9, 0x0626, 0xFFFF, 0xFFFF, 0x0E20, 0xFFFF, 0x0895, 0x0608, 0x0A7E, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x048F, 0xFFFF, 0x062F, 0xFFFF, 0x0B4C, 0xFFFF, 0xFFFF, 0xFFFF, 0x06FA,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0228, 0x091A, 0xFFFF, 0xFFFF, 0xFFFF, 0x094E, 0x02C0, 0xFFFF, 0x057A,
+  0xFFFF, 0xFFFF, 0x0BF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x07B7, 0xFFFF, 0x023F, 0x0B50, 0x05AF,
+  0xFFFF, 0x00F3, 0x0092, 0xFFFF, 0xFFFF, 0xFFFF, 0x0091, 0x033D, 0xFFFF, 0x0017, 0xFFFF, 0x05F9,
+  0x008E, 0xFFFF, 0x0987, 0xFFFF, 0x0B90, 0xFFFF, 0x0348, 0xFFFF, 0x09AB, 0xFFFF, 0x0D0C, 0x093B,
+  0xFFFF, 0xFFFF, 0x0B68, 0xFFFF, 0x0912, 0xFFFF, 0xFFFF, 0x01E1, 0x0897, 0x0D85, 0x0179, 0xFFFF,
+  0x0A3D, 0x04B5, 0x032D, 0x09C6, 0x0C83, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x015C, 0x0122,
+  0x0C34, 0xFFFF, 0xFFFF, 0x07AE, 0x0970, 0xFFFF, 0x0A84, 0x01EB, 0xFFFF, 0xFFFF, 0xFFFF, 0x0A9E,
+  0x0716, 0xFFFF, 0xFFFF, 0xFFFF, 0x09DE, 0x00EB, 0xFFFF, 0x0AEE, 0x0B06, 0x0A8E, 0x003C, 0xFFFF,
+  0x041E, 0xFFFF, 0xFFFF, 0xFFFF, 0x0238, 0x086B, 0xFFFF, 0x0690, 0xFFFF, 0xFFFF, 0xFFFF, 0x090A,
+  0xFFFF, 0x0919, 0xFFFF, 0x0529, 0xFFFF, 0x0C1A, 0xFFFF, 0x0A82, 0x0D35, 0x0813, 0x066C, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0081, 0xFFFF, 0xFFFF, 0xFFFF, 0x0954, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x007D, 0x0B6A, 0x0AA8, 0x02E4, 0xFFFF, 0x05C1,
+  0xFFFF, 0x08FA, 0xFFFF, 0xFFFF, 0x09A7, 0xFFFF, 0x07B8, 0x0A8F, 0xFFFF, 0x03F2, 0xFFFF, 0xFFFF,
+  0x00ED, 0x010A, 0xFFFF, 0x0B4A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x05B3,
+  0xFFFF, 0xFFFF, 0x0D6F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0B29, 0x0B8A, 0x04B0, 0xFFFF,
+  0x003B, 0xFFFF, 0xFFFF, 0x048D, 0xFFFF, 0x0ACD, 0x0C5A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x04E8,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x04EE, 0xFFFF, 0xFFFF, 0x08BC, 0x0728, 0xFFFF, 0x0CFD, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x01CC, 0x0130, 0xFFFF, 0xFFFF, 0xFFFF, 0x0047, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0952, 0x09FB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0D31, 0xFFFF, 0xFFFF, 0x054A,
+  0x06E7, 0xFFFF, 0x0B45, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x02DA, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x02A7, 0xFFFF, 0xFFFF, 0x0DA7, 0x0587, 0x0A96, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0C8C, 0xFFFF, 0xFFFF, 0x0CF1, 0x0BFD, 0x07BB, 0xFFFF, 0x0BD2, 0xFFFF,
+  0x088E, 0x0361, 0x06B7, 0xFFFF, 0xFFFF, 0x0DE5, 0xFFFF, 0xFFFF, 0xFFFF, 0x0215, 0xFFFF, 0x0ADF,
+  0x055B, 0x08EE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0396, 0xFFFF, 0x0D2E, 0x0D08,
+  0x077A, 0xFFFF, 0x0533, 0x0427, 0xFFFF, 0x0605, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x04CD,
+  0x08C6, 0x00B5, 0x0561, 0xFFFF, 0x01D0, 0xFFFF, 0x02D3, 0x018E, 0x06B9, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0685, 0xFFFF, 0x0DFC, 0xFFFF, 0x0967, 0xFFFF,
+  0x032F, 0x0504, 0xFFFF, 0xFFFF, 0x0ABF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x07AB, 0xFFFF,
+  0x04FE, 0x04C2, 0xFFFF, 0xFFFF, 0xFFFF, 0x006B, 0xFFFF, 0x0254, 0xFFFF, 0xFFFF, 0x0D1D, 0x034B,
+  0x0BBA, 0x09E2, 0x0A0A, 0x0AA6, 0x0AC2, 0x07D0, 0x02C2, 0x01E7, 0x01F5, 0x016D, 0x0E14, 0xFFFF,
+  0x02B9, 0xFFFF, 0x05DB, 0xFFFF, 0x08F2, 0x078C, 0xFFFF, 0xFFFF, 0xFFFF, 0x083F, 0xFFFF, 0x025C,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x081A, 0x08BA, 0xFFFF, 0xFFFF, 0x0D98, 0x0D59, 0xFFFF, 0x0CC0, 0xFFFF,
+  0x0BFB, 0x0456, 0x00A1, 0x05D4, 0x0AC0, 0xFFFF, 0x0E1A, 0xFFFF, 0xFFFF, 0x08BB, 0x0C21, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x067E, 0xFFFF, 0xFFFF, 0xFFFF, 0x0D1B, 0xFFFF, 0x083C, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0B60, 0xFFFF, 0x041A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0B28, 0xFFFF, 0x0ACE,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0C1C, 0x0BD5, 0xFFFF, 0xFFFF, 0x015D, 0xFFFF, 0x0B77, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0558, 0xFFFF, 0x0175, 0x0B49, 0xFFFF, 0xFFFF, 0xFFFF, 0x0E0D, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x01AD, 0xFFFF, 0xFFFF, 0xFFFF, 0x05D1, 0xFFFF, 0xFFFF, 0x0680, 0x0ABE,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x03D9, 0xFFFF, 0x00A5, 0xFFFF, 0x019F, 0x0388, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x063F,
+  0xFFFF, 0xFFFF, 0x0097, 0xFFFF, 0x0282, 0x0CBA, 0xFFFF, 0xFFFF, 0x0667, 0x0559, 0x0160, 0xFFFF,
+  0xFFFF, 0x0554, 0xFFFF, 0x0C9C, 0xFFFF, 0x0A92, 0x063D, 0x0BDB, 0x00B8, 0xFFFF, 0x00C5, 0x0CEF,
+  0x08AB, 0xFFFF, 0xFFFF, 0x05C2, 0x0085, 0xFFFF, 0x0139, 0xFFFF, 0x0D34, 0x0214, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x08B0, 0x0B5A, 0x08AF, 0xFFFF, 0xFFFF, 0x0332, 0x080B, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0076, 0xFFFF, 0x001D, 0xFFFF, 0xFFFF, 0xFFFF, 0x0251, 0xFFFF, 0xFFFF, 0x0D71, 0xFFFF, 0xFFFF,
+  0x0152, 0xFFFF, 0xFFFF, 0x06E9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0AB9,
+  0x078A, 0x084D, 0x011D, 0xFFFF, 0x0016, 0x04C6, 0xFFFF, 0x0BE0, 0x0585, 0xFFFF, 0xFFFF, 0x045A,
+  0xFFFF, 0x049B, 0xFFFF, 0xFFFF, 0x00E7, 0x0B47, 0x0723, 0x0CB8, 0x0AA4, 0x00AA, 0x0A54, 0xFFFF,
+  0x0273, 0xFFFF, 0xFFFF, 0x0140, 0xFFFF, 0xFFFF, 0x08BD, 0xFFFF, 0xFFFF, 0x0D3E, 0x0385, 0x0839,
+  0xFFFF, 0x096E, 0x08AD, 0x0974, 0x091F, 0xFFFF, 0x03FD, 0x099D, 0xFFFF, 0xFFFF, 0xFFFF, 0x066F,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0671, 0xFFFF, 0xFFFF, 0x04A5, 0x0106, 0x0BBB, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x005F, 0x0BE5, 0xFFFF, 0xFFFF, 0x088F, 0x0AC8, 0x01C3, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0ADD, 0xFFFF, 0x0D21, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0484, 0x0610, 0x0BB5, 0xFFFF,
+  0x08DF, 0x0249, 0xFFFF, 0xFFFF, 0x0071, 0x05E5, 0xFFFF, 0xFFFF, 0x0046, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0A4A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0C29, 0xFFFF, 0x0B2E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x09BC, 0xFFFF, 0x085C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0743, 0x096D, 0xFFFF, 0x03D0, 0x0663, 0x06C6, 0x0646, 0x0D8D, 0xFFFF, 0x0426, 0xFFFF, 0xFFFF,
+  0x0CC6, 0x04B9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x03EB, 0x05CB, 0xFFFF, 0x0D9D, 0xFFFF, 0x098A,
+  0x0D7B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x09B6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x009B, 0xFFFF, 0xFFFF, 0x0E1D, 0x0883, 0xFFFF, 0xFFFF, 0x030B, 0xFFFF,
+  0xFFFF, 0x0357, 0x0A71, 0x0525, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x05B2, 0x0BBC, 0x098F, 0x067C,
+  0xFFFF, 0x0B56, 0xFFFF, 0xFFFF, 0x04A6, 0x073F, 0xFFFF, 0x0CA9, 0xFFFF, 0x08DA, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0598, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0E24, 0x0660, 0xFFFF, 0xFFFF, 0x0D69, 0x0B92, 0xFFFF, 0x0D3A, 0xFFFF, 0xFFFF, 0x058A, 0xFFFF,
+  0x0961, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x02D7, 0x0D12, 0x02A0, 0x0446, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x069B, 0xFFFF, 0x09D1, 0x06CA, 0xFFFF, 0x033E, 0xFFFF, 0x07B2, 0x09F4, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0B87, 0xFFFF, 0x0530, 0xFFFF, 0x0137, 0xFFFF, 0xFFFF, 0x04BB,
+  0x09F0, 0xFFFF, 0x0189, 0xFFFF, 0x081B, 0x0662, 0x0211, 0xFFFF, 0xFFFF, 0x07E9, 0xFFFF, 0x0283,
+  0x0365, 0xFFFF, 0xFFFF, 0xFFFF, 0x0196, 0xFFFF, 0x0E12, 0xFFFF, 0xFFFF, 0x0E22, 0xFFFF, 0x032A,
+  0x05C4, 0xFFFF, 0x063C, 0xFFFF, 0x02F8, 0x058B, 0x069E, 0x04DE, 0x0599, 0xFFFF, 0xFFFF, 0x05A1,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0538, 0x069F, 0x0516, 0xFFFF, 0x0749, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0BB6, 0xFFFF, 0x02BF, 0x0BE6, 0xFFFF, 0xFFFF, 0x000B, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x046C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0229, 0xFFFF, 0xFFFF, 0x028B,
+  0xFFFF, 0xFFFF, 0x0A5B, 0x07CC, 0xFFFF, 0xFFFF, 0x08DD, 0x0BE9, 0x04CB, 0x04DF, 0xFFFF, 0x0A66,
+  0x0495, 0xFFFF, 0x07B6, 0x028D, 0xFFFF, 0x083E, 0xFFFF, 0xFFFF, 0x0D3F, 0x0C95, 0xFFFF, 0xFFFF,
+  0x07AA, 0x0A08, 0x00DC, 0xFFFF, 0x0718, 0x0126, 0xFFFF, 0xFFFF, 0x0208, 0x0491, 0xFFFF, 0x09EB,
+  0xFFFF, 0xFFFF, 0x0AC4, 0xFFFF, 0x0B04, 0xFFFF, 0x06C1, 0xFFFF, 0x007E, 0x0358, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0043, 0xFFFF, 0x0458, 0x0C89, 0x0777, 0x0BC0, 0x04C1, 0x02F1, 0x0D8C, 0x0C19,
+  0xFFFF, 0xFFFF, 0x0DE4, 0x0A50, 0xFFFF, 0xFFFF, 0xFFFF, 0x06FE, 0xFFFF, 0xFFFF, 0x05A8, 0x065E,
+  0x05D0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0B3A, 0x06BB, 0xFFFF, 0xFFFF, 0x060B, 0xFFFF, 0x00EC,
+  0x00F5, 0x03CF, 0xFFFF, 0x0184, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0A94, 0x0DC8,
+  0x0C2F, 0x0AAA, 0x0674, 0xFFFF, 0x0519, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x061B, 0xFFFF, 0xFFFF,
+  0x0069, 0xFFFF, 0xFFFF, 0x068E, 0xFFFF, 0xFFFF, 0x0C67, 0x014E, 0x07DD, 0xFFFF, 0xFFFF, 0x095A,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0C98, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x02CA, 0xFFFF, 0x0E23,
+  0xFFFF, 0x06D4, 0x020F, 0xFFFF, 0x05A7, 0xFFFF, 0x0823, 0x05F3, 0x0057, 0xFFFF, 0x0857, 0x0C43,
+  0xFFFF, 0x0355, 0xFFFF, 0x03E3, 0x0439, 0x0756, 0xFFFF, 0xFFFF, 0x04D4, 0x0BA7, 0xFFFF, 0xFFFF,
+  0x052D, 0x0CD0, 0x004A, 0x0676, 0xFFFF, 0x0878, 0xFFFF, 0x0324, 0x01DC, 0xFFFF, 0xFFFF, 0x013A,
+  0x0875, 0xFFFF, 0x02CE, 0x02D9, 0x0736, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x03A3, 0xFFFF, 0x09D8,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0566, 0xFFFF, 0x06FF, 0xFFFF, 0x0A43, 0x0835, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x037F, 0x0534, 0xFFFF, 0x0CFB, 0x0401, 0x0E02, 0x06B3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0CE8, 0x06AC, 0xFFFF, 0x0527, 0xFFFF, 0x01F1, 0xFFFF, 0xFFFF, 0xFFFF, 0x0836, 0x0389, 0xFFFF,
+  0x0319, 0x0620, 0x0A55, 0x0D74, 0x0CB4, 0xFFFF, 0x0B08, 0x0C57, 0xFFFF, 0xFFFF, 0x04BF, 0x0898,
+  0xFFFF, 0x0A0B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0BDA, 0x051E, 0xFFFF, 0x045E, 0xFFFF, 0x00FF,
+  0xFFFF, 0xFFFF, 0x0931, 0xFFFF, 0x0771, 0xFFFF, 0x0B01, 0x020A, 0xFFFF, 0xFFFF, 0x0DDD, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x01C8, 0x0B81, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x08FF,
+  0xFFFF, 0x08DC, 0x07C1, 0xFFFF, 0x079C, 0xFFFF, 0xFFFF, 0xFFFF, 0x080A, 0xFFFF, 0x05DA, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0D0D, 0xFFFF, 0xFFFF, 0x06A5, 0x0543, 0xFFFF, 0xFFFF, 0x0013, 0xFFFF, 0x07B4,
+  0x012B, 0x08F8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0CCB, 0x03C1, 0x0C9E, 0xFFFF, 0x0441,
+  0xFFFF, 0x0371, 0x0CDF, 0x033B, 0x0A7B, 0x0D5B, 0xFFFF, 0xFFFF, 0xFFFF, 0x0036, 0x068C, 0x095D,
+  0x0CD1, 0xFFFF, 0xFFFF, 0x0859, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0E27,
+  0x035F, 0xFFFF, 0x05F8, 0x09ED, 0xFFFF, 0xFFFF, 0x0C36, 0x0233, 0xFFFF, 0x0C3D, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0E36, 0xFFFF, 0x050C, 0x09DA, 0x04AD, 0x01D4,
+  0x0619, 0x0950, 0x084B, 0xFFFF, 0x0539, 0xFFFF, 0xFFFF, 0x0127, 0x0414, 0xFFFF, 0x0E33, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x06CF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0005,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0B21, 0xFFFF, 0xFFFF, 0xFFFF, 0x0364, 0x01FE, 0xFFFF,
+  0x0801, 0xFFFF, 0xFFFF, 0x047F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0DFA, 0xFFFF, 0x04BE, 0x035E,
+  0x0436, 0xFFFF, 0xFFFF, 0x0AF8, 0x02DF, 0x03C4, 0xFFFF, 0x04AA, 0xFFFF, 0xFFFF, 0x05CC, 0x0D76,
+  0xFFFF, 0xFFFF, 0x0A62, 0xFFFF, 0x0573, 0xFFFF, 0xFFFF, 0xFFFF, 0x08F7, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0C80, 0xFFFF, 0xFFFF, 0xFFFF, 0x0199, 0xFFFF, 0x0699, 0xFFFF, 0xFFFF, 0x0072, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x03E9, 0xFFFF, 0x0CFF, 0x0301, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x010C, 0x089B,
+  0x0464, 0xFFFF, 0xFFFF, 0xFFFF, 0x0877, 0x028E, 0x0DBC, 0x0B78, 0xFFFF, 0x0202, 0x07CB, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0AA7, 0x054C, 0xFFFF, 0xFFFF, 0x040F, 0x0668, 0xFFFF, 0xFFFF, 0xFFFF, 0x0079,
+  0xFFFF, 0xFFFF, 0x0116, 0xFFFF, 0x0168, 0x085E, 0xFFFF, 0x0243, 0x0A07, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0341, 0x0C2A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0C76, 0x0621, 0xFFFF,
+  0xFFFF, 0x0A2C, 0x07C5, 0xFFFF, 0x07F1, 0x06D6, 0x0280, 0x0367, 0x07A2, 0x0C0F, 0x0E18, 0xFFFF,
+  0xFFFF, 0x080E, 0x082D, 0x0370, 0x0E2F, 0xFFFF, 0xFFFF, 0xFFFF, 0x0666, 0x0A3C, 0xFFFF, 0x02ED,
+  0x0930, 0xFFFF, 0x0136, 0x0A63, 0xFFFF, 0xFFFF, 0xFFFF, 0x0553, 0x04A4, 0x03F9, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x063A, 0xFFFF, 0x0C55, 0xFFFF, 0xFFFF, 0x0B88, 0xFFFF, 0xFFFF, 0x0134, 0xFFFF, 0x046E,
+  0x0A5E, 0x0C0D, 0x042C, 0x0B09, 0xFFFF, 0xFFFF, 0x0CDB, 0xFFFF, 0xFFFF, 0xFFFF, 0x0880, 0x031D,
+  0xFFFF, 0x0B4E, 0x0369, 0x05B9, 0x05E0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x07CD, 0x03EC, 0xFFFF, 0x03D8, 0xFFFF, 0xFFFF, 0x0DF4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x02A4,
+  0xFFFF, 0xFFFF, 0x0032, 0x06E1, 0x0D0E, 0xFFFF, 0x06E3, 0xFFFF, 0x0B97, 0xFFFF, 0x0135, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0415, 0xFFFF, 0xFFFF, 0xFFFF, 0x0ACC, 0xFFFF, 0xFFFF, 0x0A2D, 0xFFFF, 0x0B1A,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0589, 0xFFFF, 0x089C, 0xFFFF, 0x0CC9, 0xFFFF, 0xFFFF, 0x0316,
+  0xFFFF, 0x0409, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0ABC, 0xFFFF, 0x00C6,
+  0x0C3B, 0xFFFF, 0x02E2, 0xFFFF, 0xFFFF, 0x0657, 0x0C3E, 0x0938, 0xFFFF, 0x025E, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0AD1, 0x0128, 0xFFFF, 0x0BDF, 0x0114, 0x031C, 0xFFFF, 0x09AD, 0x07DC, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x07DB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x060C, 0x0978, 0xFFFF, 0xFFFF, 0x04FC, 0xFFFF, 0xFFFF, 0x0496, 0xFFFF, 0xFFFF, 0xFFFF, 0x0A21,
+  0xFFFF, 0xFFFF, 0x07C7, 0xFFFF, 0xFFFF, 0xFFFF, 0x0133, 0xFFFF, 0xFFFF, 0xFFFF, 0x08AE, 0xFFFF,
+  0x0C6E, 0x06F5, 0xFFFF, 0xFFFF, 0x0A14, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0042, 0x0E0A, 0x0750,
+  0xFFFF, 0x04F2, 0xFFFF, 0xFFFF, 0x034E, 0xFFFF, 0xFFFF, 0xFFFF, 0x04C3, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0B69, 0x0AE1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0597, 0x0988, 0xFFFF,
+  0x00F8, 0xFFFF, 0xFFFF, 0xFFFF, 0x04D3, 0xFFFF, 0xFFFF, 0x043F, 0x0AF4, 0xFFFF, 0x0981, 0xFFFF,
+  0xFFFF, 0x05BC, 0x09A3, 0x086D, 0xFFFF, 0x097F, 0x000C, 0xFFFF, 0x0C41, 0x0BE4, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0C9F, 0xFFFF, 0x0448, 0xFFFF, 0x04AF, 0x05A3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0962,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0CF0, 0x0B5F, 0xFFFF, 0x05CD, 0xFFFF, 0x0B25, 0x0380,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x02EB, 0xFFFF, 0x0AF6, 0xFFFF, 0xFFFF, 0x0269, 0x0748, 0x0B42,
+  0xFFFF, 0x0261, 0x05AB, 0xFFFF, 0x0305, 0xFFFF, 0x0574, 0x0BE8, 0xFFFF, 0xFFFF, 0x0BAC, 0xFFFF,
+  0x0E03, 0x04D9, 0xFFFF, 0x0B33, 0xFFFF, 0xFFFF, 0x03FB, 0x0D37, 0xFFFF, 0x0E38, 0x0672, 0x0665,
+  0x002B, 0xFFFF, 0x0536, 0x05E9, 0x08A5, 0x05FC, 0x0004, 0xFFFF, 0x00AC, 0xFFFF, 0x0AA9, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0360, 0x0D65, 0x03B9, 0xFFFF, 0xFFFF, 0x0320, 0x00A4, 0xFFFF, 0xFFFF, 0x064A,
+  0x0E05, 0x00C8, 0xFFFF, 0xFFFF, 0x06DD, 0xFFFF, 0x0609, 0x094A, 0x0960, 0xFFFF, 0xFFFF, 0x02F4,
+  0xFFFF, 0x012C, 0xFFFF, 0x060A, 0xFFFF, 0x04F6, 0xFFFF, 0xFFFF, 0xFFFF, 0x034D, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x03E0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0BE3, 0x0DF1, 0xFFFF,
+  0x0B9D, 0xFFFF, 0x0B71, 0x0A7D, 0xFFFF, 0x02A6, 0xFFFF, 0x0323, 0xFFFF, 0x0CB0, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x01E4, 0xFFFF, 0x08A2, 0xFFFF, 0x0256,
+  0x0796, 0xFFFF, 0x024A, 0x07E1, 0xFFFF, 0xFFFF, 0xFFFF, 0x01A1, 0x014F, 0x0157, 0xFFFF, 0x0DAC,
+  0x070C, 0x0576, 0x053F, 0x0947, 0x0C4C, 0xFFFF, 0x0550, 0xFFFF, 0x0260, 0x0E2A, 0x002E, 0x047E,
+  0xFFFF, 0xFFFF, 0x09D7, 0x01EC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x048B, 0xFFFF, 0x09AC, 0x0C17,
+  0x0BAF, 0x005D, 0xFFFF, 0x09D4, 0xFFFF, 0xFFFF, 0x0205, 0x0A59, 0x0054, 0xFFFF, 0xFFFF, 0x0724,
+  0x05C8, 0x0925, 0x0679, 0xFFFF, 0x082C, 0x0838, 0x00D2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0350, 0x039A, 0x04C9, 0x0860, 0xFFFF, 0xFFFF, 0xFFFF, 0x00F0, 0xFFFF, 0x004F, 0x0393, 0x0831,
+  0xFFFF, 0xFFFF, 0x0453, 0xFFFF, 0x0363, 0xFFFF, 0x03A9, 0x00E2, 0xFFFF, 0xFFFF, 0xFFFF, 0x002D,
+  0xFFFF, 0xFFFF, 0x007B, 0x039F, 0x0A89, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x01C1,
+  0x0DD1, 0xFFFF, 0x0310, 0xFFFF, 0xFFFF, 0xFFFF, 0x0713, 0xFFFF, 0x0B76, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0C1B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0940, 0x0708,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0DE3, 0xFFFF, 0x04AE, 0x01A4, 0xFFFF, 0x057D, 0x0390,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0C38, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x09BF, 0x0763,
+  0xFFFF, 0x0923, 0xFFFF, 0xFFFF, 0xFFFF, 0x00B6, 0xFFFF, 0xFFFF, 0x04A9, 0xFFFF, 0xFFFF, 0x030F,
+  0xFFFF, 0xFFFF, 0x0570, 0x06D1, 0xFFFF, 0x0636, 0x04F1, 0xFFFF, 0xFFFF, 0x073D, 0x02E1, 0x0B12,
+  0x097E, 0x01F9, 0x0656, 0x0CBF, 0xFFFF, 0x0908, 0x0681, 0xFFFF, 0xFFFF, 0xFFFF, 0x0A17, 0xFFFF,
+  0x060E, 0xFFFF, 0xFFFF, 0x0734, 0xFFFF, 0xFFFF, 0xFFFF, 0x07EA, 0xFFFF, 0x033F, 0x0980, 0x0173,
+  0xFFFF, 0x0806, 0xFFFF, 0x0307, 0x0C5E, 0xFFFF, 0xFFFF, 0x03C2, 0x0CCA, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x08F4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0412, 0xFFFF, 0xFFFF, 0x016E, 0x0A48,
+  0x0476, 0xFFFF, 0xFFFF, 0x0E10, 0x09A5, 0x0DA3, 0xFFFF, 0x01D8, 0x0A22, 0x0D41, 0x0015, 0x0B4B,
+  0x0C44, 0x047D, 0xFFFF, 0x011E, 0xFFFF, 0x044B, 0xFFFF, 0x067F, 0x0480, 0x0B80, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x028A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x017B,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0790, 0xFFFF, 0x0C12, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0051, 0x0742, 0x00C3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0507, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x05AA, 0x0754, 0xFFFF, 0x0C08, 0xFFFF, 0xFFFF, 0x0ACA, 0xFFFF, 0xFFFF, 0x01E9,
+  0x047C, 0xFFFF, 0xFFFF, 0x0AB8, 0x0D48, 0x07E7, 0xFFFF, 0x0235, 0xFFFF, 0xFFFF, 0x02AA, 0xFFFF,
+  0x011C, 0x0CAA, 0x0503, 0x0A79, 0x0083, 0xFFFF, 0x062B, 0xFFFF, 0x0906, 0xFFFF, 0x0652, 0xFFFF,
+  0xFFFF, 0x0792, 0x09AF, 0x017E, 0xFFFF, 0x09E0, 0x0CBE, 0x0DD2, 0xFFFF, 0xFFFF, 0x059C, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x040D, 0x0395, 0xFFFF, 0x09D0, 0x0C4B, 0x042D, 0xFFFF, 0x0E19, 0x0523, 0xFFFF,
+  0xFFFF, 0x0535, 0x02BA, 0x0B70, 0x0D28, 0x053A, 0xFFFF, 0xFFFF, 0xFFFF, 0x091E, 0xFFFF, 0xFFFF,
+  0x07A7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0C7D, 0xFFFF, 0xFFFF, 0x0758, 0x0922, 0x09B5, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0BF1, 0x05E6, 0xFFFF, 0x0CE1, 0x04D5, 0x0D5A, 0xFFFF, 0x06B1, 0xFFFF, 0xFFFF,
+  0x0C42, 0x0BD4, 0x0B32, 0x0154, 0x007F, 0xFFFF, 0xFFFF, 0xFFFF, 0x0443, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0DF2, 0x0B43, 0xFFFF, 0x0B59, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x045B, 0xFFFF, 0x09A2, 0x079A,
+  0xFFFF, 0xFFFF, 0x010B, 0xFFFF, 0x0DD7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x08DE, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x09CC, 0x06A6, 0x0DFB, 0x0271, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0A24, 0x01BD, 0xFFFF, 0xFFFF, 0x0213, 0x0104, 0xFFFF, 0x0055, 0xFFFF, 0xFFFF, 0x0C8B, 0xFFFF,
+  0x06B8, 0xFFFF, 0x023B, 0x0475, 0x0692, 0x0D01, 0xFFFF, 0xFFFF, 0xFFFF, 0x08E9, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x02BD, 0x0D4E, 0xFFFF, 0x0D7E, 0x0DF6, 0x0D25, 0x0A53, 0xFFFF,
+  0x03B2, 0x0DF3, 0xFFFF, 0xFFFF, 0x0C4D, 0xFFFF, 0xFFFF, 0xFFFF, 0x056A, 0x04EF, 0xFFFF, 0xFFFF,
+  0x00D6, 0xFFFF, 0xFFFF, 0xFFFF, 0x01F6, 0x061E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0A11, 0x0848, 0x0DD4, 0x00FC, 0x0D1F, 0xFFFF, 0xFFFF, 0x0C06, 0xFFFF, 0x06A7,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0569, 0xFFFF, 0x05C0, 0x0873, 0x03BE, 0xFFFF, 0x0643, 0x0B1D, 0xFFFF,
+  0xFFFF, 0x0644, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x05F4, 0xFFFF, 0xFFFF, 0xFFFF, 0x009C,
+  0xFFFF, 0x0A13, 0xFFFF, 0xFFFF, 0xFFFF, 0x00E9, 0xFFFF, 0xFFFF, 0x0760, 0xFFFF, 0xFFFF, 0x0661,
+  0x08B8, 0x0D60, 0xFFFF, 0x0A68, 0xFFFF, 0xFFFF, 0x0D11, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x018F,
+  0x0D33, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x024F, 0xFFFF, 0x0AA1, 0xFFFF, 0x06AE, 0x01B7, 0x0C26,
+  0x019A, 0x0101, 0xFFFF, 0x0A15, 0xFFFF, 0x035B, 0xFFFF, 0xFFFF, 0x099A, 0x0089, 0xFFFF, 0x02AE,
+  0xFFFF, 0x031B, 0xFFFF, 0x0A5D, 0x0B99, 0xFFFF, 0x0607, 0xFFFF, 0xFFFF, 0x0CF5, 0xFFFF, 0xFFFF,
+  0x02CD, 0xFFFF, 0x094D, 0xFFFF, 0x0715, 0x00D9, 0x00D5, 0xFFFF, 0xFFFF, 0x078E, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x02F6, 0x0B34, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x06BE, 0xFFFF, 0x0721, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0DB1, 0xFFFF, 0xFFFF, 0xFFFF, 0x036A, 0x050E, 0x03F0, 0x0B16, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0C52, 0x070F, 0x0CAB, 0xFFFF, 0x0352, 0x0858, 0xFFFF, 0x0D05, 0xFFFF, 0xFFFF, 0x042B,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0726, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0BEB, 0x0979, 0x04D0, 0x00DA,
+  0x0AED, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x03FF, 0xFFFF, 0x0040, 0x03C3, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0172, 0x0D13, 0xFFFF, 0xFFFF, 0x004C, 0xFFFF, 0xFFFF, 0x00E4, 0xFFFF, 0x0846,
+  0x029D, 0x02DC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0973,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x04AC, 0xFFFF, 0x0220, 0xFFFF, 0x0ADC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0ABD, 0xFFFF, 0x01F2, 0xFFFF, 0xFFFF, 0xFFFF, 0x03CD, 0x0942, 0xFFFF, 0x0338, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0BFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0582, 0xFFFF, 0x01B6, 0xFFFF, 0x092F, 0xFFFF,
+  0xFFFF, 0x0087, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x064E, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x06CC, 0x04A1, 0xFFFF, 0x035A, 0x0C00, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x093A, 0xFFFF, 0xFFFF, 0x0C03, 0x0121, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x07CF,
+  0x0090, 0x0D9B, 0x0D5F, 0xFFFF, 0xFFFF, 0xFFFF, 0x09BA, 0x0CAF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x08F9, 0xFFFF, 0x013D, 0x0ABB, 0xFFFF, 0x01BB, 0x0C45, 0xFFFF, 0x0344, 0xFFFF, 0x0DCB, 0x06F8,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0DCF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x09D9, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0991, 0x0CEE, 0x090B, 0x0A00, 0x07D6, 0x0829, 0x07AF, 0x0420, 0xFFFF,
+  0xFFFF, 0x0CE4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0622, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0E28, 0xFFFF, 0xFFFF, 0x0738, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0852, 0xFFFF, 0x0CA1,
+  0x0B13, 0xFFFF, 0x03AB, 0x0CB7, 0xFFFF, 0xFFFF, 0xFFFF, 0x0C37, 0xFFFF, 0x036C, 0xFFFF, 0x0450,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0854, 0x0236, 0xFFFF, 0x0CC2, 0xFFFF, 0xFFFF, 0xFFFF, 0x096B, 0x0120,
+  0x0AE2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x06DE, 0x002C, 0xFFFF, 0xFFFF, 0x04A3, 0xFFFF, 0x0404,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x021B, 0xFFFF, 0x06DB, 0xFFFF, 0xFFFF, 0xFFFF, 0x03A6, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0614, 0x07F4, 0xFFFF, 0xFFFF, 0xFFFF, 0x0581, 0xFFFF, 0xFFFF, 0x093E, 0x0C53, 0x050D,
+  0x046A, 0x07F0, 0x0D6E, 0x00BE, 0xFFFF, 0x0298, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0A6E, 0x002F,
+  0x08C2, 0x0018, 0x0C87, 0xFFFF, 0x0398, 0xFFFF, 0x0CA2, 0x020D, 0x0B5E, 0x0AEF, 0xFFFF, 0xFFFF,
+  0x0907, 0xFFFF, 0x0276, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x07C9, 0x08BE, 0x0856, 0xFFFF, 0x0E29,
+  0x0A60, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0CDE, 0x0333, 0x05EC, 0x081E, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0D81, 0xFFFF, 0x036B, 0x00CD, 0x00F7, 0x0DB7, 0x0A0C, 0x0082, 0xFFFF, 0xFFFF, 0x0AE5, 0xFFFF,
+  0x0966, 0x0E32, 0x0E3B, 0xFFFF, 0x0C3F, 0xFFFF, 0x06C9, 0xFFFF, 0xFFFF, 0x02B5, 0x02BB, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0D55, 0xFFFF, 0xFFFF, 0x0A39, 0x0C68, 0xFFFF, 0x02D5, 0xFFFF, 0x00BB, 0xFFFF,
+  0x0808, 0x0546, 0xFFFF, 0x0A93, 0x07BD, 0x0BBD, 0x06D7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0437, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0548, 0xFFFF, 0xFFFF,
+  0x0A99, 0xFFFF, 0xFFFF, 0x0002, 0xFFFF, 0x09A9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x03F4, 0x0541,
+  0xFFFF, 0x06F4, 0xFFFF, 0x00FE, 0xFFFF, 0xFFFF, 0xFFFF, 0x09D5, 0xFFFF, 0x011B, 0x0799, 0x055D,
+  0x0CCF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0BCB, 0xFFFF, 0x02C9, 0x03E1, 0xFFFF,
+  0x0C9B, 0xFFFF, 0x07B1, 0x0267, 0xFFFF, 0x03F3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0592,
+  0xFFFF, 0xFFFF, 0x028F, 0xFFFF, 0x0926, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0B7A, 0xFFFF,
+  0xFFFF, 0x0D7C, 0x0717, 0x0BB0, 0xFFFF, 0x0D90, 0x0BAD, 0xFFFF, 0x0A78, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0996, 0x0DC2, 0x0696, 0x046F, 0x0410, 0x0003, 0x02AC, 0xFFFF, 0xFFFF, 0x098B, 0x051F,
+  0xFFFF, 0xFFFF, 0x0264, 0xFFFF, 0x0418, 0x0AFE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0336,
+  0x0330, 0xFFFF, 0xFFFF, 0x0AF2, 0xFFFF, 0x0B1B, 0xFFFF, 0x0151, 0xFFFF, 0xFFFF, 0x09C0, 0xFFFF,
+  0x0E3A, 0x0E17, 0x0DED, 0x03F5, 0x0067, 0xFFFF, 0xFFFF, 0xFFFF, 0x01B2, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0697, 0xFFFF, 0x0B89, 0x09B7, 0x0816, 0x01AF, 0x04FA, 0x0C02, 0xFFFF, 0xFFFF, 0xFFFF, 0x0863,
+  0xFFFF, 0xFFFF, 0x0D82, 0x03B8, 0xFFFF, 0x03A8, 0xFFFF, 0xFFFF, 0x040A, 0xFFFF, 0xFFFF, 0x0C09,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0505, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0A6F, 0x0C4E, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0C3A, 0xFFFF, 0xFFFF, 0x03E8, 0xFFFF, 0xFFFF, 0x0664, 0xFFFF, 0x08E2,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x006A, 0xFFFF, 0xFFFF,
+  0x06F3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0580, 0x05CE, 0x0008, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x00B9, 0x0392, 0x080D, 0xFFFF, 0xFFFF, 0x0411, 0xFFFF, 0x0E07, 0x072F,
+  0x0A31, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0078, 0xFFFF, 0xFFFF, 0x05FA, 0xFFFF, 0xFFFF, 0x0C9A, 0xFFFF, 0xFFFF, 0xFFFF, 0x07C4, 0xFFFF,
+  0x0178, 0xFFFF, 0xFFFF, 0xFFFF, 0x08CF, 0xFFFF, 0xFFFF, 0x0BB4, 0x0C7B, 0xFFFF, 0x0A32, 0xFFFF,
+  0xFFFF, 0x0632, 0xFFFF, 0x04D6, 0x0C81, 0x0E09, 0xFFFF, 0x0881, 0x0B91, 0x00CE, 0xFFFF, 0xFFFF,
+  0x096F, 0xFFFF, 0xFFFF, 0x00BD, 0xFFFF, 0x00C9, 0x0C6C, 0xFFFF, 0x0DA1, 0x0603, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0934, 0x021D, 0xFFFF, 0xFFFF, 0x0290, 0xFFFF, 0x0B48, 0xFFFF, 0xFFFF, 0x03B4, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x037A, 0xFFFF, 0x0A8C, 0x01DA, 0xFFFF, 0xFFFF, 0x0C7F, 0x027F, 0xFFFF, 0x0278,
+  0xFFFF, 0x0870, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0AFB, 0xFFFF, 0x04B6, 0xFFFF, 0x0C27, 0xFFFF,
+  0xFFFF, 0x0296, 0xFFFF, 0xFFFF, 0xFFFF, 0x06EE, 0x0183, 0xFFFF, 0xFFFF, 0xFFFF, 0x04B2, 0xFFFF,
+  0xFFFF, 0x0920, 0x0C59, 0xFFFF, 0xFFFF, 0x0B9B, 0xFFFF, 0x07CE, 0xFFFF, 0xFFFF, 0xFFFF, 0x0242,
+  0x042E, 0xFFFF, 0xFFFF, 0xFFFF, 0x023D, 0xFFFF, 0xFFFF, 0xFFFF, 0x04A8, 0x0A87, 0x00B3, 0xFFFF,
+  0x02B6, 0xFFFF, 0x097A, 0x091D, 0x0CD6, 0xFFFF, 0x05A4, 0x01E5, 0xFFFF, 0x0BEC, 0xFFFF, 0x0AB6,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x01BF, 0x00EF, 0x0DB3, 0x046B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0165, 0xFFFF, 0xFFFF, 0x0148, 0x0C8E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0B2B, 0x037C,
+  0xFFFF, 0xFFFF, 0x055C, 0xFFFF, 0x0472, 0xFFFF, 0x061C, 0xFFFF, 0x00F4, 0xFFFF, 0x000F, 0x0C04,
+  0x07B5, 0x067B, 0x04F4, 0x01EA, 0x0A8B, 0x02A3, 0x019B, 0x00A8, 0x0A8A, 0xFFFF, 0x05BA, 0xFFFF,
+  0xFFFF, 0x0D51, 0x0D43, 0xFFFF, 0x0421, 0xFFFF, 0xFFFF, 0x0BB9, 0x0DAE, 0x0936, 0x0909, 0x0262,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x083A, 0xFFFF, 0x0D15, 0xFFFF, 0xFFFF, 0xFFFF, 0x0737, 0x0686,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x06A4, 0x089A, 0xFFFF, 0xFFFF, 0x004B, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x051C, 0xFFFF, 0x088D, 0xFFFF, 0x08FC, 0xFFFF, 0x0C14, 0x06B6, 0xFFFF, 0xFFFF, 0x0985,
+  0x0971, 0x01DF, 0xFFFF, 0x0601, 0x035C, 0xFFFF, 0x0232, 0x07C8, 0x0826, 0x06D8, 0xFFFF, 0x0977,
+  0xFFFF, 0x0638, 0xFFFF, 0xFFFF, 0x0294, 0xFFFF, 0x0275, 0xFFFF, 0x0406, 0xFFFF, 0xFFFF, 0x0B10,
+  0x0C75, 0x02B8, 0x06D3, 0x00C4, 0xFFFF, 0xFFFF, 0x0ADB, 0x07AD, 0xFFFF, 0xFFFF, 0x01FB, 0x004D,
+  0x0B0C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x073A, 0xFFFF, 0xFFFF, 0xFFFF, 0x06E8, 0xFFFF, 0x09F3,
+  0x0DEA, 0xFFFF, 0xFFFF, 0xFFFF, 0x043E, 0x07EB, 0x0C54, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x008B, 0xFFFF, 0xFFFF, 0x0712, 0x02C6, 0xFFFF, 0x02DE, 0xFFFF, 0xFFFF, 0x04C4, 0x00A2, 0x0374,
+  0xFFFF, 0x02C5, 0xFFFF, 0x0DA9, 0xFFFF, 0xFFFF, 0x0AE0, 0x0D9A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0CA3, 0xFFFF, 0xFFFF, 0x0353, 0x042F, 0xFFFF, 0xFFFF, 0x001C, 0xFFFF, 0xFFFF, 0x0314, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0901, 0x0C07, 0x0009, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0735, 0x0230, 0x07F3,
+  0x08E7, 0x0CED, 0x0AAB, 0xFFFF, 0x072A, 0xFFFF, 0x062A, 0x066E, 0xFFFF, 0x085B, 0x0A40, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0381, 0xFFFF, 0x0161, 0x0ACB, 0xFFFF, 0x0630, 0xFFFF, 0xFFFF, 0xFFFF, 0x0CC5,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x09E1, 0x0D70, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x06A8, 0xFFFF, 0x0789,
+  0x021E, 0x0994, 0xFFFF, 0x02CC, 0xFFFF, 0x05FF, 0x0965, 0xFFFF, 0x0A7A, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x026D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x076A, 0xFFFF, 0xFFFF, 0x06DA, 0x08D9, 0x0E0E, 0x0D04, 0xFFFF, 0x0AD5,
+  0xFFFF, 0xFFFF, 0x0C28, 0x0524, 0xFFFF, 0x0781, 0x05F6, 0xFFFF, 0xFFFF, 0xFFFF, 0x0905, 0xFFFF,
+  0xFFFF, 0x072D, 0x0B1F, 0xFFFF, 0x075D, 0xFFFF, 0x04FB, 0x0CC4, 0xFFFF, 0xFFFF, 0x0691, 0x065F,
+  0x083B, 0x0C40, 0xFFFF, 0xFFFF, 0x07BF, 0xFFFF, 0xFFFF, 0x039D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0227, 0xFFFF, 0x0C6D, 0xFFFF, 0xFFFF, 0x0945, 0xFFFF, 0xFFFF, 0xFFFF, 0x064D, 0xFFFF, 0x09C1,
+  0xFFFF, 0xFFFF, 0x0AB7, 0xFFFF, 0xFFFF, 0x0AFC, 0x01A7, 0x0730, 0x0399, 0xFFFF, 0x0B22, 0xFFFF,
+  0xFFFF, 0x0149, 0x0D6B, 0xFFFF, 0x0488, 0xFFFF, 0x08CB, 0xFFFF, 0x01C5, 0x03CC, 0x0053, 0x00DE,
+  0xFFFF, 0x0AE6, 0xFFFF, 0xFFFF, 0xFFFF, 0x0531, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0B00, 0x0125,
+  0x0565, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x04E1, 0x087B, 0x0180, 0xFFFF, 0x040B, 0x0C46,
+  0x0375, 0xFFFF, 0xFFFF, 0x049A, 0x0219, 0x06DF, 0x076C, 0xFFFF, 0xFFFF, 0x0C72, 0x09A6, 0xFFFF,
+  0xFFFF, 0x0C35, 0xFFFF, 0x0012, 0x04BD, 0xFFFF, 0x0482, 0xFFFF, 0x0284, 0xFFFF, 0xFFFF, 0x0DEE,
+  0x08F1, 0xFFFF, 0x056B, 0x07C0, 0xFFFF, 0xFFFF, 0xFFFF, 0x0526, 0x089F, 0x0C5C, 0xFFFF, 0x0CF8,
+  0x05E3, 0xFFFF, 0x0648, 0xFFFF, 0xFFFF, 0xFFFF, 0x0B8E, 0xFFFF, 0x0BDC, 0xFFFF, 0xFFFF, 0x050A,
+  0x0C2E, 0xFFFF, 0x0A19, 0x00B4, 0x06F6, 0xFFFF, 0x0147, 0x0497, 0x0694, 0xFFFF, 0x0DAB, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0843, 0x0BF4, 0xFFFF, 0xFFFF, 0xFFFF, 0x02A8, 0x0A85, 0x0CD5, 0x0D44,
+  0x0CB9, 0xFFFF, 0xFFFF, 0xFFFF, 0x008D, 0xFFFF, 0x0247, 0x06C4, 0xFFFF, 0xFFFF, 0x05B6, 0x0D8A,
+  0xFFFF, 0x0A52, 0xFFFF, 0x0007, 0xFFFF, 0xFFFF, 0xFFFF, 0x0108, 0x0075, 0xFFFF, 0x0112, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x007A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0064, 0x022B, 0x0BBE, 0xFFFF, 0x00AE,
+  0x05A0, 0x0226, 0x0C23, 0xFFFF, 0xFFFF, 0xFFFF, 0x0828, 0x0C32, 0x00DF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x044D, 0xFFFF, 0x0798, 0x09C9, 0xFFFF, 0x03AF, 0xFFFF, 0xFFFF, 0x091B, 0xFFFF, 0x08D8, 0xFFFF,
+  0x003E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0819, 0x09FA, 0xFFFF, 0x01BE, 0x089D, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0D4D, 0x0141, 0x0447, 0x054E, 0x04E6,
+  0x09F9, 0x02A2, 0xFFFF, 0xFFFF, 0x0BD7, 0x00FD, 0x0BF8, 0xFFFF, 0x061F, 0x0CB1, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0492, 0xFFFF, 0xFFFF, 0x0560, 0xFFFF, 0x0C61, 0x0D0F, 0xFFFF, 0x0D3B, 0xFFFF,
+  0x0913, 0x0A0F, 0x0424, 0x086E, 0xFFFF, 0xFFFF, 0xFFFF, 0x05AD, 0x062E, 0x0203, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x039B, 0xFFFF, 0xFFFF, 0x0719, 0xFFFF, 0xFFFF, 0x021A, 0xFFFF, 0x054D, 0x0B19, 0xFFFF,
+  0x05DC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0D45, 0xFFFF, 0xFFFF, 0x0289, 0xFFFF, 0xFFFF, 0x08E1,
+  0x0794, 0x0093, 0x00AD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0D9E, 0xFFFF, 0xFFFF, 0xFFFF, 0x0955,
+  0xFFFF, 0xFFFF, 0x059B, 0x0DFE, 0xFFFF, 0xFFFF, 0x0C51, 0xFFFF, 0x0B95, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0065, 0xFFFF, 0x062C, 0xFFFF, 0x01D5, 0x01C2, 0xFFFF, 0x08B1, 0xFFFF, 0x0442, 0x054F,
+  0x051D, 0x07E5, 0x0972, 0xFFFF, 0xFFFF, 0xFFFF, 0x0E1E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x08CA, 0xFFFF, 0x0394, 0xFFFF, 0xFFFF, 0x0DE0, 0x0714, 0x0892, 0x0D1E, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0DB6, 0x04C5, 0x063B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0181, 0x0A3F, 0x079B, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0483, 0xFFFF,
+  0x00FB, 0xFFFF, 0xFFFF, 0x0AAF, 0x0A02, 0xFFFF, 0xFFFF, 0xFFFF, 0x0461, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0501, 0xFFFF, 0x082B, 0xFFFF, 0xFFFF, 0xFFFF, 0x08D7, 0x0417, 0xFFFF, 0xFFFF, 0x0062, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x03CA, 0x0D3D, 0x0AF3, 0x00B0, 0x057F, 0xFFFF, 0xFFFF, 0xFFFF, 0x014B,
+  0xFFFF, 0x051A, 0xFFFF, 0x01EF, 0x09E3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0039, 0xFFFF, 0xFFFF, 0x0C5F, 0xFFFF, 0x0195, 0xFFFF, 0xFFFF, 0x0CB5, 0xFFFF,
+  0xFFFF, 0x078D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x03DD, 0x0CE6, 0xFFFF, 0x025D, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0517, 0x0C13, 0x09C5, 0xFFFF, 0x0746, 0xFFFF, 0xFFFF, 0xFFFF, 0x0D1A, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x011A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0E11, 0xFFFF, 0x0BFC, 0xFFFF, 0xFFFF, 0x08A1,
+  0x016F, 0xFFFF, 0xFFFF, 0x05D3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0B3C,
+  0xFFFF, 0x0279, 0xFFFF, 0x0CB2, 0xFFFF, 0xFFFF, 0x0745, 0xFFFF, 0xFFFF, 0xFFFF, 0x0E39, 0x0889,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x01A9, 0x0740, 0x0B03, 0xFFFF, 0x0074, 0xFFFF,
+  0x04AB, 0xFFFF, 0x07E6, 0xFFFF, 0x05EB, 0x090C, 0x0627, 0x09BE, 0x0A5A, 0xFFFF, 0xFFFF, 0x0520,
+  0xFFFF, 0x0BA8, 0xFFFF, 0xFFFF, 0x0253, 0x0CF3, 0xFFFF, 0xFFFF, 0x03BB, 0x0B52, 0xFFFF, 0x02F2,
+  0xFFFF, 0x0518, 0xFFFF, 0x015A, 0xFFFF, 0xFFFF, 0x06E2, 0xFFFF, 0xFFFF, 0x0C91, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x099F, 0xFFFF, 0x07E4, 0xFFFF, 0x0707, 0x045D, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0788, 0x006C, 0x00A6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0899, 0x0E21, 0x0825, 0xFFFF,
+  0xFFFF, 0x0034, 0xFFFF, 0xFFFF, 0x0782, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0B98, 0x052A, 0xFFFF,
+  0x001E, 0x0D09, 0xFFFF, 0xFFFF, 0x041B, 0xFFFF, 0x0A10, 0x0177, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x07D9, 0x05A2, 0xFFFF, 0xFFFF, 0x0BAA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x09B3,
+  0xFFFF, 0x0B51, 0x015F, 0x029E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x088B, 0x00D3, 0x0677,
+  0xFFFF, 0x0969, 0xFFFF, 0xFFFF, 0x0911, 0x06B5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0CCD, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x07F9, 0x00D8, 0x0827, 0xFFFF, 0xFFFF, 0x06C2, 0x0AAC, 0x00D7, 0x05FB, 0xFFFF,
+  0xFFFF, 0x0155, 0x05C9, 0x06DC, 0x0A4B, 0x0D8E, 0xFFFF, 0x0166, 0xFFFF, 0x0D9F, 0x04EB, 0xFFFF,
+  0x0B7C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0318, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0BD1, 0xFFFF, 0x073B, 0xFFFF, 0xFFFF, 0x0221, 0xFFFF, 0xFFFF, 0x007C, 0x049D, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0785, 0x0893, 0xFFFF, 0x052B, 0x05B4, 0xFFFF, 0xFFFF, 0x0CDD, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x07B9, 0x0766, 0x0BC5, 0x0783, 0x00CB, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x0186, 0x08D6, 0xFFFF, 0xFFFF, 0x0709, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x05E4,
+  0xFFFF, 0x0D73, 0xFFFF, 0xFFFF, 0x0D47, 0x0BC6, 0x0658, 0xFFFF, 0xFFFF, 0xFFFF, 0x02EC, 0x0641,
+  0xFFFF, 0x06E4, 0xFFFF, 0x0A73, 0x0E0F, 0x00AB, 0x0751, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0B55,
+  0xFFFF, 0xFFFF, 0x06F2, 0x04B1, 0xFFFF, 0x0A2B, 0xFFFF, 0x087A, 0xFFFF, 0x0AC9, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0449, 0x0C25, 0x09B2, 0x01EE, 0x0CA4, 0x0C97, 0xFFFF, 0xFFFF, 0x0872, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x029C, 0xFFFF, 0xFFFF, 0x05BE, 0xFFFF, 0x0820, 0x0A56, 0x0270, 0x0D26, 0xFFFF,
+  0x0CFA, 0xFFFF, 0x04EA, 0x02FE, 0xFFFF, 0x0575, 0x009D, 0xFFFF, 0xFFFF, 0xFFFF, 0x0CEB, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x05C5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0B0B, 0x0811, 0x03E4, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x0188, 0x0C65, 0xFFFF, 0x066A, 0xFFFF, 0xFFFF, 0xFFFF, 0x0AC1, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x07BE, 0xFFFF, 0x0D54, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x08EB, 0xFFFF,
+  0xFFFF, 0x03BA, 0xFFFF, 0xFFFF, 0xFFFF, 0x06CE, 0x0A2E, 0x0A95, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0D92, 0x07AC, 0x01E2, 0x0CF4, 0xFFFF, 0x0866, 0xFFFF, 0x0596, 0xFFFF, 0xFFFF, 0xFFFF, 0x0E2D,
+  0x09B9, 0xFFFF, 0x04DA, 0xFFFF, 0x0E1B, 0x0240, 0x02FD, 0x0BC1, 0xFFFF, 0x08A7, 0x0465, 0xFFFF,
+  0x0A34, 0xFFFF, 0x030D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x099E, 0x0C86, 0xFFFF, 0x01AB,
+  0xFFFF, 0xFFFF, 0x0288, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0D27, 0x098D,
+  0x0340, 0xFFFF, 0xFFFF, 0x0CB6, 0xFFFF, 0x0D67, 0xFFFF, 0x0A37, 0xFFFF, 0xFFFF, 0x03E2, 0xFFFF,
+  0x0824, 0xFFFF, 0x056F, 0xFFFF, 0xFFFF, 0xFFFF, 0x0A9A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0AB4,
+  0x056E, 0x09C4, 0xFFFF, 0xFFFF, 0xFFFF, 0x041C, 0x04A2, 0xFFFF, 0x0066, 0x01D6, 0x094F, 0xFFFF,
+  0x0459, 0x056D, 0x08F3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0107, 0x07D3, 0x0532, 0xFFFF, 0x0C64,
+  0xFFFF, 0xFFFF, 0x0AB5, 0xFFFF, 0x0A2A, 0x0803, 0x044A, 0xFFFF, 0xFFFF, 0xFFFF, 0x0DB4, 0xFFFF,
+  0xFFFF, 0x0A88, 0xFFFF, 0x0CCE, 0xFFFF, 0x04B4, 0xFFFF, 0xFFFF, 0xFFFF, 0x0958, 0xFFFF, 0x06F7,
+  0x0D75, 0x01CF, 0x0D49, 0xFFFF, 0x0102, 0x0882, 0x064F, 0x020E, 0x0CEC, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x09E9, 0x0B2C, 0x0402, 0xFFFF, 0xFFFF, 0x03B1, 0xFFFF, 0xFFFF, 0xFFFF, 0x0A91, 0xFFFF, 0x07A3,
+  0x00B2, 0xFFFF, 0x05AE, 0x0D83, 0xFFFF, 0x03A7, 0x009E, 0xFFFF, 0x03AC, 0x0506, 0xFFFF, 0x0611,
+  0xFFFF, 0xFFFF, 0x0DDB, 0x0984, 0xFFFF, 0x0416, 0xFFFF, 0xFFFF, 0xFFFF, 0x0A27, 0xFFFF, 0x0DA5,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0DC6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x029B, 0x0084, 0x03D3, 0x037D,
+  0xFFFF, 0xFFFF, 0x0A4F, 0xFFFF, 0x04C7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0327, 0x0CF9, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0CD4, 0x01E3, 0xFFFF, 0xFFFF, 0x097D, 0xFFFF, 0x0963, 0x06B2, 0x07A9,
+  0xFFFF, 0x0768, 0xFFFF, 0xFFFF, 0x0BB1, 0xFFFF, 0x0CA8, 0xFFFF, 0xFFFF, 0x011F, 0x0419, 0xFFFF,
+  0xFFFF, 0x08E5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x059E, 0xFFFF, 0xFFFF, 0x0D62, 0xFFFF, 0x096A,
+  0x016C, 0xFFFF, 0xFFFF, 0x0297, 0x08EA, 0xFFFF, 0xFFFF, 0x0C24, 0xFFFF, 0xFFFF, 0x0A33, 0xFFFF,
+  0x0868, 0x084C, 0xFFFF, 0xFFFF, 0xFFFF, 0x0865, 0xFFFF, 0x0B53, 0xFFFF, 0x0D19, 0xFFFF, 0x0D5E,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x079F, 0x04EC, 0x03D4, 0x071B, 0x01B5, 0x0862, 0x0572, 0xFFFF,
+  0x0983, 0x060D, 0x053C, 0xFFFF, 0xFFFF, 0xFFFF, 0x05EE, 0x0A6D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x0887, 0x0903, 0x04CA, 0x07D7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0D30, 0x0A28, 0x019C, 0xFFFF, 0xFFFF, 0x0077, 0xFFFF, 0x0299, 0x058D, 0xFFFF, 0x0800, 0x01A8,
+  0x02F3, 0xFFFF, 0x0C7E, 0x0C47, 0x0E06, 0xFFFF, 0xFFFF, 0xFFFF, 0x09A4, 0x0B7B, 0x087E, 0x016B,
+  0x0C62, 0xFFFF, 0xFFFF, 0x07F2, 0xFFFF, 0x0D32, 0xFFFF, 0x0AA3, 0x0982, 0xFFFF, 0xFFFF, 0x047A,
+  0x0098, 0x0156, 0xFFFF, 0xFFFF, 0x0B93, 0x013C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0A46, 0x0E1F, 0xFFFF, 0xFFFF, 0x02E8, 0xFFFF, 0x08EC, 0xFFFF, 0x0AE8, 0x05AC, 0xFFFF, 0x0AD4,
+  0x06B4, 0x05D6, 0xFFFF, 0x0499, 0xFFFF, 0xFFFF, 0xFFFF, 0x07D2, 0x0AD0, 0x0A06, 0x05DD, 0x06BF,
+  0x0B9F, 0xFFFF, 0xFFFF, 0x0A36, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x06AF, 0xFFFF, 0x0588,
+  0x034A, 0x082E, 0x0BCC, 0xFFFF, 0x018C, 0x031F, 0xFFFF, 0xFFFF, 0xFFFF, 0x0E00, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x07FF, 0x065C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x086A, 0x0191, 0x05D5, 0x0187, 0x0351,
+  0xFFFF, 0x02A1, 0x0027, 0x0778, 0x0964, 0x0917, 0xFFFF, 0xFFFF, 0xFFFF, 0x08AA, 0x0602, 0x0CC1,
+  0x0A38, 0xFFFF, 0x00B7, 0x08D5, 0xFFFF, 0xFFFF, 0xFFFF, 0x0B15, 0x0478, 0xFFFF, 0xFFFF, 0x0A1E,
+  0xFFFF, 0x027B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0006, 0xFFFF, 0x0362,
+  0x0C79, 0xFFFF, 0x084E, 0x0BA3, 0x0A57, 0xFFFF, 0xFFFF, 0x03F1,
+};
+
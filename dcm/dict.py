@@ -1,8 +1,71 @@
 # Generate dict.inl from dict.txt.
+#
+# Each line of dict.txt is an entry of the data dictionary:
+#   tag; VR; VM; keyword; name
+#
+# The entries, sorted by tag, are looked up by perfect hashes (hash and
+# displace) generated here, one for the tags and one for the keywords, so that
+# a lookup needs two table reads and one comparison. See Lookup() in
+# data_dict.cpp for the lookup side, which must use the same hash functions.
 
-def dump_dict_cpp(fi, fo):
-    fo.write('// NOTE: This file was automatically generated.\n\n')
-    fo.write('static const Entry g_dict[] = {\n')
+# Number of bits of the first level (bucket) hash.
+BUCKET_BITS = 10
+
+# Number of bits of the second level (slot) hash.
+SLOT_BITS = 13
+
+GOLDEN = 0x9E3779B9
+
+NO_ENTRY = 0xFFFF
+
+MASK32 = 0xFFFFFFFF
+
+
+def mix(x):
+    '''The finalizer of MurmurHash3, see Mix() in data_dict.cpp.'''
+    x ^= x >> 16
+    x = (x * 0x85EBCA6B) & MASK32
+    x ^= x >> 13
+    x = (x * 0xC2B2AE35) & MASK32
+    x ^= x >> 16
+    return x
+
+
+def fnv1a(s):
+    '''32-bit FNV-1a hash of a string, see Fnv1a() in data_dict.cpp.'''
+    h = 0x811C9DC5
+    for c in s.encode('ascii'):
+        h ^= c
+        h = (h * 0x01000193) & MASK32
+    return h
+
+
+def bucket_of(key):
+    return mix(key) >> (32 - BUCKET_BITS)
+
+
+def slot_of(key, displacement):
+    return mix(key ^ ((displacement * GOLDEN) & MASK32)) >> (32 - SLOT_BITS)
+
+
+def parse_vm(vm):
+    '''Parse VM string to (min, max, times), see VM::Parse().'''
+    if '-' not in vm:
+        return (vm, vm, '1')
+
+    min_str, max_str = vm.split('-')
+    if not max_str.endswith('n'):
+        return (min_str, max_str, '1')
+
+    if len(max_str) == 2:
+        # "2-2n", "3-3n"
+        return ('1', 'VM::N', max_str[0])
+
+    return (min_str, 'VM::N', '1')
+
+
+def read_entries(fi):
+    entries = []
 
     for line in fi:
         line = line.strip(' \t\n')
@@ -10,17 +73,94 @@ def dump_dict_cpp(fi, fo):
             continue
 
         parts = line.split('; ')
-        
-        if len(parts) != 4:
-            print('Invalid line:', line)
+
+        if len(parts) != 5:
+            raise ValueError('Invalid line: ' + line)
+
+        entries.append(parts)
+
+    entries.sort(key=lambda parts: int(parts[0], 16))
+    return entries
+
+
+def build_hash(keys):
+    '''Return (displacements, slots) of the perfect hash of 32-bit keys.'''
+    if len(set(keys)) != len(keys):
+        raise ValueError('Duplicated keys')
+
+    buckets = [[] for _ in range(1 << BUCKET_BITS)]
+    for index, key in enumerate(keys):
+        buckets[bucket_of(key)].append(index)
+
+    displacements = [0] * (1 << BUCKET_BITS)
+    slots = [NO_ENTRY] * (1 << SLOT_BITS)
+
+    # Place the largest buckets first while the table is still sparse.
+    order = sorted(range(len(buckets)), key=lambda b: -len(buckets[b]))
+
+    for b in order:
+        if not buckets[b]:
             break
 
+        for displacement in range(1, 0x10000):
+            positions = [slot_of(keys[i], displacement) for i in buckets[b]]
+
+            if (len(set(positions)) == len(positions) and
+                    all(slots[p] == NO_ENTRY for p in positions)):
+                for i, p in zip(buckets[b], positions):
+                    slots[p] = i
+                displacements[b] = displacement
+                break
+        else:
+            raise ValueError('No displacement found for bucket %d' % b)
+
+    return displacements, slots
+
+
+def dump_array(fo, type_name, name, values, per_line=12):
+    fo.write('static const {0} {1}[] = {{\n'.format(type_name, name))
+    for i in range(0, len(values), per_line):
+        line = ', '.join('0x{0:04X}'.format(v) for v in values[i:i + per_line])
+        fo.write('  {0},\n'.format(line))
+    fo.write('};\n\n')
+
+
+def dump_dict_cpp(fi, fo):
+    entries = read_entries(fi)
+
+    fo.write('// NOTE: This file was automatically generated by dict.py.\n\n')
+
+    fo.write('static const Entry g_dict[] = {\n')
+
+    for parts in entries:
+        vm = parse_vm(parts[2])
         fo.write('  { ')
-        fo.write('{0}, VR::{1}, "{2}"'.format(parts[0], parts[1], parts[2]))
+        fo.write('{0}, VR::{1}, VM({2}, {3}, {4}), "{5}"'.format(
+            parts[0], parts[1], vm[0], vm[1], vm[2], parts[3]))
         fo.write(' },\n')
 
     fo.write('};\n\n')
 
+    tags = [int(parts[0], 16) for parts in entries]
+    displacements, slots = build_hash(tags)
+
+    fo.write('static const int kBucketBits = {0};\n'.format(BUCKET_BITS))
+    fo.write('static const int kSlotBits = {0};\n\n'.format(SLOT_BITS))
+
+    fo.write('// The displacement of the second level hash for each bucket.\n')
+    dump_array(fo, 'std::uint16_t', 'g_dict_displacements', displacements)
+
+    fo.write('// The index of the entry in g_dict for each slot, or kNoEntry.\n')
+    dump_array(fo, 'std::uint16_t', 'g_dict_slots', slots)
+
+    # The keywords are hashed by FNV-1a first, then the same as the tags.
+    keywords = [fnv1a(parts[3]) for parts in entries]
+    displacements, slots = build_hash(keywords)
+
+    fo.write('// The perfect hash of the keywords, see GetTag().\n')
+    dump_array(fo, 'std::uint16_t', 'g_keyword_displacements', displacements)
+    dump_array(fo, 'std::uint16_t', 'g_keyword_slots', slots)
+
 
 with open("dict.txt", 'r') as fi, open('dict.inl', 'w') as fo:
     dump_dict_cpp(fi, fo)
@@ -2,6 +2,7 @@
 
 #include <cassert>
 
+#include "dcm/arena.h"
 #include "dcm/data_sequence.h"
 #include "dcm/data_set.h"
 #include "dcm/logger.h"
@@ -9,7 +10,7 @@
 namespace dcm {
 
 FullReadHandler::FullReadHandler(DataSet* data_set)
-    : data_set_(data_set) {
+    : data_set_(data_set), unordered_(1) {
 }
 
 void FullReadHandler::OnTransferSyntax(VR::Type vr_type, ByteOrder byte_order) {
@@ -30,56 +31,118 @@ void FullReadHandler::OnSequenceStart(DataSequence* data_sequence) {
   LOG_INFO("OnSequenceStart");
 
   // Add the data sequence, as a normal element, to its parent data set.
-  AppendElement(data_sequence);
-
-  sequence_stack_.push(data_sequence);
+  // The levels below a dropped sequence are still tracked, for its elements to
+  // be dropped too.
+  if (AppendElement(data_sequence)) {
+    sequence_stack_.push({ data_sequence, false });
+  } else {
+    sequence_stack_.push({ nullptr, false });
+  }
 }
 
-void FullReadHandler::OnSequenceEnd(DataElement* data_element) {
-  if (data_element != nullptr) {
-    LOG_INFO("Sequence delimitation tag read.");
-
-    assert(data_element->tag() == tags::kSeqDelimatation);
-    assert(!sequence_stack_.empty());
+void FullReadHandler::OnSequenceEnd(bool delimited) {
+  LOG_INFO("Sequence ended.");
 
-    sequence_stack_.top()->set_delimitation(data_element);
-
-  } else {
-    LOG_INFO("Sequence ended.");
+  assert(!sequence_stack_.empty());
 
-    sequence_stack_.pop();
+  if (sequence_stack_.top().sequence != nullptr) {
+    sequence_stack_.top().sequence->set_delimited(delimited);
   }
+  sequence_stack_.pop();
 }
 
-void FullReadHandler::OnSequenceItemStart(DataElement* data_element) {
-  assert(data_element->tag() == tags::kSeqItemPrefix);
+void FullReadHandler::OnSequenceItemStart(std::uint32_t length) {
   assert(!sequence_stack_.empty());
 
   LOG_INFO("OnSequenceItemStart");
 
-  sequence_stack_.top()->NewItem(data_element, data_set_->vr_type(),
-                                 data_set_->byte_order());
+  Level& level = sequence_stack_.top();
+  if (level.sequence == nullptr) {
+    return;
+  }
+
+  level.sequence->NewItem(length, data_set_->vr_type(),
+                          data_set_->byte_order(), data_set_->arena());
+  level.in_item = true;
+
+  unordered_.emplace_back();
 }
 
-void FullReadHandler::OnSequenceItemEnd(DataElement* data_element) {
-  if (data_element != nullptr) {
-    LOG_INFO("Sequence item delimitation tag read.");
+void FullReadHandler::OnSequenceItemEnd(bool delimited) {
+  LOG_INFO("Sequence item ended.");
 
-    assert(data_element->tag() == tags::kSeqItemDelimatation);
-    assert(!sequence_stack_.empty());
+  assert(!sequence_stack_.empty());
 
-    sequence_stack_.top()->EndItem(data_element);
+  Level& level = sequence_stack_.top();
+  if (!level.in_item) {
+    return;
+  }
+  level.in_item = false;
 
-  } else {
-    LOG_INFO("Sequence item ended.");
+  DataSequence* data_sequence = level.sequence;
+
+  if (delimited) {
+    data_sequence->EndItem();
   }
+
+  InsertUnordered(data_sequence->At(data_sequence->size() - 1).data_set);
 }
 
-void FullReadHandler::AppendElement(DataElement* data_element) {
+void FullReadHandler::OnEnd() {
+  // The levels have all ended, only the root data set is left.
+  assert(unordered_.size() == 1);
+
+  InsertUnordered(data_set_);
+}
+
+bool FullReadHandler::AppendElement(DataElement* data_element) {
+  bool ok = false;
   if (sequence_stack_.empty()) {
-    data_set_->Append(data_element);
+    // The lengths are read, not to be adjusted.
+    ok = data_set_->Append(data_element, false);
   } else {
-    sequence_stack_.top()->AppendToLastItem(data_element);
+    if (!sequence_stack_.top().in_item) {
+      LOG_WARN("Data element (%04x,%04x) is not in a sequence item, dropped.",
+               data_element->tag().group(), data_element->tag().element());
+      DeleteElement(data_element);
+      return false;
+    }
+
+    ok = sequence_stack_.top().sequence->AppendToLastItem(data_element, false);
+  }
+
+  if (!ok) {
+    // Out of order, or duplicated.
+    unordered_.back().push_back(data_element);
+  }
+
+  return true;
+}
+
+void FullReadHandler::DeleteElement(DataElement* data_element) {
+  // Allocated by the reader from the arena shared with the data set, if any.
+  Arena* arena = data_element->from_arena() ? data_set_->arena().get()
+                                            : nullptr;
+  ArenaDelete(arena, data_element);
+}
+
+void FullReadHandler::InsertUnordered(DataSet* data_set) {
+  std::vector<DataElement*>& elements = unordered_.back();
+
+  if (!elements.empty()) {
+    LOG_WARN("%u data elements out of order.",
+             static_cast<unsigned>(elements.size()));
+
+    std::size_t duplicates = data_set->InsertBatch(
+        &elements, DataSet::DuplicatePolicy::KEEP_FIRST, false);
+    if (duplicates > 0) {
+      LOG_WARN("%u duplicated data elements dropped.",
+               static_cast<unsigned>(duplicates));
+    }
+  }
+
+  if (unordered_.size() > 1) {
+    unordered_.pop_back();
   }
 }
 
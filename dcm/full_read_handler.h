@@ -2,12 +2,17 @@
 #define DCM_FULL_READER_HANDLER_H_
 
 #include <stack>
+#include <vector>
 
 #include "dcm/read_handler.h"
 
 namespace dcm {
 
 // A read handler to insert all data elements into a given data set.
+//
+// The elements out of order (e.g., in a file written by a buggy application)
+// are inserted with a single sort once their data set ends, and only the first
+// of the elements with the same tag is kept.
 class FullReadHandler : public ReadHandler {
 public:
   //\param data_set The destination data set.
@@ -21,18 +26,41 @@ public:
   void OnElementEnd(DataElement* data_element) override;
 
   void OnSequenceStart(DataSequence* data_sequence) override;
-  void OnSequenceEnd(DataElement* data_element = nullptr) override;
+  void OnSequenceEnd(bool delimited) override;
 
-  void OnSequenceItemStart(DataElement* data_element) override;
-  void OnSequenceItemEnd(DataElement* data_element = nullptr) override;
+  void OnSequenceItemStart(std::uint32_t length) override;
+  void OnSequenceItemEnd(bool delimited) override;
+
+  void OnEnd() override;
 
 private:
+  // A sequence being read.
+  struct Level {
+    // Null if the sequence itself is dropped, see AppendElement().
+    DataSequence* sequence;
+
+    // The last item of the sequence is started but not ended yet.
+    bool in_item;
+  };
+
   // Append data element to its parent data set.
-  void AppendElement(DataElement* data_element);
+  // An element in a sequence but not in any item (i.e., a broken file) has no
+  // data set to go, it's deleted and false is returned.
+  bool AppendElement(DataElement* data_element);
+
+  // Delete an element which is not added.
+  void DeleteElement(DataElement* data_element);
+
+  // Insert the elements out of order of the current data set into it.
+  void InsertUnordered(DataSet* data_set);
 
 private:
   DataSet* data_set_;  // Root data set
-  std::stack<DataSequence*> sequence_stack_;
+  std::stack<Level> sequence_stack_;
+
+  // The elements out of order of the data sets being read, the root data set
+  // at the bottom, then the current item of each sequence.
+  std::vector<std::vector<DataElement*>> unordered_;
 };
 
 }  // namespace dcm
@@ -0,0 +1,142 @@
+#include "dcm/header_parser.h"
+
+#include "dcm/data_dict.h"
+#include "dcm/data_element.h"
+#include "dcm/logger.h"
+#include "dcm/transfer_syntax.h"
+
+namespace dcm {
+
+namespace {
+
+// Private creator, (gggg,0010-00FF) of an odd group.
+inline bool IsPrivateCreator(Tag tag) {
+  return tag.group() % 2 == 1 && tag.element() >= 0x0010 &&
+         tag.element() <= 0x00FF;
+}
+
+}  // namespace
+
+// -----------------------------------------------------------------------------
+
+const std::size_t HeaderParser::kMinHeaderSize;
+const std::size_t HeaderParser::kMaxHeaderSize;
+
+HeaderParser::HeaderParser()
+    : transfer_syntax_checked_(false),
+      vr_type_(VR::EXPLICIT),
+      byte_order_(ByteOrder::LE) {
+}
+
+void HeaderParser::Reset() {
+  // Group 0002 is always Explicit VR Little Endian.
+  vr_type_ = VR::EXPLICIT;
+  byte_order_ = ByteOrder::LE;
+
+  transfer_syntax_uid_.clear();
+  transfer_syntax_checked_ = false;
+
+  frames_.clear();
+  PushFrame(Frame::ROOT, Tag(), kUndefinedLength);
+}
+
+void HeaderParser::CheckTransferSyntax(Reader& reader) {
+  transfer_syntax_checked_ = true;
+
+  if (!transfer_syntax_uid_.empty()) {
+    // Group 0002 and tag 0x00020010 exist.
+
+    LOG_INFO("Check transfer syntax by 0x00020010 (%s).",
+             transfer_syntax_uid_.c_str());
+
+    dcm::CheckTransferSyntax(transfer_syntax_uid_, &vr_type_, &byte_order_);
+
+    return;
+  }
+
+  LOG_INFO("Check transfer syntax by reading some bytes then figure out with "
+           "the help of VR and data dictionaries.");
+
+  CheckVrType(reader, &vr_type_);
+  CheckByteOrder(reader, &byte_order_);
+}
+
+bool HeaderParser::IsValueNeeded(Tag tag) const {
+  if (tag == tags::kTransferSyntaxUID) {
+    return transfer_syntax_uid_.empty();
+  }
+
+  // Only Implicit VR needs the private creators to resolve the VRs.
+  return vr_type_ == VR::IMPLICIT && IsPrivateCreator(tag);
+}
+
+void HeaderParser::KeepValue(const DataElement& element) {
+  if (element.tag() == tags::kTransferSyntaxUID) {
+    if (transfer_syntax_uid_.empty()) {
+      element.GetString(&transfer_syntax_uid_);
+    }
+  } else if (vr_type_ == VR::IMPLICIT && IsPrivateCreator(element.tag())) {
+    element.GetString(&frames_.back().creators[element.tag().ToUint32()]);
+  }
+}
+
+void HeaderParser::PushFrame(Frame::Kind kind, Tag tag, std::uint32_t length) {
+  frames_.emplace_back(kind, tag, length);
+}
+
+HeaderParser::Frame HeaderParser::PopFrame() {
+  assert(!frames_.empty());
+
+  Frame frame = std::move(frames_.back());
+  frames_.pop_back();
+
+  if (!frames_.empty()) {
+    frames_.back().read_length += frame.read_length;
+  }
+
+  return frame;
+}
+
+VR HeaderParser::GetImplicitVR(Tag tag) const {
+  if (tag.element() == 0) {
+    // Group Length (VR type is always UL).
+    return VR::UL;
+  }
+
+  if (tag.group() % 2 == 0) {
+    // Query VR type from data dictionary.
+    VR vr = dict::GetVR(tag);
+    if (vr.IsUnknown()) {
+      LOG_WARN("Unknown tag in Implicit VR.");
+    }
+    return vr;
+  }
+
+  // Private tag with Implicit VR.
+  // As I know, images generated by Carestream Dental CR CS7600 are really
+  // Implicit VR. They do have private tags.
+  if (IsPrivateCreator(tag)) {
+    return VR::LO;
+  }
+
+  // The element (gggg,xxee) belongs to the block reserved by (gggg,00xx).
+  const std::uint16_t block = tag.element() >> 8;
+
+  if (block >= 0x10) {
+    const auto& creators = frames_.back().creators;
+
+    auto it = creators.find(Tag(tag.group(), block).ToUint32());
+    if (it != creators.end()) {
+      const dict::PrivateEntry* entry =
+          dict::GetPrivateEntry(it->second, tag.element() & 0xFF);
+      if (entry != nullptr) {
+        return entry->vr;
+      }
+    }
+  }
+
+  LOG_WARN("Private tag in Implicit VR.");
+  return VR::UN;
+}
+
+}  // namespace dcm
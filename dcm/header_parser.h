@@ -0,0 +1,319 @@
+#ifndef DCM_HEADER_PARSER_H_
+#define DCM_HEADER_PARSER_H_
+
+#include <cstring>  // for memcpy
+#include <map>
+#include <string>
+#include <vector>
+
+#include "boost/predef/other/endian.h"
+
+#include "dcm/defs.h"
+#include "dcm/reader.h"
+#include "dcm/util.h"
+
+namespace dcm {
+
+class DataElement;
+
+// Same as kByteOrderOS but known at compile time, so that the byte swapping
+// could be dropped from the specialized parsing.
+#if BOOST_ENDIAN_BIG_BYTE
+const ByteOrder kNativeByteOrder = ByteOrder::BE;
+#else
+const ByteOrder kNativeByteOrder = ByteOrder::LE;
+#endif
+
+// The parsing shared by DicomReader, IncrementalReader and DicomCursor: the
+// headers (tag, VR and value length) of the data elements, sequence items and
+// delimitations, the transfer syntax, and the levels of the data set tree.
+// The readers only differ in how the bytes come, pulled from a Reader or
+// pushed in chunks.
+class HeaderParser {
+public:
+  // A header is the tag followed by the VR and a 2-byte value length (Explicit
+  // VR), or a 4-byte value length (Implicit VR, items and delimitations), or
+  // the VR, 2 reserved bytes and a 4-byte value length.
+  static const std::size_t kMinHeaderSize = 8;
+  static const std::size_t kMaxHeaderSize = 12;
+
+  enum Status {
+    OK,
+    MORE,                   // More bytes are needed, see Header::size.
+    CHECK_TRANSFER_SYNTAX,  // The first tag out of group 0002.
+    INVALID_VR,
+    END,                    // No more bytes to read.
+  };
+
+  struct Header {
+    Tag tag;
+
+    // UN for sequence items and delimitations.
+    VR vr;
+
+    // Value length, might be kUndefinedLength for sequences and items.
+    std::uint32_t length = 0;
+
+    // The number of bytes of the header.
+    std::size_t size = 0;
+
+    // End of sequence itself, or end of sequence item.
+    bool IsDelimitation() const {
+      return tag == tags::kSeqDelimatation || tag == tags::kSeqItemDelimatation;
+    }
+
+    bool IsItem() const { return tag == tags::kSeqItemPrefix; }
+  };
+
+  // A level of the data set tree: the root data set, a sequence or an item.
+  struct Frame {
+    enum Kind { ROOT, SEQUENCE, ITEM };
+
+    Frame(Kind kind, Tag tag, std::uint32_t length)
+        : kind(kind), tag(tag), length(length), read_length(0) {
+    }
+
+    Kind kind;
+
+    // The tag of the sequence or item prefix.
+    Tag tag;
+
+    // Value length, might be kUndefinedLength, then the level is ended with a
+    // delimitation (or the end of data for the root data set).
+    std::uint32_t length;
+
+    // The length read for this level.
+    std::uint32_t read_length;
+
+    // The values of the private creators (gggg,00xx) read for the data set of
+    // this level (root or item), keyed by their tags. See KeepValue().
+    std::map<std::uint32_t, std::string> creators;
+  };
+
+  HeaderParser();
+
+  // Start over for a new data set (after the preamble), with the root level.
+  void Reset();
+
+  // The transfer syntax is known once CheckTransferSyntax() is called.
+  VR::Type vr_type() const { return vr_type_; }
+  ByteOrder byte_order() const { return byte_order_; }
+
+  // ---------------------------------------------------------------------------
+
+  // Parse a header from |size| bytes of |data|.
+  // MORE is returned, with the size of the header set, if |size| is not enough.
+  // CHECK_TRANSFER_SYNTAX is returned, with the tag parsed only, if the
+  // transfer syntax has to be checked (then parse again), see
+  // CheckTransferSyntax().
+  template <VR::Type kVrType, ByteOrder kByteOrder>
+  Status ParseHeader(const char* data, std::size_t size, Header* header) const;
+
+  // Parse with the current transfer syntax.
+  Status ParseHeader(const char* data, std::size_t size, Header* header) const;
+
+  // Read a header from |reader|.
+  // The transfer syntax is checked if needed (CHECK_TRANSFER_SYNTAX) and the
+  // reader is moved back, then read again.
+  template <VR::Type kVrType, ByteOrder kByteOrder>
+  Status ReadHeader(Reader& reader, Header* header);
+
+  // Read with the current transfer syntax.
+  Status ReadHeader(Reader& reader, Header* header);
+
+  // Check transfer syntax by Transfer Syntax UID read from 0x00020010.
+  // A "smart" algorithm will be used instead if 0x00020010 is absent, by
+  // reading some bytes (from the first tag out of group 0002) of |reader|.
+  void CheckTransferSyntax(Reader& reader);
+
+  // Check if the value of the element is needed by the parser itself even if
+  // the handler skips it, i.e., the transfer syntax UID or a private creator.
+  bool IsValueNeeded(Tag tag) const;
+
+  // Keep the value of the element if it's needed, see IsValueNeeded().
+  void KeepValue(const DataElement& element);
+
+  // ---------------------------------------------------------------------------
+
+  // The levels being read, the root data set at the bottom.
+  std::vector<Frame>& frames() { return frames_; }
+
+  void PushFrame(Frame::Kind kind, Tag tag, std::uint32_t length);
+
+  // End the current level and add its read length to the parent level.
+  Frame PopFrame();
+
+private:
+  template <ByteOrder kByteOrder>
+  static std::uint16_t ToUint16(const char* bytes);
+
+  template <ByteOrder kByteOrder>
+  static std::uint32_t ToUint32(const char* bytes);
+
+  // Query the VR of a tag in Implicit VR from the data dictionary, or the
+  // private dictionaries by the creators of the current level.
+  VR GetImplicitVR(Tag tag) const;
+
+private:
+  // Transfer Syntax UID read from 0x00020010.
+  // Please note that some DICOM files don't have group 0002.
+  // But even if it's absent, a "smart" algorithm will be used to figure out the
+  // transfer syntax of the data set.
+  std::string transfer_syntax_uid_;
+
+  // If the transfer syntax has been checked or not.
+  bool transfer_syntax_checked_;
+
+  // Explicit or implicit VR.
+  VR::Type vr_type_;
+
+  // Little endian or big endian.
+  ByteOrder byte_order_;
+
+  std::vector<Frame> frames_;
+};
+
+// -----------------------------------------------------------------------------
+
+template <ByteOrder kByteOrder>
+std::uint16_t HeaderParser::ToUint16(const char* bytes) {
+  std::uint16_t value = 0;
+  std::memcpy(&value, bytes, 2);
+  if (kByteOrder != kNativeByteOrder) {
+    util::Swap16(&value);
+  }
+  return value;
+}
+
+template <ByteOrder kByteOrder>
+std::uint32_t HeaderParser::ToUint32(const char* bytes) {
+  std::uint32_t value = 0;
+  std::memcpy(&value, bytes, 4);
+  if (kByteOrder != kNativeByteOrder) {
+    util::Swap32(&value);
+  }
+  return value;
+}
+
+template <VR::Type kVrType, ByteOrder kByteOrder>
+HeaderParser::Status HeaderParser::ParseHeader(const char* data,
+                                               std::size_t size,
+                                               Header* header) const {
+  header->size = kMinHeaderSize;
+  if (size < kMinHeaderSize) {
+    return MORE;
+  }
+
+  header->tag.set_group(ToUint16<kByteOrder>(data));
+  header->tag.set_element(ToUint16<kByteOrder>(data + 2));
+
+  if (!transfer_syntax_checked_ && header->tag.group() != 0x0002) {
+    // The byte order might be wrong.
+    return CHECK_TRANSFER_SYNTAX;
+  }
+
+  if (header->IsDelimitation() || header->IsItem()) {
+    // The value length is 0 for a delimitation, and might be undefined for an
+    // item, then it is ended with a delimitation.
+    header->vr = VR::UN;
+    header->length = ToUint32<kByteOrder>(data + 4);
+    return OK;
+  }
+
+  if (kVrType == VR::EXPLICIT) {
+    if (!header->vr.SetBytes(data + 4)) {
+      return INVALID_VR;
+    }
+
+    // For VRs of OB, OD, OF, OL, OW, SQ, UN and UC, UR, UT, the 16 bits
+    // following the two character VR Field are reserved for use by later
+    // versions of the DICOM Standard.
+    // See: PS 3.5 Section 7.1.2 - Data Element Structure with Explicit VR
+    std::uint16_t vl16 = ToUint16<kByteOrder>(data + 6);
+
+    if (vl16 != 0) {
+      header->length = vl16;
+    } else if (header->vr.Is16BitsFollowingReversed()) {
+      // The 16 bits after VR Field are 0, and the VR confirms that they are
+      // reserved (instead of a value length of 0). Read the 4-byte value
+      // length.
+      header->size = kMaxHeaderSize;
+      if (size < kMaxHeaderSize) {
+        return MORE;
+      }
+      header->length = ToUint32<kByteOrder>(data + 8);
+    } else {
+      header->length = 0;
+    }
+  } else {
+    header->vr = GetImplicitVR(header->tag);
+    header->length = ToUint32<kByteOrder>(data + 4);
+  }
+
+  return OK;
+}
+
+inline HeaderParser::Status HeaderParser::ParseHeader(const char* data,
+                                                      std::size_t size,
+                                                      Header* header) const {
+  if (vr_type_ == VR::EXPLICIT) {
+    if (byte_order_ == ByteOrder::LE) {
+      return ParseHeader<VR::EXPLICIT, ByteOrder::LE>(data, size, header);
+    }
+    return ParseHeader<VR::EXPLICIT, ByteOrder::BE>(data, size, header);
+  }
+
+  if (byte_order_ == ByteOrder::LE) {
+    return ParseHeader<VR::IMPLICIT, ByteOrder::LE>(data, size, header);
+  }
+  return ParseHeader<VR::IMPLICIT, ByteOrder::BE>(data, size, header);
+}
+
+template <VR::Type kVrType, ByteOrder kByteOrder>
+HeaderParser::Status HeaderParser::ReadHeader(Reader& reader, Header* header) {
+  char bytes[kMaxHeaderSize];
+
+  if (reader.ReadBytes(bytes, kMinHeaderSize) !=
+      static_cast<std::streamsize>(kMinHeaderSize)) {
+    return END;
+  }
+
+  Status status =
+      ParseHeader<kVrType, kByteOrder>(bytes, kMinHeaderSize, header);
+
+  if (status == CHECK_TRANSFER_SYNTAX) {
+    reader.UndoRead(kMinHeaderSize);
+    CheckTransferSyntax(reader);
+
+  } else if (status == MORE) {
+    const std::size_t count = kMaxHeaderSize - kMinHeaderSize;
+
+    if (reader.ReadBytes(bytes + kMinHeaderSize, count) !=
+        static_cast<std::streamsize>(count)) {
+      return END;
+    }
+
+    status = ParseHeader<kVrType, kByteOrder>(bytes, kMaxHeaderSize, header);
+  }
+
+  return status;
+}
+
+inline HeaderParser::Status HeaderParser::ReadHeader(Reader& reader,
+                                                     Header* header) {
+  if (vr_type_ == VR::EXPLICIT) {
+    if (byte_order_ == ByteOrder::LE) {
+      return ReadHeader<VR::EXPLICIT, ByteOrder::LE>(reader, header);
+    }
+    return ReadHeader<VR::EXPLICIT, ByteOrder::BE>(reader, header);
+  }
+
+  if (byte_order_ == ByteOrder::LE) {
+    return ReadHeader<VR::IMPLICIT, ByteOrder::LE>(reader, header);
+  }
+  return ReadHeader<VR::IMPLICIT, ByteOrder::BE>(reader, header);
+}
+
+}  // namespace dcm
+
+#endif  // DCM_HEADER_PARSER_H_
@@ -0,0 +1,370 @@
+#include "dcm/incremental_reader.h"
+
+#include <algorithm>  // for std::min
+#include <cstring>  // for memcmp, memcpy
+
+#include "dcm/data_sequence.h"
+#include "dcm/logger.h"
+#include "dcm/memory_reader.h"
+#include "dcm/read_handler.h"
+
+namespace dcm {
+
+// -----------------------------------------------------------------------------
+
+namespace {
+
+// Preamble (128 bytes) + DICOM prefix (4 bytes).
+// This is the most bytes which have to be available at once.
+const std::size_t kPreambleSize = 132;
+
+}  // namespace
+
+// -----------------------------------------------------------------------------
+
+IncrementalReader::IncrementalReader(ReadHandler* handler)
+    : handler_(handler),
+      state_(State::PREAMBLE),
+      finishing_(false),
+      failed_(false),
+      element_(nullptr),
+      element_wanted_(false),
+      chunk_size_(0),
+      value_read_(0),
+      value_length_(0) {
+  parser_.Reset();
+}
+
+IncrementalReader::~IncrementalReader() {
+  delete element_;
+}
+
+void IncrementalReader::Feed(const char* data, std::size_t size) {
+  if (state_ == State::DONE || size == 0) {
+    return;
+  }
+
+  if (!pending_.empty()) {
+    // Complete the pending header with the head of this chunk.
+    const std::size_t pending_size = pending_.size();
+    const std::size_t head_size = std::min(size, kPreambleSize);
+
+    pending_.insert(pending_.end(), data, data + head_size);
+
+    std::size_t consumed = Parse(pending_.data(), pending_.size());
+
+    if (consumed < pending_size) {
+      // Still incomplete (the chunk must be shorter than |kPreambleSize|).
+      pending_.erase(pending_.begin(), pending_.begin() + consumed);
+      pending_.insert(pending_.end(), data + head_size, data + size);
+      return;
+    }
+
+    pending_.clear();
+
+    data += consumed - pending_size;
+    size -= consumed - pending_size;
+  }
+
+  // Parse the chunk in place and keep the bytes of an incomplete header.
+  std::size_t consumed = Parse(data, size);
+
+  if (state_ != State::DONE) {
+    pending_.assign(data + consumed, data + size);
+  }
+}
+
+bool IncrementalReader::Finish() {
+  if (state_ != State::DONE) {
+    finishing_ = true;
+
+    Parse(pending_.data(), pending_.size());
+    pending_.clear();
+  }
+
+  return !failed_;
+}
+
+std::size_t IncrementalReader::Parse(const char* data, std::size_t size) {
+  std::size_t consumed = 0;
+
+  while (state_ != State::DONE) {
+    const char* p = data + consumed;
+    const std::size_t available = size - consumed;
+
+    std::size_t n = 0;
+    bool ok = false;
+
+    switch (state_) {
+      case State::PREAMBLE:
+        ok = ParsePreamble(p, available, &n);
+        break;
+
+      case State::HEADER:
+        // The top of the read loop of the current level.
+        if (parser_.frames().back().read_length >=
+            parser_.frames().back().length) {
+          PopFrame();
+          continue;
+        }
+
+        if (handler_->should_stop()) {
+          PopAllFrames();  // Handler required to stop reading.
+          continue;
+        }
+
+        ok = ParseHeader(p, available, &n);
+        break;
+
+      case State::VALUE:
+        ok = ParseValue(p, available, &n);
+        break;
+
+      case State::SKIP:
+        ok = SkipValue(available, &n);
+        break;
+
+      default:
+        break;
+    }
+
+    if (!ok) {
+      if (finishing_) {
+        EndOfData();
+      }
+      break;  // More bytes are needed.
+    }
+
+    consumed += n;
+  }
+
+  return consumed;
+}
+
+bool IncrementalReader::ParsePreamble(const char* data, std::size_t size,
+                                      std::size_t* consumed) {
+  if (size < kPreambleSize) {
+    return false;
+  }
+
+  if (std::memcmp(data + 128, "DICM", 4) == 0) {
+    *consumed = kPreambleSize;
+  } else {
+    LOG_WARN("Preamble is omitted.");
+    *consumed = 0;
+  }
+
+  state_ = State::HEADER;
+  return true;
+}
+
+bool IncrementalReader::ParseHeader(const char* data, std::size_t size,
+                                    std::size_t* consumed) {
+  HeaderParser::Header header;
+  HeaderParser::Status status = parser_.ParseHeader(data, size, &header);
+
+  if (status == HeaderParser::MORE) {
+    return false;
+  }
+
+  if (status == HeaderParser::CHECK_TRANSFER_SYNTAX) {
+    MemoryReader reader(data, size);
+    parser_.CheckTransferSyntax(reader);
+
+    handler_->OnTransferSyntax(parser_.vr_type(), parser_.byte_order());
+
+    // Go back to parse the header again since the byte order might be
+    // changed.
+    *consumed = 0;
+    return true;
+  }
+
+  parser_.frames().back().read_length +=
+      static_cast<std::uint32_t>(header.size);
+  *consumed = header.size;
+
+  if (status == HeaderParser::INVALID_VR) {
+    LOG_ERRO("Failed to read VR for (%u,%u).", header.tag.group(),
+             header.tag.element());
+    PopFrame();
+    return true;
+  }
+
+  if (header.IsDelimitation()) {
+    LOG_INFO("Read sequence (item) delimitation tag.");
+    PopFrame(true);
+    return true;
+  }
+
+  if (header.IsItem()) {
+    LOG_INFO("Read sequence item prefix tag.");
+
+    // If item length is undefined, this item will be ended with a delimitation.
+    handler_->OnSequenceItemStart(header.length);
+
+    parser_.PushFrame(HeaderParser::Frame::ITEM, header.tag, header.length);
+    return true;
+  }
+
+  const Tag tag = header.tag;
+  const VR vr = header.vr;
+  const std::uint32_t length = header.length;
+
+  if (vr == VR::SQ) {
+    auto data_sequence = new DataSequence(tag);
+    data_sequence->set_length(length);
+
+    handler_->OnSequenceStart(data_sequence);
+
+    parser_.PushFrame(HeaderParser::Frame::SEQUENCE, tag, length);
+    return true;
+  }
+
+  if (length == kUndefinedLength) {
+    LOG_ERRO("Non-SQ element with undefined length.");
+    PopFrame();
+    return true;
+  }
+
+  tag_ = tag;
+  value_read_ = 0;
+  value_length_ = length;
+
+  element_wanted_ = handler_->OnElementStart(tag);
+
+  if (element_wanted_ || parser_.IsValueNeeded(tag)) {
+    element_ = new DataElement(tag, vr, parser_.byte_order());
+
+    if (length == 0) {
+      EndValue();
+    } else {
+      if (element_wanted_ && handler_->data_chunk_size() > 0 &&
+          length > handler_->data_chunk_size()) {
+        // Pass the value in chunks instead.
+        chunk_size_ = handler_->data_chunk_size();
+        element_->SetValueless(length);
+      } else {
+        value_ = Buffer(length);
+      }
+      state_ = State::VALUE;
+    }
+  } else {
+    if (length > 0) {
+      state_ = State::SKIP;
+    }
+  }
+
+  return true;
+}
+
+bool IncrementalReader::ParseValue(const char* data, std::size_t size,
+                                   std::size_t* consumed) {
+  std::size_t n = std::min<std::size_t>(size, value_length_ - value_read_);
+  if (n == 0) {
+    return false;
+  }
+
+  if (chunk_size_ > 0) {
+    // Pass the bytes in place.
+    n = std::min(n, chunk_size_);
+  } else {
+    std::memcpy(value_.data() + value_read_, data, n);
+  }
+
+  value_read_ += static_cast<std::uint32_t>(n);
+  parser_.frames().back().read_length += static_cast<std::uint32_t>(n);
+  *consumed = n;
+
+  if (chunk_size_ > 0) {
+    handler_->OnElementData(data, n, value_read_ == value_length_);
+  }
+
+  if (value_read_ == value_length_) {
+    EndValue();
+  }
+
+  return true;
+}
+
+bool IncrementalReader::SkipValue(std::size_t size, std::size_t* consumed) {
+  std::size_t n = std::min<std::size_t>(size, value_length_ - value_read_);
+  if (n == 0) {
+    return false;
+  }
+
+  value_read_ += static_cast<std::uint32_t>(n);
+  parser_.frames().back().read_length += static_cast<std::uint32_t>(n);
+  *consumed = n;
+
+  if (value_read_ == value_length_) {
+    state_ = State::HEADER;
+  }
+
+  return true;
+}
+
+void IncrementalReader::EndValue() {
+  if (chunk_size_ > 0) {
+    chunk_size_ = 0;
+  } else if (value_length_ > 0) {
+    element_->SetBuffer(std::move(value_));
+  }
+
+  parser_.KeepValue(*element_);
+
+  DataElement* element = element_;
+  element_ = nullptr;
+
+  state_ = State::HEADER;
+
+  if (element_wanted_) {
+    // Call handler as the last step since it might delete the element.
+    handler_->OnElementEnd(element);
+  } else {
+    delete element;
+  }
+}
+
+void IncrementalReader::EndOfData() {
+  if (state_ == State::PREAMBLE) {
+    LOG_ERRO("Failed to read 4 bytes DICOM prefix.");
+    failed_ = true;
+    state_ = State::DONE;
+    return;
+  }
+
+  if (element_ != nullptr) {
+    LOG_ERRO("Failed to read value of size: %u", value_length_);
+    delete element_;
+    element_ = nullptr;
+    chunk_size_ = 0;
+  }
+
+  state_ = State::HEADER;
+
+  PopAllFrames();
+}
+
+void IncrementalReader::PopFrame(bool delimited) {
+  HeaderParser::Frame frame = parser_.PopFrame();
+
+  if (frame.kind == HeaderParser::Frame::ROOT) {
+    state_ = State::DONE;
+    handler_->OnEnd();
+    return;
+  }
+
+  if (frame.kind == HeaderParser::Frame::SEQUENCE) {
+    handler_->OnSequenceEnd(delimited);
+  } else {
+    handler_->OnSequenceItemEnd(delimited);
+  }
+}
+
+void IncrementalReader::PopAllFrames() {
+  while (!parser_.frames().empty()) {
+    PopFrame();
+  }
+}
+
+}  // namespace dcm
@@ -0,0 +1,123 @@
+#ifndef DCM_INCREMENTAL_READER_H_
+#define DCM_INCREMENTAL_READER_H_
+
+#include <vector>
+
+#include "dcm/defs.h"
+#include "dcm/header_parser.h"
+
+namespace dcm {
+
+class DataElement;
+class ReadHandler;
+
+// A push-mode reader fed by arbitrary byte chunks.
+//
+// Unlike DicomReader which pulls the bytes from a reader and blocks until they
+// are available, this reader keeps its state (sequence depth, pending tag/VR/
+// length, partial value) across Feed() calls and fires the callbacks of the
+// read handler as soon as enough bytes have arrived.
+//
+// Usage:
+//   IncrementalReader reader(&read_handler);
+//   while (/* more data */) {
+//     reader.Feed(chunk, chunk_size);
+//   }
+//   reader.Finish();
+//
+class IncrementalReader {
+public:
+  explicit IncrementalReader(ReadHandler* handler);
+
+  ~IncrementalReader();
+
+  IncrementalReader(const IncrementalReader&) = delete;
+  IncrementalReader& operator=(const IncrementalReader&) = delete;
+
+  // Feed the next chunk of bytes.
+  // The bytes are not referred after this returns; only the bytes of an
+  // incomplete header and the values wanted by the handler are copied. Values
+  // passed in chunks (see ReadHandler::OnElementData()) are not copied at all.
+  void Feed(const char* data, std::size_t size);
+
+  // Tell the reader that no more bytes will come.
+  // The open sequences and items are ended.
+  // Return false if the data is not DICOM at all (e.g., too short).
+  bool Finish();
+
+  // Reading has been done, either finished, stopped by the handler or ended
+  // because of malformed data. Any more bytes fed will be ignored.
+  bool done() const { return state_ == State::DONE; }
+
+private:
+  enum class State {
+    PREAMBLE,  // Checking the preamble and DICOM prefix.
+    HEADER,    // Reading the tag, VR and value length of an element.
+    VALUE,     // Reading the value of an element.
+    SKIP,      // Skipping the value of an element.
+    DONE,
+  };
+
+  // Parse as many bytes as possible.
+  // Return the number of bytes consumed.
+  std::size_t Parse(const char* data, std::size_t size);
+
+  // Each step returns false if more bytes are needed, otherwise the number of
+  // bytes consumed (might be 0) is set to |consumed|.
+  bool ParsePreamble(const char* data, std::size_t size, std::size_t* consumed);
+  bool ParseHeader(const char* data, std::size_t size, std::size_t* consumed);
+  bool ParseValue(const char* data, std::size_t size, std::size_t* consumed);
+  bool SkipValue(std::size_t size, std::size_t* consumed);
+
+  // The value has been completely read.
+  void EndValue();
+
+  // No more bytes will come while more are needed.
+  void EndOfData();
+
+  // End the current level (i.e., "break" the read loop of DicomReader).
+  // |delimited| tells if it's ended with a delimitation tag.
+  void PopFrame(bool delimited = false);
+
+  // End all the levels.
+  void PopAllFrames();
+
+private:
+  ReadHandler* handler_;
+
+  State state_;
+
+  // Set by Finish().
+  bool finishing_;
+
+  // Not DICOM at all.
+  bool failed_;
+
+  // The transfer syntax and the levels being read.
+  HeaderParser parser_;
+
+  // Bytes of an incomplete header, kept across Feed() calls.
+  std::vector<char> pending_;
+
+  // The element whose value is being read.
+  Tag tag_;
+  DataElement* element_;
+  Buffer value_;
+
+  // The element is wanted by the handler (see ReadHandler::OnElementStart()).
+  bool element_wanted_;
+
+  // The size of the chunks to pass the value in, 0 if the value is read into
+  // the element. See ReadHandler::OnElementData().
+  std::size_t chunk_size_;
+
+  // Number of value bytes read or skipped.
+  std::uint32_t value_read_;
+
+  // Value length of the element being read or skipped.
+  std::uint32_t value_length_;
+};
+
+}  // namespace dcm
+
+#endif  // DCM_INCREMENTAL_READER_H_
@@ -0,0 +1,57 @@
+#include "dcm/mapped_file.h"
+
+#include "boost/filesystem/operations.hpp"
+#include "boost/interprocess/file_mapping.hpp"
+#include "boost/interprocess/mapped_region.hpp"
+
+#include "dcm/logger.h"
+
+namespace bfs = boost::filesystem;
+namespace bip = boost::interprocess;
+
+namespace dcm {
+
+class MappedFile::Impl {
+public:
+  bip::file_mapping mapping;
+  bip::mapped_region region;
+};
+
+MappedFile::MappedFile() : data_(nullptr), size_(0) {
+}
+
+MappedFile::~MappedFile() = default;
+
+std::shared_ptr<MappedFile> MappedFile::Open(const Path& path) {
+  boost::system::error_code ec;
+  auto file_size = bfs::file_size(path, ec);
+  if (ec) {
+    LOG_ERRO("Failed to get the size of file: %s", path.string().c_str());
+    return nullptr;
+  }
+
+  std::shared_ptr<MappedFile> mapped_file(new MappedFile);
+
+  if (file_size == 0) {
+    // An empty file can't be mapped.
+    return mapped_file;
+  }
+
+  std::unique_ptr<Impl> impl(new Impl);
+
+  try {
+    impl->mapping = bip::file_mapping(path.string().c_str(), bip::read_only);
+    impl->region = bip::mapped_region(impl->mapping, bip::read_only);
+  } catch (const bip::interprocess_exception& e) {
+    LOG_ERRO("Failed to map file %s: %s", path.string().c_str(), e.what());
+    return nullptr;
+  }
+
+  mapped_file->data_ = static_cast<const char*>(impl->region.get_address());
+  mapped_file->size_ = impl->region.get_size();
+  mapped_file->impl_ = std::move(impl);
+
+  return mapped_file;
+}
+
+}  // namespace dcm
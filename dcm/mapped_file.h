@@ -0,0 +1,50 @@
+#ifndef DCM_MAPPED_FILE_H_
+#define DCM_MAPPED_FILE_H_
+
+#include <memory>
+
+#include "dcm/defs.h"
+
+namespace dcm {
+
+// A read-only memory-mapped file.
+//
+// Usage:
+//   auto mapped_file = MappedFile::Open("path/to/file");
+//   if (mapped_file) {
+//     // Use mapped_file->data() and mapped_file->size().
+//   }
+//
+// The mapping is released when the last shared pointer to it is destroyed.
+// Value buffers referring to the mapped bytes share the ownership, see
+// Buffer::View().
+class MappedFile {
+public:
+  // Map the whole file into memory.
+  // Return nullptr on failure.
+  static std::shared_ptr<MappedFile> Open(const Path& path);
+
+  ~MappedFile();
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  const char* data() const { return data_; }
+
+  std::size_t size() const { return size_; }
+
+private:
+  MappedFile();
+
+private:
+  // Hide the platform-specific mapping objects.
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+
+  const char* data_;
+  std::size_t size_;
+};
+
+}  // namespace dcm
+
+#endif  // DCM_MAPPED_FILE_H_
@@ -0,0 +1,64 @@
+#include "dcm/memory_reader.h"
+
+#include <algorithm>  // for std::min
+#include <cstring>  // std::memcpy
+
+namespace dcm {
+
+MemoryReader::MemoryReader(const char* data, std::size_t size,
+                           std::shared_ptr<const void> keeper)
+    : data_(data), size_(size), pos_(0), keeper_(std::move(keeper)) {
+}
+
+void MemoryReader::Seek(long offset, std::ios::seekdir dir) {
+  long base = 0;
+  if (dir == std::ios::cur) {
+    base = static_cast<long>(pos_);
+  } else if (dir == std::ios::end) {
+    base = static_cast<long>(size_);
+  }
+
+  // Clamp the position to [0, size].
+  long pos = base + offset;
+  if (pos < 0) {
+    pos = 0;
+  }
+
+  pos_ = std::min(static_cast<std::size_t>(pos), size_);
+}
+
+std::streamsize MemoryReader::ReadBytes(void* bytes, std::size_t count) {
+  count = std::min(count, size_ - pos_);
+
+  if (count > 0) {
+    std::memcpy(bytes, data_ + pos_, count);
+    pos_ += count;
+  }
+
+  return static_cast<std::streamsize>(count);
+}
+
+bool MemoryReader::ReadBuffer(std::size_t count, Buffer* buffer) {
+  if (!keeper_) {
+    return Reader::ReadBuffer(count, buffer);
+  }
+
+  if (count > size_ - pos_) {
+    return false;
+  }
+
+  *buffer = Buffer::View(data_ + pos_, count, keeper_);
+  pos_ += count;
+
+  return true;
+}
+
+bool MemoryReader::ReadBuffer(std::size_t count, Buffer* buffer,
+                              const std::shared_ptr<Arena>& arena) {
+  if (keeper_) {
+    return ReadBuffer(count, buffer);
+  }
+  return Reader::ReadBuffer(count, buffer, arena);
+}
+
+}  // namespace dcm
@@ -0,0 +1,52 @@
+#ifndef DCM_MEMORY_READER_H_
+#define DCM_MEMORY_READER_H_
+
+#include <memory>
+
+#include "dcm/reader.h"
+
+namespace dcm {
+
+// A reader reading from a contiguous range of bytes in memory.
+//
+// If a |keeper| is given, the value buffers read by ReadBuffer() refer to the
+// bytes directly (zero-copy) and share the ownership of the keeper, so the
+// bytes live as long as any of the buffers. Otherwise the values are copied.
+class MemoryReader : public Reader {
+public:
+  MemoryReader(const char* data, std::size_t size,
+               std::shared_ptr<const void> keeper = nullptr);
+
+  ~MemoryReader() override = default;
+
+  bool IsOk() const override {
+    return data_ != nullptr || size_ == 0;
+  }
+
+  void Seek(long offset, std::ios::seekdir dir = std::ios::beg) override;
+
+  std::streamoff Tell() const override {
+    return static_cast<std::streamoff>(pos_);
+  }
+
+  std::streamsize ReadBytes(void* bytes, std::size_t count) override;
+
+  bool ReadBuffer(std::size_t count, Buffer* buffer) override;
+
+  // The arena is not used if the bytes are referred to directly.
+  bool ReadBuffer(std::size_t count, Buffer* buffer,
+                  const std::shared_ptr<Arena>& arena) override;
+
+private:
+  const char* data_;
+  std::size_t size_;
+
+  // Current read position.
+  std::size_t pos_;
+
+  std::shared_ptr<const void> keeper_;
+};
+
+}  // namespace dcm
+
+#endif  // DCM_MEMORY_READER_H_
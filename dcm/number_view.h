@@ -0,0 +1,69 @@
+#ifndef DCM_NUMBER_VIEW_H_
+#define DCM_NUMBER_VIEW_H_
+
+#include <cassert>
+#include <cstddef>
+#include <utility>  // for std::move
+#include <vector>
+
+namespace dcm {
+
+// A read-only view of numeric values, see DataElement::GetUint16View(), etc.
+//
+// The view refers to the value of the element directly if it's stored in the
+// byte order of this OS (and properly aligned). Otherwise, it owns a swapped
+// copy of the values.
+// A view referring to the value must not be used after the element is
+// modified or destroyed.
+template <typename T>
+class NumberView {
+public:
+  NumberView() = default;
+
+  NumberView(const NumberView&) = delete;
+  NumberView& operator=(const NumberView&) = delete;
+
+  NumberView(NumberView&&) = default;
+  NumberView& operator=(NumberView&&) = default;
+
+  const T* data() const { return data_; }
+
+  std::size_t size() const { return size_; }
+
+  bool empty() const { return size_ == 0; }
+
+  const T& operator[](std::size_t index) const {
+    assert(index < size_);
+    return data_[index];
+  }
+
+  const T* begin() const { return data_; }
+  const T* end() const { return data_ + size_; }
+
+  // Does the view own a copy of the values instead of referring to them?
+  bool IsCopy() const { return !copy_.empty(); }
+
+  // Refer to the values.
+  void Reset(const T* data, std::size_t size) {
+    copy_.clear();
+    data_ = data;
+    size_ = size;
+  }
+
+  // Own a copy of the values.
+  void Reset(std::vector<T>&& copy) {
+    copy_ = std::move(copy);
+    data_ = copy_.data();
+    size_ = copy_.size();
+  }
+
+private:
+  std::vector<T> copy_;
+
+  const T* data_ = nullptr;
+  std::size_t size_ = 0;
+};
+
+}  // namespace dcm
+
+#endif  // DCM_NUMBER_VIEW_H_
@@ -16,6 +16,9 @@ public:
 
   bool should_stop() const { return should_stop_; }
 
+  // The size of the chunks passed to OnElementData().
+  std::size_t data_chunk_size() const { return data_chunk_size_; }
+
   virtual void OnTransferSyntax(VR::Type vr_type, ByteOrder byte_order) = 0;
 
   // The return value indicates whether OnElementEnd will be called.
@@ -24,11 +27,35 @@ public:
   // The data element was newly allocated and should be deleted by read handler.
   virtual void OnElementEnd(DataElement* data_element) = 0;
 
+  // Receive the value in chunks of at most data_chunk_size() bytes, instead
+  // of in the data element passed to OnElementEnd() which then has only the
+  // value length (see DataElement::IsValueless()). Only for the values larger
+  // than data_chunk_size().
+  // The bytes are in the byte order of the data set.
+  // If the data is truncated, the last chunk never comes, neither does
+  // OnElementEnd().
+  virtual void OnElementData(const char* /*chunk*/, std::size_t /*n*/,
+                             bool /*last*/) {
+  }
+
   virtual void OnSequenceStart(DataSequence* data_sequence) = 0;
-  virtual void OnSequenceEnd(DataElement* data_element = nullptr) = 0;
 
-  virtual void OnSequenceItemStart(DataElement* data_element) = 0;
-  virtual void OnSequenceItemEnd(DataElement* data_element = nullptr) = 0;
+  // |delimited| tells if the sequence is ended with a sequence delimitation
+  // (fffe,e0dd), otherwise by its value length (or the end of data).
+  virtual void OnSequenceEnd(bool delimited) = 0;
+
+  // |length| is the value length of the item prefix (fffe,e000), could be
+  // kUndefinedLength.
+  virtual void OnSequenceItemStart(std::uint32_t length) = 0;
+
+  // |delimited| tells if the item is ended with an item delimitation
+  // (fffe,e00d), otherwise by its value length.
+  virtual void OnSequenceItemEnd(bool delimited) = 0;
+
+  // Reading has ended, successfully or not. Called once, after the levels
+  // (sequences and items) have ended.
+  virtual void OnEnd() {
+  }
 
 protected:
   ReadHandler() = default;
@@ -36,6 +63,10 @@ protected:
 protected:
   // Set this flag to stop the read process.
   bool should_stop_ = false;
+
+  // Set this to non-zero (e.g., in OnElementStart()) to receive large values
+  // in chunks, see OnElementData().
+  std::size_t data_chunk_size_ = 0;
 };
 
 }  // namespace dcm
@@ -4,30 +4,55 @@
 #include <cassert>
 #include <cstdint>
 #include <istream>
+#include <memory>
+
+#include "dcm/arena.h"
+#include "dcm/buffer.h"
 
 namespace dcm {
 
+// An interface for reading bytes from a source.
 class Reader {
 public:
-  explicit Reader(std::istream* istream = nullptr) : istream_(istream) {}
+  virtual ~Reader() = default;
 
-  void Init(std::istream* istream) {
-    istream_ = istream;
-  }
+  virtual bool IsOk() const = 0;
 
-  bool IsOk() const {
-    return istream_ != nullptr && !istream_->bad();
-  }
+  virtual void Seek(long offset, std::ios::seekdir dir = std::ios::beg) = 0;
 
-  void Seek(long offset, std::ios::seekdir dir = std::ios::beg) {
-    assert(IsOk());
-    istream_->seekg(offset, dir);
+  // Current read position.
+  virtual std::streamoff Tell() const = 0;
+
+  virtual std::streamsize ReadBytes(void* bytes, std::size_t count) = 0;
+
+  // Read |count| bytes as a value buffer.
+  // By default the bytes are copied into a newly allocated buffer. Readers
+  // backed by memory could return a buffer referring to the bytes instead.
+  virtual bool ReadBuffer(std::size_t count, Buffer* buffer) {
+    Buffer bytes(count);
+    if (count > 0 &&
+        ReadBytes(bytes.data(), count) != static_cast<std::streamsize>(count)) {
+      return false;
+    }
+    *buffer = std::move(bytes);
+    return true;
   }
 
-  std::streamsize ReadBytes(void* bytes, std::size_t count) {
-    assert(IsOk());
-    istream_->read(reinterpret_cast<char*>(bytes), count);
-    return istream_->gcount();
+  // Read |count| bytes as a value buffer allocated from |arena|.
+  // The buffer refers to the bytes in the arena and shares its ownership.
+  // Small values are stored inline as usual, see Buffer::kInlineSize.
+  virtual bool ReadBuffer(std::size_t count, Buffer* buffer,
+                          const std::shared_ptr<Arena>& arena) {
+    if (count <= Buffer::kInlineSize) {
+      return ReadBuffer(count, buffer);
+    }
+
+    char* bytes = static_cast<char*>(arena->Allocate(count, 8));
+    if (ReadBytes(bytes, count) != static_cast<std::streamsize>(count)) {
+      return false;
+    }
+    *buffer = Buffer::View(bytes, count, arena);
+    return true;
   }
 
   void UndoRead(std::size_t byte_count) {
@@ -48,6 +73,41 @@ public:
     return ReadBytes(value, 4) == 4;
   }
 
+protected:
+  Reader() = default;
+};
+
+// -----------------------------------------------------------------------------
+
+// A reader reading from a standard input stream.
+class StreamReader : public Reader {
+public:
+  explicit StreamReader(std::istream* istream = nullptr) : istream_(istream) {}
+
+  void Init(std::istream* istream) {
+    istream_ = istream;
+  }
+
+  bool IsOk() const override {
+    return istream_ != nullptr && !istream_->bad();
+  }
+
+  void Seek(long offset, std::ios::seekdir dir = std::ios::beg) override {
+    assert(IsOk());
+    istream_->seekg(offset, dir);
+  }
+
+  std::streamoff Tell() const override {
+    assert(IsOk());
+    return istream_->tellg();
+  }
+
+  std::streamsize ReadBytes(void* bytes, std::size_t count) override {
+    assert(IsOk());
+    istream_->read(reinterpret_cast<char*>(bytes), count);
+    return istream_->gcount();
+  }
+
 protected:
   std::istream* istream_;
 };
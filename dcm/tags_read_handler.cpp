@@ -0,0 +1,117 @@
+#include "dcm/tags_read_handler.h"
+
+#include <algorithm>
+
+#include "dcm/arena.h"
+#include "dcm/data_sequence.h"
+#include "dcm/data_set.h"
+#include "dcm/logger.h"
+
+namespace dcm {
+
+TagsReadHandler::TagsReadHandler(DataSet* data_set)
+    : data_set_(data_set), full_read_handler_(data_set), depth_(0),
+      sequence_(nullptr) {
+}
+
+TagsReadHandler& TagsReadHandler::AddTag(Tag tag) {
+  // Make sure the tags are sorted.
+  auto lower = std::lower_bound(tags_.begin(), tags_.end(), tag);
+  if (lower == tags_.end() || *lower != tag) {
+    tags_.insert(lower, tag);
+  }
+
+  return *this;
+}
+
+void TagsReadHandler::ClearTags() {
+  tags_.clear();
+}
+
+void TagsReadHandler::OnTransferSyntax(VR::Type vr_type, ByteOrder byte_order) {
+  full_read_handler_.OnTransferSyntax(vr_type, byte_order);
+}
+
+bool TagsReadHandler::OnElementStart(Tag tag) {
+  if (depth_ > 0) {
+    // An element of a sequence item.
+    return sequence_ != nullptr;
+  }
+
+  return CheckTag(tag);
+}
+
+void TagsReadHandler::OnElementEnd(DataElement* data_element) {
+  Tag tag = data_element->tag();
+
+  full_read_handler_.OnElementEnd(data_element);
+
+  if (depth_ == 0 && tag == tags_.back()) {
+    LOG_INFO("The last tag has been read, stop.");
+    should_stop_ = true;
+  }
+}
+
+void TagsReadHandler::OnSequenceStart(DataSequence* data_sequence) {
+  if (depth_ == 0 && CheckTag(data_sequence->tag())) {
+    sequence_ = data_sequence;
+  }
+
+  ++depth_;
+
+  if (sequence_ != nullptr) {
+    full_read_handler_.OnSequenceStart(data_sequence);
+  } else {
+    // The sequence might be allocated from the arena of the reader, which is
+    // shared with the data set, see DicomReader::set_arena().
+    Arena* arena = data_sequence->from_arena() ? data_set_->arena().get()
+                                               : nullptr;
+    ArenaDelete(arena, data_sequence);
+  }
+}
+
+void TagsReadHandler::OnSequenceEnd(bool delimited) {
+  if (sequence_ != nullptr) {
+    full_read_handler_.OnSequenceEnd(delimited);
+  }
+
+  --depth_;
+
+  if (depth_ == 0 && sequence_ != nullptr) {
+    Tag tag = sequence_->tag();
+    sequence_ = nullptr;
+
+    if (tag == tags_.back()) {
+      LOG_INFO("The last tag has been read, stop.");
+      should_stop_ = true;
+    }
+  }
+}
+
+void TagsReadHandler::OnSequenceItemStart(std::uint32_t length) {
+  if (sequence_ != nullptr) {
+    full_read_handler_.OnSequenceItemStart(length);
+  }
+}
+
+void TagsReadHandler::OnSequenceItemEnd(bool delimited) {
+  if (sequence_ != nullptr) {
+    full_read_handler_.OnSequenceItemEnd(delimited);
+  }
+}
+
+void TagsReadHandler::OnEnd() {
+  full_read_handler_.OnEnd();
+}
+
+bool TagsReadHandler::CheckTag(Tag tag) {
+  if (tags_.empty() || tag > tags_.back()) {
+    // Larger than the last tag to read, stop the process.
+    should_stop_ = true;
+    return false;
+  }
+
+  return std::binary_search(tags_.begin(), tags_.end(), tag);
+}
+
+}  // namespace dcm
@@ -0,0 +1,69 @@
+#ifndef DCM_TAGS_READ_HANDLER_H_
+#define DCM_TAGS_READ_HANDLER_H_
+
+#include <vector>
+
+#include "dcm/full_read_handler.h"
+
+namespace dcm {
+
+// A read handler to read data elements only for the specific tags.
+// It avoids loading the full data set, so it's very fast.
+//
+// Only the tags of the root data set are matched. A sequence is read with all
+// its items if its tag is requested, otherwise its elements are skipped.
+//
+// The values not requested are skipped (see DicomReader, it seeks over them),
+// and the reading stops as soon as the highest requested tag has been read or
+// passed, so the pixel data is never touched unless requested.
+class TagsReadHandler : public ReadHandler {
+public:
+  //\param data_set The destination data set.
+  explicit TagsReadHandler(DataSet* data_set);
+
+  ~TagsReadHandler() override = default;
+
+  // Add a tag to read.
+  TagsReadHandler& AddTag(Tag tag);
+
+  // Delete all tags.
+  void ClearTags();
+
+  void OnTransferSyntax(VR::Type vr_type, ByteOrder byte_order) override;
+
+  bool OnElementStart(Tag tag) override;
+  void OnElementEnd(DataElement* data_element) override;
+
+  void OnSequenceStart(DataSequence* data_sequence) override;
+  void OnSequenceEnd(bool delimited) override;
+
+  void OnSequenceItemStart(std::uint32_t length) override;
+  void OnSequenceItemEnd(bool delimited) override;
+
+  void OnEnd() override;
+
+private:
+  // Check if the tag of the root data set is requested.
+  // Stop if the tag is larger than the last tag to read.
+  bool CheckTag(Tag tag);
+
+private:
+  // The destination data set.
+  DataSet* data_set_;
+
+  // Tags (sorted) to read.
+  std::vector<Tag> tags_;
+
+  // Add the elements read into the data set.
+  FullReadHandler full_read_handler_;
+
+  // Depth of nested sequences.
+  std::size_t depth_;
+
+  // The sequence of the root data set being read, if requested.
+  DataSequence* sequence_;
+};
+
+}  // namespace dcm
+
+#endif  // DCM_TAGS_READ_HANDLER_H_
@@ -0,0 +1,114 @@
+#include "dcm/transfer_syntax.h"
+
+#include "dcm/data_dict.h"
+#include "dcm/logger.h"
+#include "dcm/reader.h"
+
+namespace dcm {
+
+void CheckTransferSyntax(const std::string& transfer_syntax_uid,
+                         VR::Type* vr_type, ByteOrder* byte_order) {
+  if (transfer_syntax_uid == transfer_syntax_uids::kImplicitLittleEndian) {
+    *vr_type = VR::IMPLICIT;
+    *byte_order = ByteOrder::LE;
+  } else if (transfer_syntax_uid ==
+             transfer_syntax_uids::kExplicitLittleEndian) {
+    *vr_type = VR::EXPLICIT;
+    *byte_order = ByteOrder::LE;
+  } else if (transfer_syntax_uid ==
+             transfer_syntax_uids::kDeflatedExplicitLittleEndian) {
+    *vr_type = VR::EXPLICIT;
+    *byte_order = ByteOrder::LE;
+  } else if (transfer_syntax_uid ==
+             transfer_syntax_uids::kExplicitBigEndian) {
+    *vr_type = VR::EXPLICIT;
+    *byte_order = ByteOrder::BE;
+  } else {
+    // Compressed pixel data transfer syntax are always Explicit VR Little
+    // Endian (so you can call JPEG baseline 1.2.840.10008.1.2.4.50 for
+    // example "Explicit Little Endian JPEG Baseline").
+    *vr_type = VR::EXPLICIT;
+    *byte_order = ByteOrder::LE;
+  }
+}
+
+bool CheckVrType(Reader& reader, VR::Type* vr_type) {
+  // Skip the 4 tag bytes.
+  reader.Seek(4, std::ios::cur);
+
+  char bytes[2];
+  if (!reader.ReadBytes(bytes, 2)) {
+    reader.UndoRead(4);  // Put 4 tag bytes back.
+    return false;
+  }
+
+  reader.UndoRead(6);  // Put it back.
+
+  // Check to see if the 2 bytes following the tag field represents a valid VR.
+  if (VR(bytes).IsUnknown()) {
+    *vr_type = VR::IMPLICIT;
+    LOG_INFO("VR type: Implicit.");
+  } else {
+    *vr_type = VR::EXPLICIT;
+    LOG_INFO("VR type: Explicit.");
+  }
+
+  return true;
+}
+
+bool CheckByteOrder(Reader& reader, ByteOrder* byte_order) {
+  std::uint8_t bytes[4] = { 0 };
+  if (!reader.ReadBytes(bytes, 4)) {
+    return false;
+  }
+
+  reader.UndoRead(4);  // Put it back.
+
+  std::uint16_t group = (bytes[0] & 0xff) + ((bytes[1] & 0xff) << 8);
+  std::uint16_t element = (bytes[2] & 0xff) + ((bytes[3] & 0xff) << 8);
+  Tag tag_l(group, element);  // Little Endian
+  Tag tag_b = tag_l.SwapBytes();  // Big Endian
+
+  const dict::Entry* entry_l = dict::GetEntry(tag_l);
+  const dict::Entry* entry_b = dict::GetEntry(tag_b);
+
+  if (entry_l == nullptr && entry_b == nullptr) {
+    if (element == 0) {
+      // Group Length tag not in data dictionary, check the group number.
+      // For the first tag, group number is more probable of 0008 than 0800.
+      if (tag_l.group() > 0xff && tag_b.group() <= 0xff) {
+        *byte_order = ByteOrder::BE;
+      } else {
+        *byte_order = ByteOrder::LE;
+      }
+    } else {
+      // Both tags show an error, an invalid tag is encountered.
+      // Assume that it's Little Endian.
+      *byte_order = ByteOrder::LE;
+    }
+  } else {
+    if (entry_l == nullptr) {
+      *byte_order = ByteOrder::BE;
+    } else if (entry_b == nullptr) {
+      *byte_order = ByteOrder::LE;
+    } else {
+      // Both tags are valid, check the group number.
+      // For the first tag, group number is more probable of 0008 than 0800.
+      if (tag_l.group() > 0xff && tag_b.group() <= 0xff) {
+        *byte_order = ByteOrder::BE;
+      } else {
+        *byte_order = ByteOrder::LE;
+      }
+    }
+  }
+
+  if (*byte_order == ByteOrder::LE) {
+    LOG_INFO("Byte order checked: little endian.");
+  } else {
+    LOG_INFO("Byte order checked: big endian.");
+  }
+
+  return true;
+}
+
+}  // namespace dcm
@@ -0,0 +1,27 @@
+#ifndef DCM_TRANSFER_SYNTAX_H_
+#define DCM_TRANSFER_SYNTAX_H_
+
+#include <string>
+
+#include "dcm/defs.h"
+
+namespace dcm {
+
+class Reader;
+
+// Get VR type and byte order from Transfer Syntax UID.
+void CheckTransferSyntax(const std::string& transfer_syntax_uid,
+                         VR::Type* vr_type, ByteOrder* byte_order);
+
+// Check VR type by reading the first data element (without group 0002).
+// The position of the reader is kept unchanged.
+bool CheckVrType(Reader& reader, VR::Type* vr_type);
+
+// Check byte order by reading the tag of the first data element (without group
+// 0002) and looking it up in the data dictionary.
+// The position of the reader is kept unchanged.
+bool CheckByteOrder(Reader& reader, ByteOrder* byte_order);
+
+}  // namespace dcm
+
+#endif  // DCM_TRANSFER_SYNTAX_H_
@@ -1,5 +1,33 @@
 #include "dcm/util.h"
 
+#include <cstring>  // for memcpy
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define DCM_SWAP_SSE2 1
+#include <emmintrin.h>
+
+#if defined(__GNUC__) || defined(_MSC_VER)
+// AVX2 is compiled for the functions below only and used if the CPU supports
+// it, see SelectSwapKernels().
+#define DCM_SWAP_AVX2 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif  // defined(__GNUC__) || defined(_MSC_VER)
+
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define DCM_SWAP_NEON 1
+#include <arm_neon.h>
+#endif
+
+#if defined(DCM_SWAP_AVX2) && defined(__GNUC__)
+#define DCM_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define DCM_TARGET_AVX2
+#endif
+
 namespace dcm {
 namespace util {
 
@@ -44,5 +72,266 @@ void SwapBytes(void* value, std::size_t size) {
   }
 }
 
+// -----------------------------------------------------------------------------
+
+namespace {
+
+// A kernel swaps the bytes of |count| values which are not necessarily
+// aligned.
+typedef void (*SwapKernel)(char* p, std::size_t count);
+
+struct SwapKernels {
+  const char* name;
+  SwapKernel swap16;
+  SwapKernel swap32;
+  SwapKernel swap64;
+};
+
+// Scalar kernels, also used for the tails of the SIMD kernels.
+
+void ScalarSwap16(char* p, std::size_t count) {
+  for (std::size_t i = 0; i < count; ++i, p += 2) {
+    std::uint16_t value;
+    std::memcpy(&value, p, 2);
+    value = SwapUint16(value);
+    std::memcpy(p, &value, 2);
+  }
+}
+
+void ScalarSwap32(char* p, std::size_t count) {
+  for (std::size_t i = 0; i < count; ++i, p += 4) {
+    std::uint32_t value;
+    std::memcpy(&value, p, 4);
+    value = SwapUint32(value);
+    std::memcpy(p, &value, 4);
+  }
+}
+
+void ScalarSwap64(char* p, std::size_t count) {
+  for (std::size_t i = 0; i < count; ++i, p += 8) {
+    std::uint32_t value[2];
+    std::memcpy(value, p, 8);
+    std::uint32_t c = value[0];
+    value[0] = SwapUint32(value[1]);
+    value[1] = SwapUint32(c);
+    std::memcpy(p, value, 8);
+  }
+}
+
+#if defined(DCM_SWAP_SSE2)
+
+// SSE2 has no byte shuffle: swap the bytes of each 16-bit word by shifting,
+// and reorder the words (for 32/64-bit values) by shuffling.
+
+inline __m128i Sse2Vector16(__m128i v) {
+  return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+}
+
+inline __m128i Sse2Vector32(__m128i v) {
+  v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+  v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+  return Sse2Vector16(v);
+}
+
+inline __m128i Sse2Vector64(__m128i v) {
+  v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(0, 1, 2, 3));
+  v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(0, 1, 2, 3));
+  return Sse2Vector16(v);
+}
+
+template <__m128i (*kSwap)(__m128i), std::size_t kSize>
+void Sse2SwapN(char* p, std::size_t count, SwapKernel tail) {
+  const std::size_t kPerVector = 16 / kSize;
+
+  std::size_t i = 0;
+  for (; i + kPerVector <= count; i += kPerVector, p += 16) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(p), kSwap(v));
+  }
+
+  tail(p, count - i);
+}
+
+void Sse2Swap16(char* p, std::size_t count) {
+  Sse2SwapN<Sse2Vector16, 2>(p, count, ScalarSwap16);
+}
+
+void Sse2Swap32(char* p, std::size_t count) {
+  Sse2SwapN<Sse2Vector32, 4>(p, count, ScalarSwap32);
+}
+
+void Sse2Swap64(char* p, std::size_t count) {
+  Sse2SwapN<Sse2Vector64, 8>(p, count, ScalarSwap64);
+}
+
+#endif  // DCM_SWAP_SSE2
+
+#if defined(DCM_SWAP_AVX2)
+
+// Byte shuffle masks, the same for both 128-bit lanes.
+const char kAvx2Mask16[32] = {
+  1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+  1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+};
+
+const char kAvx2Mask32[32] = {
+  3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+  3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+};
+
+const char kAvx2Mask64[32] = {
+  7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+  7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+};
+
+DCM_TARGET_AVX2
+void Avx2SwapN(char* p, std::size_t count, std::size_t size,
+               const char* mask_bytes, SwapKernel tail) {
+  const __m256i mask =
+      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(mask_bytes));
+
+  const std::size_t per_vector = 32 / size;
+
+  std::size_t i = 0;
+
+  // Two vectors per iteration to hide the latency of the loads.
+  for (; i + 2 * per_vector <= count; i += 2 * per_vector, p += 64) {
+    __m256i v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    __m256i v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + 32));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(p),
+                        _mm256_shuffle_epi8(v0, mask));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(p + 32),
+                        _mm256_shuffle_epi8(v1, mask));
+  }
+
+  for (; i + per_vector <= count; i += per_vector, p += 32) {
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(p),
+                        _mm256_shuffle_epi8(v, mask));
+  }
+
+  tail(p, count - i);
+}
+
+void Avx2Swap16(char* p, std::size_t count) {
+  Avx2SwapN(p, count, 2, kAvx2Mask16, ScalarSwap16);
+}
+
+void Avx2Swap32(char* p, std::size_t count) {
+  Avx2SwapN(p, count, 4, kAvx2Mask32, ScalarSwap32);
+}
+
+void Avx2Swap64(char* p, std::size_t count) {
+  Avx2SwapN(p, count, 8, kAvx2Mask64, ScalarSwap64);
+}
+
+bool CpuSupportsAvx2() {
+#if defined(_MSC_VER)
+  int info[4];
+  __cpuid(info, 0);
+  if (info[0] < 7) {
+    return false;
+  }
+
+  // OSXSAVE and AVX, then the OS saves the YMM registers.
+  __cpuid(info, 1);
+  const int kOsxsaveAvx = (1 << 27) | (1 << 28);
+  if ((info[2] & kOsxsaveAvx) != kOsxsaveAvx ||
+      (_xgetbv(0) & 0x6) != 0x6) {
+    return false;
+  }
+
+  __cpuidex(info, 7, 0);
+  return (info[1] & (1 << 5)) != 0;
+#else
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx2") != 0;
+#endif
+}
+
+#endif  // DCM_SWAP_AVX2
+
+#if defined(DCM_SWAP_NEON)
+
+void NeonSwap16(char* p, std::size_t count) {
+  std::size_t i = 0;
+  for (; i + 8 <= count; i += 8, p += 16) {
+    uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t*>(p));
+    vst1q_u8(reinterpret_cast<uint8_t*>(p), vrev16q_u8(v));
+  }
+  ScalarSwap16(p, count - i);
+}
+
+void NeonSwap32(char* p, std::size_t count) {
+  std::size_t i = 0;
+  for (; i + 4 <= count; i += 4, p += 16) {
+    uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t*>(p));
+    vst1q_u8(reinterpret_cast<uint8_t*>(p), vrev32q_u8(v));
+  }
+  ScalarSwap32(p, count - i);
+}
+
+void NeonSwap64(char* p, std::size_t count) {
+  std::size_t i = 0;
+  for (; i + 2 <= count; i += 2, p += 16) {
+    uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t*>(p));
+    vst1q_u8(reinterpret_cast<uint8_t*>(p), vrev64q_u8(v));
+  }
+  ScalarSwap64(p, count - i);
+}
+
+#endif  // DCM_SWAP_NEON
+
+SwapKernels SelectSwapKernels() {
+#if defined(DCM_SWAP_AVX2)
+  if (CpuSupportsAvx2()) {
+    return { "AVX2", Avx2Swap16, Avx2Swap32, Avx2Swap64 };
+  }
+#endif
+
+#if defined(DCM_SWAP_SSE2)
+  return { "SSE2", Sse2Swap16, Sse2Swap32, Sse2Swap64 };
+#elif defined(DCM_SWAP_NEON)
+  return { "NEON", NeonSwap16, NeonSwap32, NeonSwap64 };
+#else
+  return { "Scalar", ScalarSwap16, ScalarSwap32, ScalarSwap64 };
+#endif
+}
+
+const SwapKernels& GetSwapKernels() {
+  static const SwapKernels kernels = SelectSwapKernels();
+  return kernels;
+}
+
+}  // namespace
+
+void SwapBytes(void* values, std::size_t size, std::size_t count) {
+  char* p = static_cast<char*>(values);
+
+  if (size == 2) {
+    GetSwapKernels().swap16(p, count);
+  } else if (size == 4) {
+    GetSwapKernels().swap32(p, count);
+  } else if (size == 8) {
+    GetSwapKernels().swap64(p, count);
+  }
+}
+
+void SwapBytesScalar(void* values, std::size_t size, std::size_t count) {
+  char* p = static_cast<char*>(values);
+
+  if (size == 2) {
+    ScalarSwap16(p, count);
+  } else if (size == 4) {
+    ScalarSwap32(p, count);
+  } else if (size == 8) {
+    ScalarSwap64(p, count);
+  }
+}
+
+const char* GetSwapKernelName() {
+  return GetSwapKernels().name;
+}
+
 }  // namespace util
 }  // namespace dcm
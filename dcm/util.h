@@ -18,6 +18,19 @@ void Swap64(void* value);
 // |size| should be 2, 4 or 8.
 void SwapBytes(void* value, std::size_t size);
 
+// Swap the bytes of an array of |count| values in place, e.g., a Big Endian
+// OW pixel buffer. |size| should be 2, 4 or 8.
+// Vectorized with the best of AVX2, SSE2 or NEON the CPU supports, which is
+// chosen at runtime once.
+void SwapBytes(void* values, std::size_t size, std::size_t count);
+
+// Same as above, but one value at a time. For comparison (e.g., benchmark).
+void SwapBytesScalar(void* values, std::size_t size, std::size_t count);
+
+// The instruction set used by SwapBytes() for arrays: "AVX2", "SSE2", "NEON"
+// or "Scalar".
+const char* GetSwapKernelName();
+
 }  // namespace util
 }  // namespace dcm
 
@@ -0,0 +1,48 @@
+#include "dcm/value_source.h"
+
+#include "boost/filesystem/fstream.hpp"
+
+#include "dcm/logger.h"
+
+namespace bfs = boost::filesystem;
+
+namespace dcm {
+
+ValueSource::ValueSource(const Path& path) : path_(path) {
+}
+
+ValueSource::~ValueSource() {
+}
+
+bool ValueSource::Read(std::int64_t offset, std::uint32_t length,
+                       Buffer* buffer) {
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  if (!stream_) {
+    std::unique_ptr<bfs::ifstream> file(
+        new bfs::ifstream(path_, std::ios::binary));
+    if (!file->is_open()) {
+      LOG_ERRO("Failed to open the file to read: %s", path_.string().c_str());
+      return false;
+    }
+    stream_ = std::move(file);
+  }
+
+  stream_->clear();
+  stream_->seekg(offset, std::ios::beg);
+
+  Buffer bytes(length);
+  if (length > 0) {
+    stream_->read(bytes.data(), length);
+    if (stream_->gcount() != static_cast<std::streamsize>(length)) {
+      LOG_ERRO("Failed to read value of size %u at offset %lld from: %s",
+               length, static_cast<long long>(offset), path_.string().c_str());
+      return false;
+    }
+  }
+
+  *buffer = std::move(bytes);
+  return true;
+}
+
+}  // namespace dcm
@@ -0,0 +1,44 @@
+#ifndef DCM_VALUE_SOURCE_H_
+#define DCM_VALUE_SOURCE_H_
+
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
+
+#include "dcm/defs.h"
+
+namespace dcm {
+
+// A file which the values of data elements are read from on demand.
+// It's shared by the lazily loaded data elements of a file.
+// See DicomReader::set_lazy_threshold().
+class ValueSource {
+public:
+  explicit ValueSource(const Path& path);
+
+  ~ValueSource();
+
+  ValueSource(const ValueSource&) = delete;
+  ValueSource& operator=(const ValueSource&) = delete;
+
+  const Path& path() const { return path_; }
+
+  // Read |length| bytes from |offset| of the file.
+  // The file is opened on the first read and kept open.
+  // Thread safe, the elements sharing the source could be loaded at the same
+  // time.
+  bool Read(std::int64_t offset, std::uint32_t length, Buffer* buffer);
+
+private:
+  Path path_;
+
+  std::unique_ptr<std::istream> stream_;
+
+  // Guards |stream_|.
+  std::mutex mutex_;
+};
+
+}  // namespace dcm
+
+#endif  // DCM_VALUE_SOURCE_H_
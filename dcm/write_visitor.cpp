@@ -1,8 +1,12 @@
 #include "dcm/write_visitor.h"
 
+#include <algorithm>  // for std::min
+#include <cstring>  // for memcpy
+
 #include "dcm/data_element.h"
 #include "dcm/data_sequence.h"
 #include "dcm/data_set.h"
+#include "dcm/logger.h"
 #include "dcm/util.h"
 #include "dcm/writer.h"
 
@@ -14,6 +18,13 @@ WriteVisitor::WriteVisitor(Writer* writer) : writer_(writer) {
 void WriteVisitor::VisitDataElement(const DataElement* data_element) {
   tag_ = data_element->tag();
 
+  if (data_element->IsValueless()) {
+    LOG_ERRO("Can't write (%04x,%04x) without its value.", tag_.group(),
+             tag_.element());
+    ok_ = false;
+    return;
+  }
+
   // Tag
   WriteUint16(tag_.group());
   WriteUint16(tag_.element());
@@ -50,8 +61,7 @@ void WriteVisitor::VisitDataElement(const DataElement* data_element) {
 
   if (vr != VR::SQ) {
     if (length > 0) {
-      const Buffer& buffer = data_element->buffer();
-      writer_->WriteBytes(&buffer[0], length);
+      WriteValue(data_element);
     }
   }
 }
@@ -64,14 +74,18 @@ void WriteVisitor::VisitDataSequence(const DataSequence* data_sequence) {
   for (std::size_t i = 0; i < data_sequence->size(); ++i) {
     const auto& item = data_sequence->At(i);
 
-    VisitDataElement(item.prefix);
+    WriteDelimiter(tags::kSeqItemPrefix, item.length);
 
     VisitDataSet(item.data_set);
 
-    if (item.delimitation != nullptr) {
-      VisitDataElement(item.delimitation);
+    if (item.delimited) {
+      WriteDelimiter(tags::kSeqItemDelimatation, 0);
     }
   }
+
+  if (data_sequence->delimited()) {
+    WriteDelimiter(tags::kSeqDelimatation, 0);
+  }
 }
 
 void WriteVisitor::VisitDataSet(const DataSet* data_set) {
@@ -101,6 +115,46 @@ void WriteVisitor::VisitDataSet(const DataSet* data_set) {
   --level_;
 }
 
+void WriteVisitor::WriteValue(const DataElement* data_element) {
+  // Meta header always in Little Endian.
+  const ByteOrder byte_order = tag_.group() == 2 ? ByteOrder::LE : byte_order_;
+
+  // The value might be stored in the other byte order, see
+  // DataElement::SetByteOrder(). Don't convert it in place.
+  const Buffer& buffer = data_element->stored_buffer();
+  const std::uint32_t length = data_element->length();
+
+  const std::size_t size = data_element->GetSwapSize();
+
+  if (size == 0 || data_element->value_byte_order() == byte_order) {
+    writer_->WriteBytes(buffer.data(), length);
+    return;
+  }
+
+  // Swap on the fly, chunk by chunk.
+  // The chunk size is a multiple of any value size.
+  const std::size_t kChunkSize = 64 * 1024;
+
+  chunk_.resize(std::min<std::size_t>(length, kChunkSize));
+
+  for (std::size_t offset = 0; offset < length; offset += chunk_.size()) {
+    const std::size_t n = std::min<std::size_t>(length - offset, chunk_.size());
+
+    std::memcpy(chunk_.data(), buffer.data() + offset, n);
+    util::SwapBytes(chunk_.data(), size, n / size);
+
+    writer_->WriteBytes(chunk_.data(), n);
+  }
+}
+
+void WriteVisitor::WriteDelimiter(Tag tag, std::uint32_t length) {
+  tag_ = tag;
+
+  WriteUint16(tag_.group());
+  WriteUint16(tag_.element());
+  WriteUint32(length);
+}
+
 void WriteVisitor::WriteUint16(std::uint16_t value) {
   if (value != 0) {
     if (tag_.group() == 2) {
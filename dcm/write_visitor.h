@@ -1,6 +1,8 @@
 #ifndef DCM_WRITE_VISITOR_H_
 #define DCM_WRITE_VISITOR_H_
 
+#include <vector>
+
 #include "dcm/defs.h"
 #include "dcm/visitor.h"
 
@@ -20,11 +22,20 @@ public:
 
   ~WriteVisitor() override = default;
 
+  // False if any element couldn't be written, see DataElement::IsValueless().
+  bool ok() const { return ok_; }
+
   void VisitDataElement(const DataElement* data_element) override;
   void VisitDataSequence(const DataSequence* data_sequence) override;
   void VisitDataSet(const DataSet* data_set) override;
 
 private:
+  // Write the value in the byte order of the data set.
+  void WriteValue(const DataElement* data_element);
+
+  // Write a sequence item prefix or delimitation.
+  void WriteDelimiter(Tag tag, std::uint32_t length);
+
   void WriteUint16(std::uint16_t value);
   void WriteUint32(std::uint32_t value);
 
@@ -39,6 +50,11 @@ private:
 
   // The tag currently being written.
   Tag tag_;
+
+  // For swapping the bytes of a value while writing, see WriteValue().
+  std::vector<char> chunk_;
+
+  bool ok_ = true;
 };
 
 }  // namespace dcm 
@@ -0,0 +1,86 @@
+#include "gtest/gtest.h"
+
+#include <cstdint>
+
+#include "dcm/arena.h"
+
+namespace {
+
+class Counted {
+public:
+  explicit Counted(int* count) : count_(count) {
+    ++*count_;
+  }
+
+  ~Counted() {
+    --*count_;
+  }
+
+private:
+  int* count_;
+};
+
+}  // namespace
+
+TEST(ArenaTest, Allocate) {
+  dcm::Arena arena;
+  EXPECT_EQ(0, arena.block_count());
+
+  char* p1 = static_cast<char*>(arena.Allocate(3, 1));
+  void* p2 = arena.Allocate(8, 8);
+
+  // From the same block.
+  EXPECT_EQ(1, arena.block_count());
+  EXPECT_EQ(dcm::Arena::kMinBlockSize, arena.size());
+
+  EXPECT_EQ(0, reinterpret_cast<std::uintptr_t>(p2) % 8);
+  EXPECT_GE(static_cast<char*>(p2), p1 + 3);
+
+  EXPECT_TRUE(arena.Owns(p1));
+  EXPECT_TRUE(arena.Owns(p2));
+
+  int i = 0;
+  EXPECT_FALSE(arena.Owns(&i));
+}
+
+TEST(ArenaTest, Blocks) {
+  dcm::Arena arena;
+
+  for (int i = 0; i < 5; ++i) {
+    arena.Allocate(dcm::Arena::kMinBlockSize / 4);
+  }
+  EXPECT_EQ(2, arena.block_count());
+
+  // The blocks grow.
+  EXPECT_EQ(dcm::Arena::kMinBlockSize * 3, arena.size());
+
+  // A large allocation takes a block of its own.
+  const std::size_t size = dcm::Arena::kMaxBlockSize * 2;
+  void* p = arena.Allocate(size);
+  EXPECT_EQ(3, arena.block_count());
+  EXPECT_TRUE(arena.Owns(p));
+  EXPECT_TRUE(arena.Owns(static_cast<char*>(p) + size - 1));
+
+  // The current block is still used.
+  arena.Allocate(1);
+  EXPECT_EQ(3, arena.block_count());
+}
+
+TEST(ArenaTest, NewAndDelete) {
+  dcm::Arena arena;
+  int count = 0;
+
+  Counted* c1 = dcm::ArenaNew<Counted>(&arena, &count);
+  EXPECT_TRUE(arena.Owns(c1));
+
+  // From the heap.
+  Counted* c2 = dcm::ArenaNew<Counted>(nullptr, &count);
+  EXPECT_FALSE(arena.Owns(c2));
+
+  EXPECT_EQ(2, count);
+
+  dcm::ArenaDelete(&arena, c1);
+  dcm::ArenaDelete<Counted>(nullptr, c2);
+
+  EXPECT_EQ(0, count);
+}
@@ -0,0 +1,140 @@
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <string>
+
+#include "dcm/buffer.h"
+
+TEST(BufferTest, Owned) {
+  dcm::Buffer buffer("abcd", 4);
+
+  EXPECT_FALSE(buffer.IsView());
+  EXPECT_EQ(4, buffer.size());
+  EXPECT_EQ('d', buffer.back());
+  EXPECT_EQ("abcd", std::string(buffer.data(), buffer.size()));
+}
+
+TEST(BufferTest, View) {
+  auto source = std::make_shared<std::string>("abcdef");
+
+  dcm::Buffer buffer = dcm::Buffer::View(source->data() + 2, 4, source);
+  const dcm::Buffer& cbuffer = buffer;
+
+  EXPECT_TRUE(cbuffer.IsView());
+  EXPECT_EQ(4, cbuffer.size());
+  EXPECT_EQ(source->data() + 2, cbuffer.data());
+
+  // The view keeps the source alive.
+  EXPECT_EQ(2, source.use_count());
+
+  dcm::Buffer moved = std::move(buffer);
+  EXPECT_TRUE(moved.IsView());
+  EXPECT_TRUE(buffer.empty());
+  EXPECT_EQ(2, source.use_count());
+
+  moved.clear();
+  EXPECT_EQ(1, source.use_count());
+}
+
+TEST(BufferTest, CopyOnWrite) {
+  auto source = std::make_shared<std::string>("abcd");
+
+  dcm::Buffer buffer = dcm::Buffer::View(source->data(), source->size(),
+                                         source);
+
+  // Non-const access copies the bytes before modifying them.
+  buffer[0] = 'x';
+
+  EXPECT_FALSE(buffer.IsView());
+  EXPECT_EQ("xbcd", std::string(buffer.data(), buffer.size()));
+  EXPECT_EQ("abcd", *source);
+  EXPECT_EQ(1, source.use_count());
+}
+
+TEST(BufferTest, Inline) {
+  dcm::Buffer buffer("abcd", 4);
+  EXPECT_FALSE(buffer.IsOnHeap());
+
+  // Copy and move of inline bytes.
+  dcm::Buffer copy = buffer;
+  EXPECT_FALSE(copy.IsOnHeap());
+  EXPECT_NE(buffer.data(), copy.data());
+  EXPECT_EQ("abcd", std::string(copy.data(), copy.size()));
+
+  dcm::Buffer moved = std::move(copy);
+  EXPECT_TRUE(copy.empty());
+  EXPECT_EQ("abcd", std::string(moved.data(), moved.size()));
+
+  // Zero-initialized up to the inline size.
+  buffer.resize(dcm::Buffer::kInlineSize);
+  EXPECT_FALSE(buffer.IsOnHeap());
+  EXPECT_EQ('\0', buffer.back());
+
+  // Spill over to the heap, keeping the bytes.
+  buffer.resize(dcm::Buffer::kInlineSize + 1);
+  EXPECT_TRUE(buffer.IsOnHeap());
+  EXPECT_EQ("abcd", std::string(buffer.data(), 4));
+  EXPECT_EQ('\0', buffer.back());
+}
+
+TEST(BufferTest, Heap) {
+  const std::string bytes(64, 'x');
+
+  dcm::Buffer buffer(bytes.data(), bytes.size());
+  EXPECT_TRUE(buffer.IsOnHeap());
+
+  dcm::Buffer copy = buffer;
+  EXPECT_TRUE(copy.IsOnHeap());
+  EXPECT_NE(buffer.data(), copy.data());
+  EXPECT_EQ(bytes, std::string(copy.data(), copy.size()));
+
+  // The heap bytes are taken over by a move.
+  const char* data = buffer.data();
+  dcm::Buffer moved = std::move(buffer);
+  EXPECT_EQ(data, moved.data());
+  EXPECT_FALSE(buffer.IsOnHeap());
+  EXPECT_TRUE(buffer.empty());
+
+  // Shrinking keeps the heap storage.
+  moved.resize(2);
+  EXPECT_EQ(data, moved.data());
+  EXPECT_EQ("xx", std::string(moved.data(), moved.size()));
+}
+
+TEST(BufferTest, Assign) {
+  auto source = std::make_shared<std::string>(64, 'v');
+  const std::string bytes(64, 'x');
+
+  dcm::Buffer view = dcm::Buffer::View(source->data(), source->size(), source);
+  dcm::Buffer heap(bytes.data(), bytes.size());
+  dcm::Buffer inline_bytes("abcd", 4);
+
+  // The heap bytes are replaced by a view.
+  dcm::Buffer buffer = heap;
+  buffer = view;
+  EXPECT_TRUE(buffer.IsView());
+  EXPECT_EQ(3, source.use_count());
+
+  // The view is replaced by inline bytes.
+  buffer = inline_bytes;
+  EXPECT_FALSE(buffer.IsView());
+  EXPECT_FALSE(buffer.IsOnHeap());
+  EXPECT_EQ(2, source.use_count());
+  EXPECT_EQ("abcd", std::string(buffer.data(), buffer.size()));
+
+  // The inline bytes are replaced by heap bytes, then by a view again.
+  buffer = std::move(heap);
+  EXPECT_TRUE(buffer.IsOnHeap());
+  EXPECT_EQ(bytes, std::string(buffer.data(), buffer.size()));
+
+  buffer = std::move(view);
+  EXPECT_TRUE(buffer.IsView());
+  EXPECT_TRUE(view.empty());
+  EXPECT_EQ(2, source.use_count());
+
+  // Copy on write to the heap.
+  buffer[0] = 'x';
+  EXPECT_TRUE(buffer.IsOnHeap());
+  EXPECT_EQ(1, source.use_count());
+  EXPECT_EQ("xv", std::string(buffer.data(), 2));
+}
@@ -54,3 +54,94 @@ TEST(DataDictTest, GetVM_1) {
 
   EXPECT_EQ(nullptr, vm);
 }
+
+TEST(DataDictTest, GetEntry_VM) {
+  auto entry = dcm::dict::GetEntry(dcm::tags::kImageType);
+
+  ASSERT_TRUE(entry != nullptr);
+
+  EXPECT_EQ(dcm::VR::CS, entry->vr);
+  EXPECT_EQ(2, entry->vm.min());
+  EXPECT_EQ(dcm::VM::N, entry->vm.max());
+  EXPECT_EQ("ImageType", std::string(entry->keyword));
+}
+
+TEST(DataDictTest, GetEntry_NotFound) {
+  EXPECT_TRUE(dcm::dict::GetEntry(0x00080001) == nullptr);
+  EXPECT_TRUE(dcm::dict::GetEntry(0x00091001) == nullptr);  // Private
+  EXPECT_TRUE(dcm::dict::GetEntry(0xFFFFFFFF) == nullptr);
+
+  EXPECT_EQ(dcm::VR::UN, dcm::dict::GetVR(0x00091001));
+  EXPECT_EQ(nullptr, dcm::dict::GetVM(0x00091001));
+}
+
+TEST(DataDictTest, GetTag) {
+  dcm::Tag tag;
+
+  EXPECT_TRUE(dcm::dict::GetTag("PatientID", &tag));
+  EXPECT_EQ(dcm::tags::kPatientID, tag);
+
+  EXPECT_TRUE(dcm::dict::GetTag("SeriesDescription", &tag));
+  EXPECT_EQ(0x0008103E, tag);
+
+  EXPECT_TRUE(dcm::dict::GetTag("PixelData", &tag));
+  EXPECT_EQ(dcm::tags::kPixelData, tag);
+
+  EXPECT_FALSE(dcm::dict::GetTag("PatientId", &tag));
+  EXPECT_FALSE(dcm::dict::GetTag("", &tag));
+  EXPECT_FALSE(dcm::dict::GetTag("NoSuchKeyword", &tag));
+}
+
+TEST(DataDictTest, GetPrivateEntry) {
+  EXPECT_TRUE(dcm::dict::GetPrivateEntry("DICT TEST", 0x10) == nullptr);
+
+  dcm::dict::RegisterPrivate("DICT TEST  ", {
+    { 0x10, dcm::VR::UL, "Foo" },
+    { 0x01, dcm::VR::DS, "Bar" },
+  });
+
+  const dcm::dict::PrivateEntry* entry =
+      dcm::dict::GetPrivateEntry("DICT TEST", 0x10);
+  ASSERT_TRUE(entry != nullptr);
+  EXPECT_EQ(dcm::VR::UL, entry->vr);
+  EXPECT_EQ("Foo", entry->keyword);
+
+  // Replace an entry and add another.
+  dcm::dict::RegisterPrivate("DICT TEST", {
+    { 0x10, dcm::VR::SL, "Foo2" },
+    { 0x20, dcm::VR::LO, "Baz" },
+  });
+
+  // The entry got before is unchanged.
+  EXPECT_EQ(dcm::VR::UL, entry->vr);
+
+  entry = dcm::dict::GetPrivateEntry("DICT TEST", 0x10);
+  ASSERT_TRUE(entry != nullptr);
+  EXPECT_EQ(dcm::VR::SL, entry->vr);
+
+  EXPECT_EQ(dcm::VR::DS, dcm::dict::GetPrivateEntry("DICT TEST", 0x01)->vr);
+  EXPECT_EQ(dcm::VR::LO, dcm::dict::GetPrivateEntry("DICT TEST", 0x20)->vr);
+
+  EXPECT_TRUE(dcm::dict::GetPrivateEntry("DICT TEST", 0x02) == nullptr);
+  EXPECT_TRUE(dcm::dict::GetPrivateEntry("DICT TES", 0x10) == nullptr);
+}
+
+TEST(DataDictTest, RegisterPrivate_Batch) {
+  dcm::dict::RegisterPrivate(dcm::dict::PrivateDict{
+    { "DICT BATCH 1 ", { { 0x01, dcm::VR::US, "Foo" } } },
+    { "DICT BATCH 2", { { 0x02, dcm::VR::FD, "Bar" } } },
+  });
+
+  const dcm::dict::PrivateEntry* entry =
+      dcm::dict::GetPrivateEntry("DICT BATCH 1", 0x01);
+  ASSERT_TRUE(entry != nullptr);
+  EXPECT_EQ(dcm::VR::US, entry->vr);
+
+  // The trailing spaces are ignored in the lookup too.
+  entry = dcm::dict::GetPrivateEntry("DICT BATCH 2  ", 0x02);
+  ASSERT_TRUE(entry != nullptr);
+  EXPECT_EQ(dcm::VR::FD, entry->vr);
+  EXPECT_EQ("Bar", entry->keyword);
+
+  EXPECT_TRUE(dcm::dict::GetPrivateEntry("DICT BATCH 2", 0x01) == nullptr);
+}
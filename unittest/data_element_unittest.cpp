@@ -1,5 +1,9 @@
 #include "gtest/gtest.h"
 
+#include <string>
+#include <thread>
+#include <vector>
+
 #include "dcm/data_element.h"
 
 TEST(DataElementTest, Constructor) {
@@ -58,3 +62,97 @@ TEST(DataElementTest, SetUint16_BE) {
   EXPECT_TRUE(element.GetUint16(&value));
   EXPECT_EQ(1, value);
 }
+
+TEST(DataElementTest, SetByteOrder) {
+  dcm::DataElement element(dcm::tags::kRows, dcm::ByteOrder::LE);
+  EXPECT_TRUE(element.SetUint16(0x0102));
+
+  const std::string le_bytes(element.buffer().data(), element.buffer().size());
+
+  EXPECT_TRUE(element.SetByteOrder(dcm::ByteOrder::BE));
+
+  // Not swapped yet.
+  EXPECT_EQ(dcm::ByteOrder::BE, element.byte_order());
+  EXPECT_EQ(dcm::ByteOrder::LE, element.value_byte_order());
+
+  // The value is swapped from the byte order it's stored in.
+  std::uint16_t value = 0;
+  EXPECT_TRUE(element.GetUint16(&value));
+  EXPECT_EQ(0x0102, value);
+  EXPECT_EQ(dcm::ByteOrder::LE, element.value_byte_order());
+
+  // Swapped into a new buffer on accessing the raw buffer, the stored one is
+  // kept as is.
+  const dcm::Buffer& buffer = element.buffer();
+  EXPECT_EQ(dcm::ByteOrder::LE, element.value_byte_order());
+  ASSERT_EQ(2, buffer.size());
+  EXPECT_EQ(le_bytes[0], buffer.data()[1]);
+  EXPECT_EQ(le_bytes[1], buffer.data()[0]);
+
+  const dcm::Buffer& stored_buffer = element.stored_buffer();
+  ASSERT_EQ(2, stored_buffer.size());
+  EXPECT_EQ(le_bytes[0], stored_buffer.data()[0]);
+  EXPECT_EQ(le_bytes[1], stored_buffer.data()[1]);
+
+  // Back to the byte order it's stored in.
+  EXPECT_TRUE(element.SetByteOrder(dcm::ByteOrder::LE));
+  EXPECT_EQ(&stored_buffer, &element.buffer());
+
+  value = 0;
+  EXPECT_TRUE(element.GetUint16(&value));
+  EXPECT_EQ(0x0102, value);
+
+  // Strings have no byte order.
+  dcm::DataElement modality(dcm::tags::kModality, dcm::ByteOrder::LE);
+  EXPECT_TRUE(modality.SetString("CT"));
+  EXPECT_FALSE(modality.SetByteOrder(dcm::ByteOrder::BE));
+  EXPECT_EQ(dcm::ByteOrder::BE, modality.value_byte_order());
+  EXPECT_EQ("CT", modality.GetString());
+}
+
+// The value is swapped once even if accessed by threads at the same time.
+TEST(DataElementTest, SetByteOrder_Threads) {
+  dcm::DataElement element(dcm::tags::kPixelData, dcm::VR::OW,
+                           dcm::ByteOrder::LE);
+
+  // Little endian 0, 1, 2, ...
+  dcm::Buffer bytes(2048);
+  for (std::size_t i = 0; i < bytes.size() / 2; ++i) {
+    bytes[i * 2] = static_cast<char>(i & 0xFF);
+    bytes[i * 2 + 1] = static_cast<char>(i >> 8);
+  }
+  EXPECT_TRUE(element.SetBuffer(std::move(bytes)));
+
+  EXPECT_TRUE(element.SetByteOrder(dcm::ByteOrder::BE));
+
+  const std::size_t kThreadCount = 4;
+
+  std::vector<const char*> datas(kThreadCount, nullptr);
+  std::vector<std::thread> threads;
+
+  for (std::size_t i = 0; i < kThreadCount; ++i) {
+    threads.emplace_back([&element, &datas, i]() {
+      datas[i] = element.buffer().data();
+    });
+  }
+
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  for (std::size_t i = 1; i < kThreadCount; ++i) {
+    EXPECT_EQ(datas[0], datas[i]);
+  }
+
+  EXPECT_EQ(dcm::ByteOrder::LE, element.value_byte_order());
+
+  // Big endian 0x0102 at index 0x0102.
+  EXPECT_EQ(0x01, datas[0][0x0102 * 2]);
+  EXPECT_EQ(0x02, datas[0][0x0102 * 2 + 1]);
+
+  // The values are swapped from the stored buffer.
+  dcm::NumberView<std::uint16_t> view;
+  EXPECT_TRUE(element.GetUint16View(&view));
+  ASSERT_EQ(1024, view.size());
+  EXPECT_EQ(0x0102, view[0x0102]);
+}
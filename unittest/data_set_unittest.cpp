@@ -68,6 +68,51 @@ TEST(DataSetTest, InsertDuplicated) {
   EXPECT_EQ(0x00080008, data_set[0]->tag());
 }
 
+TEST(DataSetTest, InsertBatch) {
+  dcm::DataSet data_set;
+  data_set.SetString(0x00080060, "CT");
+
+  auto modality = new dcm::DataElement(0x00080060);
+  modality->SetString("MR");
+
+  std::vector<dcm::DataElement*> elements = {
+    new dcm::DataElement(0x00100020),
+    new dcm::DataElement(0x00080005),
+    modality,
+    new dcm::DataElement(0x00100010),
+    new dcm::DataElement(0x00080005),
+  };
+
+  EXPECT_EQ(2, data_set.InsertBatch(&elements));
+  EXPECT_TRUE(elements.empty());
+
+  ASSERT_EQ(4, data_set.size());
+  EXPECT_EQ(0x00080005, data_set[0]->tag());
+  EXPECT_EQ(0x00080060, data_set[1]->tag());
+  EXPECT_EQ(0x00100010, data_set[2]->tag());
+  EXPECT_EQ(0x00100020, data_set[3]->tag());
+
+  // The existing element is kept.
+  EXPECT_EQ("CT", data_set.GetString(0x00080060));
+  EXPECT_TRUE(data_set.Get(0x00100010) != nullptr);
+}
+
+TEST(DataSetTest, InsertBatch_KeepLast) {
+  dcm::DataSet data_set;
+  data_set.SetString(0x00080060, "CT");
+
+  auto modality = new dcm::DataElement(0x00080060);
+  modality->SetString("MR");
+
+  std::vector<dcm::DataElement*> elements = { modality };
+
+  EXPECT_EQ(1, data_set.InsertBatch(
+                   &elements, dcm::DataSet::DuplicatePolicy::KEEP_LAST));
+
+  ASSERT_EQ(1, data_set.size());
+  EXPECT_EQ("MR", data_set.GetString(0x00080060));
+}
+
 TEST(DataSetTest, GetElement) {
   dcm::DataSet data_set;
 
@@ -83,6 +128,26 @@ TEST(DataSetTest, GetElement) {
   EXPECT_TRUE(data_set.Get(0x00020001) == nullptr);
 }
 
+TEST(DataSetTest, GetElementInserted) {
+  dcm::DataSet data_set;
+
+  data_set.Insert(new dcm::DataElement(0x00100010));
+  data_set.Insert(new dcm::DataElement(0x00080005));
+  data_set.Append(new dcm::DataElement(0x00200013));
+  data_set.Insert(new dcm::DataElement(0x00080008));
+
+  for (std::size_t i = 0; i < data_set.size(); ++i) {
+    const dcm::DataElement* element = data_set[i];
+    EXPECT_EQ(element, data_set.Get(element->tag()));
+  }
+
+  EXPECT_TRUE(data_set.Get(0x00080006) == nullptr);
+  EXPECT_TRUE(data_set.Get(0x00300000) == nullptr);
+
+  data_set.Clear();
+  EXPECT_TRUE(data_set.Get(0x00080008) == nullptr);
+}
+
 TEST(DataSetTest, SetString) {
   dcm::Path path(g_data_dir);
   path /= "cs";
@@ -220,3 +285,119 @@ TEST(DataSetTest, UpdateGroupLength) {
     EXPECT_EQ(178, group_length);
   }
 }
+
+TEST(DataSetTest, SetString_Lengths) {
+  const dcm::Tag kGroupLength(0x0040, 0);
+  const dcm::Tag kTextValue(0x0040, 0xA160);  // UT
+
+  dcm::DataSet data_set;
+
+  auto data_sequence = new dcm::DataSequence(0x0040A730);
+  data_sequence->NewItem(0, dcm::VR::EXPLICIT, dcm::ByteOrder::LE);
+  data_sequence->set_length(dcm::kDelimiterLength);  // Item prefix
+  EXPECT_TRUE(data_set.Insert(data_sequence));
+  EXPECT_EQ(&data_set, data_sequence->parent());
+
+  // Sequence (12) + item prefix (8)
+  auto group_length_element = new dcm::DataElement(kGroupLength, dcm::VR::UL);
+  group_length_element->SetUint32(20);
+  EXPECT_TRUE(data_set.Insert(group_length_element));
+
+  dcm::DataSet* item = data_sequence->At(0).data_set;
+  EXPECT_EQ(data_sequence, item->parent());
+
+  std::uint32_t group_length = 0;
+
+  // Tag (4) + VR (2) + reserved (2) + value length (4) + value (4)
+  EXPECT_TRUE(item->SetString(kTextValue, "TEXT"));
+
+  EXPECT_EQ(16, data_sequence->At(0).length);
+  EXPECT_EQ(24, data_sequence->length());
+  EXPECT_TRUE(data_set.GetUint32(kGroupLength, &group_length));
+  EXPECT_EQ(36, group_length);
+
+  // A shorter value.
+  EXPECT_TRUE(item->SetString(kTextValue, "NO"));
+
+  EXPECT_EQ(14, data_sequence->At(0).length);
+  EXPECT_EQ(22, data_sequence->length());
+  EXPECT_TRUE(data_set.GetUint32(kGroupLength, &group_length));
+  EXPECT_EQ(34, group_length);
+
+  // Same as calculated from scratch.
+  EXPECT_TRUE(data_set.UpdateGroupLength(0x0040));
+  EXPECT_TRUE(data_set.GetUint32(kGroupLength, &group_length));
+  EXPECT_EQ(34, group_length);
+
+  // Tag (4) + value length (4) + value (2)
+  data_set.SetVRType(dcm::VR::IMPLICIT);
+  EXPECT_EQ(10, data_sequence->At(0).length);
+  EXPECT_EQ(18, data_sequence->length());
+}
+
+TEST(DataSetTest, Insert_Lengths) {
+  const dcm::Tag kGroupLength(0x0040, 0);
+  const dcm::Tag kTextValue(0x0040, 0xA160);  // UT
+
+  dcm::DataSet data_set;
+
+  auto group_length_element = new dcm::DataElement(kGroupLength, dcm::VR::UL);
+  group_length_element->SetUint32(0);
+  EXPECT_TRUE(data_set.Insert(group_length_element));
+
+  std::uint32_t group_length = 0;
+
+  // Sequence (12) + item prefix (8)
+  auto data_sequence = new dcm::DataSequence(0x0040A730);
+  data_sequence->NewItem(0, dcm::VR::EXPLICIT, dcm::ByteOrder::LE);
+  data_sequence->set_length(dcm::kDelimiterLength);
+  EXPECT_TRUE(data_set.Insert(data_sequence));
+  EXPECT_TRUE(data_set.GetUint32(kGroupLength, &group_length));
+  EXPECT_EQ(20, group_length);
+
+  // Tag (4) + VR (2) + reserved (2) + value length (4) + value (4)
+  auto text_value = new dcm::DataElement(kTextValue, dcm::VR::UT);
+  text_value->SetString("TEXT");
+  EXPECT_TRUE(data_sequence->AppendToLastItem(text_value));
+
+  EXPECT_EQ(16, data_sequence->At(0).length);
+  EXPECT_EQ(24, data_sequence->length());
+  EXPECT_TRUE(data_set.GetUint32(kGroupLength, &group_length));
+  EXPECT_EQ(36, group_length);
+
+  // Replace the sequence with an empty one.
+  auto empty_sequence = new dcm::DataSequence(0x0040A730);
+  empty_sequence->set_length(0);
+  std::vector<dcm::DataElement*> elements = { empty_sequence };
+  EXPECT_EQ(1, data_set.InsertBatch(
+                   &elements, dcm::DataSet::DuplicatePolicy::KEEP_LAST));
+
+  EXPECT_EQ(&data_set, empty_sequence->parent());
+  EXPECT_TRUE(data_set.GetUint32(kGroupLength, &group_length));
+  EXPECT_EQ(12, group_length);
+
+  // The lengths are still updated through the new sequence.
+  empty_sequence->NewItem(0, dcm::VR::EXPLICIT, dcm::ByteOrder::LE);
+  empty_sequence->set_length(dcm::kDelimiterLength);
+  EXPECT_TRUE(data_set.UpdateGroupLength(0x0040));
+
+  dcm::DataSet* item = empty_sequence->At(0).data_set;
+  EXPECT_TRUE(item->SetString(kTextValue, "TEXT"));
+
+  EXPECT_EQ(16, empty_sequence->At(0).length);
+  EXPECT_EQ(24, empty_sequence->length());
+  EXPECT_TRUE(data_set.GetUint32(kGroupLength, &group_length));
+  EXPECT_EQ(36, group_length);
+
+  // Delete the elements of the item, then the items.
+  item->Clear();
+  EXPECT_EQ(0, empty_sequence->At(0).length);
+  EXPECT_EQ(8, empty_sequence->length());
+  EXPECT_TRUE(data_set.GetUint32(kGroupLength, &group_length));
+  EXPECT_EQ(20, group_length);
+
+  empty_sequence->Clear();
+  EXPECT_EQ(0, empty_sequence->length());
+  EXPECT_TRUE(data_set.GetUint32(kGroupLength, &group_length));
+  EXPECT_EQ(12, group_length);
+}
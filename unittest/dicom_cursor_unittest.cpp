@@ -0,0 +1,177 @@
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "boost/filesystem.hpp"
+
+#include "dcm/data_element.h"
+#include "dcm/dicom_cursor.h"
+#include "dcm/dicom_file.h"
+
+extern std::string g_data_dir;
+
+namespace {
+
+// Append an Explicit VR Little Endian element header.
+// An item or delimitation if |vr| is nullptr.
+void AppendHeader(std::string* bytes, std::uint32_t tag, const char* vr,
+                  std::uint32_t length) {
+  const std::uint16_t group = static_cast<std::uint16_t>(tag >> 16);
+  const std::uint16_t element = static_cast<std::uint16_t>(tag & 0xFFFF);
+
+  bytes->push_back(static_cast<char>(group & 0xFF));
+  bytes->push_back(static_cast<char>(group >> 8));
+  bytes->push_back(static_cast<char>(element & 0xFF));
+  bytes->push_back(static_cast<char>(element >> 8));
+
+  if (vr != nullptr) {
+    bytes->append(vr, 2);
+    if (std::string(vr) != "SQ") {
+      bytes->push_back(static_cast<char>(length & 0xFF));
+      bytes->push_back(static_cast<char>(length >> 8));
+      return;
+    }
+    bytes->append(2, '\0');
+  }
+
+  for (int i = 0; i < 4; ++i) {
+    bytes->push_back(static_cast<char>((length >> (i * 8)) & 0xFF));
+  }
+}
+
+}  // namespace
+
+TEST(DicomCursorTest, Sequences) {
+  std::string bytes(128, '\0');
+  bytes += "DICM";
+
+  // Sequence of undefined length with an item of undefined length.
+  AppendHeader(&bytes, 0x00081140, "SQ", dcm::kUndefinedLength);
+  AppendHeader(&bytes, 0xFFFEE000, nullptr, dcm::kUndefinedLength);
+  AppendHeader(&bytes, 0x00081150, "UI", 4);
+  bytes.append("1.2\0", 4);
+  AppendHeader(&bytes, 0xFFFEE00D, nullptr, 0);
+  AppendHeader(&bytes, 0xFFFEE0DD, nullptr, 0);
+
+  // Sequence of defined length with an item of defined length.
+  AppendHeader(&bytes, 0x0040A730, "SQ", 8 + 10);
+  AppendHeader(&bytes, 0xFFFEE000, nullptr, 10);
+  AppendHeader(&bytes, 0x00080100, "SH", 2);
+  bytes += "AB";
+
+  AppendHeader(&bytes, 0x00100010, "PN", 4);
+  bytes += "Ab^C";
+
+  using Event = dcm::DicomCursor::Event;
+
+  struct Expected {
+    Event::Type type;
+    std::uint32_t tag;
+    std::size_t depth;
+  };
+
+  const std::vector<Expected> kExpected = {
+    { Event::SEQUENCE_START, 0x00081140, 0 },
+    { Event::ITEM_START, 0xFFFEE000, 1 },
+    { Event::ELEMENT, 0x00081150, 2 },
+    { Event::ITEM_END, 0xFFFEE00D, 1 },
+    { Event::SEQUENCE_END, 0xFFFEE0DD, 0 },
+    { Event::SEQUENCE_START, 0x0040A730, 0 },
+    { Event::ITEM_START, 0xFFFEE000, 1 },
+    { Event::ELEMENT, 0x00080100, 2 },
+    { Event::ITEM_END, 0xFFFEE000, 1 },
+    { Event::SEQUENCE_END, 0x0040A730, 0 },
+    { Event::ELEMENT, 0x00100010, 0 },
+  };
+
+  dcm::DicomCursor cursor;
+  ASSERT_TRUE(cursor.OpenBuffer(bytes.data(), bytes.size()));
+
+  Event event;
+  std::size_t i = 0;
+
+  while (cursor.Next(&event)) {
+    ASSERT_LT(i, kExpected.size());
+
+    EXPECT_EQ(kExpected[i].type, event.type) << i;
+    EXPECT_EQ(kExpected[i].tag, event.tag.ToUint32()) << i;
+    EXPECT_EQ(kExpected[i].depth, event.depth) << i;
+
+    if (event.tag == 0x00080100) {
+      dcm::Buffer buffer;
+      EXPECT_TRUE(cursor.ReadValue(&buffer));
+      EXPECT_EQ("AB", std::string(buffer.data(), buffer.size()));
+    }
+
+    ++i;
+  }
+
+  EXPECT_EQ(kExpected.size(), i);
+  EXPECT_FALSE(cursor.Next(&event));
+}
+
+TEST(DicomCursorTest, Files) {
+  namespace bfs = boost::filesystem;
+
+  for (bfs::directory_iterator it(g_data_dir), end; it != end; ++it) {
+    if (it->path().extension() != ".dcm") {
+      continue;
+    }
+
+    dcm::DicomFile dicom_file(it->path());
+    ASSERT_TRUE(dicom_file.Load());
+
+    dcm::DicomCursor cursor;
+    ASSERT_TRUE(cursor.OpenFile(it->path()));
+
+    std::size_t count = 0;
+
+    dcm::DicomCursor::Event event;
+    while (cursor.Next(&event)) {
+      ASSERT_EQ(dcm::DicomCursor::Event::ELEMENT, event.type);
+
+      std::unique_ptr<dcm::DataElement> element(cursor.ReadElement());
+      ASSERT_TRUE(element != nullptr);
+
+      const dcm::DataElement* expected = dicom_file.At(count);
+      EXPECT_EQ(expected->tag(), element->tag());
+      EXPECT_EQ(expected->length(), event.length);
+
+      const dcm::Buffer& expected_buffer = expected->buffer();
+      const dcm::Buffer& buffer = element->buffer();
+      EXPECT_EQ(std::string(expected_buffer.data(), expected_buffer.size()),
+                std::string(buffer.data(), buffer.size()));
+
+      ++count;
+    }
+
+    EXPECT_EQ(dicom_file.size(), count) << it->path().string();
+    EXPECT_EQ(dicom_file.vr_type(), cursor.vr_type());
+    EXPECT_EQ(dicom_file.byte_order(), cursor.byte_order());
+  }
+}
+
+TEST(DicomCursorTest, SelectiveRead) {
+  dcm::Path path(g_data_dir);
+  path /= "Explicit Little (CT-MONO2-16-brain).dcm";
+
+  dcm::DicomCursor cursor;
+  ASSERT_TRUE(cursor.MapFile(path));
+
+  std::string modality;
+
+  dcm::DicomCursor::Event event;
+  while (cursor.Next(&event)) {
+    // Values of the others are skipped.
+    if (event.tag == dcm::tags::kModality) {
+      std::unique_ptr<dcm::DataElement> element(cursor.ReadElement());
+      ASSERT_TRUE(element != nullptr);
+      element->GetString(&modality);
+      break;
+    }
+  }
+
+  EXPECT_EQ("CT", modality);
+}
@@ -1,5 +1,12 @@
 #include "gtest/gtest.h"
 
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "boost/filesystem.hpp"
+
+#include "dcm/arena.h"
 #include "dcm/dicom_file.h"
 
 extern std::string g_data_dir;
@@ -202,3 +209,286 @@ TEST(DicomFileTest, ImplicitLittle_CS_CR7600) {
     EXPECT_EQ("0.019973", values[1]);
   }
 }
+
+TEST(DicomFileTest, ExplicitBig_MapFile) {
+  dcm::Path path(g_data_dir);
+  path /= "Explicit Big (US-RGB-8-epicard).dcm";
+
+  dcm::DicomFile dicom_file(path);
+
+  dcm::LoadOptions options;
+  options.map_file = true;
+
+  bool ok = dicom_file.Load(options);
+  EXPECT_TRUE(ok);
+
+  EXPECT_EQ(dcm::ByteOrder::BE, dicom_file.byte_order());
+  EXPECT_EQ(dcm::VR::EXPLICIT, dicom_file.vr_type());
+
+  std::string sop_instance_uid;
+  dicom_file.GetString(dcm::tags::kSOPInstanceUID, &sop_instance_uid);
+  EXPECT_EQ("1.2.840.1136190195280574824680000700.3.0.1.19970424140438",
+            sop_instance_uid);
+
+  // The pixel data refers to the mapped bytes.
+  const dcm::DataElement* pixel_data = dicom_file.Get(dcm::tags::kPixelData);
+  ASSERT_TRUE(pixel_data != nullptr);
+  EXPECT_TRUE(pixel_data->buffer().IsView());
+  EXPECT_EQ(921600, pixel_data->buffer().size());
+
+  // Same values as reading through a stream.
+  dcm::DicomFile dicom_file2(path);
+  EXPECT_TRUE(dicom_file2.Load());
+
+  const dcm::DataElement* pixel_data2 = dicom_file2.Get(dcm::tags::kPixelData);
+  ASSERT_TRUE(pixel_data2 != nullptr);
+  EXPECT_FALSE(pixel_data2->buffer().IsView());
+  EXPECT_EQ(0, std::memcmp(pixel_data->buffer().data(),
+                           pixel_data2->buffer().data(), 921600));
+}
+
+TEST(DicomFileTest, HeaderOnly) {
+  dcm::Path path(g_data_dir);
+  path /= "Explicit Little (CT-MONO2-16-brain).dcm";
+
+  dcm::DicomFile full_file(path);
+  EXPECT_TRUE(full_file.Load());
+
+  const dcm::DataElement* pixel_data = full_file.Get(dcm::tags::kPixelData);
+  ASSERT_TRUE(pixel_data != nullptr);
+
+  dcm::LoadOptions options;
+  options.header_only = true;
+
+  dcm::DicomFile dicom_file(path);
+  EXPECT_TRUE(dicom_file.Load(options));
+
+  EXPECT_EQ(full_file.size() - 1, dicom_file.size());
+  EXPECT_EQ(nullptr, dicom_file.Get(dcm::tags::kPixelData));
+  EXPECT_EQ("CT", dicom_file.GetString(dcm::tags::kModality));
+
+  const dcm::PixelDataInfo& info = dicom_file.pixel_data_info();
+  EXPECT_TRUE(info.found());
+  EXPECT_FALSE(info.encapsulated);
+  EXPECT_EQ(dcm::VR::OW, info.vr);
+  EXPECT_EQ(pixel_data->length(), info.length);
+
+  // The pixel data is at the end of the file.
+  EXPECT_EQ(525968 - 524288, info.offset);
+
+  dcm::Buffer buffer;
+  EXPECT_TRUE(dicom_file.ReadPixelData(&buffer));
+  ASSERT_EQ(pixel_data->buffer().size(), buffer.size());
+  EXPECT_EQ(0, std::memcmp(pixel_data->buffer().data(), buffer.data(),
+                           buffer.size()));
+}
+
+TEST(DicomFileTest, HeaderOnly_Encapsulated) {
+  dcm::Path path(g_data_dir);
+  path /= "JPEG_70 (CT-MONO2-16-chest).dcm";
+
+  dcm::LoadOptions options;
+  options.header_only = true;
+
+  dcm::DicomFile dicom_file(path);
+  EXPECT_TRUE(dicom_file.Load(options));
+
+  EXPECT_EQ("CT", dicom_file.GetString(dcm::tags::kModality));
+
+  const dcm::PixelDataInfo& info = dicom_file.pixel_data_info();
+  EXPECT_TRUE(info.found());
+  EXPECT_TRUE(info.encapsulated);
+  EXPECT_EQ(dcm::VR::OB, info.vr);
+  EXPECT_EQ(dcm::kUndefinedLength, info.length);
+
+  dcm::Buffer buffer;
+  EXPECT_TRUE(dicom_file.ReadPixelData(&buffer));
+
+  // Items + sequence delimitation (8 bytes) up to the end of the file.
+  EXPECT_EQ(145136, info.offset + buffer.size() + 8);
+
+  // Starts with the item of Basic Offset Table.
+  ASSERT_GE(buffer.size(), 8);
+  EXPECT_EQ(0, std::memcmp("\xFE\xFF\x00\xE0", buffer.data(), 4));
+}
+
+TEST(DicomFileTest, LazyThreshold) {
+  dcm::Path path(g_data_dir);
+  path /= "Explicit Little (CT-MONO2-16-brain).dcm";
+
+  dcm::DicomFile full_file(path);
+  EXPECT_TRUE(full_file.Load());
+
+  dcm::LoadOptions options;
+  options.lazy_threshold = 4 * 1024;
+
+  dcm::DicomFile dicom_file(path);
+  EXPECT_TRUE(dicom_file.Load(options));
+
+  ASSERT_EQ(full_file.size(), dicom_file.size());
+
+  const dcm::DataElement* pixel_data = dicom_file.Get(dcm::tags::kPixelData);
+  ASSERT_TRUE(pixel_data != nullptr);
+
+  // Small values are read as usual.
+  EXPECT_FALSE(dicom_file.Get(dcm::tags::kModality)->IsLazy());
+  EXPECT_EQ("CT", dicom_file.GetString(dcm::tags::kModality));
+
+  EXPECT_TRUE(pixel_data->IsLazy());
+  EXPECT_EQ(524288, pixel_data->length());
+
+  // The length doesn't need the value.
+  EXPECT_EQ(full_file.Get(dcm::tags::kPixelData)->GetElementLength(
+                dcm::VR::EXPLICIT),
+            pixel_data->GetElementLength(dcm::VR::EXPLICIT));
+  EXPECT_TRUE(pixel_data->IsLazy());
+
+  // Read on the first access.
+  const dcm::Buffer& buffer = pixel_data->buffer();
+  EXPECT_FALSE(pixel_data->IsLazy());
+
+  const dcm::Buffer& expected = full_file.Get(dcm::tags::kPixelData)->buffer();
+  ASSERT_EQ(expected.size(), buffer.size());
+  EXPECT_EQ(0, std::memcmp(expected.data(), buffer.data(), buffer.size()));
+}
+
+// The lazy values are loaded once even if accessed by threads at the same time.
+TEST(DicomFileTest, LazyThreshold_Threads) {
+  dcm::Path path(g_data_dir);
+  path /= "Explicit Little (CT-MONO2-16-brain).dcm";
+
+  dcm::DicomFile full_file(path);
+  EXPECT_TRUE(full_file.Load());
+
+  dcm::LoadOptions options;
+  options.lazy_threshold = 4 * 1024;
+
+  dcm::DicomFile dicom_file(path);
+  EXPECT_TRUE(dicom_file.Load(options));
+
+  const dcm::DataElement* pixel_data = dicom_file.Get(dcm::tags::kPixelData);
+  ASSERT_TRUE(pixel_data != nullptr);
+  EXPECT_TRUE(pixel_data->IsLazy());
+
+  const std::size_t kThreadCount = 4;
+
+  std::vector<const char*> datas(kThreadCount, nullptr);
+  std::vector<std::thread> threads;
+
+  for (std::size_t i = 0; i < kThreadCount; ++i) {
+    threads.emplace_back([pixel_data, &datas, i]() {
+      datas[i] = pixel_data->buffer().data();
+    });
+  }
+
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_FALSE(pixel_data->IsLazy());
+
+  // All got the same buffer.
+  for (std::size_t i = 1; i < kThreadCount; ++i) {
+    EXPECT_EQ(datas[0], datas[i]);
+  }
+
+  const dcm::Buffer& expected = full_file.Get(dcm::tags::kPixelData)->buffer();
+  const dcm::Buffer& buffer = pixel_data->buffer();
+  ASSERT_EQ(expected.size(), buffer.size());
+  EXPECT_EQ(0, std::memcmp(expected.data(), buffer.data(), buffer.size()));
+}
+
+TEST(DicomFileTest, UseArena) {
+  dcm::Path path(g_data_dir);
+  path /= "Explicit Little (CT-MONO2-16-brain).dcm";
+
+  dcm::DicomFile full_file(path);
+  EXPECT_TRUE(full_file.Load());
+
+  dcm::LoadOptions options;
+  options.use_arena = true;
+
+  dcm::Buffer pixel_data;
+
+  {
+    dcm::DicomFile dicom_file(path);
+    EXPECT_TRUE(dicom_file.Load(options));
+    ASSERT_TRUE(dicom_file.arena() != nullptr);
+
+    ASSERT_EQ(full_file.size(), dicom_file.size());
+
+    for (std::size_t i = 0; i < dicom_file.size(); ++i) {
+      const dcm::DataElement* element = dicom_file.At(i);
+      EXPECT_TRUE(dicom_file.arena()->Owns(element));
+
+      const dcm::Buffer& expected = full_file.At(i)->buffer();
+      const dcm::Buffer& buffer = element->buffer();
+      ASSERT_EQ(expected.size(), buffer.size());
+      EXPECT_EQ(0, std::memcmp(expected.data(), buffer.data(), buffer.size()));
+    }
+
+    EXPECT_EQ("CT", dicom_file.GetString(dcm::tags::kModality));
+
+    // Large values refer to the arena.
+    pixel_data = dicom_file.Get(dcm::tags::kPixelData)->buffer();
+    EXPECT_TRUE(pixel_data.IsView());
+  }
+
+  // The arena is kept alive by the buffer.
+  const dcm::Buffer& expected = full_file.Get(dcm::tags::kPixelData)->buffer();
+  ASSERT_EQ(expected.size(), pixel_data.size());
+  EXPECT_EQ(0, std::memcmp(expected.data(), pixel_data.data(),
+                           pixel_data.size()));
+}
+
+TEST(DicomFileTest, SetTransferSyntax) {
+  dcm::Path path(g_data_dir);
+  path /= "Explicit Little (CT-MONO2-16-brain).dcm";
+
+  dcm::DicomFile full_file(path);
+  EXPECT_TRUE(full_file.Load());
+
+  dcm::LoadOptions options;
+  options.lazy_threshold = 4 * 1024;
+
+  dcm::DicomFile dicom_file(path);
+  EXPECT_TRUE(dicom_file.Load(options));
+
+  EXPECT_TRUE(dicom_file.SetTransferSyntax(
+      dcm::transfer_syntax_uids::kExplicitBigEndian));
+  EXPECT_EQ(dcm::ByteOrder::BE, dicom_file.byte_order());
+
+  // The pixel data is neither read nor swapped.
+  const dcm::DataElement* pixel_data = dicom_file.Get(dcm::tags::kPixelData);
+  ASSERT_TRUE(pixel_data != nullptr);
+  EXPECT_TRUE(pixel_data->IsLazy());
+  EXPECT_EQ(dcm::ByteOrder::BE, pixel_data->byte_order());
+  EXPECT_EQ(dcm::ByteOrder::LE, pixel_data->value_byte_order());
+
+  // Swapped while writing.
+  dcm::Path new_path = boost::filesystem::temp_directory_path() /
+                       boost::filesystem::unique_path("%%%%-%%%%.dcm");
+  EXPECT_TRUE(dicom_file.Save(new_path));
+  EXPECT_EQ(dcm::ByteOrder::LE, pixel_data->value_byte_order());
+
+  dcm::DicomFile new_file(new_path);
+  EXPECT_TRUE(new_file.Load());
+  boost::filesystem::remove(new_path);
+
+  EXPECT_EQ(dcm::ByteOrder::BE, new_file.byte_order());
+
+  std::uint16_t expected_rows = 0;
+  EXPECT_TRUE(full_file.GetUint16(dcm::tags::kRows, &expected_rows));
+
+  std::uint16_t rows = 0;
+  EXPECT_TRUE(new_file.GetUint16(dcm::tags::kRows, &rows));
+  EXPECT_EQ(expected_rows, rows);
+
+  const dcm::Buffer& expected = full_file.Get(dcm::tags::kPixelData)->buffer();
+  const dcm::Buffer& buffer = new_file.Get(dcm::tags::kPixelData)->buffer();
+  ASSERT_EQ(expected.size(), buffer.size());
+  for (std::size_t i = 0; i < buffer.size(); i += 2) {
+    ASSERT_EQ(expected.data()[i], buffer.data()[i + 1]) << i;
+    ASSERT_EQ(expected.data()[i + 1], buffer.data()[i]) << i;
+  }
+}
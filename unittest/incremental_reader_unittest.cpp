@@ -0,0 +1,334 @@
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "boost/filesystem.hpp"
+
+#include "dcm/data_element.h"
+#include "dcm/data_sequence.h"
+#include "dcm/dicom_file.h"
+#include "dcm/dicom_reader.h"
+#include "dcm/incremental_reader.h"
+#include "dcm/read_handler.h"
+
+extern std::string g_data_dir;
+
+namespace {
+
+// A read handler which records the events as strings.
+class RecordReadHandler : public dcm::ReadHandler {
+public:
+  explicit RecordReadHandler(std::size_t max_elements = 0)
+      : max_elements_(max_elements), elements_(0) {
+  }
+
+  const std::vector<std::string>& events() const { return events_; }
+
+  void OnTransferSyntax(dcm::VR::Type vr_type,
+                        dcm::ByteOrder byte_order) override {
+    std::ostringstream oss;
+    oss << "TS " << vr_type << " " << static_cast<int>(byte_order);
+    events_.push_back(oss.str());
+  }
+
+  bool OnElementStart(dcm::Tag) override {
+    return true;
+  }
+
+  void OnElementEnd(dcm::DataElement* data_element) override {
+    const dcm::Buffer& buffer = data_element->buffer();
+
+    std::ostringstream oss;
+    oss << "E " << data_element->tag().ToUint32() << " "
+        << data_element->vr().byte1() << data_element->vr().byte2() << " "
+        << data_element->length() << " "
+        << std::string(buffer.data(), buffer.size());
+    events_.push_back(oss.str());
+
+    delete data_element;
+
+    if (max_elements_ > 0 && ++elements_ >= max_elements_) {
+      should_stop_ = true;
+    }
+  }
+
+  void OnSequenceStart(dcm::DataSequence* data_sequence) override {
+    std::ostringstream oss;
+    oss << "SQ " << data_sequence->tag().ToUint32() << " "
+        << data_sequence->length();
+    events_.push_back(oss.str());
+    delete data_sequence;
+  }
+
+  void OnSequenceEnd(bool delimited) override {
+    events_.push_back(delimited ? "SQ END (DELIM)" : "SQ END");
+  }
+
+  void OnSequenceItemStart(std::uint32_t length) override {
+    std::ostringstream oss;
+    oss << "ITEM " << length;
+    events_.push_back(oss.str());
+  }
+
+  void OnSequenceItemEnd(bool delimited) override {
+    events_.push_back(delimited ? "ITEM END (DELIM)" : "ITEM END");
+  }
+
+private:
+  std::size_t max_elements_;
+  std::size_t elements_;
+  std::vector<std::string> events_;
+};
+
+// A read handler which receives the values larger than 4 KiB in chunks.
+class ChunkReadHandler : public RecordReadHandler {
+public:
+  ChunkReadHandler()
+      : max_chunk_size_(0), last_count_(0), valueless_count_(0) {
+    data_chunk_size_ = 4096;
+  }
+
+  const std::string& data() const { return data_; }
+  std::size_t max_chunk_size() const { return max_chunk_size_; }
+  std::size_t last_count() const { return last_count_; }
+  std::size_t valueless_count() const { return valueless_count_; }
+
+  void OnElementEnd(dcm::DataElement* data_element) override {
+    if (data_element->IsValueless()) {
+      ++valueless_count_;
+    }
+    RecordReadHandler::OnElementEnd(data_element);
+  }
+
+  void OnElementData(const char* chunk, std::size_t n, bool last) override {
+    data_.append(chunk, n);
+    max_chunk_size_ = std::max(max_chunk_size_, n);
+    if (last) {
+      ++last_count_;
+    }
+  }
+
+private:
+  std::string data_;
+  std::size_t max_chunk_size_;
+  std::size_t last_count_;
+  std::size_t valueless_count_;
+};
+
+std::string ReadFileBytes(const dcm::Path& path) {
+  std::ifstream file(path.string(), std::ios::binary);
+  return std::string(std::istreambuf_iterator<char>(file),
+                     std::istreambuf_iterator<char>());
+}
+
+std::vector<std::string> ReadAll(const std::string& bytes,
+                                 std::size_t max_elements = 0) {
+  RecordReadHandler handler(max_elements);
+  dcm::DicomReader reader(&handler);
+  reader.ReadBuffer(bytes.data(), bytes.size());
+  return handler.events();
+}
+
+std::vector<std::string> FeedAll(const std::string& bytes,
+                                 std::size_t chunk_size,
+                                 std::size_t max_elements = 0) {
+  RecordReadHandler handler(max_elements);
+  dcm::IncrementalReader reader(&handler);
+
+  for (std::size_t pos = 0; pos < bytes.size(); pos += chunk_size) {
+    std::size_t n = std::min(chunk_size, bytes.size() - pos);
+    reader.Feed(bytes.data() + pos, n);
+  }
+
+  EXPECT_TRUE(reader.Finish());
+  EXPECT_TRUE(reader.done());
+
+  return handler.events();
+}
+
+// Append an Explicit VR Little Endian element header.
+void AppendHeader(std::string* bytes, std::uint16_t group,
+                  std::uint16_t element, const char* vr, std::uint32_t length) {
+  bytes->push_back(static_cast<char>(group & 0xFF));
+  bytes->push_back(static_cast<char>(group >> 8));
+  bytes->push_back(static_cast<char>(element & 0xFF));
+  bytes->push_back(static_cast<char>(element >> 8));
+
+  if (vr == nullptr) {
+    // Item or delimitation, 4-byte length.
+  } else {
+    bytes->append(vr, 2);
+    if (std::string(vr) == "SQ" || std::string(vr) == "OB") {
+      bytes->append(2, '\0');
+    } else {
+      bytes->push_back(static_cast<char>(length & 0xFF));
+      bytes->push_back(static_cast<char>(length >> 8));
+      return;
+    }
+  }
+
+  for (int i = 0; i < 4; ++i) {
+    bytes->push_back(static_cast<char>((length >> (i * 8)) & 0xFF));
+  }
+}
+
+// A data set (without meta info) in Explicit VR Little Endian, with nested
+// sequences of both defined and undefined length.
+std::string MakeSequenceBytes() {
+  std::string bytes(128, '\0');
+  bytes += "DICM";
+
+  AppendHeader(&bytes, 0x0008, 0x0060, "CS", 2);
+  bytes += "CT";
+
+  // Sequence of undefined length.
+  AppendHeader(&bytes, 0x0008, 0x1140, "SQ", dcm::kUndefinedLength);
+  {
+    // Item of undefined length.
+    AppendHeader(&bytes, 0xFFFE, 0xE000, nullptr, dcm::kUndefinedLength);
+    AppendHeader(&bytes, 0x0008, 0x1150, "UI", 4);
+    bytes += "1.2";
+    bytes.push_back('\0');
+    AppendHeader(&bytes, 0xFFFE, 0xE00D, nullptr, 0);
+
+    // Item of defined length with a nested sequence of defined length.
+    AppendHeader(&bytes, 0xFFFE, 0xE000, nullptr, 12 + 8 + 10);
+    AppendHeader(&bytes, 0x0040, 0xA730, "SQ", 8 + 10);
+    {
+      AppendHeader(&bytes, 0xFFFE, 0xE000, nullptr, 10);
+      AppendHeader(&bytes, 0x0008, 0x0100, "SH", 2);
+      bytes += "AB";
+    }
+  }
+  AppendHeader(&bytes, 0xFFFE, 0xE0DD, nullptr, 0);
+
+  // Empty sequence.
+  AppendHeader(&bytes, 0x0008, 0x1110, "SQ", 0);
+
+  AppendHeader(&bytes, 0x0010, 0x0010, "PN", 4);
+  bytes += "Ab^C";
+
+  return bytes;
+}
+
+}  // namespace
+
+TEST(IncrementalReaderTest, Sequences) {
+  const std::string bytes = MakeSequenceBytes();
+
+  auto expected = ReadAll(bytes);
+
+  const std::vector<std::string> kEvents = {
+    "SQ 528704 4294967295",
+    "ITEM 4294967295",
+    "ITEM END (DELIM)",
+    "ITEM 30",
+    "SQ 4237104 18",
+    "ITEM 10",
+    "ITEM END",
+    "SQ END",
+    "ITEM END",
+    "SQ END (DELIM)",
+    "SQ 528656 0",
+    "SQ END",
+  };
+
+  // Check the sequence events only, the order matters.
+  std::vector<std::string> sequence_events;
+  for (const std::string& event : expected) {
+    if (event[0] != 'E' && event[0] != 'T') {
+      sequence_events.push_back(event);
+    }
+  }
+  EXPECT_EQ(kEvents, sequence_events);
+
+  for (std::size_t chunk_size : { 1, 2, 3, 7, 64, 1000 }) {
+    EXPECT_EQ(expected, FeedAll(bytes, chunk_size)) << chunk_size;
+  }
+}
+
+TEST(IncrementalReaderTest, Files) {
+  namespace bfs = boost::filesystem;
+
+  std::size_t count = 0;
+
+  for (bfs::directory_iterator it(g_data_dir), end; it != end; ++it) {
+    if (it->path().extension() != ".dcm") {
+      continue;
+    }
+
+    const std::string bytes = ReadFileBytes(it->path());
+
+    auto expected = ReadAll(bytes);
+    ASSERT_FALSE(expected.empty());
+
+    for (std::size_t chunk_size : { 1, 7, 1000, 64 * 1024 }) {
+      EXPECT_EQ(expected, FeedAll(bytes, chunk_size))
+          << it->path().string() << " " << chunk_size;
+    }
+
+    ++count;
+  }
+
+  EXPECT_GT(count, 0);
+}
+
+TEST(IncrementalReaderTest, Stop) {
+  const dcm::Path path(g_data_dir + "/Explicit Little (CT-MONO2-16-brain).dcm");
+  const std::string bytes = ReadFileBytes(path);
+
+  auto expected = ReadAll(bytes, 5);
+  auto actual = FeedAll(bytes, 3, 5);
+
+  EXPECT_EQ(expected, actual);
+  EXPECT_EQ(5, actual.size());
+}
+
+TEST(IncrementalReaderTest, Truncated) {
+  const dcm::Path path(g_data_dir + "/Explicit Little (CT-MONO2-16-brain).dcm");
+  const std::string bytes = ReadFileBytes(path).substr(0, 1000);
+
+  EXPECT_EQ(ReadAll(bytes), FeedAll(bytes, 7));
+}
+
+TEST(IncrementalReaderTest, NotDicom) {
+  RecordReadHandler handler;
+  dcm::IncrementalReader reader(&handler);
+
+  reader.Feed("DICM", 4);
+
+  EXPECT_FALSE(reader.Finish());
+  EXPECT_TRUE(handler.events().empty());
+}
+
+TEST(IncrementalReaderTest, ElementData) {
+  const dcm::Path path(g_data_dir + "/Explicit Little (CT-MONO2-16-brain).dcm");
+  const std::string bytes = ReadFileBytes(path);
+
+  dcm::DicomFile dicom_file(path);
+  ASSERT_TRUE(dicom_file.Load());
+
+  const dcm::Buffer& expected =
+      dicom_file.Get(dcm::tags::kPixelData)->buffer();
+
+  for (std::size_t chunk_size : { 7, 1000, 64 * 1024 }) {
+    ChunkReadHandler handler;
+    dcm::IncrementalReader reader(&handler);
+
+    for (std::size_t pos = 0; pos < bytes.size(); pos += chunk_size) {
+      std::size_t n = std::min(chunk_size, bytes.size() - pos);
+      reader.Feed(bytes.data() + pos, n);
+    }
+    EXPECT_TRUE(reader.Finish());
+
+    EXPECT_EQ(1, handler.last_count());
+    EXPECT_EQ(1, handler.valueless_count());
+    EXPECT_LE(handler.max_chunk_size(), 4096);
+    EXPECT_EQ(std::string(expected.data(), expected.size()), handler.data());
+  }
+}
@@ -0,0 +1,759 @@
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "dcm/arena.h"
+#include "dcm/block_reader.h"
+#include "dcm/data_dict.h"
+#include "dcm/data_sequence.h"
+#include "dcm/data_set.h"
+#include "dcm/dicom_cursor.h"
+#include "dcm/dicom_file.h"
+#include "dcm/dicom_reader.h"
+#include "dcm/full_read_handler.h"
+#include "dcm/incremental_reader.h"
+#include "dcm/write_visitor.h"
+#include "dcm/writer.h"
+
+extern std::string g_data_dir;
+
+namespace {
+
+// A stream buffer which can't seek, like a pipe or a socket.
+class ForwardOnlyBuf : public std::streambuf {
+public:
+  explicit ForwardOnlyBuf(const std::string& bytes) : bytes_(bytes), pos_(0) {
+  }
+
+protected:
+  int_type underflow() override {
+    if (pos_ >= bytes_.size()) {
+      return traits_type::eof();
+    }
+
+    // Hand out at most 10 bytes a time.
+    std::size_t n = std::min<std::size_t>(10, bytes_.size() - pos_);
+    chunk_.assign(bytes_, pos_, n);
+    pos_ += n;
+
+    char* p = &chunk_[0];
+    setg(p, p, p + n);
+    return traits_type::to_int_type(*p);
+  }
+
+private:
+  std::string bytes_;
+  std::size_t pos_;
+  std::string chunk_;
+};
+
+std::string ReadFileBytes(const dcm::Path& path) {
+  std::ifstream file(path.string(), std::ios::binary);
+  return std::string(std::istreambuf_iterator<char>(file),
+                     std::istreambuf_iterator<char>());
+}
+
+// A read handler which receives the values larger than 4 KiB in chunks.
+class ChunkReadHandler : public dcm::FullReadHandler {
+public:
+  explicit ChunkReadHandler(dcm::DataSet* data_set)
+      : dcm::FullReadHandler(data_set), max_chunk_size_(0), last_count_(0) {
+    data_chunk_size_ = 4096;
+  }
+
+  const std::string& data() const { return data_; }
+  std::size_t max_chunk_size() const { return max_chunk_size_; }
+  std::size_t last_count() const { return last_count_; }
+
+  void OnElementData(const char* chunk, std::size_t n, bool last) override {
+    data_.append(chunk, n);
+    max_chunk_size_ = std::max(max_chunk_size_, n);
+    if (last) {
+      ++last_count_;
+    }
+  }
+
+private:
+  std::string data_;
+  std::size_t max_chunk_size_;
+  std::size_t last_count_;
+};
+
+// A read handler which counts the sequences and items.
+class CountReadHandler : public dcm::ReadHandler {
+public:
+  int sequences = 0;
+  int open_sequences = 0;
+  int open_items = 0;
+
+  void OnTransferSyntax(dcm::VR::Type, dcm::ByteOrder) override {
+  }
+
+  bool OnElementStart(dcm::Tag) override {
+    return true;
+  }
+
+  void OnElementEnd(dcm::DataElement* data_element) override {
+    delete data_element;
+  }
+
+  void OnSequenceStart(dcm::DataSequence* data_sequence) override {
+    ++sequences;
+    ++open_sequences;
+    delete data_sequence;
+  }
+
+  void OnSequenceEnd(bool /*delimited*/) override {
+    --open_sequences;
+  }
+
+  void OnSequenceItemStart(std::uint32_t /*length*/) override {
+    ++open_items;
+  }
+
+  void OnSequenceItemEnd(bool /*delimited*/) override {
+    --open_items;
+  }
+};
+
+// Explicit VR Little Endian data set of nested sequences, each of undefined
+// length and with one item of undefined length.
+std::string MakeNestedSequences(std::size_t depth) {
+  const char kSequence[] = "\x40\x00\x30\xA7SQ\0\0\xFF\xFF\xFF\xFF";
+  const char kItem[] = "\xFE\xFF\x00\xE0\xFF\xFF\xFF\xFF";
+  const char kItemDelim[] = "\xFE\xFF\x0D\xE0\0\0\0\0";
+  const char kSeqDelim[] = "\xFE\xFF\xDD\xE0\0\0\0\0";
+
+  std::string bytes(128, '\0');
+  bytes += "DICM";
+
+  for (std::size_t i = 0; i < depth; ++i) {
+    bytes.append(kSequence, 12);
+    bytes.append(kItem, 8);
+  }
+  for (std::size_t i = 0; i < depth; ++i) {
+    bytes.append(kItemDelim, 8);
+    bytes.append(kSeqDelim, 8);
+  }
+  return bytes;
+}
+
+// Append an Explicit VR Little Endian data element with a short VR.
+void AppendElement(std::string* bytes, std::uint16_t group,
+                   std::uint16_t element, const char* vr,
+                   const std::string& value) {
+  const char header[] = {
+    static_cast<char>(group & 0xFF), static_cast<char>(group >> 8),
+    static_cast<char>(element & 0xFF), static_cast<char>(element >> 8),
+    vr[0], vr[1],
+    static_cast<char>(value.size() & 0xFF), static_cast<char>(value.size() >> 8)
+  };
+  bytes->append(header, sizeof(header));
+  bytes->append(value);
+}
+
+// Append an Implicit VR Little Endian data element.
+void AppendImplicitElement(std::string* bytes, std::uint16_t group,
+                           std::uint16_t element, const std::string& value) {
+  const char header[] = {
+    static_cast<char>(group & 0xFF), static_cast<char>(group >> 8),
+    static_cast<char>(element & 0xFF), static_cast<char>(element >> 8),
+    static_cast<char>(value.size() & 0xFF),
+    static_cast<char>(value.size() >> 8), 0, 0
+  };
+  bytes->append(header, sizeof(header));
+  bytes->append(value);
+}
+
+// "0123456789abcdefghij..."
+std::string MakeBytes(std::size_t size) {
+  const char kChars[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+  std::string bytes(size, '\0');
+  for (std::size_t i = 0; i < size; ++i) {
+    bytes[i] = kChars[i % (sizeof(kChars) - 1)];
+  }
+  return bytes;
+}
+
+}  // namespace
+
+TEST(BlockReaderTest, ReadAcrossBlocks) {
+  const std::string bytes = MakeBytes(100);
+  std::istringstream stream(bytes);
+
+  dcm::BlockReader reader(&stream, 8);
+
+  std::string read(100, '\0');
+  std::size_t pos = 0;
+
+  // Read in different sizes, crossing the block boundaries.
+  for (std::size_t count : { 2, 4, 3, 7, 20, 1, 5 }) {
+    EXPECT_EQ(count, reader.ReadBytes(&read[pos], count));
+    pos += count;
+  }
+
+  EXPECT_EQ(bytes.substr(0, pos), read.substr(0, pos));
+
+  // Read the rest, less than requested.
+  EXPECT_EQ(100 - pos, reader.ReadBytes(&read[pos], 100));
+  EXPECT_EQ(bytes, read);
+
+  char c = 0;
+  EXPECT_EQ(0, reader.ReadBytes(&c, 1));
+}
+
+TEST(BlockReaderTest, SeekAndUndoRead) {
+  const std::string bytes = MakeBytes(100);
+  std::istringstream stream(bytes);
+
+  dcm::BlockReader reader(&stream, 8);
+
+  char buf[4] = { 0 };
+
+  reader.Seek(30);
+  EXPECT_EQ(4, reader.ReadBytes(buf, 4));
+  EXPECT_EQ(bytes.substr(30, 4), std::string(buf, 4));
+
+  // Within the window.
+  reader.UndoRead(4);
+  EXPECT_EQ(4, reader.ReadBytes(buf, 4));
+  EXPECT_EQ(bytes.substr(30, 4), std::string(buf, 4));
+
+  // Before the window.
+  reader.UndoRead(20);
+  EXPECT_EQ(4, reader.ReadBytes(buf, 4));
+  EXPECT_EQ(bytes.substr(14, 4), std::string(buf, 4));
+
+  // Forward beyond the window.
+  reader.Seek(50, std::ios::cur);
+  EXPECT_EQ(4, reader.ReadBytes(buf, 4));
+  EXPECT_EQ(bytes.substr(68, 4), std::string(buf, 4));
+
+  // Seek after reaching the end.
+  char rest[40];
+  EXPECT_EQ(28, reader.ReadBytes(rest, 40));
+  reader.Seek(0);
+  EXPECT_EQ(4, reader.ReadBytes(buf, 4));
+  EXPECT_EQ(bytes.substr(0, 4), std::string(buf, 4));
+}
+
+TEST(BlockReaderTest, NonSeekable) {
+  const std::string bytes = MakeBytes(1000);
+  ForwardOnlyBuf buf(bytes);
+  std::istream stream(&buf);
+
+  dcm::BlockReader reader(&stream, 8);
+  EXPECT_FALSE(reader.seekable());
+
+  char buf4[4] = { 0 };
+
+  // Skip forward by reading.
+  reader.Seek(128, std::ios::cur);
+  EXPECT_EQ(4, reader.ReadBytes(buf4, 4));
+  EXPECT_EQ(bytes.substr(128, 4), std::string(buf4, 4));
+
+  // Look back across several refills.
+  reader.UndoRead(132);
+  EXPECT_EQ(4, reader.ReadBytes(buf4, 4));
+  EXPECT_EQ(bytes.substr(0, 4), std::string(buf4, 4));
+
+  reader.Seek(600);
+  EXPECT_EQ(4, reader.ReadBytes(buf4, 4));
+  EXPECT_EQ(bytes.substr(600, 4), std::string(buf4, 4));
+  EXPECT_TRUE(reader.IsOk());
+
+  // Beyond the look-back window.
+  reader.Seek(100);
+  EXPECT_FALSE(reader.IsOk());
+  EXPECT_EQ(0, reader.ReadBytes(buf4, 4));
+}
+
+TEST(DicomReaderTest, ReadStream_NonSeekable) {
+  const char* kFiles[] = {
+    "Explicit Big (US-RGB-8-epicard).dcm",
+    "Implicit Little NoMeta (CR-MONO1-10-chest).dcm",
+  };
+
+  for (const char* file : kFiles) {
+    dcm::Path path(g_data_dir);
+    path /= file;
+
+    dcm::DataSet data_set;
+    dcm::FullReadHandler read_handler(&data_set);
+    dcm::DicomReader reader(&read_handler);
+    EXPECT_TRUE(reader.ReadFile(path));
+
+    ForwardOnlyBuf buf(ReadFileBytes(path));
+    std::istream stream(&buf);
+
+    dcm::DataSet data_set2;
+    dcm::FullReadHandler read_handler2(&data_set2);
+    dcm::DicomReader reader2(&read_handler2);
+    EXPECT_TRUE(reader2.ReadStream(&stream));
+
+    EXPECT_EQ(data_set.vr_type(), data_set2.vr_type());
+    EXPECT_EQ(data_set.byte_order(), data_set2.byte_order());
+
+    ASSERT_EQ(data_set.size(), data_set2.size());
+    for (std::size_t i = 0; i < data_set.size(); ++i) {
+      EXPECT_EQ(data_set[i]->tag(), data_set2[i]->tag());
+      EXPECT_EQ(data_set[i]->length(), data_set2[i]->length());
+    }
+
+    EXPECT_EQ(data_set.GetString(dcm::tags::kSOPInstanceUID),
+              data_set2.GetString(dcm::tags::kSOPInstanceUID));
+  }
+}
+
+TEST(DicomReaderTest, ReadBuffer) {
+  dcm::Path path(g_data_dir);
+  path /= "Explicit Little (CT-MONO2-16-brain).dcm";
+
+  auto bytes = std::make_shared<std::string>(ReadFileBytes(path));
+
+  // Copy the values.
+  {
+    dcm::DataSet data_set;
+    dcm::FullReadHandler read_handler(&data_set);
+    dcm::DicomReader reader(&read_handler);
+    EXPECT_TRUE(reader.ReadBuffer(bytes->data(), bytes->size()));
+
+    const dcm::DataElement* pixel_data = data_set.Get(dcm::tags::kPixelData);
+    ASSERT_TRUE(pixel_data != nullptr);
+    EXPECT_FALSE(pixel_data->buffer().IsView());
+    EXPECT_EQ(1, bytes.use_count());
+  }
+
+  // Refer to the bytes without copying.
+  {
+    dcm::DataSet data_set;
+    dcm::FullReadHandler read_handler(&data_set);
+    dcm::DicomReader reader(&read_handler);
+    EXPECT_TRUE(reader.ReadBuffer(bytes->data(), bytes->size(), bytes));
+
+    const dcm::DataElement* pixel_data = data_set.Get(dcm::tags::kPixelData);
+    ASSERT_TRUE(pixel_data != nullptr);
+    EXPECT_TRUE(pixel_data->buffer().IsView());
+    EXPECT_EQ(bytes->data() + bytes->size() - pixel_data->length(),
+              pixel_data->buffer().data());
+
+    EXPECT_EQ("CT", data_set.GetString(dcm::tags::kModality));
+
+    // The values share the ownership of the bytes.
+    EXPECT_LT(1, bytes.use_count());
+
+    data_set.Clear();
+    EXPECT_EQ(1, bytes.use_count());
+  }
+}
+
+TEST(DicomReaderTest, ElementData) {
+  dcm::Path path(g_data_dir);
+  path /= "Explicit Little (CT-MONO2-16-brain).dcm";
+
+  dcm::DicomFile dicom_file(path);
+  ASSERT_TRUE(dicom_file.Load());
+
+  dcm::DataSet data_set;
+  ChunkReadHandler read_handler(&data_set);
+  dcm::DicomReader reader(&read_handler);
+  EXPECT_TRUE(reader.ReadFile(path));
+
+  ASSERT_EQ(dicom_file.size(), data_set.size());
+
+  // Only the pixel data is large enough.
+  EXPECT_EQ(1, read_handler.last_count());
+  EXPECT_EQ(4096, read_handler.max_chunk_size());
+
+  const dcm::DataElement* pixel_data = data_set.Get(dcm::tags::kPixelData);
+  ASSERT_TRUE(pixel_data != nullptr);
+  EXPECT_EQ(524288, pixel_data->length());
+  EXPECT_TRUE(pixel_data->IsValueless());
+  EXPECT_TRUE(pixel_data->buffer().empty());
+
+  const dcm::Buffer& expected =
+      dicom_file.Get(dcm::tags::kPixelData)->buffer();
+  EXPECT_EQ(std::string(expected.data(), expected.size()), read_handler.data());
+
+  EXPECT_EQ("CT", data_set.GetString(dcm::tags::kModality));
+}
+
+// The element passed in chunks has no value to get or write.
+TEST(DicomReaderTest, ElementData_Valueless) {
+  std::string bytes(128, '\0');
+  bytes += "DICM";
+
+  AppendElement(&bytes, 0x0008, 0x0060, "CS", "CT");
+
+  // OW with the reserved 2 bytes and a 4-byte value length.
+  const std::uint32_t length = 8192;
+  bytes.append("\xE0\x7F\x10\x00OW\0\0", 8);
+  bytes.append(reinterpret_cast<const char*>(&length), 4);
+  bytes.append(MakeBytes(length));
+
+  dcm::DataSet data_set;
+  ChunkReadHandler read_handler(&data_set);
+  dcm::DicomReader reader(&read_handler);
+  EXPECT_TRUE(reader.ReadBuffer(bytes.data(), bytes.size()));
+
+  EXPECT_EQ(MakeBytes(length), read_handler.data());
+
+  const dcm::DataElement* pixel_data = data_set.Get(dcm::tags::kPixelData);
+  ASSERT_TRUE(pixel_data != nullptr);
+  EXPECT_TRUE(pixel_data->IsValueless());
+  EXPECT_EQ(length, pixel_data->length());
+  EXPECT_EQ(length + 12, pixel_data->GetElementLength(dcm::VR::EXPLICIT));
+
+  std::vector<std::uint16_t> values;
+  EXPECT_FALSE(data_set.GetUint16Array(dcm::tags::kPixelData, &values));
+
+  dcm::NumberView<std::uint16_t> view;
+  EXPECT_FALSE(pixel_data->GetUint16View(&view));
+
+  // The element is refused by the writer, instead of reading out of the
+  // empty buffer.
+  std::ostringstream stream;
+  dcm::Writer writer(&stream);
+  dcm::WriteVisitor write_visitor(&writer);
+  data_set.Accept(write_visitor);
+  EXPECT_FALSE(write_visitor.ok());
+
+  EXPECT_EQ("CT", data_set.GetString(dcm::tags::kModality));
+}
+
+TEST(DicomReaderTest, MaxDepth) {
+  const std::string bytes = MakeNestedSequences(100);
+
+  {
+    CountReadHandler read_handler;
+    dcm::DicomReader reader(&read_handler);
+
+    // Deeper than the default max depth.
+    EXPECT_FALSE(reader.ReadBuffer(bytes.data(), bytes.size()));
+
+    EXPECT_EQ(dcm::DicomReader::kDefaultMaxDepth, read_handler.sequences);
+    EXPECT_EQ(0, read_handler.open_sequences);
+    EXPECT_EQ(0, read_handler.open_items);
+  }
+
+  {
+    CountReadHandler read_handler;
+    dcm::DicomReader reader(&read_handler);
+    reader.set_max_depth(100);
+
+    EXPECT_TRUE(reader.ReadBuffer(bytes.data(), bytes.size()));
+
+    EXPECT_EQ(100, read_handler.sequences);
+    EXPECT_EQ(0, read_handler.open_sequences);
+    EXPECT_EQ(0, read_handler.open_items);
+  }
+}
+
+TEST(DicomReaderTest, SequenceItems) {
+  const std::string bytes = MakeNestedSequences(2);
+
+  dcm::DataSet data_set;
+  dcm::FullReadHandler read_handler(&data_set);
+  dcm::DicomReader reader(&read_handler);
+
+  ASSERT_TRUE(reader.ReadBuffer(bytes.data(), bytes.size()));
+  ASSERT_EQ(1, data_set.size());
+
+  auto sequence = dynamic_cast<const dcm::DataSequence*>(data_set.At(0));
+  ASSERT_TRUE(sequence != nullptr);
+  EXPECT_TRUE(sequence->delimited());
+  ASSERT_EQ(1, sequence->size());
+
+  const dcm::DataSequence::Item& item = sequence->At(0);
+  EXPECT_EQ(dcm::kUndefinedLength, item.length);
+  EXPECT_TRUE(item.delimited);
+  ASSERT_EQ(1, item.data_set->size());
+
+  auto child = dynamic_cast<const dcm::DataSequence*>(item.data_set->At(0));
+  ASSERT_TRUE(child != nullptr);
+  EXPECT_TRUE(child->delimited());
+  ASSERT_EQ(1, child->size());
+  EXPECT_EQ(0, child->At(0).data_set->size());
+
+  // Tag and length for each of the sequences, items and delimitations.
+  EXPECT_EQ(2 * (12 + 8 + 8 + 8),
+            sequence->GetElementLength(dcm::VR::EXPLICIT));
+}
+
+// Read files of different transfer syntaxes with the same reader.
+TEST(DicomReaderTest, Arena) {
+  const std::string bytes = MakeNestedSequences(3);
+
+  auto arena = std::make_shared<dcm::Arena>();
+
+  dcm::DataSet data_set;
+  data_set.set_arena(arena);
+
+  dcm::FullReadHandler read_handler(&data_set);
+  dcm::DicomReader reader(&read_handler);
+  reader.set_arena(arena);
+
+  ASSERT_TRUE(reader.ReadBuffer(bytes.data(), bytes.size()));
+
+  // The sequences and the data sets of the items are from the arena.
+  const dcm::DataSet* parent = &data_set;
+  for (int depth = 0; depth < 3; ++depth) {
+    ASSERT_EQ(1, parent->size());
+
+    auto sequence = dynamic_cast<const dcm::DataSequence*>(parent->At(0));
+    ASSERT_TRUE(sequence != nullptr);
+    EXPECT_TRUE(arena->Owns(sequence));
+    EXPECT_TRUE(sequence->from_arena());
+
+    ASSERT_EQ(1, sequence->size());
+    parent = sequence->At(0).data_set;
+    EXPECT_TRUE(arena->Owns(parent));
+    EXPECT_EQ(arena, parent->arena());
+  }
+  EXPECT_EQ(0, parent->size());
+
+  // Elements not from the arena are deleted as usual.
+  EXPECT_TRUE(data_set.SetString(dcm::tags::kModality, "CT"));
+  EXPECT_TRUE(arena->Owns(data_set.Get(dcm::tags::kModality)));
+  EXPECT_TRUE(data_set.Get(dcm::tags::kModality)->from_arena());
+  EXPECT_TRUE(data_set.Insert(new dcm::DataElement(dcm::tags::kRows)));
+  EXPECT_FALSE(arena->Owns(data_set.Get(dcm::tags::kRows)));
+  EXPECT_FALSE(data_set.Get(dcm::tags::kRows)->from_arena());
+
+  data_set.Clear();
+  EXPECT_EQ(1, arena->block_count());
+}
+
+TEST(DicomReaderTest, OutOfOrder) {
+  std::string bytes(128, '\0');
+  bytes += "DICM";
+
+  AppendElement(&bytes, 0x0010, 0x0020, "LO", "ID01");
+  AppendElement(&bytes, 0x0008, 0x0060, "CS", "CT");
+  AppendElement(&bytes, 0x0010, 0x0010, "PN", "DOE^J ");
+  AppendElement(&bytes, 0x0008, 0x0060, "CS", "MR");  // Duplicated
+
+  bytes.append("\x40\x00\x30\xA7SQ\0\0\xFF\xFF\xFF\xFF", 12);
+  bytes.append("\xFE\xFF\x00\xE0\xFF\xFF\xFF\xFF", 8);
+  AppendElement(&bytes, 0x0040, 0xA040, "CS", "TEXT");
+  AppendElement(&bytes, 0x0008, 0x0100, "SH", "CODE01");
+  bytes.append("\xFE\xFF\x0D\xE0\0\0\0\0", 8);
+  bytes.append("\xFE\xFF\xDD\xE0\0\0\0\0", 8);
+
+  dcm::DataSet data_set;
+  dcm::FullReadHandler read_handler(&data_set);
+  dcm::DicomReader reader(&read_handler);
+
+  ASSERT_TRUE(reader.ReadBuffer(bytes.data(), bytes.size()));
+
+  // Sorted, and the first of the duplicates is kept.
+  ASSERT_EQ(4, data_set.size());
+  EXPECT_EQ(0x00080060, data_set[0]->tag());
+  EXPECT_EQ(0x00100010, data_set[1]->tag());
+  EXPECT_EQ(0x00100020, data_set[2]->tag());
+  EXPECT_EQ(0x0040A730, data_set[3]->tag());
+
+  EXPECT_EQ("CT", data_set.GetString(0x00080060));
+  EXPECT_EQ("ID01", data_set.GetString(0x00100020));
+
+  const dcm::DataSequence* sequence = data_set.GetSequence(0x0040A730);
+  ASSERT_TRUE(sequence != nullptr);
+  ASSERT_EQ(1, sequence->size());
+
+  const dcm::DataSet* item = sequence->At(0).data_set;
+  ASSERT_EQ(2, item->size());
+  EXPECT_EQ("CODE01", item->GetString(0x00080100));
+  EXPECT_EQ("TEXT", item->GetString(0x0040A040));
+}
+
+TEST(DicomReaderTest, SequenceWithoutItem) {
+  std::string bytes(128, '\0');
+  bytes += "DICM";
+
+  AppendElement(&bytes, 0x0010, 0x0020, "LO", "ID01");
+
+  // A sequence with elements (and a nested sequence) but no item.
+  bytes.append("\x40\x00\x30\xA7SQ\0\0\xFF\xFF\xFF\xFF", 12);
+  AppendElement(&bytes, 0x0040, 0xA040, "CS", "TEXT");
+  bytes.append("\x08\x00\x15\x11SQ\0\0\xFF\xFF\xFF\xFF", 12);
+  bytes.append("\xFE\xFF\x00\xE0\xFF\xFF\xFF\xFF", 8);
+  AppendElement(&bytes, 0x0008, 0x0100, "SH", "CODE01");
+  bytes.append("\xFE\xFF\x0D\xE0\0\0\0\0", 8);
+  bytes.append("\xFE\xFF\xDD\xE0\0\0\0\0", 8);
+  bytes.append("\xFE\xFF\xDD\xE0\0\0\0\0", 8);
+
+  AppendElement(&bytes, 0x0040, 0xA732, "SH", "AB");
+
+  dcm::DataSet data_set;
+  dcm::FullReadHandler read_handler(&data_set);
+  dcm::DicomReader reader(&read_handler);
+
+  ASSERT_TRUE(reader.ReadBuffer(bytes.data(), bytes.size()));
+
+  // The elements not in any item are dropped.
+  ASSERT_EQ(3, data_set.size());
+  EXPECT_EQ(0x00100020, data_set[0]->tag());
+  EXPECT_EQ(0x0040A730, data_set[1]->tag());
+  EXPECT_EQ(0x0040A732, data_set[2]->tag());
+
+  const dcm::DataSequence* sequence = data_set.GetSequence(0x0040A730);
+  ASSERT_TRUE(sequence != nullptr);
+  EXPECT_EQ(0, sequence->size());
+}
+
+namespace {
+
+// Implicit VR Little Endian with private tags, some of which are registered.
+std::string MakePrivateTagsImplicit() {
+  dcm::dict::RegisterPrivate("ACME 1.0 ", {
+    { 0x01, dcm::VR::US, "AcmeCount" },
+    { 0x02, dcm::VR::SH, "AcmeCode" },
+  });
+
+  std::string bytes(128, '\0');
+  bytes += "DICM";
+
+  AppendElement(&bytes, 0x0002, 0x0010, "UI",
+                std::string("1.2.840.10008.1.2\0", 18));
+
+  AppendImplicitElement(&bytes, 0x0009, 0x0010, "ACME 1.0");
+  AppendImplicitElement(&bytes, 0x0009, 0x0011, "OTHER ");
+  AppendImplicitElement(&bytes, 0x0009, 0x1001, std::string("\x02\x01", 2));
+  AppendImplicitElement(&bytes, 0x0009, 0x1002, "CODE");
+  AppendImplicitElement(&bytes, 0x0009, 0x1101, "AB");  // Another creator
+  AppendImplicitElement(&bytes, 0x0009, 0x1201, "AB");  // No creator
+
+  // The creators of the root data set don't apply to the items.
+  bytes.append("\x40\x00\x30\xA7\xFF\xFF\xFF\xFF", 8);
+  bytes.append("\xFE\xFF\x00\xE0\xFF\xFF\xFF\xFF", 8);
+  AppendImplicitElement(&bytes, 0x0009, 0x1001, "AB");
+  bytes.append("\xFE\xFF\x0D\xE0\0\0\0\0", 8);
+  bytes.append("\xFE\xFF\xDD\xE0\0\0\0\0", 8);
+
+  return bytes;
+}
+
+void CheckPrivateTagsImplicit(const dcm::DataSet& data_set) {
+  EXPECT_EQ(dcm::VR::LO, data_set.Get(0x00090010)->vr());
+  EXPECT_EQ("ACME 1.0", data_set.GetString(0x00090010));
+
+  EXPECT_EQ(dcm::VR::US, data_set.Get(0x00091001)->vr());
+  std::uint16_t count = 0;
+  EXPECT_TRUE(data_set.GetUint16(0x00091001, &count));
+  EXPECT_EQ(0x0102, count);
+
+  EXPECT_EQ(dcm::VR::SH, data_set.Get(0x00091002)->vr());
+  EXPECT_EQ("CODE", data_set.GetString(0x00091002));
+
+  EXPECT_EQ(dcm::VR::UN, data_set.Get(0x00091101)->vr());
+  EXPECT_EQ(dcm::VR::UN, data_set.Get(0x00091201)->vr());
+
+  const dcm::DataSequence* sequence = data_set.GetSequence(0x0040A730);
+  ASSERT_TRUE(sequence != nullptr);
+  ASSERT_EQ(1, sequence->size());
+
+  const dcm::DataSet* item = sequence->At(0).data_set;
+  EXPECT_EQ(dcm::VR::UN, item->Get(0x00091001)->vr());
+}
+
+}  // namespace
+
+TEST(DicomReaderTest, PrivateTags_Implicit) {
+  const std::string bytes = MakePrivateTagsImplicit();
+
+  dcm::DataSet data_set;
+  dcm::FullReadHandler read_handler(&data_set);
+  dcm::DicomReader reader(&read_handler);
+
+  ASSERT_TRUE(reader.ReadBuffer(bytes.data(), bytes.size()));
+
+  CheckPrivateTagsImplicit(data_set);
+}
+
+// The same data read by the other readers sharing the header parsing.
+TEST(IncrementalReaderTest, PrivateTags_Implicit) {
+  const std::string bytes = MakePrivateTagsImplicit();
+
+  dcm::DataSet data_set;
+  dcm::FullReadHandler read_handler(&data_set);
+  dcm::IncrementalReader reader(&read_handler);
+
+  // Split the headers across the chunks.
+  for (std::size_t pos = 0; pos < bytes.size(); pos += 7) {
+    reader.Feed(bytes.data() + pos,
+                std::min<std::size_t>(7, bytes.size() - pos));
+  }
+  ASSERT_TRUE(reader.Finish());
+
+  CheckPrivateTagsImplicit(data_set);
+}
+
+TEST(DicomCursorTest, PrivateTags_Implicit) {
+  const std::string bytes = MakePrivateTagsImplicit();
+
+  dcm::DicomCursor cursor;
+  ASSERT_TRUE(cursor.OpenBuffer(bytes.data(), bytes.size()));
+
+  // The creators are skipped, but read by the cursor itself.
+  std::vector<std::pair<std::uint32_t, dcm::VR>> vrs;
+
+  dcm::DicomCursor::Event event;
+  while (cursor.Next(&event)) {
+    if (event.type == dcm::DicomCursor::Event::ELEMENT &&
+        event.tag.group() == 0x0009) {
+      vrs.emplace_back(event.tag.ToUint32(), event.vr);
+    }
+  }
+
+  std::vector<std::pair<std::uint32_t, dcm::VR>> expected = {
+    { 0x00090010, dcm::VR::LO },
+    { 0x00090011, dcm::VR::LO },
+    { 0x00091001, dcm::VR::US },
+    { 0x00091002, dcm::VR::SH },
+    { 0x00091101, dcm::VR::UN },
+    { 0x00091201, dcm::VR::UN },
+    { 0x00091001, dcm::VR::UN },  // In the item
+  };
+  EXPECT_EQ(expected, vrs);
+}
+
+TEST(DicomReaderTest, TransferSyntaxes) {
+  const char* kFiles[] = {
+    "Implicit Little (CT-MONO2-16-ankle).dcm",
+    "Explicit Big (US-RGB-8-epicard).dcm",
+    "Explicit Little (CT-MONO2-16-brain).dcm",
+    "Implicit Little NoMeta (OT-MONO2-8-hip).dcm",
+  };
+
+  dcm::DataSet data_set;
+  dcm::FullReadHandler read_handler(&data_set);
+  dcm::DicomReader reader(&read_handler);
+
+  for (const char* file : kFiles) {
+    dcm::Path path(g_data_dir);
+    path /= file;
+
+    dcm::DicomFile dicom_file(path);
+    ASSERT_TRUE(dicom_file.Load());
+
+    data_set.Clear();
+    EXPECT_TRUE(reader.ReadFile(path));
+
+    EXPECT_EQ(dicom_file.vr_type(), data_set.vr_type()) << file;
+    EXPECT_EQ(dicom_file.byte_order(), data_set.byte_order()) << file;
+    ASSERT_EQ(dicom_file.size(), data_set.size()) << file;
+
+    for (std::size_t i = 0; i < data_set.size(); ++i) {
+      EXPECT_EQ(dicom_file.At(i)->tag(), data_set.At(i)->tag()) << file;
+      EXPECT_EQ(dicom_file.At(i)->length(), data_set.At(i)->length()) << file;
+    }
+  }
+}
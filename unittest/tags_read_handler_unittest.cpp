@@ -0,0 +1,114 @@
+#include "gtest/gtest.h"
+
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include "dcm/arena.h"
+#include "dcm/data_set.h"
+#include "dcm/dicom_file.h"
+#include "dcm/dicom_reader.h"
+#include "dcm/tags_read_handler.h"
+
+extern std::string g_data_dir;
+
+TEST(TagsReadHandlerTest, ReadTags) {
+  dcm::Path path(g_data_dir);
+  path /= "Explicit Little (CT-MONO2-16-brain).dcm";
+
+  dcm::DataSet data_set;
+  dcm::TagsReadHandler handler(&data_set);
+
+  // Not in order, and one is duplicated.
+  handler.AddTag(dcm::tags::kRows)
+      .AddTag(dcm::tags::kModality)
+      .AddTag(dcm::tags::kPatientName)
+      .AddTag(dcm::tags::kModality);
+
+  std::ifstream stream(path.string(), std::ios::binary);
+
+  dcm::DicomReader reader(&handler);
+  EXPECT_TRUE(reader.ReadStream(&stream));
+
+  EXPECT_TRUE(handler.should_stop());
+
+  // Stopped after the first block, long before the pixel data.
+  EXPECT_LT(stream.tellg(), 100 * 1024);
+
+  ASSERT_EQ(3, data_set.size());
+  EXPECT_EQ(dcm::tags::kModality, data_set.At(0)->tag());
+  EXPECT_EQ(dcm::tags::kPatientName, data_set.At(1)->tag());
+  EXPECT_EQ(dcm::tags::kRows, data_set.At(2)->tag());
+
+  EXPECT_EQ(dcm::ByteOrder::LE, data_set.byte_order());
+  EXPECT_EQ(dcm::VR::EXPLICIT, data_set.vr_type());
+
+  // Compare with the full data set.
+  dcm::DicomFile dicom_file(path);
+  ASSERT_TRUE(dicom_file.Load());
+
+  EXPECT_EQ(dicom_file.GetString(dcm::tags::kModality),
+            data_set.GetString(dcm::tags::kModality));
+  EXPECT_EQ(dicom_file.GetString(dcm::tags::kPatientName),
+            data_set.GetString(dcm::tags::kPatientName));
+
+  std::uint16_t rows = 0;
+  EXPECT_TRUE(data_set.GetUint16(dcm::tags::kRows, &rows));
+  EXPECT_EQ(512, rows);
+}
+
+TEST(TagsReadHandlerTest, Absent) {
+  dcm::Path path(g_data_dir);
+  path /= "Implicit Little NoMeta (CR-MONO1-10-chest).dcm";
+
+  dcm::DataSet data_set;
+  dcm::TagsReadHandler handler(&data_set);
+
+  // The group 0002 is absent.
+  handler.AddTag(dcm::tags::kTransferSyntaxUID)
+      .AddTag(dcm::tags::kSOPInstanceUID);
+
+  dcm::DicomReader reader(&handler);
+  EXPECT_TRUE(reader.ReadFile(path));
+
+  EXPECT_TRUE(handler.should_stop());
+
+  ASSERT_EQ(1, data_set.size());
+  EXPECT_EQ("1.2.392.200036.9125.0.19950720112207",
+            data_set.GetString(dcm::tags::kSOPInstanceUID));
+}
+
+TEST(TagsReadHandlerTest, Arena) {
+  std::string bytes(128, '\0');
+  bytes += "DICM";
+
+  // (0008,0060) CS "CT"
+  bytes.append("\x08\x00\x60\x00" "CS\x02\x00" "CT", 10);
+
+  // (0040,A730) SQ, not requested, with an item of (0008,0100) SH "CODE01".
+  bytes.append("\x40\x00\x30\xA7" "SQ\0\0" "\xFF\xFF\xFF\xFF", 12);
+  bytes.append("\xFE\xFF\x00\xE0\xFF\xFF\xFF\xFF", 8);
+  bytes.append("\x08\x00\x00\x01" "SH\x06\x00" "CODE01", 14);
+  bytes.append("\xFE\xFF\x0D\xE0\0\0\0\0", 8);
+  bytes.append("\xFE\xFF\xDD\xE0\0\0\0\0", 8);
+
+  // (0040,A731) SH "ABCD"
+  bytes.append("\x40\x00\x31\xA7" "SH\x04\x00" "ABCD", 12);
+
+  auto arena = std::make_shared<dcm::Arena>();
+
+  dcm::DataSet data_set;
+  data_set.set_arena(arena);
+
+  dcm::TagsReadHandler handler(&data_set);
+  handler.AddTag(dcm::tags::kModality).AddTag(0x0040A731);
+
+  // The skipped sequence is allocated from the arena too.
+  dcm::DicomReader reader(&handler);
+  reader.set_arena(arena);
+  EXPECT_TRUE(reader.ReadBuffer(bytes.data(), bytes.size()));
+
+  ASSERT_EQ(2, data_set.size());
+  EXPECT_EQ("CT", data_set.GetString(dcm::tags::kModality));
+  EXPECT_EQ("ABCD", data_set.GetString(0x0040A731));
+}
@@ -0,0 +1,57 @@
+#include "gtest/gtest.h"
+
+#include <vector>
+
+#include "dcm/util.h"
+
+namespace {
+
+// Values of |size| bytes: 0x01 0x02 ... 0x0N, 0x11 0x12 ... 0x1N, etc.
+std::vector<char> MakeValues(std::size_t size, std::size_t count) {
+  std::vector<char> values;
+  for (std::size_t i = 0; i < count; ++i) {
+    for (std::size_t j = 0; j < size; ++j) {
+      values.push_back(static_cast<char>(((i & 0xF) << 4) | (j + 1)));
+    }
+  }
+  return values;
+}
+
+}  // namespace
+
+TEST(UtilTest, SwapBytes) {
+  EXPECT_EQ(0x3412, dcm::util::SwapUint16(0x1234));
+  EXPECT_EQ(0x78563412u, dcm::util::SwapUint32(0x12345678));
+
+  char bytes[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+  dcm::util::SwapBytes(bytes, 8);
+  EXPECT_EQ(std::vector<char>({ 8, 7, 6, 5, 4, 3, 2, 1 }),
+            std::vector<char>(bytes, bytes + 8));
+}
+
+TEST(UtilTest, SwapBytes_Array) {
+  // Counts across the vector widths, with tails handled one by one.
+  for (std::size_t size : { 2, 4, 8 }) {
+    for (std::size_t count = 0; count < 100; ++count) {
+      std::vector<char> expected = MakeValues(size, count);
+      for (std::size_t i = 0; i < count; ++i) {
+        dcm::util::SwapBytes(&expected[i * size], size);
+      }
+
+      // Also unaligned.
+      for (std::size_t offset : { 0, 1 }) {
+        std::vector<char> values = MakeValues(size, count);
+        values.insert(values.begin(), offset, '\0');
+
+        dcm::util::SwapBytes(values.data() + offset, size, count);
+        EXPECT_EQ(expected, std::vector<char>(values.begin() + offset,
+                                              values.end()))
+            << dcm::util::GetSwapKernelName() << " " << size << " " << count;
+      }
+
+      std::vector<char> values = MakeValues(size, count);
+      dcm::util::SwapBytesScalar(values.data(), size, count);
+      EXPECT_EQ(expected, values) << size << " " << count;
+    }
+  }
+}